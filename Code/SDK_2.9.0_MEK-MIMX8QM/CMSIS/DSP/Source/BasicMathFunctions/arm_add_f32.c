@@ -66,7 +66,67 @@ void arm_add_f32(
 {
         uint32_t blkCnt;                               /* Loop counter */
 
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_AVX2)
+    __m256 vec1;
+    __m256 vec2;
+    __m256 res;
+
+    /* Compute 8 outputs at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A + B */
+
+        /* Add and then store the results in the destination buffer. */
+        vec1 = _mm256_loadu_ps(pSrcA);
+        vec2 = _mm256_loadu_ps(pSrcB);
+        res = _mm256_add_ps(vec1, vec2);
+        _mm256_storeu_ps(pDst, res);
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x7;
+
+#elif defined(ARM_MATH_SSE41)
+    __m128 vec1;
+    __m128 vec2;
+    __m128 res;
+
+    /* Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A + B */
+
+        /* Add and then store the results in the destination buffer. */
+        vec1 = _mm_loadu_ps(pSrcA);
+        vec2 = _mm_loadu_ps(pSrcB);
+        res = _mm_add_ps(vec1, vec2);
+        _mm_storeu_ps(pDst, res);
+
+        /* Increment pointers */
+        pSrcA += 4;
+        pSrcB += 4;
+        pDst += 4;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x3;
+
+#elif defined(ARM_MATH_NEON)
     float32x4_t vec1;
     float32x4_t vec2;
     float32x4_t res;
@@ -125,7 +185,7 @@ void arm_add_f32(
   blkCnt = blockSize;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   while (blkCnt > 0U)
   {
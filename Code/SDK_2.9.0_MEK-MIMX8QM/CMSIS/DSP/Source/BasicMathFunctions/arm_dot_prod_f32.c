@@ -68,7 +68,65 @@ void arm_dot_prod_f32(
         uint32_t blkCnt;                               /* Loop counter */
         float32_t sum = 0.0f;                          /* Temporary return variable */
 
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_AVX2)
+    __m256 vec1;
+    __m256 vec2;
+    __m256 accum = _mm256_setzero_ps();
+
+    /* Compute 8 products at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
+        /* 8 partial sums, added together after the loop */
+        vec1 = _mm256_loadu_ps(pSrcA);
+        vec2 = _mm256_loadu_ps(pSrcB);
+        accum = _mm256_add_ps(accum, _mm256_mul_ps(vec1, vec2));
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = __arm_vec_hsum_f32_avx(accum);
+
+    /* Tail */
+    blkCnt = blockSize & 0x7;
+
+#elif defined(ARM_MATH_SSE41)
+    __m128 vec1;
+    __m128 vec2;
+    __m128 accum = _mm_setzero_ps();
+
+    /* Compute 4 products at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A[0]*B[0] + A[1]*B[1] + A[2]*B[2] + ... + A[blockSize-1]*B[blockSize-1] */
+        /* 4 partial sums, added together after the loop */
+        vec1 = _mm_loadu_ps(pSrcA);
+        vec2 = _mm_loadu_ps(pSrcB);
+        accum = _mm_add_ps(accum, _mm_mul_ps(vec1, vec2));
+
+        /* Increment pointers */
+        pSrcA += 4;
+        pSrcB += 4;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    sum = __arm_vec_hsum_f32_sse(accum);
+
+    /* Tail */
+    blkCnt = blockSize & 0x3;
+
+#elif defined(ARM_MATH_NEON)
     float32x4_t vec1;
     float32x4_t vec2;
     float32x4_t res;
@@ -141,7 +199,7 @@ void arm_dot_prod_f32(
   blkCnt = blockSize;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   while (blkCnt > 0U)
   {
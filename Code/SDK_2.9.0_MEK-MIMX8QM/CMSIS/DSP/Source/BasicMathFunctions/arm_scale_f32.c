@@ -80,7 +80,61 @@ void arm_scale_f32(
         uint32_t blockSize)
 {
   uint32_t blkCnt;                               /* Loop counter */
-#if defined(ARM_MATH_NEON_EXPERIMENTAL)
+#if defined(ARM_MATH_AVX2)
+    __m256 vec1;
+    __m256 res;
+
+    /* Compute 8 outputs at a time */
+    blkCnt = blockSize >> 3U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A * scale */
+
+        /* Scale the input and then store the results in the destination buffer. */
+        vec1 = _mm256_loadu_ps(pSrc);
+        res = _mm256_mul_ps(vec1, _mm256_set1_ps(scale));
+        _mm256_storeu_ps(pDst, res);
+
+        /* Increment pointers */
+        pSrc += 8;
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x7;
+
+#elif defined(ARM_MATH_SSE41)
+    __m128 vec1;
+    __m128 res;
+
+    /* Compute 4 outputs at a time */
+    blkCnt = blockSize >> 2U;
+
+    while (blkCnt > 0U)
+    {
+        /* C = A * scale */
+
+        /* Scale the input and then store the results in the destination buffer. */
+        vec1 = _mm_loadu_ps(pSrc);
+        res = _mm_mul_ps(vec1, _mm_set1_ps(scale));
+        _mm_storeu_ps(pDst, res);
+
+        /* Increment pointers */
+        pSrc += 4;
+        pDst += 4;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = blockSize & 0x3;
+
+#elif defined(ARM_MATH_NEON_EXPERIMENTAL)
     float32x4_t vec1;
     float32x4_t res;
 
@@ -139,7 +193,7 @@ void arm_scale_f32(
   blkCnt = blockSize;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON_EXPERIMENTAL) */
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   while (blkCnt > 0U)
   {
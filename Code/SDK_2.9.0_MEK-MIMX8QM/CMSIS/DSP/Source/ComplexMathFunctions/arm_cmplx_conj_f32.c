@@ -76,7 +76,63 @@ void arm_cmplx_conj_f32(
 {
         uint32_t blkCnt;                               /* Loop counter */
 
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_AVX2)
+   __m256 sign;
+   __m256 vec;
+
+   /* Sign bits of the imaginary parts */
+   sign = _mm256_castsi256_ps(_mm256_set1_epi64x(0x8000000000000000LL));
+
+   /* Compute 4 outputs at a time */
+   blkCnt = numSamples >> 2U;
+
+   while (blkCnt > 0U)
+   {
+     /* C[0]+jC[1] = A[0]+(-1)*jA[1] */
+     /* Calculate Complex Conjugate and then store the results in the destination buffer. */
+     vec = _mm256_loadu_ps(pSrc);
+     _mm256_storeu_ps(pDst, _mm256_xor_ps(vec, sign));
+
+     /* Increment pointers */
+     pSrc += 8;
+     pDst += 8;
+
+     /* Decrement the loop counter */
+     blkCnt--;
+   }
+
+   /* Tail */
+   blkCnt = numSamples & 0x3;
+
+#elif defined(ARM_MATH_SSE41)
+   __m128 sign;
+   __m128 vec;
+
+   /* Sign bits of the imaginary parts */
+   sign = _mm_castsi128_ps(_mm_set1_epi64x(0x8000000000000000LL));
+
+   /* Compute 2 outputs at a time */
+   blkCnt = numSamples >> 1U;
+
+   while (blkCnt > 0U)
+   {
+     /* C[0]+jC[1] = A[0]+(-1)*jA[1] */
+     /* Calculate Complex Conjugate and then store the results in the destination buffer. */
+     vec = _mm_loadu_ps(pSrc);
+     _mm_storeu_ps(pDst, _mm_xor_ps(vec, sign));
+
+     /* Increment pointers */
+     pSrc += 4;
+     pDst += 4;
+
+     /* Decrement the loop counter */
+     blkCnt--;
+   }
+
+   /* Tail */
+   blkCnt = numSamples & 0x1;
+
+#elif defined(ARM_MATH_NEON)
    float32x4_t zero;
    float32x4x2_t vec;
 
@@ -140,7 +196,7 @@ void arm_cmplx_conj_f32(
   blkCnt = numSamples;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined (ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   while (blkCnt > 0U)
   {
@@ -77,8 +77,72 @@ void arm_cmplx_mag_f32(
   uint32_t blkCnt;                               /* loop counter */
   float32_t real, imag;                      /* Temporary variables to hold input values */
 
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_AVX2)
 
+  __m256 vecA;
+  __m256 vecB;
+  __m256 vMagSq;
+
+  /* Compute 8 outputs at a time */
+  blkCnt = numSamples >> 3;
+
+  while (blkCnt > 0U)
+  {
+    /* out = sqrt((real * real) + (imag * imag)) */
+
+    vecA = _mm256_loadu_ps(pSrc);
+    vecB = _mm256_loadu_ps(pSrc + 8);
+    pSrc += 16;
+
+    vecA = _mm256_mul_ps(vecA, vecA);
+    vecB = _mm256_mul_ps(vecB, vecB);
+
+    /* hadd works in 128-bit lanes, the permute restores the order of the samples */
+    vMagSq = _mm256_hadd_ps(vecA, vecB);
+    vMagSq = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(vMagSq), 0xD8));
+
+    /* Store the result in the destination buffer. */
+    _mm256_storeu_ps(pDst, _mm256_sqrt_ps(vMagSq));
+    pDst += 8;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = numSamples & 7;
+
+#elif defined(ARM_MATH_SSE41)
+
+  __m128 vecA;
+  __m128 vecB;
+  __m128 vMagSq;
+
+  /* Compute 4 outputs at a time */
+  blkCnt = numSamples >> 2;
+
+  while (blkCnt > 0U)
+  {
+    /* out = sqrt((real * real) + (imag * imag)) */
+
+    vecA = _mm_loadu_ps(pSrc);
+    vecB = _mm_loadu_ps(pSrc + 4);
+    pSrc += 8;
+
+    vecA = _mm_mul_ps(vecA, vecA);
+    vecB = _mm_mul_ps(vecB, vecB);
+    vMagSq = _mm_hadd_ps(vecA, vecB);
+
+    /* Store the result in the destination buffer. */
+    _mm_storeu_ps(pDst, _mm_sqrt_ps(vMagSq));
+    pDst += 4;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  blkCnt = numSamples & 3;
+
+#elif defined(ARM_MATH_NEON)
   float32x4x2_t vecA;
   float32x4_t vRealA;
   float32x4_t vImagA;
@@ -165,7 +229,7 @@ void arm_cmplx_mag_f32(
   blkCnt = numSamples;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   while (blkCnt > 0U)
   {
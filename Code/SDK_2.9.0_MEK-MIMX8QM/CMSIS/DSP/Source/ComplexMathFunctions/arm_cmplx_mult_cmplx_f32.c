@@ -77,7 +77,71 @@ void arm_cmplx_mult_cmplx_f32(
     uint32_t blkCnt;                               /* Loop counter */
     float32_t a, b, c, d;  /* Temporary variables to store real and imaginary values */
 
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_AVX2)
+    __m256 va, vb, vc;
+
+    /* Compute 4 outputs at a time */
+    blkCnt = numSamples >> 2U;
+
+    while (blkCnt > 0U)
+    {
+        va = _mm256_loadu_ps(pSrcA);
+        vb = _mm256_loadu_ps(pSrcB);
+
+        /* Increment pointers */
+        pSrcA += 8;
+        pSrcB += 8;
+
+        /* Re{A}*Re{B}, Im{A}*Re{B} and Im{A}*Im{B}, Re{A}*Im{B} */
+        vc = _mm256_mul_ps(va, _mm256_moveldup_ps(vb));
+        va = _mm256_mul_ps(_mm256_permute_ps(va, 0xB1), _mm256_movehdup_ps(vb));
+
+        /* Re{C} = Re{A}*Re{B} - Im{A}*Im{B}, Im{C} = Im{A}*Re{B} + Re{A}*Im{B} */
+        _mm256_storeu_ps(pDst, _mm256_addsub_ps(vc, va));
+
+        /* Increment pointer */
+        pDst += 8;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples & 3;
+
+#elif defined(ARM_MATH_SSE41)
+    __m128 va, vb, vc;
+
+    /* Compute 2 outputs at a time */
+    blkCnt = numSamples >> 1U;
+
+    while (blkCnt > 0U)
+    {
+        va = _mm_loadu_ps(pSrcA);
+        vb = _mm_loadu_ps(pSrcB);
+
+        /* Increment pointers */
+        pSrcA += 4;
+        pSrcB += 4;
+
+        /* Re{A}*Re{B}, Im{A}*Re{B} and Im{A}*Im{B}, Re{A}*Im{B} */
+        vc = _mm_mul_ps(va, _mm_moveldup_ps(vb));
+        va = _mm_mul_ps(_mm_shuffle_ps(va, va, 0xB1), _mm_movehdup_ps(vb));
+
+        /* Re{C} = Re{A}*Re{B} - Im{A}*Im{B}, Im{C} = Im{A}*Re{B} + Re{A}*Im{B} */
+        _mm_storeu_ps(pDst, _mm_addsub_ps(vc, va));
+
+        /* Increment pointer */
+        pDst += 4;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* Tail */
+    blkCnt = numSamples & 1;
+
+#elif defined(ARM_MATH_NEON)
     float32x4x2_t va, vb;
     float32x4_t real, imag;
     float32x4x2_t outCplx;
@@ -167,7 +231,7 @@ void arm_cmplx_mult_cmplx_f32(
   blkCnt = numSamples;
 
 #endif /* #if defined (ARM_MATH_LOOPUNROLL) */
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_AVX2) */
 
   while (blkCnt > 0U)
   {
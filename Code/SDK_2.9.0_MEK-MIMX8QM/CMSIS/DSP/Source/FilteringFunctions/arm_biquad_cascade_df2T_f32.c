@@ -46,7 +46,159 @@
   @return        none
  */
 
-#if defined(ARM_MATH_NEON) 
+#if defined(ARM_MATH_SSE41)
+
+void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pIn = pSrc;                         /* Source pointer */
+        float32_t *pOut = pDst;                        /* Destination pointer */
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t acc1;                                /* Accumulator */
+        float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients */
+        float32_t Xn1;                                 /* Temporary input */
+        float32_t d1, d2;                              /* State variables */
+        float32_t d1v[4], d2v[4];                      /* State variables of 4 stages */
+        uint32_t n, sample, stageCnt, stage = S->numStages;   /* Loop counters */
+        __m128 b0V, b1V, b2V, a1V, a2V;                /* Coefficients, stage k in lane k */
+        __m128 XnV, YnV, d1V, d2V, d1N, d2N, active;
+        __m128i idx;
+
+  /* The recursion of a stage cannot be vectorized over the samples, 4 stages run in
+   * parallel instead, as a pipeline: at step n lane k computes sample n - k of stage k,
+   * with the output of lane k - 1 at step n - 1 as input. The coefficients keep the
+   * layout of the scalar code and every lane does the operations of the scalar code,
+   * in the same order, so the output is the same bit for bit. */
+  stageCnt = stage >> 2U;
+
+  while (stageCnt > 0U)
+  {
+    /* Reading the coefficients */
+    b0V = _mm_setr_ps(pCoeffs[0], pCoeffs[5], pCoeffs[10], pCoeffs[15]);
+    b1V = _mm_setr_ps(pCoeffs[1], pCoeffs[6], pCoeffs[11], pCoeffs[16]);
+    b2V = _mm_setr_ps(pCoeffs[2], pCoeffs[7], pCoeffs[12], pCoeffs[17]);
+    a1V = _mm_setr_ps(pCoeffs[3], pCoeffs[8], pCoeffs[13], pCoeffs[18]);
+    a2V = _mm_setr_ps(pCoeffs[4], pCoeffs[9], pCoeffs[14], pCoeffs[19]);
+    pCoeffs += 20U;
+
+    /* Reading the state values */
+    d1V = _mm_setr_ps(pState[0], pState[2], pState[4], pState[6]);
+    d2V = _mm_setr_ps(pState[1], pState[3], pState[5], pState[7]);
+
+    XnV = _mm_setzero_ps();
+
+    for (n = 0U; n < (blockSize + 3U); n++)
+    {
+      /* Lane 0 reads the input, lanes 1 to 3 hold the outputs of the previous step */
+      XnV = _mm_move_ss(XnV, _mm_set_ss((n < blockSize) ? pIn[n] : 0.0f));
+
+      /* y[n] = b0 * x[n] + d1 */
+      YnV = _mm_add_ps(_mm_mul_ps(b0V, XnV), d1V);
+
+      /* d1 = b1 * x[n] + d2 + a1 * y[n] */
+      d1N = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b1V, XnV), d2V), _mm_mul_ps(a1V, YnV));
+
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      d2N = _mm_add_ps(_mm_mul_ps(b2V, XnV), _mm_mul_ps(a2V, YnV));
+
+      if ((n < 3U) || (n >= blockSize))
+      {
+        /* Filling or draining the pipeline: only the lanes with 0 <= n - k < blockSize
+         * hold a sample, the others keep their state */
+        idx = _mm_sub_epi32(_mm_set1_epi32((int32_t) n), _mm_setr_epi32(0, 1, 2, 3));
+        active = _mm_castsi128_ps(_mm_andnot_si128(_mm_cmplt_epi32(idx, _mm_setzero_si128()),
+                                                   _mm_cmplt_epi32(idx, _mm_set1_epi32((int32_t) blockSize))));
+        d1V = _mm_blendv_ps(d1V, d1N, active);
+        d2V = _mm_blendv_ps(d2V, d2N, active);
+      }
+      else
+      {
+        d1V = d1N;
+        d2V = d2N;
+      }
+
+      /* Lane 3 completes sample n - 3 of the 4 stages */
+      if (n >= 3U)
+      {
+        pOut[n - 3U] = _mm_cvtss_f32(_mm_shuffle_ps(YnV, YnV, 0xFF));
+      }
+
+      /* The outputs of lanes 0 to 2 are the inputs of lanes 1 to 3 at the next step */
+      XnV = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(YnV), 4));
+    }
+
+    /* Store the updated state variables back into the state array */
+    _mm_storeu_ps(d1v, d1V);
+    _mm_storeu_ps(d2v, d2V);
+    for (n = 0U; n < 4U; n++)
+    {
+      *pState++ = d1v[n];
+      *pState++ = d2v[n];
+    }
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* decrement the loop counter */
+    stageCnt--;
+  }
+
+  /* Tail */
+  stageCnt = stage & 3U;
+
+  while (stageCnt > 0U)
+  {
+    /* Reading the coefficients */
+    b0 = pCoeffs[0];
+    b1 = pCoeffs[1];
+    b2 = pCoeffs[2];
+    a1 = pCoeffs[3];
+    a2 = pCoeffs[4];
+    pCoeffs += 5U;
+
+    /* Reading the state values */
+    d1 = pState[0];
+    d2 = pState[1];
+
+    sample = blockSize;
+
+    while (sample > 0U)
+    {
+      Xn1 = *pIn++;
+
+      acc1 = b0 * Xn1 + d1;
+
+      d1 = b1 * Xn1 + d2;
+      d1 += a1 * acc1;
+
+      d2 = b2 * Xn1;
+      d2 += a2 * acc1;
+
+      *pOut++ = acc1;
+
+      /* decrement loop counter */
+      sample--;
+    }
+
+    /* Store the updated state variables back into the state array */
+    *pState++ = d1;
+    *pState++ = d2;
+
+    /* The current stage input is given as the output to the next stage */
+    pIn = pDst;
+
+    /* Reset the output working pointer */
+    pOut = pDst;
+
+    /* decrement the loop counter */
+    stageCnt--;
+  }
+}
+#elif defined(ARM_MATH_NEON)
 
 void arm_biquad_cascade_df2T_f32(
   const arm_biquad_cascade_df2T_instance_f32 * S,
@@ -516,7 +668,7 @@ void arm_biquad_cascade_df2T_f32(
 
 }
 LOW_OPTIMIZATION_EXIT
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_SSE41) */
 
 /**
   @} end of BiquadCascadeDF2T group
@@ -0,0 +1,170 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_f32.c
+ * Description:  Processing function for floating-point transposed direct form II Biquad cascade filter, N interleaved channels
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Channels filtered together, their recurrences are independent and can be scheduled or vectorized together */
+#define MULTI_GROUP     4U
+
+/*
+ * One stage of channels ch .. ch+MULTI_GROUP-1. The coefficients and state of
+ * channel c and stage s are at pCoeffs[5 * (c * numStages + s)] and
+ * pState[2 * (c * numStages + s)].
+ */
+static void arm_biquad_multi_df2T_group_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+        uint32_t ch,
+        uint32_t stage,
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t blockSize)
+{
+  const uint32_t C = S->numChannels;
+  const float32_t *pC;
+        float32_t *pS;
+        float32_t b0[MULTI_GROUP], b1[MULTI_GROUP], b2[MULTI_GROUP], a1[MULTI_GROUP], a2[MULTI_GROUP];
+        float32_t d1[MULTI_GROUP], d2[MULTI_GROUP];
+        float32_t Xn, acc;
+        uint32_t i, sample;
+
+  for (i = 0U; i < MULTI_GROUP; i++)
+  {
+    pC = S->pCoeffs + (5U * (((ch + i) * S->numStages) + stage));
+    pS = S->pState + (2U * (((ch + i) * S->numStages) + stage));
+    b0[i] = pC[0];
+    b1[i] = pC[1];
+    b2[i] = pC[2];
+    a1[i] = pC[3];
+    a2[i] = pC[4];
+    d1[i] = pS[0];
+    d2[i] = pS[1];
+  }
+
+  pIn += ch;
+  pOut += ch;
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    for (i = 0U; i < MULTI_GROUP; i++)
+    {
+      /* y[n] = b0 * x[n] + d1 */
+      /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+      /* d2 = b2 * x[n] + a2 * y[n] */
+      Xn = pIn[i];
+      acc = (b0[i] * Xn) + d1[i];
+      pOut[i] = acc;
+      d1[i] = ((b1[i] * Xn) + (a1[i] * acc)) + d2[i];
+      d2[i] = (b2[i] * Xn) + (a2[i] * acc);
+    }
+    pIn += C;
+    pOut += C;
+  }
+
+  for (i = 0U; i < MULTI_GROUP; i++)
+  {
+    pS = S->pState + (2U * (((ch + i) * S->numStages) + stage));
+    pS[0] = d1[i];
+    pS[1] = d2[i];
+  }
+}
+
+/* Same as above for the single channel ch */
+static void arm_biquad_multi_df2T_single_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+        uint32_t ch,
+        uint32_t stage,
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t blockSize)
+{
+  const uint32_t C = S->numChannels;
+  const float32_t *pC = S->pCoeffs + (5U * ((ch * S->numStages) + stage));
+        float32_t *pS = S->pState + (2U * ((ch * S->numStages) + stage));
+        float32_t b0 = pC[0], b1 = pC[1], b2 = pC[2], a1 = pC[3], a2 = pC[4];
+        float32_t d1 = pS[0], d2 = pS[1];
+        float32_t Xn, acc;
+        uint32_t sample;
+
+  pIn += ch;
+  pOut += ch;
+  for (sample = 0U; sample < blockSize; sample++)
+  {
+    Xn = *pIn;
+    acc = (b0 * Xn) + d1;
+    *pOut = acc;
+    d1 = ((b1 * Xn) + (a1 * acc)) + d2;
+    d2 = (b2 * Xn) + (a2 * acc);
+    pIn += C;
+    pOut += C;
+  }
+
+  pS[0] = d1;
+  pS[1] = d2;
+}
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point transposed direct form II Biquad cascade filter, N interleaved channels.
+  @param[in]     S         points to an instance of the filter data structure
+  @param[in]     pSrc      points to the block of interleaved input data
+  @param[out]    pDst      points to the block of interleaved output data
+  @param[in]     blockSize number of samples per channel to process
+  @return        none
+
+  @par           Details
+                   The buffers hold <code>blockSize</code> frames of <code>numChannels</code> samples, as
+                   received from a TDM interface. Every channel has its own cascade, the channels are
+                   filtered in place in the interleaved buffers, groups of 4 channels at a time, without
+                   deinterleaving. The function can be called in-place (pSrc == pDst).
+ */
+
+void arm_biquad_cascade_multi_df2T_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t C = S->numChannels;
+  const float32_t *pIn;
+        uint32_t ch, stage;
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    /* The first stage reads the input, the next ones work in place on the output */
+    pIn = (stage == 0U) ? pSrc : pDst;
+
+    ch = 0U;
+    while ((ch + MULTI_GROUP) <= C)
+    {
+      arm_biquad_multi_df2T_group_f32(S, ch, stage, pIn, pDst, blockSize);
+      ch += MULTI_GROUP;
+    }
+    while (ch < C)
+    {
+      arm_biquad_multi_df2T_single_f32(S, ch, stage, pIn, pDst, blockSize);
+      ch++;
+    }
+  }
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_biquad_cascade_multi_df2T_init_f32.c
+ * Description:  Initialization function for floating-point transposed direct form II Biquad cascade filter, N interleaved channels
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup BiquadCascadeDF2T
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point transposed direct form II Biquad cascade filter, N interleaved channels.
+  @param[in,out] S           points to an instance of the filter data structure.
+  @param[in]     numChannels number of interleaved channels.
+  @param[in]     numStages   number of 2nd order stages in the filter.
+  @param[in]     pCoeffs     points to the filter coefficients.
+  @param[in]     pState      points to the state buffer.
+  @return        none
+
+  @par           Coefficient and State Ordering
+                   The coefficients of a channel are stored as for \ref arm_biquad_cascade_df2T_init_f32(),
+                   the channels one after the other:
+  <pre>
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}   channel 0
+      {b10, b11, b12, a11, a12, b20, b21, b22, a21, a22, ...}   channel 1
+      ...
+  </pre>
+                   The <code>pCoeffs</code> array contains a total of <code>5*numStages*numChannels</code> values.
+  @par
+                   The <code>pState</code> is a pointer to state array, of length <code>2*numStages*numChannels</code>,
+                   ordered by channel and stage in the same way. The state variables are updated after each block
+                   of data is processed; the coefficients are untouched.
+ */
+
+void arm_biquad_cascade_multi_df2T_init_f32(
+        arm_biquad_cascade_multi_df2T_instance_f32 * S,
+        uint16_t numChannels,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pState)
+{
+  /* Assign filter stages and channels */
+  S->numStages = numStages;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer and size is always 2 * numStages * numChannels */
+  memset(pState, 0, (2U * (uint32_t) numStages * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of BiquadCascadeDF2T group
+ */
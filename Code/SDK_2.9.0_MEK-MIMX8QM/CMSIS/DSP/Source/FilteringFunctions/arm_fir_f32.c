@@ -116,7 +116,227 @@
   @param[in]     blockSize  number of samples to process
   @return        none
  */
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_SSE41)
+
+void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+        float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc0;                                /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+#if defined(ARM_MATH_AVX2)
+        __m256 accv0, accv1, b;                        /* Accumulators of 8 outputs and coefficient */
+#else
+        __m128 accv0, accv1, b;                        /* Accumulators of 4 outputs and coefficient */
+#endif
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
+
+  /* Every lane of an accumulator is one output: the taps are added in the order of the
+   * scalar code, b[0] * x[n-numTaps+1] first, the results are the same bit for bit.
+   * The state buffer holds numTaps - 1 samples more than the outputs of the block, the
+   * unaligned loads of px stay inside it. */
+
+#if defined(ARM_MATH_AVX2)
+
+  /* Compute 16 outputs at a time, two independent accumulators */
+  blkCnt = blockSize >> 4U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy 16 new input samples into the state buffer */
+    _mm256_storeu_ps(pStateCurnt, _mm256_loadu_ps(pSrc));
+    _mm256_storeu_ps(pStateCurnt + 8, _mm256_loadu_ps(pSrc + 8));
+    pStateCurnt += 16;
+    pSrc += 16;
+
+    accv0 = _mm256_setzero_ps();
+    accv1 = _mm256_setzero_ps();
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* acc[m] += b[k] * x[n-numTaps+1+k+m] */
+      b = _mm256_set1_ps(*pb++);
+      accv0 = _mm256_add_ps(accv0, _mm256_mul_ps(_mm256_loadu_ps(px), b));
+      accv1 = _mm256_add_ps(accv1, _mm256_mul_ps(_mm256_loadu_ps(px + 8), b));
+      px++;
+      tapCnt--;
+    }
+
+    _mm256_storeu_ps(pDst, accv0);
+    _mm256_storeu_ps(pDst + 8, accv1);
+    pDst += 16;
+
+    /* Advance state pointer by 16 for the next 16 samples */
+    pState += 16;
+
+    blkCnt--;
+  }
+
+  /* 8 remaining outputs */
+  if ((blockSize & 0x8U) != 0U)
+  {
+    _mm256_storeu_ps(pStateCurnt, _mm256_loadu_ps(pSrc));
+    pStateCurnt += 8;
+    pSrc += 8;
+
+    accv0 = _mm256_setzero_ps();
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      accv0 = _mm256_add_ps(accv0, _mm256_mul_ps(_mm256_loadu_ps(px), _mm256_set1_ps(*pb++)));
+      px++;
+      tapCnt--;
+    }
+
+    _mm256_storeu_ps(pDst, accv0);
+    pDst += 8;
+    pState += 8;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 0x7U;
+
+#else
+
+  /* Compute 8 outputs at a time, two independent accumulators */
+  blkCnt = blockSize >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    /* Copy 8 new input samples into the state buffer */
+    _mm_storeu_ps(pStateCurnt, _mm_loadu_ps(pSrc));
+    _mm_storeu_ps(pStateCurnt + 4, _mm_loadu_ps(pSrc + 4));
+    pStateCurnt += 8;
+    pSrc += 8;
+
+    accv0 = _mm_setzero_ps();
+    accv1 = _mm_setzero_ps();
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      /* acc[m] += b[k] * x[n-numTaps+1+k+m] */
+      b = _mm_set1_ps(*pb++);
+      accv0 = _mm_add_ps(accv0, _mm_mul_ps(_mm_loadu_ps(px), b));
+      accv1 = _mm_add_ps(accv1, _mm_mul_ps(_mm_loadu_ps(px + 4), b));
+      px++;
+      tapCnt--;
+    }
+
+    _mm_storeu_ps(pDst, accv0);
+    _mm_storeu_ps(pDst + 4, accv1);
+    pDst += 8;
+
+    /* Advance state pointer by 8 for the next 8 samples */
+    pState += 8;
+
+    blkCnt--;
+  }
+
+  /* 4 remaining outputs */
+  if ((blockSize & 0x4U) != 0U)
+  {
+    _mm_storeu_ps(pStateCurnt, _mm_loadu_ps(pSrc));
+    pStateCurnt += 4;
+    pSrc += 4;
+
+    accv0 = _mm_setzero_ps();
+    px = pState;
+    pb = pCoeffs;
+    tapCnt = numTaps;
+
+    while (tapCnt > 0U)
+    {
+      accv0 = _mm_add_ps(accv0, _mm_mul_ps(_mm_loadu_ps(px), _mm_set1_ps(*pb++)));
+      px++;
+      tapCnt--;
+    }
+
+    _mm_storeu_ps(pDst, accv0);
+    pDst += 4;
+    pState += 4;
+  }
+
+  /* Tail */
+  blkCnt = blockSize & 0x3U;
+
+#endif /* #if defined(ARM_MATH_AVX2) */
+
+  while (blkCnt > 0U)
+  {
+    /* Copy one sample at a time into state buffer */
+    *pStateCurnt++ = *pSrc++;
+
+    /* Set the accumulator to zero */
+    acc0 = 0.0f;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = pCoeffs;
+
+    tapCnt = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+      acc0 += *px++ * *pb++;
+      tapCnt--;
+
+    } while (tapCnt > 0U);
+
+    /* The result is stored in the destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1;
+
+    blkCnt--;
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* Copy numTaps number of values */
+  tapCnt = numTaps - 1U;
+
+  /* Copy data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+
+}
+#elif defined(ARM_MATH_NEON)
 
 void arm_fir_f32(
 const arm_fir_instance_f32 * S,
@@ -709,7 +929,7 @@ void arm_fir_f32(
 
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_SSE41) */
 /**
 * @} end of FIR group
 */
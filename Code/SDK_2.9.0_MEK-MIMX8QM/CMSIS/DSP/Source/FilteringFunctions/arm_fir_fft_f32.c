@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point partitioned convolution FIR filter processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIRFFT Partitioned Convolution FIR Filter
+
+  This function computes the same output as \ref arm_fir_f32(), with the
+  cost of a long filter moved to the frequency domain: uniformly partitioned
+  overlap-save convolution on \ref arm_rfft_fast_f32().
+
+  @par           Algorithm
+                   The filter is split into <code>numPartitions = ceil(numTaps/partLen)</code>
+                   partitions of <code>partLen</code> taps, whose <code>2*partLen</code> point
+                   spectra are computed once by \ref arm_fir_fft_init_f32(). For every block of
+                   <code>partLen</code> input samples, the spectrum of the last <code>2*partLen</code>
+                   input samples is added to a frequency domain delay line and the output block is
+  <pre>
+      y = last partLen samples of IFFT( sum(p = 0 .. numPartitions-1) H[p] * X[n-p] )
+  </pre>
+                   One block costs two real FFTs of <code>2*partLen</code> points and
+                   <code>numPartitions*partLen</code> complex multiply-accumulates, against
+                   <code>numTaps*partLen</code> multiply-accumulates of the direct form.
+  @par
+                   The output is not delayed and the block size is free. A call ending inside a
+                   partition filters the samples received so far with the spectrum of the partial
+                   block, and keeps their count in the instance: the next call completes the block
+                   and recomputes its spectrum. Each partial block costs two more real FFTs, so that
+                   for a given block size, a partition length equal to the block size is the cheapest
+                   choice.
+  @par           Instance Structure
+                   The coefficients, the spectra and the state of the filter are stored in an instance
+                   data structure. The spectra buffer holds <code>ARM_FIR_FFT_COEFFS_LEN(numTaps, partLen)</code>
+                   values and can be shared by filters with the same coefficients. The state buffer
+                   holds <code>ARM_FIR_FFT_STATE_LEN(numTaps, partLen)</code> values.
+ */
+
+/**
+  @addtogroup FIRFFT
+  @{
+ */
+
+/* pAcc += pH * pX on spectra in the packed format of arm_rfft_fast_f32(), binPairs complex bins */
+static void arm_fir_fft_cmac_f32(
+  const float32_t * pH,
+  const float32_t * pX,
+        float32_t * pAcc,
+        uint32_t binPairs)
+{
+  uint32_t k;
+
+  /* DC and Nyquist bins are real */
+  pAcc[0] += pH[0] * pX[0];
+  pAcc[1] += pH[1] * pX[1];
+
+  for (k = 1U; k < binPairs; k++)
+  {
+    pAcc[2U * k]        += (pH[2U * k] * pX[2U * k])        - (pH[(2U * k) + 1U] * pX[(2U * k) + 1U]);
+    pAcc[(2U * k) + 1U] += (pH[2U * k] * pX[(2U * k) + 1U]) + (pH[(2U * k) + 1U] * pX[2U * k]);
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point partitioned convolution FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned convolution FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+
+void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t B = S->partLen;                        /* Partition length */
+  const uint32_t N = 2U * B;                            /* FFT length */
+  const uint32_t P = S->numPartitions;
+        float32_t *pFdl = S->pState;                    /* Frequency domain delay line, P spectra */
+        float32_t *pIn = pFdl + (P * N);                /* Previous and current input block */
+        float32_t *pWork = pIn + N;                     /* FFT input and IFFT output */
+        float32_t *pAcc = pWork + N;                    /* Output spectrum */
+        uint32_t idx, p, x, n;
+
+  while (blockSize > 0U)
+  {
+    n = B - S->inCount;
+    if (n > blockSize)
+    {
+      n = blockSize;
+    }
+
+    /* A new input block takes the place of the oldest delay line entry */
+    if (S->inCount == 0U)
+    {
+      S->fdlIndex = (S->fdlIndex + 1U == P) ? 0U : (uint16_t)(S->fdlIndex + 1U);
+    }
+    idx = S->fdlIndex;
+
+    /* Spectrum of the last 2*B input samples becomes the newest delay line entry. The samples of the
+       block not received yet only reach the outputs after them, which are not computed in this pass. */
+    memcpy(pIn + B + S->inCount, pSrc, n * sizeof(float32_t));
+    memcpy(pWork, pIn, N * sizeof(float32_t));
+    arm_rfft_fast_f32(&S->rfft, pWork, pFdl + (idx * N), 0U);
+
+    /* Partition p filters the block p blocks back */
+    memset(pAcc, 0, N * sizeof(float32_t));
+    x = idx;
+    for (p = 0U; p < P; p++)
+    {
+      arm_fir_fft_cmac_f32(S->pCoeffs + (p * N), pFdl + (x * N), pAcc, B);
+      x = (x == 0U) ? (P - 1U) : (x - 1U);
+    }
+
+    /* Overlap-save: the second half of the circular convolution is the output */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pWork, 1U);
+    memcpy(pDst, pWork + B + S->inCount, n * sizeof(float32_t));
+
+    S->inCount = (uint16_t)(S->inCount + n);
+    if (S->inCount == B)
+    {
+      memcpy(pIn, pIn + B, B * sizeof(float32_t));
+      S->inCount = 0U;
+    }
+
+    pSrc += n;
+    pDst += n;
+    blockSize -= n;
+  }
+}
+
+/**
+  @} end of FIRFFT group
+ */
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point partitioned convolution FIR filter initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIRFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point partitioned convolution FIR filter.
+  @param[in,out] S            points to an instance of the floating-point partitioned convolution FIR structure
+  @param[in]     numTaps      number of filter coefficients in the filter
+  @param[in]     pCoeffs      points to the filter coefficients buffer
+  @param[out]    pCoeffsFreq  points to the buffer for the spectra of the partitions
+  @param[in]     pState       points to the state buffer
+  @param[in]     partLen      partition length, a power of two from 16 to 2048
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0 or <code>2*partLen</code> is not a supported real FFT length
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order,
+                   as for \ref arm_fir_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   The coefficients are only read by this function. <code>pCoeffsFreq</code> is of length
+                   <code>ARM_FIR_FFT_COEFFS_LEN(numTaps, partLen)</code> and <code>pState</code> of length
+                   <code>ARM_FIR_FFT_STATE_LEN(numTaps, partLen)</code>.
+ */
+
+arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffsFreq,
+        float32_t * pState,
+        uint16_t partLen)
+{
+  const uint32_t B = partLen;
+  const uint32_t N = 2U * B;
+  uint32_t P, p, k, tap;
+  arm_status status;
+
+  if ((S == NULL) || (pCoeffs == NULL) || (pCoeffsFreq == NULL) || (pState == NULL) ||
+      (numTaps == 0U) || (partLen == 0U) || (N > 0xFFFFU))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, (uint16_t)N);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  P = ARM_FIR_FFT_PARTITIONS((uint32_t)numTaps, B);
+
+  /* Spectrum of each partition, b[p*B] .. b[p*B + B-1] followed by B zeros, the state is the work buffer */
+  for (p = 0U; p < P; p++)
+  {
+    memset(pState, 0, N * sizeof(float32_t));
+    for (k = 0U; k < B; k++)
+    {
+      tap = (p * B) + k;
+      if (tap < numTaps)
+      {
+        pState[k] = pCoeffs[numTaps - 1U - tap];
+      }
+    }
+    arm_rfft_fast_f32(&S->rfft, pState, pCoeffsFreq + (p * N), 0U);
+  }
+
+  /* Clear state buffer, the delay line and the input block */
+  memset(pState, 0, ARM_FIR_FFT_STATE_LEN((uint32_t)numTaps, B) * sizeof(float32_t));
+
+  S->numTaps = numTaps;
+  S->partLen = partLen;
+  S->numPartitions = (uint16_t)P;
+  S->fdlIndex = 0U;
+  S->inCount = 0U;
+  S->pCoeffs = pCoeffsFreq;
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of FIRFFT group
+ */
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_f32.c
+ * Description:  Floating-point FIR filter processing function, N interleaved channels
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Channels filtered together, they share the loads of the state frames */
+#define MULTI_GROUP     4U
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Processing function for floating-point FIR filter, N interleaved channels.
+  @param[in]     S          points to an instance of the floating-point FIR structure
+  @param[in]     pSrc       points to the block of interleaved input data
+  @param[out]    pDst       points to the block of interleaved output data
+  @param[in]     blockSize  number of samples per channel to process
+  @return        none
+
+  @par           Details
+                   The buffers hold <code>blockSize</code> frames of <code>numChannels</code> samples.
+                   The state buffer keeps the last <code>numTaps-1</code> frames interleaved as they
+                   arrived and the coefficients are interleaved the same way, so the tap loop of a
+                   group of 4 adjacent channels multiplies 4 consecutive coefficients with 4
+                   consecutive samples. No deinterleaving copy is made.
+ */
+
+void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const uint32_t C = S->numChannels;
+  const uint32_t numTaps = S->numTaps;
+        float32_t *pState = S->pState;
+  const float32_t *px;
+  const float32_t *pb;
+        float32_t acc[MULTI_GROUP];
+        float32_t acc0;
+        uint32_t ch, n, k, i;
+
+  /* New frames are appended after the numTaps-1 frames of history */
+  memcpy(pState + ((numTaps - 1U) * C), pSrc, (blockSize * C) * sizeof(float32_t));
+
+  for (n = 0U; n < blockSize; n++)
+  {
+    ch = 0U;
+    while ((ch + MULTI_GROUP) <= C)
+    {
+      for (i = 0U; i < MULTI_GROUP; i++)
+      {
+        acc[i] = 0.0f;
+      }
+
+      /* Tap k of the group: MULTI_GROUP consecutive coefficients times MULTI_GROUP consecutive samples */
+      px = pState + (n * C) + ch;
+      pb = S->pCoeffs + ch;
+      for (k = 0U; k < numTaps; k++)
+      {
+        for (i = 0U; i < MULTI_GROUP; i++)
+        {
+          acc[i] += pb[i] * px[i];
+        }
+        px += C;
+        pb += C;
+      }
+
+      for (i = 0U; i < MULTI_GROUP; i++)
+      {
+        pDst[(n * C) + ch + i] = acc[i];
+      }
+      ch += MULTI_GROUP;
+    }
+
+    /* Remaining channels one at a time */
+    while (ch < C)
+    {
+      acc0 = 0.0f;
+      px = pState + (n * C) + ch;
+      pb = S->pCoeffs + ch;
+      for (k = 0U; k < numTaps; k++)
+      {
+        acc0 += *pb * *px;
+        px += C;
+        pb += C;
+      }
+      pDst[(n * C) + ch] = acc0;
+      ch++;
+    }
+  }
+
+  /* The last numTaps-1 frames become the history of the next call */
+  memmove(pState, pState + (blockSize * C), ((numTaps - 1U) * C) * sizeof(float32_t));
+}
+
+/**
+  @} end of FIR group
+ */
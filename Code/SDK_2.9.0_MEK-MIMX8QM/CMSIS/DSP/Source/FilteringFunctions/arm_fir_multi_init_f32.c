@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multi_init_f32.c
+ * Description:  Floating-point FIR filter initialization function, N interleaved channels
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point FIR filter, N interleaved channels.
+  @param[in,out] S            points to an instance of the floating-point FIR filter structure
+  @param[in]     numChannels  number of interleaved channels
+  @param[in]     numTaps      number of filter coefficients in the filter of each channel
+  @param[in]     pCoeffs      points to the filter coefficients of all channels
+  @param[in]     pState       points to the state buffer
+  @param[in]     blockSize    number of samples per channel that are processed at a time
+  @return        none
+
+  @par           Details
+                   The coefficients of every channel are in time reversed order, as for
+                   \ref arm_fir_init_f32(), and interleaved like the samples: one frame of
+                   <code>numChannels</code> coefficients per tap, <code>bc[k]</code> being
+                   coefficient k of channel c:
+  <pre>
+      {b0[numTaps-1], b1[numTaps-1], ..., bC[numTaps-1],
+       b0[numTaps-2], b1[numTaps-2], ..., bC[numTaps-2],
+       ...
+       b0[0],         b1[0],         ..., bC[0]}
+  </pre>
+  @par
+                   <code>pState</code> is of length <code>(numTaps+blockSize-1)*numChannels</code>.
+                   <code>blockSize</code> is the largest number of samples per channel passed to
+                   \ref arm_fir_multi_f32().
+ */
+
+void arm_fir_multi_init_f32(
+        arm_fir_multi_instance_f32 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  /* Assign filter taps and channels */
+  S->numTaps = numTaps;
+  S->numChannels = numChannels;
+
+  /* Assign coefficient pointer */
+  S->pCoeffs = pCoeffs;
+
+  /* Clear state buffer. The size is always (numTaps + blockSize - 1) * numChannels */
+  memset(pState, 0, (((uint32_t) numTaps + blockSize - 1U) * numChannels) * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+}
+
+/**
+  @} end of FIR group
+ */
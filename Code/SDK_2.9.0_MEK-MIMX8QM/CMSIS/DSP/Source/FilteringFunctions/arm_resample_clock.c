@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_clock.c
+ * Description:  Timing and drift tracking of the polyphase resampler
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Initialization of the timing of the polyphase resampler.
+  @param[out]    S            points to the timing structure
+  @param[in]     numPhases    number of polyphase filter components
+  @param[in]     phaseLength  length of each polyphase filter component
+  @param[in]     fsIn         input sample rate
+  @param[in]     fsOut        output sample rate
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is 0 or <code>numPhases*fsIn/fsOut</code> is 2^20 or more
+
+  @par           Details
+                   Called by the initialization functions of the resampler. The step, in phases per
+                   output sample, is <code>numPhases*fsIn/fsOut</code> in Q32.32. It is exact when
+                   <code>numPhases*fsIn</code> is a multiple of <code>fsOut</code>, for example 160
+                   phases from 44100 Hz to 48000 Hz.
+ */
+
+arm_status arm_resample_clock_init(
+        arm_resample_clock * S,
+        uint16_t numPhases,
+        uint16_t phaseLength,
+        uint32_t fsIn,
+        uint32_t fsOut)
+{
+  uint64_t num, whole, rem;
+
+  if ((S == NULL) || (numPhases == 0U) || (phaseLength == 0U) || (fsIn == 0U) || (fsOut == 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  num = (uint64_t)numPhases * fsIn;
+  whole = num / fsOut;
+  rem = num % fsOut;
+  if (whole >= (1ULL << 20))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  S->numPhases = numPhases;
+  S->phaseLength = phaseLength;
+  S->nominalStep = (whole << 32) | ((rem << 32) / fsOut);
+  S->step = S->nominalStep;
+  S->drift = 0;
+  S->integral = 0;
+
+  /* The first window is the zeroed history */
+  S->pos = (uint32_t)phaseLength - 1U;
+  S->phase = 0U;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @brief         Sets the drift correction of the polyphase resampler.
+  @param[in,out] S    points to the timing structure
+  @param[in]     ppb  input clock faster than nominal, relative to the output clock, in parts per billion
+  @return        none
+
+  @par           Details
+                   The step becomes <code>nominal*(1 + ppb*1e-9)</code>, <code>ppb</code> is limited to
+                   <code>ARM_RESAMPLE_MAX_DRIFT_PPB</code>. The phase is kept, the change is glitch free.
+ */
+
+void arm_resample_set_drift(
+        arm_resample_clock * S,
+        int32_t ppb)
+{
+  int64_t delta;
+
+  if (ppb > ARM_RESAMPLE_MAX_DRIFT_PPB)
+  {
+    ppb = ARM_RESAMPLE_MAX_DRIFT_PPB;
+  }
+  else if (ppb < -ARM_RESAMPLE_MAX_DRIFT_PPB)
+  {
+    ppb = -ARM_RESAMPLE_MAX_DRIFT_PPB;
+  }
+
+  /* The step is below 2^52, 12 bits are dropped to keep the product in 64 bits */
+  delta = (((int64_t)(S->nominalStep >> 12) * ppb) / 1000000000) * 4096;
+  S->step = (uint64_t)((int64_t)S->nominalStep + delta);
+  S->drift = ppb;
+}
+
+/**
+  @brief         Drift tracking of the polyphase resampler.
+  @param[in,out] S           points to the timing structure
+  @param[in]     levelError  level of the input buffer minus its target level, in samples
+  @return        drift correction applied, in ppb
+
+  @par           Details
+                   For asynchronous clock domains: the producer writes to a buffer at the input rate,
+                   the resampler reads it at the output rate. Called once per block with the buffer
+                   level error, a proportional-integral loop with the gains <code>ARM_RESAMPLE_TRACK_KP</code>
+                   and <code>ARM_RESAMPLE_TRACK_KI</code> adjusts the drift correction: a filling buffer
+                   speeds up the consumption of input samples. The integral term converges to the
+                   clock offset, the level error to zero.
+ */
+
+int32_t arm_resample_track(
+        arm_resample_clock * S,
+        int32_t levelError)
+{
+  int64_t integral, ppb;
+
+  integral = (int64_t)S->integral + ((int64_t)ARM_RESAMPLE_TRACK_KI * levelError);
+  if (integral > ARM_RESAMPLE_MAX_DRIFT_PPB)
+  {
+    integral = ARM_RESAMPLE_MAX_DRIFT_PPB;
+  }
+  else if (integral < -ARM_RESAMPLE_MAX_DRIFT_PPB)
+  {
+    integral = -ARM_RESAMPLE_MAX_DRIFT_PPB;
+  }
+  S->integral = (int32_t)integral;
+
+  ppb = integral + ((int64_t)ARM_RESAMPLE_TRACK_KP * levelError);
+  if (ppb > ARM_RESAMPLE_MAX_DRIFT_PPB)
+  {
+    ppb = ARM_RESAMPLE_MAX_DRIFT_PPB;
+  }
+  else if (ppb < -ARM_RESAMPLE_MAX_DRIFT_PPB)
+  {
+    ppb = -ARM_RESAMPLE_MAX_DRIFT_PPB;
+  }
+
+  arm_resample_set_drift(S, (int32_t)ppb);
+  return (int32_t)ppb;
+}
+
+/**
+  @} end of Resample group
+ */
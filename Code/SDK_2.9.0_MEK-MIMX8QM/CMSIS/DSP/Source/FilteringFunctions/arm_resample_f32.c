@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_f32.c
+ * Description:  Floating-point polyphase resampler processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup Resample Polyphase Resampler
+
+  Converts between sample rates of any ratio, for example 44.1 kHz and 48 kHz,
+  without the intermediate rate of a chained \ref FIR_Interpolate and
+  \ref FIR_decimate.
+
+  @par           Algorithm
+                   The prototype filter is the lowpass of an interpolator by <code>numPhases</code>,
+                   as passed to \ref arm_fir_interpolate_init_f32(): <code>numTaps = numPhases*phaseLength</code>
+                   coefficients in time reversed order with a gain of <code>numPhases</code>. The
+                   initialization function splits it into <code>numPhases</code> components of
+                   <code>phaseLength</code> taps. Each output sample is one component applied to the last
+                   <code>phaseLength</code> input samples, the component selected by the position of the
+                   output between two input samples:
+  <pre>
+      position += numPhases * fsIn / fsOut              per output sample
+      phase     = integer part of position modulo numPhases
+  </pre>
+                   Only the output samples are computed, one output costs <code>phaseLength</code>
+                   multiply-accumulates.
+  @par           Rational and fractional ratios
+                   When <code>numPhases*fsIn</code> is a multiple of <code>fsOut</code> (rational ratio
+                   <code>numPhases/M</code>) every output falls on a phase. For other ratios, and when the
+                   drift correction is active, the position has a fractional part and the output is
+                   linearly interpolated between the two neighbouring phases, at the cost of a second
+                   dot product. With 64 or more phases the interpolation error is below the stopband
+                   of a typical prototype.
+  @par           Asynchronous clocks
+                   \ref arm_resample_set_drift() scales the step in parts per billion without a
+                   discontinuity. \ref arm_resample_track() computes the correction from the level
+                   of the buffer between the two clock domains.
+  @par           Block size
+                   One call consumes <code>blockSize</code> input samples and returns the number of
+                   output samples written, at most <code>ARM_RESAMPLE_OUT_MAX(blockSize, fsIn, fsOut)</code>.
+                   The state buffer holds <code>phaseLength+blockSize</code> samples.
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point polyphase resampler.
+  @param[in,out] S          points to an instance of the floating-point resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written
+ */
+
+uint32_t arm_resample_f32(
+        arm_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  arm_resample_clock *clk = &S->clk;
+  const uint32_t P = clk->phaseLength;
+  const uint32_t L = clk->numPhases;
+  const uint64_t wrap = (uint64_t)L << 32;
+  const uint32_t filled = P + blockSize;
+        float32_t *pState = S->pState;
+  const float32_t *pX;
+  const float32_t *pC;
+        uint64_t phase = clk->phase;
+        uint32_t pos = clk->pos;
+        uint32_t p, frac, outCount = 0U;
+        float32_t acc0, acc1;
+
+  /* New samples are appended after the phaseLength samples of history */
+  memcpy(pState + P, pSrc, blockSize * sizeof(float32_t));
+
+  /* An output after pState[pos] needs pState[pos+1] for the interpolation with the next phase */
+  while ((pos + 1U) < filled)
+  {
+    p = (uint32_t)(phase >> 32);
+    frac = (uint32_t)phase;
+    pX = pState + (pos + 1U - P);
+    pC = S->pCoeffs + (p * P);
+
+    arm_dot_prod_f32(pC, pX, P, &acc0);
+    if (frac != 0U)
+    {
+      /* Phase numPhases is phase 0 one input sample later */
+      if ((p + 1U) < L)
+      {
+        arm_dot_prod_f32(pC + P, pX, P, &acc1);
+      }
+      else
+      {
+        arm_dot_prod_f32(S->pCoeffs, pX + 1, P, &acc1);
+      }
+      acc0 += (acc1 - acc0) * ((float32_t)frac * 2.3283064365386963e-10f);
+    }
+    *pDst++ = acc0;
+    outCount++;
+
+    phase += clk->step;
+    while (phase >= wrap)
+    {
+      phase -= wrap;
+      pos++;
+    }
+  }
+
+  /* The last phaseLength samples are the history of the next call */
+  memmove(pState, pState + blockSize, P * sizeof(float32_t));
+  clk->pos = pos - blockSize;
+  clk->phase = phase;
+
+  return outCount;
+}
+
+/**
+  @} end of Resample group
+ */
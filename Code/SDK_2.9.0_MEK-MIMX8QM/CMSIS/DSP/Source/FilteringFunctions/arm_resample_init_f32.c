@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_init_f32.c
+ * Description:  Floating-point polyphase resampler initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point polyphase resampler.
+  @param[in,out] S             points to an instance of the floating-point resampler structure
+  @param[in]     numPhases     number of polyphase filter components
+  @param[in]     numTaps       number of coefficients of the prototype filter
+  @param[in]     pCoeffs       points to the prototype filter coefficients
+  @param[out]    pPhaseCoeffs  points to the buffer for the polyphase coefficient table
+  @param[in]     pState        points to the state buffer
+  @param[in]     fsIn          input sample rate
+  @param[in]     fsOut         output sample rate
+  @param[in]     blockSize     number of input samples to process per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR   : <code>numTaps</code> is not a multiple of <code>numPhases</code>
+                   - \ref ARM_MATH_ARGUMENT_ERROR : see \ref arm_resample_clock_init()
+
+  @par           Details
+                   <code>pCoeffs</code> points to the prototype filter in time reversed order, as for
+                   \ref arm_fir_interpolate_init_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[numTaps-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   It is only read by this function. <code>pPhaseCoeffs</code> is of length <code>numTaps</code>,
+                   component p is stored at <code>pPhaseCoeffs[p*phaseLength]</code> in the order of the input
+                   samples. <code>pState</code> is of length <code>numTaps/numPhases+blockSize</code>.
+ */
+
+arm_status arm_resample_init_f32(
+        arm_resample_instance_f32 * S,
+        uint16_t numPhases,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pPhaseCoeffs,
+        float32_t * pState,
+        uint32_t fsIn,
+        uint32_t fsOut,
+        uint32_t blockSize)
+{
+  uint32_t P, p, k;
+  arm_status status;
+
+  if ((numPhases == 0U) || (numTaps == 0U) || ((numTaps % numPhases) != 0U))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+  P = (uint32_t)numTaps / numPhases;
+
+  status = arm_resample_clock_init(&S->clk, numPhases, (uint16_t)P, fsIn, fsOut);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* Component p, tap k multiplies x[n-(P-1-k)]: b[p + (P-1-k)*numPhases] */
+  for (p = 0U; p < numPhases; p++)
+  {
+    for (k = 0U; k < P; k++)
+    {
+      pPhaseCoeffs[(p * P) + k] = pCoeffs[(numPhases - 1U - p) + (k * numPhases)];
+    }
+  }
+  S->pCoeffs = pPhaseCoeffs;
+
+  /* Clear state buffer and size is always phaseLength + blockSize */
+  memset(pState, 0, (P + blockSize) * sizeof(float32_t));
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resample_q15.c
+ * Description:  Q15 polyphase resampler processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup Resample
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 polyphase resampler.
+  @param[in,out] S          points to an instance of the Q15 resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process
+  @return        number of output samples written
+
+  @par           Scaling and Overflow Behavior
+                   The dot products are computed by \ref arm_dot_prod_q15() in a 64-bit accumulator
+                   in 34.30 format, the interpolation between phases uses a 15 bit weight. The result
+                   is truncated to 1.15 with saturation, as by \ref arm_fir_q15().
+ */
+
+uint32_t arm_resample_q15(
+        arm_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  arm_resample_clock *clk = &S->clk;
+  const uint32_t P = clk->phaseLength;
+  const uint32_t L = clk->numPhases;
+  const uint64_t wrap = (uint64_t)L << 32;
+  const uint32_t filled = P + blockSize;
+        q15_t *pState = S->pState;
+  const q15_t *pX;
+  const q15_t *pC;
+        uint64_t phase = clk->phase;
+        uint32_t pos = clk->pos;
+        uint32_t p, frac, outCount = 0U;
+        q63_t acc0, acc1;
+
+  /* New samples are appended after the phaseLength samples of history */
+  memcpy(pState + P, pSrc, blockSize * sizeof(q15_t));
+
+  /* An output after pState[pos] needs pState[pos+1] for the interpolation with the next phase */
+  while ((pos + 1U) < filled)
+  {
+    p = (uint32_t)(phase >> 32);
+    frac = (uint32_t)phase;
+    pX = pState + (pos + 1U - P);
+    pC = S->pCoeffs + (p * P);
+
+    arm_dot_prod_q15(pC, pX, P, &acc0);
+    if (frac != 0U)
+    {
+      /* Phase numPhases is phase 0 one input sample later */
+      if ((p + 1U) < L)
+      {
+        arm_dot_prod_q15(pC + P, pX, P, &acc1);
+      }
+      else
+      {
+        arm_dot_prod_q15(S->pCoeffs, pX + 1, P, &acc1);
+      }
+      acc0 += ((acc1 - acc0) * (q63_t)(frac >> 17)) >> 15;
+    }
+    *pDst++ = (q15_t) (__SSAT((acc0 >> 15), 16));
+    outCount++;
+
+    phase += clk->step;
+    while (phase >= wrap)
+    {
+      phase -= wrap;
+      pos++;
+    }
+  }
+
+  /* The last phaseLength samples are the history of the next call */
+  memmove(pState, pState + blockSize, P * sizeof(q15_t));
+  clk->pos = pos - blockSize;
+  clk->phase = phase;
+
+  return outCount;
+}
+
+/**
+  @} end of Resample group
+ */
@@ -29,6 +29,10 @@
 #include "arm_mat_add_f32.c"
 #include "arm_mat_add_q15.c"
 #include "arm_mat_add_q31.c"
+#include "arm_mat_cholesky_f32.c"
+#include "arm_mat_cholesky_f64.c"
+#include "arm_mat_cholesky_solve_f32.c"
+#include "arm_mat_cholesky_solve_f64.c"
 #include "arm_mat_cmplx_mult_f32.c"
 #include "arm_mat_cmplx_mult_q15.c"
 #include "arm_mat_cmplx_mult_q31.c"
@@ -37,17 +41,38 @@
 #include "arm_mat_init_q31.c"
 #include "arm_mat_inverse_f32.c"
 #include "arm_mat_inverse_f64.c"
+#include "arm_mat_ldlt_f32.c"
+#include "arm_mat_ldlt_f64.c"
+#include "arm_mat_ldlt_solve_f32.c"
+#include "arm_mat_ldlt_solve_f64.c"
+#include "arm_mat_mult_blocked_f32.c"
+#include "arm_mat_mult_blocked_q15.c"
+#include "arm_mat_mult_blocked_q31.c"
 #include "arm_mat_mult_f32.c"
 #include "arm_mat_mult_fast_q15.c"
 #include "arm_mat_mult_fast_q31.c"
 #include "arm_mat_mult_q15.c"
 #include "arm_mat_mult_q31.c"
+#include "arm_mat_mult_transb_f32.c"
+#include "arm_mat_mult_transb_q15.c"
+#include "arm_mat_mult_transb_q31.c"
+#include "arm_mat_qr_f32.c"
+#include "arm_mat_qr_f64.c"
+#include "arm_mat_qr_solve_f32.c"
+#include "arm_mat_qr_solve_f64.c"
 #include "arm_mat_scale_f32.c"
 #include "arm_mat_scale_q15.c"
 #include "arm_mat_scale_q31.c"
+#include "arm_mat_solve_lower_triangular_f32.c"
+#include "arm_mat_solve_lower_triangular_f64.c"
+#include "arm_mat_solve_upper_triangular_f32.c"
+#include "arm_mat_solve_upper_triangular_f64.c"
 #include "arm_mat_sub_f32.c"
 #include "arm_mat_sub_q15.c"
 #include "arm_mat_sub_q31.c"
 #include "arm_mat_trans_f32.c"
 #include "arm_mat_trans_q15.c"
 #include "arm_mat_trans_q31.c"
+#include "arm_mat_vec_mult_f32.c"
+#include "arm_mat_vec_mult_q15.c"
+#include "arm_mat_vec_mult_q31.c"
@@ -0,0 +1,129 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixChol Cholesky Decomposition
+
+  Computes the Cholesky decomposition of a symmetric positive definite matrix.
+
+  The decomposition is <code>A = L * L^t</code>, where <code>L</code> is lower triangular
+  with a positive diagonal. Only the lower triangle of <code>A</code> is read.
+
+  Solving <code>A * X = B</code> with the factor, see \ref arm_mat_cholesky_solve_f32(), needs
+  about a third of the operations of \ref arm_mat_inverse_f32() followed by a multiplication,
+  and its error grows with the condition number of <code>A</code> and not with its square.
+  A covariance matrix is refactored each update, the inverse is never formed.
+
+  @par Algorithm
+  The Cholesky-Crout algorithm computes <code>L</code> row by row. Every element is a dot
+  product of two rows of <code>L</code> which have already been computed, so the accesses
+  are sequential. The function can be called in-place (pSrc == pDst).
+  A matrix which is not positive definite is reported with
+  <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+  @brief         Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+  @param[in]     pSrc      points to the input matrix structure
+  @param[out]    pDst      points to the output lower triangular matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : Input matrix is not positive definite
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  const uint32_t n = pSrc->numRows;
+  const float32_t *pA = pSrc->pData;
+        float32_t *pL = pDst->pData;
+  const float32_t *pRowI, *pRowJ;
+        float32_t sum;
+        uint32_t i, j, k;
+        arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0U; j <= i; j++)
+      {
+        /* L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k < j)) / L(j,j) */
+        pRowJ = pL + (j * n);
+        sum = pA[(i * n) + j];
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (j < i)
+        {
+          pL[(i * n) + j] = sum / pRowJ[j];
+        }
+        else if (sum > 0.0f)
+        {
+          pL[(i * n) + i] = sqrtf(sum);
+        }
+        else
+        {
+          /* Not positive definite, or a NaN in the input */
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1U; j < n; j++)
+      {
+        pL[(i * n) + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
@@ -0,0 +1,86 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_solve_f32.c
+ * Description:  Floating-point linear system solve with a Cholesky factor
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+  @brief         Solves A * X = B in place, with the Cholesky factor L of A.
+  @param[in]     pSrcL     points to the factor computed by \ref arm_mat_cholesky_f32()
+  @param[in,out] pSrcDst   points to B on input, X on output
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : A diagonal element of L is zero
+
+  @par           Details
+                   <code>L * Y = B</code> is solved by forward substitution, then
+                   <code>L^t * X = Y</code> by back substitution walking the rows of
+                   <code>L</code>, so that <code>L</code> is never transposed.
+ */
+
+arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+        arm_matrix_instance_f32 * pSrcDst)
+{
+  const uint32_t n = pSrcL->numRows;
+  const uint32_t cols = pSrcDst->numCols;
+  const float32_t *pL = pSrcL->pData;
+  const float32_t *pXj;
+        float32_t *pXi;
+        float32_t l, inv;
+        uint32_t i, j, k;
+        arm_status status;                             /* status of matrix solve */
+
+  status = arm_mat_solve_lower_triangular_f32(pSrcL, pSrcDst, pSrcDst);
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    for (j = n; j > 0U; j--)
+    {
+      /* X(j,:) = Y(j,:) / L(j,j), then Y(i,:) -= L(j,i) * X(j,:) for i < j */
+      pXj = pSrcDst->pData + ((j - 1U) * cols);
+      inv = 1.0f / pL[((j - 1U) * n) + (j - 1U)];
+      for (k = 0U; k < cols; k++)
+      {
+        pSrcDst->pData[((j - 1U) * cols) + k] *= inv;
+      }
+
+      for (i = 0U; i < (j - 1U); i++)
+      {
+        l = pL[((j - 1U) * n) + i];
+        pXi = pSrcDst->pData + (i * cols);
+        for (k = 0U; k < cols; k++)
+        {
+          pXi[k] -= l * pXj[k];
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
@@ -0,0 +1,179 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f32.c
+ * Description:  Floating-point LDL^t decomposition
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixLDLT LDL^t Decomposition
+
+  Computes the LDL^t decomposition of a symmetric matrix.
+
+  The decomposition is <code>P * A * P^t = L * D * L^t</code>, where <code>L</code> is unit
+  lower triangular, <code>D</code> diagonal and <code>P</code> a permutation. Unlike the
+  Cholesky decomposition no square root is taken and positive semi-definite matrices
+  are accepted: the zero pivots are left at the end of <code>D</code>. Only the lower
+  triangle of <code>A</code> is read.
+
+  @par Algorithm
+  At step <code>k</code> the largest remaining diagonal element is swapped to the pivot
+  position, by exchanging rows and columns <code>k</code> and <code>pPerm[k]</code>. The
+  permutation is returned as this sequence of interchanges, so it can be applied in
+  place. A symmetric indefinite matrix may need a 2x2 pivot, which is not supported; this
+  case is reported with <code>ARM_MATH_DECOMPOSITION_FAILURE</code>. The function can be
+  called in-place (pSrc == pDstL).
+ */
+
+/**
+  @addtogroup MatrixLDLT
+  @{
+ */
+
+/**
+  @brief         Floating-point LDL^t decomposition of a symmetric matrix.
+  @param[in]     pSrc      points to the input matrix structure
+  @param[out]    pDstL     points to the output unit lower triangular matrix structure
+  @param[out]    pDstD     points to the output diagonal of D, numRows values
+  @param[out]    pPerm     points to the output interchanges, numRows values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS                : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH          : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE  : A 2x2 pivot is needed
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDstL,
+        float32_t * pDstD,
+        uint16_t * pPerm)
+{
+  const uint32_t n = pSrc->numRows;
+        float32_t *pW = pDstL->pData;
+        float32_t d, t, max;
+        uint32_t i, j, k, p;
+        arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDstL->numRows != pDstL->numCols) ||
+      (pSrc->numRows != pDstL->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    if (pW != pSrc->pData)
+    {
+      memcpy(pW, pSrc->pData, n * n * sizeof(float32_t));
+    }
+
+    for (k = 0U; (k < n) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      /* Pivot on the largest remaining diagonal element */
+      p = k;
+      max = fabsf(pW[(k * n) + k]);
+      for (i = k + 1U; i < n; i++)
+      {
+        if (fabsf(pW[(i * n) + i]) > max)
+        {
+          max = fabsf(pW[(i * n) + i]);
+          p = i;
+        }
+      }
+      pPerm[k] = (uint16_t) p;
+
+      if (p != k)
+      {
+        /* Symmetric interchange of rows and columns k and p, in the lower triangle */
+        for (j = 0U; j < k; j++)
+        {
+          t = pW[(k * n) + j];
+          pW[(k * n) + j] = pW[(p * n) + j];
+          pW[(p * n) + j] = t;
+        }
+        t = pW[(k * n) + k];
+        pW[(k * n) + k] = pW[(p * n) + p];
+        pW[(p * n) + p] = t;
+        for (j = k + 1U; j < p; j++)
+        {
+          t = pW[(j * n) + k];
+          pW[(j * n) + k] = pW[(p * n) + j];
+          pW[(p * n) + j] = t;
+        }
+        for (i = p + 1U; i < n; i++)
+        {
+          t = pW[(i * n) + k];
+          pW[(i * n) + k] = pW[(i * n) + p];
+          pW[(i * n) + p] = t;
+        }
+      }
+
+      d = pW[(k * n) + k];
+      pDstD[k] = d;
+
+      if (d == 0.0f)
+      {
+        /* The remaining diagonal is zero, so must be the remaining columns */
+        for (i = k + 1U; i < n; i++)
+        {
+          if (pW[(i * n) + k] != 0.0f)
+          {
+            status = ARM_MATH_DECOMPOSITION_FAILURE;
+          }
+        }
+      }
+      else
+      {
+        /* L(i,k) = W(i,k) / d, then W(i,j) -= W(i,k) * L(j,k) for k < j <= i */
+        for (i = k + 1U; i < n; i++)
+        {
+          t = pW[(i * n) + k];
+          pW[(i * n) + k] = t / d;
+          for (j = k + 1U; j <= i; j++)
+          {
+            pW[(i * n) + j] -= t * pW[(j * n) + k];
+          }
+        }
+      }
+    }
+
+    /* Unit diagonal and zero upper triangle */
+    for (i = 0U; i < n; i++)
+    {
+      pW[(i * n) + i] = 1.0f;
+      for (j = i + 1U; j < n; j++)
+      {
+        pW[(i * n) + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLDLT group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_solve_f32.c
+ * Description:  Floating-point linear system solve with an LDL^t decomposition
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Exchanges rows a and b of the cols columns matrix pX */
+static void arm_mat_swap_rows_f32(
+  float32_t * pX,
+  uint32_t cols,
+  uint32_t a,
+  uint32_t b)
+{
+  float32_t t;
+  uint32_t k;
+
+  for (k = 0U; k < cols; k++)
+  {
+    t = pX[(a * cols) + k];
+    pX[(a * cols) + k] = pX[(b * cols) + k];
+    pX[(b * cols) + k] = t;
+  }
+}
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixLDLT
+  @{
+ */
+
+/**
+  @brief         Solves A * X = B in place, with the LDL^t decomposition of A.
+  @param[in]     pSrcL     points to the factor L computed by \ref arm_mat_ldlt_f32()
+  @param[in]     pSrcD     points to the diagonal of D
+  @param[in]     pPerm     points to the interchanges
+  @param[in,out] pSrcDst   points to B on input, X on output
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : An element of D is zero
+
+  @par           Details
+                   The interchanges are applied to the rows of <code>B</code>, then
+                   <code>L * D * L^t * Y = P * B</code> is solved by forward substitution,
+                   scaling and back substitution, and the interchanges are undone on
+                   <code>Y</code>.
+ */
+
+arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const float32_t * pSrcD,
+  const uint16_t * pPerm,
+        arm_matrix_instance_f32 * pSrcDst)
+{
+  const uint32_t n = pSrcL->numRows;
+  const uint32_t cols = pSrcDst->numCols;
+  const float32_t *pL = pSrcL->pData;
+  const float32_t *pXj;
+        float32_t *pX = pSrcDst->pData;
+        float32_t *pXi;
+        float32_t l, inv;
+        uint32_t i, j, k;
+        arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcL->numRows != pSrcL->numCols) ||
+      (pSrcDst->numRows != n)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pSrcD[i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    for (i = 0U; i < n; i++)
+    {
+      if (pPerm[i] != i)
+      {
+        arm_mat_swap_rows_f32(pX, cols, i, pPerm[i]);
+      }
+    }
+
+    /* L * Z = P * B, the diagonal of L is one */
+    for (i = 1U; i < n; i++)
+    {
+      pXi = pX + (i * cols);
+      for (j = 0U; j < i; j++)
+      {
+        l = pL[(i * n) + j];
+        pXj = pX + (j * cols);
+        for (k = 0U; k < cols; k++)
+        {
+          pXi[k] -= l * pXj[k];
+        }
+      }
+    }
+
+    /* Y = D^-1 * Z */
+    for (i = 0U; i < n; i++)
+    {
+      inv = 1.0f / pSrcD[i];
+      pXi = pX + (i * cols);
+      for (k = 0U; k < cols; k++)
+      {
+        pXi[k] *= inv;
+      }
+    }
+
+    /* L^t * W = Y, walking the rows of L */
+    for (j = n; j > 1U; j--)
+    {
+      pXj = pX + ((j - 1U) * cols);
+      for (i = 0U; i < (j - 1U); i++)
+      {
+        l = pL[((j - 1U) * n) + i];
+        pXi = pX + (i * cols);
+        for (k = 0U; k < cols; k++)
+        {
+          pXi[k] -= l * pXj[k];
+        }
+      }
+    }
+
+    for (i = n; i > 0U; i--)
+    {
+      if (pPerm[i - 1U] != (i - 1U))
+      {
+        arm_mat_swap_rows_f32(pX, cols, i - 1U, pPerm[i - 1U]);
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLDLT group
+ */
@@ -0,0 +1,272 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_f32.c
+ * Description:  Floating-point matrix multiplication, register blocked and cache tiled
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/*
+ * C[4][4] (+)= A[4][kc] * B[kc][4]. A has a row stride of lda, B and C of ldb
+ * and ldc. The 16 accumulators stay in registers, every loaded element of A
+ * and B is used 4 times.
+ */
+#if defined(ARM_MATH_SSE41)
+
+/* Same as the scalar kernel below, a row of the block per vector */
+static void arm_mat_mult_kernel_4x4_f32(
+  const float32_t * pA,
+        uint32_t lda,
+  const float32_t * pB,
+        uint32_t ldb,
+        float32_t * pC,
+        uint32_t ldc,
+        uint32_t kc,
+        uint32_t accumulate)
+{
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = pA + lda;
+  const float32_t *pA2 = pA + (2U * lda);
+  const float32_t *pA3 = pA + (3U * lda);
+        __m128 c0, c1, c2, c3, b;
+        uint32_t k;
+
+  c0 = _mm_setzero_ps();
+  c1 = _mm_setzero_ps();
+  c2 = _mm_setzero_ps();
+  c3 = _mm_setzero_ps();
+
+  for (k = 0U; k < kc; k++)
+  {
+    b = _mm_loadu_ps(pB);
+    pB += ldb;
+
+    c0 = _mm_add_ps(c0, _mm_mul_ps(_mm_set1_ps(pA0[k]), b));
+    c1 = _mm_add_ps(c1, _mm_mul_ps(_mm_set1_ps(pA1[k]), b));
+    c2 = _mm_add_ps(c2, _mm_mul_ps(_mm_set1_ps(pA2[k]), b));
+    c3 = _mm_add_ps(c3, _mm_mul_ps(_mm_set1_ps(pA3[k]), b));
+  }
+
+  if (accumulate != 0U)
+  {
+    c0 = _mm_add_ps(c0, _mm_loadu_ps(pC));
+    c1 = _mm_add_ps(c1, _mm_loadu_ps(pC + ldc));
+    c2 = _mm_add_ps(c2, _mm_loadu_ps(pC + (2U * ldc)));
+    c3 = _mm_add_ps(c3, _mm_loadu_ps(pC + (3U * ldc)));
+  }
+
+  _mm_storeu_ps(pC, c0);
+  _mm_storeu_ps(pC + ldc, c1);
+  _mm_storeu_ps(pC + (2U * ldc), c2);
+  _mm_storeu_ps(pC + (3U * ldc), c3);
+}
+
+#else
+
+static void arm_mat_mult_kernel_4x4_f32(
+  const float32_t * pA,
+        uint32_t lda,
+  const float32_t * pB,
+        uint32_t ldb,
+        float32_t * pC,
+        uint32_t ldc,
+        uint32_t kc,
+        uint32_t accumulate)
+{
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = pA + lda;
+  const float32_t *pA2 = pA + (2U * lda);
+  const float32_t *pA3 = pA + (3U * lda);
+        float32_t c00 = 0.0f, c01 = 0.0f, c02 = 0.0f, c03 = 0.0f;
+        float32_t c10 = 0.0f, c11 = 0.0f, c12 = 0.0f, c13 = 0.0f;
+        float32_t c20 = 0.0f, c21 = 0.0f, c22 = 0.0f, c23 = 0.0f;
+        float32_t c30 = 0.0f, c31 = 0.0f, c32 = 0.0f, c33 = 0.0f;
+        float32_t a0, a1, a2, a3, b0, b1, b2, b3;
+        uint32_t k;
+
+  for (k = 0U; k < kc; k++)
+  {
+    b0 = pB[0];
+    b1 = pB[1];
+    b2 = pB[2];
+    b3 = pB[3];
+    pB += ldb;
+
+    a0 = pA0[k];
+    a1 = pA1[k];
+    a2 = pA2[k];
+    a3 = pA3[k];
+
+    c00 += a0 * b0;  c01 += a0 * b1;  c02 += a0 * b2;  c03 += a0 * b3;
+    c10 += a1 * b0;  c11 += a1 * b1;  c12 += a1 * b2;  c13 += a1 * b3;
+    c20 += a2 * b0;  c21 += a2 * b1;  c22 += a2 * b2;  c23 += a2 * b3;
+    c30 += a3 * b0;  c31 += a3 * b1;  c32 += a3 * b2;  c33 += a3 * b3;
+  }
+
+  if (accumulate != 0U)
+  {
+    c00 += pC[0];  c01 += pC[1];  c02 += pC[2];  c03 += pC[3];
+    pC += ldc;
+    c10 += pC[0];  c11 += pC[1];  c12 += pC[2];  c13 += pC[3];
+    pC += ldc;
+    c20 += pC[0];  c21 += pC[1];  c22 += pC[2];  c23 += pC[3];
+    pC += ldc;
+    c30 += pC[0];  c31 += pC[1];  c32 += pC[2];  c33 += pC[3];
+    pC -= 3U * ldc;
+  }
+
+  pC[0] = c00;  pC[1] = c01;  pC[2] = c02;  pC[3] = c03;
+  pC += ldc;
+  pC[0] = c10;  pC[1] = c11;  pC[2] = c12;  pC[3] = c13;
+  pC += ldc;
+  pC[0] = c20;  pC[1] = c21;  pC[2] = c22;  pC[3] = c23;
+  pC += ldc;
+  pC[0] = c30;  pC[1] = c31;  pC[2] = c32;  pC[3] = c33;
+}
+
+#endif /* #if defined(ARM_MATH_SSE41) */
+
+/* Same as above for the mr x nr edge blocks, mr and nr up to 4 */
+static void arm_mat_mult_kernel_edge_f32(
+  const float32_t * pA,
+        uint32_t lda,
+  const float32_t * pB,
+        uint32_t ldb,
+        float32_t * pC,
+        uint32_t ldc,
+        uint32_t kc,
+        uint32_t accumulate,
+        uint32_t mr,
+        uint32_t nr)
+{
+  float32_t sum;
+  uint32_t i, j, k;
+
+  for (i = 0U; i < mr; i++)
+  {
+    for (j = 0U; j < nr; j++)
+    {
+      sum = (accumulate != 0U) ? pC[(i * ldc) + j] : 0.0f;
+      for (k = 0U; k < kc; k++)
+      {
+        sum += pA[(i * lda) + k] * pB[(k * ldb) + j];
+      }
+      pC[(i * ldc) + j] = sum;
+    }
+  }
+}
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix multiplication, register blocked and cache tiled.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Same result as \ref arm_mat_mult_f32() for matrices of any size, the order of the
+                   additions differs. \ref arm_mat_mult_f32() walks down a column of B for every output
+                   element, which misses the cache on every access beyond about 32x32. This function
+                   computes 4x4 blocks of the output with 16 accumulators in registers, reading 4
+                   consecutive elements of each row of B. The K dimension and the columns of B are split
+                   in tiles of <code>ARM_MAT_BLOCK_K</code> by <code>ARM_MAT_BLOCK_N</code> elements which
+                   stay in the cache while all rows of A are processed.
+ */
+
+arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;                /* Input data matrix pointer A */
+  const float32_t *pB = pSrcB->pData;                /* Input data matrix pointer B */
+        float32_t *pC = pDst->pData;                 /* Output data matrix pointer */
+        uint32_t M = pSrcA->numRows;                 /* Number of rows of input matrix A */
+        uint32_t K = pSrcA->numCols;                 /* Number of columns of input matrix A */
+        uint32_t N = pSrcB->numCols;                 /* Number of columns of input matrix B */
+        uint32_t kk, kc, jj, nc, i, j, mr, nr;      /* Tile and block indexes and sizes */
+        arm_status status;                           /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    if (K == 0U)
+    {
+      memset(pC, 0, M * N * sizeof(float32_t));
+    }
+
+    /* Tile of B: rows kk .. kk+kc-1, columns jj .. jj+nc-1 */
+    for (kk = 0U; kk < K; kk += kc)
+    {
+      kc = ((K - kk) < ARM_MAT_BLOCK_K) ? (K - kk) : ARM_MAT_BLOCK_K;
+
+      for (jj = 0U; jj < N; jj += nc)
+      {
+        nc = ((N - jj) < ARM_MAT_BLOCK_N) ? (N - jj) : ARM_MAT_BLOCK_N;
+
+        for (i = 0U; i < M; i += mr)
+        {
+          mr = ((M - i) < 4U) ? (M - i) : 4U;
+
+          for (j = jj; j < (jj + nc); j += nr)
+          {
+            nr = ((jj + nc - j) < 4U) ? (jj + nc - j) : 4U;
+
+            /* The first K tile initializes the output block, the next ones add to it */
+            if ((mr == 4U) && (nr == 4U))
+            {
+              arm_mat_mult_kernel_4x4_f32(pA + (i * K) + kk, K, pB + (kk * N) + j, N,
+                                          pC + (i * N) + j, N, kc, kk);
+            }
+            else
+            {
+              arm_mat_mult_kernel_edge_f32(pA + (i * K) + kk, K, pB + (kk * N) + j, N,
+                                           pC + (i * N) + j, N, kc, kk, mr, nr);
+            }
+          }
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
@@ -0,0 +1,160 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_blocked_q15.c
+ * Description:  Q15 matrix multiplication, register blocked and cache tiled
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/*
+ * C[mr][nr] = A[mr][K] * B[K][nr], mr and nr up to 2, in four 64-bit
+ * accumulators as arm_mat_mult_q15().
+ */
+static void arm_mat_mult_kernel_q15(
+  const q15_t * pA,
+  const q15_t * pB,
+        q15_t * pC,
+        uint32_t K,
+        uint32_t N,
+        uint32_t mr,
+        uint32_t nr)
+{
+  const q15_t *pA0 = pA;
+  const q15_t *pA1 = pA + ((mr > 1U) ? K : 0U);
+        q63_t c00 = 0, c01 = 0, c10 = 0, c11 = 0;
+        q31_t a0, a1, b0, b1;
+        uint32_t k;
+
+  if (nr == 2U)
+  {
+    for (k = 0U; k < K; k++)
+    {
+      b0 = pB[0];
+      b1 = pB[1];
+      pB += N;
+      a0 = pA0[k];
+      a1 = pA1[k];
+      c00 += (q31_t) (a0 * b0);
+      c01 += (q31_t) (a0 * b1);
+      c10 += (q31_t) (a1 * b0);
+      c11 += (q31_t) (a1 * b1);
+    }
+  }
+  else
+  {
+    for (k = 0U; k < K; k++)
+    {
+      b0 = *pB;
+      pB += N;
+      c00 += (q31_t) (pA0[k] * b0);
+      c10 += (q31_t) (pA1[k] * b0);
+    }
+  }
+
+  /* Convert result from 34.30 to 1.15 format with saturation and store in destination buffer */
+  pC[0] = (q15_t) __SSAT((c00 >> 15), 16);
+  if (nr == 2U)
+  {
+    pC[1] = (q15_t) __SSAT((c01 >> 15), 16);
+  }
+  if (mr == 2U)
+  {
+    pC[N] = (q15_t) __SSAT((c10 >> 15), 16);
+    if (nr == 2U)
+    {
+      pC[N + 1U] = (q15_t) __SSAT((c11 >> 15), 16);
+    }
+  }
+}
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Q15 matrix multiplication, register blocked and cache tiled.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcB      points to the second input matrix structure
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Computes 2x2 blocks of the output, every element of A and B loaded is used twice,
+                   for tiles of <code>ARM_MAT_BLOCK_N</code> columns of B which are reused by all rows
+                   of A. Each output element is accumulated over the whole K dimension.
+  @par           Scaling and Overflow Behavior
+                   Same as \ref arm_mat_mult_q15(), the results are bit exact: 34.30 accumulator without
+                   risk of overflow, truncated to 1.15 with saturation. No scratch buffer is needed.
+ */
+
+arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst)
+{
+  const q15_t *pA = pSrcA->pData;                    /* Input data matrix pointer A */
+  const q15_t *pB = pSrcB->pData;                    /* Input data matrix pointer B */
+        q15_t *pC = pDst->pData;                     /* Output data matrix pointer */
+        uint32_t M = pSrcA->numRows;                 /* Number of rows of input matrix A */
+        uint32_t K = pSrcA->numCols;                 /* Number of columns of input matrix A */
+        uint32_t N = pSrcB->numCols;                 /* Number of columns of input matrix B */
+        uint32_t jj, nc, i, j, mr, nr;              /* Tile and block indexes and sizes */
+        arm_status status;                           /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (jj = 0U; jj < N; jj += nc)
+    {
+      nc = ((N - jj) < ARM_MAT_BLOCK_N) ? (N - jj) : ARM_MAT_BLOCK_N;
+
+      for (i = 0U; i < M; i += mr)
+      {
+        mr = ((M - i) < 2U) ? (M - i) : 2U;
+
+        for (j = jj; j < (jj + nc); j += nr)
+        {
+          nr = ((jj + nc - j) < 2U) ? (jj + nc - j) : 2U;
+          arm_mat_mult_kernel_q15(pA + (i * K), pB + j, pC + (i * N) + j, K, N, mr, nr);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
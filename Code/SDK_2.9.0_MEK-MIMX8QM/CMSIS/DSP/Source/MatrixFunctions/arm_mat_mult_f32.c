@@ -62,7 +62,155 @@
  * @return     		The function returns either
  * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
  */
-#if defined(ARM_MATH_NEON)
+#if defined(ARM_MATH_SSE41)
+
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pInA = pSrcA->pData;          /* Input data matrix pointer A */
+  const float32_t *pIn1;                         /* Temporary input data matrix pointer A */
+  const float32_t *pIn2;                         /* Temporary input data matrix pointer B */
+        float32_t *pOut = pDst->pData;           /* Output data matrix pointer */
+        float32_t sum;                           /* Accumulator */
+        uint32_t numRowsA = pSrcA->numRows;      /* Number of rows of input matrix A */
+        uint32_t numColsB = pSrcB->numCols;      /* Number of columns of input matrix B */
+        uint32_t numColsA = pSrcA->numCols;      /* Number of columns of input matrix A */
+        uint32_t row, col, k;                    /* Loop counters */
+        arm_status status;                       /* Status of matrix multiplication */
+#if defined(ARM_MATH_AVX2)
+        __m256 acc0, acc1, a;                    /* 8 outputs per accumulator */
+#else
+        __m128 acc0, acc1, a;                    /* 4 outputs per accumulator */
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    /* Every lane is one output, the element of A multiplies a row of B: the
+     * products are added in the order of the scalar code, and B is read row-wise */
+    for (row = 0U; row < numRowsA; row++)
+    {
+      col = 0U;
+
+#if defined(ARM_MATH_AVX2)
+
+      /* 16 columns at a time */
+      for (; (col + 16U) <= numColsB; col += 16U)
+      {
+        acc0 = _mm256_setzero_ps();
+        acc1 = _mm256_setzero_ps();
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          a = _mm256_set1_ps(pInA[k]);
+          acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(a, _mm256_loadu_ps(pIn2)));
+          acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(a, _mm256_loadu_ps(pIn2 + 8)));
+          pIn2 += numColsB;
+        }
+
+        _mm256_storeu_ps(pOut + col, acc0);
+        _mm256_storeu_ps(pOut + col + 8U, acc1);
+      }
+
+      /* 8 columns */
+      for (; (col + 8U) <= numColsB; col += 8U)
+      {
+        acc0 = _mm256_setzero_ps();
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_set1_ps(pInA[k]), _mm256_loadu_ps(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        _mm256_storeu_ps(pOut + col, acc0);
+      }
+
+#else
+
+      /* 8 columns at a time */
+      for (; (col + 8U) <= numColsB; col += 8U)
+      {
+        acc0 = _mm_setzero_ps();
+        acc1 = _mm_setzero_ps();
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          a = _mm_set1_ps(pInA[k]);
+          acc0 = _mm_add_ps(acc0, _mm_mul_ps(a, _mm_loadu_ps(pIn2)));
+          acc1 = _mm_add_ps(acc1, _mm_mul_ps(a, _mm_loadu_ps(pIn2 + 4)));
+          pIn2 += numColsB;
+        }
+
+        _mm_storeu_ps(pOut + col, acc0);
+        _mm_storeu_ps(pOut + col + 4U, acc1);
+      }
+
+      /* 4 columns */
+      for (; (col + 4U) <= numColsB; col += 4U)
+      {
+        acc0 = _mm_setzero_ps();
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_set1_ps(pInA[k]), _mm_loadu_ps(pIn2)));
+          pIn2 += numColsB;
+        }
+
+        _mm_storeu_ps(pOut + col, acc0);
+      }
+
+#endif /* #if defined(ARM_MATH_AVX2) */
+
+      /* Remaining columns */
+      for (; col < numColsB; col++)
+      {
+        sum = 0.0f;
+        pIn1 = pInA;
+        pIn2 = pSrcB->pData + col;
+
+        for (k = 0U; k < numColsA; k++)
+        {
+          /* c(m,n) = a(1,1) * b(1,1) + a(1,2) * b(2,1) + .... + a(m,p) * b(p,n) */
+          sum += *pIn1++ * *pIn2;
+          pIn2 += numColsB;
+        }
+
+        pOut[col] = sum;
+      }
+
+      /* Next row of A and of the output */
+      pInA += numColsA;
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+#elif defined(ARM_MATH_NEON)
 
 #define GROUPOFROWS 8
 
@@ -527,7 +675,7 @@ arm_status arm_mat_mult_f32(
   return (status);
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
+#endif /* #if defined(ARM_MATH_SSE41) */
 
 /**
  * @} end of MatrixMult group
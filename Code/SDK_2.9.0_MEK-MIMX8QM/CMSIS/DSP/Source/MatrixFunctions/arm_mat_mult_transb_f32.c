@@ -0,0 +1,158 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_transb_f32.c
+ * Description:  Floating-point matrix multiplication by a transposed matrix
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/*
+ * C[mr][nr] = A[mr][K] * transpose(BT[nr][K]), mr and nr up to 4. All
+ * operands are rows, read sequentially.
+ */
+static void arm_mat_mult_transb_kernel_f32(
+  const float32_t * pA,
+  const float32_t * pBT,
+        float32_t * pC,
+        uint32_t K,
+        uint32_t N,
+        uint32_t mr,
+        uint32_t nr)
+{
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = pA + ((mr > 1U) ? K : 0U);
+  const float32_t *pA2 = pA + ((mr > 2U) ? (2U * K) : 0U);
+  const float32_t *pA3 = pA + ((mr > 3U) ? (3U * K) : 0U);
+  const float32_t *pB0 = pBT;
+  const float32_t *pB1 = pBT + ((nr > 1U) ? K : 0U);
+  const float32_t *pB2 = pBT + ((nr > 2U) ? (2U * K) : 0U);
+  const float32_t *pB3 = pBT + ((nr > 3U) ? (3U * K) : 0U);
+        float32_t c[4][4];
+        float32_t a0, a1, a2, a3, b0, b1, b2, b3;
+        uint32_t i, j, k;
+
+  /* Missing rows alias row 0, their results are not stored */
+  for (i = 0U; i < 4U; i++)
+  {
+    for (j = 0U; j < 4U; j++)
+    {
+      c[i][j] = 0.0f;
+    }
+  }
+
+  for (k = 0U; k < K; k++)
+  {
+    a0 = pA0[k];
+    a1 = pA1[k];
+    a2 = pA2[k];
+    a3 = pA3[k];
+    b0 = pB0[k];
+    b1 = pB1[k];
+    b2 = pB2[k];
+    b3 = pB3[k];
+
+    c[0][0] += a0 * b0;  c[0][1] += a0 * b1;  c[0][2] += a0 * b2;  c[0][3] += a0 * b3;
+    c[1][0] += a1 * b0;  c[1][1] += a1 * b1;  c[1][2] += a1 * b2;  c[1][3] += a1 * b3;
+    c[2][0] += a2 * b0;  c[2][1] += a2 * b1;  c[2][2] += a2 * b2;  c[2][3] += a2 * b3;
+    c[3][0] += a3 * b0;  c[3][1] += a3 * b1;  c[3][2] += a3 * b2;  c[3][3] += a3 * b3;
+  }
+
+  for (i = 0U; i < mr; i++)
+  {
+    for (j = 0U; j < nr; j++)
+    {
+      pC[(i * N) + j] = c[i][j];
+    }
+  }
+}
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix multiplication by a transposed matrix.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcBT     points to the transpose of the second input matrix
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Computes <code>pSrcA * transpose(pSrcBT)</code>: every output element is the dot product
+                   of a row of A and a row of BT, both contiguous. This is the fast path when B is
+                   available transposed, for example a weight matrix stored by output. 4x4 output blocks
+                   are accumulated in registers, for tiles of <code>ARM_MAT_BLOCK_N</code> rows of BT
+                   which are reused by all rows of A.
+ */
+
+arm_status arm_mat_mult_transb_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcBT,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pA = pSrcA->pData;                /* Input data matrix pointer A */
+  const float32_t *pBT = pSrcBT->pData;              /* Input data matrix pointer BT */
+        float32_t *pC = pDst->pData;                 /* Output data matrix pointer */
+        uint32_t M = pSrcA->numRows;                 /* Number of rows of input matrix A */
+        uint32_t K = pSrcA->numCols;                 /* Number of columns of input matrices A and BT */
+        uint32_t N = pSrcBT->numRows;                /* Number of rows of input matrix BT */
+        uint32_t jj, nc, i, j, mr, nr;              /* Tile and block indexes and sizes */
+        arm_status status;                           /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcBT->numCols) ||
+      (pSrcA->numRows != pDst->numRows)   ||
+      (pSrcBT->numRows != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (jj = 0U; jj < N; jj += nc)
+    {
+      nc = ((N - jj) < ARM_MAT_BLOCK_N) ? (N - jj) : ARM_MAT_BLOCK_N;
+
+      for (i = 0U; i < M; i += mr)
+      {
+        mr = ((M - i) < 4U) ? (M - i) : 4U;
+
+        for (j = jj; j < (jj + nc); j += nr)
+        {
+          nr = ((jj + nc - j) < 4U) ? (jj + nc - j) : 4U;
+          arm_mat_mult_transb_kernel_f32(pA + (i * K), pBT + (j * K), pC + (i * N) + j, K, N, mr, nr);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
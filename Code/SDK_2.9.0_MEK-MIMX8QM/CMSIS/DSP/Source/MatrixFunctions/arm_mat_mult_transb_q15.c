@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_transb_q15.c
+ * Description:  Q15 matrix multiplication by a transposed matrix
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/*
+ * C[mr][nr] = A[mr][K] * transpose(BT[nr][K]), mr and nr up to 2. Missing
+ * rows alias row 0, their results are not stored.
+ */
+static void arm_mat_mult_transb_kernel_q15(
+  const q15_t * pA,
+  const q15_t * pBT,
+        q15_t * pC,
+        uint32_t K,
+        uint32_t N,
+        uint32_t mr,
+        uint32_t nr)
+{
+  const q15_t *pA0 = pA;
+  const q15_t *pA1 = pA + ((mr > 1U) ? K : 0U);
+  const q15_t *pB0 = pBT;
+  const q15_t *pB1 = pBT + ((nr > 1U) ? K : 0U);
+        q63_t c00 = 0, c01 = 0, c10 = 0, c11 = 0;
+        q31_t a0, a1, b0, b1;
+        uint32_t k;
+
+  for (k = 0U; k < K; k++)
+  {
+    a0 = pA0[k];
+    a1 = pA1[k];
+    b0 = pB0[k];
+    b1 = pB1[k];
+    c00 += (q31_t) (a0 * b0);
+    c01 += (q31_t) (a0 * b1);
+    c10 += (q31_t) (a1 * b0);
+    c11 += (q31_t) (a1 * b1);
+  }
+
+  /* Convert result from 34.30 to 1.15 format with saturation and store in destination buffer */
+  pC[0] = (q15_t) __SSAT((c00 >> 15), 16);
+  if (nr == 2U)
+  {
+    pC[1] = (q15_t) __SSAT((c01 >> 15), 16);
+  }
+  if (mr == 2U)
+  {
+    pC[N] = (q15_t) __SSAT((c10 >> 15), 16);
+    if (nr == 2U)
+    {
+      pC[N + 1U] = (q15_t) __SSAT((c11 >> 15), 16);
+    }
+  }
+}
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixMult
+  @{
+ */
+
+/**
+  @brief         Q15 matrix multiplication by a transposed matrix.
+  @param[in]     pSrcA      points to the first input matrix structure
+  @param[in]     pSrcBT     points to the transpose of the second input matrix
+  @param[out]    pDst       points to output matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+
+  @par           Details
+                   Computes <code>pSrcA * transpose(pSrcBT)</code> from contiguous rows of both matrices,
+                   in 2x2 output blocks, for tiles of <code>ARM_MAT_BLOCK_N</code> rows of BT.
+  @par           Scaling and Overflow Behavior
+                   Same as \ref arm_mat_mult_q15(): 34.30 accumulator without risk of overflow, truncated
+                   to 1.15 with saturation.
+ */
+
+arm_status arm_mat_mult_transb_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcBT,
+        arm_matrix_instance_q15 * pDst)
+{
+  const q15_t *pA = pSrcA->pData;                    /* Input data matrix pointer A */
+  const q15_t *pBT = pSrcBT->pData;                  /* Input data matrix pointer BT */
+        q15_t *pC = pDst->pData;                     /* Output data matrix pointer */
+        uint32_t M = pSrcA->numRows;                 /* Number of rows of input matrix A */
+        uint32_t K = pSrcA->numCols;                 /* Number of columns of input matrices A and BT */
+        uint32_t N = pSrcBT->numRows;                /* Number of rows of input matrix BT */
+        uint32_t jj, nc, i, j, mr, nr;              /* Tile and block indexes and sizes */
+        arm_status status;                           /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcBT->numCols) ||
+      (pSrcA->numRows != pDst->numRows)   ||
+      (pSrcBT->numRows != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    for (jj = 0U; jj < N; jj += nc)
+    {
+      nc = ((N - jj) < ARM_MAT_BLOCK_N) ? (N - jj) : ARM_MAT_BLOCK_N;
+
+      for (i = 0U; i < M; i += mr)
+      {
+        mr = ((M - i) < 2U) ? (M - i) : 2U;
+
+        for (j = jj; j < (jj + nc); j += nr)
+        {
+          nr = ((jj + nc - j) < 2U) ? (jj + nc - j) : 2U;
+          arm_mat_mult_transb_kernel_q15(pA + (i * K), pBT + (j * K), pC + (i * N) + j, K, N, mr, nr);
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixMult group
+ */
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_f32.c
+ * Description:  Floating-point Householder QR decomposition
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixQR QR Decomposition
+
+  Computes the QR decomposition of a matrix with at least as many rows as columns.
+
+  The decomposition is <code>A = Q * R</code>, where <code>Q</code> is orthogonal and
+  <code>R</code> upper triangular. It is the most robust of the factorizations, works on
+  any matrix of full column rank and, with \ref arm_mat_qr_solve_f32(), gives the least
+  squares solution of an overdetermined system.
+
+  @par Algorithm
+  <code>Q</code> is the product of <code>numCols</code> Householder reflections
+  <code>H(k) = I - tau(k) * v(k) * v(k)^t</code>. As in LAPACK, the output holds
+  <code>R</code> on and above the diagonal and <code>v(k)</code> below the diagonal of column
+  <code>k</code>, its first element being one. <code>Q</code> is never formed. The reflections
+  are applied row by row to the trailing columns, with the unused end of <code>pTau</code> as
+  the row accumulator, so no other memory is needed. The function can be called in-place
+  (pSrc == pDst).
+ */
+
+/**
+  @addtogroup MatrixQR
+  @{
+ */
+
+/**
+  @brief         Floating-point Householder QR decomposition.
+  @param[in]     pSrc      points to the input matrix structure
+  @param[out]    pDst      points to the output matrix structure, R and the reflections
+  @param[out]    pTau      points to the output reflection factors, numCols values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+ */
+
+arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        float32_t * pTau)
+{
+  const uint32_t m = pSrc->numRows;
+  const uint32_t n = pSrc->numCols;
+        float32_t *pR = pDst->pData;
+        float32_t *pRow;
+        float32_t alpha, sigma, beta, scale, tau, v;
+        uint32_t i, j, k;
+        arm_status status;                             /* status of matrix decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows < pSrc->numCols) ||
+      (pDst->numRows != m) ||
+      (pDst->numCols != n)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    if (pR != pSrc->pData)
+    {
+      memcpy(pR, pSrc->pData, m * n * sizeof(float32_t));
+    }
+
+    for (k = 0U; k < n; k++)
+    {
+      /* Reflection of column k below the diagonal onto beta * e(k) */
+      alpha = pR[(k * n) + k];
+      sigma = 0.0f;
+      for (i = k + 1U; i < m; i++)
+      {
+        sigma += pR[(i * n) + k] * pR[(i * n) + k];
+      }
+
+      if (sigma == 0.0f)
+      {
+        /* Already triangular, H(k) = I */
+        pTau[k] = 0.0f;
+        continue;
+      }
+
+      beta = sqrtf((alpha * alpha) + sigma);
+      if (alpha > 0.0f)
+      {
+        beta = -beta;
+      }
+      tau = (beta - alpha) / beta;
+      scale = 1.0f / (alpha - beta);
+      for (i = k + 1U; i < m; i++)
+      {
+        pR[(i * n) + k] *= scale;
+      }
+      pR[(k * n) + k] = beta;
+      pTau[k] = tau;
+
+      /* w = v^t * R(k:m, k+1:n), accumulated row by row in pTau[k+1:n] */
+      for (j = k + 1U; j < n; j++)
+      {
+        pTau[j] = pR[(k * n) + j];
+      }
+      for (i = k + 1U; i < m; i++)
+      {
+        v = pR[(i * n) + k];
+        pRow = pR + (i * n);
+        for (j = k + 1U; j < n; j++)
+        {
+          pTau[j] += v * pRow[j];
+        }
+      }
+
+      /* R(k:m, k+1:n) -= tau * v * w */
+      for (j = k + 1U; j < n; j++)
+      {
+        pTau[j] *= tau;
+        pR[(k * n) + j] -= pTau[j];
+      }
+      for (i = k + 1U; i < m; i++)
+      {
+        v = pR[(i * n) + k];
+        pRow = pR + (i * n);
+        for (j = k + 1U; j < n; j++)
+        {
+          pRow[j] -= v * pTau[j];
+        }
+      }
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixQR group
+ */
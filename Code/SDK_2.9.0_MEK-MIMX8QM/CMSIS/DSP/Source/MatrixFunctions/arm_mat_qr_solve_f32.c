@@ -0,0 +1,136 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_qr_solve_f32.c
+ * Description:  Floating-point least squares solve with a QR decomposition
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixQR
+  @{
+ */
+
+/**
+  @brief         Solves A * X = B in place in the least squares sense, with the QR decomposition of A.
+  @param[in]     pSrcQR    points to the decomposition computed by \ref arm_mat_qr_f32()
+  @param[in]     pTau      points to the reflection factors
+  @param[in,out] pSrcDst   points to B on input, numRows(A) rows; X on output, in the first numCols(A) rows
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : A is rank deficient
+
+  @par           Details
+                   The reflections are applied to <code>B</code>, giving <code>Q^t * B</code>,
+                   then <code>R * X</code> equal to its first <code>numCols(A)</code> rows is solved
+                   by back substitution. The remaining rows hold the residual in the basis of
+                   <code>Q</code>.
+ */
+
+arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcQR,
+  const float32_t * pTau,
+        arm_matrix_instance_f32 * pSrcDst)
+{
+  const uint32_t m = pSrcQR->numRows;
+  const uint32_t n = pSrcQR->numCols;
+  const uint32_t cols = pSrcDst->numCols;
+  const float32_t *pR = pSrcQR->pData;
+  const float32_t *pXj;
+        float32_t *pX = pSrcDst->pData;
+        float32_t *pXi;
+        float32_t w, r, inv;
+        uint32_t i, j, k, c;
+        arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcQR->numRows < pSrcQR->numCols) ||
+      (pSrcDst->numRows != m)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pR[(i * n) + i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+  }
+
+  if (status == ARM_MATH_SUCCESS)
+  {
+    /* B = H(k) * B, for k = 0 .. n-1 */
+    for (k = 0U; k < n; k++)
+    {
+      if (pTau[k] == 0.0f)
+      {
+        continue;
+      }
+      for (c = 0U; c < cols; c++)
+      {
+        w = pX[(k * cols) + c];
+        for (i = k + 1U; i < m; i++)
+        {
+          w += pR[(i * n) + k] * pX[(i * cols) + c];
+        }
+        w *= pTau[k];
+        pX[(k * cols) + c] -= w;
+        for (i = k + 1U; i < m; i++)
+        {
+          pX[(i * cols) + c] -= pR[(i * n) + k] * w;
+        }
+      }
+    }
+
+    /* R * X = (Q^t * B)(0:n, :) */
+    for (i = n; i > 0U; i--)
+    {
+      pXi = pX + ((i - 1U) * cols);
+      for (j = i; j < n; j++)
+      {
+        r = pR[((i - 1U) * n) + j];
+        pXj = pX + (j * cols);
+        for (k = 0U; k < cols; k++)
+        {
+          pXi[k] -= r * pXj[k];
+        }
+      }
+      inv = 1.0f / pR[((i - 1U) * n) + (i - 1U)];
+      for (k = 0U; k < cols; k++)
+      {
+        pXi[k] *= inv;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixQR group
+ */
@@ -0,0 +1,122 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f32.c
+ * Description:  Floating-point forward substitution
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixTriSolve Triangular Solve
+
+  Solves <code>T * X = A</code> where <code>T</code> is a square lower or upper triangular
+  matrix, by forward or back substitution.
+
+  <code>A</code> and <code>X</code> have <code>numRows(T)</code> rows and any number of
+  columns, one column per right-hand side. A row of <code>X</code> is computed from the
+  rows already solved with sequential multiply-accumulates over whole rows. The elements
+  on the other side of the diagonal of <code>T</code> are not read, so a factor stored in
+  place of its source matrix can be used as is. The functions can be called in-place
+  (pSrc == pDst).
+ */
+
+/**
+  @addtogroup MatrixTriSolve
+  @{
+ */
+
+/**
+  @brief         Solves L * X = A for a lower triangular matrix L.
+  @param[in]     pSrcL     points to the lower triangular matrix structure
+  @param[in]     pSrc      points to the right-hand side matrix structure
+  @param[out]    pDst      points to the solution matrix structure
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : A diagonal element of L is zero
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  const uint32_t n = pSrcL->numRows;
+  const uint32_t cols = pSrc->numCols;
+  const float32_t *pL = pSrcL->pData;
+  const float32_t *pXj;
+        float32_t *pXi;
+        float32_t l, inv;
+        uint32_t i, j, k;
+        arm_status status;                             /* status of matrix solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcL->numRows != pSrcL->numCols) ||
+      (pSrc->numRows != n) ||
+      (pDst->numRows != n) ||
+      (pDst->numCols != cols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      /* X(i,:) = (A(i,:) - sum(L(i,j) * X(j,:), j < i)) / L(i,i) */
+      pXi = pDst->pData + (i * cols);
+      if (pDst->pData != pSrc->pData)
+      {
+        memcpy(pXi, pSrc->pData + (i * cols), cols * sizeof(float32_t));
+      }
+
+      for (j = 0U; j < i; j++)
+      {
+        l = pL[(i * n) + j];
+        pXj = pDst->pData + (j * cols);
+        for (k = 0U; k < cols; k++)
+        {
+          pXi[k] -= l * pXj[k];
+        }
+      }
+
+      l = pL[(i * n) + i];
+      if (l == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+        break;
+      }
+      inv = 1.0f / l;
+      for (k = 0U; k < cols; k++)
+      {
+        pXi[k] *= inv;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixTriSolve group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f32.c
+ * Description:  Floating-point matrix and vector multiplication
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixVectMult Matrix Vector Multiplication
+
+  Multiplies a matrix and a vector.
+
+  The matrix has <code>numRows</code> rows and <code>numCols</code> columns, the vector
+  <code>numCols</code> values and the result <code>numRows</code> values. Four rows are
+  processed together, so every element of the vector is loaded once for four
+  multiply-accumulates, and all accesses are sequential.
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector
+  @param[out]    pDst     points to the output vector
+  @return        none
+ */
+
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  const uint32_t numRows = pSrcMat->numRows;
+  const uint32_t numCols = pSrcMat->numCols;
+  const float32_t *pRow0 = pSrcMat->pData;
+  const float32_t *pRow1, *pRow2, *pRow3;
+        float32_t sum0;
+        uint32_t row, k;
+#if defined(ARM_MATH_SSE41)
+        __m128 r0, r1, r2, r3, acc;
+#else
+        float32_t sum1, sum2, sum3, x;
+#endif
+
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+#if defined(ARM_MATH_SSE41)
+
+    /* The 4 sums in the lanes of acc, a 4x4 block of the rows is transposed so that
+       each sum still adds its products in the order of k */
+    acc = _mm_setzero_ps();
+
+    for (k = 0U; (k + 4U) <= numCols; k += 4U)
+    {
+      r0 = _mm_loadu_ps(pRow0 + k);
+      r1 = _mm_loadu_ps(pRow1 + k);
+      r2 = _mm_loadu_ps(pRow2 + k);
+      r3 = _mm_loadu_ps(pRow3 + k);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+      acc = _mm_add_ps(acc, _mm_mul_ps(r0, _mm_set1_ps(pVec[k])));
+      acc = _mm_add_ps(acc, _mm_mul_ps(r1, _mm_set1_ps(pVec[k + 1U])));
+      acc = _mm_add_ps(acc, _mm_mul_ps(r2, _mm_set1_ps(pVec[k + 2U])));
+      acc = _mm_add_ps(acc, _mm_mul_ps(r3, _mm_set1_ps(pVec[k + 3U])));
+    }
+
+    for (; k < numCols; k++)
+    {
+      r0 = _mm_setr_ps(pRow0[k], pRow1[k], pRow2[k], pRow3[k]);
+      acc = _mm_add_ps(acc, _mm_mul_ps(r0, _mm_set1_ps(pVec[k])));
+    }
+
+    _mm_storeu_ps(pDst, acc);
+    pDst += 4;
+
+#else
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+    for (k = 0U; k < numCols; k++)
+    {
+      x = pVec[k];
+      sum0 += pRow0[k] * x;
+      sum1 += pRow1[k] * x;
+      sum2 += pRow2[k] * x;
+      sum3 += pRow3[k] * x;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+#endif /* #if defined(ARM_MATH_SSE41) */
+
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    sum0 = 0.0f;
+    for (k = 0U; k < numCols; k++)
+    {
+      sum0 += pRow0[k] * pVec[k];
+    }
+    *pDst++ = sum0;
+    pRow0 += numCols;
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
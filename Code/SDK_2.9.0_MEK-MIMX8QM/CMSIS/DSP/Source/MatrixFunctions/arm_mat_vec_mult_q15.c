@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q15.c
+ * Description:  Q15 matrix and vector multiplication
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q15 matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector
+  @param[out]    pDst     points to the output vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator, as \ref arm_mat_mult_q15().
+                   The inputs are in 1.15 format and their products in 2.30, accumulated in 34.30 format
+                   without risk of overflow. The result is truncated to 1.15 with saturation.
+ */
+
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst)
+{
+  const uint32_t numRows = pSrcMat->numRows;
+  const uint32_t numCols = pSrcMat->numCols;
+  const q15_t *pRow0 = pSrcMat->pData;
+  const q15_t *pRow1, *pRow2, *pRow3;
+        q63_t sum0, sum1, sum2, sum3;
+        q31_t x;
+        uint32_t row, k;
+
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    for (k = 0U; k < numCols; k++)
+    {
+      x = pVec[k];
+      sum0 += (q31_t) (pRow0[k] * x);
+      sum1 += (q31_t) (pRow1[k] * x);
+      sum2 += (q31_t) (pRow2[k] * x);
+      sum3 += (q31_t) (pRow3[k] * x);
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum1 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum2 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum3 >> 15), 16);
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    sum0 = 0;
+    for (k = 0U; k < numCols; k++)
+    {
+      sum0 += (q31_t) (pRow0[k] * pVec[k]);
+    }
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+    pRow0 += numCols;
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
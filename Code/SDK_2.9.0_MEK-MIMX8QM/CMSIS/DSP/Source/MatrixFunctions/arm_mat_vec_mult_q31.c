@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q31.c
+ * Description:  Q31 matrix and vector multiplication
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q31 matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector
+  @param[out]    pDst     points to the output vector
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator, as \ref arm_mat_mult_q31().
+                   The inputs are in 1.31 format and their products in 2.62, accumulated with a single
+                   guard bit. The input is scaled down by log2(numCols) bits to avoid overflows.
+                   The 2.62 accumulator is right shifted by 31 bits to yield the 1.31 result.
+ */
+
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst)
+{
+  const uint32_t numRows = pSrcMat->numRows;
+  const uint32_t numCols = pSrcMat->numCols;
+  const q31_t *pRow0 = pSrcMat->pData;
+  const q31_t *pRow1, *pRow2, *pRow3;
+        q63_t sum0, sum1, sum2, sum3;
+        q31_t x;
+        uint32_t row, k;
+
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+    for (k = 0U; k < numCols; k++)
+    {
+      x = pVec[k];
+      sum0 += (q63_t) pRow0[k] * x;
+      sum1 += (q63_t) pRow1[k] * x;
+      sum2 += (q63_t) pRow2[k] * x;
+      sum3 += (q63_t) pRow3[k] * x;
+    }
+
+    *pDst++ = (q31_t) (sum0 >> 31);
+    *pDst++ = (q31_t) (sum1 >> 31);
+    *pDst++ = (q31_t) (sum2 >> 31);
+    *pDst++ = (q31_t) (sum3 >> 31);
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    sum0 = 0;
+    for (k = 0U; k < numCols; k++)
+    {
+      sum0 += (q63_t) pRow0[k] * pVec[k];
+    }
+    *pDst++ = (q31_t) (sum0 >> 31);
+    pRow0 += numCols;
+  }
+}
+
+/**
+  @} end of MatrixVectMult group
+ */
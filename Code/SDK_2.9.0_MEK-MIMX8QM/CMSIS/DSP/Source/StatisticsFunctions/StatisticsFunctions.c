@@ -45,6 +45,21 @@
 #include "arm_rms_f32.c"
 #include "arm_rms_q15.c"
 #include "arm_rms_q31.c"
+#include "arm_stats_accumulate_f32.c"
+#include "arm_stats_accumulate_q15.c"
+#include "arm_stats_accumulate_q31.c"
+#include "arm_stats_f32.c"
+#include "arm_stats_get_f32.c"
+#include "arm_stats_get_q15.c"
+#include "arm_stats_get_q31.c"
+#include "arm_stats_init_f32.c"
+#include "arm_stats_init_q15.c"
+#include "arm_stats_init_q31.c"
+#include "arm_stats_merge_f32.c"
+#include "arm_stats_merge_q15.c"
+#include "arm_stats_merge_q31.c"
+#include "arm_stats_q15.c"
+#include "arm_stats_q31.c"
 #include "arm_std_f32.c"
 #include "arm_std_q15.c"
 #include "arm_std_q31.c"
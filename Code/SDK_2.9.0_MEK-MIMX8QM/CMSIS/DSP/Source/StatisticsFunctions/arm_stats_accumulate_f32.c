@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accumulate_f32.c
+ * Description:  Adds a block of samples to the floating-point running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Samples summed before each update of the mean, the division is taken once per group */
+#define STATS_GROUP     64U
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the floating-point running statistics.
+  @param[in,out] S          points to an instance of the running statistics structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to add
+  @return        none
+ */
+
+void arm_stats_accumulate_f32(
+        arm_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        float32_t shift, d, sum, sumOfSquares, x;
+        float32_t minVal, maxVal, delta, meanB, nA, nB, n;
+        uint32_t minIndex, maxIndex, blkCnt, i;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  if (S->count == 0U)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+    S->minIndex = 0U;
+    S->maxIndex = 0U;
+  }
+  minVal = S->min;
+  maxVal = S->max;
+  minIndex = S->minIndex;
+  maxIndex = S->maxIndex;
+
+  while (blockSize > 0U)
+  {
+    blkCnt = (blockSize < STATS_GROUP) ? blockSize : STATS_GROUP;
+
+    /* Deviations from the current mean, or from the first sample of the stream */
+    shift = (S->count == 0U) ? pSrc[0] : S->mean;
+    sum = 0.0f;
+    sumOfSquares = 0.0f;
+
+    for (i = 0U; i < blkCnt; i++)
+    {
+      x = pSrc[i];
+      d = x - shift;
+      sum += d;
+      sumOfSquares += d * d;
+
+      if (x < minVal)
+      {
+        minVal = x;
+        minIndex = S->count + i;
+      }
+      if (x > maxVal)
+      {
+        maxVal = x;
+        maxIndex = S->count + i;
+      }
+    }
+
+    /* Merge the group: its mean is shift + sum / nB, its M2 sumOfSquares - sum^2 / nB */
+    nA = (float32_t) S->count;
+    nB = (float32_t) blkCnt;
+    n = nA + nB;
+    meanB = shift + (sum / nB);
+    delta = meanB - S->mean;
+    S->mean += delta * (nB / n);
+    S->m2 += (sumOfSquares - ((sum * sum) / nB)) + (((delta * delta) * nA) * (nB / n));
+    S->count += blkCnt;
+
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+  }
+
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIndex;
+  S->maxIndex = maxIndex;
+}
+
+/**
+  @} end of FusedStats group
+ */
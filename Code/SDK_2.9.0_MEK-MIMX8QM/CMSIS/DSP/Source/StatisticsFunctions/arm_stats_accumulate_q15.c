@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accumulate_q15.c
+ * Description:  Adds a block of samples to the Q15 running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the Q15 running statistics.
+  @param[in,out] S          points to an instance of the running statistics structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to add
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The sum of the samples is accumulated in 49.15 format and the sum of their
+                   squares in 34.30 format, as in \ref arm_var_q15(). There is no saturation.
+ */
+
+void arm_stats_accumulate_q15(
+        arm_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize)
+{
+        q63_t sum = S->sum, sumOfSquares = S->sumOfSquares;
+        q15_t in, minVal, maxVal;
+        uint32_t minIndex, maxIndex, i;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  if (S->count == 0U)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+    S->minIndex = 0U;
+    S->maxIndex = 0U;
+  }
+  minVal = S->min;
+  maxVal = S->max;
+  minIndex = S->minIndex;
+  maxIndex = S->maxIndex;
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    sum += in;
+    sumOfSquares += ((q31_t) in * in);
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = S->count + i;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = S->count + i;
+    }
+  }
+
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIndex;
+  S->maxIndex = maxIndex;
+  S->count += blockSize;
+}
+
+/**
+  @} end of FusedStats group
+ */
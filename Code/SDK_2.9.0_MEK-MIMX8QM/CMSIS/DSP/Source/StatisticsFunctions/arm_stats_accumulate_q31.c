@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_accumulate_q31.c
+ * Description:  Adds a block of samples to the Q31 running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Adds a block of samples to the Q31 running statistics.
+  @param[in,out] S          points to an instance of the running statistics structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to add
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The sum of the samples is accumulated in 33.31 format. As in \ref arm_var_q31(),
+                   the samples are also shifted right by 8 bits, to 1.23 format, and the sum of
+                   their squares accumulated in 18.46 format, with 16 guard bits. There is no
+                   saturation, the accumulators wrap around after 65536 full scale samples.
+ */
+
+void arm_stats_accumulate_q31(
+        arm_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        q63_t sum = S->sum, sum8 = S->sum8, sumOfSquares = S->sumOfSquares;
+        q31_t in, minVal, maxVal;
+        uint32_t minIndex, maxIndex, i;
+
+  if (blockSize == 0U)
+  {
+    return;
+  }
+
+  if (S->count == 0U)
+  {
+    S->min = pSrc[0];
+    S->max = pSrc[0];
+    S->minIndex = 0U;
+    S->maxIndex = 0U;
+  }
+  minVal = S->min;
+  maxVal = S->max;
+  minIndex = S->minIndex;
+  maxIndex = S->maxIndex;
+
+  for (i = 0U; i < blockSize; i++)
+  {
+    in = pSrc[i];
+    sum += in;
+    if (in < minVal)
+    {
+      minVal = in;
+      minIndex = S->count + i;
+    }
+    if (in > maxVal)
+    {
+      maxVal = in;
+      maxIndex = S->count + i;
+    }
+
+    in >>= 8U;
+    sum8 += in;
+    sumOfSquares += ((q63_t) in * in);
+  }
+
+  S->sum = sum;
+  S->sum8 = sum8;
+  S->sumOfSquares = sumOfSquares;
+  S->min = minVal;
+  S->max = maxVal;
+  S->minIndex = minIndex;
+  S->maxIndex = maxIndex;
+  S->count += blockSize;
+}
+
+/**
+  @} end of FusedStats group
+ */
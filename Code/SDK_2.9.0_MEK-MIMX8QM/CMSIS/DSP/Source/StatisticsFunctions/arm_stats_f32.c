@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_f32.c
+ * Description:  Summary statistics of a floating-point vector in one pass
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup FusedStats Fused Statistics
+
+  Computes the mean, variance, standard deviation, RMS, power, minimum and maximum
+  of a vector, and the indices of the minimum and maximum, in one pass over the data.
+
+  Calling the separate functions reads the buffer once per statistic, twice for the
+  variance and standard deviation. The fused functions read it once, and accept data
+  arriving in blocks: \ref arm_stats_accumulate_f32() adds a block to a running
+  statistics instance, \ref arm_stats_merge_f32() combines the instances of two parts
+  of a stream, computed for example by two tasks, and \ref arm_stats_get_f32() returns the
+  summary. \ref arm_stats_f32() does the three steps for one buffer.
+
+  @par Algorithm
+  The floating-point functions keep the mean and the sum of the squared deviations
+  <code>M2</code>, as Welford's algorithm, rather than the sum of the squares, which loses
+  the variance to cancellation when the mean is large. To avoid a division per sample the
+  samples are taken 64 at a time: the sums of their deviations from the current mean and
+  of the squares of the deviations give the mean and <code>M2</code> of the group, which are
+  merged with Chan's formula
+  <pre>
+      delta = meanB - meanA
+      mean  = meanA + delta * nB / (nA + nB)
+      M2    = M2A + M2B + delta^2 * nA * nB / (nA + nB)
+  </pre>
+  The fixed-point functions accumulate the sum and the sum of the squares exactly in
+  64-bit integers, with the scaling of \ref arm_var_q31() and \ref arm_var_q15(), so there is
+  no rounding to accumulate and partial sums simply add. The Q15 results are those of the
+  separate functions.
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Summary statistics of a floating-point vector, in one pass.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    summary statistics returned here
+  @return        none
+ */
+
+void arm_stats_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_summary_f32 * pResult)
+{
+  arm_stats_instance_f32 S;
+
+  arm_stats_init_f32(&S);
+  arm_stats_accumulate_f32(&S, pSrc, blockSize);
+  arm_stats_get_f32(&S, pResult);
+}
+
+/**
+  @} end of FusedStats group
+ */
@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_f32.c
+ * Description:  Summary statistics of the floating-point running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Summary statistics of the samples accumulated in the floating-point running statistics.
+  @param[in]     S          points to an instance of the running statistics structure
+  @param[out]    pResult    summary statistics returned here
+  @return        none
+
+  @par           Details
+                   The variance is the sample variance, divided by <code>count - 1</code>, and
+                   is zero for less than two samples. The power is computed as
+                   <code>M2 + count * mean^2</code>.
+ */
+
+void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+        arm_stats_summary_f32 * pResult)
+{
+  float32_t n = (float32_t) S->count;
+
+  pResult->mean = S->mean;
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+
+  pResult->var = (S->count > 1U) ? (S->m2 / (n - 1.0f)) : 0.0f;
+  arm_sqrt_f32(pResult->var, &pResult->std);
+
+  pResult->power = S->m2 + ((S->mean * S->mean) * n);
+  if (S->count > 0U)
+  {
+    arm_sqrt_f32(pResult->power / n, &pResult->rms);
+  }
+  else
+  {
+    pResult->rms = 0.0f;
+  }
+}
+
+/**
+  @} end of FusedStats group
+ */
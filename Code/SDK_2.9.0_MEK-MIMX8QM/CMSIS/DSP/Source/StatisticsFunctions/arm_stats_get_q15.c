@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_q15.c
+ * Description:  Summary statistics of the Q15 running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Summary statistics of the samples accumulated in the Q15 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure
+  @param[out]    pResult    summary statistics returned here
+  @return        none
+
+  @par           Details
+                   The mean is truncated to 1.15 format as in \ref arm_mean_q15(). The variance,
+                   standard deviation and RMS are computed from the 34.30 sums as in
+                   \ref arm_std_q15() and \ref arm_rms_q15(), the variance is saturated to
+                   1.15 format, and the power is the sum of the squares in 34.30 format.
+ */
+
+void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+        arm_stats_summary_q15 * pResult)
+{
+  const q63_t n = (q63_t) S->count;
+        q31_t meanOfSquares, squareOfMean;
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+  pResult->power = S->sumOfSquares;
+
+  if (S->count == 0U)
+  {
+    pResult->mean = 0;
+    pResult->rms = 0;
+  }
+  else
+  {
+    pResult->mean = (q15_t) (S->sum / n);
+    arm_sqrt_q15(__SSAT((S->sumOfSquares / n) >> 15, 16), &pResult->rms);
+  }
+
+  if (S->count <= 1U)
+  {
+    pResult->var = 0;
+  }
+  else
+  {
+    /* Mean of squares and square of mean, divided by n - 1, 2.30 format */
+    meanOfSquares = (q31_t) (S->sumOfSquares / (n - 1));
+    squareOfMean = (q31_t) ((S->sum * S->sum) / (n * (n - 1)));
+    pResult->var = (q15_t) __SSAT((meanOfSquares - squareOfMean) >> 15U, 16U);
+  }
+  arm_sqrt_q15(pResult->var, &pResult->std);
+}
+
+/**
+  @} end of FusedStats group
+ */
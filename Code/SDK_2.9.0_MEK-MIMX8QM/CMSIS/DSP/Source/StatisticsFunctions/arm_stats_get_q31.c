@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_get_q31.c
+ * Description:  Summary statistics of the Q31 running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Summary statistics of the samples accumulated in the Q31 running statistics.
+  @param[in]     S          points to an instance of the running statistics structure
+  @param[out]    pResult    summary statistics returned here
+  @return        none
+
+  @par           Details
+                   The mean is truncated to 1.31 format as in \ref arm_mean_q31(). The variance
+                   is computed in 18.46 format from the 1.23 sums and shifted right by 15 bits
+                   to 1.31 format; the square of the mean is formed from the truncated 1.23 mean,
+                   so that it does not overflow for any mean. The RMS is computed from the same
+                   sum of squares and the power is this sum in 16.48 format.
+ */
+
+void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+        arm_stats_summary_q31 * pResult)
+{
+  const q63_t n = (q63_t) S->count;
+        q63_t meanOfSquares, squareOfMean;
+
+  pResult->min = S->min;
+  pResult->max = S->max;
+  pResult->minIndex = S->minIndex;
+  pResult->maxIndex = S->maxIndex;
+  pResult->power = S->sumOfSquares << 2U;
+
+  if (S->count == 0U)
+  {
+    pResult->mean = 0;
+    pResult->rms = 0;
+  }
+  else
+  {
+    pResult->mean = (q31_t) (S->sum / n);
+    arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / n) >> 15U), &pResult->rms);
+  }
+
+  if (S->count <= 1U)
+  {
+    pResult->var = 0;
+  }
+  else
+  {
+    /* Mean of squares and square of mean, divided by n - 1, 18.46 format */
+    meanOfSquares = S->sumOfSquares / (n - 1);
+    squareOfMean = ((S->sum8 / n) * S->sum8) / (n - 1);
+    pResult->var = clip_q63_to_q31((meanOfSquares - squareOfMean) >> 15U);
+  }
+  arm_sqrt_q31(pResult->var, &pResult->std);
+}
+
+/**
+  @} end of FusedStats group
+ */
@@ -0,0 +1,47 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_init_f32.c
+ * Description:  Initialization function for the floating-point running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point running statistics.
+  @param[out]    S          points to an instance of the running statistics structure
+  @return        none
+ */
+
+void arm_stats_init_f32(
+  arm_stats_instance_f32 * S)
+{
+  /* No samples, the extrema are set by the first one */
+  S->count = 0U;
+  S->mean = 0.0f;
+  S->m2 = 0.0f;
+  S->min = 0.0f;
+  S->max = 0.0f;
+  S->minIndex = 0U;
+  S->maxIndex = 0U;
+}
+
+/**
+  @} end of FusedStats group
+ */
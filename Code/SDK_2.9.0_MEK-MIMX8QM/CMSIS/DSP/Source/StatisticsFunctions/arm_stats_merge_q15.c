@@ -0,0 +1,65 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_merge_q15.c
+ * Description:  Merges two Q15 running statistics
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Merges the Q15 running statistics of the samples following those of S.
+  @param[in,out] S          points to an instance of the running statistics structure
+  @param[in]     pOther     points to the running statistics of the following samples
+  @return        none
+
+  @par           Details
+                   The samples of <code>pOther</code> are taken as following those of <code>S</code>:
+                   the indices of its extrema are offset by the number of samples of <code>S</code>.
+ */
+
+void arm_stats_merge_q15(
+        arm_stats_instance_q15 * S,
+  const arm_stats_instance_q15 * pOther)
+{
+  if (pOther->count == 0U)
+  {
+    return;
+  }
+
+  if ((S->count == 0U) || (pOther->min < S->min))
+  {
+    S->min = pOther->min;
+    S->minIndex = S->count + pOther->minIndex;
+  }
+  if ((S->count == 0U) || (pOther->max > S->max))
+  {
+    S->max = pOther->max;
+    S->maxIndex = S->count + pOther->maxIndex;
+  }
+
+  /* The sums are exact, they add */
+  S->sum += pOther->sum;
+  S->sumOfSquares += pOther->sumOfSquares;
+  S->count += pOther->count;
+}
+
+/**
+  @} end of FusedStats group
+ */
@@ -0,0 +1,48 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q15.c
+ * Description:  Summary statistics of a Q15 vector in one pass
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Summary statistics of a Q15 vector, in one pass.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    summary statistics returned here
+  @return        none
+ */
+
+void arm_stats_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_summary_q15 * pResult)
+{
+  arm_stats_instance_q15 S;
+
+  arm_stats_init_q15(&S);
+  arm_stats_accumulate_q15(&S, pSrc, blockSize);
+  arm_stats_get_q15(&S, pResult);
+}
+
+/**
+  @} end of FusedStats group
+ */
@@ -0,0 +1,48 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stats_q31.c
+ * Description:  Summary statistics of a Q31 vector in one pass
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup FusedStats
+  @{
+ */
+
+/**
+  @brief         Summary statistics of a Q31 vector, in one pass.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in input vector
+  @param[out]    pResult    summary statistics returned here
+  @return        none
+ */
+
+void arm_stats_q31(
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_summary_q31 * pResult)
+{
+  arm_stats_instance_q31 S;
+
+  arm_stats_init_q31(&S);
+  arm_stats_accumulate_q31(&S, pSrc, blockSize);
+  arm_stats_get_q31(&S, pResult);
+}
+
+/**
+  @} end of FusedStats group
+ */
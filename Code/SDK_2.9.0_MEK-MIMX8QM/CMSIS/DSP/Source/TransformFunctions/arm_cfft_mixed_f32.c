@@ -0,0 +1,320 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed radix (2, 3, 4, 5) Floating point CFFT processing function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Radix-3 and radix-5 butterfly constants, cos and sin of 2*pi/3, 2*pi/5 and 4*pi/5 */
+#define MIXED_C3    (-0.5f)
+#define MIXED_S3    ( 0.866025403784438646764f)
+#define MIXED_C51   ( 0.309016994374947424102f)
+#define MIXED_C52   (-0.809016994374947424102f)
+#define MIXED_S51   ( 0.951056516295153572116f)
+#define MIXED_S52   ( 0.587785252292473129169f)
+
+/* Writes the r outputs of a butterfly, d complex values apart, output j is multiplied by pW[j-1] */
+__STATIC_FORCEINLINE void arm_cfft_mixed_store_f32(
+        float32_t * pY,
+        uint32_t d,
+  const float32_t * y,
+  const float32_t * pW,
+        uint32_t r)
+{
+  uint32_t j;
+
+  pY[0] = y[0];
+  pY[1] = y[1];
+  for (j = 1U; j < r; j++)
+  {
+    pY[2U * j * d]      = (y[2U * j] * pW[2U * (j - 1U)])      - (y[(2U * j) + 1U] * pW[(2U * (j - 1U)) + 1U]);
+    pY[(2U * j * d) + 1U] = (y[2U * j] * pW[(2U * (j - 1U)) + 1U]) + (y[(2U * j) + 1U] * pW[2U * (j - 1U)]);
+  }
+}
+
+/* Same as above for p = 0, where all twiddle factors are 1 */
+__STATIC_FORCEINLINE void arm_cfft_mixed_store_unit_f32(
+        float32_t * pY,
+        uint32_t d,
+  const float32_t * y,
+        uint32_t r)
+{
+  uint32_t j;
+
+  for (j = 0U; j < r; j++)
+  {
+    pY[2U * j * d]        = y[2U * j];
+    pY[(2U * j * d) + 1U] = y[(2U * j) + 1U];
+  }
+}
+
+/* Butterflies, the r inputs are pA[0], pA[2*d], ... and the outputs go to y */
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly2_f32(const float32_t * pA, uint32_t d, float32_t * y)
+{
+  y[0] = pA[0] + pA[2U * d];
+  y[1] = pA[1] + pA[(2U * d) + 1U];
+  y[2] = pA[0] - pA[2U * d];
+  y[3] = pA[1] - pA[(2U * d) + 1U];
+}
+
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly3_f32(const float32_t * pA, uint32_t d, float32_t * y)
+{
+  float32_t t1r, t1i, t2r, t2i, m1r, m1i, m2r, m2i;
+
+  t1r = pA[2U * d] + pA[4U * d];
+  t1i = pA[(2U * d) + 1U] + pA[(4U * d) + 1U];
+  t2r = pA[2U * d] - pA[4U * d];
+  t2i = pA[(2U * d) + 1U] - pA[(4U * d) + 1U];
+
+  y[0] = pA[0] + t1r;
+  y[1] = pA[1] + t1i;
+
+  /* m1 = a0 + cos(2*pi/3) * t1, m2 = -i * sin(2*pi/3) * t2 */
+  m1r = pA[0] + (MIXED_C3 * t1r);
+  m1i = pA[1] + (MIXED_C3 * t1i);
+  m2r =  MIXED_S3 * t2i;
+  m2i = -MIXED_S3 * t2r;
+
+  y[2] = m1r + m2r;
+  y[3] = m1i + m2i;
+  y[4] = m1r - m2r;
+  y[5] = m1i - m2i;
+}
+
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly4_f32(const float32_t * pA, uint32_t d, float32_t * y)
+{
+  float32_t t0r, t0i, t1r, t1i, t2r, t2i, t3r, t3i;
+
+  t0r = pA[0] + pA[4U * d];
+  t0i = pA[1] + pA[(4U * d) + 1U];
+  t1r = pA[0] - pA[4U * d];
+  t1i = pA[1] - pA[(4U * d) + 1U];
+  t2r = pA[2U * d] + pA[6U * d];
+  t2i = pA[(2U * d) + 1U] + pA[(6U * d) + 1U];
+  t3r = pA[2U * d] - pA[6U * d];
+  t3i = pA[(2U * d) + 1U] - pA[(6U * d) + 1U];
+
+  /* y1 = t1 - i * t3, y3 = t1 + i * t3 */
+  y[0] = t0r + t2r;
+  y[1] = t0i + t2i;
+  y[2] = t1r + t3i;
+  y[3] = t1i - t3r;
+  y[4] = t0r - t2r;
+  y[5] = t0i - t2i;
+  y[6] = t1r - t3i;
+  y[7] = t1i + t3r;
+}
+
+__STATIC_FORCEINLINE void arm_cfft_mixed_bfly5_f32(const float32_t * pA, uint32_t d, float32_t * y)
+{
+  float32_t t1r, t1i, t2r, t2i, t3r, t3i, t4r, t4i;
+  float32_t b1r, b1i, b2r, b2i, d1r, d1i, d2r, d2i;
+
+  t1r = pA[2U * d] + pA[8U * d];
+  t1i = pA[(2U * d) + 1U] + pA[(8U * d) + 1U];
+  t2r = pA[4U * d] + pA[6U * d];
+  t2i = pA[(4U * d) + 1U] + pA[(6U * d) + 1U];
+  t3r = pA[2U * d] - pA[8U * d];
+  t3i = pA[(2U * d) + 1U] - pA[(8U * d) + 1U];
+  t4r = pA[4U * d] - pA[6U * d];
+  t4i = pA[(4U * d) + 1U] - pA[(6U * d) + 1U];
+
+  y[0] = pA[0] + t1r + t2r;
+  y[1] = pA[1] + t1i + t2i;
+
+  b1r = pA[0] + (MIXED_C51 * t1r) + (MIXED_C52 * t2r);
+  b1i = pA[1] + (MIXED_C51 * t1i) + (MIXED_C52 * t2i);
+  b2r = pA[0] + (MIXED_C52 * t1r) + (MIXED_C51 * t2r);
+  b2i = pA[1] + (MIXED_C52 * t1i) + (MIXED_C51 * t2i);
+  d1r = (MIXED_S51 * t3r) + (MIXED_S52 * t4r);
+  d1i = (MIXED_S51 * t3i) + (MIXED_S52 * t4i);
+  d2r = (MIXED_S52 * t3r) - (MIXED_S51 * t4r);
+  d2i = (MIXED_S52 * t3i) - (MIXED_S51 * t4i);
+
+  /* y1 = b1 - i * d1, y4 = b1 + i * d1, y2 = b2 - i * d2, y3 = b2 + i * d2 */
+  y[2] = b1r + d1i;
+  y[3] = b1i - d1r;
+  y[4] = b2r + d2i;
+  y[5] = b2i - d2r;
+  y[6] = b2r - d2i;
+  y[7] = b2i + d2r;
+  y[8] = b1r - d1i;
+  y[9] = b1i + d1r;
+}
+
+/*
+ * One Stockham (self-sorting) decimation in frequency stage of radix r. The
+ * current sub-transforms have length n = r * m and are interleaved with stride
+ * s, that is element k of sub-transform q is pSrc[q + s * k]. Butterfly (p, q)
+ * reads elements p, p + m, ... of sub-transform q and writes its outputs,
+ * multiplied by W_n^(j * p), to elements r * p + j of the r * s sub-transforms
+ * of the next stage. pTw holds W_n^(j * p) for p = 1 .. m-1, j = 1 .. r-1.
+ */
+#define MIXED_STAGE(R, BFLY)                                                   \
+{                                                                              \
+  float32_t y[2U * (R)];                                                       \
+  const uint32_t sm = s * m;                                                   \
+  uint32_t p, q;                                                               \
+                                                                               \
+  for (q = 0U; q < s; q++)                                                     \
+  {                                                                            \
+    BFLY(pSrc + (2U * q), sm, y);                                              \
+    arm_cfft_mixed_store_unit_f32(pDst + (2U * q), s, y, (R));                 \
+  }                                                                            \
+  for (p = 1U; p < m; p++)                                                     \
+  {                                                                            \
+    const float32_t *pA = pSrc + (2U * s * p);                                 \
+          float32_t *pY = pDst + (2U * s * (R) * p);                           \
+                                                                               \
+    for (q = 0U; q < s; q++)                                                   \
+    {                                                                          \
+      BFLY(pA + (2U * q), sm, y);                                              \
+      arm_cfft_mixed_store_f32(pY + (2U * q), s, y, pTw, (R));                 \
+    }                                                                          \
+    pTw += 2U * ((R) - 1U);                                                    \
+  }                                                                            \
+}
+
+static void arm_cfft_mixed_radix2_f32(const float32_t * pSrc, float32_t * pDst, const float32_t * pTw, uint32_t m, uint32_t s)
+MIXED_STAGE(2U, arm_cfft_mixed_bfly2_f32)
+
+static void arm_cfft_mixed_radix3_f32(const float32_t * pSrc, float32_t * pDst, const float32_t * pTw, uint32_t m, uint32_t s)
+MIXED_STAGE(3U, arm_cfft_mixed_bfly3_f32)
+
+static void arm_cfft_mixed_radix4_f32(const float32_t * pSrc, float32_t * pDst, const float32_t * pTw, uint32_t m, uint32_t s)
+MIXED_STAGE(4U, arm_cfft_mixed_bfly4_f32)
+
+static void arm_cfft_mixed_radix5_f32(const float32_t * pSrc, float32_t * pDst, const float32_t * pTw, uint32_t m, uint32_t s)
+MIXED_STAGE(5U, arm_cfft_mixed_bfly5_f32)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup ComplexFFTMixed Mixed Radix Complex FFT Functions
+
+  @par
+                   The mixed radix complex FFT computes transforms of any length which is a
+                   product of the factors 2, 3 and 5, e.g. 480 and 960 (10 ms and 20 ms frames
+                   at 48 kHz) or the power of two lengths 8192 and 16384 which are beyond the
+                   tables of \ref arm_cfft_f32(). Lengths are not padded, a 480 point transform
+                   needs 5/8 of the work of a 512 point radix-8 transform on the same frame.
+  @par
+                   The transform is planned once by \ref arm_cfft_mixed_init_f32(): the length is
+                   factored into radix-4, radix-2, radix-3 and radix-5 stages and the twiddle
+                   factors of all stages are computed into a buffer provided by the caller. The
+                   stages are self-sorting (Stockham), no bit reversal is needed, and alternate
+                   between the data buffer and a scratch buffer of the same size.
+  @par
+                   As \ref arm_cfft_f32(), the function operates in-place on <code>2*fftLen</code>
+                   interleaved values, uses the standard FFT definition for the forward transform
+                   and scales the inverse transform by <code>1/fftLen</code>.
+  @par
+                   The twiddle and scratch buffers each hold <code>2*fftLen</code> values, see
+                   \ref ARM_CFFT_MIXED_TWIDDLE_LEN and \ref ARM_CFFT_MIXED_SCRATCH_LEN. Instances
+                   of the same length can share the twiddle buffer; instances which may run
+                   concurrently need their own scratch buffer.
+ */
+
+/**
+  @addtogroup ComplexFFTMixed
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point mixed radix complex FFT.
+  @param[in]     S              points to an instance of the floating-point mixed radix CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+  const float32_t *pTw = S->pTwiddle;           /* Twiddle factors of the current stage */
+        float32_t *pSrc = p1;                   /* Input of the current stage */
+        float32_t *pDst = S->pScratch;          /* Output of the current stage */
+        float32_t *pTmp;
+        float32_t invL;
+        uint32_t L = S->fftLen;
+        uint32_t n = L;                         /* Length of the current sub-transforms */
+        uint32_t s = 1U;                        /* Number of the current sub-transforms */
+        uint32_t stage, r, m, l;
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate input data */
+    pTmp = p1 + 1;
+    for (l = 0U; l < L; l++)
+    {
+      *pTmp = -*pTmp;
+      pTmp += 2;
+    }
+  }
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    r = S->pFactors[stage];
+    m = n / r;
+
+    switch (r)
+    {
+    case 2U:
+      arm_cfft_mixed_radix2_f32(pSrc, pDst, pTw, m, s);
+      break;
+    case 3U:
+      arm_cfft_mixed_radix3_f32(pSrc, pDst, pTw, m, s);
+      break;
+    case 4U:
+      arm_cfft_mixed_radix4_f32(pSrc, pDst, pTw, m, s);
+      break;
+    default:
+      arm_cfft_mixed_radix5_f32(pSrc, pDst, pTw, m, s);
+      break;
+    }
+
+    pTw += 2U * (m - 1U) * (r - 1U);
+    n = m;
+    s *= r;
+
+    pTmp = pSrc;
+    pSrc = pDst;
+    pDst = pTmp;
+  }
+
+  /* pSrc holds the result, copy it back after an odd number of stages */
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t)L;
+
+    /* Conjugate and scale output data */
+    for (l = 0U; l < L; l++)
+    {
+      p1[2U * l]        =  pSrc[2U * l] * invL;
+      p1[(2U * l) + 1U] = -pSrc[(2U * l) + 1U] * invL;
+    }
+  }
+  else if (pSrc != p1)
+  {
+    memcpy(p1, pSrc, 2U * L * sizeof(float32_t));
+  }
+}
+
+/**
+  @} end of ComplexFFTMixed group
+ */
@@ -0,0 +1,115 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Plan of the mixed radix Floating point CFFT
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFTMixed
+  @{
+ */
+
+/**
+  @brief         Initialization function (plan) for the floating-point mixed radix complex FFT.
+  @param[out]    S         points to an instance of the floating-point mixed radix CFFT structure
+  @param[in]     fftLen    length of the FFT, a product of the factors 2, 3 and 5
+  @param[out]    pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>
+  @param[in]     pScratch  points to the scratch buffer of size <code>2*fftLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is smaller than 2 or has other prime factors
+
+  @par           Details
+                   The length is factored into radix-4 stages first, followed by at most one
+                   radix-2 stage and the radix-3 and radix-5 stages. The twiddle factors are
+                   computed in double precision, in the order the stages use them. This function
+                   uses <code>cos()</code> and <code>sin()</code> and is meant to run once at
+                   startup, the processing function does not depend on it.
+ */
+
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+  float32_t *pTw = pTwiddle;
+  float64_t angle;
+  uint32_t n = fftLen;
+  uint32_t stage, r, m, p, j;
+
+  if ((S == NULL) || (pTwiddle == NULL) || (pScratch == NULL) || (fftLen < 2U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Factor the length */
+  S->numStages = 0U;
+  while (n > 1U)
+  {
+    if ((n % 4U) == 0U)
+    {
+      r = 4U;
+    }
+    else if ((n % 2U) == 0U)
+    {
+      r = 2U;
+    }
+    else if ((n % 3U) == 0U)
+    {
+      r = 3U;
+    }
+    else if ((n % 5U) == 0U)
+    {
+      r = 5U;
+    }
+    else
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    S->pFactors[S->numStages++] = (uint8_t)r;
+    n /= r;
+  }
+
+  /* Twiddle factors W_n^(j * p) = exp(-2*pi*i * j * p / n) of every stage, p = 1 .. m-1, j = 1 .. r-1 */
+  n = fftLen;
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    r = S->pFactors[stage];
+    m = n / r;
+    for (p = 1U; p < m; p++)
+    {
+      for (j = 1U; j < r; j++)
+      {
+        angle = (6.283185307179586476925 * (float64_t)(j * p)) / (float64_t)n;
+        *pTw++ = (float32_t) cos(angle);
+        *pTw++ = (float32_t)-sin(angle);
+      }
+    }
+    n = m;
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pScratch = pScratch;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of ComplexFFTMixed group
+ */
@@ -42,6 +42,147 @@
   return        none
 */
 
+#if defined(ARM_MATH_SSE41)
+
+/*
+ * Radix-8 butterfly of two interleaved complex values per vector, x[k] holds
+ * input k of the butterflies, the outputs replace them in the order of the
+ * scalar code. The operations of each lane are those of the scalar code.
+ */
+__STATIC_FORCEINLINE void arm_radix8_bfly_sse_f32(__m128 * x, __m128 c81, __m128 sign)
+{
+  __m128 a04, s04, a15, s15, a26, s26, a37, s37;
+  __m128 t, u, v, w, d, e, f, g, h, k;
+
+  a04 = _mm_add_ps(x[0], x[4]);
+  s04 = _mm_sub_ps(x[0], x[4]);
+  a15 = _mm_add_ps(x[1], x[5]);
+  s15 = _mm_sub_ps(x[1], x[5]);
+  a26 = _mm_add_ps(x[2], x[6]);
+  s26 = _mm_sub_ps(x[2], x[6]);
+  a37 = _mm_add_ps(x[3], x[7]);
+  s37 = _mm_sub_ps(x[3], x[7]);
+
+  /* Even outputs */
+  t = _mm_sub_ps(a04, a26);
+  u = _mm_add_ps(a04, a26);
+  v = _mm_sub_ps(a15, a37);
+  w = _mm_add_ps(a15, a37);
+
+  /* -j * v is (Im, -Re) */
+  v = _mm_xor_ps(_mm_shuffle_ps(v, v, 0xB1), sign);
+
+  x[0] = _mm_add_ps(u, w);
+  x[4] = _mm_sub_ps(u, w);
+  x[2] = _mm_add_ps(t, v);
+  x[6] = _mm_sub_ps(t, v);
+
+  /* Odd outputs */
+  d = _mm_mul_ps(_mm_sub_ps(s15, s37), c81);
+  e = _mm_mul_ps(_mm_add_ps(s15, s37), c81);
+  f = _mm_sub_ps(s04, d);
+  g = _mm_add_ps(s04, d);
+  h = _mm_sub_ps(s26, e);
+  k = _mm_add_ps(s26, e);
+
+  h = _mm_xor_ps(_mm_shuffle_ps(h, h, 0xB1), sign);
+  k = _mm_xor_ps(_mm_shuffle_ps(k, k, 0xB1), sign);
+
+  x[1] = _mm_add_ps(g, k);
+  x[7] = _mm_sub_ps(g, k);
+  x[5] = _mm_add_ps(f, h);
+  x[3] = _mm_sub_ps(f, h);
+}
+
+void arm_radix8_butterfly_f32(
+  float32_t * pSrc,
+  uint16_t fftLen,
+  const float32_t * pCoef,
+  uint16_t twidCoefModifier)
+{
+   uint32_t i1, j, k;
+   uint32_t n1, n2;
+   float32_t *p0, *p1;
+   __m128 x[8], co[8], si[8], tw, sign, zero;
+   const __m128 c81 = _mm_set1_ps(0.70710678118f);
+
+   /* Sign bits of the imaginary parts */
+   sign = _mm_castsi128_ps(_mm_set1_epi64x(0x8000000000000000LL));
+   zero = _mm_setzero_ps();
+
+   n2 = fftLen;
+
+   do
+   {
+      n1 = n2;
+      n2 = n2 >> 3;
+
+      if (n2 > 1U)
+      {
+         /* Butterflies j and j + 1 of every group, consecutive in memory */
+         for (j = 0U; j < n2; j += 2U)
+         {
+            /* Twiddles of output k, (cos, sin) of both butterflies, with the sign of
+               the scalar code: Re = cos * Re + sin * Im, Im = cos * Im - sin * Re */
+            for (k = 1U; k < 8U; k++)
+            {
+               tw = _mm_loadl_pi(zero, (const __m64 *) &pCoef[2U * k * j * twidCoefModifier]);
+               tw = _mm_loadh_pi(tw, (const __m64 *) &pCoef[2U * k * (j + 1U) * twidCoefModifier]);
+               co[k] = _mm_shuffle_ps(tw, tw, 0xA0);
+               si[k] = _mm_xor_ps(_mm_shuffle_ps(tw, tw, 0xF5), sign);
+            }
+
+            for (i1 = j; i1 < fftLen; i1 += n1)
+            {
+               p0 = pSrc + (2U * i1);
+
+               for (k = 0U; k < 8U; k++)
+               {
+                  x[k] = _mm_loadu_ps(p0 + (2U * k * n2));
+               }
+
+               arm_radix8_bfly_sse_f32(x, c81, sign);
+
+               _mm_storeu_ps(p0, x[0]);
+               for (k = 1U; k < 8U; k++)
+               {
+                  tw = _mm_mul_ps(si[k], _mm_shuffle_ps(x[k], x[k], 0xB1));
+                  _mm_storeu_ps(p0 + (2U * k * n2), _mm_add_ps(_mm_mul_ps(co[k], x[k]), tw));
+               }
+            }
+         }
+      }
+      else
+      {
+         /* Last stage, groups of 8 consecutive values without twiddles: the butterflies
+            of two groups per iteration, the last group of an odd count twice */
+         for (i1 = 0U; i1 < fftLen; i1 += 16U)
+         {
+            p0 = pSrc + (2U * i1);
+            p1 = ((i1 + 8U) < fftLen) ? (p0 + 16) : p0;
+
+            for (k = 0U; k < 8U; k++)
+            {
+               x[k] = _mm_loadh_pi(_mm_loadl_pi(zero, (const __m64 *) (p0 + (2U * k))),
+                                   (const __m64 *) (p1 + (2U * k)));
+            }
+
+            arm_radix8_bfly_sse_f32(x, c81, sign);
+
+            for (k = 0U; k < 8U; k++)
+            {
+               _mm_storel_pi((__m64 *) (p0 + (2U * k)), x[k]);
+               _mm_storeh_pi((__m64 *) (p1 + (2U * k)), x[k]);
+            }
+         }
+      }
+
+      twidCoefModifier <<= 3;
+   } while (n2 > 7);
+}
+
+#else
+
 void arm_radix8_butterfly_f32(
   float32_t * pSrc,
   uint16_t fftLen,
@@ -283,3 +424,5 @@ void arm_radix8_butterfly_f32(
       twidCoefModifier <<= 3;
    } while (n2 > 7);
 }
+
+#endif /* #if defined(ARM_MATH_SSE41) */
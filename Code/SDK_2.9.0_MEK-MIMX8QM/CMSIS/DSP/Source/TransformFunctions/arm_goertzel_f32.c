@@ -0,0 +1,204 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filter bank
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Filter Bank
+
+  Computes the power of a block of samples at a set of frequencies, the squared
+  magnitude of the DFT of the block at these frequencies, with the Goertzel algorithm.
+
+  Each frequency <code>w = 2*pi*f</code>, with <code>f</code> in cycles per sample, is a
+  second order recursion on the input, one multiplication and two additions per sample:
+  <pre>
+      s[n] = x[n] + 2*cos(w)*s[n-1] - s[n-2]
+  </pre>
+  After the last sample of the block the power is computed from the last two values of the
+  recursion
+  <pre>
+      |X(w)|^2 = (s[n-1] - cos(w)*s[n-2])^2 + (sin(w)*s[n-2])^2
+  </pre>
+  A block of N samples costs N multiplications per frequency, where a real FFT costs about
+  <code>(N/2)*log2(N)</code> complex operations for all of them. For a few frequencies, such as
+  the tones of DTMF signalling or the harmonics of the mains frequency, the filter bank is
+  cheaper than the FFT. The frequencies need not be FFT bins.
+
+  The processing function takes the block in pieces of any size. \ref arm_goertzel_power_f32()
+  returns the power of the samples processed since the previous call and clears the state
+  for the next block. The recursions of four frequencies are interleaved, each sample is read
+  once for the four of them.
+
+  The Q31 functions keep the recursions in 64 bits, the input is added in 33.31 format.
+  Their power is divided by the squared number of samples, as the Q31 FFTs divide the spectrum
+  by the FFT length.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point Goertzel filter bank.
+  @param[in,out] S          points to an instance of the floating-point Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+
+void arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+  const float32_t *pCoeffs = S->pCoeffs;
+  const float32_t *pIn;
+        float32_t *pState = S->pState;
+        float32_t c0, c1, c2, c3;
+        float32_t a0, a1, a2, a3, b0, b1, b2, b3, x;
+        uint32_t bin, blkCnt;
+
+  /* Four frequencies at a time */
+  for (bin = (uint32_t) S->numBins >> 2U; bin > 0U; bin--)
+  {
+    c0 = 2.0f * pCoeffs[0];
+    c1 = 2.0f * pCoeffs[2];
+    c2 = 2.0f * pCoeffs[4];
+    c3 = 2.0f * pCoeffs[6];
+
+    /* a = s[n-1], b = s[n-2] */
+    a0 = pState[0];
+    b0 = pState[1];
+    a1 = pState[2];
+    b1 = pState[3];
+    a2 = pState[4];
+    b2 = pState[5];
+    a3 = pState[6];
+    b3 = pState[7];
+
+    /* Two samples per iteration, the newest value alternates between a and b */
+    pIn = pSrc;
+    for (blkCnt = blockSize >> 1U; blkCnt > 0U; blkCnt--)
+    {
+      x = *pIn++;
+      b0 = (x + (c0 * a0)) - b0;
+      b1 = (x + (c1 * a1)) - b1;
+      b2 = (x + (c2 * a2)) - b2;
+      b3 = (x + (c3 * a3)) - b3;
+
+      x = *pIn++;
+      a0 = (x + (c0 * b0)) - a0;
+      a1 = (x + (c1 * b1)) - a1;
+      a2 = (x + (c2 * b2)) - a2;
+      a3 = (x + (c3 * b3)) - a3;
+    }
+
+    if ((blockSize & 1U) != 0U)
+    {
+      x = *pIn;
+      pState[0] = (x + (c0 * a0)) - b0;
+      pState[1] = a0;
+      pState[2] = (x + (c1 * a1)) - b1;
+      pState[3] = a1;
+      pState[4] = (x + (c2 * a2)) - b2;
+      pState[5] = a2;
+      pState[6] = (x + (c3 * a3)) - b3;
+      pState[7] = a3;
+    }
+    else
+    {
+      pState[0] = a0;
+      pState[1] = b0;
+      pState[2] = a1;
+      pState[3] = b1;
+      pState[4] = a2;
+      pState[5] = b2;
+      pState[6] = a3;
+      pState[7] = b3;
+    }
+
+    pCoeffs += 8U;
+    pState += 8U;
+  }
+
+  /* Two remaining frequencies */
+  if ((S->numBins & 2U) != 0U)
+  {
+    c0 = 2.0f * pCoeffs[0];
+    c1 = 2.0f * pCoeffs[2];
+    a0 = pState[0];
+    b0 = pState[1];
+    a1 = pState[2];
+    b1 = pState[3];
+
+    pIn = pSrc;
+    for (blkCnt = blockSize >> 1U; blkCnt > 0U; blkCnt--)
+    {
+      x = *pIn++;
+      b0 = (x + (c0 * a0)) - b0;
+      b1 = (x + (c1 * a1)) - b1;
+
+      x = *pIn++;
+      a0 = (x + (c0 * b0)) - a0;
+      a1 = (x + (c1 * b1)) - a1;
+    }
+
+    if ((blockSize & 1U) != 0U)
+    {
+      x = *pIn;
+      pState[0] = (x + (c0 * a0)) - b0;
+      pState[1] = a0;
+      pState[2] = (x + (c1 * a1)) - b1;
+      pState[3] = a1;
+    }
+    else
+    {
+      pState[0] = a0;
+      pState[1] = b0;
+      pState[2] = a1;
+      pState[3] = b1;
+    }
+
+    pCoeffs += 4U;
+    pState += 4U;
+  }
+
+  /* Last frequency */
+  if ((S->numBins & 1U) != 0U)
+  {
+    c0 = 2.0f * pCoeffs[0];
+    a0 = pState[0];
+    b0 = pState[1];
+
+    pIn = pSrc;
+    for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+    {
+      x = (*pIn++ + (c0 * a0)) - b0;
+      b0 = a0;
+      a0 = x;
+    }
+
+    pState[0] = a0;
+    pState[1] = b0;
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,78 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Floating-point Goertzel filter bank initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Goertzel filter bank.
+  @param[in,out] S        points to an instance of the floating-point Goertzel structure
+  @param[in]     numBins  number of frequencies
+  @param[in]     pFreqs   points to the frequencies in cycles per sample, from 0 to 0.5, <code>numBins</code> values
+  @param[out]    pCoeffs  points to the coefficient buffer of <code>2*numBins</code> values
+  @param[in]     pState   points to the state buffer of <code>2*numBins</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : no frequency, or a frequency out of range
+
+  @par           Details
+                   The frequency of the DFT bin <code>k</code> of an <code>N</code> point FFT is <code>k/N</code>.
+                   The state is cleared.
+ */
+
+arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs,
+        float32_t * pState)
+{
+  float64_t w;
+  uint32_t i;
+
+  if (numBins == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    if ((pFreqs[i] < 0.0f) || (pFreqs[i] > 0.5f))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    w = 6.283185307179586476925 * (float64_t)pFreqs[i];
+    pCoeffs[2U * i] = (float32_t) cos(w);
+    pCoeffs[(2U * i) + 1U] = (float32_t) sin(w);
+  }
+  memset(pState, 0, 2U * numBins * sizeof(float32_t));
+
+  S->numBins = numBins;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,80 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_q31.c
+ * Description:  Q31 Goertzel filter bank initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 Goertzel filter bank.
+  @param[in,out] S        points to an instance of the Q31 Goertzel structure
+  @param[in]     numBins  number of frequencies
+  @param[in]     pFreqs   points to the frequencies in cycles per sample, from 0 to 0.5, <code>numBins</code> values
+  @param[out]    pCoeffs  points to the coefficient buffer of <code>2*numBins</code> values
+  @param[in]     pState   points to the state buffer of <code>2*numBins</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : no frequency, or a frequency out of range
+
+  @par           Details
+                   The frequency of the DFT bin <code>k</code> of an <code>N</code> point FFT is <code>k/N</code>.
+                   The cosines and sines are rounded to 1.31 format, a cosine of 1 saturates to
+                   <code>0x7FFFFFFF</code>. The state is cleared.
+ */
+
+arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState)
+{
+  float64_t w;
+  uint32_t i;
+
+  if (numBins == 0U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (i = 0U; i < numBins; i++)
+  {
+    if ((pFreqs[i] < 0.0f) || (pFreqs[i] > 0.5f))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    w = 6.283185307179586476925 * (float64_t)pFreqs[i];
+    pCoeffs[2U * i] = clip_q63_to_q31((q63_t) floor((cos(w) * 2147483648.0) + 0.5));
+    pCoeffs[(2U * i) + 1U] = clip_q63_to_q31((q63_t) floor((sin(w) * 2147483648.0) + 0.5));
+  }
+  memset(pState, 0, 2U * numBins * sizeof(q63_t));
+
+  S->numBins = numBins;
+  S->count = 0U;
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,63 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_power_f32.c
+ * Description:  Power at the frequencies of the floating-point Goertzel filter bank
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Power at each frequency of the floating-point Goertzel filter bank.
+  @param[in,out] S     points to an instance of the floating-point Goertzel structure
+  @param[out]    pDst  points to the squared magnitudes, <code>numBins</code> values
+  @return        none
+
+  @par           Details
+                   The power is that of the samples processed since the initialization or the
+                   previous call, with the scaling of \ref arm_cmplx_mag_squared_f32() applied
+                   to the output of \ref arm_rfft_fast_f32(). The state is cleared for the next block.
+ */
+
+void arm_goertzel_power_f32(
+        arm_goertzel_instance_f32 * S,
+        float32_t * pDst)
+{
+  const float32_t *pCoeffs = S->pCoeffs;
+        float32_t *pState = S->pState;
+        float32_t re, im;
+        uint32_t bin;
+
+  for (bin = S->numBins; bin > 0U; bin--)
+  {
+    /* X(w) up to a phase: s[n-1] - exp(-jw) * s[n-2] */
+    re = pState[0] - (pCoeffs[0] * pState[1]);
+    im = pCoeffs[1] * pState[1];
+    *pDst++ = (re * re) + (im * im);
+
+    pState[0] = 0.0f;
+    pState[1] = 0.0f;
+    pCoeffs += 2U;
+    pState += 2U;
+  }
+}
+
+/**
+  @} end of Goertzel group
+ */
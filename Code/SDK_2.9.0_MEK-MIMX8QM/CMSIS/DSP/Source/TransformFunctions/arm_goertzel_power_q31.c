@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_power_q31.c
+ * Description:  Power at the frequencies of the Q31 Goertzel filter bank
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Power at each frequency of the Q31 Goertzel filter bank.
+  @param[in,out] S     points to an instance of the Q31 Goertzel structure
+  @param[out]    pDst  points to the squared magnitudes, <code>numBins</code> values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The output is <code>|X(w)/N|^2</code> in 1.31 format, where N is the number of samples
+                   processed since the initialization or the previous call: the squared magnitude of the
+                   spectrum computed by the Q31 FFTs, divided by the FFT length. The real and imaginary
+                   parts are divided by N in 64 bits before squaring, saturated to 1.31, and the sum of
+                   their squares is saturated to 1.31. The state is cleared for the next block.
+ */
+
+void arm_goertzel_power_q31(
+        arm_goertzel_instance_q31 * S,
+        q31_t * pDst)
+{
+  const q31_t *pCoeffs = S->pCoeffs;
+        q63_t *pState = S->pState;
+        q63_t re, im;
+        q31_t reN, imN;
+        uint32_t bin;
+
+  for (bin = S->numBins; bin > 0U; bin--)
+  {
+    if (S->count == 0U)
+    {
+      *pDst++ = 0;
+    }
+    else
+    {
+      /* X(w) up to a phase: s[n-1] - exp(-jw) * s[n-2], in 33.31 format */
+      re = pState[0] - (mult32x64(pState[1], pCoeffs[0]) << 1);
+      im = mult32x64(pState[1], pCoeffs[1]) << 1;
+      reN = clip_q63_to_q31(re / (q63_t) S->count);
+      imN = clip_q63_to_q31(im / (q63_t) S->count);
+      *pDst++ = clip_q63_to_q31((((q63_t) reN * reN) + ((q63_t) imN * imN)) >> 31);
+    }
+
+    pState[0] = 0;
+    pState[1] = 0;
+    pCoeffs += 2U;
+    pState += 2U;
+  }
+
+  S->count = 0U;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filter bank
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 Goertzel filter bank.
+  @param[in,out] S          points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc       points to the block of input data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The recursions are kept in 64-bit state variables in 33.31 format, and multiplied
+                   by the 1.31 cosine with \ref mult32x64(). A recursion grows at most by
+                   <code>1/sin(w)</code> per sample, there is no overflow for blocks of up to
+                   <code>2^32 * sin(w)</code> full scale samples.
+ */
+
+void arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+  const q31_t *pCoeffs = S->pCoeffs;
+  const q31_t *pIn;
+        q63_t *pState = S->pState;
+        q31_t c0, c1, c2, c3;
+        q63_t a0, a1, a2, a3, b0, b1, b2, b3, x;
+        uint32_t bin, blkCnt;
+
+  /* Four frequencies at a time */
+  for (bin = (uint32_t) S->numBins >> 2U; bin > 0U; bin--)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[2];
+    c2 = pCoeffs[4];
+    c3 = pCoeffs[6];
+
+    /* a = s[n-1], b = s[n-2], 2*cos(w)*s = (s * cos(w) in 1.31) >> 30 */
+    a0 = pState[0];
+    b0 = pState[1];
+    a1 = pState[2];
+    b1 = pState[3];
+    a2 = pState[4];
+    b2 = pState[5];
+    a3 = pState[6];
+    b3 = pState[7];
+
+    /* Two samples per iteration, the newest value alternates between a and b */
+    pIn = pSrc;
+    for (blkCnt = blockSize >> 1U; blkCnt > 0U; blkCnt--)
+    {
+      x = *pIn++;
+      b0 = (x + (mult32x64(a0, c0) << 2)) - b0;
+      b1 = (x + (mult32x64(a1, c1) << 2)) - b1;
+      b2 = (x + (mult32x64(a2, c2) << 2)) - b2;
+      b3 = (x + (mult32x64(a3, c3) << 2)) - b3;
+
+      x = *pIn++;
+      a0 = (x + (mult32x64(b0, c0) << 2)) - a0;
+      a1 = (x + (mult32x64(b1, c1) << 2)) - a1;
+      a2 = (x + (mult32x64(b2, c2) << 2)) - a2;
+      a3 = (x + (mult32x64(b3, c3) << 2)) - a3;
+    }
+
+    if ((blockSize & 1U) != 0U)
+    {
+      x = *pIn;
+      pState[0] = (x + (mult32x64(a0, c0) << 2)) - b0;
+      pState[1] = a0;
+      pState[2] = (x + (mult32x64(a1, c1) << 2)) - b1;
+      pState[3] = a1;
+      pState[4] = (x + (mult32x64(a2, c2) << 2)) - b2;
+      pState[5] = a2;
+      pState[6] = (x + (mult32x64(a3, c3) << 2)) - b3;
+      pState[7] = a3;
+    }
+    else
+    {
+      pState[0] = a0;
+      pState[1] = b0;
+      pState[2] = a1;
+      pState[3] = b1;
+      pState[4] = a2;
+      pState[5] = b2;
+      pState[6] = a3;
+      pState[7] = b3;
+    }
+
+    pCoeffs += 8U;
+    pState += 8U;
+  }
+
+  /* Two remaining frequencies */
+  if ((S->numBins & 2U) != 0U)
+  {
+    c0 = pCoeffs[0];
+    c1 = pCoeffs[2];
+    a0 = pState[0];
+    b0 = pState[1];
+    a1 = pState[2];
+    b1 = pState[3];
+
+    pIn = pSrc;
+    for (blkCnt = blockSize >> 1U; blkCnt > 0U; blkCnt--)
+    {
+      x = *pIn++;
+      b0 = (x + (mult32x64(a0, c0) << 2)) - b0;
+      b1 = (x + (mult32x64(a1, c1) << 2)) - b1;
+
+      x = *pIn++;
+      a0 = (x + (mult32x64(b0, c0) << 2)) - a0;
+      a1 = (x + (mult32x64(b1, c1) << 2)) - a1;
+    }
+
+    if ((blockSize & 1U) != 0U)
+    {
+      x = *pIn;
+      pState[0] = (x + (mult32x64(a0, c0) << 2)) - b0;
+      pState[1] = a0;
+      pState[2] = (x + (mult32x64(a1, c1) << 2)) - b1;
+      pState[3] = a1;
+    }
+    else
+    {
+      pState[0] = a0;
+      pState[1] = b0;
+      pState[2] = a1;
+      pState[3] = b1;
+    }
+
+    pCoeffs += 4U;
+    pState += 4U;
+  }
+
+  /* Last frequency */
+  if ((S->numBins & 1U) != 0U)
+  {
+    c0 = pCoeffs[0];
+    a0 = pState[0];
+    b0 = pState[1];
+
+    pIn = pSrc;
+    for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+    {
+      x = ((q63_t) *pIn++ + (mult32x64(a0, c0) << 2)) - b0;
+      b0 = a0;
+      a0 = x;
+    }
+
+    pState[0] = a0;
+    pState[1] = b0;
+  }
+
+  S->count += blockSize;
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mel_filterbank_f32.c
+ * Description:  Floating-point mel filterbank energies of a spectrum
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Floating-point mel filterbank energies of a spectrum.
+  @param[in]     S          points to an instance of the floating-point mel filterbank structure
+  @param[in]     pSpectrum  points to the spectrum, <code>fftLen</code> values in the format of \ref arm_rfft_fast_f32()
+  @param[out]    pDst       points to the energies, <code>numFilters</code> values
+  @return        none
+
+  @par           Details
+                   The energy of a filter is the weighted sum of the squared magnitudes of its bins.
+                   The squared magnitudes are computed from the spectrum as the bins are read,
+                   a bin shared by two filters is squared twice rather than kept in a buffer.
+                   The real parts of the DC and Nyquist bins are the first two values of the spectrum.
+ */
+
+void arm_mel_filterbank_f32(
+  const arm_mel_filterbank_instance_f32 * S,
+  const float32_t * pSpectrum,
+        float32_t * pDst)
+{
+  const uint32_t half = S->fftLen / 2U;
+  const float32_t *pW = S->pWeights;
+  const float32_t *pIn;
+        float32_t acc, re, im;
+        uint32_t m, k, blkCnt, nyquist;
+
+  for (m = 0U; m < S->numFilters; m++)
+  {
+    k = S->pStart[m];
+    blkCnt = S->pLength[m];
+    acc = 0.0f;
+
+    /* DC bin, real */
+    if (k == 0U)
+    {
+      acc += *pW++ * (pSpectrum[0] * pSpectrum[0]);
+      k++;
+      blkCnt--;
+    }
+
+    /* Nyquist bin, real, packed in the imaginary part of the DC bin */
+    nyquist = ((k + blkCnt) > half) ? 1U : 0U;
+    blkCnt -= nyquist;
+
+    pIn = pSpectrum + (2U * k);
+    while (blkCnt > 0U)
+    {
+      re = *pIn++;
+      im = *pIn++;
+      acc += *pW++ * ((re * re) + (im * im));
+      blkCnt--;
+    }
+
+    if (nyquist != 0U)
+    {
+      acc += *pW++ * (pSpectrum[1] * pSpectrum[1]);
+    }
+
+    *pDst++ = acc;
+  }
+}
+
+/**
+  @} end of MFCC group
+ */
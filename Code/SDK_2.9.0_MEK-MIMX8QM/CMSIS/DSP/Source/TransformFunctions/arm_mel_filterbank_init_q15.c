@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mel_filterbank_init_q15.c
+ * Description:  Q15 mel filterbank initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 mel filterbank.
+  @param[in,out] S           points to an instance of the Q15 mel filterbank structure
+  @param[in]     fftLen      length of the real FFT of the spectra
+  @param[in]     numFilters  number of filters
+  @param[in]     sampleRate  sample rate in Hz
+  @param[in]     fMin        lower edge of the first filter in Hz
+  @param[in]     fMax        upper edge of the last filter in Hz, at most <code>sampleRate/2</code>
+  @param[out]    pStart      points to the buffer of the first bins, <code>numFilters</code> values
+  @param[out]    pLength     points to the buffer of the numbers of bins, <code>numFilters</code> values
+  @param[out]    pWeights    points to the buffer of the weights, \ref ARM_MEL_WEIGHTS_MAX(fftLen) values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is out of range, or a filter falls between two bins
+
+  @par           Details
+                   The filters are those of \ref arm_mel_filterbank_init_f32(), with the weights rounded
+                   to 1.15 format. The peak of a filter saturates to <code>0x7FFF</code>.
+ */
+
+arm_status arm_mel_filterbank_init_q15(
+        arm_mel_filterbank_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t numFilters,
+        float32_t sampleRate,
+        float32_t fMin,
+        float32_t fMax,
+        uint16_t * pStart,
+        uint16_t * pLength,
+        q15_t * pWeights)
+{
+  float64_t melMin, melStep, fLeft, fCenter, fRight, f, w;
+  uint32_t half = fftLen / 2U;
+  uint32_t m, k, len, total = 0U;
+
+  if ((numFilters == 0U) || (fftLen < 2U) || (sampleRate <= 0.0f) || (fMin < 0.0f) ||
+      (fMax <= fMin) || (fMax > (0.5f * sampleRate)))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  melMin = 2595.0 * log10(1.0 + ((float64_t)fMin / 700.0));
+  melStep = ((2595.0 * log10(1.0 + ((float64_t)fMax / 700.0))) - melMin) / (float64_t)(numFilters + 1U);
+
+  fLeft = fMin;
+  fCenter = 700.0 * (pow(10.0, (melMin + melStep) / 2595.0) - 1.0);
+  for (m = 0U; m < numFilters; m++)
+  {
+    fRight = 700.0 * (pow(10.0, (melMin + ((float64_t)(m + 2U) * melStep)) / 2595.0) - 1.0);
+
+    /* Bins strictly inside the triangle */
+    len = 0U;
+    for (k = 0U; k <= half; k++)
+    {
+      f = ((float64_t)k * (float64_t)sampleRate) / (float64_t)fftLen;
+      if (f >= fRight)
+      {
+        break;
+      }
+      if (f > fLeft)
+      {
+        if (len == 0U)
+        {
+          pStart[m] = (uint16_t) k;
+        }
+        w = (f <= fCenter) ? ((f - fLeft) / (fCenter - fLeft)) : ((fRight - f) / (fRight - fCenter));
+        pWeights[total + len] = (q15_t) __SSAT((q31_t) ((w * 32768.0) + 0.5), 16);
+        len++;
+      }
+    }
+    if (len == 0U)
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    pLength[m] = (uint16_t) len;
+    total += len;
+
+    fLeft = fCenter;
+    fCenter = fRight;
+  }
+
+  S->fftLen = fftLen;
+  S->numFilters = numFilters;
+  S->pStart = pStart;
+  S->pLength = pLength;
+  S->pWeights = pWeights;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mel_filterbank_q15.c
+ * Description:  Q15 mel filterbank energies of a spectrum
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Q15 mel filterbank energies of a spectrum.
+  @param[in]     S          points to an instance of the Q15 mel filterbank structure
+  @param[in]     pSpectrum  points to the spectrum, in the format of \ref arm_rfft_q15()
+  @param[out]    pDst       points to the energies, <code>numFilters</code> values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The squared magnitudes of the 1.15 bins are in 2.30 format, their products with the
+                   1.15 weights are accumulated in a 64-bit accumulator in 19.45 format. The energies are
+                   truncated to 2.30 format with saturation. As the spectrum of \ref arm_rfft_q15() is divided
+                   by the FFT length, the sum of the squared magnitudes of its bins is at most the mean square
+                   of the frame, and the energies do not saturate.
+ */
+
+void arm_mel_filterbank_q15(
+  const arm_mel_filterbank_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q31_t * pDst)
+{
+  const q15_t *pW = S->pWeights;
+  const q15_t *pIn;
+        q63_t acc;
+        q31_t re, im;
+        uint32_t m, blkCnt;
+
+  for (m = 0U; m < S->numFilters; m++)
+  {
+    pIn = pSpectrum + (2U * S->pStart[m]);
+    blkCnt = S->pLength[m];
+    acc = 0;
+
+    while (blkCnt > 0U)
+    {
+      re = *pIn++;
+      im = *pIn++;
+      acc += (q63_t) *pW++ * ((q63_t) (re * re) + (im * im));
+      blkCnt--;
+    }
+
+    *pDst++ = clip_q63_to_q31(acc >> 15);
+  }
+}
+
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,112 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_f32.c
+ * Description:  Floating-point mel-frequency cepstral coefficients
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Smallest energy taken by the logarithm */
+#define MFCC_LOG_FLOOR  (1.0e-20f)
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MFCC Mel Filterbank and MFCC
+
+  Computes the mel filterbank energies and the mel-frequency cepstral coefficients
+  (MFCC) of the spectra of the \ref STFT functions, the features of keyword spotting
+  and speech recognition front ends.
+
+  The mel filterbank is a set of triangular filters evenly spaced on the mel scale.
+  The MFCC are the discrete cosine transform (DCT-II) of the logarithm of the filterbank energies.
+  The processing chain of a frame is
+  <pre>
+      samples --> window --> real FFT --> |X|^2 --> mel filterbank --> log --> DCT-II --> MFCC
+  </pre>
+  The \ref STFT functions window the frames and compute their FFT. The filterbank function
+  reads the spectrum directly, it squares the magnitudes of the bins of each filter as it
+  sums them, and the power spectrum is not stored. The MFCC function takes the same spectrum
+  and runs the filterbank, the logarithm and the DCT in a scratch buffer of one value per filter.
+
+  @par           Filterbank storage
+                   Each filter only covers the bins between the peaks of its neighbours. The filterbank
+                   keeps, for each filter, its first bin and its number of bins, and the weights of all
+                   filters one after the other: at most <code>fftLen + 2</code> weights instead of the
+                   <code>numFilters * (fftLen/2 + 1)</code> of a dense matrix. For a 512 point FFT and 40
+                   filters the floating-point filterbank takes about 2 KB, where the dense matrix takes 40 KB.
+
+  @par           DCT
+                   The DCT is the orthonormal DCT-II of length <code>numFilters</code>, truncated to the first
+                   <code>numCoeffs</code> coefficients, computed as the product of a precomputed
+                   <code>numCoeffs x numFilters</code> matrix and the log energies with
+                   \ref arm_mat_vec_mult_f32() or \ref arm_mat_vec_mult_q15(). The \ref DCT4_IDCT4 functions
+                   compute a DCT-IV of 128 points and more, they do not apply to the 20 to 40 filters of a filterbank.
+
+  @par           Memory
+                   For an FFT of <code>fftLen</code> points, a frame of <code>frameLen</code> samples,
+                   <code>numFilters</code> filters and <code>numCoeffs</code> coefficients the chain uses
+                   - STFT: <code>frameLen</code> values of state, <code>frameLen</code> values of window and
+                     <code>fftLen</code> values of scratch, plus one spectrum of <code>fftLen</code> values
+                     (<code>2*fftLen</code> in Q15) per output frame
+                   - filterbank: <code>2*numFilters</code> 16-bit bin indices and at most <code>fftLen + 2</code> weights
+                   - MFCC: <code>numCoeffs * numFilters</code> DCT values and a scratch buffer of <code>numFilters</code> values
+
+  @par           Fixed-point
+                   The Q15 chain works on the spectra of \ref arm_stft_q15(), divided by the FFT length. The
+                   filterbank energies are in 2.30 format. The natural logarithm is computed with a count of
+                   leading zeros and a polynomial, the log energies and the coefficients are in 8.7 format.
+                   As the spectrum is divided by <code>fftLen</code>, the log energies are those of the
+                   floating-point chain minus <code>2*ln(fftLen)</code>, and the first coefficient is that of the
+                   floating-point chain minus <code>2*ln(fftLen)*sqrt(numFilters)</code>; the other coefficients
+                   are not affected.
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Floating-point MFCC of a spectrum.
+  @param[in]     S          points to an instance of the floating-point MFCC structure
+  @param[in]     pSpectrum  points to the spectrum, <code>fftLen</code> values in the format of \ref arm_rfft_fast_f32()
+  @param[out]    pDst       points to the coefficients, <code>numCoeffs</code> values
+  @param[in]     pScratch   points to a scratch buffer of <code>numFilters</code> values
+  @return        none
+
+  @par           Details
+                   The logarithm is the natural logarithm, energies below 1e-20 are taken as 1e-20.
+ */
+
+void arm_mfcc_f32(
+  const arm_mfcc_instance_f32 * S,
+  const float32_t * pSpectrum,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  uint32_t i;
+
+  arm_mel_filterbank_f32(S->pMel, pSpectrum, pScratch);
+
+  for (i = 0U; i < S->pMel->numFilters; i++)
+  {
+    pScratch[i] = logf((pScratch[i] > MFCC_LOG_FLOOR) ? pScratch[i] : MFCC_LOG_FLOOR);
+  }
+
+  arm_mat_vec_mult_f32(&S->dct, pScratch, pDst);
+}
+
+/**
+  @} end of MFCC group
+ */
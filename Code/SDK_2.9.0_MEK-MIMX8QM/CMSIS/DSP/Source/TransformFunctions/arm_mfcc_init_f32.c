@@ -0,0 +1,75 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_f32.c
+ * Description:  Floating-point MFCC initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point MFCC.
+  @param[in,out] S           points to an instance of the floating-point MFCC structure
+  @param[in]     pMel        points to an initialized floating-point mel filterbank
+  @param[in]     numCoeffs   number of cepstral coefficients, from 1 to the number of filters
+  @param[out]    pDctCoeffs  points to the buffer of the DCT matrix, <code>numCoeffs * numFilters</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numCoeffs</code> is out of range
+
+  @par           Details
+                   Row <code>k</code> of the orthonormal DCT-II matrix of <code>N = numFilters</code> columns is
+                   <pre>
+                       d[k][n] = s[k] * cos(pi * k * (2n + 1) / (2N)),  s[0] = sqrt(1/N), s[k] = sqrt(2/N)
+                   </pre>
+ */
+
+arm_status arm_mfcc_init_f32(
+        arm_mfcc_instance_f32 * S,
+  const arm_mel_filterbank_instance_f32 * pMel,
+        uint16_t numCoeffs,
+        float32_t * pDctCoeffs)
+{
+  const uint32_t numFilters = pMel->numFilters;
+        float64_t scale;
+        uint32_t k, n;
+
+  if ((numCoeffs == 0U) || (numCoeffs > numFilters))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (k = 0U; k < numCoeffs; k++)
+  {
+    scale = sqrt(((k == 0U) ? 1.0 : 2.0) / (float64_t)numFilters);
+    for (n = 0U; n < numFilters; n++)
+    {
+      pDctCoeffs[(k * numFilters) + n] = (float32_t) (scale * cos((3.14159265358979323846 * (float64_t)(k * ((2U * n) + 1U))) / (float64_t)(2U * numFilters)));
+    }
+  }
+
+  S->pMel = pMel;
+  arm_mat_init_f32(&S->dct, numCoeffs, (uint16_t) numFilters, pDctCoeffs);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,77 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_init_q15.c
+ * Description:  Q15 MFCC initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q15 MFCC.
+  @param[in,out] S           points to an instance of the Q15 MFCC structure
+  @param[in]     pMel        points to an initialized Q15 mel filterbank
+  @param[in]     numCoeffs   number of cepstral coefficients, from 1 to the number of filters
+  @param[out]    pDctCoeffs  points to the buffer of the DCT matrix, <code>numCoeffs * numFilters</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numCoeffs</code> is out of range
+
+  @par           Details
+                   Row <code>k</code> of the orthonormal DCT-II matrix of <code>N = numFilters</code> columns is
+                   <pre>
+                       d[k][n] = s[k] * cos(pi * k * (2n + 1) / (2N)),  s[0] = sqrt(1/N), s[k] = sqrt(2/N)
+                   </pre>
+                   rounded to 1.15 format. A value of 1, for less than three filters, saturates to <code>0x7FFF</code>.
+ */
+
+arm_status arm_mfcc_init_q15(
+        arm_mfcc_instance_q15 * S,
+  const arm_mel_filterbank_instance_q15 * pMel,
+        uint16_t numCoeffs,
+        q15_t * pDctCoeffs)
+{
+  const uint32_t numFilters = pMel->numFilters;
+        float64_t scale, d;
+        uint32_t k, n;
+
+  if ((numCoeffs == 0U) || (numCoeffs > numFilters))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  for (k = 0U; k < numCoeffs; k++)
+  {
+    scale = sqrt(((k == 0U) ? 1.0 : 2.0) / (float64_t)numFilters);
+    for (n = 0U; n < numFilters; n++)
+    {
+      d = scale * cos((3.14159265358979323846 * (float64_t)(k * ((2U * n) + 1U))) / (float64_t)(2U * numFilters));
+      pDctCoeffs[(k * numFilters) + n] = (q15_t) __SSAT((q31_t) floor((d * 32768.0) + 0.5), 16);
+    }
+  }
+
+  S->pMel = pMel;
+  arm_mat_init_q15(&S->dct, numCoeffs, (uint16_t) numFilters, pDctCoeffs);
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MFCC group
+ */
@@ -0,0 +1,104 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mfcc_q15.c
+ * Description:  Q15 mel-frequency cepstral coefficients
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* log2(1 + f) on [0, 1) by a polynomial of degree 4 without constant term, Q30 coefficients, error 2e-4 */
+#define MFCC_LOG2_C1    ( 1544627856)
+#define MFCC_LOG2_C2    (-728084451)
+#define MFCC_LOG2_C3    ( 347495462)
+#define MFCC_LOG2_C4    (-90500429)
+
+/* ln(2) in Q24 */
+#define MFCC_LN2_Q24    (11629080)
+
+/**
+  @brief         Natural logarithm of an energy in 2.30 format, in 8.7 format.
+  @param[in]     x  energy, values below the smallest positive value are taken as the smallest value
+  @return        logarithm, from -2662 (ln(2^-30)) to 89 (ln(2))
+ */
+static q15_t arm_mfcc_log_q15(
+  q31_t x)
+{
+  uint32_t norm;
+  q63_t f, p;
+
+  if (x <= 0)
+  {
+    x = 1;
+  }
+
+  /* x = 2^(1 - norm) * (1 + f), f in Q31 */
+  norm = __CLZ((uint32_t) x);
+  f = (q63_t) (((uint32_t) x << norm) & 0x7FFFFFFFU);
+
+  p = MFCC_LOG2_C4;
+  p = MFCC_LOG2_C3 + ((p * f) >> 31);
+  p = MFCC_LOG2_C2 + ((p * f) >> 31);
+  p = MFCC_LOG2_C1 + ((p * f) >> 31);
+  p = (p * f) >> 31;
+
+  /* log2(x) in Q30, times ln(2) in Q24, rounded from Q54 to Q7 */
+  p += (q63_t) (1 - (int32_t) norm) * (1LL << 30);
+  return ((q15_t) (((p * MFCC_LN2_Q24) + (1LL << 46)) >> 47));
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MFCC
+  @{
+ */
+
+/**
+  @brief         Q15 MFCC of a spectrum.
+  @param[in]     S          points to an instance of the Q15 MFCC structure
+  @param[in]     pSpectrum  points to the spectrum, in the format of \ref arm_rfft_q15()
+  @param[out]    pDst       points to the coefficients, <code>numCoeffs</code> values
+  @param[in]     pScratch   points to a scratch buffer of <code>numFilters</code> values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The filterbank energies are in 2.30 format. Their natural logarithms are in 8.7 format,
+                   with an error of at most 0.004, and range from -20.8 to 0.7. The DCT is computed by
+                   \ref arm_mat_vec_mult_q15() with a 1.15 matrix, and the coefficients are in 8.7 format,
+                   saturated, which does not happen for up to 64 filters.
+                   The log energies are written in place over the energies in the scratch buffer.
+ */
+
+void arm_mfcc_q15(
+  const arm_mfcc_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q15_t * pDst,
+        q31_t * pScratch)
+{
+  q15_t *pLog = (q15_t *) pScratch;
+  uint32_t i;
+
+  arm_mel_filterbank_q15(S->pMel, pSpectrum, pScratch);
+
+  /* Log energy i overwrites the first half of energy i/2, already read */
+  for (i = 0U; i < S->pMel->numFilters; i++)
+  {
+    pLog[i] = arm_mfcc_log_q15(pScratch[i]);
+  }
+
+  arm_mat_vec_mult_q15(&S->dct, pLog, pDst);
+}
+
+/**
+  @} end of MFCC group
+ */
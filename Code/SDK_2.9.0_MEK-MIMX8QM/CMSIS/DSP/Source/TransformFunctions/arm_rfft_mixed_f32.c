@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_f32.c
+ * Description:  RFFT & RIFFT Floating point process function on the mixed radix CFFT
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/* Real FFT extraction, same as stage_rfft_f32() of arm_rfft_fast_f32.c */
+static void arm_rfft_mixed_stage_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut)
+{
+        uint32_t  k;                                /* Loop Counter */
+        float32_t twR, twI;                         /* RFFT Twiddle coefficients */
+  const float32_t *pCoeff = S->pTwiddleRFFT + 2;    /* Points to RFFT Twiddle factors */
+  const float32_t *pA = p;                          /* increasing pointer */
+  const float32_t *pB;                              /* decreasing pointer */
+        float32_t xAR, xAI, xBR, xBI;               /* temporary variables */
+        float32_t t1a, t1b;                         /* temporary variables */
+        float32_t p0, p1, p2, p3;                   /* temporary variables */
+
+  k = S->Sint.fftLen - 1U;
+
+  /* Pack first and last sample of the frequency domain together */
+  xAR = pA[0];
+  xAI = pA[1];
+  *pOut++ = xAR + xAI;
+  *pOut++ = xAR - xAI;
+
+  pB  = p + (2U * k);
+  pA += 2;
+
+  while (k > 0U)
+  {
+    /* X(k) = 1/2 * (XA(k) + XB(k) + TW(k) * (XB(k) - XA(k))), XB(k) = conj(XA(N/2 - k)) */
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twR = *pCoeff++;
+    twI = *pCoeff++;
+
+    t1a = xBR - xAR;
+    t1b = xBI + xAI;
+
+    p0 = twR * t1a;
+    p1 = twI * t1a;
+    p2 = twR * t1b;
+    p3 = twI * t1b;
+
+    *pOut++ = 0.5f * (xAR + xBR + p0 + p3);
+    *pOut++ = 0.5f * (xAI - xBI + p1 - p2);
+
+    pA += 2;
+    pB -= 2;
+    k--;
+  }
+}
+
+/* Prepares data for the inverse CFFT, same as merge_rfft_f32() of arm_rfft_fast_f32.c */
+static void arm_rfft_mixed_merge_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pOut)
+{
+        uint32_t  k;                                /* Loop Counter */
+        float32_t twR, twI;                         /* RFFT Twiddle coefficients */
+  const float32_t *pCoeff = S->pTwiddleRFFT + 2;    /* Points to RFFT Twiddle factors */
+  const float32_t *pA = p;                          /* increasing pointer */
+  const float32_t *pB;                              /* decreasing pointer */
+        float32_t xAR, xAI, xBR, xBI;               /* temporary variables */
+        float32_t t1a, t1b, r, s, t, u;             /* temporary variables */
+
+  k = S->Sint.fftLen - 1U;
+
+  xAR = pA[0];
+  xAI = pA[1];
+  *pOut++ = 0.5f * (xAR + xAI);
+  *pOut++ = 0.5f * (xAR - xAI);
+
+  pB  = p + (2U * k);
+  pA += 2;
+
+  while (k > 0U)
+  {
+    /* G(k) = 1/2 * (X(k) + conj(X(N/2 - k)) + Tw(k) * (X(k) - conj(X(N/2 - k)))) */
+    xBI = pB[1];
+    xBR = pB[0];
+    xAR = pA[0];
+    xAI = pA[1];
+
+    twR = *pCoeff++;
+    twI = *pCoeff++;
+
+    t1a = xAR - xBR;
+    t1b = xAI + xBI;
+
+    r = twR * t1a;
+    s = twI * t1b;
+    t = twI * t1a;
+    u = twR * t1b;
+
+    *pOut++ = 0.5f * (xAR + xBR - r - s);
+    *pOut++ = 0.5f * (xAI - xBI + t - u);
+
+    pA += 2;
+    pB -= 2;
+    k--;
+  }
+}
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point real FFT on the mixed radix CFFT.
+  @param[in]     S         points to an arm_rfft_mixed_instance_f32 structure
+  @param[in]     p         points to input buffer, it is used as work buffer and modified
+  @param[out]    pOut      points to output buffer
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par           Details
+                   Input and output use the packed format of \ref arm_rfft_fast_f32(): the
+                   forward transform writes X[0] and X[fftLen/2] (both real) to pOut[0] and
+                   pOut[1], followed by the complex bins 1 .. fftLen/2-1. Any even length whose
+                   half is supported by \ref arm_cfft_mixed_f32() can be used.
+ */
+
+void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag)
+{
+  if (ifftFlag)
+  {
+    /* Real FFT compression */
+    arm_rfft_mixed_merge_f32(S, p, pOut);
+
+    /* Complex IFFT of half length */
+    arm_cfft_mixed_f32(&S->Sint, pOut, ifftFlag);
+  }
+  else
+  {
+    /* Complex FFT of half length, the even samples are the real parts */
+    arm_cfft_mixed_f32(&S->Sint, p, ifftFlag);
+
+    /* Real FFT extraction */
+    arm_rfft_mixed_stage_f32(S, p, pOut);
+  }
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,82 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_mixed_init_f32.c
+ * Description:  Plan of the Floating point RFFT on the mixed radix CFFT
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function (plan) for the floating-point real FFT on the mixed radix CFFT.
+  @param[out]    S         points to an arm_rfft_mixed_instance_f32 structure
+  @param[in]     fftLen    length of the real sequence, even and fftLen/2 a product of the factors 2, 3 and 5
+  @param[out]    pTwiddle  points to the twiddle factor buffer of size <code>2*fftLen</code>
+  @param[in]     pScratch  points to the scratch buffer of size <code>fftLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Details
+                   The first <code>fftLen</code> values of pTwiddle hold the plan of the
+                   <code>fftLen/2</code> point complex FFT, the next <code>fftLen</code> values
+                   the twiddle factors of the real stage, in the format of the
+                   <code>twiddleCoef_rfft_N</code> tables.
+ */
+
+arm_status arm_rfft_mixed_init_f32(
+  arm_rfft_mixed_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+  float32_t *pTw;
+  float64_t angle;
+  arm_status status;
+  uint32_t k;
+
+  if ((S == NULL) || (pTwiddle == NULL) || ((fftLen % 2U) != 0U) || (fftLen < 4U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_cfft_mixed_init_f32(&S->Sint, fftLen / 2U, pTwiddle, pScratch);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* sin and cos of 2*pi*k/fftLen, k = 0 .. fftLen/2-1 */
+  pTw = pTwiddle + fftLen;
+  for (k = 0U; k < (fftLen / 2U); k++)
+  {
+    angle = (6.283185307179586476925 * (float64_t)k) / (float64_t)fftLen;
+    *pTw++ = (float32_t)sin(angle);
+    *pTw++ = (float32_t)cos(angle);
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddle + fftLen;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SlidingDFT Sliding DFT
+
+  Updates a set of bins of the DFT of the last <code>fftLen</code> samples at every sample.
+
+  When a sample enters the window and the oldest one leaves it, the bin <code>k</code> of the
+  DFT of the window is updated with one complex multiplication
+  <pre>
+      X[k] = r * exp(j*2*pi*k/fftLen) * (X[k] + x[n] - r^fftLen * x[n - fftLen])
+  </pre>
+  A bin costs four multiplications per sample whatever the window length, where an FFT of the
+  window at every sample would cost <code>O(fftLen*log2(fftLen))</code>. The bins track the
+  amplitude and phase of tones, such as the harmonics of the mains frequency, without a block delay.
+
+  With a damping factor <code>r</code> of 1 the bins are exactly the DFT of the window
+  <pre>
+      X[k] = sum(m = 0 .. fftLen-1) x[n - fftLen + 1 + m] * exp(-j*2*pi*k*m/fftLen)
+  </pre>
+  and the rounding errors of the recursion accumulate with the number of samples. A damping
+  factor slightly below 1, such as <code>1 - 1e-5</code>, makes the errors decay, at the cost of
+  weighting sample <code>m</code> of the window by <code>r^(fftLen-m)</code>.
+
+  The delay line holds the <code>fftLen</code> samples of the window. The bins after the last
+  sample of a block are returned, a block of one sample gives them at every sample.
+
+  The Q31 functions keep the bins in 64 bits in 33.31 format and return them divided by
+  <code>fftLen</code>, as the Q31 FFTs.
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the complex bins after the last sample, <code>2*numBins</code> values, or NULL
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+
+void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  const float32_t *pCoeffs;
+        float32_t *pState;
+        float32_t *pDelay = S->pDelay;
+        float32_t x, delta, re, im;
+        uint32_t index = S->index;
+        uint32_t blkCnt, bin;
+
+  for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+  {
+    /* Sample entering the window minus the damped sample leaving it */
+    x = *pSrc++;
+    delta = x - (S->dampingN * pDelay[index]);
+    pDelay[index] = x;
+    index++;
+    if (index == S->fftLen)
+    {
+      index = 0U;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+    for (bin = S->numBins; bin > 0U; bin--)
+    {
+      re = pState[0] + delta;
+      im = pState[1];
+      pState[0] = (re * pCoeffs[0]) - (im * pCoeffs[1]);
+      pState[1] = (re * pCoeffs[1]) + (im * pCoeffs[0]);
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+  }
+  S->index = (uint16_t) index;
+
+  if (pDst != NULL)
+  {
+    memcpy(pDst, S->pState, 2U * S->numBins * sizeof(float32_t));
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
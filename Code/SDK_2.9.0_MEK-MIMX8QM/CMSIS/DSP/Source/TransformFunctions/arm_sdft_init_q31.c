@@ -0,0 +1,91 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q31.c
+ * Description:  Q31 sliding DFT initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 sliding DFT.
+  @param[in,out] S        points to an instance of the Q31 sliding DFT structure
+  @param[in]     fftLen   length of the DFT window
+  @param[in]     numBins  number of DFT bins
+  @param[in]     pBins    points to the bin indices, from 0 to <code>fftLen/2</code>, <code>numBins</code> values
+  @param[in]     damping  damping factor, 1 or slightly less
+  @param[out]    pCoeffs  points to the coefficient buffer of <code>2*numBins</code> values
+  @param[in]     pState   points to the state buffer of <code>2*numBins</code> values
+  @param[in]     pDelay   points to the delay line of <code>fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : a parameter is out of range
+
+  @par           Details
+                   The twiddle factors and the damping of the delay line are rounded to 1.31 format, a
+                   value of 1 saturates to <code>0x7FFFFFFF</code>. The bins and the delay line are cleared:
+                   the window starts as <code>fftLen</code> zeros.
+ */
+
+arm_status arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        float32_t damping,
+        q31_t * pCoeffs,
+        q63_t * pState,
+        q31_t * pDelay)
+{
+  float64_t w;
+  uint32_t i;
+
+  if ((fftLen < 2U) || (numBins == 0U) || (damping <= 0.0f) || (damping > 1.0f))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* r * exp(j*2*pi*k/fftLen) */
+  for (i = 0U; i < numBins; i++)
+  {
+    if (pBins[i] > (fftLen / 2U))
+    {
+      return ARM_MATH_ARGUMENT_ERROR;
+    }
+    w = (6.283185307179586476925 * (float64_t)pBins[i]) / (float64_t)fftLen;
+    pCoeffs[2U * i] = clip_q63_to_q31((q63_t) floor((damping * cos(w) * 2147483648.0) + 0.5));
+    pCoeffs[(2U * i) + 1U] = clip_q63_to_q31((q63_t) floor((damping * sin(w) * 2147483648.0) + 0.5));
+  }
+  memset(pState, 0, 2U * numBins * sizeof(q63_t));
+  memset(pDelay, 0, fftLen * sizeof(q31_t));
+
+  S->fftLen = fftLen;
+  S->numBins = numBins;
+  S->index = 0U;
+  S->dampingN = clip_q63_to_q31((q63_t) floor((pow(damping, fftLen) * 2147483648.0) + 0.5));
+  S->pCoeffs = pCoeffs;
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of SlidingDFT group
+ */
@@ -0,0 +1,93 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SlidingDFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the complex bins after the last sample, <code>2*numBins</code> values, or NULL
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The bins are kept in 64-bit state variables in 33.31 format, a bin is at most
+                   <code>fftLen</code> times full scale. The twiddle factors are in 1.31 format and
+                   applied with \ref mult32x64(). The output bins are divided by <code>fftLen</code>
+                   and saturated to 1.31 format.
+ */
+
+void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  const q31_t *pCoeffs;
+        q63_t *pState;
+        q31_t *pDelay = S->pDelay;
+        q31_t x;
+        q63_t delta, re, im;
+        uint32_t index = S->index;
+        uint32_t blkCnt, bin;
+
+  for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+  {
+    /* Sample entering the window minus the damped sample leaving it */
+    x = *pSrc++;
+    delta = (q63_t) x - (((q63_t) pDelay[index] * S->dampingN) >> 31);
+    pDelay[index] = x;
+    index++;
+    if (index == S->fftLen)
+    {
+      index = 0U;
+    }
+
+    pCoeffs = S->pCoeffs;
+    pState = S->pState;
+    for (bin = S->numBins; bin > 0U; bin--)
+    {
+      re = pState[0] + delta;
+      im = pState[1];
+      pState[0] = (mult32x64(re, pCoeffs[0]) - mult32x64(im, pCoeffs[1])) << 1;
+      pState[1] = (mult32x64(re, pCoeffs[1]) + mult32x64(im, pCoeffs[0])) << 1;
+      pCoeffs += 2U;
+      pState += 2U;
+    }
+  }
+  S->index = (uint16_t) index;
+
+  if (pDst != NULL)
+  {
+    pState = S->pState;
+    for (bin = 2U * S->numBins; bin > 0U; bin--)
+    {
+      *pDst++ = clip_q63_to_q31(*pState++ / (q63_t) S->fftLen);
+    }
+  }
+}
+
+/**
+  @} end of SlidingDFT group
+ */
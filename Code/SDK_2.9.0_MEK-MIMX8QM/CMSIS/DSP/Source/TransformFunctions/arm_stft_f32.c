@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point short-time Fourier transform
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Short-Time Fourier Transform
+
+  Splits a stream of samples into overlapping frames and computes the real FFT
+  of each windowed frame.
+
+  A frame holds <code>frameLen</code> samples and the next frame starts <code>hopSize</code>
+  samples later, so consecutive frames overlap by <code>frameLen - hopSize</code> samples.
+  The frame is multiplied by the analysis window and padded with zeros to
+  <code>fftLen</code> samples before the transform.
+
+  The input is taken in blocks of any size. The state buffer keeps the samples of the
+  frame being collected, a call returns the number of frames completed by its block
+  and writes their spectra one after the other, in the format of the real FFT of the type:
+  \ref arm_rfft_fast_f32() for the floating-point function and \ref arm_rfft_q15() for the
+  Q15 function. The first frame is produced once <code>frameLen</code> samples have been
+  received.
+
+  @par           Memory
+                   The instance keeps a pointer to the window and to the state buffer of
+                   <code>frameLen</code> values. The processing function needs a scratch buffer of
+                   <code>fftLen</code> values for the windowed frame, and an output buffer for
+                   \ref ARM_STFT_MAX_FRAMES(blockSize, hopSize) spectra.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point short-time Fourier transform.
+  @param[in,out] S          points to an instance of the floating-point STFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the spectra, <code>fftLen</code> values per frame
+  @param[in]     blockSize  number of samples to process
+  @param[in]     pScratch   points to a scratch buffer of <code>fftLen</code> values
+  @return        number of frames written to pDst
+ */
+
+uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t * pScratch)
+{
+  const uint32_t frameLen = S->frameLen;
+  const uint32_t hopSize = S->hopSize;
+        uint32_t numFrames = 0U;
+        uint32_t blkCnt;
+
+  while (blockSize > 0U)
+  {
+    /* Complete the frame */
+    blkCnt = frameLen - S->fill;
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+    memcpy(S->pState + S->fill, pSrc, blkCnt * sizeof(float32_t));
+    S->fill += (uint16_t) blkCnt;
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+
+    if (S->fill == frameLen)
+    {
+      /* Windowed frame padded with zeros */
+      if (S->pWindow != NULL)
+      {
+        arm_mult_f32(S->pState, S->pWindow, pScratch, frameLen);
+      }
+      else
+      {
+        memcpy(pScratch, S->pState, frameLen * sizeof(float32_t));
+      }
+      memset(pScratch + frameLen, 0, (S->fftLen - frameLen) * sizeof(float32_t));
+
+      arm_rfft_fast_f32(&S->rfft, pScratch, pDst, 0);
+      pDst += S->fftLen;
+      numFrames++;
+
+      /* Keep the overlap with the next frame */
+      memmove(S->pState, S->pState + hopSize, (frameLen - hopSize) * sizeof(float32_t));
+      S->fill = (uint16_t) (frameLen - hopSize);
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of STFT group
+ */
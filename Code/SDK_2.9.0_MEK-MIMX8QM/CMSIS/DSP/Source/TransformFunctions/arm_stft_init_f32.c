@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Floating-point short-time Fourier transform initialization function
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point short-time Fourier transform.
+  @param[in,out] S         points to an instance of the floating-point STFT structure
+  @param[in]     fftLen    length of the real FFT, a length supported by \ref arm_rfft_fast_init_f32()
+  @param[in]     frameLen  samples of a frame, from 1 to <code>fftLen</code>
+  @param[in]     hopSize   samples between the starts of two frames, from 1 to <code>frameLen</code>
+  @param[in]     pWindow   points to the analysis window of <code>frameLen</code> values, NULL for a rectangular window
+  @param[in]     pState    points to the state buffer of <code>frameLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : unsupported <code>fftLen</code>, or frame length or hop size out of range
+ */
+
+arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t frameLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState)
+{
+  arm_status status;
+
+  if ((frameLen == 0U) || (frameLen > fftLen) || (hopSize == 0U) || (hopSize > frameLen))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  status = arm_rfft_fast_init_f32(&S->rfft, fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  S->fftLen = fftLen;
+  S->frameLen = frameLen;
+  S->hopSize = hopSize;
+  S->fill = 0U;
+  S->pWindow = pWindow;
+  S->pState = pState;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_q15.c
+ * Description:  Q15 short-time Fourier transform
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q15 short-time Fourier transform.
+  @param[in,out] S          points to an instance of the Q15 STFT structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the spectra, <code>2*fftLen</code> values per frame
+  @param[in]     blockSize  number of samples to process
+  @param[in]     pScratch   points to a scratch buffer of <code>fftLen</code> values
+  @return        number of frames written to pDst
+
+  @par           Scaling and Overflow Behavior
+                   The window is applied with \ref arm_mult_q15() and the spectra have the scaling of
+                   \ref arm_rfft_q15(): the spectrum of an <code>fftLen</code> point frame is divided by
+                   <code>fftLen</code>. The real FFT works in place, the frame is transformed in the scratch buffer.
+ */
+
+uint32_t arm_stft_q15(
+        arm_stft_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize,
+        q15_t * pScratch)
+{
+  const uint32_t frameLen = S->frameLen;
+  const uint32_t hopSize = S->hopSize;
+        uint32_t numFrames = 0U;
+        uint32_t blkCnt;
+
+  while (blockSize > 0U)
+  {
+    /* Complete the frame */
+    blkCnt = frameLen - S->fill;
+    if (blkCnt > blockSize)
+    {
+      blkCnt = blockSize;
+    }
+    memcpy(S->pState + S->fill, pSrc, blkCnt * sizeof(q15_t));
+    S->fill += (uint16_t) blkCnt;
+    pSrc += blkCnt;
+    blockSize -= blkCnt;
+
+    if (S->fill == frameLen)
+    {
+      /* Windowed frame padded with zeros */
+      if (S->pWindow != NULL)
+      {
+        arm_mult_q15(S->pState, S->pWindow, pScratch, frameLen);
+      }
+      else
+      {
+        memcpy(pScratch, S->pState, frameLen * sizeof(q15_t));
+      }
+      memset(pScratch + frameLen, 0, (S->fftLen - frameLen) * sizeof(q15_t));
+
+      arm_rfft_q15(&S->rfft, pScratch, pDst);
+      pDst += 2U * S->fftLen;
+      numFrames++;
+
+      /* Keep the overlap with the next frame */
+      memmove(S->pState, S->pState + hopSize, (frameLen - hopSize) * sizeof(q15_t));
+      S->fill = (uint16_t) (frameLen - hopSize);
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of STFT group
+ */
@@ -0,0 +1,955 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        bench_filtering.c
+ * Description:  FIR and biquad kernels of the host suite
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "dsp_bench.h"
+#include "arm_fixed_size_filters.h"
+
+/* 32 tap lowpass, even length as required by the Q15 FIR */
+#define FIR_TAPS        32U
+/* 8th order Butterworth lowpass */
+#define BIQUAD_STAGES   4U
+#define BIQUAD_MAX_STAGES 8U     /* up to 16th order for the fixed size kernels */
+#define BIQUAD_FC       0.1
+/* Fixed point coefficients are stored divided by 2^BIQUAD_POST_SHIFT */
+#define BIQUAD_POST_SHIFT 1
+
+/* Variant flags of the direct form II transposed biquad and of the FFT FIR */
+#define BIQUAD_DF2T     0x100U
+#define FIR_FFT         0x200U
+
+/*
+ * Long FIR filters: block size n is the number of taps, the input is
+ * processed in blocks of FIRLONG_BLOCK samples, at least n + FIRLONG_BLOCK
+ * samples so that every partition of the FFT filter contributes.
+ */
+#define FIRLONG_BLOCK   256U
+/* Call sizes of the uneven FFT FIR run, which split the partitions at varying offsets */
+#define FIRLONG_UNEVEN  { 100U, 37U, 1U, 255U, 160U }
+
+/*
+ * Interleaved multichannel filters: block size n is the number of frames,
+ * every channel has its own cut-off. The number of channels is stored in
+ * the upper half of the variant. MULTICH_SPLIT selects the baseline which
+ * deinterleaves, runs the single channel function per channel and
+ * reinterleaves.
+ */
+#define MULTICH_MAX     8U
+#define MULTICH_FIR     0x400U
+#define MULTICH_SPLIT   0x800U
+#define MULTICH(ch)     ((uint32_t)(ch) << 16)
+
+/*
+ * Sample rate conversion: block size n is the number of input samples of
+ * one call, the input is a tone. The reference is the tone at the output
+ * instants, scaled and delayed by the prototype filter, so the SNR column
+ * is the THD+N of the conversion. The throughput is per output sample.
+ * The upper half of the variant selects the ratio, RESAMPLE_CHAIN the
+ * interpolator and decimator chain at the upsampled rate.
+ */
+#define RESAMPLE_TONE   997.0
+#define RESAMPLE_AMPL   0.5
+#define RESAMPLE_CHAIN  0x1000U
+#define RESAMPLE(r)     ((uint32_t)(r) << 16)
+
+/*
+ * Kernels generated for a fixed size, against the generic functions at the
+ * same size. The upper half of the variant is the number of FIR taps or of
+ * biquad stages, FIXED_SIZE selects the generated function.
+ */
+#define FIXED_SIZE      0x2000U
+#define FIXED(n)        ((uint32_t)(n) << 16)
+
+typedef void (*fixed_fir_f32)(const arm_fir_instance_f32 *, const float32_t *, float32_t *, uint32_t);
+typedef void (*fixed_df1_q31)(const arm_biquad_casd_df1_inst_q31 *, const q31_t *, q31_t *, uint32_t);
+
+typedef struct
+{
+  dsp_bench_type type;
+  float64_t *x;          /* quantized input */
+  float64_t *h;          /* quantized coefficients */
+  void *src;
+  void *dst;
+  void *coeffs;
+  void *state;
+  float32_t *coeffsFreq;
+  float32_t *planar;     /* deinterleaved input and output of the multichannel baseline */
+  void *table;           /* polyphase table of the resampler, upsampled signal of the chain */
+  uint32_t skip;         /* output samples of the start transient, not compared */
+  fixed_fir_f32 firFixed;
+  fixed_df1_q31 df1Fixed;
+  union
+  {
+    arm_fir_instance_f32 fir_f32;
+    arm_fir_instance_q31 fir_q31;
+    arm_fir_instance_q15 fir_q15;
+    arm_fir_fft_instance_f32 fir_fft_f32;
+    arm_biquad_casd_df1_inst_f32 df1_f32;
+    arm_biquad_cascade_df2T_instance_f32 df2T_f32;
+    arm_biquad_casd_df1_inst_q31 df1_q31;
+    arm_biquad_casd_df1_inst_q15 df1_q15;
+    arm_fir_multi_instance_f32 fir_multi_f32;
+    arm_biquad_cascade_multi_df2T_instance_f32 df2T_multi_f32;
+    arm_fir_instance_f32 fir_ch_f32[MULTICH_MAX];
+    arm_biquad_cascade_df2T_instance_f32 df2T_ch_f32[MULTICH_MAX];
+    arm_resample_instance_f32 resample_f32;
+    arm_resample_instance_q15 resample_q15;
+    struct
+    {
+      arm_fir_interpolate_instance_f32 interp;
+      arm_fir_decimate_instance_f32 decim;
+    } chain_f32;
+  } S;
+} filter_ctx;
+
+static filter_ctx *filter_alloc(dsp_bench_case *c, uint32_t len, uint32_t numCoeffs, uint32_t stateLen)
+{
+  filter_ctx *ctx = dsp_bench_alloc(sizeof(filter_ctx));
+  size_t size;
+
+  ctx->type = (dsp_bench_type)(c->variant & 0xFFU);
+  size = dsp_bench_type_size(ctx->type);
+  ctx->x = dsp_bench_alloc(len * sizeof(float64_t));
+  ctx->h = dsp_bench_alloc(numCoeffs * sizeof(float64_t));
+  ctx->src = dsp_bench_alloc(len * size);
+  ctx->dst = dsp_bench_alloc(len * size);
+  ctx->coeffs = dsp_bench_alloc(numCoeffs * size);
+  ctx->state = dsp_bench_alloc(stateLen * size);
+
+  c->samples = len;
+  c->outLen = len;
+  c->ref = dsp_bench_alloc(len * sizeof(float64_t));
+  c->out = dsp_bench_alloc(len * sizeof(float64_t));
+  c->priv = ctx;
+
+  dsp_bench_signal(ctx->x, len, 0);
+  dsp_bench_quantize(ctx->type, ctx->x, ctx->src, len);
+  return ctx;
+}
+
+static void filter_teardown(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  dsp_bench_free(ctx->x);
+  dsp_bench_free(ctx->h);
+  dsp_bench_free(ctx->src);
+  dsp_bench_free(ctx->dst);
+  dsp_bench_free(ctx->coeffs);
+  dsp_bench_free(ctx->state);
+  dsp_bench_free(ctx->coeffsFreq);
+  dsp_bench_free(ctx->planar);
+  dsp_bench_free(ctx->table);
+  dsp_bench_free(ctx);
+}
+
+static void filter_result(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  dsp_bench_from(ctx->type, ctx->dst, c->out, c->outLen, 1.0);
+}
+
+/*
+ * FIR
+ */
+
+/* Hamming windowed sinc of taps coefficients, cut-off at fc * fs, unity gain at DC */
+static void fir_sinc(float64_t *h, uint32_t taps, float64_t fc)
+{
+  float64_t w, sum = 0.0;
+  uint32_t i;
+
+  for (i = 0; i < taps; i++)
+  {
+    float64_t t = (float64_t)i - ((float64_t)(taps - 1U) / 2.0);
+    w = 0.54 - (0.46 * cos((2.0 * PI * i) / (taps - 1U)));
+    h[i] = w * ((t == 0.0) ? (2.0 * fc) : (sin(2.0 * PI * fc * t) / (PI * t)));
+    sum += h[i];
+  }
+  for (i = 0; i < taps; i++)
+  {
+    h[i] /= sum;
+  }
+}
+
+/* Quantize h to dst, time reversed as CMSIS expects the coefficients, h is updated */
+static void fir_store(dsp_bench_type type, float64_t *h, void *dst, uint32_t taps)
+{
+  uint8_t *reversed = dsp_bench_alloc(taps * sizeof(float32_t));
+  size_t size = dsp_bench_type_size(type);
+  uint32_t i;
+
+  dsp_bench_quantize(type, h, reversed, taps);
+  for (i = 0; i < taps; i++)
+  {
+    memcpy((uint8_t *)dst + (i * size), reversed + ((taps - 1U - i) * size), size);
+  }
+  dsp_bench_free(reversed);
+}
+
+/* Direct convolution in double, len samples of stride values apart */
+static void fir_reference(const float64_t *h, uint32_t taps, const float64_t *x, float64_t *y, uint32_t len, uint32_t stride)
+{
+  float64_t acc;
+  uint32_t i, k;
+
+  for (i = 0; i < len; i++)
+  {
+    acc = 0.0;
+    for (k = 0; (k < taps) && (k <= i); k++)
+    {
+      acc += h[k] * x[(i - k) * stride];
+    }
+    y[i * stride] = acc;
+  }
+}
+
+/*
+ * Lowpass cut-off at fs/5. The quantized coefficients are written to ctx->h
+ * and ctx->coeffs. The reference output is computed for c->outLen samples.
+ */
+static void fir_design(dsp_bench_case *c, filter_ctx *ctx, uint32_t taps)
+{
+  fir_sinc(ctx->h, taps, 0.2);
+  fir_store(ctx->type, ctx->h, ctx->coeffs, taps);
+  fir_reference(ctx->h, taps, ctx->x, c->ref, c->outLen, 1U);
+}
+
+static arm_status fir_setup(dsp_bench_case *c)
+{
+  const uint32_t taps = ((c->variant >> 16) != 0U) ? (c->variant >> 16) : FIR_TAPS;
+  filter_ctx *ctx = filter_alloc(c, c->n, taps, taps + c->n);
+
+  fir_design(c, ctx, taps);
+
+  switch (ctx->type)
+  {
+    case DSP_BENCH_Q31:
+      arm_fir_init_q31(&ctx->S.fir_q31, (uint16_t)taps, ctx->coeffs, ctx->state, c->n);
+      break;
+    case DSP_BENCH_Q15:
+      return arm_fir_init_q15(&ctx->S.fir_q15, (uint16_t)taps, ctx->coeffs, ctx->state, c->n);
+    default:
+      arm_fir_init_f32(&ctx->S.fir_f32, (uint16_t)taps, ctx->coeffs, ctx->state, c->n);
+      break;
+  }
+  return ARM_MATH_SUCCESS;
+}
+
+static void fir_run_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_f32(&ctx->S.fir_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void fir_run_q31(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_q31(&ctx->S.fir_q31, ctx->src, ctx->dst, c->n);
+}
+
+static void fir_run_fast_q31(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_fast_q31(&ctx->S.fir_q31, ctx->src, ctx->dst, c->n);
+}
+
+static void fir_run_q15(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_q15(&ctx->S.fir_q15, ctx->src, ctx->dst, c->n);
+}
+
+static void fir_run_fast_q15(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_fast_q15(&ctx->S.fir_q15, ctx->src, ctx->dst, c->n);
+}
+
+/*
+ * Long FIR, direct form against partitioned convolution
+ */
+
+static arm_status firlong_setup(dsp_bench_case *c)
+{
+  const uint32_t taps = c->n;
+  const int fft = (c->variant & FIR_FFT) != 0U;
+  uint32_t len = (taps > (3U * FIRLONG_BLOCK)) ? (taps + FIRLONG_BLOCK) : (4U * FIRLONG_BLOCK);
+  filter_ctx *ctx;
+
+  if ((taps < 2U) || (taps > 0xFFFFU))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+  len = ((len + FIRLONG_BLOCK - 1U) / FIRLONG_BLOCK) * FIRLONG_BLOCK;
+  ctx = filter_alloc(c, len, taps, fft ? ARM_FIR_FFT_STATE_LEN(taps, FIRLONG_BLOCK) : (taps + FIRLONG_BLOCK - 1U));
+  fir_design(c, ctx, taps);
+
+  if (fft)
+  {
+    ctx->coeffsFreq = dsp_bench_alloc(ARM_FIR_FFT_COEFFS_LEN(taps, FIRLONG_BLOCK) * sizeof(float32_t));
+    return arm_fir_fft_init_f32(&ctx->S.fir_fft_f32, (uint16_t)taps, ctx->coeffs, ctx->coeffsFreq, ctx->state, FIRLONG_BLOCK);
+  }
+  arm_fir_init_f32(&ctx->S.fir_f32, (uint16_t)taps, ctx->coeffs, ctx->state, FIRLONG_BLOCK);
+  return ARM_MATH_SUCCESS;
+}
+
+static void firlong_run_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+  uint32_t i;
+
+  for (i = 0; i < c->samples; i += FIRLONG_BLOCK)
+  {
+    arm_fir_f32(&ctx->S.fir_f32, (float32_t *)ctx->src + i, (float32_t *)ctx->dst + i, FIRLONG_BLOCK);
+  }
+}
+
+static void firlong_run_fft_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+  uint32_t i;
+
+  for (i = 0; i < c->samples; i += FIRLONG_BLOCK)
+  {
+    arm_fir_fft_f32(&ctx->S.fir_fft_f32, (float32_t *)ctx->src + i, (float32_t *)ctx->dst + i, FIRLONG_BLOCK);
+  }
+}
+
+static void firlong_run_fft_uneven_f32(dsp_bench_case *c)
+{
+  static const uint32_t sizes[] = FIRLONG_UNEVEN;
+  filter_ctx *ctx = c->priv;
+  uint32_t i, k, n;
+
+  for (i = 0, k = 0; i < c->samples; i += n)
+  {
+    n = sizes[k];
+    k = (k + 1U) % (sizeof(sizes) / sizeof(sizes[0]));
+    if (n > (c->samples - i))
+    {
+      n = c->samples - i;
+    }
+    arm_fir_fft_f32(&ctx->S.fir_fft_f32, (float32_t *)ctx->src + i, (float32_t *)ctx->dst + i, n);
+  }
+}
+
+/*
+ * Biquad cascade
+ */
+
+/*
+ * RBJ lowpass sections with the pole Q factors of a Butterworth filter,
+ * low Q first so that the intermediate signals stay in range.
+ * Stored as CMSIS expects them: {b0, b1, b2, -a1, -a2}, Q15 with a zero
+ * after b0.
+ */
+static void biquad_butterworth(float64_t *h, uint32_t numStages, uint32_t perStage, float64_t fc)
+{
+  uint32_t st;
+
+  for (st = 0; st < numStages; st++)
+  {
+    float64_t q = 1.0 / (2.0 * cos((PI * ((2.0 * (numStages - 1U - st)) + 1.0)) / (4.0 * numStages)));
+    float64_t w0 = 2.0 * PI * fc;
+    float64_t alpha = sin(w0) / (2.0 * q);
+    float64_t a0 = 1.0 + alpha;
+    float64_t *p = &h[st * perStage];
+
+    *p++ = ((1.0 - cos(w0)) / 2.0) / a0;
+    if (perStage == 6U)
+    {
+      *p++ = 0.0;
+    }
+    *p++ = (1.0 - cos(w0)) / a0;
+    *p++ = ((1.0 - cos(w0)) / 2.0) / a0;
+    *p++ = (2.0 * cos(w0)) / a0;
+    *p = -(1.0 - alpha) / a0;
+  }
+}
+
+/* Direct form I in double with the quantized coefficients, len samples of stride values apart */
+static void biquad_reference(const float64_t *h, uint32_t numStages, uint32_t perStage, float64_t scale,
+                             const float64_t *x, float64_t *y, uint32_t len, uint32_t stride)
+{
+  float64_t xn, yn;
+  float64_t s[4 * BIQUAD_MAX_STAGES];
+  uint32_t i, st;
+
+  memset(s, 0, sizeof(s));
+  for (i = 0; i < len; i++)
+  {
+    xn = x[i * stride];
+    for (st = 0; st < numStages; st++)
+    {
+      const float64_t *p = &h[st * perStage];
+      float64_t *z = &s[4U * st];
+
+      if (perStage == 6U)
+      {
+        yn = scale * ((p[0] * xn) + (p[2] * z[0]) + (p[3] * z[1]) + (p[4] * z[2]) + (p[5] * z[3]));
+      }
+      else
+      {
+        yn = scale * ((p[0] * xn) + (p[1] * z[0]) + (p[2] * z[1]) + (p[3] * z[2]) + (p[4] * z[3]));
+      }
+      z[1] = z[0];
+      z[0] = xn;
+      z[3] = z[2];
+      z[2] = yn;
+      xn = yn;
+    }
+    y[i * stride] = xn;
+  }
+}
+
+static arm_status biquad_setup(dsp_bench_case *c)
+{
+  const uint32_t perStage = ((c->variant & 0xFFU) == DSP_BENCH_Q15) ? 6U : 5U;
+  const uint32_t numStages = ((c->variant >> 16) != 0U) ? (c->variant >> 16) : BIQUAD_STAGES;
+  filter_ctx *ctx;
+  float64_t *h;
+  float64_t scale = 1.0;
+  uint32_t i;
+
+  if (numStages > BIQUAD_MAX_STAGES)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+  ctx = filter_alloc(c, c->n, numStages * perStage, 4U * numStages);
+  h = ctx->h;
+  biquad_butterworth(h, numStages, perStage, BIQUAD_FC);
+
+  /* Beyond 8th order the signals overshoot full scale, the input of the cascade is scaled by 1/4 */
+  if (numStages > BIQUAD_STAGES)
+  {
+    for (i = 0; i < (perStage - 2U); i++)
+    {
+      h[i] *= 0.25;
+    }
+  }
+
+  if (ctx->type != DSP_BENCH_F32)
+  {
+    scale = (float64_t)(1U << BIQUAD_POST_SHIFT);
+    for (i = 0; i < numStages * perStage; i++)
+    {
+      h[i] /= scale;
+    }
+  }
+  dsp_bench_quantize(ctx->type, h, ctx->coeffs, numStages * perStage);
+  biquad_reference(h, numStages, perStage, scale, ctx->x, c->ref, c->n, 1U);
+
+  switch (c->variant & (0xFFU | BIQUAD_DF2T))
+  {
+    case DSP_BENCH_Q31:
+      arm_biquad_cascade_df1_init_q31(&ctx->S.df1_q31, (uint8_t)numStages, ctx->coeffs, ctx->state, BIQUAD_POST_SHIFT);
+      break;
+    case DSP_BENCH_Q15:
+      arm_biquad_cascade_df1_init_q15(&ctx->S.df1_q15, (uint8_t)numStages, ctx->coeffs, ctx->state, BIQUAD_POST_SHIFT);
+      break;
+    case DSP_BENCH_F32 | BIQUAD_DF2T:
+      arm_biquad_cascade_df2T_init_f32(&ctx->S.df2T_f32, (uint8_t)numStages, ctx->coeffs, ctx->state);
+      break;
+    default:
+      arm_biquad_cascade_df1_init_f32(&ctx->S.df1_f32, (uint8_t)numStages, ctx->coeffs, ctx->state);
+      break;
+  }
+  return ARM_MATH_SUCCESS;
+}
+
+static void biquad_run_df1_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_df1_f32(&ctx->S.df1_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void biquad_run_df2T_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_df2T_f32(&ctx->S.df2T_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void biquad_run_df1_q31(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_df1_q31(&ctx->S.df1_q31, ctx->src, ctx->dst, c->n);
+}
+
+static void biquad_run_df1_fast_q31(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_df1_fast_q31(&ctx->S.df1_q31, ctx->src, ctx->dst, c->n);
+}
+
+static void biquad_run_df1_q15(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_df1_q15(&ctx->S.df1_q15, ctx->src, ctx->dst, c->n);
+}
+
+static void biquad_run_df1_fast_q15(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_df1_fast_q15(&ctx->S.df1_q15, ctx->src, ctx->dst, c->n);
+}
+
+/*
+ * FIR and biquad generated for a fixed size, against the generic functions
+ */
+
+ARM_FIR_F32_FIXED_SIZE(fir_fixed_5_f32, 5)
+ARM_FIR_F32_FIXED_SIZE(fir_fixed_8_f32, 8)
+ARM_FIR_F32_FIXED_SIZE(fir_fixed_16_f32, 16)
+ARM_FIR_F32_FIXED_SIZE(fir_fixed_32_f32, 32)
+ARM_FIR_F32_FIXED_SIZE(fir_fixed_64_f32, 64)
+
+ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(biquad_fixed_2_q31, 2)
+ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(biquad_fixed_3_q31, 3)
+ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(biquad_fixed_4_q31, 4)
+ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(biquad_fixed_6_q31, 6)
+ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(biquad_fixed_8_q31, 8)
+
+static const struct
+{
+  uint32_t size;
+  fixed_fir_f32 fir;
+  fixed_df1_q31 df1;
+} fixed_kernels[] = {
+  { 5U,  fir_fixed_5_f32,  NULL },
+  { 8U,  fir_fixed_8_f32,  NULL },
+  { 16U, fir_fixed_16_f32, NULL },
+  { 32U, fir_fixed_32_f32, NULL },
+  { 64U, fir_fixed_64_f32, NULL },
+  { 2U,  NULL, biquad_fixed_2_q31 },
+  { 3U,  NULL, biquad_fixed_3_q31 },
+  { 4U,  NULL, biquad_fixed_4_q31 },
+  { 6U,  NULL, biquad_fixed_6_q31 },
+  { 8U,  NULL, biquad_fixed_8_q31 },
+};
+
+static arm_status fixed_setup(dsp_bench_case *c)
+{
+  const uint32_t size = c->variant >> 16;
+  const int fir = (c->variant & 0xFFU) == DSP_BENCH_F32;
+  arm_status status = fir ? fir_setup(c) : biquad_setup(c);
+  filter_ctx *ctx = c->priv;
+  uint32_t i;
+
+  if ((status != ARM_MATH_SUCCESS) || ((c->variant & FIXED_SIZE) == 0U))
+  {
+    return status;
+  }
+  for (i = 0; i < (sizeof(fixed_kernels) / sizeof(fixed_kernels[0])); i++)
+  {
+    if ((fixed_kernels[i].size == size) && (fir ? (fixed_kernels[i].fir != NULL) : (fixed_kernels[i].df1 != NULL)))
+    {
+      ctx->firFixed = fixed_kernels[i].fir;
+      ctx->df1Fixed = fixed_kernels[i].df1;
+      return ARM_MATH_SUCCESS;
+    }
+  }
+  return ARM_MATH_ARGUMENT_ERROR;
+}
+
+static void fixed_run_fir_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  ctx->firFixed(&ctx->S.fir_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void fixed_run_df1_q31(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  ctx->df1Fixed(&ctx->S.df1_q31, ctx->src, ctx->dst, c->n);
+}
+
+/*
+ * Interleaved multichannel FIR and biquad, against deinterleaving
+ */
+
+static arm_status multich_setup(dsp_bench_case *c)
+{
+  const uint32_t C = c->variant >> 16;
+  const uint32_t n = c->n;
+  const int fir = (c->variant & MULTICH_FIR) != 0U;
+  const uint32_t perChannel = fir ? FIR_TAPS : (5U * BIQUAD_STAGES);
+  const uint32_t stateLen = fir ? (FIR_TAPS + n - 1U) : (2U * BIQUAD_STAGES);
+  filter_ctx *ctx = filter_alloc(c, n * C, perChannel * C, stateLen * C);
+  float32_t *coeffs = ctx->coeffs;
+  float32_t *state = ctx->state;
+  float64_t *h;
+  uint32_t ch;
+
+  for (ch = 0; ch < C; ch++)
+  {
+    h = ctx->h + (ch * perChannel);
+    if (fir)
+    {
+      fir_sinc(h, FIR_TAPS, 0.05 + (0.03 * ch));
+      fir_store(ctx->type, h, coeffs + (ch * perChannel), FIR_TAPS);
+      fir_reference(h, FIR_TAPS, ctx->x + ch, c->ref + ch, n, C);
+    }
+    else
+    {
+      biquad_butterworth(h, BIQUAD_STAGES, 5U, 0.02 + (0.02 * ch));
+      dsp_bench_quantize(ctx->type, h, coeffs + (ch * perChannel), perChannel);
+      biquad_reference(h, BIQUAD_STAGES, 5U, 1.0, ctx->x + ch, c->ref + ch, n, C);
+    }
+  }
+
+  if ((c->variant & MULTICH_SPLIT) == 0U)
+  {
+    if (fir)
+    {
+      /* The multichannel FIR takes the coefficients interleaved by tap */
+      float32_t *perCh = dsp_bench_alloc(perChannel * C * sizeof(float32_t));
+      uint32_t k;
+
+      memcpy(perCh, coeffs, perChannel * C * sizeof(float32_t));
+      for (ch = 0; ch < C; ch++)
+      {
+        for (k = 0; k < FIR_TAPS; k++)
+        {
+          coeffs[(k * C) + ch] = perCh[(ch * FIR_TAPS) + k];
+        }
+      }
+      dsp_bench_free(perCh);
+      arm_fir_multi_init_f32(&ctx->S.fir_multi_f32, (uint16_t)C, FIR_TAPS, coeffs, state, n);
+    }
+    else
+    {
+      arm_biquad_cascade_multi_df2T_init_f32(&ctx->S.df2T_multi_f32, (uint16_t)C, BIQUAD_STAGES, coeffs, state);
+    }
+    return ARM_MATH_SUCCESS;
+  }
+
+  /* One single channel instance per channel, on the same coefficients */
+  ctx->planar = dsp_bench_alloc(2U * n * C * sizeof(float32_t));
+  for (ch = 0; ch < C; ch++)
+  {
+    if (fir)
+    {
+      arm_fir_init_f32(&ctx->S.fir_ch_f32[ch], FIR_TAPS, coeffs + (ch * perChannel), state + (ch * stateLen), n);
+    }
+    else
+    {
+      arm_biquad_cascade_df2T_init_f32(&ctx->S.df2T_ch_f32[ch], BIQUAD_STAGES, coeffs + (ch * perChannel), state + (ch * stateLen));
+    }
+  }
+  return ARM_MATH_SUCCESS;
+}
+
+static void multich_run_fir_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_multi_f32(&ctx->S.fir_multi_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void multich_run_df2T_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_biquad_cascade_multi_df2T_f32(&ctx->S.df2T_multi_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void multich_run_split_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+  const uint32_t C = c->variant >> 16;
+  const uint32_t n = c->n;
+  const float32_t *src = ctx->src;
+  float32_t *dst = ctx->dst;
+  float32_t *in = ctx->planar;
+  float32_t *out = in + (n * C);
+  uint32_t ch, i;
+
+  for (ch = 0; ch < C; ch++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      in[(ch * n) + i] = src[(i * C) + ch];
+    }
+  }
+
+  for (ch = 0; ch < C; ch++)
+  {
+    if ((c->variant & MULTICH_FIR) != 0U)
+    {
+      arm_fir_f32(&ctx->S.fir_ch_f32[ch], in + (ch * n), out + (ch * n), n);
+    }
+    else
+    {
+      arm_biquad_cascade_df2T_f32(&ctx->S.df2T_ch_f32[ch], in + (ch * n), out + (ch * n), n);
+    }
+  }
+
+  for (ch = 0; ch < C; ch++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      dst[(i * C) + ch] = out[(ch * n) + i];
+    }
+  }
+}
+
+/*
+ * Polyphase resampler, against an interpolator and decimator chain
+ */
+
+static const struct
+{
+  uint32_t fsIn;
+  uint32_t fsOut;
+  uint16_t numPhases;
+  uint16_t phaseLength;
+  int32_t drift;         /* ppb */
+} resample_ratio[] = {
+  { 44100U, 48000U, 160U, 32U, 0 },         /* rational 160/147 */
+  { 48000U, 44100U, 147U, 32U, 0 },         /* rational 147/160 */
+  { 48000U, 16000U,   1U, 96U, 0 },         /* decimation by 3 */
+  { 48000U, 44100U,  64U, 32U, 0 },         /* fractional, interpolated phases */
+  { 44100U, 48000U, 160U, 32U, 100000 },    /* rational with 100 ppm drift */
+};
+
+/* Modified Bessel function of order 0, for the Kaiser window */
+static float64_t bessel_i0(float64_t x)
+{
+  float64_t sum = 1.0, term = 1.0;
+  uint32_t k;
+
+  for (k = 1; k < 32; k++)
+  {
+    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+    sum += term;
+  }
+  return sum;
+}
+
+/* Kaiser windowed sinc, cut-off at fc * fs, gain at DC */
+static void resample_design(float64_t *h, uint32_t taps, float64_t fc, float64_t gain)
+{
+  const float64_t beta = 9.0;
+  float64_t sum = 0.0, t, r;
+  uint32_t i;
+
+  for (i = 0; i < taps; i++)
+  {
+    t = (float64_t)i - ((float64_t)(taps - 1U) / 2.0);
+    r = (2.0 * t) / (float64_t)taps;
+    h[i] = bessel_i0(beta * sqrt(1.0 - (r * r))) / bessel_i0(beta);
+    h[i] *= (t == 0.0) ? (2.0 * fc) : (sin(2.0 * 3.14159265358979323846 * fc * t) / (3.14159265358979323846 * t));
+    sum += h[i];
+  }
+  for (i = 0; i < taps; i++)
+  {
+    h[i] *= gain / sum;
+  }
+}
+
+static arm_status resample_setup(dsp_bench_case *c)
+{
+  const uint32_t r = c->variant >> 16;
+  const uint32_t fsIn = resample_ratio[r].fsIn;
+  const uint32_t fsOut = resample_ratio[r].fsOut;
+  const uint32_t L = resample_ratio[r].numPhases;
+  const uint32_t P = resample_ratio[r].phaseLength;
+  const int chain = (c->variant & RESAMPLE_CHAIN) != 0U;
+  const uint32_t outMax = ARM_RESAMPLE_OUT_MAX(c->n, fsIn, fsOut);
+  const float64_t w0 = (2.0 * 3.14159265358979323846 * RESAMPLE_TONE) / fsIn;
+  const float64_t delay = ((float64_t)(L * P) - 1.0) / 2.0;
+  filter_ctx *ctx;
+  arm_resample_clock *clk = NULL;
+  float64_t step, offset, gain;
+  uint64_t count, k;
+  uint32_t i;
+  arm_status status;
+
+  if (chain && (((c->n % ((L * fsIn) / fsOut)) != 0U) || (L > 255U)))
+  {
+    /* The decimator needs whole output blocks: n a multiple of 147 for 160/147 */
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  ctx = filter_alloc(c, (c->n > outMax) ? c->n : outMax, L * P, P + c->n);
+  for (i = 0; i < c->n; i++)
+  {
+    ctx->x[i] = RESAMPLE_AMPL * sin(w0 * i);
+  }
+  dsp_bench_quantize(ctx->type, ctx->x, ctx->src, c->n);
+
+  /* Lowpass at 0.45 of the lower rate, in units of the upsampled rate, time reversed */
+  resample_design(ctx->h, L * P, (0.45 * ((fsIn < fsOut) ? fsIn : fsOut)) / ((float64_t)L * fsIn), (float64_t)L);
+  fir_store(ctx->type, ctx->h, ctx->coeffs, L * P);
+
+  if (chain)
+  {
+    /* Every sample of the upsampled signal, the decimator keeps one in M */
+    const uint32_t M = (L * fsIn) / fsOut;
+    static const float32_t one = 1.0f;
+
+    ctx->table = dsp_bench_alloc(c->n * L * sizeof(float32_t));
+    ctx->planar = dsp_bench_alloc(c->n * L * sizeof(float32_t));
+    arm_fir_interpolate_init_f32(&ctx->S.chain_f32.interp, (uint8_t)L, (uint16_t)(L * P), ctx->coeffs, ctx->state, c->n);
+    status = arm_fir_decimate_init_f32(&ctx->S.chain_f32.decim, 1U, (uint8_t)M, &one, ctx->planar, c->n * L);
+    step = (float64_t)M;
+    offset = 0.0;
+  }
+  else
+  {
+    ctx->table = dsp_bench_alloc(L * P * dsp_bench_type_size(ctx->type));
+    if (ctx->type == DSP_BENCH_Q15)
+    {
+      status = arm_resample_init_q15(&ctx->S.resample_q15, (uint16_t)L, (uint16_t)(L * P), ctx->coeffs, ctx->table,
+                                     ctx->state, fsIn, fsOut, c->n);
+      clk = &ctx->S.resample_q15.clk;
+    }
+    else
+    {
+      status = arm_resample_init_f32(&ctx->S.resample_f32, (uint16_t)L, (uint16_t)(L * P), ctx->coeffs, ctx->table,
+                                     ctx->state, fsIn, fsOut, c->n);
+      clk = &ctx->S.resample_f32.clk;
+    }
+    arm_resample_set_drift(clk, resample_ratio[r].drift);
+    step = (float64_t)clk->step / 4294967296.0;
+    offset = -(float64_t)L;
+  }
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return status;
+  }
+
+  /* Outputs of the first call, the first ones see the zeroed history */
+  count = ((uint64_t)c->n * L) / (uint64_t)step;
+  if (!chain)
+  {
+    /* Outputs until the window passes the last input, phases Q32.32 */
+    count = ((((uint64_t)c->n * L) << 32) + clk->step - 1U) / clk->step;
+  }
+  ctx->skip = (uint32_t)ceil((((float64_t)P * L) - offset) / step);
+  if (count <= ctx->skip)
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+  c->samples = (uint32_t)count;
+  c->outLen = (uint32_t)count - ctx->skip;
+
+  /* Output k is the upsampled signal at k * step + offset */
+  gain = 0.0;
+  for (i = 0; i < L * P; i++)
+  {
+    gain += ctx->h[i] * cos((w0 / L) * ((float64_t)i - delay));
+  }
+  gain /= L;
+  for (k = ctx->skip; k < count; k++)
+  {
+    c->ref[k - ctx->skip] = gain * RESAMPLE_AMPL * sin((w0 / L) * (((float64_t)k * step) + offset - delay));
+  }
+  return ARM_MATH_SUCCESS;
+}
+
+static void resample_result(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  dsp_bench_from(ctx->type, (uint8_t *)ctx->dst + (ctx->skip * dsp_bench_type_size(ctx->type)), c->out, c->outLen, 1.0);
+}
+
+static void resample_run_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_resample_f32(&ctx->S.resample_f32, ctx->src, ctx->dst, c->n);
+}
+
+static void resample_run_q15(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_resample_q15(&ctx->S.resample_q15, ctx->src, ctx->dst, c->n);
+}
+
+static void resample_run_chain_f32(dsp_bench_case *c)
+{
+  filter_ctx *ctx = c->priv;
+
+  arm_fir_interpolate_f32(&ctx->S.chain_f32.interp, ctx->src, ctx->table, c->n);
+  arm_fir_decimate_f32(&ctx->S.chain_f32.decim, ctx->table, ctx->dst, c->n * ctx->S.chain_f32.interp.L);
+}
+
+const dsp_bench_kernel dsp_bench_filtering[] = {
+  { "fir",    "arm_fir_f32",                     120.0, DSP_BENCH_F32, fir_setup, fir_run_f32,      filter_result, filter_teardown },
+  { "fir",    "arm_fir_q31",                     120.0, DSP_BENCH_Q31, fir_setup, fir_run_q31,      filter_result, filter_teardown },
+  { "fir",    "arm_fir_fast_q31",                120.0, DSP_BENCH_Q31, fir_setup, fir_run_fast_q31, filter_result, filter_teardown },
+  { "fir",    "arm_fir_q15",                      65.0, DSP_BENCH_Q15, fir_setup, fir_run_q15,      filter_result, filter_teardown },
+  { "fir",    "arm_fir_fast_q15",                 65.0, DSP_BENCH_Q15, fir_setup, fir_run_fast_q15, filter_result, filter_teardown },
+  { "firlong", "arm_fir_f32",                    110.0, DSP_BENCH_F32, firlong_setup, firlong_run_f32, filter_result, filter_teardown },
+  { "firlong", "arm_fir_fft_f32",                110.0, DSP_BENCH_F32 | FIR_FFT, firlong_setup, firlong_run_fft_f32, filter_result, filter_teardown },
+  { "firlong", "arm_fir_fft_f32_uneven",         110.0, DSP_BENCH_F32 | FIR_FFT, firlong_setup, firlong_run_fft_uneven_f32, filter_result, filter_teardown },
+  { "biquad", "arm_biquad_cascade_df1_f32",      120.0, DSP_BENCH_F32, biquad_setup, biquad_run_df1_f32, filter_result, filter_teardown },
+  { "biquad", "arm_biquad_cascade_df2T_f32",     120.0, DSP_BENCH_F32 | BIQUAD_DF2T, biquad_setup, biquad_run_df2T_f32, filter_result, filter_teardown },
+  { "biquad", "arm_biquad_cascade_df1_q31",      120.0, DSP_BENCH_Q31, biquad_setup, biquad_run_df1_q31, filter_result, filter_teardown },
+  { "biquad", "arm_biquad_cascade_df1_fast_q31", 120.0, DSP_BENCH_Q31, biquad_setup, biquad_run_df1_fast_q31, filter_result, filter_teardown },
+  { "biquad", "arm_biquad_cascade_df1_q15",       50.0, DSP_BENCH_Q15, biquad_setup, biquad_run_df1_q15, filter_result, filter_teardown },
+  { "biquad", "arm_biquad_cascade_df1_fast_q15",  50.0, DSP_BENCH_Q15, biquad_setup, biquad_run_df1_fast_q15, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_5taps",                   120.0, DSP_BENCH_F32 | FIXED(5), fixed_setup, fir_run_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_fixed_5taps",             120.0, DSP_BENCH_F32 | FIXED_SIZE | FIXED(5), fixed_setup, fixed_run_fir_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_8taps",                   120.0, DSP_BENCH_F32 | FIXED(8), fixed_setup, fir_run_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_fixed_8taps",             120.0, DSP_BENCH_F32 | FIXED_SIZE | FIXED(8), fixed_setup, fixed_run_fir_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_16taps",                  120.0, DSP_BENCH_F32 | FIXED(16), fixed_setup, fir_run_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_fixed_16taps",            120.0, DSP_BENCH_F32 | FIXED_SIZE | FIXED(16), fixed_setup, fixed_run_fir_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_32taps",                  120.0, DSP_BENCH_F32 | FIXED(32), fixed_setup, fir_run_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_fixed_32taps",            120.0, DSP_BENCH_F32 | FIXED_SIZE | FIXED(32), fixed_setup, fixed_run_fir_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_64taps",                  120.0, DSP_BENCH_F32 | FIXED(64), fixed_setup, fir_run_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_fir_f32_fixed_64taps",            120.0, DSP_BENCH_F32 | FIXED_SIZE | FIXED(64), fixed_setup, fixed_run_fir_f32, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_2st",      120.0, DSP_BENCH_Q31 | FIXED(2), fixed_setup, biquad_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_fixed_2st", 120.0, DSP_BENCH_Q31 | FIXED_SIZE | FIXED(2), fixed_setup, fixed_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_3st",      120.0, DSP_BENCH_Q31 | FIXED(3), fixed_setup, biquad_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_fixed_3st", 120.0, DSP_BENCH_Q31 | FIXED_SIZE | FIXED(3), fixed_setup, fixed_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_4st",      120.0, DSP_BENCH_Q31 | FIXED(4), fixed_setup, biquad_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_fixed_4st", 120.0, DSP_BENCH_Q31 | FIXED_SIZE | FIXED(4), fixed_setup, fixed_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_6st",      120.0, DSP_BENCH_Q31 | FIXED(6), fixed_setup, biquad_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_fixed_6st", 120.0, DSP_BENCH_Q31 | FIXED_SIZE | FIXED(6), fixed_setup, fixed_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_8st",      120.0, DSP_BENCH_Q31 | FIXED(8), fixed_setup, biquad_run_df1_q31, filter_result, filter_teardown },
+  { "fixed",  "arm_biquad_cascade_df1_q31_fixed_8st", 120.0, DSP_BENCH_Q31 | FIXED_SIZE | FIXED(8), fixed_setup, fixed_run_df1_q31, filter_result, filter_teardown },
+  { "multich", "arm_fir_multi_f32",              120.0, DSP_BENCH_F32 | MULTICH_FIR | MULTICH(8), multich_setup, multich_run_fir_f32, filter_result, filter_teardown },
+  { "multich", "arm_fir_f32_deinterleaved",      120.0, DSP_BENCH_F32 | MULTICH_FIR | MULTICH_SPLIT | MULTICH(8), multich_setup, multich_run_split_f32, filter_result, filter_teardown },
+  { "multich", "arm_fir_multi_f32_6ch",          120.0, DSP_BENCH_F32 | MULTICH_FIR | MULTICH(6), multich_setup, multich_run_fir_f32, filter_result, filter_teardown },
+  { "multich", "arm_biquad_cascade_multi_df2T_f32",     110.0, DSP_BENCH_F32 | MULTICH(8), multich_setup, multich_run_df2T_f32, filter_result, filter_teardown },
+  { "multich", "arm_biquad_cascade_df2T_f32_deinterleaved", 110.0, DSP_BENCH_F32 | MULTICH_SPLIT | MULTICH(8), multich_setup, multich_run_split_f32, filter_result, filter_teardown },
+  { "multich", "arm_biquad_cascade_multi_df2T_f32_6ch", 110.0, DSP_BENCH_F32 | MULTICH(6), multich_setup, multich_run_df2T_f32, filter_result, filter_teardown },
+  { "resample", "arm_resample_f32_44k1_48k",      90.0, DSP_BENCH_F32 | RESAMPLE(0), resample_setup, resample_run_f32, resample_result, filter_teardown },
+  { "resample", "arm_resample_f32_48k_44k1",      90.0, DSP_BENCH_F32 | RESAMPLE(1), resample_setup, resample_run_f32, resample_result, filter_teardown },
+  { "resample", "arm_resample_f32_48k_16k",       90.0, DSP_BENCH_F32 | RESAMPLE(2), resample_setup, resample_run_f32, resample_result, filter_teardown },
+  { "resample", "arm_resample_f32_48k_44k1_frac", 90.0, DSP_BENCH_F32 | RESAMPLE(3), resample_setup, resample_run_f32, resample_result, filter_teardown },
+  { "resample", "arm_resample_f32_44k1_48k_drift", 90.0, DSP_BENCH_F32 | RESAMPLE(4), resample_setup, resample_run_f32, resample_result, filter_teardown },
+  { "resample", "arm_resample_q15_44k1_48k",      80.0, DSP_BENCH_Q15 | RESAMPLE(0), resample_setup, resample_run_q15, resample_result, filter_teardown },
+  { "resample", "arm_resample_q15_48k_44k1_frac", 80.0, DSP_BENCH_Q15 | RESAMPLE(3), resample_setup, resample_run_q15, resample_result, filter_teardown },
+  { "resample", "arm_fir_interpolate_decimate_f32_44k1_48k", 90.0, DSP_BENCH_F32 | RESAMPLE_CHAIN | RESAMPLE(0), resample_setup, resample_run_chain_f32, resample_result, filter_teardown },
+  { NULL, NULL, 0.0, 0, NULL, NULL, NULL, NULL }
+};
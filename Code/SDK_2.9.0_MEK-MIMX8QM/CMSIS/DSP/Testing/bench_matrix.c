@@ -0,0 +1,530 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        bench_matrix.c
+ * Description:  Matrix kernels of the host suite
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "dsp_bench.h"
+
+/*
+ * Block size n is the number of elements of the square result, sizes which
+ * are not a square number are skipped. Inputs of the multiplications are
+ * scaled by 1.8/sqrt(dim), so that no dot product exceeds 0.81 and fixed
+ * point results do not saturate. The matrix inverted is diagonally dominant.
+ *
+ * The solvers compute X = A^-1 * B for dim right-hand sides, A symmetric
+ * positive definite G * G^t / dim + 0.1 * I (condition number about 4).
+ */
+
+/*
+ * Variant flags of the inverse, of the multiplication by a transposed
+ * matrix (B is stored transposed) and of the matrix vector product (the
+ * vector is the first row of B, the result is one column).
+ */
+#define MAT_INVERSE     0x100U
+#define MAT_TRANSB      0x200U
+#define MAT_VEC         0x400U
+
+/*
+ * Variant flags of the linear solvers. The f64 solvers use double buffers and
+ * the F32 type for the comparison.
+ */
+#define MAT_SOLVE       0x800U
+#define MAT_F64         0x1000U
+
+typedef struct
+{
+  dsp_bench_type type;
+  uint16_t dim;
+  void *a;
+  void *b;
+  void *work;
+  void *dst;
+  void *state;
+  void *aux;
+  uint16_t *perm;
+  int f64;
+  union
+  {
+    arm_matrix_instance_f32 f32;
+    arm_matrix_instance_f64 f64;
+    arm_matrix_instance_q31 q31;
+    arm_matrix_instance_q15 q15;
+  } A, B, W, C, S;
+} mat_ctx;
+
+static void mat_instance(mat_ctx *ctx, void *inst, void *data)
+{
+  arm_matrix_instance_f64 *m64 = inst;
+
+  if (ctx->f64)
+  {
+    m64->numRows = ctx->dim;
+    m64->numCols = ctx->dim;
+    m64->pData = data;
+    return;
+  }
+  switch (ctx->type)
+  {
+    case DSP_BENCH_Q31:
+      arm_mat_init_q31(inst, ctx->dim, ctx->dim, data);
+      break;
+    case DSP_BENCH_Q15:
+      arm_mat_init_q15(inst, ctx->dim, ctx->dim, data);
+      break;
+    default:
+      arm_mat_init_f32(inst, ctx->dim, ctx->dim, data);
+      break;
+  }
+}
+
+/* Gauss-Jordan elimination with partial pivoting, a is destroyed */
+static void mat_inverse_reference(float64_t *a, float64_t *inv, uint32_t d)
+{
+  uint32_t i, j, k, p;
+  float64_t t;
+
+  for (i = 0; i < d; i++)
+  {
+    for (j = 0; j < d; j++)
+    {
+      inv[(i * d) + j] = (i == j) ? 1.0 : 0.0;
+    }
+  }
+  for (k = 0; k < d; k++)
+  {
+    p = k;
+    for (i = k + 1U; i < d; i++)
+    {
+      if (fabs(a[(i * d) + k]) > fabs(a[(p * d) + k]))
+      {
+        p = i;
+      }
+    }
+    for (j = 0; j < d; j++)
+    {
+      t = a[(k * d) + j];
+      a[(k * d) + j] = a[(p * d) + j];
+      a[(p * d) + j] = t;
+      t = inv[(k * d) + j];
+      inv[(k * d) + j] = inv[(p * d) + j];
+      inv[(p * d) + j] = t;
+    }
+    t = a[(k * d) + k];
+    for (j = 0; j < d; j++)
+    {
+      a[(k * d) + j] /= t;
+      inv[(k * d) + j] /= t;
+    }
+    for (i = 0; i < d; i++)
+    {
+      if (i != k)
+      {
+        t = a[(i * d) + k];
+        for (j = 0; j < d; j++)
+        {
+          a[(i * d) + j] -= t * a[(k * d) + j];
+          inv[(i * d) + j] -= t * inv[(k * d) + j];
+        }
+      }
+    }
+  }
+}
+
+/* A is symmetric positive definite, the reference is A^-1 * B */
+static void mat_solve_reference(mat_ctx *ctx, dsp_bench_case *c, float64_t *a, float64_t *b)
+{
+  const uint32_t d = ctx->dim;
+  float64_t *g = dsp_bench_alloc(c->n * sizeof(float64_t));
+  float64_t *inv = dsp_bench_alloc(c->n * sizeof(float64_t));
+  float64_t acc;
+  uint32_t i, j, k;
+
+  memcpy(g, a, c->n * sizeof(float64_t));
+  for (i = 0; i < d; i++)
+  {
+    for (j = 0; j < d; j++)
+    {
+      acc = (i == j) ? 0.1 : 0.0;
+      for (k = 0; k < d; k++)
+      {
+        acc += g[(i * d) + k] * g[(j * d) + k] / d;
+      }
+      a[(i * d) + j] = acc;
+    }
+  }
+
+  if (ctx->f64)
+  {
+    memcpy(ctx->a, a, c->n * sizeof(float64_t));
+    memcpy(ctx->b, b, c->n * sizeof(float64_t));
+  }
+  else
+  {
+    dsp_bench_quantize(ctx->type, a, ctx->a, c->n);
+    dsp_bench_quantize(ctx->type, b, ctx->b, c->n);
+  }
+
+  mat_inverse_reference(a, inv, d);
+  for (i = 0; i < d; i++)
+  {
+    for (j = 0; j < d; j++)
+    {
+      acc = 0.0;
+      for (k = 0; k < d; k++)
+      {
+        acc += inv[(i * d) + k] * b[(k * d) + j];
+      }
+      c->ref[(i * d) + j] = acc;
+    }
+  }
+  dsp_bench_free(g);
+  dsp_bench_free(inv);
+}
+
+static arm_status mat_setup(dsp_bench_case *c)
+{
+  const int inverse = (c->variant & MAT_INVERSE) != 0U;
+  uint32_t d = (uint32_t)(sqrt((float64_t)c->n) + 0.5);
+  mat_ctx *ctx;
+  float64_t *a, *b, scale, acc;
+  size_t size;
+  uint32_t i, j, k;
+
+  if (((d * d) != c->n) || (d > 0xFFFFU))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  ctx = dsp_bench_alloc(sizeof(mat_ctx));
+  ctx->type = (dsp_bench_type)(c->variant & 0xFFU);
+  ctx->dim = (uint16_t)d;
+  ctx->f64 = (c->variant & MAT_F64) != 0U;
+  size = ctx->f64 ? sizeof(float64_t) : dsp_bench_type_size(ctx->type);
+  ctx->a = dsp_bench_alloc(c->n * size);
+  ctx->b = dsp_bench_alloc(c->n * size);
+  ctx->work = dsp_bench_alloc(c->n * size);
+  ctx->dst = dsp_bench_alloc(c->n * size);
+  ctx->state = dsp_bench_alloc(c->n * size);
+  ctx->aux = dsp_bench_alloc(d * sizeof(float64_t));
+  ctx->perm = dsp_bench_alloc(d * sizeof(uint16_t));
+  mat_instance(ctx, &ctx->A, ctx->a);
+  mat_instance(ctx, &ctx->B, ctx->b);
+  mat_instance(ctx, &ctx->W, ctx->work);
+  mat_instance(ctx, &ctx->C, ctx->dst);
+  mat_instance(ctx, &ctx->S, ctx->state);
+
+  c->samples = c->n;
+  c->outLen = c->n;
+  c->ref = dsp_bench_alloc(c->n * sizeof(float64_t));
+  c->out = dsp_bench_alloc(c->n * sizeof(float64_t));
+  c->priv = ctx;
+
+  a = dsp_bench_alloc(c->n * sizeof(float64_t));
+  b = dsp_bench_alloc(c->n * sizeof(float64_t));
+  dsp_bench_signal(a, c->n, 0);
+  dsp_bench_signal(b, c->n, 1);
+
+  if ((c->variant & MAT_SOLVE) != 0U)
+  {
+    mat_solve_reference(ctx, c, a, b);
+  }
+  else if (inverse)
+  {
+    for (i = 0; i < d; i++)
+    {
+      for (j = 0; j < d; j++)
+      {
+        a[(i * d) + j] = (i == j) ? 1.0 : (a[(i * d) + j] * 0.5 / d);
+      }
+    }
+    dsp_bench_quantize(ctx->type, a, ctx->a, c->n);
+    mat_inverse_reference(a, c->ref, d);
+  }
+  else
+  {
+    scale = 1.8 / sqrt((float64_t)d);
+    for (i = 0; i < c->n; i++)
+    {
+      a[i] *= scale;
+      b[i] *= scale;
+    }
+    dsp_bench_quantize(ctx->type, a, ctx->a, c->n);
+    dsp_bench_quantize(ctx->type, b, ctx->b, c->n);
+    if ((c->variant & MAT_VEC) != 0U)
+    {
+      for (i = 0; i < d; i++)
+      {
+        acc = 0.0;
+        for (k = 0; k < d; k++)
+        {
+          acc += a[(i * d) + k] * b[k];
+        }
+        c->ref[i] = acc;
+      }
+      c->outLen = d;
+    }
+    else
+    {
+      for (i = 0; i < d; i++)
+      {
+        for (j = 0; j < d; j++)
+        {
+          acc = 0.0;
+          for (k = 0; k < d; k++)
+          {
+            acc += a[(i * d) + k] * b[(k * d) + j];
+          }
+          c->ref[(i * d) + j] = acc;
+        }
+      }
+    }
+    if ((c->variant & MAT_TRANSB) != 0U)
+    {
+      for (i = 0; i < d; i++)
+      {
+        for (j = 0; j < d; j++)
+        {
+          memcpy((uint8_t *)ctx->state + (((j * d) + i) * size), (uint8_t *)ctx->b + (((i * d) + j) * size), size);
+        }
+      }
+      memcpy(ctx->b, ctx->state, c->n * size);
+    }
+  }
+  dsp_bench_free(a);
+  dsp_bench_free(b);
+  return ARM_MATH_SUCCESS;
+}
+
+static void mat_teardown(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  dsp_bench_free(ctx->a);
+  dsp_bench_free(ctx->b);
+  dsp_bench_free(ctx->work);
+  dsp_bench_free(ctx->dst);
+  dsp_bench_free(ctx->state);
+  dsp_bench_free(ctx->aux);
+  dsp_bench_free(ctx->perm);
+  dsp_bench_free(ctx);
+}
+
+static void mat_result(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  if (ctx->f64)
+  {
+    memcpy(c->out, ctx->dst, c->outLen * sizeof(float64_t));
+  }
+  else
+  {
+    dsp_bench_from(ctx->type, ctx->dst, c->out, c->outLen, 1.0);
+  }
+}
+
+static void mat_run_mult_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_f32(&ctx->A.f32, &ctx->B.f32, &ctx->C.f32);
+}
+
+static void mat_run_mult_q31(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_q31(&ctx->A.q31, &ctx->B.q31, &ctx->C.q31);
+}
+
+static void mat_run_mult_fast_q31(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_fast_q31(&ctx->A.q31, &ctx->B.q31, &ctx->C.q31);
+}
+
+static void mat_run_mult_q15(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_q15(&ctx->A.q15, &ctx->B.q15, &ctx->C.q15, ctx->state);
+}
+
+static void mat_run_mult_fast_q15(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_fast_q15(&ctx->A.q15, &ctx->B.q15, &ctx->C.q15, ctx->state);
+}
+
+static void mat_run_mult_blocked_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_blocked_f32(&ctx->A.f32, &ctx->B.f32, &ctx->C.f32);
+}
+
+static void mat_run_mult_blocked_q31(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_blocked_q31(&ctx->A.q31, &ctx->B.q31, &ctx->C.q31);
+}
+
+static void mat_run_mult_blocked_q15(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_blocked_q15(&ctx->A.q15, &ctx->B.q15, &ctx->C.q15);
+}
+
+static void mat_run_mult_transb_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_transb_f32(&ctx->A.f32, &ctx->B.f32, &ctx->C.f32);
+}
+
+static void mat_run_mult_transb_q31(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_transb_q31(&ctx->A.q31, &ctx->B.q31, &ctx->C.q31);
+}
+
+static void mat_run_mult_transb_q15(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_mult_transb_q15(&ctx->A.q15, &ctx->B.q15, &ctx->C.q15);
+}
+
+static void mat_run_vec_mult_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_vec_mult_f32(&ctx->A.f32, ctx->b, ctx->dst);
+}
+
+static void mat_run_vec_mult_q31(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_vec_mult_q31(&ctx->A.q31, ctx->b, ctx->dst);
+}
+
+static void mat_run_vec_mult_q15(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_vec_mult_q15(&ctx->A.q15, ctx->b, ctx->dst);
+}
+
+/* The inverse works in place on its source, restore it first */
+static void mat_run_inverse_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->a, c->n * sizeof(float32_t));
+  arm_mat_inverse_f32(&ctx->W.f32, &ctx->C.f32);
+}
+
+/* The solvers factor a copy of A, as the Kalman update does with its covariance */
+static void mat_run_inverse_mult_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->a, c->n * sizeof(float32_t));
+  arm_mat_inverse_f32(&ctx->W.f32, &ctx->S.f32);
+  arm_mat_mult_f32(&ctx->S.f32, &ctx->B.f32, &ctx->C.f32);
+}
+
+static void mat_run_cholesky_solve_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_cholesky_f32(&ctx->A.f32, &ctx->W.f32);
+  memcpy(ctx->dst, ctx->b, c->n * sizeof(float32_t));
+  arm_mat_cholesky_solve_f32(&ctx->W.f32, &ctx->C.f32);
+}
+
+static void mat_run_ldlt_solve_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_ldlt_f32(&ctx->A.f32, &ctx->W.f32, ctx->aux, ctx->perm);
+  memcpy(ctx->dst, ctx->b, c->n * sizeof(float32_t));
+  arm_mat_ldlt_solve_f32(&ctx->W.f32, ctx->aux, ctx->perm, &ctx->C.f32);
+}
+
+static void mat_run_qr_solve_f32(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_qr_f32(&ctx->A.f32, &ctx->W.f32, ctx->aux);
+  memcpy(ctx->dst, ctx->b, c->n * sizeof(float32_t));
+  arm_mat_qr_solve_f32(&ctx->W.f32, ctx->aux, &ctx->C.f32);
+}
+
+static void mat_run_cholesky_solve_f64(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_cholesky_f64(&ctx->A.f64, &ctx->W.f64);
+  memcpy(ctx->dst, ctx->b, c->n * sizeof(float64_t));
+  arm_mat_cholesky_solve_f64(&ctx->W.f64, &ctx->C.f64);
+}
+
+static void mat_run_ldlt_solve_f64(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_ldlt_f64(&ctx->A.f64, &ctx->W.f64, ctx->aux, ctx->perm);
+  memcpy(ctx->dst, ctx->b, c->n * sizeof(float64_t));
+  arm_mat_ldlt_solve_f64(&ctx->W.f64, ctx->aux, ctx->perm, &ctx->C.f64);
+}
+
+static void mat_run_qr_solve_f64(dsp_bench_case *c)
+{
+  mat_ctx *ctx = c->priv;
+
+  arm_mat_qr_f64(&ctx->A.f64, &ctx->W.f64, ctx->aux);
+  memcpy(ctx->dst, ctx->b, c->n * sizeof(float64_t));
+  arm_mat_qr_solve_f64(&ctx->W.f64, ctx->aux, &ctx->C.f64);
+}
+
+const dsp_bench_kernel dsp_bench_matrix[] = {
+  { "matrix", "arm_mat_mult_f32",      120.0, DSP_BENCH_F32, mat_setup, mat_run_mult_f32,      mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_q31",      120.0, DSP_BENCH_Q31, mat_setup, mat_run_mult_q31,      mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_fast_q31", 120.0, DSP_BENCH_Q31, mat_setup, mat_run_mult_fast_q31, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_q15",       55.0, DSP_BENCH_Q15, mat_setup, mat_run_mult_q15,      mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_fast_q15",  55.0, DSP_BENCH_Q15, mat_setup, mat_run_mult_fast_q15, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_blocked_f32",   120.0, DSP_BENCH_F32, mat_setup, mat_run_mult_blocked_f32, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_blocked_q31",   120.0, DSP_BENCH_Q31, mat_setup, mat_run_mult_blocked_q31, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_blocked_q15",    55.0, DSP_BENCH_Q15, mat_setup, mat_run_mult_blocked_q15, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_transb_f32",    120.0, DSP_BENCH_F32 | MAT_TRANSB, mat_setup, mat_run_mult_transb_f32, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_transb_q31",    120.0, DSP_BENCH_Q31 | MAT_TRANSB, mat_setup, mat_run_mult_transb_q31, mat_result, mat_teardown },
+  { "matrix", "arm_mat_mult_transb_q15",     55.0, DSP_BENCH_Q15 | MAT_TRANSB, mat_setup, mat_run_mult_transb_q15, mat_result, mat_teardown },
+  { "matrix", "arm_mat_vec_mult_f32",       120.0, DSP_BENCH_F32 | MAT_VEC, mat_setup, mat_run_vec_mult_f32, mat_result, mat_teardown },
+  { "matrix", "arm_mat_vec_mult_q31",       120.0, DSP_BENCH_Q31 | MAT_VEC, mat_setup, mat_run_vec_mult_q31, mat_result, mat_teardown },
+  { "matrix", "arm_mat_vec_mult_q15",        55.0, DSP_BENCH_Q15 | MAT_VEC, mat_setup, mat_run_vec_mult_q15, mat_result, mat_teardown },
+  { "matrix", "arm_mat_inverse_f32",   100.0, DSP_BENCH_F32 | MAT_INVERSE, mat_setup, mat_run_inverse_f32, mat_result, mat_teardown },
+  { "solve", "arm_mat_inverse_mult_f32",   100.0, DSP_BENCH_F32 | MAT_SOLVE,            mat_setup, mat_run_inverse_mult_f32,   mat_result, mat_teardown },
+  { "solve", "arm_mat_cholesky_solve_f32", 100.0, DSP_BENCH_F32 | MAT_SOLVE,            mat_setup, mat_run_cholesky_solve_f32, mat_result, mat_teardown },
+  { "solve", "arm_mat_ldlt_solve_f32",     100.0, DSP_BENCH_F32 | MAT_SOLVE,            mat_setup, mat_run_ldlt_solve_f32,     mat_result, mat_teardown },
+  { "solve", "arm_mat_qr_solve_f32",       100.0, DSP_BENCH_F32 | MAT_SOLVE,            mat_setup, mat_run_qr_solve_f32,       mat_result, mat_teardown },
+  { "solve", "arm_mat_cholesky_solve_f64", 250.0, DSP_BENCH_F32 | MAT_SOLVE | MAT_F64,            mat_setup, mat_run_cholesky_solve_f64, mat_result, mat_teardown },
+  { "solve", "arm_mat_ldlt_solve_f64",     250.0, DSP_BENCH_F32 | MAT_SOLVE | MAT_F64,            mat_setup, mat_run_ldlt_solve_f64,     mat_result, mat_teardown },
+  { "solve", "arm_mat_qr_solve_f64",       250.0, DSP_BENCH_F32 | MAT_SOLVE | MAT_F64,            mat_setup, mat_run_qr_solve_f64,       mat_result, mat_teardown },
+  { NULL, NULL, 0.0, 0, NULL, NULL, NULL, NULL }
+};
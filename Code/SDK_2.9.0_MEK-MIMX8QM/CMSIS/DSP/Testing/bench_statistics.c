@@ -0,0 +1,393 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        bench_statistics.c
+ * Description:  Statistics kernels of the host suite
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "dsp_bench.h"
+
+/*
+ * Block size n is the number of input samples, every kernel returns one
+ * value. The variance is the sample variance (divided by n - 1) as in
+ * CMSIS-DSP. Power results are 16.48 (Q31) and 34.30 (Q15) values.
+ * arm_rms_q31() accumulates the squares in 2.62 without guard bits, its input
+ * is scaled by 1/sqrt(n) to keep the sum of squares below 2.
+ *
+ * The fused kernels return mean, variance, standard deviation, RMS, power / n,
+ * minimum and maximum. They are compared with the separate functions called
+ * one after the other, and with the blocks accumulated in two running
+ * statistics of 37 sample chunks, then merged. The Q31 input is scaled as for
+ * arm_rms_q31().
+ */
+
+typedef enum
+{
+  STATS_MEAN,
+  STATS_VAR,
+  STATS_STD,
+  STATS_RMS,
+  STATS_POWER,
+  STATS_MAX,
+  STATS_MIN,
+  STATS_FUSED,
+  STATS_SEPARATE,
+  STATS_MERGE
+} stats_op;
+
+#define STATS_FUSED_LEN   7U
+#define STATS_CHUNK       37U
+
+#define STATS_VARIANT(op, type) (((uint32_t)(op) << 8) | (uint32_t)(type))
+
+typedef struct
+{
+  dsp_bench_type type;
+  stats_op op;
+  void *src;
+  union
+  {
+    float32_t f32;
+    q31_t q31;
+    q15_t q15;
+    q63_t q63;
+  } r;
+  uint32_t index;
+  union
+  {
+    arm_stats_summary_f32 f32;
+    arm_stats_summary_q31 q31;
+    arm_stats_summary_q15 q15;
+  } s;
+  union
+  {
+    arm_stats_instance_f32 f32[2];
+    arm_stats_instance_q31 q31[2];
+    arm_stats_instance_q15 q15[2];
+  } S;
+} stats_ctx;
+
+static arm_status stats_setup(dsp_bench_case *c)
+{
+  stats_ctx *ctx;
+  float64_t *x;
+  float64_t sum = 0.0, sq = 0.0, dev = 0.0, mean, v;
+  uint32_t i;
+
+  /* The sample variance needs two samples */
+  if ((c->n < 2U) && ((c->variant >> 8) >= STATS_FUSED))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  ctx = dsp_bench_alloc(sizeof(stats_ctx));
+  x = dsp_bench_alloc(c->n * sizeof(float64_t));
+  ctx->type = (dsp_bench_type)(c->variant & 0xFFU);
+  ctx->op = (stats_op)(c->variant >> 8);
+  ctx->src = dsp_bench_alloc(c->n * dsp_bench_type_size(ctx->type));
+  dsp_bench_signal(x, c->n, 0);
+  if (((ctx->op == STATS_RMS) || (ctx->op >= STATS_FUSED)) && (ctx->type == DSP_BENCH_Q31))
+  {
+    for (i = 0; i < c->n; i++)
+    {
+      x[i] /= sqrt((float64_t)c->n);
+    }
+  }
+  dsp_bench_quantize(ctx->type, x, ctx->src, c->n);
+
+  c->samples = c->n;
+  c->outLen = (ctx->op >= STATS_FUSED) ? STATS_FUSED_LEN : 1U;
+  c->ref = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  c->out = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  c->priv = ctx;
+
+  for (i = 0; i < c->n; i++)
+  {
+    sum += x[i];
+    sq += x[i] * x[i];
+  }
+  mean = sum / c->n;
+  for (i = 0; i < c->n; i++)
+  {
+    dev += (x[i] - mean) * (x[i] - mean);
+  }
+
+  switch (ctx->op)
+  {
+    case STATS_MEAN:
+      v = mean;
+      break;
+    case STATS_VAR:
+      v = dev / (c->n - 1U);
+      break;
+    case STATS_STD:
+      v = sqrt(dev / (c->n - 1U));
+      break;
+    case STATS_RMS:
+      v = sqrt(sq / c->n);
+      break;
+    case STATS_POWER:
+      v = sq;
+      break;
+    case STATS_FUSED:
+    case STATS_SEPARATE:
+    case STATS_MERGE:
+      c->ref[0] = mean;
+      c->ref[1] = dev / (c->n - 1U);
+      c->ref[2] = sqrt(c->ref[1]);
+      c->ref[3] = sqrt(sq / c->n);
+      c->ref[4] = sq / c->n;
+      c->ref[5] = x[0];
+      c->ref[6] = x[0];
+      for (i = 1; i < c->n; i++)
+      {
+        c->ref[5] = (x[i] < c->ref[5]) ? x[i] : c->ref[5];
+        c->ref[6] = (x[i] > c->ref[6]) ? x[i] : c->ref[6];
+      }
+      dsp_bench_free(x);
+      return ARM_MATH_SUCCESS;
+    case STATS_MAX:
+    case STATS_MIN:
+    default:
+      v = x[0];
+      for (i = 1; i < c->n; i++)
+      {
+        if ((ctx->op == STATS_MAX) ? (x[i] > v) : (x[i] < v))
+        {
+          v = x[i];
+        }
+      }
+      break;
+  }
+  c->ref[0] = v;
+  dsp_bench_free(x);
+  return ARM_MATH_SUCCESS;
+}
+
+static void stats_teardown(dsp_bench_case *c)
+{
+  stats_ctx *ctx = c->priv;
+
+  dsp_bench_free(ctx->src);
+  dsp_bench_free(ctx);
+}
+
+/* Summary in the order of the reference, power divided by n */
+static void stats_result_fused(dsp_bench_case *c)
+{
+  stats_ctx *ctx = c->priv;
+  float64_t *o = c->out;
+
+  switch (ctx->type)
+  {
+    case DSP_BENCH_Q31:
+      o[0] = ctx->s.q31.mean / 2147483648.0;
+      o[1] = ctx->s.q31.var / 2147483648.0;
+      o[2] = ctx->s.q31.std / 2147483648.0;
+      o[3] = ctx->s.q31.rms / 2147483648.0;
+      o[4] = ctx->s.q31.power / 281474976710656.0 / c->n;
+      o[5] = ctx->s.q31.min / 2147483648.0;
+      o[6] = ctx->s.q31.max / 2147483648.0;
+      break;
+    case DSP_BENCH_Q15:
+      o[0] = ctx->s.q15.mean / 32768.0;
+      o[1] = ctx->s.q15.var / 32768.0;
+      o[2] = ctx->s.q15.std / 32768.0;
+      o[3] = ctx->s.q15.rms / 32768.0;
+      o[4] = ctx->s.q15.power / 1073741824.0 / c->n;
+      o[5] = ctx->s.q15.min / 32768.0;
+      o[6] = ctx->s.q15.max / 32768.0;
+      break;
+    default:
+      o[0] = ctx->s.f32.mean;
+      o[1] = ctx->s.f32.var;
+      o[2] = ctx->s.f32.std;
+      o[3] = ctx->s.f32.rms;
+      o[4] = ctx->s.f32.power / c->n;
+      o[5] = ctx->s.f32.min;
+      o[6] = ctx->s.f32.max;
+      break;
+  }
+}
+
+static void stats_result(dsp_bench_case *c)
+{
+  stats_ctx *ctx = c->priv;
+
+  if (ctx->op >= STATS_FUSED)
+  {
+    stats_result_fused(c);
+    return;
+  }
+
+  if (ctx->op == STATS_POWER)
+  {
+    switch (ctx->type)
+    {
+      case DSP_BENCH_Q31:
+        c->out[0] = (float64_t)ctx->r.q63 / 281474976710656.0;
+        return;
+      case DSP_BENCH_Q15:
+        c->out[0] = (float64_t)ctx->r.q63 / 1073741824.0;
+        return;
+      default:
+        break;
+    }
+  }
+  dsp_bench_from(ctx->type, &ctx->r, c->out, 1, 1.0);
+}
+
+#define STATS_RUN(op, type, ...)                                  \
+static void stats_run_##op##_##type(dsp_bench_case *c)            \
+{                                                                 \
+  stats_ctx *ctx = c->priv;                                       \
+                                                                  \
+  arm_##op##_##type(ctx->src, c->n, __VA_ARGS__);                 \
+}
+
+STATS_RUN(mean,  f32, &ctx->r.f32)
+STATS_RUN(mean,  q31, &ctx->r.q31)
+STATS_RUN(mean,  q15, &ctx->r.q15)
+STATS_RUN(var,   f32, &ctx->r.f32)
+STATS_RUN(var,   q31, &ctx->r.q31)
+STATS_RUN(var,   q15, &ctx->r.q15)
+STATS_RUN(std,   f32, &ctx->r.f32)
+STATS_RUN(std,   q31, &ctx->r.q31)
+STATS_RUN(std,   q15, &ctx->r.q15)
+STATS_RUN(rms,   f32, &ctx->r.f32)
+STATS_RUN(rms,   q31, &ctx->r.q31)
+STATS_RUN(rms,   q15, &ctx->r.q15)
+STATS_RUN(power, f32, &ctx->r.f32)
+STATS_RUN(power, q31, &ctx->r.q63)
+STATS_RUN(power, q15, &ctx->r.q63)
+STATS_RUN(max,   f32, &ctx->r.f32, &ctx->index)
+STATS_RUN(max,   q31, &ctx->r.q31, &ctx->index)
+STATS_RUN(max,   q15, &ctx->r.q15, &ctx->index)
+STATS_RUN(min,   f32, &ctx->r.f32, &ctx->index)
+STATS_RUN(min,   q31, &ctx->r.q31, &ctx->index)
+STATS_RUN(min,   q15, &ctx->r.q15, &ctx->index)
+
+#define STATS_RUN_FUSED(type)                                     \
+static void stats_run_fused_##type(dsp_bench_case *c)             \
+{                                                                 \
+  stats_ctx *ctx = c->priv;                                       \
+                                                                  \
+  arm_stats_##type(ctx->src, c->n, &ctx->s.type);                 \
+}
+
+STATS_RUN_FUSED(f32)
+STATS_RUN_FUSED(q31)
+STATS_RUN_FUSED(q15)
+
+/* What the fused kernel replaces: one pass per statistic */
+static void stats_run_separate_f32(dsp_bench_case *c)
+{
+  stats_ctx *ctx = c->priv;
+  arm_stats_summary_f32 *s = &ctx->s.f32;
+
+  arm_mean_f32(ctx->src, c->n, &s->mean);
+  arm_var_f32(ctx->src, c->n, &s->var);
+  arm_std_f32(ctx->src, c->n, &s->std);
+  arm_rms_f32(ctx->src, c->n, &s->rms);
+  arm_power_f32(ctx->src, c->n, &s->power);
+  arm_min_f32(ctx->src, c->n, &s->min, &s->minIndex);
+  arm_max_f32(ctx->src, c->n, &s->max, &s->maxIndex);
+}
+
+static void stats_run_separate_q31(dsp_bench_case *c)
+{
+  stats_ctx *ctx = c->priv;
+  arm_stats_summary_q31 *s = &ctx->s.q31;
+
+  arm_mean_q31(ctx->src, c->n, &s->mean);
+  arm_var_q31(ctx->src, c->n, &s->var);
+  arm_std_q31(ctx->src, c->n, &s->std);
+  arm_rms_q31(ctx->src, c->n, &s->rms);
+  arm_power_q31(ctx->src, c->n, &s->power);
+  arm_min_q31(ctx->src, c->n, &s->min, &s->minIndex);
+  arm_max_q31(ctx->src, c->n, &s->max, &s->maxIndex);
+}
+
+static void stats_run_separate_q15(dsp_bench_case *c)
+{
+  stats_ctx *ctx = c->priv;
+  arm_stats_summary_q15 *s = &ctx->s.q15;
+
+  arm_mean_q15(ctx->src, c->n, &s->mean);
+  arm_var_q15(ctx->src, c->n, &s->var);
+  arm_std_q15(ctx->src, c->n, &s->std);
+  arm_rms_q15(ctx->src, c->n, &s->rms);
+  arm_power_q15(ctx->src, c->n, &s->power);
+  arm_min_q15(ctx->src, c->n, &s->min, &s->minIndex);
+  arm_max_q15(ctx->src, c->n, &s->max, &s->maxIndex);
+}
+
+/* Each half in STATS_CHUNK sample blocks, then the second half merged into the first */
+#define STATS_RUN_MERGE(type, T)                                  \
+static void stats_run_merge_##type(dsp_bench_case *c)             \
+{                                                                 \
+  stats_ctx *ctx = c->priv;                                       \
+  const T *src = ctx->src;                                        \
+  uint32_t half = c->n / 2U, i, len;                              \
+                                                                  \
+  arm_stats_init_##type(&ctx->S.type[0]);                         \
+  arm_stats_init_##type(&ctx->S.type[1]);                         \
+  for (i = 0; i < c->n; i += len)                                 \
+  {                                                               \
+    len = (i < half) ? (half - i) : (c->n - i);                   \
+    len = (len < STATS_CHUNK) ? len : STATS_CHUNK;                \
+    arm_stats_accumulate_##type(&ctx->S.type[(i < half) ? 0 : 1], \
+                                src + i, len);                    \
+  }                                                               \
+  arm_stats_merge_##type(&ctx->S.type[0], &ctx->S.type[1]);       \
+  arm_stats_get_##type(&ctx->S.type[0], &ctx->s.type);            \
+}
+
+STATS_RUN_MERGE(f32, float32_t)
+STATS_RUN_MERGE(q31, q31_t)
+STATS_RUN_MERGE(q15, q15_t)
+
+#define STATS_KERNEL(op, OP, type, TYPE, snr) \
+  { "stats", "arm_" #op "_" #type, snr, STATS_VARIANT(STATS_##OP, DSP_BENCH_##TYPE), \
+    stats_setup, stats_run_##op##_##type, stats_result, stats_teardown }
+
+const dsp_bench_kernel dsp_bench_statistics[] = {
+  STATS_KERNEL(mean,  MEAN,  f32, F32, 100.0),
+  STATS_KERNEL(mean,  MEAN,  q31, Q31,  70.0),
+  STATS_KERNEL(mean,  MEAN,  q15, Q15,  20.0),
+  STATS_KERNEL(var,   VAR,   f32, F32, 100.0),
+  STATS_KERNEL(var,   VAR,   q31, Q31,  80.0),
+  STATS_KERNEL(var,   VAR,   q15, Q15,  40.0),
+  STATS_KERNEL(std,   STD,   f32, F32, 100.0),
+  STATS_KERNEL(std,   STD,   q31, Q31,  80.0),
+  STATS_KERNEL(std,   STD,   q15, Q15,  40.0),
+  STATS_KERNEL(rms,   RMS,   f32, F32, 100.0),
+  STATS_KERNEL(rms,   RMS,   q31, Q31,  80.0),
+  STATS_KERNEL(rms,   RMS,   q15, Q15,  40.0),
+  STATS_KERNEL(power, POWER, f32, F32, 100.0),
+  STATS_KERNEL(power, POWER, q31, Q31,  80.0),
+  STATS_KERNEL(power, POWER, q15, Q15,  80.0),
+  STATS_KERNEL(max,   MAX,   f32, F32, DSP_BENCH_SNR_EXACT),
+  STATS_KERNEL(max,   MAX,   q31, Q31, DSP_BENCH_SNR_EXACT),
+  STATS_KERNEL(max,   MAX,   q15, Q15, DSP_BENCH_SNR_EXACT),
+  STATS_KERNEL(min,   MIN,   f32, F32, DSP_BENCH_SNR_EXACT),
+  STATS_KERNEL(min,   MIN,   q31, Q31, DSP_BENCH_SNR_EXACT),
+  STATS_KERNEL(min,   MIN,   q15, Q15, DSP_BENCH_SNR_EXACT),
+  { "stats", "arm_stats_f32",          100.0, STATS_VARIANT(STATS_FUSED,    DSP_BENCH_F32), stats_setup, stats_run_fused_f32,    stats_result, stats_teardown },
+  { "stats", "arm_stats_q31",           80.0, STATS_VARIANT(STATS_FUSED,    DSP_BENCH_Q31), stats_setup, stats_run_fused_q31,    stats_result, stats_teardown },
+  { "stats", "arm_stats_q15",           40.0, STATS_VARIANT(STATS_FUSED,    DSP_BENCH_Q15), stats_setup, stats_run_fused_q15,    stats_result, stats_teardown },
+  { "stats", "arm_stats_separate_f32", 100.0, STATS_VARIANT(STATS_SEPARATE, DSP_BENCH_F32), stats_setup, stats_run_separate_f32, stats_result, stats_teardown },
+  { "stats", "arm_stats_separate_q31",  80.0, STATS_VARIANT(STATS_SEPARATE, DSP_BENCH_Q31), stats_setup, stats_run_separate_q31, stats_result, stats_teardown },
+  { "stats", "arm_stats_separate_q15",  40.0, STATS_VARIANT(STATS_SEPARATE, DSP_BENCH_Q15), stats_setup, stats_run_separate_q15, stats_result, stats_teardown },
+  { "stats", "arm_stats_merge_f32",    100.0, STATS_VARIANT(STATS_MERGE,    DSP_BENCH_F32), stats_setup, stats_run_merge_f32,    stats_result, stats_teardown },
+  { "stats", "arm_stats_merge_q31",     80.0, STATS_VARIANT(STATS_MERGE,    DSP_BENCH_Q31), stats_setup, stats_run_merge_q31,    stats_result, stats_teardown },
+  { "stats", "arm_stats_merge_q15",     40.0, STATS_VARIANT(STATS_MERGE,    DSP_BENCH_Q15), stats_setup, stats_run_merge_q15,    stats_result, stats_teardown },
+  { NULL, NULL, 0.0, 0, NULL, NULL, NULL, NULL }
+};
@@ -0,0 +1,941 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        bench_transform.c
+ * Description:  FFT kernels of the host suite
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "dsp_bench.h"
+#include "arm_const_structs.h"
+
+/*
+ * The transforms work in place, every run restores the input first. The
+ * copy is part of the measured time, it is small against N log N.
+ * Block size n is the transform length, complex transforms take n complex
+ * samples, real transforms n real samples and their first n/2 + 1 bins are
+ * compared. Fixed point transforms scale the output down by n.
+ * The padded kernels measure the power of two transforms on a frame of n
+ * samples padded with zeros, as used for lengths arm_cfft_f32() does not
+ * support, their output is compared with the DFT of the padded frame.
+ */
+
+/* Variant flags: real transform, mixed radix transform, zero padded frame */
+#define FFT_REAL        0x100U
+#define FFT_MIXED       0x200U
+#define FFT_PAD         0x400U
+
+typedef struct
+{
+  dsp_bench_type type;
+  uint32_t len;
+  void *src;
+  void *work;
+  void *dst;
+  const void *cfft;
+  float32_t *twiddle;
+  float32_t *scratch;
+  union
+  {
+    arm_rfft_fast_instance_f32 rfft_f32;
+    arm_rfft_instance_q31 rfft_q31;
+    arm_rfft_instance_q15 rfft_q15;
+    arm_cfft_mixed_instance_f32 cfft_mixed;
+    arm_rfft_mixed_instance_f32 rfft_mixed;
+  } S;
+} fft_ctx;
+
+static const arm_cfft_instance_f32 *fft_cfft_f32(uint32_t n)
+{
+  switch (n)
+  {
+    case 16:   return &arm_cfft_sR_f32_len16;
+    case 32:   return &arm_cfft_sR_f32_len32;
+    case 64:   return &arm_cfft_sR_f32_len64;
+    case 128:  return &arm_cfft_sR_f32_len128;
+    case 256:  return &arm_cfft_sR_f32_len256;
+    case 512:  return &arm_cfft_sR_f32_len512;
+    case 1024: return &arm_cfft_sR_f32_len1024;
+    case 2048: return &arm_cfft_sR_f32_len2048;
+    case 4096: return &arm_cfft_sR_f32_len4096;
+    default:   return NULL;
+  }
+}
+
+static const arm_cfft_instance_q31 *fft_cfft_q31(uint32_t n)
+{
+  switch (n)
+  {
+    case 16:   return &arm_cfft_sR_q31_len16;
+    case 32:   return &arm_cfft_sR_q31_len32;
+    case 64:   return &arm_cfft_sR_q31_len64;
+    case 128:  return &arm_cfft_sR_q31_len128;
+    case 256:  return &arm_cfft_sR_q31_len256;
+    case 512:  return &arm_cfft_sR_q31_len512;
+    case 1024: return &arm_cfft_sR_q31_len1024;
+    case 2048: return &arm_cfft_sR_q31_len2048;
+    case 4096: return &arm_cfft_sR_q31_len4096;
+    default:   return NULL;
+  }
+}
+
+static const arm_cfft_instance_q15 *fft_cfft_q15(uint32_t n)
+{
+  switch (n)
+  {
+    case 16:   return &arm_cfft_sR_q15_len16;
+    case 32:   return &arm_cfft_sR_q15_len32;
+    case 64:   return &arm_cfft_sR_q15_len64;
+    case 128:  return &arm_cfft_sR_q15_len128;
+    case 256:  return &arm_cfft_sR_q15_len256;
+    case 512:  return &arm_cfft_sR_q15_len512;
+    case 1024: return &arm_cfft_sR_q15_len1024;
+    case 2048: return &arm_cfft_sR_q15_len2048;
+    case 4096: return &arm_cfft_sR_q15_len4096;
+    default:   return NULL;
+  }
+}
+
+/* DFT of n complex (interleaved) samples, bins 0 .. bins-1 */
+static void fft_reference(const float64_t *x, uint32_t n, float64_t *dst, uint32_t bins)
+{
+  float64_t *cs = dsp_bench_alloc(2U * n * sizeof(float64_t));
+  float64_t re, im;
+  uint32_t j, k, idx;
+
+  for (j = 0; j < n; j++)
+  {
+    cs[2U * j] = cos((2.0 * PI * j) / n);
+    cs[(2U * j) + 1U] = sin((2.0 * PI * j) / n);
+  }
+  for (k = 0; k < bins; k++)
+  {
+    re = 0.0;
+    im = 0.0;
+    for (j = 0, idx = 0; j < n; j++)
+    {
+      re += (x[2U * j] * cs[2U * idx]) + (x[(2U * j) + 1U] * cs[(2U * idx) + 1U]);
+      im += (x[(2U * j) + 1U] * cs[2U * idx]) - (x[2U * j] * cs[(2U * idx) + 1U]);
+      idx += k;
+      if (idx >= n)
+      {
+        idx -= n;
+      }
+    }
+    dst[2U * k] = re;
+    dst[(2U * k) + 1U] = im;
+  }
+  dsp_bench_free(cs);
+}
+
+static arm_status fft_setup(dsp_bench_case *c)
+{
+  const int real = (c->variant & FFT_REAL) != 0U;
+  uint32_t n = c->n;
+  uint32_t inLen;
+  fft_ctx *ctx;
+  float64_t *x, *cx;
+  arm_status status = ARM_MATH_SUCCESS;
+  size_t size;
+  uint32_t i;
+
+  if ((c->variant & FFT_PAD) != 0U)
+  {
+    /* Next power of two, lengths which need no padding are measured by the plain kernels */
+    for (n = 1U; (n < c->n) && (n < 0x80000000U); n <<= 1)
+    {
+    }
+    if (n == c->n)
+    {
+      return ARM_MATH_LENGTH_ERROR;
+    }
+  }
+  inLen = real ? n : (2U * n);
+
+  ctx = dsp_bench_alloc(sizeof(fft_ctx));
+  ctx->type = (dsp_bench_type)(c->variant & 0xFFU);
+  ctx->len = n;
+  switch ((uint32_t)c->variant & ~FFT_PAD)
+  {
+    case DSP_BENCH_F32:
+      ctx->cfft = fft_cfft_f32(n);
+      break;
+    case DSP_BENCH_Q31:
+      ctx->cfft = fft_cfft_q31(n);
+      break;
+    case DSP_BENCH_Q15:
+      ctx->cfft = fft_cfft_q15(n);
+      break;
+    case DSP_BENCH_F32 | FFT_REAL:
+      status = (n <= 0xFFFFU) ? arm_rfft_fast_init_f32(&ctx->S.rfft_f32, (uint16_t)n) : ARM_MATH_ARGUMENT_ERROR;
+      break;
+    case DSP_BENCH_Q31 | FFT_REAL:
+      status = arm_rfft_init_q31(&ctx->S.rfft_q31, n, 0, 1);
+      break;
+    case DSP_BENCH_Q15 | FFT_REAL:
+      status = arm_rfft_init_q15(&ctx->S.rfft_q15, n, 0, 1);
+      break;
+    case DSP_BENCH_F32 | FFT_MIXED:
+      ctx->twiddle = dsp_bench_alloc(ARM_CFFT_MIXED_TWIDDLE_LEN(n) * sizeof(float32_t));
+      ctx->scratch = dsp_bench_alloc(ARM_CFFT_MIXED_SCRATCH_LEN(n) * sizeof(float32_t));
+      status = arm_cfft_mixed_init_f32(&ctx->S.cfft_mixed, n, ctx->twiddle, ctx->scratch);
+      ctx->cfft = &ctx->S.cfft_mixed;
+      break;
+    case DSP_BENCH_F32 | FFT_MIXED | FFT_REAL:
+      ctx->twiddle = dsp_bench_alloc(ARM_RFFT_MIXED_TWIDDLE_LEN(n) * sizeof(float32_t));
+      ctx->scratch = dsp_bench_alloc(ARM_RFFT_MIXED_SCRATCH_LEN(n) * sizeof(float32_t));
+      status = arm_rfft_mixed_init_f32(&ctx->S.rfft_mixed, n, ctx->twiddle, ctx->scratch);
+      break;
+    default:
+      status = ARM_MATH_ARGUMENT_ERROR;
+      break;
+  }
+  if ((status != ARM_MATH_SUCCESS) || (!real && (ctx->cfft == NULL)))
+  {
+    dsp_bench_free(ctx->twiddle);
+    dsp_bench_free(ctx->scratch);
+    dsp_bench_free(ctx);
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  size = dsp_bench_type_size(ctx->type);
+  ctx->src = dsp_bench_alloc(inLen * size);
+  ctx->work = dsp_bench_alloc(inLen * size);
+  ctx->dst = dsp_bench_alloc(((2U * n) + 2U) * size);
+
+  /* c->n samples of signal, zeros up to the transform length */
+  x = dsp_bench_alloc(inLen * sizeof(float64_t));
+  dsp_bench_signal(x, real ? c->n : (2U * c->n), 0);
+  dsp_bench_quantize(ctx->type, x, ctx->src, inLen);
+
+  c->samples = c->n;
+  c->outLen = real ? (n + 2U) : (2U * n);
+  c->ref = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  c->out = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  c->priv = ctx;
+
+  if (real)
+  {
+    cx = dsp_bench_alloc(2U * n * sizeof(float64_t));
+    for (i = 0; i < n; i++)
+    {
+      cx[2U * i] = x[i];
+    }
+    fft_reference(cx, n, c->ref, (n / 2U) + 1U);
+    dsp_bench_free(cx);
+  }
+  else
+  {
+    fft_reference(x, n, c->ref, n);
+  }
+  dsp_bench_free(x);
+  return ARM_MATH_SUCCESS;
+}
+
+static void fft_teardown(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  dsp_bench_free(ctx->src);
+  dsp_bench_free(ctx->work);
+  dsp_bench_free(ctx->dst);
+  dsp_bench_free(ctx->twiddle);
+  dsp_bench_free(ctx->scratch);
+  dsp_bench_free(ctx);
+}
+
+static void cfft_result(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  dsp_bench_from(ctx->type, ctx->work, c->out, c->outLen, (ctx->type == DSP_BENCH_F32) ? 1.0 : (float64_t)ctx->len);
+}
+
+static void rfft_result(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  dsp_bench_from(ctx->type, ctx->dst, c->out, c->outLen, (ctx->type == DSP_BENCH_F32) ? 1.0 : (float64_t)ctx->len);
+}
+
+/* arm_rfft_fast_f32() and arm_rfft_mixed_f32() pack the real Nyquist bin into the imaginary part of bin 0 */
+static void rfft_fast_result(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  dsp_bench_from_f32(ctx->dst, c->out, ctx->len);
+  c->out[ctx->len] = c->out[1];
+  c->out[ctx->len + 1U] = 0.0;
+  c->out[1] = 0.0;
+}
+
+static void cfft_run_f32(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, 2U * ctx->len * sizeof(float32_t));
+  arm_cfft_f32(ctx->cfft, ctx->work, 0, 1);
+}
+
+static void cfft_run_q31(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, 2U * ctx->len * sizeof(q31_t));
+  arm_cfft_q31(ctx->cfft, ctx->work, 0, 1);
+}
+
+static void cfft_run_q15(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, 2U * ctx->len * sizeof(q15_t));
+  arm_cfft_q15(ctx->cfft, ctx->work, 0, 1);
+}
+
+static void rfft_run_fast_f32(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, ctx->len * sizeof(float32_t));
+  arm_rfft_fast_f32(&ctx->S.rfft_f32, ctx->work, ctx->dst, 0);
+}
+
+static void cfft_run_mixed_f32(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, 2U * ctx->len * sizeof(float32_t));
+  arm_cfft_mixed_f32(&ctx->S.cfft_mixed, ctx->work, 0);
+}
+
+static void rfft_run_mixed_f32(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, ctx->len * sizeof(float32_t));
+  arm_rfft_mixed_f32(&ctx->S.rfft_mixed, ctx->work, ctx->dst, 0);
+}
+
+static void rfft_run_q31(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, ctx->len * sizeof(q31_t));
+  arm_rfft_q31(&ctx->S.rfft_q31, ctx->work, ctx->dst);
+}
+
+static void rfft_run_q15(dsp_bench_case *c)
+{
+  fft_ctx *ctx = c->priv;
+
+  memcpy(ctx->work, ctx->src, ctx->len * sizeof(q15_t));
+  arm_rfft_q15(&ctx->S.rfft_q15, ctx->work, ctx->dst);
+}
+
+/*
+ * MFCC front end: n is the FFT length and the frame length, frames overlap by
+ * half a frame. A run takes MFCC_FRAMES hops of input, one hop at a time as
+ * they would arrive, and computes MFCC_COEFFS coefficients of MFCC_FILTERS
+ * mel filters per frame, so the throughput column is in Mframes/s. The state
+ * is primed with the end of the input, every run sees the same frames.
+ * The stitched kernel is the same chain written with the FFT, magnitude and
+ * matrix functions: a power spectrum buffer and a dense filterbank matrix.
+ * The bytes column is the state, tables and buffers of each chain.
+ */
+#define MFCC_FRAMES         16U
+#define MFCC_FILTERS        40U
+#define MFCC_COEFFS         13U
+#define MFCC_SAMPLE_RATE    16000.0f
+#define MFCC_F_MIN          20.0f
+#define MFCC_F_MAX          8000.0f
+
+/* Variant flag: hand written chain */
+#define MFCC_STITCHED       0x100U
+
+typedef struct
+{
+  dsp_bench_type type;
+  uint32_t fftLen;
+  uint32_t hop;
+  void *src;
+  void *window;
+  void *state;
+  void *scratch;
+  void *spectrum;
+  void *melScratch;
+  void *dst;
+  uint16_t *start;
+  uint16_t *length;
+  void *weights;
+  void *dct;
+  float32_t *power;
+  float32_t *dense;
+  arm_matrix_instance_f32 denseMat;
+  arm_rfft_fast_instance_f32 rfft;
+  union
+  {
+    arm_stft_instance_f32 f32;
+    arm_stft_instance_q15 q15;
+  } stft;
+  union
+  {
+    arm_mel_filterbank_instance_f32 f32;
+    arm_mel_filterbank_instance_q15 q15;
+  } mel;
+  union
+  {
+    arm_mfcc_instance_f32 f32;
+    arm_mfcc_instance_q15 q15;
+  } mfcc;
+} mfcc_ctx;
+
+/* Mel filterbank of arm_mel_filterbank_init_f32(), dense, bins 0 .. n/2 */
+static void mfcc_reference_filters(uint32_t n, float64_t *dense)
+{
+  const uint32_t bins = (n / 2U) + 1U;
+  float64_t melMin = 2595.0 * log10(1.0 + (MFCC_F_MIN / 700.0));
+  float64_t melMax = 2595.0 * log10(1.0 + (MFCC_F_MAX / 700.0));
+  float64_t edge[MFCC_FILTERS + 2U];
+  float64_t f;
+  uint32_t m, k;
+
+  for (m = 0; m < (MFCC_FILTERS + 2U); m++)
+  {
+    edge[m] = 700.0 * (pow(10.0, (melMin + (((melMax - melMin) * m) / (MFCC_FILTERS + 1U))) / 2595.0) - 1.0);
+  }
+  edge[0] = MFCC_F_MIN;
+  for (m = 0; m < MFCC_FILTERS; m++)
+  {
+    for (k = 0; k < bins; k++)
+    {
+      f = (k * (float64_t)MFCC_SAMPLE_RATE) / n;
+      if ((f > edge[m]) && (f <= edge[m + 1U]))
+      {
+        dense[(m * bins) + k] = (f - edge[m]) / (edge[m + 1U] - edge[m]);
+      }
+      else if ((f > edge[m + 1U]) && (f < edge[m + 2U]))
+      {
+        dense[(m * bins) + k] = (edge[m + 2U] - f) / (edge[m + 2U] - edge[m + 1U]);
+      }
+    }
+  }
+}
+
+/* MFCC of the frames of x, frame f starts at sample f * hop */
+static void mfcc_reference(const float64_t *x, const float64_t *window, uint32_t n, uint32_t hop,
+                           float64_t logOffset, float64_t *dst)
+{
+  const uint32_t bins = (n / 2U) + 1U;
+  float64_t *dense = dsp_bench_alloc(MFCC_FILTERS * bins * sizeof(float64_t));
+  float64_t *cx = dsp_bench_alloc(2U * n * sizeof(float64_t));
+  float64_t *spec = dsp_bench_alloc(2U * bins * sizeof(float64_t));
+  float64_t logMel[MFCC_FILTERS];
+  float64_t acc;
+  uint32_t f, i, m, k;
+
+  mfcc_reference_filters(n, dense);
+  for (f = 0; f < MFCC_FRAMES; f++)
+  {
+    for (i = 0; i < n; i++)
+    {
+      cx[2U * i] = x[(f * hop) + i] * window[i];
+    }
+    fft_reference(cx, n, spec, bins);
+    for (m = 0; m < MFCC_FILTERS; m++)
+    {
+      acc = 0.0;
+      for (k = 0; k < bins; k++)
+      {
+        acc += dense[(m * bins) + k] * ((spec[2U * k] * spec[2U * k]) + (spec[(2U * k) + 1U] * spec[(2U * k) + 1U]));
+      }
+      logMel[m] = log(acc) + logOffset;
+    }
+    for (k = 0; k < MFCC_COEFFS; k++)
+    {
+      acc = 0.0;
+      for (m = 0; m < MFCC_FILTERS; m++)
+      {
+        acc += logMel[m] * cos((PI * k * ((2.0 * m) + 1.0)) / (2.0 * MFCC_FILTERS));
+      }
+      dst[(f * MFCC_COEFFS) + k] = acc * sqrt(((k == 0U) ? 1.0 : 2.0) / MFCC_FILTERS);
+    }
+  }
+  dsp_bench_free(dense);
+  dsp_bench_free(cx);
+  dsp_bench_free(spec);
+}
+
+static void mfcc_teardown(dsp_bench_case *c)
+{
+  mfcc_ctx *ctx = c->priv;
+
+  dsp_bench_free(ctx->src);
+  dsp_bench_free(ctx->window);
+  dsp_bench_free(ctx->state);
+  dsp_bench_free(ctx->scratch);
+  dsp_bench_free(ctx->spectrum);
+  dsp_bench_free(ctx->melScratch);
+  dsp_bench_free(ctx->dst);
+  dsp_bench_free(ctx->start);
+  dsp_bench_free(ctx->length);
+  dsp_bench_free(ctx->weights);
+  dsp_bench_free(ctx->dct);
+  dsp_bench_free(ctx->power);
+  dsp_bench_free(ctx->dense);
+  dsp_bench_free(ctx);
+}
+
+static arm_status mfcc_setup(dsp_bench_case *c)
+{
+  const int stitched = (c->variant & MFCC_STITCHED) != 0U;
+  const uint32_t n = c->n;
+  const uint32_t hop = n / 2U;
+  const uint32_t block = MFCC_FRAMES * hop;
+  const uint32_t bins = (n / 2U) + 1U;
+  mfcc_ctx *ctx;
+  float64_t *x, *w, *filters;
+  arm_status status;
+  size_t size;
+  uint32_t i, weights = 0U;
+
+  if ((n < 32U) || (n > 4096U) || ((n & (n - 1U)) != 0U))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  ctx = dsp_bench_alloc(sizeof(mfcc_ctx));
+  ctx->type = (dsp_bench_type)(c->variant & 0xFFU);
+  ctx->fftLen = n;
+  ctx->hop = hop;
+  c->priv = ctx;
+  size = dsp_bench_type_size(ctx->type);
+
+  /* Input, the frames of a run are preceded by the end of the input */
+  x = dsp_bench_alloc((n + block) * sizeof(float64_t));
+  ctx->src = dsp_bench_alloc(block * size);
+  dsp_bench_signal(x + (n - hop), block, 0);
+  dsp_bench_quantize(ctx->type, x + (n - hop), ctx->src, block);
+  memcpy(x, x + block, (n - hop) * sizeof(float64_t));
+
+  /* Periodic Hann window */
+  w = dsp_bench_alloc(n * sizeof(float64_t));
+  for (i = 0; i < n; i++)
+  {
+    w[i] = 0.5 - (0.5 * cos((2.0 * PI * i) / n));
+  }
+  ctx->window = dsp_bench_alloc(n * size);
+  dsp_bench_quantize(ctx->type, w, ctx->window, n);
+
+  ctx->state = dsp_bench_alloc(n * size);
+  ctx->scratch = dsp_bench_alloc(n * size);
+  ctx->spectrum = dsp_bench_alloc(2U * n * size);
+  ctx->melScratch = dsp_bench_alloc(MFCC_FILTERS * sizeof(q31_t));
+  ctx->dst = dsp_bench_alloc(MFCC_FRAMES * MFCC_COEFFS * size);
+  ctx->start = dsp_bench_alloc(MFCC_FILTERS * sizeof(uint16_t));
+  ctx->length = dsp_bench_alloc(MFCC_FILTERS * sizeof(uint16_t));
+  ctx->weights = dsp_bench_alloc(ARM_MEL_WEIGHTS_MAX(n) * size);
+  ctx->dct = dsp_bench_alloc(MFCC_COEFFS * MFCC_FILTERS * size);
+
+  if (ctx->type == DSP_BENCH_Q15)
+  {
+    status = arm_stft_init_q15(&ctx->stft.q15, (uint16_t)n, (uint16_t)n, (uint16_t)hop, ctx->window, ctx->state);
+    if (status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mel_filterbank_init_q15(&ctx->mel.q15, (uint16_t)n, MFCC_FILTERS, MFCC_SAMPLE_RATE, MFCC_F_MIN, MFCC_F_MAX,
+                                           ctx->start, ctx->length, ctx->weights);
+    }
+    if (status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mfcc_init_q15(&ctx->mfcc.q15, &ctx->mel.q15, MFCC_COEFFS, ctx->dct);
+      (void)arm_stft_q15(&ctx->stft.q15, (const q15_t *)ctx->src + (block - (n - hop)), ctx->spectrum, n - hop, ctx->scratch);
+    }
+  }
+  else
+  {
+    status = arm_stft_init_f32(&ctx->stft.f32, (uint16_t)n, (uint16_t)n, (uint16_t)hop, ctx->window, ctx->state);
+    if (status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mel_filterbank_init_f32(&ctx->mel.f32, (uint16_t)n, MFCC_FILTERS, MFCC_SAMPLE_RATE, MFCC_F_MIN, MFCC_F_MAX,
+                                           ctx->start, ctx->length, ctx->weights);
+    }
+    if (status == ARM_MATH_SUCCESS)
+    {
+      status = arm_mfcc_init_f32(&ctx->mfcc.f32, &ctx->mel.f32, MFCC_COEFFS, ctx->dct);
+      (void)arm_stft_f32(&ctx->stft.f32, (const float32_t *)ctx->src + (block - (n - hop)), ctx->spectrum, n - hop, ctx->scratch);
+    }
+  }
+  if (status != ARM_MATH_SUCCESS)
+  {
+    dsp_bench_free(x);
+    dsp_bench_free(w);
+    mfcc_teardown(c);
+    return ARM_MATH_LENGTH_ERROR;
+  }
+  for (i = 0; i < MFCC_FILTERS; i++)
+  {
+    weights += ctx->length[i];
+  }
+
+  if (stitched)
+  {
+    /* Dense filterbank on a power spectrum, the state holds a whole frame */
+    ctx->power = dsp_bench_alloc(bins * sizeof(float32_t));
+    ctx->dense = dsp_bench_alloc(MFCC_FILTERS * bins * sizeof(float32_t));
+    filters = dsp_bench_alloc(MFCC_FILTERS * bins * sizeof(float64_t));
+    mfcc_reference_filters(n, filters);
+    dsp_bench_quantize_f32(filters, ctx->dense, MFCC_FILTERS * bins);
+    dsp_bench_free(filters);
+    arm_mat_init_f32(&ctx->denseMat, MFCC_FILTERS, (uint16_t)bins, ctx->dense);
+    (void)arm_rfft_fast_init_f32(&ctx->rfft, (uint16_t)n);
+    memcpy(ctx->state, (const float32_t *)ctx->src + (block - (n - hop)), (n - hop) * sizeof(float32_t));
+
+    /* state, window, frame, spectrum, power, dense filterbank, DCT, log energies */
+    c->bytes = (uint32_t)(((4U * n) + ((MFCC_FILTERS + 1U) * bins) + (MFCC_COEFFS * MFCC_FILTERS) + MFCC_FILTERS) * sizeof(float32_t));
+  }
+  else
+  {
+    /* state, window, scratch, one spectrum, weights, DCT, MFCC scratch, bin ranges */
+    c->bytes = (uint32_t)((((3U * n) + ((ctx->type == DSP_BENCH_Q15) ? (2U * n) : n) + weights + (MFCC_COEFFS * MFCC_FILTERS)) * size) +
+                          (MFCC_FILTERS * size * ((ctx->type == DSP_BENCH_Q15) ? 2U : 1U)) + (2U * MFCC_FILTERS * sizeof(uint16_t)));
+  }
+
+  c->samples = MFCC_FRAMES;
+  c->outLen = MFCC_FRAMES * MFCC_COEFFS;
+  c->ref = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  c->out = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+
+  /* The Q15 spectrum is divided by n */
+  mfcc_reference(x, w, n, hop, (ctx->type == DSP_BENCH_Q15) ? (-2.0 * log((float64_t)n)) : 0.0, c->ref);
+  dsp_bench_free(x);
+  dsp_bench_free(w);
+  return ARM_MATH_SUCCESS;
+}
+
+static void mfcc_run_f32(dsp_bench_case *c)
+{
+  mfcc_ctx *ctx = c->priv;
+  const float32_t *pSrc = ctx->src;
+  float32_t *pDst = ctx->dst;
+  uint32_t f;
+
+  for (f = 0; f < MFCC_FRAMES; f++)
+  {
+    if (arm_stft_f32(&ctx->stft.f32, pSrc, ctx->spectrum, ctx->hop, ctx->scratch) != 0U)
+    {
+      arm_mfcc_f32(&ctx->mfcc.f32, ctx->spectrum, pDst, ctx->melScratch);
+      pDst += MFCC_COEFFS;
+    }
+    pSrc += ctx->hop;
+  }
+}
+
+static void mfcc_run_q15(dsp_bench_case *c)
+{
+  mfcc_ctx *ctx = c->priv;
+  const q15_t *pSrc = ctx->src;
+  q15_t *pDst = ctx->dst;
+  uint32_t f;
+
+  for (f = 0; f < MFCC_FRAMES; f++)
+  {
+    if (arm_stft_q15(&ctx->stft.q15, pSrc, ctx->spectrum, ctx->hop, ctx->scratch) != 0U)
+    {
+      arm_mfcc_q15(&ctx->mfcc.q15, ctx->spectrum, pDst, ctx->melScratch);
+      pDst += MFCC_COEFFS;
+    }
+    pSrc += ctx->hop;
+  }
+}
+
+static void mfcc_run_stitched_f32(dsp_bench_case *c)
+{
+  mfcc_ctx *ctx = c->priv;
+  const uint32_t n = ctx->fftLen;
+  const uint32_t hop = ctx->hop;
+  const float32_t *pSrc = ctx->src;
+  float32_t *state = ctx->state;
+  float32_t *frame = ctx->scratch;
+  float32_t *spectrum = ctx->spectrum;
+  float32_t *mel = ctx->melScratch;
+  float32_t *pDst = ctx->dst;
+  uint32_t f, m;
+
+  for (f = 0; f < MFCC_FRAMES; f++)
+  {
+    memcpy(state + (n - hop), pSrc, hop * sizeof(float32_t));
+    pSrc += hop;
+    arm_mult_f32(state, ctx->window, frame, n);
+    memmove(state, state + hop, (n - hop) * sizeof(float32_t));
+
+    arm_rfft_fast_f32(&ctx->rfft, frame, spectrum, 0);
+    arm_cmplx_mag_squared_f32(spectrum, ctx->power, n / 2U);
+    ctx->power[0] = spectrum[0] * spectrum[0];
+    ctx->power[n / 2U] = spectrum[1] * spectrum[1];
+
+    arm_mat_vec_mult_f32(&ctx->denseMat, ctx->power, mel);
+    for (m = 0; m < MFCC_FILTERS; m++)
+    {
+      mel[m] = logf((mel[m] > 1.0e-20f) ? mel[m] : 1.0e-20f);
+    }
+    arm_mat_vec_mult_f32(&ctx->mfcc.f32.dct, mel, pDst);
+    pDst += MFCC_COEFFS;
+  }
+}
+
+static void mfcc_result(dsp_bench_case *c)
+{
+  mfcc_ctx *ctx = c->priv;
+
+  /* Q15 coefficients are in 8.7 format */
+  dsp_bench_from(ctx->type, ctx->dst, c->out, c->outLen, (ctx->type == DSP_BENCH_F32) ? 1.0 : 256.0);
+}
+
+/*
+ * Tone detection: n is the number of bins, a run processes TONE_LEN samples.
+ * The bins are spread over the spectrum of a TONE_LEN point FFT. The
+ * Goertzel kernels return the power of the bins of the block, the FFT
+ * kernel computes the power spectrum of the block and picks the bins, the
+ * sliding DFT kernels update the complex bins at every sample of the block.
+ * ns_per_call against n shows the bin count where the FFT becomes cheaper.
+ */
+#define TONE_LEN            256U
+#define TONE_DAMPING        0.99999f
+
+/* Variant flags: sliding DFT, FFT baseline */
+#define TONE_SDFT           0x100U
+#define TONE_FFT            0x200U
+
+typedef struct
+{
+  dsp_bench_type type;
+  uint32_t numBins;
+  void *src;
+  void *coeffs;
+  void *state;
+  void *delay;
+  void *dst;
+  uint16_t *bins;
+  float32_t *work;
+  float32_t *spectrum;
+  float32_t *power;
+  arm_rfft_fast_instance_f32 rfft;
+  union
+  {
+    arm_goertzel_instance_f32 goertzel_f32;
+    arm_goertzel_instance_q31 goertzel_q31;
+    arm_sdft_instance_f32 sdft_f32;
+    arm_sdft_instance_q31 sdft_q31;
+  } S;
+} tone_ctx;
+
+static void tone_teardown(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+
+  dsp_bench_free(ctx->src);
+  dsp_bench_free(ctx->coeffs);
+  dsp_bench_free(ctx->state);
+  dsp_bench_free(ctx->delay);
+  dsp_bench_free(ctx->dst);
+  dsp_bench_free(ctx->bins);
+  dsp_bench_free(ctx->work);
+  dsp_bench_free(ctx->spectrum);
+  dsp_bench_free(ctx->power);
+  dsp_bench_free(ctx);
+}
+
+static arm_status tone_setup(dsp_bench_case *c)
+{
+  const int sdft = (c->variant & TONE_SDFT) != 0U;
+  const uint32_t numBins = c->n;
+  tone_ctx *ctx;
+  float64_t *x, *cx, *spec;
+  float32_t *freqs;
+  arm_status status;
+  size_t size;
+  uint32_t i, k;
+
+  if (numBins > (TONE_LEN / 2U))
+  {
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  ctx = dsp_bench_alloc(sizeof(tone_ctx));
+  ctx->type = (dsp_bench_type)(c->variant & 0xFFU);
+  ctx->numBins = numBins;
+  c->priv = ctx;
+  size = dsp_bench_type_size(ctx->type);
+
+  x = dsp_bench_alloc(TONE_LEN * sizeof(float64_t));
+  ctx->src = dsp_bench_alloc(TONE_LEN * size);
+  dsp_bench_signal(x, TONE_LEN, 0);
+  dsp_bench_quantize(ctx->type, x, ctx->src, TONE_LEN);
+
+  /* Bins 1 .. TONE_LEN/2, evenly spread */
+  ctx->bins = dsp_bench_alloc(numBins * sizeof(uint16_t));
+  freqs = dsp_bench_alloc(numBins * sizeof(float32_t));
+  for (i = 0; i < numBins; i++)
+  {
+    ctx->bins[i] = (uint16_t)(1U + ((i * (TONE_LEN / 2U)) / numBins));
+    freqs[i] = (float32_t)ctx->bins[i] / TONE_LEN;
+  }
+
+  ctx->coeffs = dsp_bench_alloc(2U * numBins * size);
+  ctx->state = dsp_bench_alloc(2U * numBins * sizeof(q63_t));
+  ctx->dst = dsp_bench_alloc(2U * numBins * size);
+  switch (c->variant)
+  {
+    case DSP_BENCH_F32:
+      status = arm_goertzel_init_f32(&ctx->S.goertzel_f32, (uint16_t)numBins, freqs, ctx->coeffs, ctx->state);
+      break;
+    case DSP_BENCH_Q31:
+      status = arm_goertzel_init_q31(&ctx->S.goertzel_q31, (uint16_t)numBins, freqs, ctx->coeffs, ctx->state);
+      break;
+    case DSP_BENCH_F32 | TONE_SDFT:
+      ctx->delay = dsp_bench_alloc(TONE_LEN * size);
+      status = arm_sdft_init_f32(&ctx->S.sdft_f32, TONE_LEN, (uint16_t)numBins, ctx->bins, TONE_DAMPING,
+                                 ctx->coeffs, ctx->state, ctx->delay);
+      break;
+    case DSP_BENCH_Q31 | TONE_SDFT:
+      ctx->delay = dsp_bench_alloc(TONE_LEN * size);
+      status = arm_sdft_init_q31(&ctx->S.sdft_q31, TONE_LEN, (uint16_t)numBins, ctx->bins, TONE_DAMPING,
+                                 ctx->coeffs, ctx->state, ctx->delay);
+      break;
+    case DSP_BENCH_F32 | TONE_FFT:
+      ctx->work = dsp_bench_alloc(TONE_LEN * sizeof(float32_t));
+      ctx->spectrum = dsp_bench_alloc(TONE_LEN * sizeof(float32_t));
+      ctx->power = dsp_bench_alloc(((TONE_LEN / 2U) + 1U) * sizeof(float32_t));
+      status = arm_rfft_fast_init_f32(&ctx->rfft, TONE_LEN);
+      break;
+    default:
+      status = ARM_MATH_ARGUMENT_ERROR;
+      break;
+  }
+  dsp_bench_free(freqs);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    dsp_bench_free(x);
+    tone_teardown(c);
+    return ARM_MATH_LENGTH_ERROR;
+  }
+
+  /* DFT of the block, the sliding DFT weights sample m by r^(TONE_LEN - m) */
+  cx = dsp_bench_alloc(2U * TONE_LEN * sizeof(float64_t));
+  spec = dsp_bench_alloc((TONE_LEN + 2U) * sizeof(float64_t));
+  for (i = 0; i < TONE_LEN; i++)
+  {
+    cx[2U * i] = sdft ? (x[i] * pow(TONE_DAMPING, (float64_t)(TONE_LEN - i))) : x[i];
+  }
+  fft_reference(cx, TONE_LEN, spec, (TONE_LEN / 2U) + 1U);
+
+  c->samples = TONE_LEN;
+  c->outLen = sdft ? (2U * numBins) : numBins;
+  c->ref = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  c->out = dsp_bench_alloc(c->outLen * sizeof(float64_t));
+  for (i = 0; i < numBins; i++)
+  {
+    k = ctx->bins[i];
+    if (sdft)
+    {
+      c->ref[2U * i] = spec[2U * k];
+      c->ref[(2U * i) + 1U] = spec[(2U * k) + 1U];
+    }
+    else
+    {
+      c->ref[i] = (spec[2U * k] * spec[2U * k]) + (spec[(2U * k) + 1U] * spec[(2U * k) + 1U]);
+    }
+  }
+  dsp_bench_free(cx);
+  dsp_bench_free(spec);
+  dsp_bench_free(x);
+  return ARM_MATH_SUCCESS;
+}
+
+static void tone_run_goertzel_f32(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+
+  arm_goertzel_f32(&ctx->S.goertzel_f32, ctx->src, TONE_LEN);
+  arm_goertzel_power_f32(&ctx->S.goertzel_f32, ctx->dst);
+}
+
+static void tone_run_goertzel_q31(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+
+  arm_goertzel_q31(&ctx->S.goertzel_q31, ctx->src, TONE_LEN);
+  arm_goertzel_power_q31(&ctx->S.goertzel_q31, ctx->dst);
+}
+
+static void tone_run_sdft_f32(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+
+  arm_sdft_f32(&ctx->S.sdft_f32, ctx->src, ctx->dst, TONE_LEN);
+}
+
+static void tone_run_sdft_q31(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+
+  arm_sdft_q31(&ctx->S.sdft_q31, ctx->src, ctx->dst, TONE_LEN);
+}
+
+static void tone_run_fft_f32(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+  float32_t *pDst = ctx->dst;
+  uint32_t i;
+
+  memcpy(ctx->work, ctx->src, TONE_LEN * sizeof(float32_t));
+  arm_rfft_fast_f32(&ctx->rfft, ctx->work, ctx->spectrum, 0);
+  arm_cmplx_mag_squared_f32(ctx->spectrum, ctx->power, TONE_LEN / 2U);
+  ctx->power[0] = ctx->spectrum[0] * ctx->spectrum[0];
+  ctx->power[TONE_LEN / 2U] = ctx->spectrum[1] * ctx->spectrum[1];
+  for (i = 0; i < ctx->numBins; i++)
+  {
+    pDst[i] = ctx->power[ctx->bins[i]];
+  }
+}
+
+static void tone_result(dsp_bench_case *c)
+{
+  tone_ctx *ctx = c->priv;
+  float64_t scale = 1.0;
+
+  /* Q31 power is |X/N|^2, Q31 bins X/N */
+  if (ctx->type == DSP_BENCH_Q31)
+  {
+    scale = ((c->variant & TONE_SDFT) != 0U) ? TONE_LEN : ((float64_t)TONE_LEN * TONE_LEN);
+  }
+  dsp_bench_from(ctx->type, ctx->dst, c->out, c->outLen, scale);
+}
+
+const dsp_bench_kernel dsp_bench_transform[] = {
+  { "fft", "arm_cfft_f32",      110.0, DSP_BENCH_F32, fft_setup, cfft_run_f32, cfft_result, fft_teardown },
+  { "fft", "arm_cfft_q31",       90.0, DSP_BENCH_Q31, fft_setup, cfft_run_q31, cfft_result, fft_teardown },
+  { "fft", "arm_cfft_q15",       30.0, DSP_BENCH_Q15, fft_setup, cfft_run_q15, cfft_result, fft_teardown },
+  { "fft", "arm_rfft_fast_f32", 110.0, DSP_BENCH_F32 | FFT_REAL, fft_setup, rfft_run_fast_f32, rfft_fast_result, fft_teardown },
+  { "fft", "arm_rfft_q31",       90.0, DSP_BENCH_Q31 | FFT_REAL, fft_setup, rfft_run_q31, rfft_result, fft_teardown },
+  { "fft", "arm_rfft_q15",       30.0, DSP_BENCH_Q15 | FFT_REAL, fft_setup, rfft_run_q15, rfft_result, fft_teardown },
+  { "fft", "arm_cfft_mixed_f32", 110.0, DSP_BENCH_F32 | FFT_MIXED, fft_setup, cfft_run_mixed_f32, cfft_result, fft_teardown },
+  { "fft", "arm_rfft_mixed_f32", 110.0, DSP_BENCH_F32 | FFT_MIXED | FFT_REAL, fft_setup, rfft_run_mixed_f32, rfft_fast_result, fft_teardown },
+  { "fft", "arm_cfft_f32_padded",      110.0, DSP_BENCH_F32 | FFT_PAD, fft_setup, cfft_run_f32, cfft_result, fft_teardown },
+  { "fft", "arm_rfft_fast_f32_padded", 110.0, DSP_BENCH_F32 | FFT_REAL | FFT_PAD, fft_setup, rfft_run_fast_f32, rfft_fast_result, fft_teardown },
+  { "mfcc", "arm_mfcc_f32",         110.0, DSP_BENCH_F32, mfcc_setup, mfcc_run_f32, mfcc_result, mfcc_teardown },
+  { "mfcc", "arm_mfcc_stitched_f32", 110.0, DSP_BENCH_F32 | MFCC_STITCHED, mfcc_setup, mfcc_run_stitched_f32, mfcc_result, mfcc_teardown },
+  { "mfcc", "arm_mfcc_q15",          50.0, DSP_BENCH_Q15, mfcc_setup, mfcc_run_q15, mfcc_result, mfcc_teardown },
+  { "tones", "arm_goertzel_f32",       80.0, DSP_BENCH_F32, tone_setup, tone_run_goertzel_f32, tone_result, tone_teardown },
+  { "tones", "arm_goertzel_q31",       90.0, DSP_BENCH_Q31, tone_setup, tone_run_goertzel_q31, tone_result, tone_teardown },
+  { "tones", "arm_sdft_f32",           90.0, DSP_BENCH_F32 | TONE_SDFT, tone_setup, tone_run_sdft_f32, tone_result, tone_teardown },
+  { "tones", "arm_sdft_q31",           90.0, DSP_BENCH_Q31 | TONE_SDFT, tone_setup, tone_run_sdft_q31, tone_result, tone_teardown },
+  { "tones", "arm_rfft_fast_f32_bins", 90.0, DSP_BENCH_F32 | TONE_FFT, tone_setup, tone_run_fft_f32, tone_result, tone_teardown },
+  { NULL, NULL, 0.0, 0, NULL, NULL, NULL, NULL }
+};
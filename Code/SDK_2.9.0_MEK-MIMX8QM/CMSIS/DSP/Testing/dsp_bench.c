@@ -0,0 +1,520 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench.c
+ * Description:  Host accuracy and throughput suite
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Runs every kernel of the selected families for a sweep of block sizes and
+ * prints one CSV line per case: time per call, throughput, cycles per sample
+ * (TSC cycles on x86 hosts, ns elsewhere), SNR and maximum absolute error of
+ * the output against a double precision reference, and the working memory of
+ * the kernel when it reports it. The process exits with
+ * status 1 if any case misses the accuracy gate of its kernel.
+ *
+ * The test signal is white noise, or recorded data (-i, raw little endian
+ * float32 samples) scaled to a peak of 0.5 so that it fits all data types.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dsp_bench.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define DSP_BENCH_CYCLES() ((uint64_t)__rdtsc())
+#define DSP_BENCH_CYCLES_UNIT "cycles"
+#else
+#define DSP_BENCH_CYCLES() dsp_bench_now_ns()
+#define DSP_BENCH_CYCLES_UNIT "ns"
+#endif
+
+#define DSP_BENCH_MAX_SIZES 32
+
+typedef struct
+{
+  const char *name;
+  const dsp_bench_kernel *kernels;
+} dsp_bench_family;
+
+static const dsp_bench_family dsp_bench_families[] = {
+  { "filtering",  dsp_bench_filtering },
+  { "transform",  dsp_bench_transform },
+  { "matrix",     dsp_bench_matrix },
+  { "statistics", dsp_bench_statistics },
+};
+
+static float64_t *dsp_bench_recorded;
+static uint32_t dsp_bench_recorded_len;
+
+static uint64_t dsp_bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+void *dsp_bench_alloc(size_t size)
+{
+  void *p = calloc(1, (size != 0U) ? size : 1U);
+
+  if (p == NULL)
+  {
+    fprintf(stderr, "dsp_bench: out of memory\n");
+    exit(2);
+  }
+  return p;
+}
+
+void dsp_bench_free(void *p)
+{
+  free(p);
+}
+
+/* xorshift64*, independent of rand() and identical on every host */
+static uint64_t dsp_bench_rand(uint64_t *state)
+{
+  uint64_t x = *state;
+
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  *state = x;
+  return x * 0x2545F4914F6CDD1DU;
+}
+
+void dsp_bench_signal(float64_t *dst, uint32_t n, uint32_t stream)
+{
+  uint64_t state = 0x9E3779B97F4A7C15U * (stream + 1U);
+  uint32_t i, offset;
+
+  if (dsp_bench_recorded_len != 0U)
+  {
+    /* Streams start at different places of the recording */
+    offset = (uint32_t)((dsp_bench_rand(&state) >> 11) % dsp_bench_recorded_len);
+    for (i = 0; i < n; i++)
+    {
+      dst[i] = dsp_bench_recorded[(offset + i) % dsp_bench_recorded_len];
+    }
+    return;
+  }
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = ((float64_t)(dsp_bench_rand(&state) >> 11) / 9007199254740992.0) - 0.5;
+  }
+}
+
+void dsp_bench_quantize_f32(float64_t *v, float32_t *dst, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = (float32_t)v[i];
+    v[i] = dst[i];
+  }
+}
+
+void dsp_bench_quantize_q31(float64_t *v, q31_t *dst, uint32_t n)
+{
+  uint32_t i;
+  float64_t x;
+
+  for (i = 0; i < n; i++)
+  {
+    x = v[i] * 2147483648.0;
+    x = (x >= 0.0) ? (x + 0.5) : (x - 0.5);
+    if (x >= 2147483647.0)
+    {
+      dst[i] = INT32_MAX;
+    }
+    else if (x <= -2147483648.0)
+    {
+      dst[i] = INT32_MIN;
+    }
+    else
+    {
+      dst[i] = (q31_t)x;
+    }
+    v[i] = (float64_t)dst[i] / 2147483648.0;
+  }
+}
+
+void dsp_bench_quantize_q15(float64_t *v, q15_t *dst, uint32_t n)
+{
+  uint32_t i;
+  float64_t x;
+
+  for (i = 0; i < n; i++)
+  {
+    x = v[i] * 32768.0;
+    x = (x >= 0.0) ? (x + 0.5) : (x - 0.5);
+    if (x >= 32767.0)
+    {
+      dst[i] = INT16_MAX;
+    }
+    else if (x <= -32768.0)
+    {
+      dst[i] = INT16_MIN;
+    }
+    else
+    {
+      dst[i] = (q15_t)x;
+    }
+    v[i] = (float64_t)dst[i] / 32768.0;
+  }
+}
+
+void dsp_bench_from_f32(const float32_t *src, float64_t *dst, uint32_t n)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = src[i];
+  }
+}
+
+void dsp_bench_from_q31(const q31_t *src, float64_t *dst, uint32_t n, float64_t scale)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = (float64_t)src[i] * (scale / 2147483648.0);
+  }
+}
+
+void dsp_bench_from_q15(const q15_t *src, float64_t *dst, uint32_t n, float64_t scale)
+{
+  uint32_t i;
+
+  for (i = 0; i < n; i++)
+  {
+    dst[i] = (float64_t)src[i] * (scale / 32768.0);
+  }
+}
+
+size_t dsp_bench_type_size(dsp_bench_type type)
+{
+  switch (type)
+  {
+    case DSP_BENCH_Q31:
+      return sizeof(q31_t);
+    case DSP_BENCH_Q15:
+      return sizeof(q15_t);
+    default:
+      return sizeof(float32_t);
+  }
+}
+
+void dsp_bench_quantize(dsp_bench_type type, float64_t *v, void *dst, uint32_t n)
+{
+  switch (type)
+  {
+    case DSP_BENCH_Q31:
+      dsp_bench_quantize_q31(v, (q31_t *)dst, n);
+      break;
+    case DSP_BENCH_Q15:
+      dsp_bench_quantize_q15(v, (q15_t *)dst, n);
+      break;
+    default:
+      dsp_bench_quantize_f32(v, (float32_t *)dst, n);
+      break;
+  }
+}
+
+void dsp_bench_from(dsp_bench_type type, const void *src, float64_t *dst, uint32_t n, float64_t scale)
+{
+  uint32_t i;
+
+  switch (type)
+  {
+    case DSP_BENCH_Q31:
+      dsp_bench_from_q31((const q31_t *)src, dst, n, scale);
+      break;
+    case DSP_BENCH_Q15:
+      dsp_bench_from_q15((const q15_t *)src, dst, n, scale);
+      break;
+    default:
+      dsp_bench_from_f32((const float32_t *)src, dst, n);
+      for (i = 0; i < n; i++)
+      {
+        dst[i] *= scale;
+      }
+      break;
+  }
+}
+
+static int dsp_bench_load(const char *path)
+{
+  FILE *f = fopen(path, "rb");
+  float32_t v;
+  float64_t peak = 0.0;
+  uint32_t i, cap = 4096;
+
+  if (f == NULL)
+  {
+    perror(path);
+    return -1;
+  }
+  dsp_bench_recorded = dsp_bench_alloc(cap * sizeof(float64_t));
+  while (fread(&v, sizeof(v), 1, f) == 1)
+  {
+    if (dsp_bench_recorded_len == cap)
+    {
+      cap *= 2U;
+      dsp_bench_recorded = realloc(dsp_bench_recorded, cap * sizeof(float64_t));
+      if (dsp_bench_recorded == NULL)
+      {
+        fprintf(stderr, "dsp_bench: out of memory\n");
+        exit(2);
+      }
+    }
+    dsp_bench_recorded[dsp_bench_recorded_len++] = v;
+    if (fabs(v) > peak)
+    {
+      peak = fabs(v);
+    }
+  }
+  fclose(f);
+
+  if ((dsp_bench_recorded_len == 0U) || (peak == 0.0) || (peak != peak))
+  {
+    fprintf(stderr, "%s: no usable float32 samples\n", path);
+    return -1;
+  }
+  for (i = 0; i < dsp_bench_recorded_len; i++)
+  {
+    dsp_bench_recorded[i] *= 0.5 / peak;
+  }
+  return 0;
+}
+
+/* Runs c repeatedly for at least seconds, returns ns per call and cycles per call */
+static float64_t dsp_bench_time(const dsp_bench_kernel *k, dsp_bench_case *c, float64_t seconds, float64_t *cycles)
+{
+  uint64_t iters = 1, i, t0, t1, c0, c1;
+  uint64_t target = (uint64_t)(seconds * 1e9);
+
+  for (;;)
+  {
+    t0 = dsp_bench_now_ns();
+    c0 = DSP_BENCH_CYCLES();
+    for (i = 0; i < iters; i++)
+    {
+      k->run(c);
+    }
+    c1 = DSP_BENCH_CYCLES();
+    t1 = dsp_bench_now_ns();
+    if (((t1 - t0) >= target) || (iters >= (1ULL << 40)))
+    {
+      break;
+    }
+    iters *= 2U;
+  }
+  *cycles = (float64_t)(c1 - c0) / (float64_t)iters;
+  return (float64_t)(t1 - t0) / (float64_t)iters;
+}
+
+/* Returns 0 if the case passed its accuracy gate (or was skipped) */
+static int dsp_bench_case_run(const dsp_bench_kernel *k, uint32_t n, float64_t seconds)
+{
+  dsp_bench_case c;
+  float64_t sig = 0.0, noise = 0.0, maxErr = 0.0, err, snr;
+  float64_t ns = 0.0, cycles = 0.0;
+  uint32_t i;
+  int failed;
+
+  memset(&c, 0, sizeof(c));
+  c.n = n;
+  c.variant = k->variant;
+  if (k->setup(&c) != ARM_MATH_SUCCESS)
+  {
+    return 0;
+  }
+
+  k->run(&c);
+  k->result(&c);
+  for (i = 0; i < c.outLen; i++)
+  {
+    err = c.out[i] - c.ref[i];
+    sig += c.ref[i] * c.ref[i];
+    noise += err * err;
+    if (fabs(err) > maxErr)
+    {
+      maxErr = fabs(err);
+    }
+  }
+  if (noise == 0.0)
+  {
+    snr = DSP_BENCH_SNR_EXACT;
+  }
+  else
+  {
+    snr = 10.0 * log10(sig / noise);
+    if (snr > DSP_BENCH_SNR_EXACT)
+    {
+      snr = DSP_BENCH_SNR_EXACT;
+    }
+  }
+  /* NaN fails as well */
+  failed = !(snr >= k->minSnr);
+
+  if (seconds > 0.0)
+  {
+    ns = dsp_bench_time(k, &c, seconds, &cycles);
+  }
+
+  printf("%s,%s,%u,%.1f,%.2f,%.2f,%.1f,%.3g,%s,", k->family, k->name, (unsigned)n, ns,
+         (ns > 0.0) ? ((float64_t)c.samples * 1e3 / ns) : 0.0,
+         (c.samples != 0U) ? (cycles / (float64_t)c.samples) : 0.0, snr, maxErr, failed ? "FAIL" : "ok");
+  if (c.bytes != 0U)
+  {
+    printf("%u", (unsigned)c.bytes);
+  }
+  printf("\n");
+  fflush(stdout);
+
+  k->teardown(&c);
+  dsp_bench_free(c.ref);
+  dsp_bench_free(c.out);
+  return failed;
+}
+
+static int dsp_bench_listed(const char *list, const char *name)
+{
+  size_t len = strlen(name);
+  const char *p = list;
+
+  if (list == NULL)
+  {
+    return 1;
+  }
+  while ((p = strstr(p, name)) != NULL)
+  {
+    if (((p == list) || (p[-1] == ',')) && ((p[len] == ',') || (p[len] == '\0')))
+    {
+      return 1;
+    }
+    p += len;
+  }
+  return 0;
+}
+
+static void dsp_bench_usage(const char *prog)
+{
+  fprintf(stderr,
+          "usage: %s [-f family[,family...]] [-k kernel[,kernel...]] [-n size[,size...]] [-t seconds] [-a] [-i file] [-H]\n"
+          "  -f  filtering, transform, matrix, statistics or kernel family (fir, biquad, fft, ...), default all\n"
+          "  -k  CMSIS-DSP function names, default all\n"
+          "  -n  block sizes, default 16,64,256,1024,4096\n"
+          "  -t  minimum measuring time per case in seconds (default 0.2)\n"
+          "  -a  accuracy only, no timing\n"
+          "  -i  test signal from a raw float32 recording instead of white noise\n"
+          "  -H  print the CSV header line\n",
+          prog);
+}
+
+int main(int argc, char **argv)
+{
+  const char *families = NULL;
+  const char *kernels = NULL;
+  const char *sizes = "16,64,256,1024,4096";
+  float64_t seconds = 0.2;
+  uint32_t n[DSP_BENCH_MAX_SIZES];
+  uint32_t sizeCount = 0, f, s;
+  const dsp_bench_kernel *k;
+  char *list, *tok;
+  int header = 0, failures = 0, ch;
+
+  while ((ch = getopt(argc, argv, "f:k:n:t:ai:H")) != -1)
+  {
+    switch (ch)
+    {
+      case 'f':
+        families = optarg;
+        break;
+      case 'k':
+        kernels = optarg;
+        break;
+      case 'n':
+        sizes = optarg;
+        break;
+      case 't':
+        seconds = atof(optarg);
+        break;
+      case 'a':
+        seconds = 0.0;
+        break;
+      case 'i':
+        if (dsp_bench_load(optarg) != 0)
+        {
+          return 2;
+        }
+        break;
+      case 'H':
+        header = 1;
+        break;
+      default:
+        dsp_bench_usage(argv[0]);
+        return 2;
+    }
+  }
+
+  list = strdup(sizes);
+  for (tok = strtok(list, ","); tok != NULL; tok = strtok(NULL, ","))
+  {
+    unsigned long v = strtoul(tok, NULL, 0);
+    if ((v == 0U) || (v > (1UL << 24)) || (sizeCount == DSP_BENCH_MAX_SIZES))
+    {
+      dsp_bench_usage(argv[0]);
+      free(list);
+      return 2;
+    }
+    n[sizeCount++] = (uint32_t)v;
+  }
+  free(list);
+
+  if (header)
+  {
+    printf("family,kernel,n,ns_per_call,msamples_s,%s_per_sample,snr_db,max_abs_err,status,bytes\n", DSP_BENCH_CYCLES_UNIT);
+  }
+
+  for (f = 0; f < sizeof(dsp_bench_families) / sizeof(dsp_bench_families[0]); f++)
+  {
+    for (k = dsp_bench_families[f].kernels; k->name != NULL; k++)
+    {
+      if ((!dsp_bench_listed(families, dsp_bench_families[f].name) && !dsp_bench_listed(families, k->family)) ||
+          !dsp_bench_listed(kernels, k->name))
+      {
+        continue;
+      }
+      for (s = 0; s < sizeCount; s++)
+      {
+        failures += dsp_bench_case_run(k, n[s], seconds);
+      }
+    }
+  }
+
+  if (failures != 0)
+  {
+    fprintf(stderr, "dsp_bench: %d case(s) below the accuracy gate\n", failures);
+    return 1;
+  }
+  return 0;
+}
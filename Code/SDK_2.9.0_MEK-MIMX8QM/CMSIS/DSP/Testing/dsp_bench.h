@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench.h
+ * Description:  Host accuracy and throughput suite, common definitions
+ *
+ * Target Processor: Linux host
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _DSP_BENCH_H
+#define _DSP_BENCH_H
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+  @brief Highest SNR reported, an exact result is reported with this value.
+ */
+#define DSP_BENCH_SNR_EXACT  (999.0)
+
+/**
+  @brief Data types of the kernels, used as dsp_bench_kernel::variant by the
+         kernels which only differ in type.
+ */
+typedef enum
+{
+  DSP_BENCH_F32 = 0,
+  DSP_BENCH_Q31 = 1,
+  DSP_BENCH_Q15 = 2
+} dsp_bench_type;
+
+/**
+  @brief One measured case: a kernel with one block size.
+
+  Every kernel sees the same input: the recorded or generated test signal,
+  quantized to the data type of the kernel. The reference output is
+  computed in double precision from the quantized input, so the SNR only
+  measures the error of the kernel itself.
+ */
+typedef struct dsp_bench_case
+{
+  uint32_t n;            /**< block size: samples, transform length or matrix elements */
+  uint32_t variant;      /**< copy of dsp_bench_kernel::variant */
+  uint32_t samples;      /**< samples (or output elements) processed by one run */
+  uint32_t outLen;       /**< number of output values compared */
+  float64_t *ref;        /**< reference output, outLen values */
+  float64_t *out;        /**< kernel output converted to double, outLen values */
+  uint32_t bytes;        /**< working memory of the kernel: state, tables and scratch, 0 if not reported */
+  void *priv;            /**< kernel specific state */
+} dsp_bench_case;
+
+/**
+  @brief Kernel under test.
+
+  setup() allocates and initializes the kernel state for c->n and fills
+  c->ref, it returns ARM_MATH_LENGTH_ERROR for block sizes the kernel does
+  not support. run() is the timed call, it may be called many times in a
+  row. result() converts the output of the first run() to c->out.
+ */
+typedef struct dsp_bench_kernel
+{
+  const char *family;    /**< fir, firlong, fixed, multich, resample, biquad, fft, mfcc, matrix, solve, stats */
+  const char *name;      /**< CMSIS-DSP function measured */
+  float64_t minSnr;      /**< accuracy gate in dB */
+  uint32_t variant;      /**< kernel specific, lets kernels share setup() and result() */
+  arm_status (*setup)(dsp_bench_case *c);
+  void (*run)(dsp_bench_case *c);
+  void (*result)(dsp_bench_case *c);
+  void (*teardown)(dsp_bench_case *c);
+} dsp_bench_kernel;
+
+/* Kernel tables of the families, terminated by an entry with name == NULL */
+extern const dsp_bench_kernel dsp_bench_filtering[];
+extern const dsp_bench_kernel dsp_bench_transform[];
+extern const dsp_bench_kernel dsp_bench_matrix[];
+extern const dsp_bench_kernel dsp_bench_statistics[];
+
+/* Memory, aborts the program when exhausted, zero initialized */
+void *dsp_bench_alloc(size_t size);
+void dsp_bench_free(void *p);
+
+/* Test signal of n samples in [-0.5, 0.5), stream selects an independent sequence */
+void dsp_bench_signal(float64_t *dst, uint32_t n, uint32_t stream);
+
+/* Quantize v to the data type and write the quantized value back to v */
+void dsp_bench_quantize_f32(float64_t *v, float32_t *dst, uint32_t n);
+void dsp_bench_quantize_q31(float64_t *v, q31_t *dst, uint32_t n);
+void dsp_bench_quantize_q15(float64_t *v, q15_t *dst, uint32_t n);
+
+/* Convert kernel output to double, scale is the value of full scale (1.0 for 1.31/1.15) */
+void dsp_bench_from_f32(const float32_t *src, float64_t *dst, uint32_t n);
+void dsp_bench_from_q31(const q31_t *src, float64_t *dst, uint32_t n, float64_t scale);
+void dsp_bench_from_q15(const q15_t *src, float64_t *dst, uint32_t n, float64_t scale);
+
+/* Same as above, for data of the given type */
+size_t dsp_bench_type_size(dsp_bench_type type);
+void dsp_bench_quantize(dsp_bench_type type, float64_t *v, void *dst, uint32_t n);
+void dsp_bench_from(dsp_bench_type type, const void *src, float64_t *dst, uint32_t n, float64_t scale);
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _DSP_BENCH_H */
@@ -0,0 +1,333 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fixed_size_filters.h
+ * Description:  FIR and biquad kernels specialized for a number of taps or stages
+ *               fixed at build time
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _ARM_FIXED_SIZE_FILTERS_H
+#define _ARM_FIXED_SIZE_FILTERS_H
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FixedSizeFilters Fixed Size Filter Kernels
+
+  The generic filter functions take the number of taps or stages from the instance at run
+  time: they loop over it, handle the taps or samples left over by the unrolled loops and,
+  for the FIR, move the history through the state buffer on every call. When a filter of
+  the application has a size known at build time, the macros of this file generate a
+  function for that size, in which the loops over the taps or the stages have a constant
+  trip count and are fully unrolled, and the coefficients and the state are held in local
+  variables for the whole block, in registers when the size allows it.
+
+  The macros are expanded once, at file scope, in a source file of the application:
+  <pre>
+      #include "arm_fixed_size_filters.h"
+
+      ARM_FIR_F32_FIXED_SIZE(fir_lowpass_16, 16)
+      ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(eq_4stages, 4)
+  </pre>
+  and declared in the headers with \ref ARM_FIR_F32_FIXED_SIZE_DECLARE and
+  \ref ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE_DECLARE. The generated functions take the same
+  arguments as \ref arm_fir_f32() and \ref arm_biquad_cascade_df1_q31(), and have C linkage
+  when expanded in C++.
+
+  The gain is largest for few taps or stages and small blocks, where the loop and state
+  handling overhead of the generic functions is comparable to the arithmetic. The generated
+  code grows with the size, and a generic function with a hand vectorized path can be
+  faster for long filters: the <code>fixed</code> family of the host benchmark compares
+  both at each size.
+ */
+
+/**
+  @addtogroup FixedSizeFilters
+  @{
+ */
+
+/**
+  @brief Unrolls the following loop, whose trip count is a constant.
+ */
+#if defined ( __clang__ )
+  #define ARM_FIXED_SIZE_UNROLL _Pragma("unroll")
+#elif defined ( __GNUC__ ) && (__GNUC__ >= 8)
+  #define ARM_FIXED_SIZE_UNROLL _Pragma("GCC unroll 128")
+#else
+  #define ARM_FIXED_SIZE_UNROLL
+#endif
+
+/**
+  @brief Linkage of the generated functions, C when expanded in C++.
+ */
+#ifdef   __cplusplus
+  #define ARM_FIXED_SIZE_LINKAGE extern "C"
+#else
+  #define ARM_FIXED_SIZE_LINKAGE
+#endif
+
+/**
+  @brief         Declares a floating-point FIR function generated by \ref ARM_FIR_F32_FIXED_SIZE.
+  @param[in]     name  name of the function
+ */
+#define ARM_FIR_F32_FIXED_SIZE_DECLARE(name)                                   \
+  ARM_FIXED_SIZE_LINKAGE void name(                                            \
+    const arm_fir_instance_f32 * S,                                            \
+    const float32_t * pSrc,                                                    \
+          float32_t * pDst,                                                    \
+          uint32_t blockSize)
+
+/**
+  @brief Number of outputs of the generated FIR functions computed together, sharing the
+         loads of the coefficients.
+ */
+#ifndef ARM_FIR_FIXED_SIZE_OUTPUTS
+  #define ARM_FIR_FIXED_SIZE_OUTPUTS 8U
+#endif
+
+/**
+  @brief         One output of a FIR of numTaps coefficients.
+  @param[in]     b        points to the coefficients, time reversed
+  @param[in]     px       points to the oldest input of the window
+  @param[in]     numTaps  number of coefficients, constant once inlined
+  @return        output
+ */
+__STATIC_FORCEINLINE float32_t arm_fir_fixed_size_dot_f32(
+  const float32_t * b,
+  const float32_t * px,
+  const uint32_t numTaps)
+{
+  float32_t acc = 0.0f;
+  uint32_t k;
+
+  ARM_FIXED_SIZE_UNROLL
+  for (k = 0U; k < numTaps; k++)
+  {
+    acc += b[k] * px[k];
+  }
+
+  return (acc);
+}
+
+/**
+  @brief         count outputs of a FIR of numTaps coefficients, the window of output i starting at px[i].
+  @param[in]     b        points to the coefficients, time reversed
+  @param[in]     px       points to the oldest input of the first output
+  @param[out]    pDst     points to the outputs
+  @param[in]     count    number of outputs
+  @param[in]     numTaps  number of coefficients, constant once inlined
+  @return        none
+ */
+__STATIC_FORCEINLINE void arm_fir_fixed_size_block_f32(
+  const float32_t * b,
+  const float32_t * px,
+        float32_t * pDst,
+        uint32_t count,
+  const uint32_t numTaps)
+{
+  float32_t acc[ARM_FIR_FIXED_SIZE_OUTPUTS];
+  uint32_t i, j, k;
+
+  for (i = 0U; (i + ARM_FIR_FIXED_SIZE_OUTPUTS) <= count; i += ARM_FIR_FIXED_SIZE_OUTPUTS)
+  {
+    const float32_t *pw = &px[i];
+
+    ARM_FIXED_SIZE_UNROLL
+    for (j = 0U; j < ARM_FIR_FIXED_SIZE_OUTPUTS; j++)
+    {
+      acc[j] = 0.0f;
+    }
+
+    /* acc[j] = b[0] * x[n+j-numTaps+1] + ... + b[numTaps-1] * x[n+j] */
+    ARM_FIXED_SIZE_UNROLL
+    for (k = 0U; k < numTaps; k++)
+    {
+      ARM_FIXED_SIZE_UNROLL
+      for (j = 0U; j < ARM_FIR_FIXED_SIZE_OUTPUTS; j++)
+      {
+        acc[j] += b[k] * pw[k + j];
+      }
+    }
+
+    ARM_FIXED_SIZE_UNROLL
+    for (j = 0U; j < ARM_FIR_FIXED_SIZE_OUTPUTS; j++)
+    {
+      pDst[i + j] = acc[j];
+    }
+  }
+
+  /* Remaining outputs, one at a time */
+  for (; i < count; i++)
+  {
+    pDst[i] = arm_fir_fixed_size_dot_f32(b, &px[i], numTaps);
+  }
+}
+
+/**
+  @brief         Generates a floating-point FIR function for a fixed number of taps.
+  @param[in]     name     name of the function
+  @param[in]     numTaps  number of filter coefficients, a constant expression, at least 1
+
+  @par           Details
+                   The generated function filters <code>blockSize</code> samples as
+                   \ref arm_fir_f32() with <code>numTaps</code> coefficients, whatever the
+                   <code>numTaps</code> member of the instance. The instance is initialized by
+                   \ref arm_fir_init_f32(), with the same coefficients and state buffer, and both
+                   functions can be called on the same instance.
+  @par
+                   Only the first <code>numTaps - 1</code> inputs of the block, whose windows
+                   reach into the history, are copied to the state buffer: the following
+                   outputs are computed from the source buffer, and the history of the next
+                   block is taken from its end. \ref ARM_FIR_FIXED_SIZE_OUTPUTS outputs are
+                   computed together, their accumulators forming a vector that the compiler
+                   can map to SIMD registers. Each output adds its products in the order of
+                   \ref arm_fir_f32(), oldest input first, and is rounded the same.
+ */
+#define ARM_FIR_F32_FIXED_SIZE(name, numTaps)                                  \
+  ARM_FIR_F32_FIXED_SIZE_DECLARE(name)                                         \
+  {                                                                            \
+    const uint32_t histLen = (uint32_t)(numTaps) - 1U;                         \
+    const uint32_t headLen = (blockSize < histLen) ? blockSize : histLen;      \
+    float32_t * const pState = S->pState;                                      \
+    float32_t b[(numTaps)];                                                    \
+    uint32_t k;                                                                \
+                                                                               \
+    ARM_FIXED_SIZE_UNROLL                                                      \
+    for (k = 0U; k < (uint32_t)(numTaps); k++)                                 \
+    {                                                                          \
+      b[k] = S->pCoeffs[k];                                                    \
+    }                                                                          \
+                                                                               \
+    /* Outputs whose window starts in the history */                           \
+    for (k = 0U; k < headLen; k++)                                             \
+    {                                                                          \
+      pState[histLen + k] = pSrc[k];                                           \
+    }                                                                          \
+    for (k = 0U; k < headLen; k++)                                             \
+    {                                                                          \
+      pDst[k] = arm_fir_fixed_size_dot_f32(b, &pState[k], (uint32_t)(numTaps)); \
+    }                                                                          \
+                                                                               \
+    /* Outputs whose window is in the block */                                 \
+    arm_fir_fixed_size_block_f32(b, pSrc, pDst + histLen, blockSize - headLen, \
+                                 (uint32_t)(numTaps));                         \
+                                                                               \
+    /* The last numTaps - 1 inputs are the history of the next block */        \
+    if (blockSize >= histLen)                                                  \
+    {                                                                          \
+      ARM_FIXED_SIZE_UNROLL                                                    \
+      for (k = 0U; k < histLen; k++)                                           \
+      {                                                                        \
+        pState[k] = pSrc[(blockSize - histLen) + k];                           \
+      }                                                                        \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      ARM_FIXED_SIZE_UNROLL                                                    \
+      for (k = 0U; k < histLen; k++)                                           \
+      {                                                                        \
+        pState[k] = pState[blockSize + k];                                     \
+      }                                                                        \
+    }                                                                          \
+  }
+
+/**
+  @brief         Declares a Q31 biquad cascade function generated by \ref ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE.
+  @param[in]     name  name of the function
+ */
+#define ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE_DECLARE(name)                    \
+  ARM_FIXED_SIZE_LINKAGE void name(                                            \
+    const arm_biquad_casd_df1_inst_q31 * S,                                    \
+    const q31_t * pSrc,                                                        \
+          q31_t * pDst,                                                        \
+          uint32_t blockSize)
+
+/**
+  @brief         Generates a Q31 Direct Form I biquad cascade function for a fixed number of stages.
+  @param[in]     name       name of the function
+  @param[in]     numStages  number of second order stages, a constant expression, at least 1
+
+  @par           Details
+                   The generated function filters <code>blockSize</code> samples as
+                   \ref arm_biquad_cascade_df1_q31() with <code>numStages</code> stages, whatever
+                   the <code>numStages</code> member of the instance, and gives the same output.
+                   The coefficients, the state and the <code>postShift</code> of the instance are
+                   used as by \ref arm_biquad_cascade_df1_q31() and the instance is initialized
+                   by \ref arm_biquad_cascade_df1_init_q31(): both functions can be called on
+                   the same instance.
+  @par
+                   The samples go through all the stages one at a time, rather than the block
+                   through one stage at a time, so that no intermediate block is written to
+                   the output buffer.
+ */
+#define ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE(name, numStages)                 \
+  ARM_BIQUAD_CASCADE_DF1_Q31_FIXED_SIZE_DECLARE(name)                          \
+  {                                                                            \
+    q31_t c[5U * (uint32_t)(numStages)];     /* {b0, b1, b2, a1, a2} */        \
+    q31_t z[4U * (uint32_t)(numStages)];     /* {x[n-1], x[n-2], y[n-1], y[n-2]} */ \
+    const uint32_t lShift = 32U - ((uint32_t) S->postShift + 1U);             \
+    q63_t acc;                                                                 \
+    q31_t x;                                                                   \
+    uint32_t k;                                                                \
+                                                                               \
+    ARM_FIXED_SIZE_UNROLL                                                      \
+    for (k = 0U; k < (5U * (uint32_t)(numStages)); k++)                        \
+    {                                                                          \
+      c[k] = S->pCoeffs[k];                                                    \
+    }                                                                          \
+    ARM_FIXED_SIZE_UNROLL                                                      \
+    for (k = 0U; k < (4U * (uint32_t)(numStages)); k++)                        \
+    {                                                                          \
+      z[k] = S->pState[k];                                                     \
+    }                                                                          \
+                                                                               \
+    while (blockSize > 0U)                                                     \
+    {                                                                          \
+      x = *pSrc++;                                                             \
+                                                                               \
+      ARM_FIXED_SIZE_UNROLL                                                    \
+      for (k = 0U; k < (uint32_t)(numStages); k++)                             \
+      {                                                                        \
+        /* acc = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */ \
+        acc = ((q63_t) c[(5U * k)     ] * x) +                                 \
+              ((q63_t) c[(5U * k) + 1U] * z[(4U * k)     ]) +                  \
+              ((q63_t) c[(5U * k) + 2U] * z[(4U * k) + 1U]) +                  \
+              ((q63_t) c[(5U * k) + 3U] * z[(4U * k) + 2U]) +                  \
+              ((q63_t) c[(5U * k) + 4U] * z[(4U * k) + 3U]);                   \
+                                                                               \
+        z[(4U * k) + 1U] = z[4U * k];                                          \
+        z[4U * k] = x;                                                         \
+        z[(4U * k) + 3U] = z[(4U * k) + 2U];                                   \
+                                                                               \
+        /* The result is converted to 1.31, and is the input of the next stage */ \
+        x = (q31_t) (acc >> lShift);                                           \
+        z[(4U * k) + 2U] = x;                                                  \
+      }                                                                        \
+                                                                               \
+      *pDst++ = x;                                                             \
+      blockSize--;                                                             \
+    }                                                                          \
+                                                                               \
+    ARM_FIXED_SIZE_UNROLL                                                      \
+    for (k = 0U; k < (4U * (uint32_t)(numStages)); k++)                        \
+    {                                                                          \
+      S->pState[k] = z[k];                                                     \
+    }                                                                          \
+  }
+
+/**
+  @} end of FixedSizeFilters group
+ */
+
+#endif /* _ARM_FIXED_SIZE_FILTERS_H */
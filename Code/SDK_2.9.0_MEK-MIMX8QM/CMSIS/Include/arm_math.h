@@ -128,6 +128,21 @@
    * of some DSP functions. Experimental Neon versions currently do not have better
    * performances than the scalar versions.
    *
+   * - ARM_MATH_SSE41:
+   *
+   * Define macro ARM_MATH_SSE41 to enable the SSE4.1 versions of the floating-point
+   * basic math, complex math, FIR, biquad, FFT butterfly and matrix functions on x86 hosts,
+   * for the replay of the firmware processing chains on build servers.
+   * The element-wise functions, the filters, the FFT and the matrix products keep the
+   * order of the operations of the scalar versions and give the same results, bit for bit.
+   * Only arm_dot_prod_f32() adds its products in a different order.
+   *
+   * - ARM_MATH_AVX2:
+   *
+   * Define macro ARM_MATH_AVX2 to use 8 samples wide AVX2 versions where they exist.
+   * It implies ARM_MATH_SSE41 for the other functions. No fused multiply-add is used,
+   * the functions giving the scalar results above still do.
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -331,6 +346,14 @@
 #include <arm_neon.h>
 #endif
 
+#if defined(ARM_MATH_AVX2) && !defined(ARM_MATH_SSE41)
+  #define ARM_MATH_SSE41
+#endif
+
+#if defined(ARM_MATH_SSE41)
+#include <immintrin.h>
+#endif
+
 
 #ifdef   __cplusplus
 extern "C"
@@ -380,7 +403,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH  = -3,        /**< Size of matrices is not compatible with the operation */
     ARM_MATH_NANINF         = -4,        /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR       = -5,        /**< Input matrix is singular and cannot be inverted */
-    ARM_MATH_TEST_FAILURE   = -6         /**< Test Failed */
+    ARM_MATH_TEST_FAILURE   = -6,        /**< Test Failed */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Decomposition failed, the matrix does not have the required property */
   } arm_status;
 
   /**
@@ -856,6 +880,27 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
 
 #endif
 
+#if defined(ARM_MATH_SSE41)
+
+/* Sum of the 4 lanes, (x0 + x2) + (x1 + x3) */
+static inline float32_t __arm_vec_hsum_f32_sse(__m128 x)
+{
+    x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+    return(_mm_cvtss_f32(x));
+}
+
+#endif
+
+#if defined(ARM_MATH_AVX2)
+
+static inline float32_t __arm_vec_hsum_f32_avx(__m256 x)
+{
+    return(__arm_vec_hsum_f32_sse(_mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1))));
+}
+
+#endif
+
 /*
  * @brief C custom defined intrinsic functions
  */
@@ -1372,6 +1417,47 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the floating-point FIR filter. N interleaved channels
+   */
+  typedef struct
+  {
+          uint16_t numTaps;     /**< number of filter coefficients in the filter. */
+          uint16_t numChannels; /**< number of interleaved channels. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    const float32_t *pCoeffs;   /**< points to the coefficient array. The array is of length numTaps*numChannels, interleaved by tap. */
+  } arm_fir_multi_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point FIR filter. N interleaved channels
+   * @param[in]  S          points to an instance of the floating-point FIR structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples per channel to process.
+   */
+  void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter. N interleaved channels
+   * @param[in,out] S            points to an instance of the floating-point FIR filter structure.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients of all channels.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_multi_init_f32(
+        arm_fir_multi_instance_f32 * S,
+        uint16_t numChannels,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1734,6 +1820,128 @@ arm_status arm_mat_mult_fast_q31(
   const arm_matrix_instance_q31 * pSrcB,
         arm_matrix_instance_q31 * pDst);
 
+  /**
+   * @brief Tile sizes of the cache blocked matrix multiplication: depth of the K panel
+   * and width of the B panel. The default B tile of 32x64 floats takes 8 KB.
+   */
+#ifndef ARM_MAT_BLOCK_K
+#define ARM_MAT_BLOCK_K   32U
+#endif
+#ifndef ARM_MAT_BLOCK_N
+#define ARM_MAT_BLOCK_N   64U
+#endif
+
+  /**
+   * @brief Floating-point matrix multiplication, register blocked and cache tiled
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q31 matrix multiplication, register blocked and cache tiled
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcB,
+        arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q15 matrix multiplication, register blocked and cache tiled
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_blocked_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcB,
+        arm_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief Floating-point matrix multiplication by a transposed matrix, pDst = pSrcA * transpose(pSrcBT)
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcBT  points to the transpose of the second input matrix
+   * @param[out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_transb_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcBT,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Q31 matrix multiplication by a transposed matrix, pDst = pSrcA * transpose(pSrcBT)
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcBT  points to the transpose of the second input matrix
+   * @param[out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_transb_q31(
+  const arm_matrix_instance_q31 * pSrcA,
+  const arm_matrix_instance_q31 * pSrcBT,
+        arm_matrix_instance_q31 * pDst);
+
+  /**
+   * @brief Q15 matrix multiplication by a transposed matrix, pDst = pSrcA * transpose(pSrcBT)
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcBT  points to the transpose of the second input matrix
+   * @param[out] pDst    points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+arm_status arm_mat_mult_transb_q15(
+  const arm_matrix_instance_q15 * pSrcA,
+  const arm_matrix_instance_q15 * pSrcBT,
+        arm_matrix_instance_q15 * pDst);
+
+  /**
+   * @brief Floating-point matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols values
+   * @param[out] pDst     points to the output vector of numRows values
+   */
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Q31 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols values
+   * @param[out] pDst     points to the output vector of numRows values
+   */
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst);
+
+  /**
+   * @brief Q15 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols values
+   * @param[out] pDst     points to the output vector of numRows values
+   */
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst);
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -2390,6 +2598,117 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+  /**
+   * @brief Maximum number of radix stages of a mixed radix CFFT plan.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES       (32U)
+
+  /**
+   * @brief Sizes in float32_t of the twiddle and scratch buffers of the mixed radix transforms.
+   */
+#define ARM_CFFT_MIXED_TWIDDLE_LEN(fftLen)  (2U * (fftLen))
+#define ARM_CFFT_MIXED_SCRATCH_LEN(fftLen)  (2U * (fftLen))
+#define ARM_RFFT_MIXED_TWIDDLE_LEN(fftLen)  (2U * (fftLen))
+#define ARM_RFFT_MIXED_SCRATCH_LEN(fftLen)  (fftLen)
+
+  /**
+   * @brief Instance structure (plan) for the floating-point mixed radix CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                                /**< length of the FFT. */
+          uint32_t numStages;                             /**< number of radix stages. */
+          uint8_t pFactors[ARM_CFFT_MIXED_MAX_STAGES];    /**< radix of each stage: 2, 3, 4 or 5. */
+    const float32_t *pTwiddle;                            /**< points to the twiddle factors of all stages. */
+          float32_t *pScratch;                            /**< points to the scratch buffer, 2*fftLen values. */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pScratch);
+
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point RFFT/RIFFT function on the mixed radix CFFT.
+   */
+  typedef struct
+  {
+          arm_cfft_mixed_instance_f32 Sint;  /**< Internal CFFT plan of fftLenRFFT/2 points. */
+          uint32_t fftLenRFFT;               /**< length of the real sequence */
+    const float32_t * pTwiddleRFFT;          /**< Twiddle factors real stage  */
+  } arm_rfft_mixed_instance_f32;
+
+  arm_status arm_rfft_mixed_init_f32(
+        arm_rfft_mixed_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pScratch);
+
+  void arm_rfft_mixed_f32(
+  const arm_rfft_mixed_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Number of partitions and buffer sizes in float32_t of the partitioned convolution FIR filter.
+   */
+#define ARM_FIR_FFT_PARTITIONS(numTaps, partLen)   (((numTaps) + (partLen) - 1U) / (partLen))
+#define ARM_FIR_FFT_COEFFS_LEN(numTaps, partLen)   (2U * (partLen) * ARM_FIR_FFT_PARTITIONS(numTaps, partLen))
+#define ARM_FIR_FFT_STATE_LEN(numTaps, partLen)    (2U * (partLen) * (ARM_FIR_FFT_PARTITIONS(numTaps, partLen) + 3U))
+
+  /**
+   * @brief Instance structure for the floating-point partitioned convolution FIR filter.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;                 /**< number of filter coefficients in the filter. */
+          uint16_t partLen;                 /**< partition length, the FFT length is 2*partLen. */
+          uint16_t numPartitions;           /**< number of filter partitions. */
+          uint16_t fdlIndex;                /**< newest spectrum of the frequency domain delay line. */
+          uint16_t inCount;                 /**< samples of the newest input block already filtered, less than partLen. */
+          arm_rfft_fast_instance_f32 rfft;  /**< real FFT of 2*partLen points. */
+    const float32_t *pCoeffs;               /**< points to the spectra of the partitions, numPartitions*2*partLen values. */
+          float32_t *pState;                /**< points to the state array of ARM_FIR_FFT_STATE_LEN(numTaps, partLen) values. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned convolution FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned convolution FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned convolution FIR filter.
+   * @param[in,out] S            points to an instance of the floating-point partitioned convolution FIR structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients, in the order of arm_fir_init_f32().
+   * @param[out]    pCoeffsFreq  points to the buffer for the spectra of the partitions.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     partLen      partition length, a power of two from 16 to 2048.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pCoeffsFreq,
+        float32_t * pState,
+        uint16_t partLen);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -2507,25 +2826,488 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
    * @param[in]     normalize  normalizing factor.
    * @return      arm_status function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if <code>N</code> is not a supported transform length.
    */
-  arm_status arm_dct4_init_q15(
-        arm_dct4_instance_q15 * S,
-        arm_rfft_instance_q15 * S_RFFT,
-        arm_cfft_radix4_instance_q15 * S_CFFT,
-        uint16_t N,
-        uint16_t Nby2,
-        q15_t normalize);
+  arm_status arm_dct4_init_q15(
+        arm_dct4_instance_q15 * S,
+        arm_rfft_instance_q15 * S_RFFT,
+        arm_cfft_radix4_instance_q15 * S_CFFT,
+        uint16_t N,
+        uint16_t Nby2,
+        q15_t normalize);
+
+
+  /**
+   * @brief Processing function for the Q15 DCT4/IDCT4.
+   * @param[in]     S              points to an instance of the Q15 DCT4 structure.
+   * @param[in]     pState         points to state buffer.
+   * @param[in,out] pInlineBuffer  points to the in-place input and output buffer.
+   */
+  void arm_dct4_q15(
+  const arm_dct4_instance_q15 * S,
+        q15_t * pState,
+        q15_t * pInlineBuffer);
+
+  /**
+   * @brief Largest number of STFT frames produced by one call on blockSize samples.
+   */
+#define ARM_STFT_MAX_FRAMES(blockSize, hopSize)   (((blockSize) + (hopSize) - 1U) / (hopSize))
+
+  /**
+   * @brief Instance structure for the floating-point short-time Fourier transform.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< length of the real FFT. */
+          uint16_t frameLen;                /**< samples of a frame, at most fftLen, the FFT input is padded with zeros. */
+          uint16_t hopSize;                 /**< samples between the starts of two frames, at most frameLen. */
+          uint16_t fill;                    /**< samples of the next frame already in the state buffer. */
+    const float32_t *pWindow;               /**< points to the analysis window of frameLen values, or NULL. */
+          float32_t *pState;                /**< points to the state buffer of frameLen values. */
+          arm_rfft_fast_instance_f32 rfft;  /**< real FFT of fftLen points. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 short-time Fourier transform.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< length of the real FFT. */
+          uint16_t frameLen;                /**< samples of a frame, at most fftLen, the FFT input is padded with zeros. */
+          uint16_t hopSize;                 /**< samples between the starts of two frames, at most frameLen. */
+          uint16_t fill;                    /**< samples of the next frame already in the state buffer. */
+    const q15_t *pWindow;                   /**< points to the analysis window of frameLen values, or NULL. */
+          q15_t *pState;                    /**< points to the state buffer of frameLen values. */
+          arm_rfft_instance_q15 rfft;       /**< real FFT of fftLen points. */
+  } arm_stft_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point short-time Fourier transform.
+   * @param[in,out] S         points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen    length of the real FFT, a length supported by arm_rfft_fast_init_f32().
+   * @param[in]     frameLen  samples of a frame, from 1 to fftLen.
+   * @param[in]     hopSize   samples between the starts of two frames, from 1 to frameLen.
+   * @param[in]     pWindow   points to the analysis window of frameLen values, NULL for a rectangular window.
+   * @param[in]     pState    points to the state buffer of frameLen values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t frameLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the spectra, fftLen values per frame in the format of arm_rfft_fast_f32().
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     pScratch   points to a scratch buffer of fftLen values.
+   * @return        number of frames written to pDst, at most ARM_STFT_MAX_FRAMES(blockSize, hopSize).
+   */
+  uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        float32_t * pScratch);
+
+  /**
+   * @brief  Initialization function for the Q15 short-time Fourier transform.
+   * @param[in,out] S         points to an instance of the Q15 STFT structure.
+   * @param[in]     fftLen    length of the real FFT, a length supported by arm_rfft_init_q15().
+   * @param[in]     frameLen  samples of a frame, from 1 to fftLen.
+   * @param[in]     hopSize   samples between the starts of two frames, from 1 to frameLen.
+   * @param[in]     pWindow   points to the analysis window of frameLen values, NULL for a rectangular window.
+   * @param[in]     pState    points to the state buffer of frameLen values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_stft_init_q15(
+        arm_stft_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t frameLen,
+        uint16_t hopSize,
+  const q15_t * pWindow,
+        q15_t * pState);
+
+  /**
+   * @brief Processing function for the Q15 short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the Q15 STFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the spectra, 2*fftLen values per frame in the format of arm_rfft_q15().
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     pScratch   points to a scratch buffer of fftLen values.
+   * @return        number of frames written to pDst, at most ARM_STFT_MAX_FRAMES(blockSize, hopSize).
+   */
+  uint32_t arm_stft_q15(
+        arm_stft_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize,
+        q15_t * pScratch);
+
+  /**
+   * @brief Largest number of weights of a mel filterbank on the bins of a real FFT of fftLen points.
+   */
+#define ARM_MEL_WEIGHTS_MAX(fftLen)   ((fftLen) + 2U)
+
+  /**
+   * @brief Instance structure for the floating-point mel filterbank.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< length of the real FFT of the spectra. */
+          uint16_t numFilters;              /**< number of filters. */
+    const uint16_t *pStart;                 /**< points to the first FFT bin of each filter. */
+    const uint16_t *pLength;                /**< points to the number of FFT bins of each filter. */
+    const float32_t *pWeights;              /**< points to the weights of the filters, one after the other. */
+  } arm_mel_filterbank_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 mel filterbank.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< length of the real FFT of the spectra. */
+          uint16_t numFilters;              /**< number of filters. */
+    const uint16_t *pStart;                 /**< points to the first FFT bin of each filter. */
+    const uint16_t *pLength;                /**< points to the number of FFT bins of each filter. */
+    const q15_t *pWeights;                  /**< points to the weights of the filters, one after the other. */
+  } arm_mel_filterbank_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point mel filterbank.
+   * @param[in,out] S           points to an instance of the floating-point mel filterbank structure.
+   * @param[in]     fftLen      length of the real FFT of the spectra.
+   * @param[in]     numFilters  number of filters.
+   * @param[in]     sampleRate  sample rate in Hz.
+   * @param[in]     fMin        lower edge of the first filter in Hz.
+   * @param[in]     fMax        upper edge of the last filter in Hz, at most sampleRate/2.
+   * @param[out]    pStart      points to the buffer of the first bins, numFilters values.
+   * @param[out]    pLength     points to the buffer of the numbers of bins, numFilters values.
+   * @param[out]    pWeights    points to the buffer of the weights, ARM_MEL_WEIGHTS_MAX(fftLen) values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_mel_filterbank_init_f32(
+        arm_mel_filterbank_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t numFilters,
+        float32_t sampleRate,
+        float32_t fMin,
+        float32_t fMax,
+        uint16_t * pStart,
+        uint16_t * pLength,
+        float32_t * pWeights);
+
+  /**
+   * @brief Floating-point mel filterbank energies of a spectrum.
+   * @param[in]  S          points to an instance of the floating-point mel filterbank structure.
+   * @param[in]  pSpectrum  points to the spectrum, fftLen values in the format of arm_rfft_fast_f32().
+   * @param[out] pDst       points to the energies, numFilters values.
+   */
+  void arm_mel_filterbank_f32(
+  const arm_mel_filterbank_instance_f32 * S,
+  const float32_t * pSpectrum,
+        float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q15 mel filterbank.
+   * @param[in,out] S           points to an instance of the Q15 mel filterbank structure.
+   * @param[in]     fftLen      length of the real FFT of the spectra.
+   * @param[in]     numFilters  number of filters.
+   * @param[in]     sampleRate  sample rate in Hz.
+   * @param[in]     fMin        lower edge of the first filter in Hz.
+   * @param[in]     fMax        upper edge of the last filter in Hz, at most sampleRate/2.
+   * @param[out]    pStart      points to the buffer of the first bins, numFilters values.
+   * @param[out]    pLength     points to the buffer of the numbers of bins, numFilters values.
+   * @param[out]    pWeights    points to the buffer of the weights, ARM_MEL_WEIGHTS_MAX(fftLen) values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_mel_filterbank_init_q15(
+        arm_mel_filterbank_instance_q15 * S,
+        uint16_t fftLen,
+        uint16_t numFilters,
+        float32_t sampleRate,
+        float32_t fMin,
+        float32_t fMax,
+        uint16_t * pStart,
+        uint16_t * pLength,
+        q15_t * pWeights);
+
+  /**
+   * @brief Q15 mel filterbank energies of a spectrum.
+   * @param[in]  S          points to an instance of the Q15 mel filterbank structure.
+   * @param[in]  pSpectrum  points to the spectrum, in the format of arm_rfft_q15().
+   * @param[out] pDst       points to the energies in 2.30 format, numFilters values.
+   */
+  void arm_mel_filterbank_q15(
+  const arm_mel_filterbank_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point MFCC.
+   */
+  typedef struct
+  {
+    const arm_mel_filterbank_instance_f32 *pMel;  /**< points to the mel filterbank. */
+          arm_matrix_instance_f32 dct;            /**< DCT-II matrix of numCoeffs rows and numFilters columns. */
+  } arm_mfcc_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 MFCC.
+   */
+  typedef struct
+  {
+    const arm_mel_filterbank_instance_q15 *pMel;  /**< points to the mel filterbank. */
+          arm_matrix_instance_q15 dct;            /**< DCT-II matrix of numCoeffs rows and numFilters columns. */
+  } arm_mfcc_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point MFCC.
+   * @param[in,out] S           points to an instance of the floating-point MFCC structure.
+   * @param[in]     pMel        points to an initialized floating-point mel filterbank.
+   * @param[in]     numCoeffs   number of cepstral coefficients, from 1 to the number of filters.
+   * @param[out]    pDctCoeffs  points to the buffer of the DCT matrix, numCoeffs*numFilters values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_mfcc_init_f32(
+        arm_mfcc_instance_f32 * S,
+  const arm_mel_filterbank_instance_f32 * pMel,
+        uint16_t numCoeffs,
+        float32_t * pDctCoeffs);
+
+  /**
+   * @brief Floating-point MFCC of a spectrum.
+   * @param[in]  S          points to an instance of the floating-point MFCC structure.
+   * @param[in]  pSpectrum  points to the spectrum, fftLen values in the format of arm_rfft_fast_f32().
+   * @param[out] pDst       points to the coefficients, numCoeffs values.
+   * @param[in]  pScratch   points to a scratch buffer of numFilters values.
+   */
+  void arm_mfcc_f32(
+  const arm_mfcc_instance_f32 * S,
+  const float32_t * pSpectrum,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+  /**
+   * @brief  Initialization function for the Q15 MFCC.
+   * @param[in,out] S           points to an instance of the Q15 MFCC structure.
+   * @param[in]     pMel        points to an initialized Q15 mel filterbank.
+   * @param[in]     numCoeffs   number of cepstral coefficients, from 1 to the number of filters.
+   * @param[out]    pDctCoeffs  points to the buffer of the DCT matrix, numCoeffs*numFilters values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_mfcc_init_q15(
+        arm_mfcc_instance_q15 * S,
+  const arm_mel_filterbank_instance_q15 * pMel,
+        uint16_t numCoeffs,
+        q15_t * pDctCoeffs);
+
+  /**
+   * @brief Q15 MFCC of a spectrum.
+   * @param[in]  S          points to an instance of the Q15 MFCC structure.
+   * @param[in]  pSpectrum  points to the spectrum, in the format of arm_rfft_q15().
+   * @param[out] pDst       points to the coefficients in 8.7 format, numCoeffs values.
+   * @param[in]  pScratch   points to a scratch buffer of numFilters values.
+   */
+  void arm_mfcc_q15(
+  const arm_mfcc_instance_q15 * S,
+  const q15_t * pSpectrum,
+        q15_t * pDst,
+        q31_t * pScratch);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of frequencies. */
+    const float32_t *pCoeffs;               /**< points to the cosine and sine of each frequency, 2*numBins values. */
+          float32_t *pState;                /**< points to the state buffer, 2*numBins values. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of frequencies. */
+          uint32_t count;                   /**< number of samples since the last power readout. */
+    const q31_t *pCoeffs;                   /**< points to the cosine and sine of each frequency, 2*numBins values. */
+          q63_t *pState;                    /**< points to the state buffer, 2*numBins values. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[in,out] S        points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins  number of frequencies.
+   * @param[in]     pFreqs   points to the frequencies, in cycles per sample from 0 to 0.5, numBins values.
+   * @param[out]    pCoeffs  points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pState   points to the state buffer of 2*numBins values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief Processing function for the floating-point Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief Power at each frequency of the floating-point Goertzel filter bank, the state is cleared.
+   * @param[in,out] S     points to an instance of the floating-point Goertzel structure.
+   * @param[out]    pDst  points to the squared magnitudes, numBins values.
+   */
+  void arm_goertzel_power_f32(
+        arm_goertzel_instance_f32 * S,
+        float32_t * pDst);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[in,out] S        points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins  number of frequencies.
+   * @param[in]     pFreqs   points to the frequencies, in cycles per sample from 0 to 0.5, numBins values.
+   * @param[out]    pCoeffs  points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pState   points to the state buffer of 2*numBins values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+  const float32_t * pFreqs,
+        q31_t * pCoeffs,
+        q63_t * pState);
+
+  /**
+   * @brief Processing function for the Q31 Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief Power at each frequency of the Q31 Goertzel filter bank, the state is cleared.
+   * @param[in,out] S     points to an instance of the Q31 Goertzel structure.
+   * @param[out]    pDst  points to the squared magnitudes divided by the squared number of samples, numBins values.
+   */
+  void arm_goertzel_power_q31(
+        arm_goertzel_instance_q31 * S,
+        q31_t * pDst);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< length of the DFT window. */
+          uint16_t numBins;                 /**< number of DFT bins. */
+          uint16_t index;                   /**< oldest sample of the delay line. */
+          float32_t dampingN;               /**< damping factor raised to the power fftLen. */
+    const float32_t *pCoeffs;               /**< points to the twiddle factor of each bin, 2*numBins values. */
+          float32_t *pState;                /**< points to the complex bins, 2*numBins values. */
+          float32_t *pDelay;                /**< points to the delay line of fftLen values. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t fftLen;                  /**< length of the DFT window. */
+          uint16_t numBins;                 /**< number of DFT bins. */
+          uint16_t index;                   /**< oldest sample of the delay line. */
+          q31_t dampingN;                   /**< damping factor raised to the power fftLen. */
+    const q31_t *pCoeffs;                   /**< points to the twiddle factor of each bin, 2*numBins values. */
+          q63_t *pState;                    /**< points to the complex bins, 2*numBins values. */
+          q31_t *pDelay;                    /**< points to the delay line of fftLen values. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S        points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     fftLen   length of the DFT window.
+   * @param[in]     numBins  number of DFT bins.
+   * @param[in]     pBins    points to the bin indices, from 0 to fftLen/2, numBins values.
+   * @param[in]     damping  damping factor, 1 or slightly less.
+   * @param[out]    pCoeffs  points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pState   points to the state buffer of 2*numBins values.
+   * @param[in]     pDelay   points to the delay line of fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pDelay);
+
+  /**
+   * @brief Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the complex bins after the last sample, 2*numBins values, or NULL.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
 
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[in,out] S        points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     fftLen   length of the DFT window.
+   * @param[in]     numBins  number of DFT bins.
+   * @param[in]     pBins    points to the bin indices, from 0 to fftLen/2, numBins values.
+   * @param[in]     damping  damping factor, 1 or slightly less.
+   * @param[out]    pCoeffs  points to the coefficient buffer of 2*numBins values.
+   * @param[in]     pState   points to the state buffer of 2*numBins values.
+   * @param[in]     pDelay   points to the delay line of fftLen values.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t fftLen,
+        uint16_t numBins,
+  const uint16_t * pBins,
+        float32_t damping,
+        q31_t * pCoeffs,
+        q63_t * pState,
+        q31_t * pDelay);
 
   /**
-   * @brief Processing function for the Q15 DCT4/IDCT4.
-   * @param[in]     S              points to an instance of the Q15 DCT4 structure.
-   * @param[in]     pState         points to state buffer.
-   * @param[in,out] pInlineBuffer  points to the in-place input and output buffer.
+   * @brief Processing function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the complex bins divided by fftLen after the last sample, 2*numBins values, or NULL.
+   * @param[in]     blockSize  number of samples to process.
    */
-  void arm_dct4_q15(
-  const arm_dct4_instance_q15 * S,
-        q15_t * pState,
-        q15_t * pInlineBuffer);
+  void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
 
 
   /**
@@ -3705,6 +4487,176 @@ arm_status arm_fir_decimate_init_f32(
         uint32_t blockSize);
 
 
+  /**
+   * @brief Largest clock drift corrected by the polyphase resampler, in parts per billion.
+   */
+#ifndef ARM_RESAMPLE_MAX_DRIFT_PPB
+#define ARM_RESAMPLE_MAX_DRIFT_PPB   (1000000)
+#endif
+
+  /**
+   * @brief Proportional and integral gains of arm_resample_track(), in ppb per sample of level error.
+   */
+#ifndef ARM_RESAMPLE_TRACK_KP
+#define ARM_RESAMPLE_TRACK_KP        (2000)
+#endif
+#ifndef ARM_RESAMPLE_TRACK_KI
+#define ARM_RESAMPLE_TRACK_KI        (20)
+#endif
+
+  /**
+   * @brief Largest number of output samples of one call of the polyphase resampler for blockSize input samples.
+   */
+#define ARM_RESAMPLE_OUT_MAX(blockSize, fsIn, fsOut) \
+  ((uint32_t)(((((uint64_t)(blockSize) * (fsOut)) / (fsIn)) * 1001U) / 1000U) + 3U)
+
+  /**
+   * @brief Timing of the polyphase resampler, common to all data types.
+   */
+  typedef struct
+  {
+        uint16_t numPhases;            /**< number of polyphase filter components. */
+        uint16_t phaseLength;          /**< length of each polyphase filter component. */
+        uint32_t pos;                  /**< index in the state of the newest sample of the current window. */
+        uint64_t phase;                /**< position of the next output after that sample, in phases, Q32.32. */
+        uint64_t step;                 /**< input advance per output sample, in phases, Q32.32. */
+        uint64_t nominalStep;          /**< step for fsIn and fsOut without drift correction. */
+        int32_t drift;                 /**< current drift correction in ppb. */
+        int32_t integral;              /**< integral term of arm_resample_track(), in ppb. */
+  } arm_resample_clock;
+
+  /**
+   * @brief Instance structure for the Q15 polyphase resampler.
+   */
+  typedef struct
+  {
+        arm_resample_clock clk;        /**< timing of the resampler. */
+  const q15_t *pCoeffs;                /**< points to the polyphase coefficient table of numPhases*phaseLength values. */
+        q15_t *pState;                 /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point polyphase resampler.
+   */
+  typedef struct
+  {
+        arm_resample_clock clk;        /**< timing of the resampler. */
+  const float32_t *pCoeffs;            /**< points to the polyphase coefficient table of numPhases*phaseLength values. */
+        float32_t *pState;             /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_resample_instance_f32;
+
+  /**
+   * @brief  Initialization of the timing of the polyphase resampler, called by the initialization functions.
+   * @param[out] S            points to the timing structure.
+   * @param[in]  numPhases    number of polyphase filter components.
+   * @param[in]  phaseLength  length of each polyphase filter component.
+   * @param[in]  fsIn         input sample rate.
+   * @param[in]  fsOut        output sample rate.
+   * @return     The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_resample_clock_init(
+        arm_resample_clock * S,
+        uint16_t numPhases,
+        uint16_t phaseLength,
+        uint32_t fsIn,
+        uint32_t fsOut);
+
+  /**
+   * @brief  Sets the drift correction of the polyphase resampler.
+   * @param[in,out] S    points to the timing structure.
+   * @param[in]     ppb  input clock faster than nominal, relative to the output clock, in parts per billion.
+   */
+  void arm_resample_set_drift(
+        arm_resample_clock * S,
+        int32_t ppb);
+
+  /**
+   * @brief  Drift tracking of the polyphase resampler, proportional-integral loop on a buffer level.
+   * @param[in,out] S           points to the timing structure.
+   * @param[in]     levelError  level of the input buffer minus its target level, in samples.
+   * @return        drift correction applied, in ppb.
+   */
+  int32_t arm_resample_track(
+        arm_resample_clock * S,
+        int32_t levelError);
+
+  /**
+   * @brief Processing function for the Q15 polyphase resampler.
+   * @param[in,out] S          points to an instance of the Q15 resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_RESAMPLE_OUT_MAX(blockSize, fsIn, fsOut) samples.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_resample_q15(
+        arm_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 polyphase resampler.
+   * @param[in,out] S             points to an instance of the Q15 resampler structure.
+   * @param[in]     numPhases     number of polyphase filter components, the interpolation factor of the prototype filter.
+   * @param[in]     numTaps       number of coefficients of the prototype filter, a multiple of numPhases.
+   * @param[in]     pCoeffs       points to the prototype filter coefficients, in the order of arm_fir_interpolate_init_q15().
+   * @param[out]    pPhaseCoeffs  points to the buffer for the polyphase coefficient table, numTaps values.
+   * @param[in]     pState        points to the state buffer.
+   * @param[in]     fsIn          input sample rate.
+   * @param[in]     fsOut         output sample rate.
+   * @param[in]     blockSize     number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_resample_init_q15(
+        arm_resample_instance_q15 * S,
+        uint16_t numPhases,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pPhaseCoeffs,
+        q15_t * pState,
+        uint32_t fsIn,
+        uint32_t fsOut,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point polyphase resampler.
+   * @param[in,out] S          points to an instance of the floating-point resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of ARM_RESAMPLE_OUT_MAX(blockSize, fsIn, fsOut) samples.
+   * @param[in]     blockSize  number of input samples to process.
+   * @return        number of output samples written.
+   */
+  uint32_t arm_resample_f32(
+        arm_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point polyphase resampler.
+   * @param[in,out] S             points to an instance of the floating-point resampler structure.
+   * @param[in]     numPhases     number of polyphase filter components, the interpolation factor of the prototype filter.
+   * @param[in]     numTaps       number of coefficients of the prototype filter, a multiple of numPhases.
+   * @param[in]     pCoeffs       points to the prototype filter coefficients, in the order of arm_fir_interpolate_init_f32().
+   * @param[out]    pPhaseCoeffs  points to the buffer for the polyphase coefficient table, numTaps values.
+   * @param[in]     pState        points to the state buffer.
+   * @param[in]     fsIn          input sample rate.
+   * @param[in]     fsOut         output sample rate.
+   * @param[in]     blockSize     number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS, ARM_MATH_LENGTH_ERROR or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_resample_init_f32(
+        arm_resample_instance_f32 * S,
+        uint16_t numPhases,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pPhaseCoeffs,
+        float32_t * pState,
+        uint32_t fsIn,
+        uint32_t fsOut,
+        uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3852,6 +4804,46 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pState);
 
 
+  /**
+   * @brief Instance structure for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   */
+  typedef struct
+  {
+          uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+          uint16_t numChannels;      /**< number of interleaved channels. */
+          float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    const float32_t *pCoeffs;        /**< points to the array of coefficients.  The array is of length 5*numStages*numChannels. */
+  } arm_biquad_cascade_multi_df2T_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data
+   * @param[in]  blockSize  number of samples per channel to process.
+   */
+  void arm_biquad_cascade_multi_df2T_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter. N interleaved channels
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     pCoeffs      points to the filter coefficients of all channels.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_multi_df2T_init_f32(
+        arm_biquad_cascade_multi_df2T_instance_f32 * S,
+        uint16_t numChannels,
+        uint8_t numStages,
+  const float32_t * pCoeffs,
+        float32_t * pState);
+
+
   /**
    * @brief  Initialization function for the floating-point transposed direct form II Biquad cascade filter.
    * @param[in,out] S          points to an instance of the filter data structure.
@@ -5088,6 +6080,213 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  pSrc   points to the instance of the input matrix structure.
+   * @param[out] pDst   points to the instance of the output lower triangular matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Solves A * X = B in place, with the Cholesky factor L of A.
+   * @param[in]     pSrcL     points to the instance of the factor.
+   * @param[in,out] pSrcDst   points to the instance of B on input, X on output.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of L is zero.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+        arm_matrix_instance_f32 * pSrcDst);
+
+  /**
+   * @brief Floating-point LDL^t decomposition of a symmetric matrix, P * A * P^t = L * D * L^t.
+   * @param[in]  pSrc    points to the instance of the input matrix structure.
+   * @param[out] pDstL   points to the instance of the output unit lower triangular matrix structure.
+   * @param[out] pDstD   points to the output diagonal of D, numRows values.
+   * @param[out] pPerm   points to the output row and column interchanges, numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_DECOMPOSITION_FAILURE if the matrix is indefinite and needs a 2x2 pivot.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDstL,
+        float32_t * pDstD,
+        uint16_t * pPerm);
+
+  /**
+   * @brief Solves A * X = B in place, with the LDL^t decomposition of A.
+   * @param[in]     pSrcL     points to the instance of the factor L.
+   * @param[in]     pSrcD     points to the diagonal of D.
+   * @param[in]     pPerm     points to the interchanges.
+   * @param[in,out] pSrcDst   points to the instance of B on input, X on output.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if an element of D is zero.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const float32_t * pSrcD,
+  const uint16_t * pPerm,
+        arm_matrix_instance_f32 * pSrcDst);
+
+  /**
+   * @brief Floating-point Householder QR decomposition.
+   * @param[in]  pSrc   points to the instance of the input matrix structure, numRows >= numCols.
+   * @param[out] pDst   points to the instance of the output matrix structure, R and the reflections.
+   * @param[out] pTau   points to the output reflection factors, numCols values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_qr_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        float32_t * pTau);
+
+  /**
+   * @brief Solves A * X = B in place in the least squares sense, with the QR decomposition of A.
+   * @param[in]     pSrcQR    points to the instance of the decomposition.
+   * @param[in]     pTau      points to the reflection factors.
+   * @param[in,out] pSrcDst   points to the instance of B on input, X in the first numCols(A) rows on output.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if A is rank deficient.
+   */
+  arm_status arm_mat_qr_solve_f32(
+  const arm_matrix_instance_f32 * pSrcQR,
+  const float32_t * pTau,
+        arm_matrix_instance_f32 * pSrcDst);
+
+  /**
+   * @brief Solves L * X = A for a lower triangular matrix L.
+   * @param[in]  pSrcL   points to the instance of the lower triangular matrix structure.
+   * @param[in]  pSrc    points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst    points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of L is zero.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcL,
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Solves U * X = A for an upper triangular matrix U.
+   * @param[in]  pSrcU   points to the instance of the upper triangular matrix structure.
+   * @param[in]  pSrc    points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst    points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of U is zero.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pSrcU,
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  pSrc   points to the instance of the input matrix structure.
+   * @param[out] pDst   points to the instance of the output lower triangular matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_DECOMPOSITION_FAILURE if the input matrix is not positive definite.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Solves A * X = B in place, with the Cholesky factor L of A, 64 bit floating-point.
+   * @param[in]     pSrcL     points to the instance of the factor.
+   * @param[in,out] pSrcDst   points to the instance of B on input, X on output.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of L is zero.
+   */
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+        arm_matrix_instance_f64 * pSrcDst);
+
+  /**
+   * @brief Floating-point (64 bit) LDL^t decomposition of a symmetric matrix, P * A * P^t = L * D * L^t.
+   * @param[in]  pSrc    points to the instance of the input matrix structure.
+   * @param[out] pDstL   points to the instance of the output unit lower triangular matrix structure.
+   * @param[out] pDstD   points to the output diagonal of D, numRows values.
+   * @param[out] pPerm   points to the output row and column interchanges, numRows values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_DECOMPOSITION_FAILURE if the matrix is indefinite and needs a 2x2 pivot.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDstL,
+        float64_t * pDstD,
+        uint16_t * pPerm);
+
+  /**
+   * @brief Solves A * X = B in place, with the LDL^t decomposition of A, 64 bit floating-point.
+   * @param[in]     pSrcL     points to the instance of the factor L.
+   * @param[in]     pSrcD     points to the diagonal of D.
+   * @param[in]     pPerm     points to the interchanges.
+   * @param[in,out] pSrcDst   points to the instance of B on input, X on output.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if an element of D is zero.
+   */
+  arm_status arm_mat_ldlt_solve_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const float64_t * pSrcD,
+  const uint16_t * pPerm,
+        arm_matrix_instance_f64 * pSrcDst);
+
+  /**
+   * @brief Floating-point (64 bit) Householder QR decomposition.
+   * @param[in]  pSrc   points to the instance of the input matrix structure, numRows >= numCols.
+   * @param[out] pDst   points to the instance of the output matrix structure, R and the reflections.
+   * @param[out] pTau   points to the output reflection factors, numCols values.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   */
+  arm_status arm_mat_qr_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDst,
+        float64_t * pTau);
+
+  /**
+   * @brief Solves A * X = B in place in the least squares sense, with the QR decomposition of A, 64 bit floating-point.
+   * @param[in]     pSrcQR    points to the instance of the decomposition.
+   * @param[in]     pTau      points to the reflection factors.
+   * @param[in,out] pSrcDst   points to the instance of B on input, X in the first numCols(A) rows on output.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if A is rank deficient.
+   */
+  arm_status arm_mat_qr_solve_f64(
+  const arm_matrix_instance_f64 * pSrcQR,
+  const float64_t * pTau,
+        arm_matrix_instance_f64 * pSrcDst);
+
+  /**
+   * @brief Solves L * X = A for a lower triangular matrix L, 64 bit floating-point.
+   * @param[in]  pSrcL   points to the instance of the lower triangular matrix structure.
+   * @param[in]  pSrc    points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst    points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of L is zero.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcL,
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Solves U * X = A for an upper triangular matrix U, 64 bit floating-point.
+   * @param[in]  pSrcU   points to the instance of the upper triangular matrix structure.
+   * @param[in]  pSrc    points to the instance of the right-hand side matrix structure.
+   * @param[out] pDst    points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match,
+   * or ARM_MATH_SINGULAR if a diagonal element of U is zero.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pSrcU,
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDst);
+
+
 
   /**
    * @ingroup groupController
@@ -6678,6 +7877,239 @@ arm_status arm_sqrt_q15(
         uint32_t * pIndex);
 
 
+  /**
+   * @brief Running statistics of a floating-point stream.
+   */
+  typedef struct
+  {
+        uint32_t count;                /**< number of samples accumulated. */
+        float32_t mean;                /**< mean of the samples. */
+        float32_t m2;                  /**< sum of the squared deviations from the mean. */
+        float32_t min;                 /**< minimum value. */
+        float32_t max;                 /**< maximum value. */
+        uint32_t minIndex;             /**< index of the first minimum in the stream. */
+        uint32_t maxIndex;             /**< index of the first maximum in the stream. */
+  } arm_stats_instance_f32;
+
+  /**
+   * @brief Running statistics of a Q31 stream.
+   */
+  typedef struct
+  {
+        uint32_t count;                /**< number of samples accumulated. */
+        q63_t sum;                     /**< sum of the samples, 33.31 format. */
+        q63_t sum8;                    /**< sum of the samples shifted right by 8 bits, 41.23 format. */
+        q63_t sumOfSquares;            /**< sum of the squares of the shifted samples, 18.46 format. */
+        q31_t min;                     /**< minimum value. */
+        q31_t max;                     /**< maximum value. */
+        uint32_t minIndex;             /**< index of the first minimum in the stream. */
+        uint32_t maxIndex;             /**< index of the first maximum in the stream. */
+  } arm_stats_instance_q31;
+
+  /**
+   * @brief Running statistics of a Q15 stream.
+   */
+  typedef struct
+  {
+        uint32_t count;                /**< number of samples accumulated. */
+        q63_t sum;                     /**< sum of the samples, 49.15 format. */
+        q63_t sumOfSquares;            /**< sum of the squares of the samples, 34.30 format. */
+        q15_t min;                     /**< minimum value. */
+        q15_t max;                     /**< maximum value. */
+        uint32_t minIndex;             /**< index of the first minimum in the stream. */
+        uint32_t maxIndex;             /**< index of the first maximum in the stream. */
+  } arm_stats_instance_q15;
+
+  /**
+   * @brief Summary statistics of a floating-point vector.
+   */
+  typedef struct
+  {
+        float32_t mean;                /**< mean, as arm_mean_f32(). */
+        float32_t var;                 /**< sample variance, as arm_var_f32(). */
+        float32_t std;                 /**< standard deviation, as arm_std_f32(). */
+        float32_t rms;                 /**< root mean square, as arm_rms_f32(). */
+        float32_t power;               /**< sum of the squares, as arm_power_f32(). */
+        float32_t min;                 /**< minimum value. */
+        float32_t max;                 /**< maximum value. */
+        uint32_t minIndex;             /**< index of the first minimum. */
+        uint32_t maxIndex;             /**< index of the first maximum. */
+  } arm_stats_summary_f32;
+
+  /**
+   * @brief Summary statistics of a Q31 vector.
+   */
+  typedef struct
+  {
+        q31_t mean;                    /**< mean, as arm_mean_q31(). */
+        q31_t var;                     /**< sample variance, 1.31 format. */
+        q31_t std;                     /**< standard deviation, as arm_std_q31(). */
+        q31_t rms;                     /**< root mean square, 1.31 format. */
+        q63_t power;                   /**< sum of the squares, 16.48 format as arm_power_q31(). */
+        q31_t min;                     /**< minimum value. */
+        q31_t max;                     /**< maximum value. */
+        uint32_t minIndex;             /**< index of the first minimum. */
+        uint32_t maxIndex;             /**< index of the first maximum. */
+  } arm_stats_summary_q31;
+
+  /**
+   * @brief Summary statistics of a Q15 vector.
+   */
+  typedef struct
+  {
+        q15_t mean;                    /**< mean, as arm_mean_q15(). */
+        q15_t var;                     /**< sample variance, 1.15 format. */
+        q15_t std;                     /**< standard deviation, as arm_std_q15(). */
+        q15_t rms;                     /**< root mean square, as arm_rms_q15(). */
+        q63_t power;                   /**< sum of the squares, 34.30 format as arm_power_q15(). */
+        q15_t min;                     /**< minimum value. */
+        q15_t max;                     /**< maximum value. */
+        uint32_t minIndex;             /**< index of the first minimum. */
+        uint32_t maxIndex;             /**< index of the first maximum. */
+  } arm_stats_summary_q15;
+
+  /**
+   * @brief Summary statistics of a floating-point vector, in one pass.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  blockSize  length of the input vector
+   * @param[out] pResult    summary statistics returned here
+   */
+  void arm_stats_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_summary_f32 * pResult);
+
+  /**
+   * @brief Initialization function for the floating-point running statistics.
+   * @param[out] S  points to an instance of the running statistics structure.
+   */
+  void arm_stats_init_f32(
+        arm_stats_instance_f32 * S);
+
+  /**
+   * @brief Adds a block of samples to the floating-point running statistics.
+   * @param[in,out] S          points to an instance of the running statistics structure.
+   * @param[in]     pSrc       points to the block of input data
+   * @param[in]     blockSize  number of samples to add
+   */
+  void arm_stats_accumulate_f32(
+        arm_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief Merges the floating-point running statistics of the samples following those of S.
+   * @param[in,out] S       points to an instance of the running statistics structure.
+   * @param[in]     pOther  points to the running statistics of the following samples.
+   */
+  void arm_stats_merge_f32(
+        arm_stats_instance_f32 * S,
+  const arm_stats_instance_f32 * pOther);
+
+  /**
+   * @brief Summary statistics of the samples accumulated in the floating-point running statistics.
+   * @param[in]  S        points to an instance of the running statistics structure.
+   * @param[out] pResult  summary statistics returned here
+   */
+  void arm_stats_get_f32(
+  const arm_stats_instance_f32 * S,
+        arm_stats_summary_f32 * pResult);
+
+  /**
+   * @brief Summary statistics of a Q31 vector, in one pass.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  blockSize  length of the input vector
+   * @param[out] pResult    summary statistics returned here
+   */
+  void arm_stats_q31(
+  const q31_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_summary_q31 * pResult);
+
+  /**
+   * @brief Initialization function for the Q31 running statistics.
+   * @param[out] S  points to an instance of the running statistics structure.
+   */
+  void arm_stats_init_q31(
+        arm_stats_instance_q31 * S);
+
+  /**
+   * @brief Adds a block of samples to the Q31 running statistics.
+   * @param[in,out] S          points to an instance of the running statistics structure.
+   * @param[in]     pSrc       points to the block of input data
+   * @param[in]     blockSize  number of samples to add
+   */
+  void arm_stats_accumulate_q31(
+        arm_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief Merges the Q31 running statistics of the samples following those of S.
+   * @param[in,out] S       points to an instance of the running statistics structure.
+   * @param[in]     pOther  points to the running statistics of the following samples.
+   */
+  void arm_stats_merge_q31(
+        arm_stats_instance_q31 * S,
+  const arm_stats_instance_q31 * pOther);
+
+  /**
+   * @brief Summary statistics of the samples accumulated in the Q31 running statistics.
+   * @param[in]  S        points to an instance of the running statistics structure.
+   * @param[out] pResult  summary statistics returned here
+   */
+  void arm_stats_get_q31(
+  const arm_stats_instance_q31 * S,
+        arm_stats_summary_q31 * pResult);
+
+  /**
+   * @brief Summary statistics of a Q15 vector, in one pass.
+   * @param[in]  pSrc       points to the input vector
+   * @param[in]  blockSize  length of the input vector
+   * @param[out] pResult    summary statistics returned here
+   */
+  void arm_stats_q15(
+  const q15_t * pSrc,
+        uint32_t blockSize,
+        arm_stats_summary_q15 * pResult);
+
+  /**
+   * @brief Initialization function for the Q15 running statistics.
+   * @param[out] S  points to an instance of the running statistics structure.
+   */
+  void arm_stats_init_q15(
+        arm_stats_instance_q15 * S);
+
+  /**
+   * @brief Adds a block of samples to the Q15 running statistics.
+   * @param[in,out] S          points to an instance of the running statistics structure.
+   * @param[in]     pSrc       points to the block of input data
+   * @param[in]     blockSize  number of samples to add
+   */
+  void arm_stats_accumulate_q15(
+        arm_stats_instance_q15 * S,
+  const q15_t * pSrc,
+        uint32_t blockSize);
+
+  /**
+   * @brief Merges the Q15 running statistics of the samples following those of S.
+   * @param[in,out] S       points to an instance of the running statistics structure.
+   * @param[in]     pOther  points to the running statistics of the following samples.
+   */
+  void arm_stats_merge_q15(
+        arm_stats_instance_q15 * S,
+  const arm_stats_instance_q15 * pOther);
+
+  /**
+   * @brief Summary statistics of the samples accumulated in the Q15 running statistics.
+   * @param[in]  S        points to an instance of the running statistics structure.
+   * @param[out] pResult  summary statistics returned here
+   */
+  void arm_stats_get_q15(
+  const arm_stats_instance_q15 * S,
+        arm_stats_summary_q15 * pResult);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pin_mux.h"
+#include "clock_config.h"
+#include "board.h"
+#include "fsl_debug_console.h"
+#include "fsl_cache.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define BUFF_LENGTH      512U
+#define BENCH_RUNS       8U
+#define EXAMPLE_DDR_BASE 0x80000000U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* Cached in the ddr targets, where the data is in DDR and BOARD_InitMemory() makes it cacheable. */
+SDK_ALIGN(static uint32_t s_cached[BUFF_LENGTH / 4U], 32);
+AT_NONCACHEABLE_SECTION_ALIGN(static uint32_t s_uncached[BUFF_LENGTH / 4U], 32);
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void BENCH_InitCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/* Reads a message word by word, as a parser does. */
+static uint32_t BENCH_Read(const volatile uint32_t *data, uint32_t size)
+{
+    uint32_t sum = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < size / 4U; i++)
+    {
+        sum += data[i];
+    }
+
+    return sum;
+}
+
+static void BENCH_Access(uint32_t size)
+{
+    uint32_t invalidateCycles = UINT32_MAX;
+    uint32_t missCycles       = UINT32_MAX;
+    uint32_t hitCycles        = UINT32_MAX;
+    uint32_t uncachedCycles   = UINT32_MAX;
+    uint32_t expected;
+    uint32_t sum;
+    uint32_t start;
+    uint32_t invalidated;
+    uint32_t cycles;
+    uint32_t run;
+
+    expected = BENCH_Read(s_uncached, size);
+
+    /* The minimum of the runs, to leave out the interrupts. */
+    for (run = 0U; run < BENCH_RUNS; run++)
+    {
+        /* The lines of the message are in the cache, as after the previous message. */
+        (void)BENCH_Read(s_cached, size);
+
+        /* A new message arrives: invalidate, then read it from the memory. */
+        start = DWT->CYCCNT;
+        DCACHE_InvalidateByRangeOrAll((uint32_t)s_cached, size);
+        invalidated = DWT->CYCCNT;
+        sum         = BENCH_Read(s_cached, size);
+        cycles      = DWT->CYCCNT;
+        if (sum != expected)
+        {
+            s_failures++;
+        }
+        invalidateCycles = MIN(invalidateCycles, invalidated - start);
+        missCycles       = MIN(missCycles, cycles - start);
+
+        /* The message is read again while it is parsed. */
+        start  = DWT->CYCCNT;
+        sum    = BENCH_Read(s_cached, size);
+        cycles = DWT->CYCCNT - start;
+        if (sum != expected)
+        {
+            s_failures++;
+        }
+        hitCycles = MIN(hitCycles, cycles);
+
+        start  = DWT->CYCCNT;
+        sum    = BENCH_Read(s_uncached, size);
+        cycles = DWT->CYCCNT - start;
+        if (sum != expected)
+        {
+            s_failures++;
+        }
+        uncachedCycles = MIN(uncachedCycles, cycles);
+    }
+
+    PRINTF("%8u %10u %10u %10u %10u\r\n", size, invalidateCycles, missCycles, hitCycles, uncachedCycles);
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    static const uint32_t sizes[] = {16U, 64U, 256U, 496U};
+    uint32_t i;
+
+    sc_ipc_t ipc;
+
+    ipc = BOARD_InitRpc();
+
+    BOARD_InitPins(ipc);
+    BOARD_BootClockRUN();
+    BOARD_InitMemory();
+    BOARD_InitDebugConsole();
+
+    PRINTF("Cache benchmark begin.\r\n\r\n");
+
+    if ((uint32_t)s_cached < EXAMPLE_DDR_BASE)
+    {
+        PRINTF("The buffers are not in DDR, run the ddr_debug or ddr_release target.\r\n\r\n");
+    }
+
+    for (i = 0U; i < ARRAY_SIZE(s_cached); i++)
+    {
+        s_cached[i]   = i * 0x01010101U + 0x5AU;
+        s_uncached[i] = s_cached[i];
+    }
+    DCACHE_CleanByRange((uint32_t)s_cached, sizeof(s_cached));
+
+    BENCH_InitCycleCounter();
+
+    PRINTF("   bytes invalidate inv + read   hit read   uncached\r\n");
+    for (i = 0U; i < ARRAY_SIZE(sizes); i++)
+    {
+        BENCH_Access(sizes[i]);
+    }
+
+    PRINTF("\r\nCache benchmark finish, %u failures.\r\n", s_failures);
+
+    while (1)
+    {
+    }
+}
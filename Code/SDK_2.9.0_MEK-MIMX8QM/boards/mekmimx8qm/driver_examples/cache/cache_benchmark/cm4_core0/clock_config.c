@@ -0,0 +1,33 @@
+/*
+ * Copyright 2017 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_common.h"
+#include "clock_config.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* System clock frequency. */
+extern uint32_t SystemCoreClock;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void BOARD_BootClockVLPR(void)
+{
+    SystemCoreClockUpdate();
+}
+
+void BOARD_BootClockRUN(void)
+{
+    SystemCoreClockUpdate();
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "pin_mux.h"
+#include "clock_config.h"
+#include "board.h"
+#include "fsl_debug_console.h"
+#include "fsl_edma.h"
+#include "fsl_component_dma_copy.h"
+
+#include "fsl_irqsteer.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define EXAMPLE_DMA_CHANNEL  30U
+#define EXAMPLE_DMA_BASEADDR DMA__EDMA0
+#define BUFF_LENGTH          (32U * 1024U)
+#define TCD_COUNT            32U
+#define BATCH_COPIES         64U
+#define BATCH_COPY_LENGTH    256U
+#define RECT_WIDTH           128U
+#define RECT_HEIGHT          128U
+#define RECT_SRC_PITCH       256U
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+AT_NONCACHEABLE_SECTION_ALIGN(static edma_tcd_t s_tcdPool[TCD_COUNT], 32);
+SDK_ALIGN(static uint8_t s_src[BUFF_LENGTH], 32);
+SDK_ALIGN(static uint8_t s_dest[BUFF_LENGTH], 32);
+static dma_copy_handle_t s_copyHandle;
+static dma_copy_request_t s_requests[BATCH_COPIES];
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void BENCH_InitCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static void BENCH_Check(const char *name, const uint8_t *expected, uint32_t size)
+{
+    if (memcmp(s_dest, expected, size) != 0)
+    {
+        PRINTF("%s: data mismatch\r\n", name);
+        s_failures++;
+    }
+}
+
+/* CPU cycles of an idle loop iteration, to turn the iterations counted during a DMA copy into free cycles. */
+static uint32_t BENCH_CalibrateIdleLoop(void)
+{
+    volatile uint32_t iterations = 0U;
+    uint32_t start               = DWT->CYCCNT;
+
+    while (iterations < 10000U)
+    {
+        iterations++;
+    }
+
+    return (DWT->CYCCNT - start) / 10000U;
+}
+
+static void BENCH_Copy(uint32_t size, uint32_t idleLoopCycles)
+{
+    dma_copy_request_t *request = &s_requests[0];
+    volatile uint32_t idle      = 0U;
+    uint32_t cpuCycles;
+    uint32_t submitCycles;
+    uint32_t dmaCycles;
+    uint32_t start;
+
+    (void)memset(s_dest, 0, size);
+    start = DWT->CYCCNT;
+    (void)memcpy(s_dest, s_src, size);
+    cpuCycles = DWT->CYCCNT - start;
+    BENCH_Check("memcpy", s_src, size);
+
+    (void)memset(s_dest, 0, size);
+    start = DWT->CYCCNT;
+    (void)DMA_COPY_Memcpy(&s_copyHandle, request, s_dest, s_src, size, NULL, NULL);
+    submitCycles = DWT->CYCCNT - start;
+    while (DMA_COPY_GetStatus(request) == kStatus_DMA_COPY_Pending)
+    {
+        idle++;
+    }
+    dmaCycles = DWT->CYCCNT - start;
+    BENCH_Check("DMA copy", s_src, size);
+
+    PRINTF("%8u %10u %10u %10u %9u%%\r\n", size, cpuCycles, dmaCycles, submitCycles,
+           (dmaCycles != 0U) ? ((idle * idleLoopCycles * 100U) / dmaCycles) : 0U);
+}
+
+static void BENCH_Batch(void)
+{
+    uint32_t singleCycles;
+    uint32_t batchCycles;
+    uint32_t start;
+    uint32_t i;
+
+    /* One chain per copy. */
+    (void)memset(s_dest, 0, BATCH_COPIES * BATCH_COPY_LENGTH);
+    start = DWT->CYCCNT;
+    for (i = 0U; i < BATCH_COPIES; i++)
+    {
+        (void)DMA_COPY_Memcpy(&s_copyHandle, &s_requests[i], &s_dest[i * BATCH_COPY_LENGTH],
+                              &s_src[i * BATCH_COPY_LENGTH], BATCH_COPY_LENGTH, NULL, NULL);
+        (void)DMA_COPY_Wait(&s_requests[i]);
+    }
+    singleCycles = DWT->CYCCNT - start;
+    BENCH_Check("single copies", s_src, BATCH_COPIES * BATCH_COPY_LENGTH);
+
+    /* One chain for all the copies. */
+    (void)memset(s_dest, 0, BATCH_COPIES * BATCH_COPY_LENGTH);
+    start = DWT->CYCCNT;
+    DMA_COPY_BeginBatch(&s_copyHandle);
+    for (i = 0U; i < BATCH_COPIES; i++)
+    {
+        (void)DMA_COPY_Memcpy(&s_copyHandle, &s_requests[i], &s_dest[i * BATCH_COPY_LENGTH],
+                              &s_src[i * BATCH_COPY_LENGTH], BATCH_COPY_LENGTH, NULL, NULL);
+    }
+    DMA_COPY_EndBatch(&s_copyHandle);
+    for (i = 0U; i < BATCH_COPIES; i++)
+    {
+        (void)DMA_COPY_Wait(&s_requests[i]);
+    }
+    batchCycles = DWT->CYCCNT - start;
+    BENCH_Check("batched copies", s_src, BATCH_COPIES * BATCH_COPY_LENGTH);
+
+    PRINTF("%u copies of %u bytes: %u cycles one by one, %u cycles batched\r\n", BATCH_COPIES, BATCH_COPY_LENGTH,
+           singleCycles, batchCycles);
+}
+
+static void BENCH_Rectangle(void)
+{
+    static uint8_t s_expected[RECT_WIDTH * RECT_HEIGHT];
+    uint32_t cpuCycles;
+    uint32_t dmaCycles;
+    uint32_t start;
+    uint32_t line;
+
+    for (line = 0U; line < RECT_HEIGHT; line++)
+    {
+        (void)memcpy(&s_expected[line * RECT_WIDTH], &s_src[line * RECT_SRC_PITCH], RECT_WIDTH);
+    }
+
+    (void)memset(s_dest, 0, sizeof(s_expected));
+    start = DWT->CYCCNT;
+    for (line = 0U; line < RECT_HEIGHT; line++)
+    {
+        (void)memcpy(&s_dest[line * RECT_WIDTH], &s_src[line * RECT_SRC_PITCH], RECT_WIDTH);
+    }
+    cpuCycles = DWT->CYCCNT - start;
+
+    (void)memset(s_dest, 0, sizeof(s_expected));
+    start = DWT->CYCCNT;
+    (void)DMA_COPY_Memcpy2D(&s_copyHandle, &s_requests[0], s_dest, RECT_WIDTH, s_src, RECT_SRC_PITCH, RECT_WIDTH,
+                            RECT_HEIGHT, NULL, NULL);
+    (void)DMA_COPY_Wait(&s_requests[0]);
+    dmaCycles = DWT->CYCCNT - start;
+    BENCH_Check("rectangle copy", s_expected, sizeof(s_expected));
+
+    PRINTF("%ux%u rectangle: %u cycles CPU, %u cycles DMA\r\n", RECT_WIDTH, RECT_HEIGHT, cpuCycles, dmaCycles);
+}
+
+static void BENCH_Fill(void)
+{
+    uint32_t cpuCycles;
+    uint32_t dmaCycles;
+    uint32_t start;
+
+    start = DWT->CYCCNT;
+    (void)memset(s_dest, 0xA5, BUFF_LENGTH);
+    cpuCycles = DWT->CYCCNT - start;
+
+    (void)memset(s_dest, 0, BUFF_LENGTH);
+    start = DWT->CYCCNT;
+    (void)DMA_COPY_Memset(&s_copyHandle, &s_requests[0], s_dest, 0xA5U, BUFF_LENGTH, NULL, NULL);
+    (void)DMA_COPY_Wait(&s_requests[0]);
+    dmaCycles = DWT->CYCCNT - start;
+    (void)memset(s_src, 0xA5, BUFF_LENGTH);
+    BENCH_Check("fill", s_src, BUFF_LENGTH);
+
+    PRINTF("%u bytes fill: %u cycles CPU, %u cycles DMA\r\n", BUFF_LENGTH, cpuCycles, dmaCycles);
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    static const uint32_t sizes[] = {64U, 256U, 1024U, 4096U, 16384U, BUFF_LENGTH};
+    edma_config_t userConfig;
+    dma_copy_config_t copyConfig;
+    uint32_t idleLoopCycles;
+    uint32_t i;
+
+    sc_ipc_t ipc;
+
+    ipc = BOARD_InitRpc();
+
+    BOARD_InitPins(ipc);
+    BOARD_BootClockRUN();
+    BOARD_InitMemory();
+    BOARD_InitDebugConsole();
+
+    /* Power on EDMA Channel*/
+    if (sc_pm_set_resource_power_mode(ipc, SC_R_DMA_0_CH30, SC_PM_PW_MODE_ON) != SC_ERR_NONE)
+    {
+        PRINTF("Error: Failed to power on DMA Channel\r\n");
+    }
+
+    if (sc_pm_set_resource_power_mode(ipc, SC_R_IRQSTR_M4_0, SC_PM_PW_MODE_ON) != SC_ERR_NONE)
+    {
+        PRINTF("Error: Failed to power on IRQSTEER\r\n");
+    }
+
+    /* Enable interrupt in irqsteer */
+    IRQSTEER_Init(IRQSTEER);
+    IRQSTEER_EnableInterrupt(IRQSTEER, DMA_EXTERNAL_DMA_INT_0_IRQn);
+
+    PRINTF("DMA copy benchmark begin.\r\n\r\n");
+
+    EDMA_GetDefaultConfig(&userConfig);
+    EDMA_Init(EXAMPLE_DMA_BASEADDR, &userConfig);
+
+    DMA_COPY_GetDefaultConfig(&copyConfig);
+    copyConfig.base     = EXAMPLE_DMA_BASEADDR;
+    copyConfig.channel  = EXAMPLE_DMA_CHANNEL;
+    copyConfig.tcdPool  = s_tcdPool;
+    copyConfig.tcdCount = TCD_COUNT;
+    /* Measure the eDMA for all the sizes. */
+    copyConfig.cpuCopyThreshold = 0U;
+    DMA_COPY_Init(&s_copyHandle, &copyConfig);
+
+    for (i = 0U; i < BUFF_LENGTH; i++)
+    {
+        s_src[i] = (uint8_t)(i * 7U + (i >> 8));
+    }
+
+    BENCH_InitCycleCounter();
+    idleLoopCycles = BENCH_CalibrateIdleLoop();
+
+    PRINTF("   bytes   CPU copy   DMA copy DMA submit  CPU free\r\n");
+    for (i = 0U; i < ARRAY_SIZE(sizes); i++)
+    {
+        BENCH_Copy(sizes[i], idleLoopCycles);
+    }
+    PRINTF("\r\n");
+
+    BENCH_Batch();
+    BENCH_Rectangle();
+    BENCH_Fill();
+
+    PRINTF("\r\nDMA copy benchmark finish, %u failures.\r\n", s_failures);
+
+    while (1)
+    {
+    }
+}
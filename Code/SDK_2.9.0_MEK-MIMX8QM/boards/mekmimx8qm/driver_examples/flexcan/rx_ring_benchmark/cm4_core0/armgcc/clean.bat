@@ -0,0 +1,3 @@
+RD /s /Q debug release ddr_debug ddr_release flash_debug flash_release CMakeFiles
+DEL /s /Q /F Makefile cmake_install.cmake CMakeCache.txt
+pause
@@ -0,0 +1,2 @@
+# config to select component, the format is CONFIG_USE_${component}
+set(CONFIG_USE_driver_lpuart_MIMX8QM6_cm4_core0 true)
@@ -0,0 +1,334 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_debug_console.h"
+#include "fsl_flexcan.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#include "board.h"
+
+#include "fsl_irqsteer.h"
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define EXAMPLE_CAN          DMA__CAN0
+#define EXAMPLE_CAN_CLK_FREQ CLOCK_GetIpFreq(kCLOCK_DMA_Can0)
+/* MB0 is the reserved Tx MB of ERR005641, the Rx FIFO is disabled. */
+#define TX_MESSAGE_BUFFER_FIRST (1U)
+#define TX_MESSAGE_BUFFER_COUNT (4U)
+#define RX_MESSAGE_BUFFER_FIRST (8U)
+#define RX_MESSAGE_BUFFER_COUNT (8U)
+#define RX_RING_ENTRIES         (64U)
+#define TX_ID                   (0x123U)
+/* Each run loads the bus for one second. */
+#define BENCH_RUN_CYCLES SystemCoreClock
+
+/* Fix MISRA_C-2012 Rule 17.7. */
+#define LOG_INFO (void)PRINTF
+
+typedef enum _bench_mode
+{
+    kBENCH_Idle = 0U,  /*!< No traffic, the reference of the idle loop. */
+    kBENCH_TxOnly,     /*!< The Tx Message Buffers load the bus, no Rx Message Buffer. */
+    kBENCH_MbTransfer, /*!< One transactional receive per Rx Message Buffer and frame. */
+    kBENCH_RxRing,     /*!< The Rx Message Buffers are drained into the receive ring. */
+} bench_mode_t;
+
+typedef struct _bench_result
+{
+    uint32_t idle;     /*!< Iterations of the idle loop. */
+    uint32_t txFrames; /*!< Frames sent. */
+    uint32_t rxFrames; /*!< Frames received. */
+    uint32_t batches;  /*!< Callbacks with received frames. */
+} bench_result_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static flexcan_handle_t s_flexcanHandle;
+static flexcan_mb_transfer_t s_txXfer[TX_MESSAGE_BUFFER_COUNT];
+static flexcan_mb_transfer_t s_rxXfer[RX_MESSAGE_BUFFER_COUNT];
+static flexcan_frame_t s_txFrame;
+static flexcan_frame_t s_rxFrames[RX_MESSAGE_BUFFER_COUNT];
+static flexcan_rx_ring_entry_t s_ringEntries[RX_RING_ENTRIES];
+static flexcan_rx_ring_t s_ring;
+static volatile bool s_running;
+static volatile uint32_t s_txCount;
+static volatile uint32_t s_rxCount;
+static volatile uint32_t s_batchCount;
+static volatile uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void BENCH_InitCycleCounter(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t BENCH_GetTimestamp(void)
+{
+    return DWT->CYCCNT;
+}
+
+static void BENCH_CheckFrame(const flexcan_frame_t *frame)
+{
+    if ((frame->id != FLEXCAN_ID_STD(TX_ID)) || (frame->dataWord0 != s_txFrame.dataWord0) ||
+        (frame->dataWord1 != s_txFrame.dataWord1))
+    {
+        s_failures++;
+    }
+}
+
+/*!
+ * @brief FlexCAN Call Back function
+ */
+static void flexcan_callback(CAN_Type *base, flexcan_handle_t *handle, status_t status, uint32_t result, void *userData)
+{
+    switch (status)
+    {
+        /* One frame of a transactional receive, re-armed at once. */
+        case kStatus_FLEXCAN_RxIdle:
+            BENCH_CheckFrame(&s_rxFrames[result - RX_MESSAGE_BUFFER_FIRST]);
+            s_rxCount++;
+            s_batchCount++;
+            (void)FLEXCAN_TransferReceiveNonBlocking(base, handle, &s_rxXfer[result - RX_MESSAGE_BUFFER_FIRST]);
+            break;
+
+        /* A batch of frames in the ring, read by the main loop. */
+        case kStatus_FLEXCAN_RxRingReady:
+            s_batchCount++;
+            break;
+
+        /* Keep the bus loaded. */
+        case kStatus_FLEXCAN_TxIdle:
+            s_txCount++;
+            if (s_running)
+            {
+                (void)FLEXCAN_TransferSendNonBlocking(base, handle, &s_txXfer[result - TX_MESSAGE_BUFFER_FIRST]);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void BENCH_Run(bench_mode_t mode, bench_result_t *result)
+{
+    flexcan_config_t flexcanConfig;
+    flexcan_rx_mb_config_t mbConfig;
+    flexcan_rx_ring_config_t ringConfig;
+    const flexcan_rx_ring_entry_t *entry;
+    uint32_t idle = 0U;
+    uint32_t start;
+    uint32_t i;
+
+    FLEXCAN_GetDefaultConfig(&flexcanConfig);
+#if defined(EXAMPLE_CAN_CLK_SOURCE)
+    flexcanConfig.clkSrc = EXAMPLE_CAN_CLK_SOURCE;
+#endif
+    flexcanConfig.maxMbNum       = RX_MESSAGE_BUFFER_FIRST + RX_MESSAGE_BUFFER_COUNT;
+    flexcanConfig.enableLoopBack = true;
+    FLEXCAN_Init(EXAMPLE_CAN, &flexcanConfig, EXAMPLE_CAN_CLK_FREQ);
+
+    FLEXCAN_TransferCreateHandle(EXAMPLE_CAN, &s_flexcanHandle, flexcan_callback, NULL);
+
+    s_txCount    = 0U;
+    s_rxCount    = 0U;
+    s_batchCount = 0U;
+
+    /* All the Rx Message Buffers accept the frames of the Tx Message Buffers. */
+    if (kBENCH_TxOnly < mode)
+    {
+        mbConfig.format = kFLEXCAN_FrameFormatStandard;
+        mbConfig.type   = kFLEXCAN_FrameTypeData;
+        mbConfig.id     = FLEXCAN_ID_STD(TX_ID);
+        for (i = 0U; i < RX_MESSAGE_BUFFER_COUNT; i++)
+        {
+            FLEXCAN_SetRxMbConfig(EXAMPLE_CAN, (uint8_t)(RX_MESSAGE_BUFFER_FIRST + i), &mbConfig, true);
+        }
+    }
+
+    if (kBENCH_MbTransfer == mode)
+    {
+        for (i = 0U; i < RX_MESSAGE_BUFFER_COUNT; i++)
+        {
+            s_rxXfer[i].mbIdx = (uint8_t)(RX_MESSAGE_BUFFER_FIRST + i);
+            s_rxXfer[i].frame = &s_rxFrames[i];
+            (void)FLEXCAN_TransferReceiveNonBlocking(EXAMPLE_CAN, &s_flexcanHandle, &s_rxXfer[i]);
+        }
+    }
+    else if (kBENCH_RxRing == mode)
+    {
+        ringConfig.entries      = s_ringEntries;
+        ringConfig.entryCount   = RX_RING_ENTRIES;
+        ringConfig.mbMask       = ((1ULL << RX_MESSAGE_BUFFER_COUNT) - 1U) << RX_MESSAGE_BUFFER_FIRST;
+        ringConfig.enableRxFifo = false;
+        ringConfig.getTimestamp = BENCH_GetTimestamp;
+        if (kStatus_Success != FLEXCAN_TransferStartRxRing(EXAMPLE_CAN, &s_flexcanHandle, &s_ring, &ringConfig))
+        {
+            LOG_INFO("Error: Failed to start the receive ring\r\n");
+            s_failures++;
+        }
+    }
+    else
+    {
+        /* No receive. */
+    }
+
+    s_running = (kBENCH_Idle != mode);
+    if (s_running)
+    {
+        for (i = 0U; i < TX_MESSAGE_BUFFER_COUNT; i++)
+        {
+            FLEXCAN_SetTxMbConfig(EXAMPLE_CAN, (uint8_t)(TX_MESSAGE_BUFFER_FIRST + i), true);
+            s_txXfer[i].mbIdx = (uint8_t)(TX_MESSAGE_BUFFER_FIRST + i);
+            s_txXfer[i].frame = &s_txFrame;
+            (void)FLEXCAN_TransferSendNonBlocking(EXAMPLE_CAN, &s_flexcanHandle, &s_txXfer[i]);
+        }
+    }
+
+    /* The main loop consumes the ring, and counts its idle iterations. */
+    start = DWT->CYCCNT;
+    while ((DWT->CYCCNT - start) < BENCH_RUN_CYCLES)
+    {
+        entry = (NULL != s_flexcanHandle.rxRing) ? FLEXCAN_RxRingPeek(&s_ring) : NULL;
+        if (NULL != entry)
+        {
+            BENCH_CheckFrame(&entry->frame);
+            s_rxCount++;
+            FLEXCAN_RxRingRelease(&s_ring);
+        }
+        else
+        {
+            idle++;
+        }
+    }
+
+    s_running = false;
+    if (kBENCH_RxRing == mode)
+    {
+        FLEXCAN_TransferStopRxRing(EXAMPLE_CAN, &s_flexcanHandle);
+        if ((0U != s_ring.droppedFrames) || (0U != s_ring.overrunFrames))
+        {
+            LOG_INFO("Receive ring: %u frames dropped, %u overruns\r\n", s_ring.droppedFrames, s_ring.overrunFrames);
+        }
+    }
+    FLEXCAN_Deinit(EXAMPLE_CAN);
+
+    result->idle     = idle;
+    result->txFrames = s_txCount;
+    result->rxFrames = s_rxCount;
+    result->batches  = s_batchCount;
+}
+
+/* Cycles taken from the idle loop by a run, the interrupts and the frame processing. */
+static uint32_t BENCH_BusyCycles(const bench_result_t *result, const bench_result_t *reference)
+{
+    uint64_t idleCycles = ((uint64_t)BENCH_RUN_CYCLES * result->idle) / reference->idle;
+
+    return (idleCycles < BENCH_RUN_CYCLES) ? (BENCH_RUN_CYCLES - (uint32_t)idleCycles) : 0U;
+}
+
+static void BENCH_Print(const char *name,
+                        const bench_result_t *result,
+                        const bench_result_t *reference,
+                        const bench_result_t *txOnly)
+{
+    uint32_t busy   = BENCH_BusyCycles(result, reference);
+    uint32_t txBusy = 0U;
+
+    /* Charge the Tx interrupts at their cost without receive, the rest is the receive path. */
+    if (0U != txOnly->txFrames)
+    {
+        txBusy = (uint32_t)(((uint64_t)BENCH_BusyCycles(txOnly, reference) * result->txFrames) / txOnly->txFrames);
+    }
+
+    LOG_INFO("%-12s %9u %9u %9u %7u.%u%% %15u\r\n", name, result->txFrames, result->rxFrames, result->batches,
+             (uint32_t)(((uint64_t)busy * 100U) / BENCH_RUN_CYCLES),
+             (uint32_t)((((uint64_t)busy * 1000U) / BENCH_RUN_CYCLES) % 10U),
+             ((0U != result->rxFrames) && (busy > txBusy)) ? ((busy - txBusy) / result->rxFrames) : 0U);
+}
+
+/*!
+ * @brief Main function
+ */
+int main(void)
+{
+    bench_result_t reference;
+    bench_result_t txOnly;
+    bench_result_t mbTransfer;
+    bench_result_t rxRing;
+
+    /* Initialize board hardware. */
+    sc_ipc_t ipc;
+
+    ipc = BOARD_InitRpc();
+
+    BOARD_InitPins(ipc);
+    BOARD_BootClockRUN();
+    BOARD_InitMemory();
+    BOARD_InitDebugConsole();
+
+    /* Power on Peripherals. */
+    if (sc_pm_set_resource_power_mode(ipc, SC_R_IRQSTR_M4_0, SC_PM_PW_MODE_ON) != SC_ERR_NONE)
+    {
+        PRINTF("Error: Failed to power on IRQSTEER!\r\n");
+    }
+    if (sc_pm_set_resource_power_mode(ipc, SC_R_CAN_0, SC_PM_PW_MODE_ON) != SC_ERR_NONE)
+    {
+        PRINTF("Error: Failed to power on FLEXCAN\r\n");
+    }
+
+    /* Set Peripheral clock frequency. */
+    if (CLOCK_SetIpFreq(kCLOCK_DMA_Can0, SC_24MHZ) == 0)
+    {
+        PRINTF("Error: Failed to set FLEXCAN frequency\r\n");
+    }
+
+    /* Enable interrupt in irqsteer */
+    IRQSTEER_Init(IRQSTEER);
+    IRQSTEER_EnableInterrupt(IRQSTEER, DMA_FLEXCAN0_INT_IRQn);
+
+    LOG_INFO("\r\n==FlexCAN receive ring benchmark -- Start.==\r\n\r\n");
+
+    s_txFrame.format    = (uint8_t)kFLEXCAN_FrameFormatStandard;
+    s_txFrame.type      = (uint8_t)kFLEXCAN_FrameTypeData;
+    s_txFrame.id        = FLEXCAN_ID_STD(TX_ID);
+    s_txFrame.length    = 8U;
+    s_txFrame.dataWord0 = CAN_WORD0_DATA_BYTE_0(0x11) | CAN_WORD0_DATA_BYTE_1(0x22) | CAN_WORD0_DATA_BYTE_2(0x33) |
+                          CAN_WORD0_DATA_BYTE_3(0x44);
+    s_txFrame.dataWord1 = CAN_WORD1_DATA_BYTE_4(0x55) | CAN_WORD1_DATA_BYTE_5(0x66) | CAN_WORD1_DATA_BYTE_6(0x77) |
+                          CAN_WORD1_DATA_BYTE_7(0x88);
+
+    BENCH_InitCycleCounter();
+
+    BENCH_Run(kBENCH_Idle, &reference);
+    BENCH_Run(kBENCH_TxOnly, &txOnly);
+    BENCH_Run(kBENCH_MbTransfer, &mbTransfer);
+    BENCH_Run(kBENCH_RxRing, &rxRing);
+
+    LOG_INFO("%u Rx Message Buffers, loopback at full bus load, %u cycles per run\r\n\r\n", RX_MESSAGE_BUFFER_COUNT,
+             BENCH_RUN_CYCLES);
+    LOG_INFO("receive path tx frames rx frames   batches  CPU load rx cycles/frame\r\n");
+    BENCH_Print("none", &txOnly, &reference, &txOnly);
+    BENCH_Print("per MB", &mbTransfer, &reference, &txOnly);
+    BENCH_Print("receive ring", &rxRing, &reference, &txOnly);
+
+    LOG_INFO("\r\n==FlexCAN receive ring benchmark -- Finish, %u failures.==\r\n", s_failures);
+
+    while (true)
+    {
+    }
+}
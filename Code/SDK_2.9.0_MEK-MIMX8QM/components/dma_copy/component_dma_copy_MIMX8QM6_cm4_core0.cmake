@@ -0,0 +1,23 @@
+if(NOT COMPONENT_DMA_COPY_MIMX8QM6_cm4_core0_INCLUDED)
+    
+    set(COMPONENT_DMA_COPY_MIMX8QM6_cm4_core0_INCLUDED true CACHE BOOL "component_dma_copy component is included.")
+
+    target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/fsl_component_dma_copy.c
+    )
+
+
+    target_include_directories(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/.
+    )
+
+
+    include(driver_common_MIMX8QM6_cm4_core0)
+
+    include(driver_dma3_MIMX8QM6_cm4_core0)
+
+    include(driver_cache_lmem_MIMX8QM6_cm4_core0)
+
+    include(driver_memory_MIMX8QM6_cm4_core0)
+
+endif()
@@ -0,0 +1,620 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "fsl_component_dma_copy.h"
+#if defined(DMA_COPY_ENABLE_CACHE_MAINTENANCE) && (DMA_COPY_ENABLE_CACHE_MAINTENANCE > 0)
+#include "fsl_cache.h"
+#endif
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+#include "fsl_memory.h"
+#endif
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Widest transfer of the eDMA used for the copies. */
+#define DMA_COPY_MAX_TRANSFER_SIZE (kEDMA_TransferSize32Bytes)
+
+/* Major loop count of a TCD using the minor loop link: CITER has 9 bits. */
+#define DMA_COPY_MAX_MAJOR_LOOPS (0x1FFU)
+
+/* Minor loop bytes of a TCD using the minor loop offset: NBYTES has 10 bits. */
+#define DMA_COPY_MAX_OFFSET_MINOR_LOOP_BYTES (0x3FFU)
+
+/* Largest minor loop offset: MLOFF has 20 signed bits. */
+#define DMA_COPY_MAX_MINOR_OFFSET (0x7FFFFU)
+
+/* The source of a fill is the pattern word, read with a transfer of up to 4 bytes. */
+#define DMA_COPY_FILL_SOURCE_SIZE(destSize) \
+    (((destSize) > kEDMA_TransferSize4Bytes) ? kEDMA_TransferSize4Bytes : (destSize))
+
+/* TCDs being built: the TCDs are only counted without pool. */
+typedef struct _dma_copy_chain
+{
+    edma_tcd_t *tcdPool;
+    uint32_t channel;
+    uint32_t index;
+} dma_copy_chain_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void DMA_COPY_EdmaCallback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t DMA_COPY_RequestBytes(const dma_copy_request_t *request)
+{
+    return request->width * request->height;
+}
+
+/* Widest transfer size that the addresses, offsets and sizes in alignment are aligned on, up to maxBytes. */
+static edma_transfer_size_t DMA_COPY_GetTransferSize(uint32_t alignment, uint32_t maxBytes)
+{
+    uint32_t transferSize = (uint32_t)DMA_COPY_MAX_TRANSFER_SIZE;
+
+    while ((transferSize != 0U) &&
+           (((alignment & ((1UL << transferSize) - 1U)) != 0U) || ((1UL << transferSize) > maxBytes)))
+    {
+        transferSize--;
+    }
+
+    return (edma_transfer_size_t)transferSize;
+}
+
+static void DMA_COPY_AddTcd(dma_copy_chain_t *chain,
+                            const edma_transfer_config_t *config,
+                            const edma_minor_offset_config_t *minorOffset)
+{
+    edma_tcd_t *tcd;
+
+    if (chain->tcdPool != NULL)
+    {
+        tcd = &chain->tcdPool[chain->index];
+
+        EDMA_TcdReset(tcd);
+        EDMA_TcdSetTransferConfig(tcd, config, &chain->tcdPool[chain->index + 1U]);
+        if (minorOffset != NULL)
+        {
+            EDMA_TcdSetMinorOffsetConfig(tcd, minorOffset);
+        }
+        /* The channel starts its own minor loops, and its next TCD. */
+        if (config->majorLoopCounts > 1U)
+        {
+            EDMA_TcdSetChannelLink(tcd, kEDMA_MinorLink, chain->channel);
+        }
+        EDMA_TcdSetChannelLink(tcd, kEDMA_MajorLink, chain->channel);
+    }
+
+    chain->index++;
+}
+
+/* Adds the TCDs of a line, the source of a fill does not move. */
+static void DMA_COPY_AddLine(dma_copy_chain_t *chain, uint32_t srcAddr, bool fill, uint32_t destAddr, uint32_t size)
+{
+    edma_transfer_config_t config;
+    edma_transfer_size_t transferSize;
+    uint32_t transferBytes;
+    uint32_t minorLoopBytes;
+    uint32_t majorLoopCounts;
+
+    while (size != 0U)
+    {
+        transferSize    = DMA_COPY_GetTransferSize(fill ? destAddr : (srcAddr | destAddr), size);
+        transferBytes   = 1UL << (uint32_t)transferSize;
+        minorLoopBytes  = MIN(DMA_COPY_MINOR_LOOP_BYTES, size & ~(transferBytes - 1U));
+        majorLoopCounts = MIN(size / minorLoopBytes, DMA_COPY_MAX_MAJOR_LOOPS);
+
+        config.srcAddr          = srcAddr;
+        config.destAddr         = destAddr;
+        config.srcTransferSize  = fill ? DMA_COPY_FILL_SOURCE_SIZE(transferSize) : transferSize;
+        config.destTransferSize = transferSize;
+        config.srcOffset        = fill ? 0 : (int16_t)transferBytes;
+        config.destOffset       = (int16_t)transferBytes;
+        config.minorLoopBytes   = minorLoopBytes;
+        config.majorLoopCounts  = majorLoopCounts;
+        DMA_COPY_AddTcd(chain, &config, NULL);
+
+        if (!fill)
+        {
+            srcAddr += minorLoopBytes * majorLoopCounts;
+        }
+        destAddr += minorLoopBytes * majorLoopCounts;
+        size -= minorLoopBytes * majorLoopCounts;
+    }
+}
+
+static void DMA_COPY_AddRequest(dma_copy_chain_t *chain, const dma_copy_request_t *request)
+{
+    bool fill         = (request->type == (uint8_t)kDMA_COPY_Fill);
+    uint32_t srcAddr  = fill ? (uint32_t)&request->pattern : request->srcAddr;
+    uint32_t destAddr = request->destAddr;
+    uint32_t srcGap   = fill ? 0U : request->srcPitch - request->width;
+    uint32_t destGap  = request->destPitch - request->width;
+    uint32_t gap      = (srcGap != 0U) ? srcGap : destGap;
+    edma_transfer_config_t config;
+    edma_minor_offset_config_t minorOffset;
+    uint32_t transferBytes;
+    uint32_t lines;
+
+    if ((srcGap == 0U) && (destGap == 0U))
+    {
+        /* Contiguous lines. */
+        DMA_COPY_AddLine(chain, srcAddr, fill, destAddr, DMA_COPY_RequestBytes(request));
+    }
+    else if ((request->width <= DMA_COPY_MAX_OFFSET_MINOR_LOOP_BYTES) && (gap <= DMA_COPY_MAX_MINOR_OFFSET) &&
+             ((srcGap == 0U) || (destGap == 0U) || (srcGap == destGap)))
+    {
+        /* One line per minor loop, the minor loop offset skips the gap between the lines. */
+        config.destTransferSize = DMA_COPY_GetTransferSize(
+            destAddr | request->width | request->destPitch | (fill ? 0U : (srcAddr | request->srcPitch)),
+            request->width);
+        transferBytes          = 1UL << (uint32_t)config.destTransferSize;
+        config.srcTransferSize = fill ? DMA_COPY_FILL_SOURCE_SIZE(config.destTransferSize) : config.destTransferSize;
+        config.srcOffset       = fill ? 0 : (int16_t)transferBytes;
+        config.destOffset      = (int16_t)transferBytes;
+        config.minorLoopBytes  = request->width;
+        minorOffset.enableSrcMinorOffset  = (srcGap != 0U);
+        minorOffset.enableDestMinorOffset = (destGap != 0U);
+        minorOffset.minorOffset           = gap;
+
+        for (lines = request->height; lines != 0U; lines -= config.majorLoopCounts)
+        {
+            config.srcAddr         = srcAddr;
+            config.destAddr        = destAddr;
+            config.majorLoopCounts = MIN(lines, DMA_COPY_MAX_MAJOR_LOOPS);
+            DMA_COPY_AddTcd(chain, &config, &minorOffset);
+
+            if (!fill)
+            {
+                srcAddr += config.majorLoopCounts * request->srcPitch;
+            }
+            destAddr += config.majorLoopCounts * request->destPitch;
+        }
+    }
+    else
+    {
+        /* One TCD per line. */
+        for (lines = request->height; lines != 0U; lines--)
+        {
+            DMA_COPY_AddLine(chain, srcAddr, fill, destAddr, request->width);
+
+            if (!fill)
+            {
+                srcAddr += request->srcPitch;
+            }
+            destAddr += request->destPitch;
+        }
+    }
+}
+
+static uint32_t DMA_COPY_CountTcds(const dma_copy_handle_t *handle, const dma_copy_request_t *request)
+{
+    dma_copy_chain_t chain = {NULL, handle->edmaHandle.channel, 0U};
+
+    DMA_COPY_AddRequest(&chain, request);
+
+    return chain.index;
+}
+
+#if defined(DMA_COPY_ENABLE_CACHE_MAINTENANCE) && (DMA_COPY_ENABLE_CACHE_MAINTENANCE > 0)
+/* Adds the memory of a request to the ranges maintained before the chain starts. */
+static void DMA_COPY_AddCacheRanges(dma_copy_request_t *request,
+                                    dcache_range_set_t *cleanRanges,
+                                    dcache_range_set_t *cleanInvalidateRanges)
+{
+    uint32_t lastLine = request->height - 1U;
+
+    if (request->type == (uint8_t)kDMA_COPY_Fill)
+    {
+        DCACHE_AddRangeToSet(cleanRanges, (uint32_t)&request->pattern, sizeof(request->pattern));
+    }
+    else
+    {
+        DCACHE_AddRangeToSet(cleanRanges, request->srcAddr, (lastLine * request->srcPitch) + request->width);
+    }
+    DCACHE_AddRangeToSet(cleanInvalidateRanges, request->destAddr, (lastLine * request->destPitch) + request->width);
+}
+#endif
+
+static void DMA_COPY_RunOnCpu(dma_copy_request_t *request)
+{
+    uint8_t *dest      = (uint8_t *)request->destAddr;
+    const uint8_t *src = (const uint8_t *)request->srcAddr;
+    uint32_t lines;
+
+    for (lines = request->height; lines != 0U; lines--)
+    {
+        if (request->type == (uint8_t)kDMA_COPY_Fill)
+        {
+            (void)memset(dest, (int)(request->pattern & 0xFFU), request->width);
+        }
+        else
+        {
+            (void)memcpy(dest, src, request->width);
+            src += request->srcPitch;
+        }
+        dest += request->destPitch;
+    }
+}
+
+/* Builds the queued requests into a chain and starts it, called with the interrupts disabled. */
+static void DMA_COPY_StartChain(dma_copy_handle_t *handle)
+{
+    dma_copy_chain_t chain      = {handle->tcdPool, handle->edmaHandle.channel, 0U};
+    dma_copy_request_t *request = handle->pendingHead;
+    dma_copy_request_t *last    = NULL;
+    edma_tcd_t *tcd;
+#if defined(DMA_COPY_ENABLE_CACHE_MAINTENANCE) && (DMA_COPY_ENABLE_CACHE_MAINTENANCE > 0)
+    /* The requests of a batch are often adjacent lines or buffers: their ranges are merged and maintained once. */
+    dcache_range_set_t cleanRanges;
+    dcache_range_set_t cleanInvalidateRanges;
+
+    DCACHE_InitRangeSet(&cleanRanges);
+    DCACHE_InitRangeSet(&cleanInvalidateRanges);
+#endif
+
+    while ((request != NULL) && ((chain.index + DMA_COPY_CountTcds(handle, request)) <= handle->tcdCount))
+    {
+        DMA_COPY_AddRequest(&chain, request);
+        request->lastTcd = (uint16_t)(chain.index - 1U);
+        EDMA_TcdEnableInterrupts(&handle->tcdPool[request->lastTcd], (uint32_t)kEDMA_MajorInterruptEnable);
+#if defined(DMA_COPY_ENABLE_CACHE_MAINTENANCE) && (DMA_COPY_ENABLE_CACHE_MAINTENANCE > 0)
+        DMA_COPY_AddCacheRanges(request, &cleanRanges, &cleanInvalidateRanges);
+#endif
+        last    = request;
+        request = request->next;
+    }
+
+    if (last != NULL)
+    {
+        handle->runningHead = handle->pendingHead;
+        handle->pendingHead = request;
+        if (request == NULL)
+        {
+            handle->pendingTail = NULL;
+        }
+        last->next = NULL;
+
+        /* The last TCD ends the chain. */
+        tcd            = &handle->tcdPool[chain.index - 1U];
+        tcd->DLAST_SGA = 0U;
+        tcd->CSR = (tcd->CSR & ~(uint16_t)(DMA_TCD_CSR_ESG_MASK | DMA_TCD_CSR_MAJORELINK_MASK)) | DMA_TCD_CSR_DREQ_MASK;
+#if defined(DMA_COPY_ENABLE_CACHE_MAINTENANCE) && (DMA_COPY_ENABLE_CACHE_MAINTENANCE > 0)
+        DCACHE_AddRangeToSet(&cleanRanges, (uint32_t)handle->tcdPool, chain.index * sizeof(edma_tcd_t));
+        DCACHE_CleanRangeSet(&cleanRanges);
+        DCACHE_CleanInvalidateRangeSet(&cleanInvalidateRanges);
+#endif
+
+        handle->chainTcds = chain.index;
+        EDMA_ClearChannelStatusFlags(handle->edmaHandle.base, handle->edmaHandle.channel, (uint32_t)kEDMA_DoneFlag);
+        EDMA_InstallTCD(handle->edmaHandle.base, handle->edmaHandle.channel, &handle->tcdPool[0]);
+        EDMA_TriggerChannelStart(handle->edmaHandle.base, handle->edmaHandle.channel);
+    }
+}
+
+/* Completes a list of requests, the requests submitted by the callbacks wait for the end of the list. */
+static void DMA_COPY_Complete(dma_copy_handle_t *handle, dma_copy_request_t *request, status_t status)
+{
+    dma_copy_request_t *next;
+
+    DMA_COPY_BeginBatch(handle);
+    while (request != NULL)
+    {
+        next            = request->next;
+        request->next   = NULL;
+        request->status = status;
+        if (request->callback != NULL)
+        {
+            request->callback(request, status, request->userData);
+        }
+        request = next;
+    }
+    DMA_COPY_EndBatch(handle);
+}
+
+static void DMA_COPY_EdmaCallback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds)
+{
+    dma_copy_handle_t *copyHandle = (dma_copy_handle_t *)userData;
+    DMA_Type *base                = handle->base;
+    uint32_t channel              = handle->channel;
+    dma_copy_request_t *done      = NULL;
+    dma_copy_request_t *last;
+    uint32_t primask;
+    uint32_t sga;
+    uint32_t tcdsDone;
+
+    (void)transferDone;
+    (void)tcds;
+
+    primask = DisableGlobalIRQ();
+
+    if (copyHandle->chainTcds != 0U)
+    {
+        sga = base->CH[channel].TCD_DLAST_SGA;
+        if (sga != 0U)
+        {
+            /* The TCDs before the loaded one are done. */
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+            sga -= MEMORY_ConvertMemoryMapAddress((uint32_t)copyHandle->tcdPool, kMEMORY_Local2DMA);
+#else
+            sga -= (uint32_t)copyHandle->tcdPool;
+#endif
+            tcdsDone = (sga / sizeof(edma_tcd_t)) - 1U;
+        }
+        else if (((base->CH[channel].CH_CSR & (DMA_CH_CSR_DONE_MASK | DMA_CH_CSR_ACTIVE_MASK)) ==
+                  DMA_CH_CSR_DONE_MASK) &&
+                 ((base->CH[channel].TCD_CSR & DMA_TCD_CSR_START_MASK) == 0U))
+        {
+            /* The last TCD is done: DONE is also set between the load of the last TCD and its start. */
+            tcdsDone = copyHandle->chainTcds;
+        }
+        else
+        {
+            tcdsDone = copyHandle->chainTcds - 1U;
+        }
+
+        /* Detach the requests whose last TCD is done. */
+        done = copyHandle->runningHead;
+        last = NULL;
+        while ((copyHandle->runningHead != NULL) && (copyHandle->runningHead->lastTcd < tcdsDone))
+        {
+            last                    = copyHandle->runningHead;
+            copyHandle->runningHead = last->next;
+        }
+        if (last != NULL)
+        {
+            last->next = NULL;
+        }
+        else
+        {
+            done = NULL;
+        }
+
+        if (tcdsDone == copyHandle->chainTcds)
+        {
+            copyHandle->chainTcds = 0U;
+            EDMA_ClearChannelStatusFlags(base, channel, (uint32_t)kEDMA_DoneFlag);
+        }
+    }
+
+    EnableGlobalIRQ(primask);
+
+    DMA_COPY_Complete(copyHandle, done, kStatus_Success);
+}
+
+void DMA_COPY_GetDefaultConfig(dma_copy_config_t *config)
+{
+    assert(config != NULL);
+
+    (void)memset(config, 0, sizeof(*config));
+    config->cpuCopyThreshold = DMA_COPY_CPU_COPY_THRESHOLD;
+}
+
+void DMA_COPY_Init(dma_copy_handle_t *handle, const dma_copy_config_t *config)
+{
+    assert(handle != NULL);
+    assert(config != NULL);
+    assert((config->tcdPool != NULL) && (config->tcdCount != 0U));
+    assert(((uint32_t)config->tcdPool & 0x1FU) == 0U);
+
+    (void)memset(handle, 0, sizeof(*handle));
+    handle->tcdPool          = config->tcdPool;
+    handle->tcdCount         = config->tcdCount;
+    handle->cpuCopyThreshold = config->cpuCopyThreshold;
+
+    EDMA_CreateHandle(&handle->edmaHandle, config->base, config->channel);
+    EDMA_SetCallback(&handle->edmaHandle, DMA_COPY_EdmaCallback, handle);
+}
+
+void DMA_COPY_Deinit(dma_copy_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    DMA_COPY_AbortAll(handle);
+    EDMA_ResetChannel(handle->edmaHandle.base, handle->edmaHandle.channel);
+}
+
+/* The handle is idle when no request is running, queued, or waiting for the end of a batch. */
+static bool DMA_COPY_IsIdle(const dma_copy_handle_t *handle)
+{
+    return (handle->batchDepth == 0U) && (handle->chainTcds == 0U) && (handle->pendingHead == NULL);
+}
+
+static status_t DMA_COPY_Submit(dma_copy_handle_t *handle, dma_copy_request_t *request)
+{
+    uint32_t primask;
+    bool onCpu;
+
+    request->next = NULL;
+
+    /* A small request only runs on the CPU when it does not pass the requests before it. */
+    primask = DisableGlobalIRQ();
+    onCpu   = (DMA_COPY_RequestBytes(request) == 0U) ||
+              ((DMA_COPY_RequestBytes(request) < handle->cpuCopyThreshold) && DMA_COPY_IsIdle(handle));
+    EnableGlobalIRQ(primask);
+
+    if (onCpu)
+    {
+        DMA_COPY_RunOnCpu(request);
+        request->status = kStatus_Success;
+        if (request->callback != NULL)
+        {
+            request->callback(request, kStatus_Success, request->userData);
+        }
+        return kStatus_Success;
+    }
+
+    if (DMA_COPY_CountTcds(handle, request) > handle->tcdCount)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    request->status = kStatus_DMA_COPY_Pending;
+
+    primask = DisableGlobalIRQ();
+    if (handle->pendingTail != NULL)
+    {
+        handle->pendingTail->next = request;
+    }
+    else
+    {
+        handle->pendingHead = request;
+    }
+    handle->pendingTail = request;
+    if ((handle->batchDepth == 0U) && (handle->chainTcds == 0U))
+    {
+        DMA_COPY_StartChain(handle);
+    }
+    EnableGlobalIRQ(primask);
+
+    return kStatus_Success;
+}
+
+status_t DMA_COPY_Memcpy(dma_copy_handle_t *handle,
+                         dma_copy_request_t *request,
+                         void *dest,
+                         const void *src,
+                         uint32_t size,
+                         dma_copy_callback_t callback,
+                         void *userData)
+{
+    return DMA_COPY_Memcpy2D(handle, request, dest, size, src, size, size, 1U, callback, userData);
+}
+
+status_t DMA_COPY_Memset(dma_copy_handle_t *handle,
+                         dma_copy_request_t *request,
+                         void *dest,
+                         uint8_t value,
+                         uint32_t size,
+                         dma_copy_callback_t callback,
+                         void *userData)
+{
+    assert(handle != NULL);
+    assert(request != NULL);
+
+    request->callback  = callback;
+    request->userData  = userData;
+    request->destAddr  = (uint32_t)dest;
+    request->srcAddr   = 0U;
+    request->destPitch = size;
+    request->srcPitch  = 0U;
+    request->width     = size;
+    request->height    = 1U;
+    request->pattern   = 0x01010101U * value;
+    request->type      = (uint8_t)kDMA_COPY_Fill;
+
+    return DMA_COPY_Submit(handle, request);
+}
+
+status_t DMA_COPY_Memcpy2D(dma_copy_handle_t *handle,
+                           dma_copy_request_t *request,
+                           void *dest,
+                           uint32_t destPitch,
+                           const void *src,
+                           uint32_t srcPitch,
+                           uint32_t width,
+                           uint32_t height,
+                           dma_copy_callback_t callback,
+                           void *userData)
+{
+    assert(handle != NULL);
+    assert(request != NULL);
+    assert((destPitch >= width) && (srcPitch >= width));
+
+    request->callback  = callback;
+    request->userData  = userData;
+    request->destAddr  = (uint32_t)dest;
+    request->srcAddr   = (uint32_t)src;
+    request->destPitch = destPitch;
+    request->srcPitch  = srcPitch;
+    request->width     = width;
+    request->height    = height;
+    request->pattern   = 0U;
+    request->type      = (uint8_t)kDMA_COPY_Copy;
+
+    return DMA_COPY_Submit(handle, request);
+}
+
+void DMA_COPY_BeginBatch(dma_copy_handle_t *handle)
+{
+    uint32_t primask;
+
+    assert(handle != NULL);
+
+    primask = DisableGlobalIRQ();
+    handle->batchDepth++;
+    EnableGlobalIRQ(primask);
+}
+
+void DMA_COPY_EndBatch(dma_copy_handle_t *handle)
+{
+    uint32_t primask;
+
+    assert(handle != NULL);
+    assert(handle->batchDepth != 0U);
+
+    primask = DisableGlobalIRQ();
+    handle->batchDepth--;
+    if ((handle->batchDepth == 0U) && (handle->chainTcds == 0U))
+    {
+        DMA_COPY_StartChain(handle);
+    }
+    EnableGlobalIRQ(primask);
+}
+
+status_t DMA_COPY_Wait(const dma_copy_request_t *request)
+{
+    assert(request != NULL);
+
+    while (request->status == kStatus_DMA_COPY_Pending)
+    {
+    }
+
+    return request->status;
+}
+
+void DMA_COPY_AbortAll(dma_copy_handle_t *handle)
+{
+    dma_copy_request_t *aborted;
+    uint32_t primask;
+
+    assert(handle != NULL);
+
+    primask = DisableGlobalIRQ();
+    EDMA_AbortTransfer(&handle->edmaHandle);
+    EDMA_ClearChannelStatusFlags(handle->edmaHandle.base, handle->edmaHandle.channel,
+                                 (uint32_t)kEDMA_DoneFlag | (uint32_t)kEDMA_InterruptFlag);
+    handle->chainTcds = 0U;
+
+    /* The running requests, then the queued ones. */
+    aborted = handle->runningHead;
+    if (aborted != NULL)
+    {
+        while (handle->runningHead->next != NULL)
+        {
+            handle->runningHead = handle->runningHead->next;
+        }
+        handle->runningHead->next = handle->pendingHead;
+    }
+    else
+    {
+        aborted = handle->pendingHead;
+    }
+    handle->runningHead = NULL;
+    handle->pendingHead = NULL;
+    handle->pendingTail = NULL;
+    EnableGlobalIRQ(primask);
+
+    DMA_COPY_Complete(handle, aborted, kStatus_DMA_COPY_Aborted);
+}
@@ -0,0 +1,314 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_DMA_COPY_H_
+#define _FSL_COMPONENT_DMA_COPY_H_
+
+#include "fsl_common.h"
+#include "fsl_edma.h"
+
+/*!
+ * @addtogroup dma_copy
+ * @{
+ */
+
+/*!
+ * @brief The DMA copy component
+ *
+ * The DMA copy component runs memory copies and fills on one eDMA channel, so that the CPU is free while the
+ * data moves. The requests are queued, and all the queued requests are built into one scatter/gather chain of
+ * TCDs which the channel runs without CPU intervention: each TCD starts the next one with a major loop link
+ * to the channel itself, and each minor loop starts the next one with a minor loop link. The copies of
+ * rectangles use the minor loop offsets, so that one TCD moves up to 511 lines.
+ *
+ * Each request completes with its callback, called in the eDMA interrupt, or can be polled as a future with
+ * DMA_COPY_GetStatus() and DMA_COPY_Wait(). The requests smaller than the CPU copy threshold are done by the
+ * CPU in the submitting call, because setting up the eDMA costs more than copying them.
+ *
+ * The requests of a handle take effect in their submission order, so that a request may depend on the data of
+ * the previous ones. A small request is only done by the CPU when the handle is idle, no request running or
+ * queued and no batch open; otherwise it is queued on the eDMA after the others. Only the requests of zero
+ * bytes always complete in the submitting call. The requests of different handles are not ordered.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Bytes of a minor loop of the copies, the eDMA arbitrates between the channels after each minor loop. */
+#ifndef DMA_COPY_MINOR_LOOP_BYTES
+#define DMA_COPY_MINOR_LOOP_BYTES (512U)
+#endif
+
+/*! @brief Requests smaller than this number of bytes are done by the CPU, until DMA_COPY_SetCpuCopyThreshold(). */
+#ifndef DMA_COPY_CPU_COPY_THRESHOLD
+#define DMA_COPY_CPU_COPY_THRESHOLD (256U)
+#endif
+
+/*! @brief Cleans the sources and invalidates the destinations in the cache before running the requests. */
+#ifndef DMA_COPY_ENABLE_CACHE_MAINTENANCE
+#define DMA_COPY_ENABLE_CACHE_MAINTENANCE (1)
+#endif
+
+/*! @brief DMA copy status, _dma_copy_status */
+enum
+{
+    kStatus_DMA_COPY_Pending = MAKE_STATUS(kStatusGroup_DMA_COPY, 0), /*!< The request is queued or running. */
+    kStatus_DMA_COPY_Aborted = MAKE_STATUS(kStatusGroup_DMA_COPY, 1), /*!< The request was aborted. */
+};
+
+/*! @brief DMA copy request type. */
+typedef enum _dma_copy_request_type
+{
+    kDMA_COPY_Copy = 0U, /*!< Copy of a rectangle, a single line for a linear copy. */
+    kDMA_COPY_Fill = 1U, /*!< Fill of a rectangle with a byte, a single line for a linear fill. */
+} dma_copy_request_type_t;
+
+/*! @brief Forward declaration of the DMA copy request. */
+typedef struct _dma_copy_request dma_copy_request_t;
+
+/*!
+ * @brief Callback of a request.
+ *
+ * @param request The request.
+ * @param status kStatus_Success, or kStatus_DMA_COPY_Aborted.
+ * @param userData Parameter of the callback.
+ */
+typedef void (*dma_copy_callback_t)(dma_copy_request_t *request, status_t status, void *userData);
+
+/*!
+ * @brief DMA copy request.
+ *
+ * The request is owned by the component from its submission until its completion, after which it can be
+ * submitted again.
+ */
+struct _dma_copy_request
+{
+    struct _dma_copy_request *next; /*!< Next request in the queue. */
+    dma_copy_callback_t callback;   /*!< Callback, NULL to poll the request. */
+    void *userData;                 /*!< Parameter of the callback. */
+    volatile status_t status;       /*!< kStatus_DMA_COPY_Pending until the request completes. */
+    uint32_t destAddr;              /*!< Destination address. */
+    uint32_t srcAddr;               /*!< Source address, unused for the fills. */
+    uint32_t destPitch;             /*!< Bytes between the starts of two destination lines. */
+    uint32_t srcPitch;              /*!< Bytes between the starts of two source lines. */
+    uint32_t width;                 /*!< Bytes of a line. */
+    uint32_t height;                /*!< Number of lines. */
+    uint32_t pattern;               /*!< The fill byte repeated in a word, read by the eDMA. */
+    uint16_t lastTcd;               /*!< Index of the last TCD of the request in the running chain. */
+    uint8_t type;                   /*!< Request type, see dma_copy_request_type_t. */
+};
+
+/*! @brief DMA copy configuration. */
+typedef struct _dma_copy_config
+{
+    DMA_Type *base;            /*!< eDMA peripheral base address, initialized with EDMA_Init(). */
+    uint32_t channel;          /*!< eDMA channel used by the component only. */
+    edma_tcd_t *tcdPool;       /*!< TCD memory, 32 bytes aligned and reachable by the eDMA. */
+    uint32_t tcdCount;         /*!< Number of TCDs in the pool, which bounds the TCDs of a batch. */
+    uint32_t cpuCopyThreshold; /*!< Requests smaller than this number of bytes are done by the CPU. */
+} dma_copy_config_t;
+
+/*! @brief DMA copy handle. */
+typedef struct _dma_copy_handle
+{
+    edma_handle_t edmaHandle;        /*!< eDMA handle of the channel. */
+    edma_tcd_t *tcdPool;             /*!< TCD memory. */
+    uint32_t tcdCount;               /*!< Number of TCDs in the pool. */
+    uint32_t chainTcds;              /*!< Number of TCDs in the running chain, 0 while the channel is idle. */
+    uint32_t cpuCopyThreshold;       /*!< Requests smaller than this number of bytes are done by the CPU. */
+    uint32_t batchDepth;             /*!< Nesting of DMA_COPY_BeginBatch(), the queue starts at 0. */
+    dma_copy_request_t *pendingHead; /*!< First request waiting for the next chain. */
+    dma_copy_request_t *pendingTail; /*!< Last request waiting for the next chain. */
+    dma_copy_request_t *runningHead; /*!< First request of the running chain. */
+} dma_copy_handle_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name Initialization and de-initialization
+ * @{
+ */
+
+/*!
+ * @brief Gets the default configuration: no TCD pool, CPU copy threshold DMA_COPY_CPU_COPY_THRESHOLD.
+ *
+ * @param config The configuration.
+ */
+void DMA_COPY_GetDefaultConfig(dma_copy_config_t *config);
+
+/*!
+ * @brief Initializes the component on an eDMA channel.
+ *
+ * The eDMA must be initialized with EDMA_Init(), the component creates the eDMA handle of the channel.
+ *
+ * @param handle The handle.
+ * @param config The configuration.
+ */
+void DMA_COPY_Init(dma_copy_handle_t *handle, const dma_copy_config_t *config);
+
+/*!
+ * @brief Aborts the requests and stops the channel.
+ *
+ * @param handle The handle.
+ */
+void DMA_COPY_Deinit(dma_copy_handle_t *handle);
+
+/*!
+ * @brief Sets the size under which the requests are done by the CPU, when the handle is idle.
+ *
+ * @param handle The handle.
+ * @param cpuCopyThreshold The threshold in bytes, 0 to run all the requests on the eDMA.
+ */
+static inline void DMA_COPY_SetCpuCopyThreshold(dma_copy_handle_t *handle, uint32_t cpuCopyThreshold)
+{
+    handle->cpuCopyThreshold = cpuCopyThreshold;
+}
+
+/*! @} */
+
+/*!
+ * @name Requests
+ * @{
+ */
+
+/*!
+ * @brief Submits a copy.
+ *
+ * @param handle The handle.
+ * @param request The request, owned by the component until it completes.
+ * @param dest The destination.
+ * @param src The source.
+ * @param size Number of bytes.
+ * @param callback Callback, NULL to poll the request.
+ * @param userData Parameter of the callback.
+ * @retval kStatus_Success The request is queued, or done by the CPU.
+ * @retval kStatus_OutOfRange The request needs more TCDs than the pool has.
+ */
+status_t DMA_COPY_Memcpy(dma_copy_handle_t *handle,
+                         dma_copy_request_t *request,
+                         void *dest,
+                         const void *src,
+                         uint32_t size,
+                         dma_copy_callback_t callback,
+                         void *userData);
+
+/*!
+ * @brief Submits a fill.
+ *
+ * @param handle The handle.
+ * @param request The request, owned by the component until it completes.
+ * @param dest The destination.
+ * @param value The byte written.
+ * @param size Number of bytes.
+ * @param callback Callback, NULL to poll the request.
+ * @param userData Parameter of the callback.
+ * @retval kStatus_Success The request is queued, or done by the CPU.
+ * @retval kStatus_OutOfRange The request needs more TCDs than the pool has.
+ */
+status_t DMA_COPY_Memset(dma_copy_handle_t *handle,
+                         dma_copy_request_t *request,
+                         void *dest,
+                         uint8_t value,
+                         uint32_t size,
+                         dma_copy_callback_t callback,
+                         void *userData);
+
+/*!
+ * @brief Submits a copy of a rectangle, for example a part of a frame buffer.
+ *
+ * One TCD moves up to 511 lines when the lines are shorter than 1024 bytes and the source and destination
+ * gaps between the lines are equal, or one of them is 0. Otherwise each line needs its own TCDs.
+ *
+ * @param handle The handle.
+ * @param request The request, owned by the component until it completes.
+ * @param dest The first destination line.
+ * @param destPitch Bytes between the starts of two destination lines, at least width.
+ * @param src The first source line.
+ * @param srcPitch Bytes between the starts of two source lines, at least width.
+ * @param width Bytes of a line.
+ * @param height Number of lines.
+ * @param callback Callback, NULL to poll the request.
+ * @param userData Parameter of the callback.
+ * @retval kStatus_Success The request is queued, or done by the CPU.
+ * @retval kStatus_OutOfRange The request needs more TCDs than the pool has.
+ */
+status_t DMA_COPY_Memcpy2D(dma_copy_handle_t *handle,
+                           dma_copy_request_t *request,
+                           void *dest,
+                           uint32_t destPitch,
+                           const void *src,
+                           uint32_t srcPitch,
+                           uint32_t width,
+                           uint32_t height,
+                           dma_copy_callback_t callback,
+                           void *userData);
+
+/*!
+ * @brief Starts a batch: the requests submitted until DMA_COPY_EndBatch() wait, to run in one chain.
+ *
+ * Without batch, the first request submitted to an idle channel runs alone, and the requests submitted while
+ * a chain runs form the next chain. The batches can be nested.
+ *
+ * @param handle The handle.
+ */
+void DMA_COPY_BeginBatch(dma_copy_handle_t *handle);
+
+/*!
+ * @brief Ends a batch, and starts the queued requests if the channel is idle.
+ *
+ * @param handle The handle.
+ */
+void DMA_COPY_EndBatch(dma_copy_handle_t *handle);
+
+/*!
+ * @brief Gets the status of a request.
+ *
+ * @param request The request.
+ * @retval kStatus_DMA_COPY_Pending The request is queued or running.
+ * @retval kStatus_Success The request is done.
+ * @retval kStatus_DMA_COPY_Aborted The request was aborted.
+ */
+static inline status_t DMA_COPY_GetStatus(const dma_copy_request_t *request)
+{
+    return request->status;
+}
+
+/*!
+ * @brief Waits for the completion of a request.
+ *
+ * @note Must not be called with the eDMA interrupt masked.
+ *
+ * @param request The request.
+ * @return The final status of the request, see DMA_COPY_GetStatus().
+ */
+status_t DMA_COPY_Wait(const dma_copy_request_t *request);
+
+/*!
+ * @brief Aborts the running and the queued requests, which complete with kStatus_DMA_COPY_Aborted.
+ *
+ * The destinations of the aborted requests are partially written.
+ *
+ * @param handle The handle.
+ */
+void DMA_COPY_AbortAll(dma_copy_handle_t *handle);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_COMPONENT_DMA_COPY_H_ */
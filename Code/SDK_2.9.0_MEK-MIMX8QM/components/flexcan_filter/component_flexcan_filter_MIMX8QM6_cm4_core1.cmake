@@ -0,0 +1,20 @@
+if(NOT COMPONENT_FLEXCAN_FILTER_MIMX8QM6_cm4_core1_INCLUDED)
+    
+    set(COMPONENT_FLEXCAN_FILTER_MIMX8QM6_cm4_core1_INCLUDED true CACHE BOOL "component_flexcan_filter component is included.")
+
+    target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/fsl_component_flexcan_filter.c
+        ${CMAKE_CURRENT_LIST_DIR}/fsl_component_flexcan_filter_apply.c
+    )
+
+
+    target_include_directories(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/.
+    )
+
+
+    include(driver_common_MIMX8QM6_cm4_core1)
+
+    include(driver_flexcan_MIMX8QM6_cm4_core1)
+
+endif()
@@ -0,0 +1,1229 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "fsl_component_flexcan_filter.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Index of the standard and extended identifiers in the counters and the work area. */
+#define FLEXCAN_FILTER_STD (0U)
+#define FLEXCAN_FILTER_EXT (1U)
+
+/*
+ * Identifier, mask and filter words of the Message Buffers and the Rx FIFO, built as the FLEXCAN_ID_STD(),
+ * FLEXCAN_ID_EXT(), FLEXCAN_RX_MB_x_MASK() and FLEXCAN_RX_FIFO_x() macros of fsl_flexcan.h do, without the
+ * device headers. rtr and ide are the flags of the Message Buffer and format A and B words, compared when set
+ * in a mask. Only the upper part of the format B and C words is built, the others are shifts of it.
+ */
+#define FLEXCAN_FILTER_ID_STD(id) ((((uint32_t)(id)) << 18U) & 0x1FFC0000U)
+#define FLEXCAN_FILTER_ID_EXT(id) (((uint32_t)(id)) & 0x1FFFFFFFU)
+#define FLEXCAN_FILTER_ID_MASK    (0x1FFFFFFFU)
+#define FLEXCAN_FILTER_FLAGS(rtr, ide) ((((uint32_t)(rtr)) << 31U) | (((uint32_t)(ide)) << 30U))
+#define FLEXCAN_FILTER_MB_STD(id, rtr, ide) (FLEXCAN_FILTER_FLAGS(rtr, ide) | FLEXCAN_FILTER_ID_STD(id))
+#define FLEXCAN_FILTER_MB_EXT(id, rtr, ide) (FLEXCAN_FILTER_FLAGS(rtr, ide) | FLEXCAN_FILTER_ID_EXT(id))
+#define FLEXCAN_FILTER_FIFO_STD_A(id, rtr, ide) (FLEXCAN_FILTER_FLAGS(rtr, ide) | (FLEXCAN_FILTER_ID_STD(id) << 1U))
+#define FLEXCAN_FILTER_FIFO_EXT_A(id, rtr, ide) (FLEXCAN_FILTER_FLAGS(rtr, ide) | (FLEXCAN_FILTER_ID_EXT(id) << 1U))
+#define FLEXCAN_FILTER_FIFO_STD_B(id, rtr, ide) (FLEXCAN_FILTER_FLAGS(rtr, ide) | ((((uint32_t)(id)) & 0x7FFU) << 19U))
+#define FLEXCAN_FILTER_FIFO_EXT_B(id, rtr, ide) \
+    (FLEXCAN_FILTER_FLAGS(rtr, ide) | ((FLEXCAN_FILTER_ID_EXT(id) & 0x1FFF8000U) << 1U))
+#define FLEXCAN_FILTER_FIFO_STD_C(id) ((((uint32_t)(id)) & 0x7F8U) << 21U)
+#define FLEXCAN_FILTER_FIFO_EXT_C(id) ((FLEXCAN_FILTER_ID_EXT(id) & 0x1FE00000U) << 3U)
+
+/* No merge partner. */
+#define FLEXCAN_FILTER_NO_PARTNER (0xFFFFU)
+
+/* Cost of a block which a kind of filter cannot hold. */
+#define FLEXCAN_FILTER_NO_FIT (0xFFFFFFFFU)
+
+/* Kinds of filters. The full resolution filters, Message Buffers and format A elements with an individual mask,
+ * match any block. The others compare only the upper bits of the extended identifiers (format B), or 8 bits of
+ * the identifiers in both formats (format C); the global mask ones compare all the bits they can. */
+enum _flexcan_filter_slot
+{
+    kFLEXCAN_FILTER_SlotFull    = 0U,
+    kFLEXCAN_FILTER_SlotAGlobal = 1U,
+    kFLEXCAN_FILTER_SlotBMask   = 2U,
+    kFLEXCAN_FILTER_SlotBGlobal = 3U,
+    kFLEXCAN_FILTER_SlotCMask   = 4U,
+    kFLEXCAN_FILTER_SlotCGlobal = 5U,
+    kFLEXCAN_FILTER_SlotNone    = 6U,
+};
+
+/* Filters of an Rx FIFO size and format, and of the Rx Message Buffers left. */
+typedef struct _flexcan_filter_layout
+{
+    flexcan_filter_fifo_mode_t fifoMode; /* kFLEXCAN_FILTER_FifoNone, or the format of the Rx FIFO. */
+    uint32_t fifoFilterNum;              /* Elements of the Rx FIFO filter table. */
+    uint32_t fifoMaskNum;                /* Elements with an individual mask. */
+    uint32_t firstMb;                    /* First Rx Message Buffer. */
+    uint32_t mbNum;                      /* Rx Message Buffers. */
+    uint32_t fullNum;                    /* Full resolution filters. */
+    uint8_t slot[2];                     /* Kinds of the low resolution filters, individual mask then global. */
+    uint32_t slotNum[2];                 /* Number of low resolution filters of each kind. */
+} flexcan_filter_layout_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Identifier bits of each format. */
+static const uint32_t s_flexcanFilterIdMask[2] = {0x7FFU, 0x1FFFFFFFU};
+static const uint32_t s_flexcanFilterIdBits[2] = {11U, 29U};
+
+/* Identifier bits compared by each kind of filter, for each format. */
+static const uint32_t s_flexcanFilterSlotMask[6][2] = {
+    {0x7FFU, 0x1FFFFFFFU}, {0x7FFU, 0x1FFFFFFFU}, {0x7FFU, 0x1FFF8000U},
+    {0x7FFU, 0x1FFF8000U}, {0x7F8U, 0x1FE00000U}, {0x7F8U, 0x1FE00000U},
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t FLEXCAN_FILTER_CountBits(uint32_t value)
+{
+    uint32_t count = 0U;
+
+    while (value != 0U)
+    {
+        value &= value - 1U;
+        count++;
+    }
+
+    return count;
+}
+
+/* Counts the identifiers from 0 to last in the block of id and mask. */
+static uint32_t FLEXCAN_FILTER_CountBlockUpTo(uint32_t id, uint32_t mask, uint32_t last, uint32_t format)
+{
+    uint32_t freeBits = FLEXCAN_FILTER_CountBits(~mask & s_flexcanFilterIdMask[format]);
+    uint32_t count    = 0U;
+    uint32_t bit;
+    uint32_t i;
+
+    for (i = s_flexcanFilterIdBits[format]; i > 0U; i--)
+    {
+        bit = 1UL << (i - 1U);
+        if ((mask & bit) == 0U)
+        {
+            freeBits--;
+        }
+
+        if ((last & bit) != 0U)
+        {
+            /* All the identifiers of the block with this bit cleared are below last. */
+            if (((mask & bit) == 0U) || ((id & bit) == 0U))
+            {
+                count += 1UL << freeBits;
+            }
+            if (((mask & bit) != 0U) && ((id & bit) == 0U))
+            {
+                return count;
+            }
+        }
+        else if (((mask & bit) != 0U) && ((id & bit) != 0U))
+        {
+            return count;
+        }
+        else
+        {
+            /* The bit is cleared in last and can be in the block. */
+        }
+    }
+
+    /* last is in the block. */
+    return count + 1U;
+}
+
+/* Index of the first unwanted range ending at or after id. */
+static uint32_t FLEXCAN_FILTER_FindRange(const flexcan_filter_work_t *work, uint32_t format, uint32_t id)
+{
+    uint32_t low  = 0U;
+    uint32_t high = work->unwantedNum[format];
+    uint32_t middle;
+
+    while (low < high)
+    {
+        middle = (low + high) / 2U;
+        if (work->unwanted[format][middle].last < id)
+        {
+            low = middle + 1U;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/* Counts the unwanted identifiers in the block of id and mask. */
+static uint32_t FLEXCAN_FILTER_BlockCost(const flexcan_filter_work_t *work, uint32_t format, uint32_t id, uint32_t mask)
+{
+    const flexcan_filter_range_t *range;
+    uint32_t last = id | (~mask & s_flexcanFilterIdMask[format]);
+    uint32_t cost = 0U;
+    uint32_t i;
+
+    for (i = FLEXCAN_FILTER_FindRange(work, format, id); i < work->unwantedNum[format]; i++)
+    {
+        range = &work->unwanted[format][i];
+        if (range->first > last)
+        {
+            break;
+        }
+        cost += FLEXCAN_FILTER_CountBlockUpTo(id, mask, (range->last < last) ? range->last : last, format);
+        if (range->first > id)
+        {
+            cost -= FLEXCAN_FILTER_CountBlockUpTo(id, mask, range->first - 1U, format);
+        }
+    }
+
+    return cost;
+}
+
+/* Counts the unwanted identifiers from first to last. */
+static uint32_t FLEXCAN_FILTER_RangeCost(const flexcan_filter_work_t *work,
+                                         uint32_t format,
+                                         uint32_t first,
+                                         uint32_t last)
+{
+    const flexcan_filter_range_t *range;
+    uint32_t cost = 0U;
+    uint32_t i;
+
+    for (i = FLEXCAN_FILTER_FindRange(work, format, first); i < work->unwantedNum[format]; i++)
+    {
+        range = &work->unwanted[format][i];
+        if (range->first > last)
+        {
+            break;
+        }
+        cost += ((range->last < last) ? range->last : last) - ((range->first > first) ? range->first : first) + 1U;
+    }
+
+    return cost;
+}
+
+/*
+ * Gets the identifiers of a format accepted by the filter of a block: the block itself at the resolution of the
+ * filter, and for the format C filters, which do not compare the format, the identifiers of the other format
+ * with the same 8 bits.
+ */
+static bool FLEXCAN_FILTER_SlotBlock(
+    const flexcan_filter_block_t *block, uint32_t slot, uint32_t format, uint32_t *id, uint32_t *mask)
+{
+    uint32_t blockMask = block->mask & s_flexcanFilterSlotMask[slot][block->format];
+    uint32_t blockId   = block->id & blockMask;
+    bool accepted      = true;
+
+    if (format == block->format)
+    {
+        *id   = blockId;
+        *mask = blockMask;
+    }
+    else if ((slot != (uint32_t)kFLEXCAN_FILTER_SlotCMask) && (slot != (uint32_t)kFLEXCAN_FILTER_SlotCGlobal))
+    {
+        accepted = false;
+    }
+    else if (format == FLEXCAN_FILTER_EXT)
+    {
+        *id   = (blockId >> 3U) << 21U;
+        *mask = (blockMask >> 3U) << 21U;
+    }
+    else
+    {
+        *id   = (blockId >> 21U) << 3U;
+        *mask = (blockMask >> 21U) << 3U;
+    }
+
+    return accepted;
+}
+
+/* Counts the unwanted identifiers the filter of a block accepts, FLEXCAN_FILTER_NO_FIT if it cannot hold it. */
+static uint32_t FLEXCAN_FILTER_SlotCost(const flexcan_filter_work_t *work,
+                                        const flexcan_filter_block_t *block,
+                                        uint32_t slot)
+{
+    uint32_t slotMask = s_flexcanFilterSlotMask[slot][block->format];
+    uint32_t cost     = 0U;
+    uint32_t format;
+    uint32_t id;
+    uint32_t mask;
+
+    /* The global mask compares all the bits the filter can compare. */
+    if (((slot == (uint32_t)kFLEXCAN_FILTER_SlotAGlobal) || (slot == (uint32_t)kFLEXCAN_FILTER_SlotBGlobal) ||
+         (slot == (uint32_t)kFLEXCAN_FILTER_SlotCGlobal)) &&
+        ((block->mask & slotMask) != slotMask))
+    {
+        return FLEXCAN_FILTER_NO_FIT;
+    }
+
+    for (format = FLEXCAN_FILTER_STD; format <= FLEXCAN_FILTER_EXT; format++)
+    {
+        if (FLEXCAN_FILTER_SlotBlock(block, slot, format, &id, &mask))
+        {
+            cost += FLEXCAN_FILTER_BlockCost(work, format, id, mask);
+        }
+    }
+
+    return cost;
+}
+
+/* Additional unwanted identifiers accepted by the merge of two blocks. */
+static int32_t FLEXCAN_FILTER_MergeCost(const flexcan_filter_work_t *work,
+                                        const flexcan_filter_block_t *a,
+                                        const flexcan_filter_block_t *b)
+{
+    uint32_t mask = a->mask & b->mask & ~(a->id ^ b->id);
+
+    return (int32_t)FLEXCAN_FILTER_BlockCost(work, a->format, a->id & mask, mask) - (int32_t)a->cost -
+           (int32_t)b->cost;
+}
+
+/* Finds the cheapest merge of a block with the other blocks of the full resolution filters. */
+static void FLEXCAN_FILTER_UpdatePartner(flexcan_filter_work_t *work, uint32_t index)
+{
+    flexcan_filter_block_t *block = &work->blocks[index];
+    int32_t cost;
+    uint32_t i;
+
+    block->mergePartner = FLEXCAN_FILTER_NO_PARTNER;
+    block->mergeCost    = INT32_MAX;
+    for (i = 0U; i < work->poolNum; i++)
+    {
+        if ((i == index) || (work->blocks[i].format != block->format))
+        {
+            continue;
+        }
+        cost = FLEXCAN_FILTER_MergeCost(work, block, &work->blocks[i]);
+        if (cost < block->mergeCost)
+        {
+            block->mergeCost    = cost;
+            block->mergePartner = (uint16_t)i;
+        }
+    }
+}
+
+static void FLEXCAN_FILTER_UpdateCosts(flexcan_filter_work_t *work,
+                                       flexcan_filter_block_t *block,
+                                       const flexcan_filter_layout_t *layout)
+{
+    uint32_t i;
+
+    block->cost = FLEXCAN_FILTER_BlockCost(work, block->format, block->id, block->mask);
+    for (i = 0U; i < 2U; i++)
+    {
+        block->slotCost[i] = (layout->slotNum[i] != 0U) ? FLEXCAN_FILTER_SlotCost(work, block, layout->slot[i]) :
+                                                          FLEXCAN_FILTER_NO_FIT;
+    }
+}
+
+/*
+ * Removes a block from the full resolution filters: the last one takes its index. The block is kept after them
+ * if it moves to a low resolution filter, or deleted.
+ */
+static void FLEXCAN_FILTER_PoolRemove(flexcan_filter_work_t *work, uint32_t index, bool keep)
+{
+    flexcan_filter_block_t removed = work->blocks[index];
+    uint32_t last                  = work->poolNum - 1U;
+    uint32_t i;
+
+    work->blocks[index] = work->blocks[last];
+    if (keep)
+    {
+        work->blocks[last] = removed;
+    }
+    else
+    {
+        work->blocks[last] = work->blocks[work->blockNum - 1U];
+        work->blockNum--;
+    }
+    work->poolNum--;
+
+    for (i = 0U; i < work->poolNum; i++)
+    {
+        if (work->blocks[i].mergePartner == index)
+        {
+            FLEXCAN_FILTER_UpdatePartner(work, i);
+        }
+        else if (work->blocks[i].mergePartner == last)
+        {
+            work->blocks[i].mergePartner = (uint16_t)index;
+        }
+        else
+        {
+            /* The partner did not move. */
+        }
+    }
+}
+
+/* Merges a block with its partner, at the lower index of the two. */
+static void FLEXCAN_FILTER_PoolMerge(flexcan_filter_work_t *work, uint32_t index, const flexcan_filter_layout_t *layout)
+{
+    uint32_t partner = work->blocks[index].mergePartner;
+    uint32_t keep    = (index < partner) ? index : partner;
+    uint32_t drop    = (index < partner) ? partner : index;
+    flexcan_filter_block_t *block = &work->blocks[keep];
+    uint32_t mask;
+    int32_t cost;
+    uint32_t i;
+
+    mask        = block->mask & work->blocks[drop].mask & ~(block->id ^ work->blocks[drop].id);
+    block->mask = mask;
+    block->id &= mask;
+    FLEXCAN_FILTER_UpdateCosts(work, block, layout);
+    FLEXCAN_FILTER_PoolRemove(work, drop, false);
+
+    for (i = 0U; i < work->poolNum; i++)
+    {
+        if (i == keep)
+        {
+            continue;
+        }
+        if (work->blocks[i].mergePartner == keep)
+        {
+            FLEXCAN_FILTER_UpdatePartner(work, i);
+        }
+        else if (work->blocks[i].format == block->format)
+        {
+            cost = FLEXCAN_FILTER_MergeCost(work, &work->blocks[i], block);
+            if (cost < work->blocks[i].mergeCost)
+            {
+                work->blocks[i].mergeCost    = cost;
+                work->blocks[i].mergePartner = (uint16_t)keep;
+            }
+        }
+        else
+        {
+            /* Blocks of different formats are not merged. */
+        }
+    }
+    FLEXCAN_FILTER_UpdatePartner(work, keep);
+}
+
+/* Size of the largest aligned block starting at first and ending at last at most. */
+static uint32_t FLEXCAN_FILTER_BlockSize(uint32_t first, uint32_t last, uint32_t format)
+{
+    uint32_t size = (first == 0U) ? (s_flexcanFilterIdMask[format] + 1U) : (first & (~first + 1U));
+
+    while ((size - 1U) > (last - first))
+    {
+        size >>= 1U;
+    }
+
+    return size;
+}
+
+/* Splits the wanted ranges in aligned blocks, all for the full resolution filters. */
+static void FLEXCAN_FILTER_InitBlocks(flexcan_filter_work_t *work, const flexcan_filter_layout_t *layout)
+{
+    flexcan_filter_block_t *block;
+    uint32_t format;
+    uint32_t first;
+    uint32_t last;
+    uint32_t size;
+    uint32_t i;
+
+    work->blockNum = 0U;
+    for (format = FLEXCAN_FILTER_STD; format <= FLEXCAN_FILTER_EXT; format++)
+    {
+        for (i = 0U; i < work->wantedNum[format]; i++)
+        {
+            first = work->wanted[format][i].first;
+            last  = work->wanted[format][i].last;
+            while (first <= last)
+            {
+                size          = FLEXCAN_FILTER_BlockSize(first, last, format);
+                block         = &work->blocks[work->blockNum];
+                block->id     = first;
+                block->mask   = s_flexcanFilterIdMask[format] & ~(size - 1U);
+                block->format = (uint8_t)format;
+                block->slot   = (uint8_t)kFLEXCAN_FILTER_SlotFull;
+                FLEXCAN_FILTER_UpdateCosts(work, block, layout);
+                work->blockNum++;
+
+                first += size;
+                if (first == 0U)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    work->poolNum = work->blockNum;
+    for (i = 0U; i < work->poolNum; i++)
+    {
+        FLEXCAN_FILTER_UpdatePartner(work, i);
+    }
+}
+
+/* Counts the blocks of the wanted ranges, FLEXCAN_FILTER_MAX_BLOCKS + 1 if they do not fit the work area. */
+static uint32_t FLEXCAN_FILTER_CountBlocks(const flexcan_filter_work_t *work)
+{
+    uint32_t count = 0U;
+    uint32_t format;
+    uint32_t first;
+    uint32_t last;
+    uint32_t size;
+    uint32_t i;
+
+    for (format = FLEXCAN_FILTER_STD; format <= FLEXCAN_FILTER_EXT; format++)
+    {
+        for (i = 0U; i < work->wantedNum[format]; i++)
+        {
+            first = work->wanted[format][i].first;
+            last  = work->wanted[format][i].last;
+            while ((first <= last) && (count <= FLEXCAN_FILTER_MAX_BLOCKS))
+            {
+                size = FLEXCAN_FILTER_BlockSize(first, last, format);
+                count++;
+                first += size;
+                if (first == 0U)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Fits the blocks in the filters of a layout: while there are more blocks than full resolution filters, either
+ * merges the two blocks whose merge accepts the fewest additional unwanted identifiers, or moves the block
+ * which accepts the fewest additional ones at low resolution to a low resolution filter.
+ * Returns the number of unwanted identifiers accepted, counting the overlaps of the blocks as many times, or
+ * UINT64_MAX if the blocks do not fit.
+ */
+static uint64_t FLEXCAN_FILTER_Fit(flexcan_filter_work_t *work, const flexcan_filter_layout_t *layout)
+{
+    uint32_t slotUsed[2] = {0U, 0U};
+    flexcan_filter_block_t *block;
+    int64_t bestCost;
+    int64_t cost;
+    uint32_t bestIndex;
+    uint32_t bestSlot;
+    uint64_t total = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    FLEXCAN_FILTER_InitBlocks(work, layout);
+
+    while (work->poolNum > layout->fullNum)
+    {
+        bestCost  = INT64_MAX;
+        bestIndex = 0U;
+        bestSlot  = (uint32_t)kFLEXCAN_FILTER_SlotNone;
+
+        /* Low resolution filters first on a tie, they keep the full resolution ones for the other blocks. */
+        for (j = 0U; j < 2U; j++)
+        {
+            if (slotUsed[j] == layout->slotNum[j])
+            {
+                continue;
+            }
+            for (i = 0U; i < work->poolNum; i++)
+            {
+                block = &work->blocks[i];
+                if (block->slotCost[j] == FLEXCAN_FILTER_NO_FIT)
+                {
+                    continue;
+                }
+                cost = (int64_t)block->slotCost[j] - (int64_t)block->cost;
+                if (cost < bestCost)
+                {
+                    bestCost  = cost;
+                    bestIndex = i;
+                    bestSlot  = j;
+                }
+            }
+        }
+        for (i = 0U; i < work->poolNum; i++)
+        {
+            block = &work->blocks[i];
+            if ((block->mergePartner != FLEXCAN_FILTER_NO_PARTNER) && ((int64_t)block->mergeCost < bestCost))
+            {
+                bestCost  = block->mergeCost;
+                bestIndex = i;
+                bestSlot  = (uint32_t)kFLEXCAN_FILTER_SlotNone;
+            }
+        }
+
+        if (bestCost == INT64_MAX)
+        {
+            return UINT64_MAX;
+        }
+        if (bestSlot == (uint32_t)kFLEXCAN_FILTER_SlotNone)
+        {
+            FLEXCAN_FILTER_PoolMerge(work, bestIndex, layout);
+        }
+        else
+        {
+            work->blocks[bestIndex].slot = layout->slot[bestSlot];
+            work->blocks[bestIndex].cost = work->blocks[bestIndex].slotCost[bestSlot];
+            slotUsed[bestSlot]++;
+            FLEXCAN_FILTER_PoolRemove(work, bestIndex, true);
+        }
+    }
+
+    for (i = 0U; i < work->blockNum; i++)
+    {
+        total += work->blocks[i].cost;
+    }
+
+    return total;
+}
+
+/*
+ * Counts the unwanted identifiers accepted by the filters of the blocks in the aligned range of 2^level
+ * identifiers from prefix. The range is split until a filter accepts it all or none does.
+ */
+static uint32_t FLEXCAN_FILTER_CountAccepted(const flexcan_filter_work_t *work,
+                                             uint32_t format,
+                                             uint32_t prefix,
+                                             uint32_t level)
+{
+    uint32_t low      = (1UL << level) - 1U;
+    uint32_t unwanted = FLEXCAN_FILTER_RangeCost(work, format, prefix, prefix | low);
+    bool partial      = false;
+    uint32_t id;
+    uint32_t mask;
+    uint32_t i;
+
+    if (unwanted == 0U)
+    {
+        return 0U;
+    }
+
+    for (i = 0U; i < work->blockNum; i++)
+    {
+        if ((!FLEXCAN_FILTER_SlotBlock(&work->blocks[i], work->blocks[i].slot, format, &id, &mask)) ||
+            ((((prefix ^ id) & mask) & ~low) != 0U))
+        {
+            continue;
+        }
+        if ((mask & low) == 0U)
+        {
+            return unwanted;
+        }
+        partial = true;
+    }
+
+    if (!partial)
+    {
+        return 0U;
+    }
+
+    return FLEXCAN_FILTER_CountAccepted(work, format, prefix, level - 1U) +
+           FLEXCAN_FILTER_CountAccepted(work, format, prefix | (1UL << (level - 1U)), level - 1U);
+}
+
+/* Encodes the filter and the mask of a block in the part of an Rx FIFO filter element. */
+static void FLEXCAN_FILTER_EncodeFifo(const flexcan_filter_block_t *block,
+                                      flexcan_filter_fifo_mode_t fifoMode,
+                                      uint32_t part,
+                                      uint32_t *filter,
+                                      uint32_t *mask)
+{
+    uint32_t id       = block->id;
+    uint32_t idMask   = block->mask;
+    bool extended     = (block->format == FLEXCAN_FILTER_EXT);
+    uint32_t filter32 = 0U;
+    uint32_t mask32   = 0U;
+
+    switch (fifoMode)
+    {
+        case kFLEXCAN_FILTER_FifoTypeA:
+            filter32 = extended ? FLEXCAN_FILTER_FIFO_EXT_A(id, 0, 1) : FLEXCAN_FILTER_FIFO_STD_A(id, 0, 0);
+            mask32   = extended ? FLEXCAN_FILTER_FIFO_EXT_A(idMask, 1, 1) : FLEXCAN_FILTER_FIFO_STD_A(idMask, 1, 1);
+            break;
+        case kFLEXCAN_FILTER_FifoTypeB:
+            filter32 = extended ? FLEXCAN_FILTER_FIFO_EXT_B(id, 0, 1) : FLEXCAN_FILTER_FIFO_STD_B(id, 0, 0);
+            mask32   = extended ? FLEXCAN_FILTER_FIFO_EXT_B(idMask, 1, 1) : FLEXCAN_FILTER_FIFO_STD_B(idMask, 1, 1);
+            /* The lower part is the upper one shifted by 16 bits. */
+            filter32 >>= 16U * part;
+            mask32 >>= 16U * part;
+            break;
+        case kFLEXCAN_FILTER_FifoTypeC:
+            filter32 = extended ? FLEXCAN_FILTER_FIFO_EXT_C(id) : FLEXCAN_FILTER_FIFO_STD_C(id);
+            mask32   = extended ? FLEXCAN_FILTER_FIFO_EXT_C(idMask) : FLEXCAN_FILTER_FIFO_STD_C(idMask);
+            /* The other parts are the upper one shifted by 8 bits each. */
+            filter32 >>= 8U * part;
+            mask32 >>= 8U * part;
+            break;
+        default:
+            assert(false);
+            break;
+    }
+
+    *filter |= filter32;
+    *mask |= mask32;
+}
+
+/* Builds the plan of the blocks fitted in a layout. */
+static void FLEXCAN_FILTER_Build(flexcan_filter_plan_t *plan,
+                                 const flexcan_filter_work_t *work,
+                                 const flexcan_filter_layout_t *layout)
+{
+    uint32_t parts = (layout->fifoMode == kFLEXCAN_FILTER_FifoTypeC) ?
+                         4U :
+                         ((layout->fifoMode == kFLEXCAN_FILTER_FifoTypeB) ? 2U : 1U);
+    const flexcan_filter_block_t *partBlock[FLEXCAN_FILTER_FIFO_FILTER_MAX][4];
+    const flexcan_filter_block_t *block;
+    uint32_t next[2] = {0U, layout->fifoMaskNum * parts};
+    uint32_t reference = FLEXCAN_FILTER_FIFO_FILTER_MAX;
+    uint32_t globalMask = 0U;
+    uint32_t element;
+    uint32_t part;
+    uint32_t i;
+
+    (void)memset(partBlock, 0, sizeof(partBlock));
+    plan->enableRxFifo  = (layout->fifoMode != kFLEXCAN_FILTER_FifoNone);
+    plan->fifoFilterNum = (uint8_t)layout->fifoFilterNum;
+    plan->fifoMaskNum   = (uint8_t)layout->fifoMaskNum;
+    plan->fifoFilterType =
+        (layout->fifoMode == kFLEXCAN_FILTER_FifoTypeC) ?
+            kFLEXCAN_FILTER_FifoFilterTypeC :
+            ((layout->fifoMode == kFLEXCAN_FILTER_FifoTypeB) ? kFLEXCAN_FILTER_FifoFilterTypeB :
+                                                               kFLEXCAN_FILTER_FifoFilterTypeA);
+    /* The elements without individual mask compare all their bits. */
+    plan->fifoGlobalMask = 0xFFFFFFFFU;
+    plan->firstMb        = (uint8_t)layout->firstMb;
+    plan->mbNum          = 0U;
+
+    for (i = 0U; i < work->blockNum; i++)
+    {
+        block = &work->blocks[i];
+        if (block->slot == (uint8_t)kFLEXCAN_FILTER_SlotFull)
+        {
+            /* The format A elements with an individual mask first, then the Message Buffers. */
+            if ((layout->fifoMode == kFLEXCAN_FILTER_FifoTypeA) && (next[0] < layout->fifoMaskNum))
+            {
+                partBlock[next[0]][0] = block;
+                next[0]++;
+            }
+            else
+            {
+                plan->mbId[plan->mbNum] = (block->format == FLEXCAN_FILTER_EXT) ? FLEXCAN_FILTER_ID_EXT(block->id) :
+                                                                                  FLEXCAN_FILTER_ID_STD(block->id);
+                plan->mbFormat[plan->mbNum] = (block->format == FLEXCAN_FILTER_EXT) ?
+                                                  kFLEXCAN_FILTER_FrameFormatExtend :
+                                                  kFLEXCAN_FILTER_FrameFormatStandard;
+                plan->mbMask[plan->mbNum] = (block->format == FLEXCAN_FILTER_EXT) ?
+                                                FLEXCAN_FILTER_MB_EXT(block->mask, 1, 1) :
+                                                FLEXCAN_FILTER_MB_STD(block->mask, 1, 1);
+                plan->mbNum++;
+            }
+        }
+        else
+        {
+            /* Individual mask elements, or global mask elements after them. */
+            part = (block->slot == layout->slot[0]) ? 0U : 1U;
+            partBlock[next[part] / parts][next[part] % parts] = block;
+            next[part]++;
+        }
+    }
+
+    if (!plan->enableRxFifo)
+    {
+        return;
+    }
+
+    for (element = 0U; element < layout->fifoFilterNum; element++)
+    {
+        plan->fifoFilterTable[element] = 0U;
+        if (element < FLEXCAN_FILTER_FIFO_MASK_MAX)
+        {
+            plan->fifoMask[element] = 0U;
+        }
+        if (partBlock[element][0] == NULL)
+        {
+            continue;
+        }
+        if (reference == FLEXCAN_FILTER_FIFO_FILTER_MAX)
+        {
+            reference = element;
+        }
+        for (part = 0U; part < parts; part++)
+        {
+            /* An unused part repeats the first one. */
+            block = (partBlock[element][part] != NULL) ? partBlock[element][part] : partBlock[element][0];
+            /* The global mask elements use the global mask, their own is not kept. */
+            FLEXCAN_FILTER_EncodeFifo(block, layout->fifoMode, part, &plan->fifoFilterTable[element],
+                                      (element < layout->fifoMaskNum) ? &plan->fifoMask[element] : &globalMask);
+        }
+    }
+
+    if (reference == FLEXCAN_FILTER_FIFO_FILTER_MAX)
+    {
+        /* No filter in the Rx FIFO, which rejects all the frames. */
+        plan->fifoFilterType = kFLEXCAN_FILTER_FifoFilterTypeD;
+        return;
+    }
+
+    /*
+     * An unused element repeats the first used one. With all the bits compared, an element accepts a part of
+     * what it accepts with its individual mask.
+     */
+    for (element = 0U; element < layout->fifoFilterNum; element++)
+    {
+        if (partBlock[element][0] != NULL)
+        {
+            continue;
+        }
+        plan->fifoFilterTable[element] = plan->fifoFilterTable[reference];
+        if (element < layout->fifoMaskNum)
+        {
+            plan->fifoMask[element] = (reference < layout->fifoMaskNum) ? plan->fifoMask[reference] : 0xFFFFFFFFU;
+        }
+    }
+}
+
+/* Sorts the ranges and merges the overlapping and contiguous ones, returns the number of merged ranges. */
+static uint32_t FLEXCAN_FILTER_SortRanges(flexcan_filter_range_t *ranges, uint32_t count)
+{
+    flexcan_filter_range_t range;
+    uint32_t merged;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 1U; i < count; i++)
+    {
+        range = ranges[i];
+        for (j = i; (j > 0U) && (ranges[j - 1U].first > range.first); j--)
+        {
+            ranges[j] = ranges[j - 1U];
+        }
+        ranges[j] = range;
+    }
+
+    merged = 0U;
+    for (i = 0U; i < count; i++)
+    {
+        if ((merged != 0U) && (ranges[i].first <= (ranges[merged - 1U].last + 1U)))
+        {
+            if (ranges[i].last > ranges[merged - 1U].last)
+            {
+                ranges[merged - 1U].last = ranges[i].last;
+            }
+        }
+        else
+        {
+            ranges[merged] = ranges[i];
+            merged++;
+        }
+    }
+
+    return merged;
+}
+
+/* Copies the rules of a format to ranges, returns false if they are invalid or do not fit. */
+static bool FLEXCAN_FILTER_LoadRules(flexcan_filter_range_t *ranges,
+                                     uint32_t *count,
+                                     uint32_t format,
+                                     const flexcan_filter_rule_t *rules,
+                                     uint32_t ruleNum)
+{
+    uint32_t i;
+
+    *count = 0U;
+    for (i = 0U; i < ruleNum; i++)
+    {
+        if ((rules[i].lastId < rules[i].firstId) || (rules[i].lastId > s_flexcanFilterIdMask[FLEXCAN_FILTER_EXT]) ||
+            ((rules[i].format == kFLEXCAN_FILTER_FrameFormatStandard) &&
+             (rules[i].lastId > s_flexcanFilterIdMask[FLEXCAN_FILTER_STD])))
+        {
+            return false;
+        }
+        if ((uint32_t)rules[i].format != format)
+        {
+            continue;
+        }
+        if (*count == FLEXCAN_FILTER_MAX_RANGES)
+        {
+            return false;
+        }
+        ranges[*count].first = rules[i].firstId;
+        ranges[*count].last  = rules[i].lastId;
+        (*count)++;
+    }
+    *count = FLEXCAN_FILTER_SortRanges(ranges, *count);
+
+    return true;
+}
+
+/* Computes the unwanted ranges of a format: the bus ranges, or all the identifiers, out of the wanted ones. */
+static bool FLEXCAN_FILTER_InitUnwanted(flexcan_filter_work_t *work, uint32_t format)
+{
+    flexcan_filter_range_t *unwanted = work->unwanted[format];
+    const flexcan_filter_range_t *wanted;
+    uint32_t count = work->unwantedNum[format];
+    uint32_t first;
+    uint32_t last;
+    uint32_t i;
+    uint32_t j;
+
+    /* The complement of the wanted ranges in each candidate range, in place from the end. */
+    j = 0U;
+    for (i = 0U; i < count; i++)
+    {
+        first = unwanted[i].first;
+        last  = unwanted[i].last;
+        while (j < work->wantedNum[format])
+        {
+            wanted = &work->wanted[format][j];
+            if (wanted->last < first)
+            {
+                j++;
+                continue;
+            }
+            if (wanted->first > last)
+            {
+                break;
+            }
+            if (wanted->first > first)
+            {
+                if (work->unwantedNum[format] == FLEXCAN_FILTER_MAX_RANGES)
+                {
+                    return false;
+                }
+                work->unwanted[format][work->unwantedNum[format]].first = first;
+                work->unwanted[format][work->unwantedNum[format]].last  = wanted->first - 1U;
+                work->unwantedNum[format]++;
+            }
+            if (wanted->last >= last)
+            {
+                first = last + 1U;
+                break;
+            }
+            first = wanted->last + 1U;
+            j++;
+        }
+        if (first <= last)
+        {
+            if (work->unwantedNum[format] == FLEXCAN_FILTER_MAX_RANGES)
+            {
+                return false;
+            }
+            work->unwanted[format][work->unwantedNum[format]].first = first;
+            work->unwanted[format][work->unwantedNum[format]].last  = last;
+            work->unwantedNum[format]++;
+        }
+    }
+
+    /* Move the results in place of the candidate ranges. */
+    for (i = count; i < work->unwantedNum[format]; i++)
+    {
+        unwanted[i - count] = unwanted[i];
+    }
+    work->unwantedNum[format] -= count;
+
+    return true;
+}
+
+/* Gets the layout of an Rx FIFO format and size, returns false if the Message Buffers cannot hold it. */
+static bool FLEXCAN_FILTER_GetLayout(flexcan_filter_layout_t *layout,
+                                     const flexcan_filter_config_t *config,
+                                     flexcan_filter_fifo_mode_t fifoMode,
+                                     uint32_t fifoFilterNum)
+{
+    uint32_t rxEnd = (uint32_t)config->mbNum - config->reservedMbNum;
+    uint32_t parts = (fifoMode == kFLEXCAN_FILTER_FifoTypeC) ? 4U : ((fifoMode == kFLEXCAN_FILTER_FifoTypeB) ? 2U : 1U);
+    uint32_t occupiedMbNum = 0U;
+
+    (void)memset(layout, 0, sizeof(*layout));
+    layout->fifoMode      = fifoMode;
+    layout->fifoFilterNum = fifoFilterNum;
+
+    if (fifoMode != kFLEXCAN_FILTER_FifoNone)
+    {
+        /* The Rx FIFO and its filter table take the first Message Buffers, the driver needs one more after them. */
+        occupiedMbNum = 6U + (fifoFilterNum / 4U);
+        if ((occupiedMbNum + 2U) > config->mbNum)
+        {
+            return false;
+        }
+        /* The first Rx FIFO elements use the individual masks of their Message Buffer index. */
+        layout->fifoMaskNum =
+            (occupiedMbNum < FLEXCAN_FILTER_FIFO_MASK_MAX) ? occupiedMbNum : FLEXCAN_FILTER_FIFO_MASK_MAX;
+    }
+
+    layout->firstMb = occupiedMbNum;
+#if ((defined(FSL_FEATURE_FLEXCAN_HAS_ERRATA_5641) && FSL_FEATURE_FLEXCAN_HAS_ERRATA_5641) || \
+     (defined(FSL_FEATURE_FLEXCAN_HAS_ERRATA_5829) && FSL_FEATURE_FLEXCAN_HAS_ERRATA_5829))
+    /* The first valid Message Buffer is kept inactive by the driver. */
+    layout->firstMb++;
+#endif
+    if (layout->firstMb > rxEnd)
+    {
+        return false;
+    }
+    layout->mbNum   = ((rxEnd - layout->firstMb) < config->maxRxMbNum) ? (rxEnd - layout->firstMb) : config->maxRxMbNum;
+    layout->fullNum = layout->mbNum;
+
+    switch (fifoMode)
+    {
+        case kFLEXCAN_FILTER_FifoTypeA:
+            layout->fullNum += layout->fifoMaskNum;
+            layout->slot[0] = (uint8_t)kFLEXCAN_FILTER_SlotNone;
+            layout->slot[1] = (uint8_t)kFLEXCAN_FILTER_SlotAGlobal;
+            break;
+        case kFLEXCAN_FILTER_FifoTypeB:
+            layout->slot[0] = (uint8_t)kFLEXCAN_FILTER_SlotBMask;
+            layout->slot[1] = (uint8_t)kFLEXCAN_FILTER_SlotBGlobal;
+            layout->slotNum[0] = layout->fifoMaskNum * parts;
+            break;
+        case kFLEXCAN_FILTER_FifoTypeC:
+            layout->slot[0] = (uint8_t)kFLEXCAN_FILTER_SlotCMask;
+            layout->slot[1] = (uint8_t)kFLEXCAN_FILTER_SlotCGlobal;
+            layout->slotNum[0] = layout->fifoMaskNum * parts;
+            break;
+        default:
+            layout->slot[0] = (uint8_t)kFLEXCAN_FILTER_SlotNone;
+            layout->slot[1] = (uint8_t)kFLEXCAN_FILTER_SlotNone;
+            break;
+    }
+    if (fifoMode != kFLEXCAN_FILTER_FifoNone)
+    {
+        layout->slotNum[1] = (fifoFilterNum - layout->fifoMaskNum) * parts;
+    }
+
+    return true;
+}
+
+/*!
+ * brief Gets the default configuration.
+ *
+ * param config The configuration.
+ */
+void FLEXCAN_FILTER_GetDefaultConfig(flexcan_filter_config_t *config)
+{
+    assert(NULL != config);
+
+    (void)memset(config, 0, sizeof(*config));
+    config->mbNum            = 16U;
+    config->reservedMbNum    = 0U;
+    config->maxRxMbNum       = FLEXCAN_FILTER_MB_MAX;
+    config->maxFifoFilterNum = (uint8_t)FLEXCAN_FILTER_FIFO_FILTER_MAX;
+    config->fifoMode         = kFLEXCAN_FILTER_FifoAuto;
+    config->busRules         = NULL;
+    config->busRuleNum       = 0U;
+}
+
+/*!
+ * brief Computes the acceptance filters of a set of identifiers.
+ *
+ * param plan The plan.
+ * param config The configuration.
+ * param rules The identifiers wanted by the application.
+ * param ruleNum Number of rules.
+ * param work Work area of the computation.
+ * retval kStatus_FLEXCAN_FILTER_Success The plan is computed.
+ * retval kStatus_FLEXCAN_FILTER_InvalidArgument A rule or the configuration is invalid.
+ * retval kStatus_FLEXCAN_FILTER_OutOfRange The ranges do not fit the work area, or the filters available cannot
+ *        receive one of the frame formats.
+ */
+flexcan_filter_status_t FLEXCAN_FILTER_Plan(flexcan_filter_plan_t *plan,
+                                            const flexcan_filter_config_t *config,
+                                            const flexcan_filter_rule_t *rules,
+                                            uint32_t ruleNum,
+                                            flexcan_filter_work_t *work)
+{
+    assert((NULL != plan) && (NULL != config) && (NULL != work));
+    assert((NULL != rules) || (0U == ruleNum));
+
+    flexcan_filter_layout_t best;
+    flexcan_filter_layout_t layout;
+    uint32_t fifoMode;
+    uint64_t bestCost = UINT64_MAX;
+    uint64_t cost;
+    uint32_t fifoFilterNum;
+    uint32_t format;
+    uint32_t i;
+
+    if ((config->mbNum == 0U) || (config->mbNum > FLEXCAN_FILTER_MB_MAX) ||
+        (config->reservedMbNum >= config->mbNum) ||
+        ((config->fifoMode != kFLEXCAN_FILTER_FifoNone) && (config->fifoMode != kFLEXCAN_FILTER_FifoAuto) &&
+         ((config->maxFifoFilterNum < 8U) || (config->maxFifoFilterNum > FLEXCAN_FILTER_FIFO_FILTER_MAX))))
+    {
+        return kStatus_FLEXCAN_FILTER_InvalidArgument;
+    }
+
+    (void)memset(plan, 0, sizeof(*plan));
+    for (format = FLEXCAN_FILTER_STD; format <= FLEXCAN_FILTER_EXT; format++)
+    {
+        if (!FLEXCAN_FILTER_LoadRules(work->wanted[format], &work->wantedNum[format], format, rules, ruleNum))
+        {
+            return kStatus_FLEXCAN_FILTER_InvalidArgument;
+        }
+        if (config->busRules != NULL)
+        {
+            if (!FLEXCAN_FILTER_LoadRules(work->unwanted[format], &work->unwantedNum[format], format,
+                                          config->busRules, config->busRuleNum))
+            {
+                return kStatus_FLEXCAN_FILTER_InvalidArgument;
+            }
+        }
+        else
+        {
+            work->unwanted[format][0].first = 0U;
+            work->unwanted[format][0].last  = s_flexcanFilterIdMask[format];
+            work->unwantedNum[format]       = 1U;
+        }
+        if (!FLEXCAN_FILTER_InitUnwanted(work, format))
+        {
+            return kStatus_FLEXCAN_FILTER_OutOfRange;
+        }
+
+        for (i = 0U; i < work->wantedNum[format]; i++)
+        {
+            plan->wantedIdNum[format] += work->wanted[format][i].last - work->wanted[format][i].first + 1U;
+        }
+        for (i = 0U; i < work->unwantedNum[format]; i++)
+        {
+            plan->unwantedIdNum[format] += work->unwanted[format][i].last - work->unwanted[format][i].first + 1U;
+        }
+    }
+    if (FLEXCAN_FILTER_CountBlocks(work) > FLEXCAN_FILTER_MAX_BLOCKS)
+    {
+        return kStatus_FLEXCAN_FILTER_OutOfRange;
+    }
+
+    /* Message Buffers only, then each Rx FIFO format and size allowed; the first of the cheapest layouts wins. */
+    (void)memset(&best, 0, sizeof(best));
+    for (fifoMode = (uint32_t)kFLEXCAN_FILTER_FifoNone; fifoMode <= (uint32_t)kFLEXCAN_FILTER_FifoTypeC; fifoMode++)
+    {
+        if ((fifoMode == (uint32_t)kFLEXCAN_FILTER_FifoAuto) ||
+            ((fifoMode == (uint32_t)kFLEXCAN_FILTER_FifoNone) && (config->fifoMode != kFLEXCAN_FILTER_FifoNone) &&
+             (config->fifoMode != kFLEXCAN_FILTER_FifoAuto)) ||
+            ((fifoMode != (uint32_t)kFLEXCAN_FILTER_FifoNone) && (config->fifoMode != kFLEXCAN_FILTER_FifoAuto) &&
+             ((uint32_t)config->fifoMode != fifoMode)))
+        {
+            continue;
+        }
+
+        for (fifoFilterNum = (fifoMode == (uint32_t)kFLEXCAN_FILTER_FifoNone) ? 0U : 8U;
+             (fifoFilterNum <= config->maxFifoFilterNum) && (bestCost != 0U); fifoFilterNum += 8U)
+        {
+            if (FLEXCAN_FILTER_GetLayout(&layout, config, (flexcan_filter_fifo_mode_t)fifoMode, fifoFilterNum))
+            {
+                cost = FLEXCAN_FILTER_Fit(work, &layout);
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    best     = layout;
+                }
+            }
+            if (fifoMode == (uint32_t)kFLEXCAN_FILTER_FifoNone)
+            {
+                break;
+            }
+        }
+    }
+
+    if (bestCost == UINT64_MAX)
+    {
+        return kStatus_FLEXCAN_FILTER_OutOfRange;
+    }
+
+    (void)FLEXCAN_FILTER_Fit(work, &best);
+    FLEXCAN_FILTER_Build(plan, work, &best);
+    for (format = FLEXCAN_FILTER_STD; format <= FLEXCAN_FILTER_EXT; format++)
+    {
+        plan->falseAcceptIdNum[format] =
+            FLEXCAN_FILTER_CountAccepted(work, format, 0U, s_flexcanFilterIdBits[format]);
+    }
+
+    return kStatus_FLEXCAN_FILTER_Success;
+}
+
+/*!
+ * brief Checks an identifier against the filters of a plan, as the controller matches the frames.
+ *
+ * param plan The plan.
+ * param id The identifier.
+ * param format Standard or extended identifier.
+ * return true if the filters accept the data frames of the identifier.
+ */
+bool FLEXCAN_FILTER_Accepts(const flexcan_filter_plan_t *plan, uint32_t id, flexcan_filter_frame_format_t format)
+{
+    assert(NULL != plan);
+
+    bool extended   = (format == kFLEXCAN_FILTER_FrameFormatExtend);
+    uint32_t idWord = extended ? FLEXCAN_FILTER_ID_EXT(id) : FLEXCAN_FILTER_ID_STD(id);
+    uint32_t flags  = extended ? 0x40000000U : 0U;
+    uint32_t candidate;
+    uint32_t element;
+    uint32_t mask;
+    uint32_t part;
+    uint32_t i;
+
+    for (i = 0U; i < plan->mbNum; i++)
+    {
+        if ((plan->mbFormat[i] == format) &&
+            (((idWord ^ plan->mbId[i]) & plan->mbMask[i] & FLEXCAN_FILTER_ID_MASK) == 0U))
+        {
+            return true;
+        }
+    }
+
+    if ((!plan->enableRxFifo) || (plan->fifoFilterType == kFLEXCAN_FILTER_FifoFilterTypeD))
+    {
+        return false;
+    }
+
+    for (i = 0U; i < plan->fifoFilterNum; i++)
+    {
+        element = plan->fifoFilterTable[i];
+        mask    = (i < plan->fifoMaskNum) ? plan->fifoMask[i] : plan->fifoGlobalMask;
+        switch (plan->fifoFilterType)
+        {
+            case kFLEXCAN_FILTER_FifoFilterTypeA:
+                candidate = flags | (extended ? ((id & 0x1FFFFFFFU) << 1U) : ((id & 0x7FFU) << 19U));
+                if (((candidate ^ element) & mask) == 0U)
+                {
+                    return true;
+                }
+                break;
+            case kFLEXCAN_FILTER_FifoFilterTypeB:
+                candidate = flags | (extended ? (((id & 0x1FFFFFFFU) >> 15U) << 16U) : ((id & 0x7FFU) << 19U));
+                candidate |= candidate >> 16U;
+                if (((((candidate ^ element) & mask) & 0xFFFF0000U) == 0U) ||
+                    ((((candidate ^ element) & mask) & 0x0000FFFFU) == 0U))
+                {
+                    return true;
+                }
+                break;
+            default:
+                candidate = extended ? ((id >> 21U) & 0xFFU) : ((id >> 3U) & 0xFFU);
+                for (part = 0U; part < 32U; part += 8U)
+                {
+                    if ((((candidate << part) ^ element) & mask & (0xFFUL << part)) == 0U)
+                    {
+                        return true;
+                    }
+                }
+                break;
+        }
+    }
+
+    return false;
+}
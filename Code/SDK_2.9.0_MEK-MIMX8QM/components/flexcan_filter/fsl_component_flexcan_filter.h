@@ -0,0 +1,273 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_FLEXCAN_FILTER_H_
+#define _FSL_COMPONENT_FLEXCAN_FILTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup flexcan_filter
+ * @{
+ */
+
+/*!
+ * @brief The FlexCAN acceptance filter planner
+ *
+ * The planner takes the identifiers an application receives, as single identifiers and ranges, and computes
+ * the acceptance filters of a FlexCAN: the Rx FIFO filter table in format A, B or C, the individual masks and
+ * the dedicated Rx Message Buffers. It minimises the false accepts, the frames the controller receives but the
+ * application does not want, within the Message Buffers given to it.
+ *
+ * Each range is first split into aligned blocks, which the filters match exactly with a mask. When there are
+ * more blocks than filters, the planner either merges the two blocks whose merged mask accepts the fewest
+ * additional identifiers, or moves a block to a FIFO filter of lower resolution (a global mask element, a
+ * format B or C element), whichever costs less, until the blocks fit. Each Rx FIFO size and format allowed
+ * by the configuration is tried, and the layout with the fewest false accepts is kept.
+ *
+ * When the configuration lists the identifiers present on the bus, from the DBC of the network for example,
+ * the false accepts are counted on these identifiers only: the other identifiers are free to accept, which
+ * gives much coarser and fewer filters. Otherwise all the identifiers of the format count.
+ *
+ * The plan is computed once, typically at initialization, and applied with FLEXCAN_FILTER_Apply() of
+ * fsl_component_flexcan_filter_apply.h. The planner is pure computation and does not depend on the FlexCAN
+ * driver or the device headers, so that plans can also be computed and checked on a host.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Largest number of merged ranges of a format, for the wanted and for the bus identifiers. */
+#ifndef FLEXCAN_FILTER_MAX_RANGES
+#define FLEXCAN_FILTER_MAX_RANGES (128U)
+#endif
+
+/*! @brief Largest number of aligned blocks the wanted ranges are split into. */
+#ifndef FLEXCAN_FILTER_MAX_BLOCKS
+#define FLEXCAN_FILTER_MAX_BLOCKS (256U)
+#endif
+
+/*! @brief Largest Rx FIFO filter table, in elements. */
+#define FLEXCAN_FILTER_FIFO_FILTER_MAX (128U)
+
+/*! @brief Largest number of Rx FIFO filter elements with an individual mask. */
+#define FLEXCAN_FILTER_FIFO_MASK_MAX (32U)
+
+/*! @brief Largest number of Message Buffers of a FlexCAN. */
+#define FLEXCAN_FILTER_MB_MAX (64U)
+
+/*! @brief Status of the planner, with the values of the generic status codes of fsl_common.h. */
+typedef enum _flexcan_filter_status
+{
+    kStatus_FLEXCAN_FILTER_Success         = 0, /*!< Same as kStatus_Success. */
+    kStatus_FLEXCAN_FILTER_OutOfRange      = 3, /*!< Same as kStatus_OutOfRange. */
+    kStatus_FLEXCAN_FILTER_InvalidArgument = 4, /*!< Same as kStatus_InvalidArgument. */
+} flexcan_filter_status_t;
+
+/*! @brief Identifier format, with the values of flexcan_frame_format_t. */
+typedef enum _flexcan_filter_frame_format
+{
+    kFLEXCAN_FILTER_FrameFormatStandard = 0U, /*!< Standard identifier, 11 bits. */
+    kFLEXCAN_FILTER_FrameFormatExtend   = 1U, /*!< Extended identifier, 29 bits. */
+} flexcan_filter_frame_format_t;
+
+/*! @brief Format of the Rx FIFO filter table, with the values of flexcan_rx_fifo_filter_type_t. */
+typedef enum _flexcan_filter_fifo_type
+{
+    kFLEXCAN_FILTER_FifoFilterTypeA = 0U, /*!< One full identifier per element. */
+    kFLEXCAN_FILTER_FifoFilterTypeB = 1U, /*!< Two identifiers of 14 upper bits per element. */
+    kFLEXCAN_FILTER_FifoFilterTypeC = 2U, /*!< Four identifiers of 8 upper bits per element. */
+    kFLEXCAN_FILTER_FifoFilterTypeD = 3U, /*!< All the frames rejected. */
+} flexcan_filter_fifo_type_t;
+
+/*! @brief Initializer of a rule receiving one standard identifier. */
+#define FLEXCAN_FILTER_STD_ID(id)                            \
+    {                                                        \
+        (id), (id), kFLEXCAN_FILTER_FrameFormatStandard      \
+    }
+/*! @brief Initializer of a rule receiving a range of standard identifiers. */
+#define FLEXCAN_FILTER_STD_RANGE(first, last)                \
+    {                                                        \
+        (first), (last), kFLEXCAN_FILTER_FrameFormatStandard \
+    }
+/*! @brief Initializer of a rule receiving one extended identifier. */
+#define FLEXCAN_FILTER_EXT_ID(id)                            \
+    {                                                        \
+        (id), (id), kFLEXCAN_FILTER_FrameFormatExtend        \
+    }
+/*! @brief Initializer of a rule receiving a range of extended identifiers. */
+#define FLEXCAN_FILTER_EXT_RANGE(first, last)                \
+    {                                                        \
+        (first), (last), kFLEXCAN_FILTER_FrameFormatExtend   \
+    }
+
+/*! @brief Use of the Rx FIFO by the plan. */
+typedef enum _flexcan_filter_fifo_mode
+{
+    kFLEXCAN_FILTER_FifoNone  = 0U, /*!< The plan uses Message Buffers only. */
+    kFLEXCAN_FILTER_FifoAuto  = 1U, /*!< The plan uses the Rx FIFO, in any format, when it accepts less. */
+    kFLEXCAN_FILTER_FifoTypeA = 2U, /*!< The plan uses the Rx FIFO with format A filters. */
+    kFLEXCAN_FILTER_FifoTypeB = 3U, /*!< The plan uses the Rx FIFO with format B filters. */
+    kFLEXCAN_FILTER_FifoTypeC = 4U, /*!< The plan uses the Rx FIFO with format C filters. */
+} flexcan_filter_fifo_mode_t;
+
+/*! @brief Identifiers received by the application, or present on the bus. */
+typedef struct _flexcan_filter_rule
+{
+    uint32_t firstId;                     /*!< First identifier of the range. */
+    uint32_t lastId;                      /*!< Last identifier of the range, firstId for a single identifier. */
+    flexcan_filter_frame_format_t format; /*!< Standard or extended identifiers. */
+} flexcan_filter_rule_t;
+
+/*! @brief Planner configuration. */
+typedef struct _flexcan_filter_config
+{
+    uint8_t mbNum;                         /*!< Message Buffers of the FlexCAN, flexcan_config_t::maxMbNum. */
+    uint8_t reservedMbNum;                 /*!< Message Buffers at the end kept by the application, for the
+                                                transmission for example, not used by the plan. */
+    uint8_t maxRxMbNum;                    /*!< Largest number of Rx Message Buffers of the plan, 0 to receive
+                                                with the Rx FIFO only. */
+    uint8_t maxFifoFilterNum;              /*!< Largest Rx FIFO filter table, 8 to 128 elements. */
+    flexcan_filter_fifo_mode_t fifoMode;   /*!< Use of the Rx FIFO. */
+    const flexcan_filter_rule_t *busRules; /*!< Identifiers present on the bus, NULL if unknown. */
+    uint32_t busRuleNum;                   /*!< Number of rules in busRules. */
+} flexcan_filter_config_t;
+
+/*!
+ * @brief Acceptance filter plan.
+ *
+ * The plan holds the register values of the filters, in the layout of the FlexCAN Message Buffer and Rx FIFO
+ * words, and the false accepts of the filters: the identifiers
+ * they accept which are not wanted, among all the identifiers, or among the bus identifiers when the
+ * configuration lists them. Index 0 of the counters is for the standard identifiers, index 1 for the
+ * extended ones.
+ */
+typedef struct _flexcan_filter_plan
+{
+    bool enableRxFifo;                                             /*!< The plan uses the Rx FIFO. */
+    flexcan_filter_fifo_type_t fifoFilterType;                     /*!< Format of the Rx FIFO filter table. */
+    uint8_t fifoFilterNum;                                         /*!< Elements of the Rx FIFO filter table. */
+    uint8_t fifoMaskNum;                                           /*!< Elements with an individual mask, the
+                                                                        first ones. */
+    uint32_t fifoFilterTable[FLEXCAN_FILTER_FIFO_FILTER_MAX];      /*!< Rx FIFO filter table. */
+    uint32_t fifoMask[FLEXCAN_FILTER_FIFO_MASK_MAX];               /*!< Individual masks of the first elements. */
+    uint32_t fifoGlobalMask;                                       /*!< Mask of the other elements. */
+    uint8_t firstMb;                                               /*!< First Rx Message Buffer of the plan. */
+    uint8_t mbNum;                                                 /*!< Number of Rx Message Buffers, from
+                                                                        firstMb. */
+    uint32_t mbId[FLEXCAN_FILTER_MB_MAX];                          /*!< Identifiers of the Rx Message Buffers, as
+                                                                        FLEXCAN_ID_STD() or FLEXCAN_ID_EXT(). */
+    flexcan_filter_frame_format_t mbFormat[FLEXCAN_FILTER_MB_MAX]; /*!< Formats of the Rx Message Buffers. */
+    uint32_t mbMask[FLEXCAN_FILTER_MB_MAX];                        /*!< Individual masks of the Rx Message
+                                                                        Buffers. */
+    uint32_t wantedIdNum[2];                                       /*!< Identifiers wanted by the application. */
+    uint32_t unwantedIdNum[2];                                     /*!< Identifiers not wanted, the bus ones if
+                                                                        known. */
+    uint32_t falseAcceptIdNum[2];                                  /*!< Unwanted identifiers the filters accept. */
+} flexcan_filter_plan_t;
+
+/*! @brief Range of identifiers, for the planner work area. */
+typedef struct _flexcan_filter_range
+{
+    uint32_t first; /*!< First identifier. */
+    uint32_t last;  /*!< Last identifier. */
+} flexcan_filter_range_t;
+
+/*! @brief Block of identifiers matched by an identifier and a mask, for the planner work area. */
+typedef struct _flexcan_filter_block
+{
+    uint32_t id;          /*!< Identifier, with the bits out of the mask cleared. */
+    uint32_t mask;        /*!< Mask, the bits compared by the filter. */
+    uint32_t cost;        /*!< Unwanted identifiers the block accepts. */
+    uint32_t slotCost[2]; /*!< Unwanted identifiers the block accepts in each kind of low resolution filter. */
+    int32_t mergeCost;    /*!< Additional unwanted identifiers accepted if merged with mergePartner. */
+    uint16_t mergePartner; /*!< Block with the cheapest merge. */
+    uint8_t format;       /*!< 0 for standard identifiers, 1 for extended ones. */
+    uint8_t slot;         /*!< Kind of filter of the block. */
+} flexcan_filter_block_t;
+
+/*!
+ * @brief Work area of the planner.
+ *
+ * The work area is only used during FLEXCAN_FILTER_Plan(), it can be shared by the plans computed one after
+ * the other.
+ */
+typedef struct _flexcan_filter_work
+{
+    flexcan_filter_range_t wanted[2][FLEXCAN_FILTER_MAX_RANGES];   /*!< Wanted ranges, sorted and merged. */
+    flexcan_filter_range_t unwanted[2][FLEXCAN_FILTER_MAX_RANGES]; /*!< Unwanted ranges, sorted. */
+    uint32_t wantedNum[2];                                         /*!< Number of wanted ranges. */
+    uint32_t unwantedNum[2];                                       /*!< Number of unwanted ranges. */
+    flexcan_filter_block_t blocks[FLEXCAN_FILTER_MAX_BLOCKS];      /*!< Blocks of the wanted ranges. */
+    uint32_t blockNum;                                             /*!< Number of blocks. */
+    uint32_t poolNum;                                              /*!< Blocks for the full resolution filters,
+                                                                        the first ones. */
+} flexcan_filter_work_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Gets the default configuration.
+ *
+ * The default configuration matches the default FlexCAN configuration of FLEXCAN_GetDefaultConfig(), with
+ * 16 Message Buffers, all available to the plan, and an Rx FIFO of up to 128 filters used when it accepts
+ * less. The bus identifiers are unknown.
+ *
+ * @param config The configuration.
+ */
+void FLEXCAN_FILTER_GetDefaultConfig(flexcan_filter_config_t *config);
+
+/*!
+ * @brief Computes the acceptance filters of a set of identifiers.
+ *
+ * The identifiers of all the rules are accepted by the plan. The filters are computed for the data frames;
+ * the format C filters also accept the remote frames.
+ *
+ * The computation takes in the order of the square of the number of identifier blocks cost evaluations for
+ * each Rx FIFO layout tried.
+ *
+ * @param plan The plan.
+ * @param config The configuration.
+ * @param rules The identifiers wanted by the application.
+ * @param ruleNum Number of rules.
+ * @param work Work area of the computation.
+ * @retval kStatus_FLEXCAN_FILTER_Success The plan is computed.
+ * @retval kStatus_FLEXCAN_FILTER_InvalidArgument A rule or the configuration is invalid.
+ * @retval kStatus_FLEXCAN_FILTER_OutOfRange The ranges do not fit the work area, or the filters available cannot
+ *         receive one of the frame formats.
+ */
+flexcan_filter_status_t FLEXCAN_FILTER_Plan(flexcan_filter_plan_t *plan,
+                                            const flexcan_filter_config_t *config,
+                                            const flexcan_filter_rule_t *rules,
+                                            uint32_t ruleNum,
+                                            flexcan_filter_work_t *work);
+
+/*!
+ * @brief Checks an identifier against the filters of a plan, as the controller matches the frames.
+ *
+ * @param plan The plan.
+ * @param id The identifier.
+ * @param format Standard or extended identifier.
+ * @return true if the filters accept the data frames of the identifier.
+ */
+bool FLEXCAN_FILTER_Accepts(const flexcan_filter_plan_t *plan, uint32_t id, flexcan_filter_frame_format_t format);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_COMPONENT_FLEXCAN_FILTER_H_ */
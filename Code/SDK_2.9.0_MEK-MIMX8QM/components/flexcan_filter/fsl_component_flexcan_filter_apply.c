@@ -0,0 +1,70 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_component_flexcan_filter_apply.h"
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Driver formats of the Rx FIFO filter tables of the plans. */
+static const flexcan_rx_fifo_filter_type_t s_flexcanFilterFifoType[] = {
+    kFLEXCAN_RxFifoFilterTypeA, kFLEXCAN_RxFifoFilterTypeB, kFLEXCAN_RxFifoFilterTypeC, kFLEXCAN_RxFifoFilterTypeD};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * brief Applies a plan to a FlexCAN.
+ *
+ * param base FlexCAN peripheral base address.
+ * param plan The plan.
+ */
+void FLEXCAN_FILTER_Apply(CAN_Type *base, const flexcan_filter_plan_t *plan)
+{
+    assert(NULL != plan);
+    assert(0U != (base->MCR & CAN_MCR_IRMQ_MASK));
+
+    flexcan_rx_fifo_config_t fifoConfig;
+    flexcan_rx_mb_config_t mbConfig;
+    uint32_t i;
+
+    if (plan->enableRxFifo)
+    {
+        /* The masks first, so that the Rx FIFO never accepts more than planned. */
+        FLEXCAN_SetRxFifoGlobalMask(base, plan->fifoGlobalMask);
+        for (i = 0U; i < plan->fifoMaskNum; i++)
+        {
+            FLEXCAN_SetRxIndividualMask(base, (uint8_t)i, plan->fifoMask[i]);
+        }
+
+        fifoConfig.idFilterTable = (uint32_t *)(uintptr_t)plan->fifoFilterTable;
+        fifoConfig.idFilterNum   = plan->fifoFilterNum;
+        fifoConfig.idFilterType  = s_flexcanFilterFifoType[plan->fifoFilterType];
+        fifoConfig.priority      = kFLEXCAN_RxFifoPrioHigh;
+        FLEXCAN_SetRxFifoConfig(base, &fifoConfig, true);
+    }
+    else if (0U != (base->MCR & CAN_MCR_RFEN_MASK))
+    {
+        FLEXCAN_SetRxFifoConfig(base, NULL, false);
+    }
+    else
+    {
+        /* The Rx FIFO is already disabled. */
+    }
+
+    mbConfig.type = kFLEXCAN_FrameTypeData;
+    for (i = 0U; i < plan->mbNum; i++)
+    {
+        mbConfig.id     = plan->mbId[i];
+        mbConfig.format = (plan->mbFormat[i] == kFLEXCAN_FILTER_FrameFormatExtend) ? kFLEXCAN_FrameFormatExtend :
+                                                                                     kFLEXCAN_FrameFormatStandard;
+        FLEXCAN_SetRxIndividualMask(base, (uint8_t)(plan->firstMb + i), plan->mbMask[i]);
+        FLEXCAN_SetRxMbConfig(base, (uint8_t)(plan->firstMb + i), &mbConfig, true);
+    }
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_FLEXCAN_FILTER_APPLY_H_
+#define _FSL_COMPONENT_FLEXCAN_FILTER_APPLY_H_
+
+#include "fsl_common.h"
+#include "fsl_flexcan.h"
+#include "fsl_component_flexcan_filter.h"
+
+/*!
+ * @addtogroup flexcan_filter
+ * @{
+ */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Applies a plan to a FlexCAN.
+ *
+ * Configures the Rx FIFO and its masks, or disables the Rx FIFO, and configures the Rx Message Buffers of the
+ * plan with their masks. The other Message Buffers are left as they are.
+ *
+ * @note The FlexCAN must be initialized with flexcan_config_t::enableIndividMask set, and with the number of
+ *       Message Buffers of the planner configuration.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param plan The plan.
+ */
+void FLEXCAN_FILTER_Apply(CAN_Type *base, const flexcan_filter_plan_t *plan);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_COMPONENT_FLEXCAN_FILTER_APPLY_H_ */
@@ -0,0 +1,497 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host tests of the FlexCAN acceptance filter planner, on the identifier sets of networks described by DBC
+ * files: a passenger car powertrain bus, a body bus with network management ranges, a J1939 truck bus and a
+ * CANopen machine bus bridged to J1939.
+ *
+ * Each network is planned for a few Message Buffer budgets, without and with the bus identifiers. Each plan
+ * is checked:
+ * - every wanted identifier is accepted;
+ * - the false accepts the plan reports are the ones FLEXCAN_FILTER_Accepts() finds, over all the standard
+ *   identifiers, over the bus identifiers, and estimated on random extended identifiers;
+ * - with the host simulation of the device (TEST_HOSTSIM), the simulated FlexCAN, configured with
+ *   FLEXCAN_FILTER_Apply(), receives the bus frames the plan accepts.
+ *
+ * One line per plan reports the layout and the false accept rates: over the identifiers of the formats
+ * received, and over the frames of the bus which the application does not want. The rate of a single mask
+ * per format, the usual hand configuration, is reported for comparison. The process exits with status 1 if
+ * any check fails.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "flexcan_filter_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#ifndef TEST_HOSTSIM
+#define TEST_HOSTSIM (0)
+#endif
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+/* Random extended identifiers drawn to check the false accepts over all the extended identifiers. */
+#define TEST_EXT_SAMPLES (1000000U)
+
+/* Wanted identifiers of a range checked at most, evenly spaced from the first one. */
+#define TEST_IDS_PER_RANGE (4096U)
+
+#define TEST_STD(id)            FLEXCAN_FILTER_STD_ID(id)
+#define TEST_STD_R(first, last) FLEXCAN_FILTER_STD_RANGE(first, last)
+#define TEST_EXT(id)            FLEXCAN_FILTER_EXT_ID(id)
+#define TEST_EXT_R(first, last) FLEXCAN_FILTER_EXT_RANGE(first, last)
+
+/* J1939 identifier: priority, parameter group number and source address. */
+#define TEST_J1939(priority, pgn, sa) ((((uint32_t)(priority)) << 26U) | (((uint32_t)(pgn)) << 8U) | (uint32_t)(sa))
+/* All the source addresses of a parameter group. */
+#define TEST_J1939_ANY(priority, pgn) TEST_EXT_R(TEST_J1939(priority, pgn, 0x00U), TEST_J1939(priority, pgn, 0xFFU))
+
+typedef struct _test_network
+{
+    const char *name;
+    const flexcan_filter_rule_t *bus;
+    uint32_t busNum;
+    const flexcan_filter_rule_t *wanted;
+    uint32_t wantedNum;
+} test_network_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Powertrain bus of a passenger car, 500 kbit/s; the receiver is the transmission controller. */
+static const flexcan_filter_rule_t s_powertrainBus[] = {
+    TEST_STD(0x080),  TEST_STD(0x0A0),  TEST_STD(0x0A1),  TEST_STD(0x0A5),  TEST_STD(0x0C1),  TEST_STD(0x0C5),
+    TEST_STD(0x0C9),  TEST_STD(0x0D1),  TEST_STD(0x0F1),  TEST_STD(0x0F9),  TEST_STD(0x110),  TEST_STD(0x120),
+    TEST_STD(0x12A),  TEST_STD(0x130),  TEST_STD(0x140),  TEST_STD(0x15A),  TEST_STD(0x17C),  TEST_STD(0x180),
+    TEST_STD(0x190),  TEST_STD(0x1A0),  TEST_STD(0x1A6),  TEST_STD(0x1C8),  TEST_STD(0x1D0),  TEST_STD(0x1E1),
+    TEST_STD(0x1E5),  TEST_STD(0x1F1),  TEST_STD(0x1F5),  TEST_STD(0x200),  TEST_STD(0x201),  TEST_STD(0x202),
+    TEST_STD(0x20E),  TEST_STD(0x217),  TEST_STD(0x230),  TEST_STD(0x260),  TEST_STD(0x280),  TEST_STD(0x2A0),
+    TEST_STD(0x2C0),  TEST_STD(0x2F9),  TEST_STD(0x300),  TEST_STD(0x309),  TEST_STD(0x316),  TEST_STD(0x329),
+    TEST_STD(0x340),  TEST_STD(0x350),  TEST_STD(0x360),  TEST_STD(0x380),  TEST_STD(0x3A0),  TEST_STD(0x3C9),
+    TEST_STD(0x3D1),  TEST_STD(0x3E9),  TEST_STD(0x3F1),  TEST_STD(0x400),  TEST_STD(0x440),  TEST_STD(0x4C1),
+    TEST_STD(0x4C9),  TEST_STD(0x4D1),  TEST_STD(0x4E1),  TEST_STD(0x500),  TEST_STD(0x510),  TEST_STD(0x520),
+    TEST_STD(0x530),  TEST_STD(0x540),  TEST_STD(0x5A0),  TEST_STD(0x5C0),  TEST_STD(0x5E0),  TEST_STD(0x600),
+    TEST_STD(0x610),  TEST_STD(0x620),  TEST_STD(0x7DF),  TEST_STD_R(0x7E0, 0x7EF),
+};
+static const flexcan_filter_rule_t s_powertrainWanted[] = {
+    TEST_STD(0x0A0), TEST_STD(0x0C9), TEST_STD(0x0F1), TEST_STD(0x120), TEST_STD(0x12A), TEST_STD(0x17C),
+    TEST_STD(0x1A0), TEST_STD(0x1C8), TEST_STD(0x1E1), TEST_STD(0x1F5), TEST_STD(0x200), TEST_STD(0x201),
+    TEST_STD(0x202), TEST_STD(0x230), TEST_STD(0x2F9), TEST_STD(0x309), TEST_STD(0x329), TEST_STD(0x3C9),
+    TEST_STD(0x3D1), TEST_STD(0x4C1), TEST_STD(0x4C9), TEST_STD(0x500), TEST_STD(0x510), TEST_STD(0x7DF),
+    TEST_STD(0x7E1),
+};
+
+/* Body bus: AUTOSAR network management from 0x500, door and seat modules, diagnostics; the receiver is the
+ * body controller. */
+static const flexcan_filter_rule_t s_bodyBus[] = {
+    TEST_STD(0x0B4),          TEST_STD(0x0D0),          TEST_STD(0x1B0),          TEST_STD(0x1B8),
+    TEST_STD(0x1C0),          TEST_STD(0x210),          TEST_STD(0x21A),          TEST_STD(0x290),
+    TEST_STD(0x2B0),          TEST_STD_R(0x3B0, 0x3BF), TEST_STD_R(0x3C0, 0x3C7), TEST_STD(0x3E0),
+    TEST_STD(0x3F0),          TEST_STD(0x420),          TEST_STD(0x430),          TEST_STD(0x470),
+    TEST_STD_R(0x500, 0x5FF), TEST_STD(0x6A0),          TEST_STD(0x6B0),          TEST_STD_R(0x700, 0x77F),
+    TEST_STD(0x7DF),          TEST_STD_R(0x7E0, 0x7EF),
+};
+static const flexcan_filter_rule_t s_bodyWanted[] = {
+    TEST_STD(0x0B4),          TEST_STD(0x1B0),          TEST_STD(0x1B8),          TEST_STD(0x21A),
+    TEST_STD_R(0x3B0, 0x3BF), TEST_STD(0x3C2),          TEST_STD(0x3E0),          TEST_STD(0x430),
+    TEST_STD_R(0x500, 0x57F), TEST_STD(0x6A0),          TEST_STD(0x740),          TEST_STD(0x7DF),
+};
+
+/* J1939 truck bus, 250 kbit/s; the receiver is the instrument cluster, source address 0x17. */
+static const flexcan_filter_rule_t s_j1939Bus[] = {
+    TEST_EXT(TEST_J1939(3, 0xF004, 0x00)), /* EEC1 */
+    TEST_EXT(TEST_J1939(3, 0xF003, 0x00)), /* EEC2 */
+    TEST_EXT(TEST_J1939(3, 0xF002, 0x03)), /* ETC1 */
+    TEST_EXT(TEST_J1939(6, 0xF001, 0x0B)), /* EBC1 */
+    TEST_EXT(TEST_J1939(3, 0x0000, 0x03)), /* TSC1 from the transmission */
+    TEST_EXT(TEST_J1939(3, 0x000B, 0x03)), /* TSC1 to the brakes */
+    TEST_EXT(TEST_J1939(6, 0xFEF1, 0x00)), /* CCVS */
+    TEST_EXT(TEST_J1939(6, 0xFEF1, 0x21)),
+    TEST_EXT(TEST_J1939(6, 0xFEEE, 0x00)), /* ET1 */
+    TEST_EXT(TEST_J1939(6, 0xFEF2, 0x00)), /* LFE */
+    TEST_EXT(TEST_J1939(6, 0xFEF5, 0x00)), /* AMB */
+    TEST_EXT(TEST_J1939(6, 0xFEE0, 0x00)), /* VD */
+    TEST_EXT(TEST_J1939(6, 0xFEE5, 0x00)), /* HOURS */
+    TEST_EXT(TEST_J1939(6, 0xFEE9, 0x00)), /* LFC */
+    TEST_EXT(TEST_J1939(6, 0xFEEF, 0x00)), /* EFL/P1 */
+    TEST_EXT(TEST_J1939(6, 0xFEFC, 0x21)), /* DD */
+    TEST_EXT(TEST_J1939(6, 0xFEC1, 0xEE)), /* VDHR */
+    TEST_EXT(TEST_J1939(6, 0xFE6C, 0xEE)), /* TCO1 */
+    TEST_EXT(TEST_J1939(6, 0xFECA, 0x00)), /* DM1 */
+    TEST_EXT(TEST_J1939(6, 0xFECA, 0x03)),
+    TEST_EXT(TEST_J1939(6, 0xFECA, 0x0B)),
+    TEST_EXT(TEST_J1939(6, 0xFECA, 0x21)),
+    TEST_EXT(TEST_J1939(6, 0xFF00, 0x00)), /* Proprietary B */
+    TEST_EXT(TEST_J1939(6, 0xFF21, 0x21)),
+    TEST_EXT(TEST_J1939(6, 0xFF40, 0x21)),
+    TEST_EXT_R(TEST_J1939(6, 0xEA00, 0x00), TEST_J1939(6, 0xEAFF, 0xFF)), /* Request */
+    TEST_EXT_R(TEST_J1939(6, 0xEE00, 0x00), TEST_J1939(6, 0xEEFF, 0xFF)), /* Address claimed */
+    TEST_EXT_R(TEST_J1939(7, 0xEB00, 0x00), TEST_J1939(7, 0xECFF, 0xFF)), /* TP.DT and TP.CM */
+};
+static const flexcan_filter_rule_t s_j1939Wanted[] = {
+    TEST_J1939_ANY(3, 0xF004), /* EEC1 */
+    TEST_J1939_ANY(6, 0xF001), /* EBC1 */
+    TEST_J1939_ANY(6, 0xFEF1), /* CCVS */
+    TEST_J1939_ANY(6, 0xFEEE), /* ET1 */
+    TEST_J1939_ANY(6, 0xFEF2), /* LFE */
+    TEST_J1939_ANY(6, 0xFEF5), /* AMB */
+    TEST_J1939_ANY(6, 0xFEE5), /* HOURS */
+    TEST_J1939_ANY(6, 0xFEFC), /* DD */
+    TEST_J1939_ANY(6, 0xFEC1), /* VDHR */
+    TEST_J1939_ANY(6, 0xFE6C), /* TCO1 */
+    TEST_J1939_ANY(6, 0xFECA), /* DM1 */
+    TEST_J1939_ANY(6, 0xEA17), /* Request to the cluster */
+    TEST_J1939_ANY(6, 0xEAFF), /* Global request */
+    TEST_J1939_ANY(6, 0xEEFF), /* Address claimed */
+    TEST_J1939_ANY(7, 0xEB17), /* TP.DT to the cluster */
+    TEST_J1939_ANY(7, 0xEBFF),
+    TEST_J1939_ANY(7, 0xEC17), /* TP.CM to the cluster */
+    TEST_J1939_ANY(7, 0xECFF),
+};
+
+/* CANopen machine bus, nodes 1 to 16, with a J1939 engine bridged in; the receiver is the supervisor. */
+static const flexcan_filter_rule_t s_machineBus[] = {
+    TEST_STD(0x000),
+    TEST_STD(0x080),
+    TEST_STD_R(0x081, 0x090), /* EMCY */
+    TEST_STD_R(0x181, 0x190), /* TPDO1 */
+    TEST_STD_R(0x201, 0x210), /* RPDO1 */
+    TEST_STD_R(0x281, 0x290), /* TPDO2 */
+    TEST_STD_R(0x301, 0x310), /* RPDO2 */
+    TEST_STD_R(0x381, 0x390), /* TPDO3 */
+    TEST_STD_R(0x481, 0x490), /* TPDO4 */
+    TEST_STD_R(0x581, 0x590), /* SDO responses */
+    TEST_STD_R(0x601, 0x610), /* SDO requests */
+    TEST_STD_R(0x701, 0x710), /* Heartbeats */
+    TEST_EXT(TEST_J1939(3, 0xF004, 0x00)),
+    TEST_EXT(TEST_J1939(6, 0xFEEE, 0x00)),
+    TEST_EXT(TEST_J1939(6, 0xFEEF, 0x00)),
+    TEST_EXT(TEST_J1939(6, 0xFECA, 0x00)),
+    TEST_EXT(TEST_J1939(6, 0xFEE5, 0x00)),
+};
+static const flexcan_filter_rule_t s_machineWanted[] = {
+    TEST_STD(0x000),
+    TEST_STD(0x080),
+    TEST_STD_R(0x081, 0x090),
+    TEST_STD_R(0x181, 0x188),
+    TEST_STD_R(0x281, 0x284),
+    TEST_STD_R(0x581, 0x590),
+    TEST_STD_R(0x701, 0x710),
+    TEST_EXT(TEST_J1939(3, 0xF004, 0x00)),
+    TEST_EXT(TEST_J1939(6, 0xFEEE, 0x00)),
+    TEST_EXT(TEST_J1939(6, 0xFECA, 0x00)),
+};
+
+static const test_network_t s_networks[] = {
+    {"powertrain", s_powertrainBus, ARRAY_SIZE(s_powertrainBus), s_powertrainWanted, ARRAY_SIZE(s_powertrainWanted)},
+    {"body", s_bodyBus, ARRAY_SIZE(s_bodyBus), s_bodyWanted, ARRAY_SIZE(s_bodyWanted)},
+    {"j1939", s_j1939Bus, ARRAY_SIZE(s_j1939Bus), s_j1939Wanted, ARRAY_SIZE(s_j1939Wanted)},
+    {"machine", s_machineBus, ARRAY_SIZE(s_machineBus), s_machineWanted, ARRAY_SIZE(s_machineWanted)},
+};
+
+/* Message Buffers of the FlexCAN, and those kept for transmission. */
+static const uint8_t s_mbBudgets[][2] = {{8U, 2U}, {16U, 2U}, {32U, 4U}, {64U, 8U}};
+
+static flexcan_filter_work_t s_work;
+static flexcan_filter_plan_t s_plan;
+static uint32_t s_failures;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static uint32_t TEST_Random(void)
+{
+    static uint32_t s_state = 0x2545F491U;
+
+    s_state ^= s_state << 13U;
+    s_state ^= s_state >> 17U;
+    s_state ^= s_state << 5U;
+
+    return s_state;
+}
+
+static bool TEST_InRules(const flexcan_filter_rule_t *rules,
+                         uint32_t ruleNum,
+                         uint32_t id,
+                         flexcan_filter_frame_format_t format)
+{
+    uint32_t i;
+
+    for (i = 0U; i < ruleNum; i++)
+    {
+        if ((rules[i].format == format) && (id >= rules[i].firstId) && (id <= rules[i].lastId))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void TEST_Fail(const char *message, uint32_t id)
+{
+    printf("  FAIL: %s, identifier 0x%x\n", message, (unsigned int)id);
+    s_failures++;
+}
+
+/* Counts the unwanted frames of the bus accepted, and the unwanted frames of the bus. */
+static void TEST_CountBus(const test_network_t *network,
+                          const flexcan_filter_plan_t *plan,
+                          uint32_t accepted[2],
+                          uint32_t unwanted[2])
+{
+    const flexcan_filter_rule_t *rule;
+    uint32_t format;
+    uint32_t id;
+    uint32_t i;
+
+    (void)memset(accepted, 0, 2U * sizeof(uint32_t));
+    (void)memset(unwanted, 0, 2U * sizeof(uint32_t));
+    for (i = 0U; i < network->busNum; i++)
+    {
+        rule   = &network->bus[i];
+        format = (uint32_t)rule->format;
+        for (id = rule->firstId; id <= rule->lastId; id++)
+        {
+            if (TEST_InRules(network->wanted, network->wantedNum, id, rule->format))
+            {
+                continue;
+            }
+            unwanted[format]++;
+            if (FLEXCAN_FILTER_Accepts(plan, id, rule->format))
+            {
+                accepted[format]++;
+            }
+        }
+    }
+}
+
+/* Checks that the plan accepts the wanted identifiers. */
+static void TEST_CheckWanted(const test_network_t *network, const flexcan_filter_plan_t *plan)
+{
+    const flexcan_filter_rule_t *rule;
+    uint32_t count;
+    uint32_t step;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0U; i < network->wantedNum; i++)
+    {
+        rule  = &network->wanted[i];
+        count = rule->lastId - rule->firstId + 1U;
+        step  = (count > TEST_IDS_PER_RANGE) ? (count / TEST_IDS_PER_RANGE) : 1U;
+        for (j = 0U; j < count; j += step)
+        {
+            if (!FLEXCAN_FILTER_Accepts(plan, rule->firstId + j, rule->format))
+            {
+                TEST_Fail("wanted identifier rejected", rule->firstId + j);
+            }
+        }
+        if (!FLEXCAN_FILTER_Accepts(plan, rule->lastId, rule->format))
+        {
+            TEST_Fail("wanted identifier rejected", rule->lastId);
+        }
+    }
+}
+
+/* Checks the false accepts reported by a plan computed without the bus identifiers. */
+static void TEST_CheckFalseAccepts(const test_network_t *network, const flexcan_filter_plan_t *plan)
+{
+    uint32_t accepted = 0U;
+    double expected;
+    double sigma;
+    uint32_t id;
+    uint32_t i;
+
+    /* All the standard identifiers. */
+    for (id = 0U; id <= 0x7FFU; id++)
+    {
+        if (FLEXCAN_FILTER_Accepts(plan, id, kFLEXCAN_FILTER_FrameFormatStandard) &&
+            !TEST_InRules(network->wanted, network->wantedNum, id, kFLEXCAN_FILTER_FrameFormatStandard))
+        {
+            accepted++;
+        }
+    }
+    if (accepted != plan->falseAcceptIdNum[0])
+    {
+        TEST_Fail("standard false accepts differ from the plan", accepted);
+    }
+
+    /* Random extended identifiers, the accepted proportion must be within 5 standard deviations. */
+    accepted = 0U;
+    for (i = 0U; i < TEST_EXT_SAMPLES; i++)
+    {
+        id = TEST_Random() & 0x1FFFFFFFU;
+        if (FLEXCAN_FILTER_Accepts(plan, id, kFLEXCAN_FILTER_FrameFormatExtend) &&
+            !TEST_InRules(network->wanted, network->wantedNum, id, kFLEXCAN_FILTER_FrameFormatExtend))
+        {
+            accepted++;
+        }
+    }
+    expected = (double)plan->falseAcceptIdNum[1] * TEST_EXT_SAMPLES / 536870912.0;
+    sigma    = (expected < 1.0) ? 1.0 : sqrt(expected);
+    if (fabs((double)accepted - expected) > (5.0 * sigma))
+    {
+        TEST_Fail("extended false accepts differ from the plan", accepted);
+    }
+}
+
+/* False accepts of the bus with a single mask per format, the common bits of all the wanted identifiers. */
+static void TEST_CountSingleMask(const test_network_t *network, uint32_t accepted[2], uint32_t unwanted[2])
+{
+    static flexcan_filter_plan_t s_singleMask;
+    const flexcan_filter_rule_t *rule;
+    uint32_t first[2] = {0U, 0U};
+    uint32_t mask[2]  = {0x7FFU, 0x1FFFFFFFU};
+    bool used[2]      = {false, false};
+    uint32_t format;
+    uint32_t id;
+    uint32_t i;
+
+    (void)memset(&s_singleMask, 0, sizeof(s_singleMask));
+    for (i = 0U; i < network->wantedNum; i++)
+    {
+        rule   = &network->wanted[i];
+        format = (uint32_t)rule->format;
+        if (!used[format])
+        {
+            first[format] = rule->firstId;
+            used[format]  = true;
+        }
+        for (id = rule->firstId; id <= rule->lastId; id++)
+        {
+            mask[format] &= ~(id ^ first[format]);
+        }
+    }
+    for (format = 0U; format < 2U; format++)
+    {
+        if (!used[format])
+        {
+            continue;
+        }
+        /* Standard identifiers are in the upper 11 bits of the Message Buffer identifier word. */
+        s_singleMask.mbFormat[s_singleMask.mbNum] = (flexcan_filter_frame_format_t)format;
+        s_singleMask.mbId[s_singleMask.mbNum]     = (format == 0U) ? (first[format] << 18U) : first[format];
+        s_singleMask.mbMask[s_singleMask.mbNum]   = (format == 0U) ? (mask[format] << 18U) : mask[format];
+        s_singleMask.mbNum++;
+    }
+
+    TEST_CountBus(network, &s_singleMask, accepted, unwanted);
+}
+
+static const char *TEST_Layout(const flexcan_filter_plan_t *plan)
+{
+    static char s_layout[32];
+    static const char s_types[] = {'A', 'B', 'C', 'D'};
+
+    if (plan->enableRxFifo)
+    {
+        (void)snprintf(s_layout, sizeof(s_layout), "FIFO %c/%-3u + %2u MB", s_types[plan->fifoFilterType],
+                       (unsigned int)plan->fifoFilterNum, (unsigned int)plan->mbNum);
+    }
+    else
+    {
+        (void)snprintf(s_layout, sizeof(s_layout), "          %2u MB", (unsigned int)plan->mbNum);
+    }
+
+    return s_layout;
+}
+
+static double TEST_Rate(uint32_t accepted, uint32_t total)
+{
+    return (total != 0U) ? (100.0 * (double)accepted / (double)total) : 0.0;
+}
+
+static void TEST_Network(const test_network_t *network, uint32_t mbNum, uint32_t reservedMbNum, bool knownBus)
+{
+    flexcan_filter_config_t config;
+    uint32_t busAccepted[2];
+    uint32_t busUnwanted[2];
+    uint32_t maskAccepted[2];
+    uint32_t maskUnwanted[2];
+#if TEST_HOSTSIM
+    uint32_t errors;
+#endif
+    flexcan_filter_status_t status;
+
+    FLEXCAN_FILTER_GetDefaultConfig(&config);
+    config.mbNum         = (uint8_t)mbNum;
+    config.reservedMbNum = (uint8_t)reservedMbNum;
+    if (knownBus)
+    {
+        config.busRules   = network->bus;
+        config.busRuleNum = network->busNum;
+    }
+
+    status = FLEXCAN_FILTER_Plan(&s_plan, &config, network->wanted, network->wantedNum, &s_work);
+    if (status != kStatus_FLEXCAN_FILTER_Success)
+    {
+        printf("%-10s %2u MB %-5s plan failed, status %d\n", network->name, (unsigned int)mbNum,
+               knownBus ? "bus" : "all", (int)status);
+        s_failures++;
+        return;
+    }
+
+    TEST_CheckWanted(network, &s_plan);
+    if (!knownBus)
+    {
+        TEST_CheckFalseAccepts(network, &s_plan);
+    }
+    TEST_CountBus(network, &s_plan, busAccepted, busUnwanted);
+    if (knownBus && ((busAccepted[0] != s_plan.falseAcceptIdNum[0]) || (busAccepted[1] != s_plan.falseAcceptIdNum[1])))
+    {
+        TEST_Fail("bus false accepts differ from the plan", busAccepted[0] + busAccepted[1]);
+    }
+    TEST_CountSingleMask(network, maskAccepted, maskUnwanted);
+
+#if TEST_HOSTSIM
+    errors = TEST_ReceiveOnBus(&s_plan, mbNum, network->bus, network->busNum);
+    if (errors != 0U)
+    {
+        TEST_Fail("simulated FlexCAN reception differs from the plan", errors);
+    }
+#endif
+
+    printf("%-10s %2u MB %-5s %-22s %9u %10u %7.3f%% %10u %7.3f%% %7.2f%% %7.2f%%\n", network->name,
+           (unsigned int)mbNum, knownBus ? "bus" : "all", TEST_Layout(&s_plan),
+           (unsigned int)(s_plan.wantedIdNum[0] + s_plan.wantedIdNum[1]), (unsigned int)s_plan.falseAcceptIdNum[0],
+           TEST_Rate(s_plan.falseAcceptIdNum[0], s_plan.unwantedIdNum[0]), (unsigned int)s_plan.falseAcceptIdNum[1],
+           TEST_Rate(s_plan.falseAcceptIdNum[1], s_plan.unwantedIdNum[1]),
+           TEST_Rate(busAccepted[0] + busAccepted[1], busUnwanted[0] + busUnwanted[1]),
+           TEST_Rate(maskAccepted[0] + maskAccepted[1], maskUnwanted[0] + maskUnwanted[1]));
+}
+
+int main(void)
+{
+    uint32_t i;
+    uint32_t j;
+
+    printf("network    budget  ids   layout                    wanted  false std    rate  false ext    rate"
+           "   bus fa  1 mask\n");
+    for (i = 0U; i < ARRAY_SIZE(s_networks); i++)
+    {
+        for (j = 0U; j < ARRAY_SIZE(s_mbBudgets); j++)
+        {
+            TEST_Network(&s_networks[i], s_mbBudgets[j][0], s_mbBudgets[j][1], false);
+            TEST_Network(&s_networks[i], s_mbBudgets[j][0], s_mbBudgets[j][1], true);
+        }
+    }
+
+    printf("\n%u failures\n", (unsigned int)s_failures);
+
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FLEXCAN_FILTER_TEST_H_
+#define _FLEXCAN_FILTER_TEST_H_
+
+#include "fsl_component_flexcan_filter.h"
+
+/*!
+ * @brief Receives the bus identifiers on a simulated FlexCAN configured with a plan, with TEST_HOSTSIM.
+ *
+ * Sends a data frame of each bus identifier, and checks that the FlexCAN receives exactly the frames that
+ * FLEXCAN_FILTER_Accepts() accepts.
+ *
+ * @param plan The plan.
+ * @param mbNum Message Buffers of the FlexCAN.
+ * @param busRules Identifiers present on the bus.
+ * @param busRuleNum Number of rules.
+ * @return Number of identifiers received differently than expected.
+ */
+uint32_t TEST_ReceiveOnBus(const flexcan_filter_plan_t *plan,
+                           uint32_t mbNum,
+                           const flexcan_filter_rule_t *busRules,
+                           uint32_t busRuleNum);
+
+#endif /* _FLEXCAN_FILTER_TEST_H_ */
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Runs the plans on the FlexCAN model of the host simulation: the filters are applied with
+ * FLEXCAN_FILTER_Apply(), the host sends the frames of the bus, and the received frames are compared with
+ * the predictions of FLEXCAN_FILTER_Accepts().
+ */
+
+#include <stdio.h>
+
+#include "flexcan_filter_test.h"
+#include "fsl_component_flexcan_filter_apply.h"
+#include "fsl_hostsim.h"
+#include "fsl_hostsim_flexcan.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_CAN          DMA__CAN0
+#define TEST_CAN_CLOCK_HZ (40000000U)
+
+/* Longest extended frame at 1 Mbit/s, with margin. */
+#define TEST_FRAME_TIME_NS (200000U)
+
+/* Identifiers sent of each bus range at most, evenly spaced from the first one. */
+#define TEST_IDS_PER_RANGE (64U)
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Sends a frame and returns true if the FlexCAN received it, in the Rx FIFO or a Message Buffer. */
+static bool TEST_SendFrame(const flexcan_filter_plan_t *plan, uint32_t mbNum, uint32_t id, bool extended)
+{
+    hostsim_flexcan_frame_t frame = {0};
+    flexcan_frame_t rxFrame;
+    uint64_t flags;
+    bool received = false;
+    uint32_t i;
+
+    frame.id       = id;
+    frame.extended = extended;
+    frame.length   = 8U;
+    (void)HOSTSIM_FlexcanSend(&frame);
+    HOSTSIM_Run(TEST_FRAME_TIME_NS);
+
+    if (plan->enableRxFifo && (0U != FLEXCAN_GetMbStatusFlags(TEST_CAN, (uint64_t)kFLEXCAN_RxFifoFrameAvlFlag)))
+    {
+        (void)FLEXCAN_ReadRxFifo(TEST_CAN, &rxFrame);
+        FLEXCAN_ClearMbStatusFlags(TEST_CAN, (uint64_t)kFLEXCAN_RxFifoFrameAvlFlag);
+        received = true;
+    }
+
+    flags = FLEXCAN_GetMbStatusFlags(TEST_CAN, (mbNum < 64U) ? ((1ULL << mbNum) - 1U) : ~0ULL);
+    for (i = plan->firstMb; i < ((uint32_t)plan->firstMb + plan->mbNum); i++)
+    {
+        if ((flags & (1ULL << i)) != 0U)
+        {
+            (void)FLEXCAN_ReadRxMb(TEST_CAN, (uint8_t)i, &rxFrame);
+            FLEXCAN_ClearMbStatusFlags(TEST_CAN, 1ULL << i);
+            received = true;
+        }
+    }
+
+    return received;
+}
+
+uint32_t TEST_ReceiveOnBus(const flexcan_filter_plan_t *plan,
+                           uint32_t mbNum,
+                           const flexcan_filter_rule_t *busRules,
+                           uint32_t busRuleNum)
+{
+    flexcan_config_t config;
+    flexcan_filter_frame_format_t format;
+    uint32_t errors = 0U;
+    uint32_t count;
+    uint32_t step;
+    uint32_t id;
+    uint32_t i;
+    uint32_t j;
+
+    FLEXCAN_GetDefaultConfig(&config);
+    config.maxMbNum          = (uint8_t)mbNum;
+    config.enableIndividMask = true;
+    HOSTSIM_FlexcanSetClock(TEST_CAN, TEST_CAN_CLOCK_HZ);
+    FLEXCAN_Init(TEST_CAN, &config, TEST_CAN_CLOCK_HZ);
+    FLEXCAN_FILTER_Apply(TEST_CAN, plan);
+
+    for (i = 0U; i < busRuleNum; i++)
+    {
+        format = busRules[i].format;
+        count  = busRules[i].lastId - busRules[i].firstId + 1U;
+        step   = (count > TEST_IDS_PER_RANGE) ? (count / TEST_IDS_PER_RANGE) : 1U;
+        for (j = 0U; j < count; j += step)
+        {
+            id = busRules[i].firstId + j;
+            if (TEST_SendFrame(plan, mbNum, id, format == kFLEXCAN_FILTER_FrameFormatExtend) !=
+                FLEXCAN_FILTER_Accepts(plan, id, format))
+            {
+                printf("  simulated FlexCAN: identifier 0x%x received differently than planned\n", (unsigned int)id);
+                errors++;
+            }
+        }
+    }
+
+    FLEXCAN_Deinit(TEST_CAN);
+
+    return errors;
+}
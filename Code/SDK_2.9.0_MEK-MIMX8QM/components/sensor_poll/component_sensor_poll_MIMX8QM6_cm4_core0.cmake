@@ -0,0 +1,23 @@
+if(NOT COMPONENT_SENSOR_POLL_MIMX8QM6_cm4_core0_INCLUDED)
+    
+    set(COMPONENT_SENSOR_POLL_MIMX8QM6_cm4_core0_INCLUDED true CACHE BOOL "component_sensor_poll component is included.")
+
+    target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/fsl_component_sensor_poll.c
+    )
+
+
+    target_include_directories(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/.
+    )
+
+
+    include(driver_common_MIMX8QM6_cm4_core0)
+
+    include(driver_dma3_MIMX8QM6_cm4_core0)
+
+    include(driver_lpi2c_MIMX8QM6_cm4_core0)
+
+    include(driver_lpi2c_edma_MIMX8QM6_cm4_core0)
+
+endif()
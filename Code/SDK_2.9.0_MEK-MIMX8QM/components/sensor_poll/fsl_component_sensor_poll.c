@@ -0,0 +1,196 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "fsl_component_sensor_poll.h"
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void SENSOR_POLL_Lpi2cCallback(LPI2C_Type *base,
+                                      lpi2c_master_edma_handle_t *i2cHandle,
+                                      status_t completionStatus,
+                                      void *userData);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Encodes the transfers of the sensors of a mask in the command list. */
+static status_t SENSOR_POLL_EncodeList(sensor_poll_handle_t *handle, uint32_t sensorMask)
+{
+    status_t status;
+    uint32_t i;
+
+    status = LPI2C_MasterCreateCommandListEDMA(handle->base, &handle->cmdList, NULL, 0U);
+
+    for (i = 0U; (i < handle->sensorNum) && (status == kStatus_Success); i++)
+    {
+        if ((sensorMask & (1UL << i)) != 0U)
+        {
+            status = LPI2C_MasterAppendCommandListEDMA(handle->base, &handle->cmdList, handle->sensors[i]->transfers,
+                                                       handle->sensors[i]->transferNum);
+        }
+    }
+
+    /* A partial list is never run: a mask of no sensor is never due. */
+    handle->listMask = (status == kStatus_Success) ? sensorMask : 0U;
+
+    return status;
+}
+
+/* Calls the callbacks of the sensors of the running list, and frees the bus. */
+static void SENSOR_POLL_CompleteList(sensor_poll_handle_t *handle, status_t status)
+{
+    sensor_poll_sensor_t *sensor;
+    uint32_t runMask = handle->runMask;
+    uint32_t i;
+
+    handle->runMask = 0U;
+
+    for (i = 0U; i < handle->sensorNum; i++)
+    {
+        if ((runMask & (1UL << i)) != 0U)
+        {
+            sensor = handle->sensors[i];
+            if (sensor->callback != NULL)
+            {
+                sensor->callback(sensor, status, sensor->userData);
+            }
+        }
+    }
+}
+
+static void SENSOR_POLL_Lpi2cCallback(LPI2C_Type *base,
+                                      lpi2c_master_edma_handle_t *i2cHandle,
+                                      status_t completionStatus,
+                                      void *userData)
+{
+    SENSOR_POLL_CompleteList((sensor_poll_handle_t *)userData, completionStatus);
+}
+
+void SENSOR_POLL_Init(sensor_poll_handle_t *handle,
+                      LPI2C_Type *base,
+                      edma_handle_t *rxDmaHandle,
+                      edma_handle_t *txDmaHandle)
+{
+    assert(handle != NULL);
+    assert(rxDmaHandle != NULL);
+    assert(txDmaHandle != NULL);
+
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->base = base;
+    LPI2C_MasterCreateEDMAHandle(base, &handle->i2cHandle, rxDmaHandle, txDmaHandle, SENSOR_POLL_Lpi2cCallback,
+                                 handle);
+}
+
+status_t SENSOR_POLL_AddSensor(sensor_poll_handle_t *handle, sensor_poll_sensor_t *sensor)
+{
+    status_t status;
+    uint32_t index = handle->sensorNum;
+
+    assert(sensor != NULL);
+
+    if ((sensor->transfers == NULL) || (sensor->transferNum == 0U) || (sensor->period == 0U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (index >= SENSOR_POLL_MAX_SENSORS)
+    {
+        return kStatus_OutOfRange;
+    }
+
+    if (handle->runMask != 0U)
+    {
+        return kStatus_LPI2C_Busy;
+    }
+
+    /* All the sensors may be due at the same tick: their transfers must fit in one list. */
+    handle->sensors[index] = sensor;
+    handle->sensorNum      = index + 1U;
+    status                 = SENSOR_POLL_EncodeList(handle, (2UL << index) - 1U);
+    if (status != kStatus_Success)
+    {
+        handle->sensors[index] = NULL;
+        handle->sensorNum      = index;
+        return kStatus_InvalidArgument;
+    }
+
+    sensor->countdown = 1U;
+
+    return kStatus_Success;
+}
+
+void SENSOR_POLL_Tick(sensor_poll_handle_t *handle)
+{
+    sensor_poll_sensor_t *sensor;
+    uint32_t dueMask = 0U;
+    uint32_t regPrimask;
+    status_t status;
+    uint32_t i;
+
+    for (i = 0U; i < handle->sensorNum; i++)
+    {
+        sensor = handle->sensors[i];
+        sensor->countdown--;
+        if (sensor->countdown == 0U)
+        {
+            sensor->countdown = sensor->period;
+            dueMask |= 1UL << i;
+        }
+    }
+
+    if (handle->runMask != 0U)
+    {
+        for (i = 0U; i < handle->sensorNum; i++)
+        {
+            if ((dueMask & (1UL << i)) != 0U)
+            {
+                handle->missedSamples++;
+            }
+        }
+
+        handle->runTicks++;
+        if (handle->runTicks >= SENSOR_POLL_TIMEOUT_TICKS)
+        {
+            /* The list may complete in the eDMA interrupt meanwhile. */
+            regPrimask = DisableGlobalIRQ();
+            if (handle->runMask != 0U)
+            {
+                (void)LPI2C_MasterTransferAbortEDMA(handle->base, &handle->i2cHandle);
+                SENSOR_POLL_CompleteList(handle, kStatus_Timeout);
+            }
+            EnableGlobalIRQ(regPrimask);
+        }
+        return;
+    }
+
+    if (dueMask == 0U)
+    {
+        return;
+    }
+
+    /* The sensors due at each tick usually repeat, the list is reused while they do. */
+    if (dueMask != handle->listMask)
+    {
+        /* Cannot fail: the list of all the sensors fits, as checked when they were added. */
+        (void)SENSOR_POLL_EncodeList(handle, dueMask);
+    }
+
+    handle->runMask  = dueMask;
+    handle->runTicks = 0U;
+    status           = LPI2C_MasterTransferCommandListEDMA(handle->base, &handle->i2cHandle, &handle->cmdList);
+    if (status != kStatus_Success)
+    {
+        /* The bus is busy with another master: the sensors skip this sample. */
+        SENSOR_POLL_CompleteList(handle, status);
+    }
+}
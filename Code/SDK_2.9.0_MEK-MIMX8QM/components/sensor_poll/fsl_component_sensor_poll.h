@@ -0,0 +1,170 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMPONENT_SENSOR_POLL_H_
+#define _FSL_COMPONENT_SENSOR_POLL_H_
+
+#include "fsl_common.h"
+#include "fsl_lpi2c_edma.h"
+
+/*!
+ * @addtogroup sensor_poll
+ * @{
+ */
+
+/*!
+ * @brief The sensor polling component
+ *
+ * The sensor polling component samples the sensors of an LPI2C bus, each at its own period, without CPU work
+ * between the register accesses. A sensor is sampled by a sequence of LPI2C transfers, such as a status register
+ * read followed by a data read, whose read buffers receive the sample.
+ *
+ * At each tick of the application timer, the sequences of all the sensors due are run as one LPI2C command list
+ * by the eDMA, back to back on the bus, and the callback of each sensor is called when the list completes. The
+ * command list is only encoded again when the set of sensors due changes, so that a steady polling costs the CPU
+ * one start of the eDMA per tick and one interrupt per list.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Maximum number of sensors of a handle. */
+#ifndef SENSOR_POLL_MAX_SENSORS
+#define SENSOR_POLL_MAX_SENSORS (8U)
+#endif
+
+/*! @brief Ticks a command list may run before it is aborted and its sensors complete with kStatus_Timeout. */
+#ifndef SENSOR_POLL_TIMEOUT_TICKS
+#define SENSOR_POLL_TIMEOUT_TICKS (2U)
+#endif
+
+/*! @brief Forward declaration of the sensor. */
+typedef struct _sensor_poll_sensor sensor_poll_sensor_t;
+
+/*!
+ * @brief Callback of a sample.
+ *
+ * @param sensor The sensor.
+ * @param status kStatus_Success when the read buffers hold the sample, or the error of the command list:
+ *               kStatus_LPI2C_Nak, kStatus_LPI2C_ArbitrationLost, kStatus_LPI2C_Busy or kStatus_Timeout.
+ * @param userData Parameter of the callback.
+ */
+typedef void (*sensor_poll_callback_t)(sensor_poll_sensor_t *sensor, status_t status, void *userData);
+
+/*!
+ * @brief Sensor polled by the component.
+ *
+ * The sensor is owned by the component once added. The transfers and their read buffers must stay valid, and
+ * the read buffers must not be cached, or be invalidated by the callback before it reads them.
+ */
+struct _sensor_poll_sensor
+{
+    lpi2c_master_transfer_t *transfers; /*!< Transfers of a sample, run in order. */
+    uint32_t transferNum;               /*!< Number of transfers. */
+    uint32_t period;                    /*!< Ticks between two samples, not 0. */
+    sensor_poll_callback_t callback;    /*!< Callback of the samples, called in the eDMA interrupt. */
+    void *userData;                     /*!< Parameter of the callback. */
+    uint32_t countdown;                 /*!< Ticks until the next sample, private. */
+};
+
+/*! @brief Sensor polling handle. */
+typedef struct _sensor_poll_handle
+{
+    LPI2C_Type *base;                                       /*!< LPI2C peripheral base address. */
+    lpi2c_master_edma_handle_t i2cHandle;                   /*!< LPI2C master eDMA handle. */
+    lpi2c_master_edma_cmd_list_t cmdList;                   /*!< Command list of the sensors in listMask. */
+    sensor_poll_sensor_t *sensors[SENSOR_POLL_MAX_SENSORS]; /*!< Sensors, in the order they were added. */
+    uint32_t sensorNum;                                     /*!< Number of sensors. */
+    uint32_t listMask;                                      /*!< Sensors encoded in the command list. */
+    volatile uint32_t runMask;                              /*!< Sensors of the running list, 0 while idle. */
+    uint32_t runTicks;                                      /*!< Ticks since the running list started. */
+    uint32_t missedSamples;                                 /*!< Samples skipped because the list was still running. */
+} sensor_poll_handle_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name Initialization
+ * @{
+ */
+
+/*!
+ * @brief Initializes the component on an LPI2C master.
+ *
+ * The LPI2C master must be initialized with LPI2C_MasterInit(), and the eDMA channels created with
+ * EDMA_CreateHandle(). The component creates the LPI2C master eDMA handle, and owns the bus from then on.
+ *
+ * @param handle The handle.
+ * @param base The LPI2C peripheral base address.
+ * @param rxDmaHandle Handle of the eDMA channel of the receive requests.
+ * @param txDmaHandle Handle of the eDMA channel of the transmit requests.
+ */
+void SENSOR_POLL_Init(sensor_poll_handle_t *handle,
+                      LPI2C_Type *base,
+                      edma_handle_t *rxDmaHandle,
+                      edma_handle_t *txDmaHandle);
+
+/*!
+ * @brief Adds a sensor, sampled at the first tick, then every period ticks.
+ *
+ * The transfers of all the sensors must fit in one command list, which is checked by encoding them. The sensors
+ * are added before the timer calls SENSOR_POLL_Tick().
+ *
+ * @param handle The handle.
+ * @param sensor The sensor.
+ * @retval kStatus_Success The sensor is added.
+ * @retval kStatus_InvalidArgument The sensor has no transfer, a period of 0, or the transfers of all the sensors
+ *         do not fit in LPI2C_EDMA_CMD_LIST_SIZE command words and LPI2C_EDMA_CMD_LIST_READS reads.
+ * @retval kStatus_OutOfRange The handle already has SENSOR_POLL_MAX_SENSORS sensors.
+ * @retval kStatus_LPI2C_Busy A command list is running.
+ */
+status_t SENSOR_POLL_AddSensor(sensor_poll_handle_t *handle, sensor_poll_sensor_t *sensor);
+
+/*! @} */
+
+/*!
+ * @name Polling
+ * @{
+ */
+
+/*!
+ * @brief Advances the time of the sensors, and starts the command list of the sensors due.
+ *
+ * Called from the periodic interrupt of the application timer. A sensor due while the previous list still runs
+ * skips its sample, counted in missedSamples, and a list running for SENSOR_POLL_TIMEOUT_TICKS ticks is aborted.
+ *
+ * @param handle The handle.
+ */
+void SENSOR_POLL_Tick(sensor_poll_handle_t *handle);
+
+/*!
+ * @brief Gets the number of samples skipped because the bus was still busy.
+ *
+ * @param handle The handle.
+ * @return Number of samples skipped since the initialization.
+ */
+static inline uint32_t SENSOR_POLL_GetMissedSamples(sensor_poll_handle_t *handle)
+{
+    return handle->missedSamples;
+}
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @} */
+
+#endif /* _FSL_COMPONENT_SENSOR_POLL_H_ */
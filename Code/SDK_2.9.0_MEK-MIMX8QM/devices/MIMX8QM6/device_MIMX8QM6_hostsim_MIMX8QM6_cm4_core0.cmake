@@ -0,0 +1,51 @@
+if(NOT DEVICE_MIMX8QM6_HOSTSIM_MIMX8QM6_cm4_core0_INCLUDED)
+    
+    set(DEVICE_MIMX8QM6_HOSTSIM_MIMX8QM6_cm4_core0_INCLUDED true CACHE BOOL "device_MIMX8QM6_hostsim component is included.")
+
+    target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/system_MIMX8QM6_cm4_core0.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_vectors.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_edma.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_enet.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_flexcan.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_lmem.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_lpuart.c
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/fsl_hostsim_mu.c
+    )
+
+    # The simulated core_cm4.h and device header must be found before the CMSIS and device ones.
+    target_include_directories(${MCUX_SDK_PROJECT_NAME} BEFORE PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim/device
+        ${CMAKE_CURRENT_LIST_DIR}/hostsim
+    )
+
+    target_include_directories(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        ${CMAKE_CURRENT_LIST_DIR}/.
+    )
+
+    # The drivers store addresses in 32-bit registers and the vector table holds 32-bit handlers: the
+    # simulation is a 64-bit host process linked without PIE, where the code and static data are below
+    # 4 GB, and main() is wrapped to run on a stack below 4 GB. The buffers the drivers give to the eDMA
+    # or the ENET must not be on the heap. The casts of the drivers between pointers and uint32_t are then
+    # exact.
+    target_compile_options(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        -fno-pie
+        -Wno-int-to-pointer-cast
+        -Wno-pointer-to-int-cast
+    )
+    target_link_options(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        -no-pie
+        -Wl,--wrap=main
+    )
+
+    # SDK_DelayAtLeastUs() counts the cycles of the simulated DWT, the delay loop is ARM assembly.
+    target_compile_definitions(${MCUX_SDK_PROJECT_NAME} PRIVATE
+        SDK_DELAY_USE_DWT
+    )
+
+    include(CMSIS_Include_core_cm4_MIMX8QM6_cm4_core0)
+
+    include(driver_memory_MIMX8QM6_cm4_core0)
+
+endif()
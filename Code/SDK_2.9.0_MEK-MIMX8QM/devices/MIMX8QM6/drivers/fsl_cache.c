@@ -18,6 +18,17 @@
 #define L1CACHE_ONEWAYSIZE_BYTE      (4096U)       /*!< Cache size is 4K-bytes one way. */
 #define L1CACHE_CODEBUSADDR_BOUNDARY (0x1FFFFFFFU) /*!< The processor code bus address boundary. */
 
+/* Offset mask of the addresses in a data cache line. */
+#define DCACHE_LINE_MASK ((uint32_t)L1SYSTEMBUSCACHE_LINESIZE_BYTE - 1U)
+
+/* Maintenance operation of the functions of the memory shared with other bus masters. */
+typedef enum _dcache_operation
+{
+    kDCACHE_Clean           = 0U, /* Clean. */
+    kDCACHE_Invalidate      = 1U, /* Invalidate. */
+    kDCACHE_CleanInvalidate = 2U, /* Clean and invalidate. */
+} dcache_operation_t;
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -505,3 +516,212 @@ void L1CACHE_CleanInvalidateDCacheByRange(uint32_t address, uint32_t size_byte)
     }
 #endif /* FSL_FEATURE_SOC_LMEM_COUNT == 1 */
 }
+
+/* Maintains the whole caches of the buses of a range, the invalidations always clean the modified lines first. */
+static void DCACHE_MaintainAll(uint32_t startAddr, uint32_t endAddr, dcache_operation_t operation)
+{
+#if (FSL_FEATURE_SOC_LMEM_COUNT == 1)
+    if (startAddr <= L1CACHE_CODEBUSADDR_BOUNDARY)
+    {
+        if (operation == kDCACHE_Clean)
+        {
+            L1CACHE_CleanCodeCache();
+        }
+        else
+        {
+            L1CACHE_CleanInvalidateCodeCache();
+        }
+    }
+#if defined(FSL_FEATURE_LMEM_HAS_SYSTEMBUS_CACHE) && FSL_FEATURE_LMEM_HAS_SYSTEMBUS_CACHE
+    if ((endAddr - 1U) > L1CACHE_CODEBUSADDR_BOUNDARY)
+    {
+        if (operation == kDCACHE_Clean)
+        {
+            L1CACHE_CleanSystemCache();
+        }
+        else
+        {
+            L1CACHE_CleanInvalidateSystemCache();
+        }
+    }
+#endif /* FSL_FEATURE_LMEM_HAS_SYSTEMBUS_CACHE */
+#endif /* FSL_FEATURE_SOC_LMEM_COUNT == 1 */
+}
+
+/* Maintains a range line by line, or the whole cache when the range is larger than the cache. */
+static void DCACHE_MaintainRange(uint32_t address, uint32_t size_byte, dcache_operation_t operation)
+{
+    if (size_byte > DCACHE_RANGE_MAINTENANCE_MAX_BYTE)
+    {
+        DCACHE_MaintainAll(address, address + size_byte, operation);
+    }
+    else if (operation == kDCACHE_Clean)
+    {
+        DCACHE_CleanByRange(address, size_byte);
+    }
+    else if (operation == kDCACHE_Invalidate)
+    {
+        DCACHE_InvalidateByRange(address, size_byte);
+    }
+    else
+    {
+        DCACHE_CleanInvalidateByRange(address, size_byte);
+    }
+}
+
+/* Maintains the ranges of a range set, or the whole cache when they are larger than the cache, and empties it. */
+static void DCACHE_MaintainRangeSet(dcache_range_set_t *rangeSet, dcache_operation_t operation)
+{
+    uint32_t size = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < rangeSet->count; i++)
+    {
+        size += rangeSet->endAddr[i] - rangeSet->startAddr[i];
+    }
+
+    if (size > DCACHE_RANGE_MAINTENANCE_MAX_BYTE)
+    {
+        DCACHE_MaintainAll(rangeSet->startAddr[0], rangeSet->endAddr[rangeSet->count - 1U], operation);
+    }
+    else
+    {
+        for (i = 0U; i < rangeSet->count; i++)
+        {
+            DCACHE_MaintainRange(rangeSet->startAddr[i], rangeSet->endAddr[i] - rangeSet->startAddr[i], operation);
+        }
+    }
+
+    rangeSet->count = 0U;
+}
+
+/*!
+ * brief Cleans data cache by range, or the whole cache for a large range.
+ *
+ * param address The physical address.
+ * param size_byte size of the memory to be cleaned.
+ */
+void DCACHE_CleanByRangeOrAll(uint32_t address, uint32_t size_byte)
+{
+    DCACHE_MaintainRange(address, size_byte, kDCACHE_Clean);
+}
+
+/*!
+ * brief Invalidates data cache by range, or cleans and invalidates the whole cache for a large range.
+ *
+ * param address The physical address.
+ * param size_byte size of the memory to be invalidated.
+ * note As for DCACHE_InvalidateByRange(), the lines partially in the range lose their modifications.
+ */
+void DCACHE_InvalidateByRangeOrAll(uint32_t address, uint32_t size_byte)
+{
+    DCACHE_MaintainRange(address, size_byte, kDCACHE_Invalidate);
+}
+
+/*!
+ * brief Cleans and invalidates data cache by range, or the whole cache for a large range.
+ *
+ * param address The physical address.
+ * param size_byte size of the memory to be cleaned and invalidated.
+ */
+void DCACHE_CleanInvalidateByRangeOrAll(uint32_t address, uint32_t size_byte)
+{
+    DCACHE_MaintainRange(address, size_byte, kDCACHE_CleanInvalidate);
+}
+
+/*!
+ * brief Adds a range to a range set.
+ *
+ * The range is merged with the ranges it overlaps or touches. When the set is full, the closest range is extended
+ * over the new one, so that the lines between them are maintained too: a range set is only cleaned, or cleaned
+ * and invalidated, never just invalidated.
+ *
+ * param rangeSet The range set.
+ * param address The physical address.
+ * param size_byte size of the memory.
+ */
+void DCACHE_AddRangeToSet(dcache_range_set_t *rangeSet, uint32_t address, uint32_t size_byte)
+{
+    uint32_t startAddr = address & ~DCACHE_LINE_MASK;
+    uint32_t endAddr   = (address + size_byte + DCACHE_LINE_MASK) & ~DCACHE_LINE_MASK;
+    uint32_t first     = 0U;
+    uint32_t last;
+    uint32_t i;
+
+    if (size_byte == 0U)
+    {
+        return;
+    }
+
+    /* The ranges before the first one ending at or after the start are disjoint. */
+    while ((first < rangeSet->count) && (rangeSet->endAddr[first] < startAddr))
+    {
+        first++;
+    }
+
+    /* The ranges from the first one to the last one overlap or touch the new range. */
+    last = first;
+    while ((last < rangeSet->count) && (rangeSet->startAddr[last] <= endAddr))
+    {
+        startAddr = MIN(startAddr, rangeSet->startAddr[last]);
+        endAddr   = MAX(endAddr, rangeSet->endAddr[last]);
+        last++;
+    }
+
+    if (last > first)
+    {
+        /* Merge them into the first one. */
+        rangeSet->startAddr[first] = startAddr;
+        rangeSet->endAddr[first]   = endAddr;
+        for (i = last; i < rangeSet->count; i++)
+        {
+            rangeSet->startAddr[i - (last - first - 1U)] = rangeSet->startAddr[i];
+            rangeSet->endAddr[i - (last - first - 1U)]   = rangeSet->endAddr[i];
+        }
+        rangeSet->count -= last - first - 1U;
+    }
+    else if (rangeSet->count < DCACHE_RANGE_SET_SIZE)
+    {
+        /* Insert the new range before the first one. */
+        for (i = rangeSet->count; i > first; i--)
+        {
+            rangeSet->startAddr[i] = rangeSet->startAddr[i - 1U];
+            rangeSet->endAddr[i]   = rangeSet->endAddr[i - 1U];
+        }
+        rangeSet->startAddr[first] = startAddr;
+        rangeSet->endAddr[first]   = endAddr;
+        rangeSet->count++;
+    }
+    else if ((first == rangeSet->count) ||
+             ((first > 0U) && ((startAddr - rangeSet->endAddr[first - 1U]) <= (rangeSet->startAddr[first] - endAddr))))
+    {
+        /* Full, the previous range is the closest. */
+        rangeSet->endAddr[first - 1U] = endAddr;
+    }
+    else
+    {
+        /* Full, the next range is the closest. */
+        rangeSet->startAddr[first] = startAddr;
+    }
+}
+
+/*!
+ * brief Cleans the ranges of a range set, or the whole cache when they are large, and empties the set.
+ *
+ * param rangeSet The range set.
+ */
+void DCACHE_CleanRangeSet(dcache_range_set_t *rangeSet)
+{
+    DCACHE_MaintainRangeSet(rangeSet, kDCACHE_Clean);
+}
+
+/*!
+ * brief Cleans and invalidates the ranges of a range set, or the whole cache when they are large, and empties
+ * the set.
+ *
+ * param rangeSet The range set.
+ */
+void DCACHE_CleanInvalidateRangeSet(dcache_range_set_t *rangeSet)
+{
+    DCACHE_MaintainRangeSet(rangeSet, kDCACHE_CleanInvalidate);
+}
@@ -22,7 +22,7 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief cache driver version. */
-#define FSL_CACHE_DRIVER_VERSION (MAKE_VERSION(2, 0, 5))
+#define FSL_CACHE_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
 /*@}*/
 
 /*! @brief code bus cache line size is equal to system bus line size, so the unified I/D cache line size equals too. */
@@ -31,6 +31,29 @@
 #define L1SYSTEMBUSCACHE_LINESIZE_BYTE \
     L1CODEBUSCACHE_LINESIZE_BYTE /*!< The system bus CACHE line size is 16B = 128b. */
 
+/*! @brief Number of bytes above which the whole cache is maintained instead of a range: the size of a bus cache. */
+#ifndef DCACHE_RANGE_MAINTENANCE_MAX_BYTE
+#define DCACHE_RANGE_MAINTENANCE_MAX_BYTE (8192U)
+#endif
+
+/*! @brief Maximum number of disjoint ranges of a range set, a new range extends the closest one beyond. */
+#ifndef DCACHE_RANGE_SET_SIZE
+#define DCACHE_RANGE_SET_SIZE (4U)
+#endif
+
+/*!
+ * @brief Set of memory ranges to maintain at once, such as the buffers written by the CPU before a DMA transfer.
+ *
+ * The ranges are kept aligned to the cache lines, sorted, and the adjacent or overlapping ones are merged, so that
+ * each line is maintained once.
+ */
+typedef struct _dcache_range_set
+{
+    uint32_t startAddr[DCACHE_RANGE_SET_SIZE]; /*!< Start addresses of the ranges, aligned to the cache line. */
+    uint32_t endAddr[DCACHE_RANGE_SET_SIZE];   /*!< End addresses of the ranges, aligned to the cache line. */
+    uint32_t count;                            /*!< Number of ranges. */
+} dcache_range_set_t;
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -331,6 +354,81 @@ static inline void DCACHE_CleanInvalidateByRange(uint32_t address, uint32_t size
 
 /*@}*/
 
+/*!
+ * @name Cache maintenance of memory shared with other bus masters
+ *
+ * These functions keep the buffers shared with a DMA or another core cacheable. A range is maintained line by
+ * line up to DCACHE_RANGE_MAINTENANCE_MAX_BYTE bytes, and the whole cache is maintained beyond, which costs a
+ * fixed time instead of a time proportional to the size. Whole cache invalidations are always done as clean and
+ * invalidate, so that the modified lines of the other buffers are not lost.
+ *@{
+ */
+
+/*!
+ * @brief Cleans data cache by range, or the whole cache for a large range.
+ *
+ * @param address The physical address.
+ * @param size_byte size of the memory to be cleaned.
+ */
+void DCACHE_CleanByRangeOrAll(uint32_t address, uint32_t size_byte);
+
+/*!
+ * @brief Invalidates data cache by range, or cleans and invalidates the whole cache for a large range.
+ *
+ * @param address The physical address.
+ * @param size_byte size of the memory to be invalidated.
+ * @note As for DCACHE_InvalidateByRange(), the lines partially in the range lose their modifications.
+ */
+void DCACHE_InvalidateByRangeOrAll(uint32_t address, uint32_t size_byte);
+
+/*!
+ * @brief Cleans and invalidates data cache by range, or the whole cache for a large range.
+ *
+ * @param address The physical address.
+ * @param size_byte size of the memory to be cleaned and invalidated.
+ */
+void DCACHE_CleanInvalidateByRangeOrAll(uint32_t address, uint32_t size_byte);
+
+/*!
+ * @brief Empties a range set.
+ *
+ * @param rangeSet The range set.
+ */
+static inline void DCACHE_InitRangeSet(dcache_range_set_t *rangeSet)
+{
+    rangeSet->count = 0U;
+}
+
+/*!
+ * @brief Adds a range to a range set.
+ *
+ * The range is merged with the ranges it overlaps or touches. When the set is full, the closest range is extended
+ * over the new one, so that the lines between them are maintained too: a range set is only cleaned, or cleaned
+ * and invalidated, never just invalidated.
+ *
+ * @param rangeSet The range set.
+ * @param address The physical address.
+ * @param size_byte size of the memory.
+ */
+void DCACHE_AddRangeToSet(dcache_range_set_t *rangeSet, uint32_t address, uint32_t size_byte);
+
+/*!
+ * @brief Cleans the ranges of a range set, or the whole cache when they are large, and empties the set.
+ *
+ * @param rangeSet The range set.
+ */
+void DCACHE_CleanRangeSet(dcache_range_set_t *rangeSet);
+
+/*!
+ * @brief Cleans and invalidates the ranges of a range set, or the whole cache when they are large, and empties
+ * the set.
+ *
+ * @param rangeSet The range set.
+ */
+void DCACHE_CleanInvalidateRangeSet(dcache_range_set_t *rangeSet);
+
+/*@}*/
+
 #if defined(__cplusplus)
 }
 #endif
@@ -172,6 +172,7 @@ enum _status_groups
     kStatusGroup_MECC = 152,                  /*!< Group number for MECC status codes. */
     kStatusGroup_ENET_QOS = 153,              /*!< Group number for ENET_QOS status codes. */
     kStatusGroup_LOG = 154,                   /*!< Group number for LOG status codes. */
+    kStatusGroup_DMA_COPY = 155,              /*!< Group number for DMA copy status codes. */
 };
 
 /*! \public
@@ -362,8 +363,10 @@ _Pragma("diag_suppress=Pm120")
 #elif(defined(__GNUC__))
 /* For GCC, when the non-cacheable section is required, please define "__STARTUP_INITIALIZE_NONCACHEDATA"
  * in your projects to make sure the non-cacheable section variables will be initialized in system startup.
+ * The section flags are in the ARM assembler syntax, host builds (the device simulation) have no such section.
  */
-#if ((!(defined(FSL_FEATURE_HAS_NO_NONCACHEABLE_SECTION) && FSL_FEATURE_HAS_NO_NONCACHEABLE_SECTION)) && defined(FSL_FEATURE_L1ICACHE_LINESIZE_BYTE))
+#if ((!(defined(FSL_FEATURE_HAS_NO_NONCACHEABLE_SECTION) && FSL_FEATURE_HAS_NO_NONCACHEABLE_SECTION)) && \
+     defined(FSL_FEATURE_L1ICACHE_LINESIZE_BYTE) && defined(__arm__))
 #define AT_NONCACHEABLE_SECTION_INIT(var) __attribute__((section("NonCacheable.init"))) var
 #define AT_NONCACHEABLE_SECTION_ALIGN_INIT(var, alignbytes) \
     __attribute__((section("NonCacheable.init"))) var __attribute__((aligned(alignbytes)))
@@ -863,8 +863,8 @@ static void ENET_SetRxBufferDescriptors(enet_handle_t *handle,
 #if defined(FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL) && FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL
             if (buffCfg->rxMaintainEnable)
             {
-                /* Invalidate rx buffers before DMA transfer data into them. */
-                DCACHE_InvalidateByRange((uint32_t)rxBuffer, ((uint32_t)buffCfg->rxBdNumber * rxBuffSizeAlign));
+                /* Invalidate rx buffers before DMA transfer data into them, the whole cache for a large ring. */
+                DCACHE_InvalidateByRangeOrAll((uint32_t)rxBuffer, ((uint32_t)buffCfg->rxBdNumber * rxBuffSizeAlign));
             }
 #endif /* FSL_SDK_ENABLE_DRIVER_CACHE_CONTROL */
 
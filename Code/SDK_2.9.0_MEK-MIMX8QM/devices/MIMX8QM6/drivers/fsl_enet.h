@@ -24,7 +24,7 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief Defines the driver version. */
-#define FSL_ENET_DRIVER_VERSION (MAKE_VERSION(2, 3, 4))
+#define FSL_ENET_DRIVER_VERSION (MAKE_VERSION(2, 3, 5))
 /*@}*/
 
 /*! @name ENET DESCRIPTOR QUEUE */
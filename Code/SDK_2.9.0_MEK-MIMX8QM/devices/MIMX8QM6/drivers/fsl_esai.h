@@ -22,7 +22,7 @@
 
 /*! @name Driver version */
 /*@{*/
-#define FSL_ESAI_DRIVER_VERSION (MAKE_VERSION(2, 1, 1)) /*!< Version 2.1.1 */
+#define FSL_ESAI_DRIVER_VERSION (MAKE_VERSION(2, 1, 2)) /*!< Version 2.1.2 */
 /*@}*/
 
 /*! @brief ESAI return status, _esai_status_t*/
@@ -34,7 +34,9 @@ enum
     kStatus_ESAI_RxError   = MAKE_STATUS(kStatusGroup_ESAI, 3), /*!< ESAI Rx FIFO error. */
     kStatus_ESAI_QueueFull = MAKE_STATUS(kStatusGroup_ESAI, 4), /*!< ESAI transfer queue is full. */
     kStatus_ESAI_TxIdle    = MAKE_STATUS(kStatusGroup_ESAI, 5), /*!< ESAI Tx is idle */
-    kStatus_ESAI_RxIdle    = MAKE_STATUS(kStatusGroup_ESAI, 6)  /*!< ESAI Rx is idle */
+    kStatus_ESAI_RxIdle    = MAKE_STATUS(kStatusGroup_ESAI, 6), /*!< ESAI Rx is idle */
+    kStatus_ESAI_TxPeriod  = MAKE_STATUS(kStatusGroup_ESAI, 7), /*!< ESAI Tx stream sent periods, still running */
+    kStatus_ESAI_RxPeriod  = MAKE_STATUS(kStatusGroup_ESAI, 8)  /*!< ESAI Rx stream received periods, still running */
 };
 
 /*! @brief Define the ESAI bus type */
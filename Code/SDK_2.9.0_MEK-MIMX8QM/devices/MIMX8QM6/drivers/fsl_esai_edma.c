@@ -7,6 +7,7 @@
  */
 
 #include "fsl_esai_edma.h"
+#include "fsl_memory.h"
 
 /* Component ID definition, used by tools. */
 #ifndef FSL_COMPONENT_ID
@@ -59,6 +60,47 @@ static void ESAI_TxEDMACallback(edma_handle_t *handle, void *userData, bool done
  */
 static void ESAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
 
+/*!
+ * @brief ESAI EDMA callback for the circular stream send.
+ *
+ * @param handle pointer to esai_edma_handle_t structure which stores the transfer state.
+ * @param userData Parameter for user callback.
+ * @param done If the DMA transfer finished.
+ * @param tcds The TCD index.
+ */
+static void ESAI_TxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
+
+/*!
+ * @brief ESAI EDMA callback for the circular stream receive.
+ *
+ * @param handle pointer to esai_edma_handle_t structure which stores the transfer state.
+ * @param userData Parameter for user callback.
+ * @param done If the DMA transfer finished.
+ * @param tcds The TCD index.
+ */
+static void ESAI_RxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
+
+/*!
+ * @brief Builds the looped TCD chain of a circular stream and starts the eDMA channel.
+ *
+ * @param handle ESAI eDMA handle pointer.
+ * @param config Pointer to the stream configuration.
+ * @param fifoAddr Address of the ESAI data register.
+ * @param type Transfer direction.
+ */
+static status_t ESAI_StartStreamEDMA(esai_edma_handle_t *handle,
+                                     const esai_edma_stream_config_t *config,
+                                     uint32_t fifoAddr,
+                                     edma_transfer_type_t type);
+
+/*!
+ * @brief Gives the TCD pool back to the transfer queue after a circular stream.
+ *
+ * @param handle ESAI eDMA handle pointer.
+ * @param callback The eDMA callback of the transfer queue.
+ */
+static void ESAI_StopStreamEDMA(esai_edma_handle_t *handle, edma_callback callback);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -102,6 +144,118 @@ static void ESAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done
     }
 }
 
+static void ESAI_TxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds)
+{
+    esai_edma_private_handle_t *privHandle = (esai_edma_private_handle_t *)userData;
+    esai_edma_handle_t *esaiHandle         = privHandle->handle;
+
+    /* The next TCD of the ring is already loaded, only the DONE bit is left from the finished one. */
+    handle->base->CH[handle->channel].CH_CSR |= DMA_CH_CSR_DONE_MASK;
+
+    if (esaiHandle->callback != NULL)
+    {
+        (esaiHandle->callback)(privHandle->base, esaiHandle, kStatus_ESAI_TxPeriod, esaiHandle->userData);
+    }
+}
+
+static void ESAI_RxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds)
+{
+    esai_edma_private_handle_t *privHandle = (esai_edma_private_handle_t *)userData;
+    esai_edma_handle_t *esaiHandle         = privHandle->handle;
+
+    /* The next TCD of the ring is already loaded, only the DONE bit is left from the finished one. */
+    handle->base->CH[handle->channel].CH_CSR |= DMA_CH_CSR_DONE_MASK;
+
+    if (esaiHandle->callback != NULL)
+    {
+        (esaiHandle->callback)(privHandle->base, esaiHandle, kStatus_ESAI_RxPeriod, esaiHandle->userData);
+    }
+}
+
+static status_t ESAI_StartStreamEDMA(esai_edma_handle_t *handle,
+                                     const esai_edma_stream_config_t *config,
+                                     uint32_t fifoAddr,
+                                     edma_transfer_type_t type)
+{
+    edma_transfer_config_t transfer = {0};
+    edma_tcd_t *tcd                 = STCD_ADDR(handle->tcd);
+    uint32_t width                  = handle->bitWidth / 8UL;
+    uint32_t nbytes                 = (uint32_t)handle->count * handle->bitWidth / 8U;
+    uint32_t tcdNum;
+    size_t tcdSize;
+    uint8_t *data;
+    uint32_t i;
+
+    if ((config->buffer == NULL) || (config->periodNum < 2U) || (config->periodSize == 0U) || (nbytes == 0U) ||
+        ((config->periodSize % nbytes) != 0U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* One TCD per interrupt, or a single TCD looping on itself without interrupts. */
+    if (config->periodsPerIrq == 0U)
+    {
+        tcdNum = 1U;
+    }
+    else if ((config->periodNum % config->periodsPerIrq) == 0U)
+    {
+        tcdNum = config->periodNum / config->periodsPerIrq;
+    }
+    else
+    {
+        return kStatus_InvalidArgument;
+    }
+    tcdSize = config->periodSize * config->periodNum / tcdNum;
+    if ((tcdNum > ESAI_XFER_QUEUE_SIZE) ||
+        ((tcdSize / nbytes) > (DMA_TCD_CITER_ELINKNO_CITER_MASK >> DMA_TCD_CITER_ELINKNO_CITER_SHIFT)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < tcdNum; i++)
+    {
+        data = &config->buffer[i * tcdSize];
+        if (type == kEDMA_MemoryToPeripheral)
+        {
+            EDMA_PrepareTransfer(&transfer, data, width, (void *)(uint32_t *)fifoAddr, width, nbytes, tcdSize, type);
+        }
+        else
+        {
+            EDMA_PrepareTransfer(&transfer, (void *)(uint32_t *)fifoAddr, width, data, width, nbytes, tcdSize, type);
+        }
+        /* The last TCD links back to the first one, the chain never ends. */
+        EDMA_TcdReset(&tcd[i]);
+        EDMA_TcdSetTransferConfig(&tcd[i], &transfer, &tcd[(i + 1U) % tcdNum]);
+        if (config->periodsPerIrq != 0U)
+        {
+            EDMA_TcdEnableInterrupts(&tcd[i], (uint32_t)kEDMA_MajorInterruptEnable);
+        }
+    }
+
+    handle->state         = (uint32_t)kESAI_Busy;
+    handle->nbytes        = (uint8_t)nbytes;
+    handle->streamSize    = config->periodSize * config->periodNum;
+    handle->streamTcdSize = tcdSize;
+
+    /* The ring is not a queue of transfers: detach the pool so that the eDMA IRQ handler only calls back. */
+    EDMA_InstallTCDMemory(handle->dmaHandle, NULL, 0U);
+    EDMA_ResetChannel(handle->dmaHandle->base, handle->dmaHandle->channel);
+    EDMA_InstallTCD(handle->dmaHandle->base, handle->dmaHandle->channel, &tcd[0]);
+    EDMA_StartTransfer(handle->dmaHandle);
+
+    return kStatus_Success;
+}
+
+static void ESAI_StopStreamEDMA(esai_edma_handle_t *handle, edma_callback callback)
+{
+    /* Need to use scatter gather */
+    EDMA_InstallTCDMemory(handle->dmaHandle, STCD_ADDR(handle->tcd), ESAI_XFER_QUEUE_SIZE);
+    EDMA_SetCallback(handle->dmaHandle, callback, handle->dmaHandle->userData);
+
+    handle->streamSize    = 0U;
+    handle->streamTcdSize = 0U;
+}
+
 /*!
  * brief Initializes the ESAI eDMA handle.
  *
@@ -277,6 +431,12 @@ status_t ESAI_TransferSendEDMA(ESAI_Type *base, esai_edma_handle_t *handle, esai
         return kStatus_InvalidArgument;
     }
 
+    /* The TCD pool runs a circular stream */
+    if (handle->streamSize != 0U)
+    {
+        return kStatus_ESAI_TxBusy;
+    }
+
     if (handle->esaiQueue[handle->queueUser].data != NULL)
     {
         return kStatus_ESAI_QueueFull;
@@ -336,6 +496,12 @@ status_t ESAI_TransferReceiveEDMA(ESAI_Type *base, esai_edma_handle_t *handle, e
         return kStatus_InvalidArgument;
     }
 
+    /* The TCD pool runs a circular stream */
+    if (handle->streamSize != 0U)
+    {
+        return kStatus_ESAI_RxBusy;
+    }
+
     if (handle->esaiQueue[handle->queueUser].data != NULL)
     {
         return kStatus_ESAI_QueueFull;
@@ -385,6 +551,11 @@ void ESAI_TransferAbortSendEDMA(ESAI_Type *base, esai_edma_handle_t *handle)
     /* Disable Tx */
     ESAI_TxEnable(base, 0x0);
 
+    if (handle->streamSize != 0U)
+    {
+        ESAI_StopStreamEDMA(handle, ESAI_TxEDMACallback);
+    }
+
     /* Set the handle state */
     handle->state = (uint32_t)kESAI_Idle;
 }
@@ -405,6 +576,11 @@ void ESAI_TransferAbortReceiveEDMA(ESAI_Type *base, esai_edma_handle_t *handle)
     /* Disable Rx */
     ESAI_RxEnable(base, 0x0);
 
+    if (handle->streamSize != 0U)
+    {
+        ESAI_StopStreamEDMA(handle, ESAI_RxEDMACallback);
+    }
+
     /* Set the handle state */
     handle->state = (uint32_t)kESAI_Idle;
 }
@@ -466,3 +642,148 @@ status_t ESAI_TransferGetReceiveCountEDMA(ESAI_Type *base, esai_edma_handle_t *h
 
     return status;
 }
+
+/*!
+ * brief Starts a gapless ESAI send of a ring buffer using eDMA.
+ *
+ * The eDMA sends the ring continuously, with no transfer to resubmit. The application fills the whole ring before the
+ * call, then refills the periods the eDMA has sent, which it finds with ESAI_TransferGetStreamPositionEDMA(). The
+ * callback is called with kStatus_ESAI_TxPeriod every config->periodsPerIrq periods. The stream never reports
+ * kStatus_ESAI_TxIdle, it runs until it is stopped with ESAI_TransferAbortSendEDMA().
+ *
+ * param base ESAI base pointer.
+ * param handle ESAI eDMA handle pointer.
+ * param config Pointer to the stream configuration.
+ * retval kStatus_Success Start the stream successfully.
+ * retval kStatus_InvalidArgument The configuration does not fit the eDMA minor loop or the TCD pool.
+ * retval kStatus_ESAI_TxBusy ESAI is busy sending data.
+ */
+status_t ESAI_TransferSendStreamEDMA(ESAI_Type *base,
+                                     esai_edma_handle_t *handle,
+                                     const esai_edma_stream_config_t *config)
+{
+    assert((handle != NULL) && (config != NULL));
+
+    uint32_t instance = ESAI_GetInstance(base);
+    status_t status;
+
+    if (handle->state == (uint32_t)kESAI_Busy)
+    {
+        return kStatus_ESAI_TxBusy;
+    }
+
+    EDMA_SetCallback(handle->dmaHandle, ESAI_TxStreamEDMACallback, &s_edmaPrivateHandle[instance][0]);
+    status = ESAI_StartStreamEDMA(handle, config, ESAI_TxGetDataRegisterAddress(base), kEDMA_MemoryToPeripheral);
+    if (status != kStatus_Success)
+    {
+        EDMA_SetCallback(handle->dmaHandle, ESAI_TxEDMACallback, &s_edmaPrivateHandle[instance][0]);
+        return status;
+    }
+
+    /* Enable ESAI Tx clock */
+    ESAI_TxEnable(base, handle->sectionMap);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts a gapless ESAI receive into a ring buffer using eDMA.
+ *
+ * The eDMA fills the ring continuously, with no transfer to resubmit. The application reads the periods the eDMA has
+ * filled, which it finds with ESAI_TransferGetStreamPositionEDMA(). The callback is called with kStatus_ESAI_RxPeriod
+ * every config->periodsPerIrq periods. The stream never reports kStatus_ESAI_RxIdle, it runs until it is stopped with
+ * ESAI_TransferAbortReceiveEDMA().
+ *
+ * param base ESAI base pointer.
+ * param handle ESAI eDMA handle pointer.
+ * param config Pointer to the stream configuration.
+ * retval kStatus_Success Start the stream successfully.
+ * retval kStatus_InvalidArgument The configuration does not fit the eDMA minor loop or the TCD pool.
+ * retval kStatus_ESAI_RxBusy ESAI is busy receiving data.
+ */
+status_t ESAI_TransferReceiveStreamEDMA(ESAI_Type *base,
+                                        esai_edma_handle_t *handle,
+                                        const esai_edma_stream_config_t *config)
+{
+    assert((handle != NULL) && (config != NULL));
+
+    uint32_t instance = ESAI_GetInstance(base);
+    status_t status;
+
+    if (handle->state == (uint32_t)kESAI_Busy)
+    {
+        return kStatus_ESAI_RxBusy;
+    }
+
+    EDMA_SetCallback(handle->dmaHandle, ESAI_RxStreamEDMACallback, &s_edmaPrivateHandle[instance][1]);
+    status = ESAI_StartStreamEDMA(handle, config, ESAI_RxGetDataRegisterAddress(base), kEDMA_PeripheralToMemory);
+    if (status != kStatus_Success)
+    {
+        EDMA_SetCallback(handle->dmaHandle, ESAI_RxEDMACallback, &s_edmaPrivateHandle[instance][1]);
+        return status;
+    }
+
+    /* Enable ESAI Rx clock */
+    ESAI_RxEnable(base, handle->sectionMap);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the position of the eDMA in the ring of a circular stream.
+ *
+ * The position is read from the eDMA registers, with a minor loop resolution. The period at the position is
+ * in transfer. For a send, the periods before it back to the last one refilled are free; for a receive, they
+ * hold new data.
+ *
+ * param base ESAI base pointer.
+ * param handle ESAI eDMA handle pointer.
+ * param position Offset in bytes of the next eDMA transfer in the ring.
+ * retval kStatus_Success Succeed get the position.
+ * retval kStatus_NoTransferInProgress There is no circular stream in progress.
+ */
+status_t ESAI_TransferGetStreamPositionEDMA(ESAI_Type *base, esai_edma_handle_t *handle, size_t *position)
+{
+    assert((handle != NULL) && (position != NULL));
+
+    DMA_Type *dmaBase = handle->dmaHandle->base;
+    uint32_t channel  = handle->dmaHandle->channel;
+    uint32_t tcdNum;
+    uint32_t major;
+    uint32_t remaining;
+    uint32_t pool;
+    uint32_t sga;
+    uint32_t index;
+
+    if (handle->streamSize == 0U)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+    pool = MEMORY_ConvertMemoryMapAddress((uint32_t)STCD_ADDR(handle->tcd), kMEMORY_Local2DMA);
+#else
+    pool = (uint32_t)STCD_ADDR(handle->tcd);
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+    tcdNum = handle->streamSize / handle->streamTcdSize;
+    major  = handle->streamTcdSize / handle->nbytes;
+
+    /* Read the count again if a TCD was loaded in between, the count must belong to the linked TCD. */
+    do
+    {
+        sga       = dmaBase->CH[channel].TCD_DLAST_SGA;
+        remaining = EDMA_GetRemainingMajorLoopCount(dmaBase, channel);
+    } while (sga != dmaBase->CH[channel].TCD_DLAST_SGA);
+
+    /* A 0 count is the DONE bit left from the previous TCD of the ring, before the next one starts. */
+    if (remaining == 0U)
+    {
+        remaining = major;
+    }
+
+    /* The registers hold the TCD before the one DLAST_SGA links to. */
+    index     = ((sga - pool) / sizeof(edma_tcd_t) + tcdNum - 1U) % tcdNum;
+    *position = index * handle->streamTcdSize + (major - remaining) * handle->nbytes;
+
+    return kStatus_Success;
+}
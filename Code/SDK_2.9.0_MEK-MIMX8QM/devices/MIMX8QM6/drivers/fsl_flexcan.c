@@ -79,6 +79,7 @@ enum _flexcan_state
     kFLEXCAN_StateTxData   = 0x3, /*!< MB transmitting.*/
     kFLEXCAN_StateTxRemote = 0x4, /*!< MB transmitting remote request.*/
     kFLEXCAN_StateRxFifo   = 0x5, /*!< RxFIFO receiving.*/
+    kFLEXCAN_StateRxRing   = 0x6, /*!< MB/RxFIFO receiving into the receive ring.*/
 };
 
 /*! @brief FlexCAN message buffer CODE for Rx buffers. */
@@ -140,16 +141,22 @@ static uint8_t FLEXCAN_GetFirstValidMb(CAN_Type *base);
 #endif
 
 /*!
- * @brief Check if Message Buffer interrupt is enabled.
+ * @brief Get the Message Buffer interrupt flags whose interrupt is enabled.
  *
- * This function check if Message Buffer interrupt is enabled.
+ * This function reads each interrupt flag and interrupt mask register once.
  *
  * @param base FlexCAN peripheral base address.
- * @param mbIdx The FlexCAN Message Buffer index.
- * @return TRUE if the index MB interrupt mask enabled, FALSE if the index MB interrupt mask disabled.
+ * @return The ORed flags of the Message Buffers, Message Buffer 32 is bit 32.
+ */
+static uint64_t FLEXCAN_GetEnabledMbFlags(CAN_Type *base);
+
+/*!
+ * @brief Get the lowest Message Buffer index of the flags.
  *
+ * @param flags The ORed flags of the Message Buffers, not 0.
+ * @return The index of the lowest flag set.
  */
-static bool FLEXCAN_IsMbIntEnabled(CAN_Type *base, uint8_t mbIdx);
+static uint32_t FLEXCAN_GetLowestMbFlag(uint64_t flags);
 
 /*!
  * @brief Reset the FlexCAN Instance.
@@ -272,6 +279,31 @@ static bool FLEXCAN_CheckUnhandleInterruptEvents(CAN_Type *base);
  */
 static status_t FLEXCAN_SubHandlerForDataTransfered(CAN_Type *base, flexcan_handle_t *handle, uint32_t *pResult);
 
+/*!
+ * @brief Read a Rx Message Buffer into a receive ring entry.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param ring The receive ring.
+ * @param entry The entry, in the ring or a scratch one when the ring is full.
+ * @param mbIdx The FlexCAN Message Buffer index.
+ * @retval kStatus_Success The entry holds the frame.
+ * @retval kStatus_FLEXCAN_RxOverflow The entry holds the frame, the frames before it were overwritten.
+ * @retval kStatus_Fail The Message Buffer held no frame, the entry is not valid.
+ */
+static status_t FLEXCAN_RxRingReadMb(CAN_Type *base,
+                                     flexcan_rx_ring_t *ring,
+                                     flexcan_rx_ring_entry_t *entry,
+                                     uint32_t mbIdx);
+
+/*!
+ * @brief Sub Handler Receive Ring Events
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @return the number of the entries added to the receive ring.
+ */
+static uint32_t FLEXCAN_SubHandlerForRxRing(CAN_Type *base, flexcan_handle_t *handle);
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -553,26 +585,34 @@ static uint8_t FLEXCAN_GetFirstValidMb(CAN_Type *base)
 }
 #endif
 
-static bool FLEXCAN_IsMbIntEnabled(CAN_Type *base, uint8_t mbIdx)
+static uint64_t FLEXCAN_GetEnabledMbFlags(CAN_Type *base)
 {
-    /* Assertion. */
-    assert(mbIdx < (uint8_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base));
-
-    uint32_t flag = 1U;
-    bool fgRet    = false;
+    uint64_t flags = (uint64_t)(base->IFLAG1 & base->IMASK1);
 
 #if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-    if (mbIdx >= 32U)
+    flags |= ((uint64_t)(base->IFLAG2 & base->IMASK2)) << 32;
+#endif
+
+    return flags;
+}
+
+static uint32_t FLEXCAN_GetLowestMbFlag(uint64_t flags)
+{
+    assert(0U != flags);
+
+    uint32_t mbIdx;
+
+    /* Count the trailing zeros: bit reverse, then count the leading zeros. */
+    if (0U != (uint32_t)flags)
     {
-        fgRet = (0U != (base->IMASK2 & (flag << (mbIdx - 32U))));
+        mbIdx = (uint32_t)__CLZ(__RBIT((uint32_t)flags));
     }
     else
-#endif
     {
-        fgRet = (0U != (base->IMASK1 & (flag << mbIdx)));
+        mbIdx = 32U + (uint32_t)__CLZ(__RBIT((uint32_t)(flags >> 32)));
     }
 
-    return fgRet;
+    return mbIdx;
 }
 
 static void FLEXCAN_Reset(CAN_Type *base)
@@ -3331,6 +3371,158 @@ void FLEXCAN_TransferAbortReceiveFifo(CAN_Type *base, flexcan_handle_t *handle)
     handle->rxFifoState = (uint8_t)kFLEXCAN_StateIdle;
 }
 
+/*!
+ * brief Starts receiving into a ring.
+ *
+ * The Rx Message Buffers must be configured with FLEXCAN_SetRxMbConfig() or FLEXCAN_SetFDRxMbConfig(), and the
+ * Rx FIFO with FLEXCAN_SetRxFifoConfig(). They stay active: the IRQ handler reads the interrupt flags once,
+ * reads all the ready Message Buffers and Rx FIFO frames into the ring with one software timestamp, and then
+ * calls the callback once with kStatus_FLEXCAN_RxRingReady and the number of the new entries as result.
+ * The frames read while the ring is full are dropped and counted. The callback is not called with
+ * kStatus_FLEXCAN_UnHandled for the interrupts which the ring handled.
+ *
+ * The application reads the entries with FLEXCAN_RxRingPeek() and FLEXCAN_RxRingRelease().
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle FlexCAN handle pointer.
+ * param ring The ring, used until FLEXCAN_TransferStopRxRing().
+ * param config The ring configuration.
+ * retval kStatus_Success            - The ring is receiving.
+ * retval kStatus_InvalidArgument    - The number of entries is not a power of 2.
+ * retval kStatus_FLEXCAN_RxBusy     - A Message Buffer is in use.
+ * retval kStatus_FLEXCAN_RxFifoBusy - The Rx FIFO is in use.
+ */
+status_t FLEXCAN_TransferStartRxRing(CAN_Type *base,
+                                     flexcan_handle_t *handle,
+                                     flexcan_rx_ring_t *ring,
+                                     const flexcan_rx_ring_config_t *config)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+    assert(NULL != ring);
+    assert(NULL != config);
+    assert(NULL != config->entries);
+    assert(NULL == handle->rxRing);
+
+    status_t status = kStatus_Success;
+    uint64_t mbMask = config->mbMask;
+    uint32_t fifoMask;
+    uint32_t mbIdx;
+
+    if ((0U == config->entryCount) || (0U != (config->entryCount & (config->entryCount - 1U))))
+    {
+        status = kStatus_InvalidArgument;
+    }
+    else if (config->enableRxFifo && ((uint8_t)kFLEXCAN_StateIdle != handle->rxFifoState))
+    {
+        status = kStatus_FLEXCAN_RxFifoBusy;
+    }
+    else
+    {
+        /* Check if the Message Buffers are idle. */
+        while (0U != mbMask)
+        {
+            mbIdx = FLEXCAN_GetLowestMbFlag(mbMask);
+            mbMask &= mbMask - 1U;
+            assert(mbIdx <= (base->MCR & CAN_MCR_MAXMB_MASK));
+#if !defined(NDEBUG)
+            assert(!FLEXCAN_IsMbOccupied(base, (uint8_t)mbIdx));
+#endif
+            if ((uint8_t)kFLEXCAN_StateIdle != handle->mbState[mbIdx])
+            {
+                status = kStatus_FLEXCAN_RxBusy;
+                break;
+            }
+        }
+    }
+
+    if (kStatus_Success == status)
+    {
+        fifoMask = 0U;
+        if (config->enableRxFifo)
+        {
+            fifoMask = (uint32_t)kFLEXCAN_RxFifoOverflowFlag | (uint32_t)kFLEXCAN_RxFifoWarningFlag |
+                       (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag;
+        }
+
+        ring->entries       = config->entries;
+        ring->indexMask     = config->entryCount - 1U;
+        ring->head          = 0U;
+        ring->tail          = 0U;
+        ring->droppedFrames = 0U;
+        ring->overrunFrames = 0U;
+        ring->mbMask        = config->mbMask;
+        ring->fifoMask      = fifoMask;
+        ring->getTimestamp  = config->getTimestamp;
+
+        /* The transactional receive APIs report the Message Buffers and the Rx FIFO of the ring as busy. */
+        mbMask = config->mbMask;
+        while (0U != mbMask)
+        {
+            mbIdx = FLEXCAN_GetLowestMbFlag(mbMask);
+            mbMask &= mbMask - 1U;
+            handle->mbState[mbIdx] = (uint8_t)kFLEXCAN_StateRxRing;
+        }
+        if (config->enableRxFifo)
+        {
+            handle->rxFifoState = (uint8_t)kFLEXCAN_StateRxRing;
+        }
+
+        handle->rxRing = ring;
+
+        /* Enable Message Buffer Interrupts. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+        FLEXCAN_EnableMbInterrupts(base, config->mbMask | (uint64_t)fifoMask);
+#else
+        FLEXCAN_EnableMbInterrupts(base, (uint32_t)config->mbMask | fifoMask);
+#endif
+    }
+
+    return status;
+}
+
+/*!
+ * brief Stops receiving into the ring.
+ *
+ * The Message Buffers and the Rx FIFO of the ring are idle again, the entries not read stay in the ring.
+ *
+ * param base FlexCAN peripheral base address.
+ * param handle FlexCAN handle pointer.
+ */
+void FLEXCAN_TransferStopRxRing(CAN_Type *base, flexcan_handle_t *handle)
+{
+    /* Assertion. */
+    assert(NULL != handle);
+
+    flexcan_rx_ring_t *ring = handle->rxRing;
+    uint64_t mbMask;
+    uint32_t mbIdx;
+
+    if (NULL != ring)
+    {
+        /* Disable Message Buffer Interrupts. */
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
+        FLEXCAN_DisableMbInterrupts(base, ring->mbMask | (uint64_t)ring->fifoMask);
+#else
+        FLEXCAN_DisableMbInterrupts(base, (uint32_t)ring->mbMask | ring->fifoMask);
+#endif
+
+        handle->rxRing = NULL;
+
+        mbMask = ring->mbMask;
+        while (0U != mbMask)
+        {
+            mbIdx = FLEXCAN_GetLowestMbFlag(mbMask);
+            mbMask &= mbMask - 1U;
+            handle->mbState[mbIdx] = (uint8_t)kFLEXCAN_StateIdle;
+        }
+        if (0U != ring->fifoMask)
+        {
+            handle->rxFifoState = (uint8_t)kFLEXCAN_StateIdle;
+        }
+    }
+}
+
 /*!
  * brief Gets the detail index of Mailbox's Timestamp by handle.
  *
@@ -3386,30 +3578,155 @@ static bool FLEXCAN_CheckUnhandleInterruptEvents(CAN_Type *base)
     return fgRet;
 }
 
-static status_t FLEXCAN_SubHandlerForDataTransfered(CAN_Type *base, flexcan_handle_t *handle, uint32_t *pResult)
+static status_t FLEXCAN_RxRingReadMb(CAN_Type *base,
+                                     flexcan_rx_ring_t *ring,
+                                     flexcan_rx_ring_entry_t *entry,
+                                     uint32_t mbIdx)
 {
-    status_t status = kStatus_FLEXCAN_UnHandled;
-    uint32_t result = 0xFFU;
+    status_t status;
 
-    /* For this implementation, we solve the Message with lowest MB index first. */
-    for (result = 0U; result < (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base); result++)
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+    if (0U != (base->MCR & CAN_MCR_FDEN_MASK))
+    {
+        status = FLEXCAN_ReadFDRxMb(base, (uint8_t)mbIdx, &entry->fdFrame);
+    }
+    else
+#endif
+    {
+        status = FLEXCAN_ReadRxMb(base, (uint8_t)mbIdx, &entry->frame);
+    }
+
+    if (kStatus_FLEXCAN_RxOverflow == status)
     {
-        /* Get the lowest unhandled Message Buffer */
+        /* The frame is valid, the frames before it were overwritten. */
+        ring->overrunFrames++;
+    }
+    entry->mbIdx = (uint8_t)mbIdx;
+
+    return status;
+}
+
+static uint32_t FLEXCAN_SubHandlerForRxRing(CAN_Type *base, flexcan_handle_t *handle)
+{
+    flexcan_rx_ring_t *ring = handle->rxRing;
+    flexcan_rx_ring_entry_t dropped;
+    flexcan_rx_ring_entry_t *entry;
+    status_t status;
+    uint32_t timestamp = 0U;
+    uint32_t head      = ring->head;
+    uint32_t tail      = ring->tail;
+    uint32_t count     = 0U;
+    uint64_t flags;
+    uint32_t mbIdx;
+
+    /* Read the flags once, the frames received meanwhile are left to the next pass of the IRQ handler. */
+    flags = FLEXCAN_GetEnabledMbFlags(base) & (ring->mbMask | (uint64_t)ring->fifoMask);
+
+    if ((0U != flags) && (NULL != ring->getTimestamp))
+    {
+        timestamp = ring->getTimestamp();
+    }
+
+    /* Walk the flags from the lowest Message Buffer, the order of the matching priority. */
+    while (0U != flags)
+    {
+        mbIdx = FLEXCAN_GetLowestMbFlag(flags);
+        flags &= flags - 1U;
+
+        if ((0U != ring->fifoMask) && (mbIdx <= (uint32_t)CAN_IFLAG1_BUF7I_SHIFT))
+        {
+            if ((uint32_t)CAN_IFLAG1_BUF5I_SHIFT == mbIdx)
+            {
+                /* Pop the Rx FIFO until empty, each clear of the flag shows the next frame. */
+                while (0U != (base->IFLAG1 & (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag))
+                {
+                    entry = ((head - tail) <= ring->indexMask) ? &ring->entries[head & ring->indexMask] : &dropped;
+                    status           = FLEXCAN_ReadRxFifo(base, &entry->frame);
+                    entry->timestamp = timestamp;
+                    entry->mbIdx     = (uint8_t)FLEXCAN_RX_RING_FIFO_INDEX;
+                    FLEXCAN_ClearMbStatusFlags(base, (uint32_t)kFLEXCAN_RxFifoFrameAvlFlag);
+                    if (kStatus_Fail == status)
+                    {
+                        /* No frame was read, the entry is written again by the next one. */
+                    }
+                    else if (entry != &dropped)
+                    {
+                        head++;
+                        count++;
+                    }
+                    else
+                    {
+                        ring->droppedFrames++;
+                    }
+                }
+            }
+            else
+            {
+                if ((uint32_t)CAN_IFLAG1_BUF7I_SHIFT == mbIdx)
+                {
+                    /* The Rx FIFO lost at least one frame. */
+                    ring->overrunFrames++;
+                }
+                FLEXCAN_ClearMbStatusFlags(base, (uint32_t)1U << mbIdx);
+            }
+        }
+        else
+        {
+            entry = ((head - tail) <= ring->indexMask) ? &ring->entries[head & ring->indexMask] : &dropped;
+            status           = FLEXCAN_RxRingReadMb(base, ring, entry, mbIdx);
+            entry->timestamp = timestamp;
+            /* The Message Buffer stays active, clearing its flag makes it free to receive the next frame. */
 #if (defined(FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER)) && (FSL_FEATURE_FLEXCAN_HAS_EXTENDED_FLAG_REGISTER > 0)
-        uint64_t u64flag = 1;
-        if (0U != FLEXCAN_GetMbStatusFlags(base, u64flag << result))
+            uint64_t u64flag = 1;
+            FLEXCAN_ClearMbStatusFlags(base, u64flag << mbIdx);
 #else
-        uint32_t u32flag = 1;
-        if (0U != FLEXCAN_GetMbStatusFlags(base, u32flag << result))
+            uint32_t u32flag = 1;
+            FLEXCAN_ClearMbStatusFlags(base, u32flag << mbIdx);
 #endif
-        {
-            if (FLEXCAN_IsMbIntEnabled(base, (uint8_t)result))
+            if (kStatus_Fail == status)
             {
-                break;
+                /* The Message Buffer held no frame, as when it was busy: skip the entry, head does not move. */
+            }
+            else if (entry != &dropped)
+            {
+                head++;
+                count++;
+            }
+            else
+            {
+                ring->droppedFrames++;
             }
         }
     }
 
+    if (0U != count)
+    {
+        /* Publish the entries once they are written. */
+        __DMB();
+        ring->head = head;
+    }
+
+    return count;
+}
+
+static status_t FLEXCAN_SubHandlerForDataTransfered(CAN_Type *base, flexcan_handle_t *handle, uint32_t *pResult)
+{
+    status_t status = kStatus_FLEXCAN_UnHandled;
+    uint32_t result = (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base);
+    uint64_t flags  = FLEXCAN_GetEnabledMbFlags(base);
+
+    /* The Message Buffers and the Rx FIFO of the receive ring are handled by FLEXCAN_SubHandlerForRxRing(). */
+    if (NULL != handle->rxRing)
+    {
+        flags &= ~(handle->rxRing->mbMask | (uint64_t)handle->rxRing->fifoMask);
+    }
+
+    /* For this implementation, we solve the Message with lowest MB index first. */
+    if (0U != flags)
+    {
+        result = FLEXCAN_GetLowestMbFlag(flags);
+    }
+
     /* find Message to deal with. */
     if (result < (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base))
     {
@@ -3555,11 +3872,18 @@ void FLEXCAN_TransferHandleIRQ(CAN_Type *base, flexcan_handle_t *handle)
     assert(NULL != handle);
 
     status_t status;
-    uint32_t result    = 0xFFU;
-    uint32_t EsrStatus = 0U;
+    uint32_t result     = 0xFFU;
+    uint32_t EsrStatus  = 0U;
+    uint32_t ringFrames = 0U;
 
     do
     {
+        /* Drain the receive ring first, its new entries are signaled once at the end. */
+        if (NULL != handle->rxRing)
+        {
+            ringFrames += FLEXCAN_SubHandlerForRxRing(base, handle);
+        }
+
         /* Get Current FlexCAN Module Error and Status. */
         EsrStatus = FLEXCAN_GetStatusFlags(base);
 
@@ -3584,12 +3908,19 @@ void FLEXCAN_TransferHandleIRQ(CAN_Type *base, flexcan_handle_t *handle)
             status = FLEXCAN_SubHandlerForDataTransfered(base, handle, &result);
         }
 
-        /* Calling Callback Function if has one. */
-        if (handle->callback != NULL)
+        /* Calling Callback Function if has one, the passes which only drained the receive ring are silent. */
+        if ((handle->callback != NULL) &&
+            ((NULL == handle->rxRing) || (kStatus_FLEXCAN_UnHandled != status) ||
+             (result < (uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(base))))
         {
             handle->callback(base, handle, status, result, handle->userData);
         }
     } while (FLEXCAN_CheckUnhandleInterruptEvents(base));
+
+    if ((0U != ringFrames) && (handle->callback != NULL))
+    {
+        handle->callback(base, handle, kStatus_FLEXCAN_RxRingReady, ringFrames, handle->userData);
+    }
 }
 
 #if defined(CAN0)
@@ -22,7 +22,7 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief FlexCAN driver version. */
-#define FSL_FLEXCAN_DRIVER_VERSION (MAKE_VERSION(2, 6, 0))
+#define FSL_FLEXCAN_DRIVER_VERSION (MAKE_VERSION(2, 7, 0))
 /*@}*/
 
 #if !(defined(FLEXCAN_WAIT_TIMEOUT) && FLEXCAN_WAIT_TIMEOUT)
@@ -145,6 +145,8 @@ enum
     kStatus_FLEXCAN_WakeUp         = MAKE_STATUS(kStatusGroup_FLEXCAN, 11), /*!< FlexCAN is waken up from STOP mode. */
     kStatus_FLEXCAN_UnHandled      = MAKE_STATUS(kStatusGroup_FLEXCAN, 12), /*!< UnHadled Interrupt asserted. */
     kStatus_FLEXCAN_RxRemote = MAKE_STATUS(kStatusGroup_FLEXCAN, 13), /*!< Rx Remote Message Received in Mail box. */
+    kStatus_FLEXCAN_RxRingReady =
+        MAKE_STATUS(kStatusGroup_FLEXCAN, 14), /*!< A batch of frames is added to the receive ring. */
 };
 
 /*! @brief FlexCAN frame format. */
@@ -589,6 +591,61 @@ typedef struct _flexcan_fifo_transfer
     flexcan_frame_t *frame; /*!< The buffer of CAN Message to be received from Rx FIFO. */
 } flexcan_fifo_transfer_t;
 
+/*! @brief Receive ring entry index of the frames read from the Rx FIFO. */
+#define FLEXCAN_RX_RING_FIFO_INDEX (0xFFU)
+
+/*! @brief FlexCAN receive ring entry. */
+typedef struct _flexcan_rx_ring_entry
+{
+#if (defined(FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE) && FSL_FEATURE_FLEXCAN_HAS_FLEXIBLE_DATA_RATE)
+    union
+    {
+        flexcan_frame_t frame;      /*!< The frame, when the CAN FD operation is disabled. */
+        flexcan_fd_frame_t fdFrame; /*!< The frame, when the CAN FD operation is enabled. */
+    };
+#else
+    flexcan_frame_t frame; /*!< The frame. */
+#endif
+    uint32_t timestamp; /*!< Software timestamp of the interrupt which read the frame. */
+    uint8_t mbIdx;      /*!< Message Buffer of the frame, or FLEXCAN_RX_RING_FIFO_INDEX for the Rx FIFO. */
+} flexcan_rx_ring_entry_t;
+
+/*!
+ * @brief FlexCAN receive ring timestamp function.
+ *
+ * @return The current time of a free running counter, a timer or the DWT cycle counter for example.
+ */
+typedef uint32_t (*flexcan_rx_ring_timestamp_t)(void);
+
+/*! @brief FlexCAN receive ring configuration structure. */
+typedef struct _flexcan_rx_ring_config
+{
+    flexcan_rx_ring_entry_t *entries;         /*!< The ring entries. */
+    uint32_t entryCount;                      /*!< Number of entries, a power of 2. */
+    uint64_t mbMask;                          /*!< The ORed Rx Message Buffers drained into the ring. */
+    bool enableRxFifo;                        /*!< Drains the Rx FIFO into the ring. */
+    flexcan_rx_ring_timestamp_t getTimestamp; /*!< Timestamp function, NULL to leave the timestamps 0. */
+} flexcan_rx_ring_config_t;
+
+/*!
+ * @brief FlexCAN receive ring.
+ *
+ * The ring has a single producer, the FlexCAN interrupt, and a single consumer, the application, so it needs
+ * no lock: the interrupt only writes head and the application only writes tail.
+ */
+typedef struct _flexcan_rx_ring
+{
+    flexcan_rx_ring_entry_t *entries;         /*!< The ring entries. */
+    uint32_t indexMask;                       /*!< Number of entries minus 1. */
+    volatile uint32_t head;                   /*!< Number of entries written, by the interrupt. */
+    volatile uint32_t tail;                   /*!< Number of entries read, by the application. */
+    volatile uint32_t droppedFrames;          /*!< Frames read while the ring was full, and dropped. */
+    volatile uint32_t overrunFrames;          /*!< Message Buffer overruns and Rx FIFO overflows. */
+    uint64_t mbMask;                          /*!< The ORed Rx Message Buffers drained into the ring. */
+    uint32_t fifoMask;                        /*!< The Rx FIFO flags, 0 if the Rx FIFO is not drained. */
+    flexcan_rx_ring_timestamp_t getTimestamp; /*!< Timestamp function. */
+} flexcan_rx_ring_t;
+
 /*! @brief FlexCAN handle structure definition. */
 typedef struct _flexcan_handle flexcan_handle_t;
 
@@ -619,6 +676,7 @@ struct _flexcan_handle
     volatile uint8_t mbState[CAN_WORD1_COUNT];    /*!< Message Buffer transfer state. */
     volatile uint8_t rxFifoState;                 /*!< Rx FIFO transfer state. */
     volatile uint32_t timestamp[CAN_WORD1_COUNT]; /*!< Mailbox transfer timestamp. */
+    flexcan_rx_ring_t *volatile rxRing;           /*!< Receive ring, NULL if not started. */
 };
 
 /******************************************************************************
@@ -1589,6 +1647,80 @@ void FLEXCAN_TransferAbortReceive(CAN_Type *base, flexcan_handle_t *handle, uint
  */
 void FLEXCAN_TransferAbortReceiveFifo(CAN_Type *base, flexcan_handle_t *handle);
 
+/*!
+ * @brief Starts receiving into a ring.
+ *
+ * The Rx Message Buffers must be configured with FLEXCAN_SetRxMbConfig() or FLEXCAN_SetFDRxMbConfig(), and the
+ * Rx FIFO with FLEXCAN_SetRxFifoConfig(). They stay active: the IRQ handler reads the interrupt flags once,
+ * reads all the ready Message Buffers and Rx FIFO frames into the ring with one software timestamp, and then
+ * calls the callback once with kStatus_FLEXCAN_RxRingReady and the number of the new entries as result.
+ * The frames read while the ring is full are dropped and counted. The callback is not called with
+ * kStatus_FLEXCAN_UnHandled for the interrupts which the ring handled.
+ *
+ * The application reads the entries with FLEXCAN_RxRingPeek() and FLEXCAN_RxRingRelease().
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ * @param ring The ring, used until FLEXCAN_TransferStopRxRing().
+ * @param config The ring configuration.
+ * @retval kStatus_Success            - The ring is receiving.
+ * @retval kStatus_InvalidArgument    - The number of entries is not a power of 2.
+ * @retval kStatus_FLEXCAN_RxBusy     - A Message Buffer is in use.
+ * @retval kStatus_FLEXCAN_RxFifoBusy - The Rx FIFO is in use.
+ */
+status_t FLEXCAN_TransferStartRxRing(CAN_Type *base,
+                                     flexcan_handle_t *handle,
+                                     flexcan_rx_ring_t *ring,
+                                     const flexcan_rx_ring_config_t *config);
+
+/*!
+ * @brief Stops receiving into the ring.
+ *
+ * The Message Buffers and the Rx FIFO of the ring are idle again, the entries not read stay in the ring.
+ *
+ * @param base FlexCAN peripheral base address.
+ * @param handle FlexCAN handle pointer.
+ */
+void FLEXCAN_TransferStopRxRing(CAN_Type *base, flexcan_handle_t *handle);
+
+/*!
+ * @brief Gets the number of entries in the receive ring.
+ *
+ * @param ring The ring.
+ * @return The number of entries not read.
+ */
+static inline uint32_t FLEXCAN_RxRingGetCount(const flexcan_rx_ring_t *ring)
+{
+    return ring->head - ring->tail;
+}
+
+/*!
+ * @brief Gets the oldest entry of the receive ring, which stays in the ring until FLEXCAN_RxRingRelease().
+ *
+ * @param ring The ring.
+ * @return The entry, NULL if the ring is empty.
+ */
+static inline const flexcan_rx_ring_entry_t *FLEXCAN_RxRingPeek(const flexcan_rx_ring_t *ring)
+{
+    uint32_t tail = ring->tail;
+
+    return (ring->head != tail) ? &ring->entries[tail & ring->indexMask] : NULL;
+}
+
+/*!
+ * @brief Releases the oldest entry of the receive ring.
+ *
+ * @param ring The ring, not empty.
+ */
+static inline void FLEXCAN_RxRingRelease(flexcan_rx_ring_t *ring)
+{
+    assert(ring->head != ring->tail);
+
+    /* The entry is read before the interrupt can write it again. */
+    __DMB();
+    ring->tail++;
+}
+
 /*!
  * @brief FlexCAN IRQ handle function.
  *
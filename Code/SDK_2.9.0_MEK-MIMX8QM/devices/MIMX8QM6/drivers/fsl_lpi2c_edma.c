@@ -22,6 +22,9 @@
 /* @brief Mask to align an address to 32 bytes. */
 #define ALIGN_32_MASK (0x1fU)
 
+/* @brief Maximum number of bytes received by one receive command. */
+#define LPI2C_RX_CMD_MAX_BYTES (256U)
+
 /* ! @brief LPI2C master fifo commands. */
 enum _lpi2c_master_fifo_cmd
 {
@@ -51,6 +54,13 @@ typedef void (*lpi2c_isr_t)(LPI2C_Type *base, void *handle);
 
 static uint32_t LPI2C_GenerateCommands(lpi2c_master_edma_handle_t *handle);
 
+static status_t LPI2C_EncodeCommandList(lpi2c_master_edma_cmd_list_t *list,
+                                        lpi2c_master_transfer_t *xfer,
+                                        uint32_t *cmdCount,
+                                        uint32_t *readCount);
+
+static void LPI2C_LinkCommandListReads(LPI2C_Type *base, lpi2c_master_edma_cmd_list_t *list);
+
 static void LPI2C_MasterEDMACallback(edma_handle_t *dmaHandle, void *userData, bool isTransferDone, uint32_t tcds);
 
 /*******************************************************************************
@@ -446,11 +456,336 @@ status_t LPI2C_MasterTransferAbortEDMA(LPI2C_Type *base, lpi2c_master_edma_handl
     base->MTDR = (uint32_t)kStopCmd;
 
     /* Reset handle. */
-    handle->isBusy = false;
+    handle->isBusy       = false;
+    handle->listChannels = 0U;
+
+    return kStatus_Success;
+}
+
+/*!
+ * @brief Encodes the command words of a transfer at the end of a command list.
+ * @param list Command list.
+ * @param xfer Transfer descriptor.
+ * @param[in,out] cmdCount Number of command words in the list.
+ * @param[in,out] readCount Number of read transfers in the list.
+ * @retval kStatus_Success The transfer was encoded.
+ * @retval kStatus_InvalidArgument The transfer does not fit in the list.
+ */
+static status_t LPI2C_EncodeCommandList(lpi2c_master_edma_cmd_list_t *list,
+                                        lpi2c_master_transfer_t *xfer,
+                                        uint32_t *cmdCount,
+                                        uint32_t *readCount)
+{
+    uint16_t *cmd       = &list->commandBuffer[*cmdCount];
+    bool hasStart       = (xfer->flags & (uint32_t)kLPI2C_TransferNoStartFlag) == 0U;
+    bool hasStop        = (xfer->flags & (uint32_t)kLPI2C_TransferNoStopFlag) == 0U;
+    bool hasReceiveData = (xfer->direction == kLPI2C_Read) && (xfer->dataSize != 0U);
+    uint8_t *data       = (uint8_t *)xfer->data;
+    uint32_t maxCount   = DMA_TCD_CITER_ELINKNO_CITER_MASK >> DMA_TCD_CITER_ELINKNO_CITER_SHIFT;
+    uint32_t wordCount  = 0U;
+    size_t remaining    = xfer->dataSize;
+    uint32_t i;
+
+    /*
+     * Initial direction depends on whether a subaddress was provided, and of course the actual
+     * data transfer direction.
+     */
+    lpi2c_direction_t direction = (xfer->subaddressSize != 0U) ? kLPI2C_Write : xfer->direction;
+
+    /* Count the command words first, so that the list is left unchanged if they do not fit. */
+    if (hasStart)
+    {
+        wordCount += 1U + xfer->subaddressSize;
+    }
+    if (hasReceiveData)
+    {
+        if (hasStart && (direction == kLPI2C_Write))
+        {
+            wordCount++;
+        }
+        wordCount += (uint32_t)((xfer->dataSize + LPI2C_RX_CMD_MAX_BYTES - 1U) / LPI2C_RX_CMD_MAX_BYTES);
+    }
+    else if (xfer->direction == kLPI2C_Write)
+    {
+        wordCount += (uint32_t)xfer->dataSize;
+    }
+    else
+    {
+        /* No data to receive */
+    }
+    if (hasStop)
+    {
+        wordCount++;
+    }
+
+    if (((*cmdCount + wordCount) > LPI2C_EDMA_CMD_LIST_SIZE) ||
+        (hasReceiveData && ((*readCount >= LPI2C_EDMA_CMD_LIST_READS) || (xfer->dataSize > maxCount))))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    if (hasStart)
+    {
+        /* Start command. */
+        *cmd++ = (uint16_t)kStartCmd | (uint16_t)((uint16_t)((uint16_t)xfer->slaveAddress << 1U) | (uint16_t)direction);
+
+        /* Subaddress, MSB first. */
+        uint32_t subaddressRemaining = xfer->subaddressSize;
+        while (0U != subaddressRemaining--)
+        {
+            uint8_t subaddressByte = (uint8_t)(xfer->subaddress >> (8U * subaddressRemaining)) & 0xffU;
+            *cmd++                 = subaddressByte;
+        }
+    }
+
+    if (hasReceiveData)
+    {
+        /* Need to send repeated start if switching directions to read. */
+        if (hasStart && (direction == kLPI2C_Write))
+        {
+            *cmd++ = (uint16_t)kStartCmd |
+                     (uint16_t)((uint16_t)((uint16_t)xfer->slaveAddress << 1U) | (uint16_t)kLPI2C_Read);
+        }
+
+        /* Read commands, each one receives up to 256 bytes. */
+        while (remaining > LPI2C_RX_CMD_MAX_BYTES)
+        {
+            *cmd++ = (uint16_t)kRxDataCmd | (uint16_t)LPI2C_MTDR_DATA(LPI2C_RX_CMD_MAX_BYTES - 1U);
+            remaining -= LPI2C_RX_CMD_MAX_BYTES;
+        }
+        *cmd++ = (uint16_t)kRxDataCmd | (uint16_t)LPI2C_MTDR_DATA(remaining - 1U);
+
+        list->readData[*readCount] = data;
+        list->readSize[*readCount] = xfer->dataSize;
+        (*readCount)++;
+    }
+    else if (xfer->direction == kLPI2C_Write)
+    {
+        /* Transmit data commands carry the data byte. */
+        for (i = 0U; i < xfer->dataSize; i++)
+        {
+            *cmd++ = (uint16_t)kTxDataCmd | (uint16_t)data[i];
+        }
+    }
+    else
+    {
+        /* No data to receive */
+    }
+
+    if (hasStop)
+    {
+        *cmd++ = (uint16_t)kStopCmd;
+    }
+
+    *cmdCount += wordCount;
 
     return kStatus_Success;
 }
 
+/*!
+ * @brief Builds the receive TCD chain of a command list, the last TCD raises the major interrupt.
+ * @param base The LPI2C peripheral base address.
+ * @param list Command list.
+ */
+static void LPI2C_LinkCommandListReads(LPI2C_Type *base, lpi2c_master_edma_cmd_list_t *list)
+{
+    /* Get a 32-byte aligned TCD pointer. */
+    edma_tcd_t *tcd = (edma_tcd_t *)((uint32_t)(&list->tcds[1]) & (~ALIGN_32_MASK));
+    edma_transfer_config_t transferConfig;
+    uint32_t i;
+
+    for (i = 0U; i < list->readCount; i++)
+    {
+        transferConfig.srcAddr          = (uint32_t)LPI2C_MasterGetRxFifoAddress(base);
+        transferConfig.destAddr         = (uint32_t)list->readData[i];
+        transferConfig.srcTransferSize  = kEDMA_TransferSize1Bytes;
+        transferConfig.destTransferSize = kEDMA_TransferSize1Bytes;
+        transferConfig.srcOffset        = 0;
+        transferConfig.destOffset       = (int16_t)sizeof(uint8_t);
+        transferConfig.minorLoopBytes   = sizeof(uint8_t);
+        transferConfig.majorLoopCounts  = list->readSize[i];
+
+        EDMA_TcdReset(&tcd[i]);
+        if ((i + 1U) < list->readCount)
+        {
+            EDMA_TcdSetTransferConfig(&tcd[i], &transferConfig, &tcd[i + 1U]);
+        }
+        else
+        {
+            EDMA_TcdSetTransferConfig(&tcd[i], &transferConfig, NULL);
+            EDMA_TcdEnableInterrupts(&tcd[i], (uint32_t)kEDMA_MajorInterruptEnable);
+        }
+    }
+}
+
+/*!
+ * brief Encodes a sequence of transfers into a command list.
+ *
+ * The transfers are the same descriptors as for LPI2C_MasterTransferBlocking(), and may address different slaves.
+ * The data of the write transfers is copied into the command words, so the list must be created again when it
+ * changes. The receive buffers of the read transfers are used each time the list runs.
+ *
+ * param base The LPI2C peripheral base address.
+ * param[out] list Pointer to the command list.
+ * param transfers Array of transfer descriptors.
+ * param transferNum Number of transfers.
+ * retval #kStatus_Success The list was created successfully.
+ * retval #kStatus_InvalidArgument The transfers do not fit in LPI2C_EDMA_CMD_LIST_SIZE command words or
+ *      LPI2C_EDMA_CMD_LIST_READS read transfers.
+ */
+status_t LPI2C_MasterCreateCommandListEDMA(LPI2C_Type *base,
+                                           lpi2c_master_edma_cmd_list_t *list,
+                                           lpi2c_master_transfer_t *transfers,
+                                           uint32_t transferNum)
+{
+    assert(list);
+
+    list->commandCount = 0U;
+    list->readCount    = 0U;
+
+    return LPI2C_MasterAppendCommandListEDMA(base, list, transfers, transferNum);
+}
+
+/*!
+ * brief Appends transfers at the end of a command list.
+ *
+ * param base The LPI2C peripheral base address.
+ * param list Pointer to the command list, created by LPI2C_MasterCreateCommandListEDMA().
+ * param transfers Array of transfer descriptors.
+ * param transferNum Number of transfers.
+ * retval #kStatus_Success The transfers were appended successfully.
+ * retval #kStatus_InvalidArgument The transfers do not fit in the list. The list is left unchanged.
+ */
+status_t LPI2C_MasterAppendCommandListEDMA(LPI2C_Type *base,
+                                           lpi2c_master_edma_cmd_list_t *list,
+                                           lpi2c_master_transfer_t *transfers,
+                                           uint32_t transferNum)
+{
+    assert(list);
+    assert((transfers != NULL) || (transferNum == 0U));
+
+    uint32_t cmdCount  = list->commandCount;
+    uint32_t readCount = list->readCount;
+    status_t result    = kStatus_Success;
+    uint32_t i;
+
+    for (i = 0U; i < transferNum; i++)
+    {
+        assert(transfers[i].subaddressSize <= sizeof(transfers[i].subaddress));
+
+        result = LPI2C_EncodeCommandList(list, &transfers[i], &cmdCount, &readCount);
+        if (result != kStatus_Success)
+        {
+            return result;
+        }
+    }
+
+    list->commandCount = cmdCount;
+    list->readCount    = readCount;
+    LPI2C_LinkCommandListReads(base, list);
+
+    return result;
+}
+
+/*!
+ * brief Performs a non-blocking DMA-based run of a command list on the I2C bus.
+ *
+ * All the transfers of the list run back to back, with no CPU intervention between them. The callback specified
+ * when the a handle was created is invoked once, when both the command words are sent and the data of all the
+ * read transfers is received. The STOP conditions are part of the list.
+ *
+ * note Requires separate LPI2C receive and transmit DMA requests. If a slave does not acknowledge, the LPI2C
+ *      master stops processing the commands and the list does not complete: call LPI2C_MasterTransferAbortEDMA().
+ *
+ * param base The LPI2C peripheral base address.
+ * param handle Pointer to the LPI2C master driver handle.
+ * param list Pointer to the command list.
+ * retval #kStatus_Success The list was started successfully.
+ * retval #kStatus_InvalidArgument The list is empty, or the device shares the receive and transmit DMA requests.
+ * retval #kStatus_LPI2C_Busy Either another master is currently utilizing the bus, or another DMA
+ *      transaction is already in progress.
+ */
+status_t LPI2C_MasterTransferCommandListEDMA(LPI2C_Type *base,
+                                             lpi2c_master_edma_handle_t *handle,
+                                             lpi2c_master_edma_cmd_list_t *list)
+{
+    status_t result;
+
+    assert(handle);
+    assert(list);
+
+    /* The commands and the received data run on their own channels. */
+    if ((0U == list->commandCount) || (0 == FSL_FEATURE_LPI2C_HAS_SEPARATE_DMA_RX_TX_REQn(base)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Return busy if another transaction is in progress. */
+    if (handle->isBusy)
+    {
+        return kStatus_LPI2C_Busy;
+    }
+
+    /* Return an error if the bus is already in use not by us. */
+    result = LPI2C_CheckForBusyBus(base);
+    if (result != kStatus_Success)
+    {
+        return result;
+    }
+
+    /* We're now busy. */
+    handle->isBusy = true;
+
+    /* Disable LPI2C IRQ and DMA sources while we configure stuff. */
+    LPI2C_MasterDisableInterrupts(base, (uint32_t)kLPI2C_MasterIrqFlags);
+    LPI2C_MasterEnableDMA(base, false, false);
+
+    /* Clear all flags. */
+    LPI2C_MasterClearStatusFlags(base, (uint32_t)kLPI2C_MasterClearFlags);
+
+    /* The list carries its own STOP conditions, and has no byte count. */
+    (void)memset(&handle->transfer, 0, sizeof(handle->transfer));
+    handle->transfer.flags = (uint32_t)kLPI2C_TransferNoStopFlag;
+    handle->listChannels   = (list->readCount != 0U) ? 2U : 1U;
+
+    /* Reset DMA channels. */
+    EDMA_ResetChannel(handle->rx->base, handle->rx->channel);
+    EDMA_ResetChannel(handle->tx->base, handle->tx->channel);
+
+    /* Set up data receive. */
+    if (list->readCount != 0U)
+    {
+        EDMA_InstallTCD(handle->rx->base, handle->rx->channel,
+                        (edma_tcd_t *)((uint32_t)(&list->tcds[1]) & (~ALIGN_32_MASK)));
+    }
+
+    /* Set up commands transfer. */
+    edma_transfer_config_t transferConfig;
+    transferConfig.srcAddr          = (uint32_t)list->commandBuffer;
+    transferConfig.destAddr         = (uint32_t)LPI2C_MasterGetTxFifoAddress(base);
+    transferConfig.srcTransferSize  = kEDMA_TransferSize2Bytes;
+    transferConfig.destTransferSize = kEDMA_TransferSize2Bytes;
+    transferConfig.srcOffset        = (int16_t)sizeof(uint16_t);
+    transferConfig.destOffset       = 0;
+    transferConfig.minorLoopBytes   = sizeof(uint16_t);
+    transferConfig.majorLoopCounts  = list->commandCount;
+
+    EDMA_SetTransferConfig(handle->tx->base, handle->tx->channel, &transferConfig, NULL);
+    EDMA_EnableChannelInterrupts(handle->tx->base, handle->tx->channel, (uint32_t)kEDMA_MajorInterruptEnable);
+
+    /* Start DMA transfer. */
+    if (list->readCount != 0U)
+    {
+        EDMA_StartTransfer(handle->rx);
+    }
+    EDMA_StartTransfer(handle->tx);
+
+    /* Enable DMA in both directions. This actually kicks of the transfer. */
+    LPI2C_MasterEnableDMA(base, true, true);
+
+    return result;
+}
+
 /*!
  * @brief DMA completion callback.
  * @param dmaHandle DMA channel handle for the channel that completed.
@@ -462,12 +797,28 @@ status_t LPI2C_MasterTransferAbortEDMA(LPI2C_Type *base, lpi2c_master_edma_handl
 static void LPI2C_MasterEDMACallback(edma_handle_t *dmaHandle, void *userData, bool isTransferDone, uint32_t tcds)
 {
     lpi2c_master_edma_handle_t *handle = (lpi2c_master_edma_handle_t *)userData;
+    uint32_t regPrimask;
+    bool listPending = false;
 
     if (NULL == handle)
     {
         return;
     }
 
+    /* A command list is done when both its channels are. The interrupts of the two channels may have different
+     * priorities, so the count is updated with the interrupts masked. */
+    regPrimask = DisableGlobalIRQ();
+    if (handle->listChannels != 0U)
+    {
+        handle->listChannels--;
+        listPending = (handle->listChannels != 0U);
+    }
+    EnableGlobalIRQ(regPrimask);
+    if (listPending)
+    {
+        return;
+    }
+
     /* Check for errors. */
     status_t result = LPI2C_MasterCheckAndClearError(handle->base, LPI2C_MasterGetStatusFlags(handle->base));
 
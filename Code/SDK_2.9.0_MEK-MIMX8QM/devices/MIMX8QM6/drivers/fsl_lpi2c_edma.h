@@ -18,9 +18,19 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief LPI2C EDMA driver version. */
-#define FSL_LPI2C_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 0))
+#define FSL_LPI2C_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 3, 0))
 /*@}*/
 
+/*! @brief Maximum number of LPI2C command words in a command list. */
+#ifndef LPI2C_EDMA_CMD_LIST_SIZE
+#define LPI2C_EDMA_CMD_LIST_SIZE (64U)
+#endif
+
+/*! @brief Maximum number of read transfers in a command list. */
+#ifndef LPI2C_EDMA_CMD_LIST_READS
+#define LPI2C_EDMA_CMD_LIST_READS (8U)
+#endif
+
 /*!
  * @addtogroup lpi2c_master_edma_driver
  * @{
@@ -54,6 +64,7 @@ struct _lpi2c_master_edma_handle
     LPI2C_Type *base;                 /*!< LPI2C base pointer. */
     bool isBusy;                      /*!< Transfer state machine current state. */
     uint8_t nbytes;                   /*!< eDMA minor byte transfer count initially configured. */
+    volatile uint8_t listChannels;    /*!< DMA channels of the running command list not yet complete. */
     uint16_t commandBuffer[7];        /*!< LPI2C command sequence. */
     lpi2c_master_transfer_t transfer; /*!< Copy of the current transfer info. */
     lpi2c_master_edma_transfer_callback_t completionCallback; /*!< Callback function pointer. */
@@ -63,6 +74,24 @@ struct _lpi2c_master_edma_handle
     edma_tcd_t tcds[3]; /*!< Software TCD. Three are allocated to provide enough room to align to 32-bytes. */
 };
 
+/*!
+ * @brief LPI2C master command list, a sequence of transfers encoded into MTDR command words.
+ *
+ * The transmit DMA channel feeds all the command words of the list to the master transmit FIFO, including the
+ * START, STOP and transmit data of each transfer. The receive DMA channel runs a chain of software TCDs, one for each
+ * read transfer.
+ * @note The contents of this structure are private and subject to change.
+ */
+typedef struct _lpi2c_master_edma_cmd_list
+{
+    uint32_t commandCount;                            /*!< Number of command words. */
+    uint32_t readCount;                               /*!< Number of read transfers. */
+    uint16_t commandBuffer[LPI2C_EDMA_CMD_LIST_SIZE]; /*!< LPI2C command sequence. */
+    uint8_t *readData[LPI2C_EDMA_CMD_LIST_READS];     /*!< Receive buffer of each read transfer. */
+    size_t readSize[LPI2C_EDMA_CMD_LIST_READS];       /*!< Bytes of each read transfer. */
+    edma_tcd_t tcds[LPI2C_EDMA_CMD_LIST_READS + 1U];  /*!< Receive TCD chain, one more to align to 32-bytes. */
+} lpi2c_master_edma_cmd_list_t;
+
 /*! @} */
 
 /*******************************************************************************
@@ -148,6 +177,68 @@ status_t LPI2C_MasterTransferAbortEDMA(LPI2C_Type *base, lpi2c_master_edma_handl
 
 /*@}*/
 
+/*! @name Master DMA command list */
+/*@{*/
+
+/*!
+ * @brief Encodes a sequence of transfers into a command list.
+ *
+ * The transfers are the same descriptors as for LPI2C_MasterTransferBlocking(), and may address different slaves.
+ * The data of the write transfers is copied into the command words, so the list must be created again when it
+ * changes. The receive buffers of the read transfers are used each time the list runs.
+ *
+ * @param base The LPI2C peripheral base address.
+ * @param[out] list Pointer to the command list.
+ * @param transfers Array of transfer descriptors.
+ * @param transferNum Number of transfers.
+ * @retval kStatus_Success The list was created successfully.
+ * @retval kStatus_InvalidArgument The transfers do not fit in LPI2C_EDMA_CMD_LIST_SIZE command words or
+ *      LPI2C_EDMA_CMD_LIST_READS read transfers.
+ */
+status_t LPI2C_MasterCreateCommandListEDMA(LPI2C_Type *base,
+                                           lpi2c_master_edma_cmd_list_t *list,
+                                           lpi2c_master_transfer_t *transfers,
+                                           uint32_t transferNum);
+
+/*!
+ * @brief Appends transfers at the end of a command list.
+ *
+ * @param base The LPI2C peripheral base address.
+ * @param list Pointer to the command list, created by LPI2C_MasterCreateCommandListEDMA().
+ * @param transfers Array of transfer descriptors.
+ * @param transferNum Number of transfers.
+ * @retval kStatus_Success The transfers were appended successfully.
+ * @retval kStatus_InvalidArgument The transfers do not fit in the list. The list is left unchanged.
+ */
+status_t LPI2C_MasterAppendCommandListEDMA(LPI2C_Type *base,
+                                           lpi2c_master_edma_cmd_list_t *list,
+                                           lpi2c_master_transfer_t *transfers,
+                                           uint32_t transferNum);
+
+/*!
+ * @brief Performs a non-blocking DMA-based run of a command list on the I2C bus.
+ *
+ * All the transfers of the list run back to back, with no CPU intervention between them. The callback specified
+ * when the @a handle was created is invoked once, when both the command words are sent and the data of all the
+ * read transfers is received. The STOP conditions are part of the list.
+ *
+ * @note Requires separate LPI2C receive and transmit DMA requests. If a slave does not acknowledge, the LPI2C
+ *      master stops processing the commands and the list does not complete: call LPI2C_MasterTransferAbortEDMA().
+ *
+ * @param base The LPI2C peripheral base address.
+ * @param handle Pointer to the LPI2C master driver handle.
+ * @param list Pointer to the command list.
+ * @retval kStatus_Success The list was started successfully.
+ * @retval kStatus_InvalidArgument The list is empty, or the device shares the receive and transmit DMA requests.
+ * @retval #kStatus_LPI2C_Busy Either another master is currently utilizing the bus, or another DMA
+ *      transaction is already in progress.
+ */
+status_t LPI2C_MasterTransferCommandListEDMA(LPI2C_Type *base,
+                                             lpi2c_master_edma_handle_t *handle,
+                                             lpi2c_master_edma_cmd_list_t *list);
+
+/*@}*/
+
 /*! @} */
 
 #if defined(__cplusplus)
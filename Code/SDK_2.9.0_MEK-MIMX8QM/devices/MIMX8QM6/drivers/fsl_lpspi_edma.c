@@ -656,6 +656,298 @@ status_t LPSPI_MasterTransferGetCountEDMA(LPSPI_Type *base, lpspi_master_edma_ha
     return kStatus_Success;
 }
 
+/*!
+ * brief Compiles a list of LPSPI master transfers into an eDMA batch.
+ *
+ * Each transfer keeps its own PCS, kLPSPI_MasterPcsContinuous and kLPSPI_MasterByteSwap flags, which are written to
+ * the TCR by the eDMA before the data of the transfer. The other TCR settings, such as the frame size, clock polarity
+ * and prescaler, are taken from the TCR when the batch is compiled, and the TCR is set back to them at the end of
+ * the batch. The batch can be sent any number of times with LPSPI_MasterTransferBatchEDMA() while its buffers
+ * stay valid.
+ *
+ * Note:
+ * The frame size should be 1, 2 or 4 bytes, and the data size of each transfer an integer multiple of it. The
+ * 3-wire modes are not supported.
+ *
+ * param base LPSPI peripheral base address.
+ * param batch pointer to lpspi_master_edma_batch_t structure to compile the transfers into.
+ * param transfers pointer to the array of lpspi_transfer_t structures.
+ * param transferNum Number of transfers, from 1 to LPSPI_EDMA_BATCH_SIZE.
+ * return status of status_t.
+ */
+status_t LPSPI_MasterTransferCreateBatchEDMA(LPSPI_Type *base,
+                                             lpspi_master_edma_batch_t *batch,
+                                             lpspi_transfer_t *transfers,
+                                             uint32_t transferNum)
+{
+    assert(batch);
+    assert(transfers);
+
+    uint32_t bitsPerFrame  = ((base->TCR & LPSPI_TCR_FRAMESZ_MASK) >> LPSPI_TCR_FRAMESZ_SHIFT) + 1U;
+    uint32_t bytesPerFrame = (bitsPerFrame + 7U) / 8U;
+    uint32_t instance      = LPSPI_GetInstance(base);
+    uint32_t rxAddr        = LPSPI_GetRxRegisterAddress(base);
+    uint32_t txAddr        = LPSPI_GetTxRegisterAddress(base);
+    uint8_t dummyData      = g_lpspiDummyData[instance];
+    uint32_t temp          = 0U;
+    uint32_t whichPcs;
+    uint32_t frameCount;
+    bool isByteSwap;
+    bool isPcsContinuous;
+    uint32_t i;
+
+    /*Used for byte swap*/
+    uint32_t dif = 0;
+
+    edma_transfer_size_t transferSize;
+    edma_transfer_config_t transferConfigRx;
+    edma_transfer_config_t transferConfigTx;
+
+    edma_tcd_t *softwareTCD = (edma_tcd_t *)((uint32_t)(&batch->lpspiSoftwareTCD[1]) & (~0x1FU));
+    edma_tcd_t *softwareTCD_tx;
+    edma_tcd_t *softwareTCD_rx;
+
+    if ((transferNum == 0U) || (transferNum > LPSPI_EDMA_BATCH_SIZE))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* The dma transfer can not support 3 bytes, and the frames over 4 bytes need extra TCDs for the last bytes. */
+    switch (bytesPerFrame)
+    {
+        case (1U):
+            transferSize = kEDMA_TransferSize1Bytes;
+            break;
+
+        case (2U):
+            transferSize = kEDMA_TransferSize2Bytes;
+            break;
+
+        case (4U):
+            transferSize = kEDMA_TransferSize4Bytes;
+            break;
+
+        default:
+            return kStatus_InvalidArgument;
+    }
+
+    /* The 3-wire mode can't send and receive data at the same time. */
+    temp = base->CFGR1;
+    temp &= LPSPI_CFGR1_PINCFG_MASK;
+    if ((temp == LPSPI_CFGR1_PINCFG(kLPSPI_SdiInSdiOut)) || (temp == LPSPI_CFGR1_PINCFG(kLPSPI_SdoInSdoOut)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* The Tx chain is a command and a data TCD per transfer and the ending command, the Rx chain follows it. */
+    softwareTCD_tx = &softwareTCD[0];
+    softwareTCD_rx = &softwareTCD[(2U * transferNum) + 1U];
+
+    batch->transferNum    = transferNum;
+    batch->totalByteCount = 0U;
+    batch->txBuffIfNull =
+        ((uint32_t)dummyData) | ((uint32_t)dummyData << 8) | ((uint32_t)dummyData << 16) | ((uint32_t)dummyData << 24);
+
+    for (i = 0U; i < transferNum; i++)
+    {
+        if (!LPSPI_CheckTransferArgument(&transfers[i], bitsPerFrame, bytesPerFrame))
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        frameCount = transfers[i].dataSize / bytesPerFrame;
+        if (frameCount > (DMA_TCD_CITER_ELINKNO_CITER_MASK >> DMA_TCD_CITER_ELINKNO_CITER_SHIFT))
+        {
+            return kStatus_InvalidArgument;
+        }
+
+        whichPcs        = (transfers[i].configFlags & LPSPI_MASTER_PCS_MASK) >> LPSPI_MASTER_PCS_SHIFT;
+        isPcsContinuous = ((transfers[i].configFlags & (uint32_t)kLPSPI_MasterPcsContinuous) != 0U);
+        isByteSwap      = ((transfers[i].configFlags & (uint32_t)kLPSPI_MasterByteSwap) != 0U);
+
+        /* A command word with CONTC cleared starts a new frame, which also ends a continuous previous transfer. */
+        batch->transmitCommand[i] =
+            (base->TCR & ~(LPSPI_TCR_CONT_MASK | LPSPI_TCR_CONTC_MASK | LPSPI_TCR_BYSW_MASK | LPSPI_TCR_PCS_MASK)) |
+            LPSPI_TCR_CONT(isPcsContinuous) | LPSPI_TCR_CONTC(0U) | LPSPI_TCR_BYSW(isByteSwap) |
+            LPSPI_TCR_PCS(whichPcs);
+        batch->totalByteCount += transfers[i].dataSize;
+
+        dif = 0U;
+        if (isByteSwap)
+        {
+            dif = 4U - bytesPerFrame;
+        }
+
+        /*Tx command word*/
+        transferConfigTx.srcAddr   = (uint32_t) & (batch->transmitCommand[i]);
+        transferConfigTx.srcOffset = 0;
+
+        transferConfigTx.destAddr   = (uint32_t) & (base->TCR);
+        transferConfigTx.destOffset = 0;
+
+        transferConfigTx.srcTransferSize  = kEDMA_TransferSize4Bytes;
+        transferConfigTx.destTransferSize = kEDMA_TransferSize4Bytes;
+        transferConfigTx.minorLoopBytes   = 4;
+        transferConfigTx.majorLoopCounts  = 1;
+
+        EDMA_TcdReset(&softwareTCD_tx[2U * i]);
+        EDMA_TcdSetTransferConfig(&softwareTCD_tx[2U * i], &transferConfigTx, &softwareTCD_tx[(2U * i) + 1U]);
+
+        /*Tx data*/
+        if (transfers[i].txData != NULL)
+        {
+            transferConfigTx.srcAddr   = (uint32_t)(transfers[i].txData);
+            transferConfigTx.srcOffset = 1;
+        }
+        else
+        {
+            transferConfigTx.srcAddr   = (uint32_t)(&batch->txBuffIfNull);
+            transferConfigTx.srcOffset = 0;
+        }
+
+        transferConfigTx.destAddr   = txAddr + dif;
+        transferConfigTx.destOffset = 0;
+
+        transferConfigTx.srcTransferSize  = kEDMA_TransferSize1Bytes;
+        transferConfigTx.destTransferSize = transferSize;
+        transferConfigTx.minorLoopBytes   = bytesPerFrame;
+        transferConfigTx.majorLoopCounts  = frameCount;
+
+        EDMA_TcdReset(&softwareTCD_tx[(2U * i) + 1U]);
+        EDMA_TcdSetTransferConfig(&softwareTCD_tx[(2U * i) + 1U], &transferConfigTx, &softwareTCD_tx[(2U * i) + 2U]);
+
+        /*Rx data*/
+        if (transfers[i].rxData != NULL)
+        {
+            transferConfigRx.destAddr   = (uint32_t)(transfers[i].rxData);
+            transferConfigRx.destOffset = 1;
+        }
+        else
+        {
+            transferConfigRx.destAddr   = (uint32_t)(&batch->rxBuffIfNull);
+            transferConfigRx.destOffset = 0;
+        }
+
+        transferConfigRx.srcAddr   = rxAddr + dif;
+        transferConfigRx.srcOffset = 0;
+
+        transferConfigRx.srcTransferSize  = transferSize;
+        transferConfigRx.destTransferSize = kEDMA_TransferSize1Bytes;
+        transferConfigRx.minorLoopBytes   = bytesPerFrame;
+        transferConfigRx.majorLoopCounts  = frameCount;
+
+        EDMA_TcdReset(&softwareTCD_rx[i]);
+        if ((i + 1U) < transferNum)
+        {
+            EDMA_TcdSetTransferConfig(&softwareTCD_rx[i], &transferConfigRx, &softwareTCD_rx[i + 1U]);
+        }
+        else
+        {
+            /* Only the end of the batch interrupts the CPU. */
+            EDMA_TcdSetTransferConfig(&softwareTCD_rx[i], &transferConfigRx, NULL);
+            EDMA_TcdEnableInterrupts(&softwareTCD_rx[i], (uint32_t)kEDMA_MajorInterruptEnable);
+        }
+    }
+
+    /*Tx ending command word, releases the PCS and sets the TCR back*/
+    batch->transmitCommand[transferNum] = base->TCR & ~(LPSPI_TCR_CONTC_MASK | LPSPI_TCR_CONT_MASK);
+
+    transferConfigTx.srcAddr   = (uint32_t) & (batch->transmitCommand[transferNum]);
+    transferConfigTx.srcOffset = 0;
+
+    transferConfigTx.destAddr   = (uint32_t) & (base->TCR);
+    transferConfigTx.destOffset = 0;
+
+    transferConfigTx.srcTransferSize  = kEDMA_TransferSize4Bytes;
+    transferConfigTx.destTransferSize = kEDMA_TransferSize4Bytes;
+    transferConfigTx.minorLoopBytes   = 4;
+    transferConfigTx.majorLoopCounts  = 1;
+
+    EDMA_TcdReset(&softwareTCD_tx[2U * transferNum]);
+    EDMA_TcdSetTransferConfig(&softwareTCD_tx[2U * transferNum], &transferConfigTx, NULL);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief LPSPI master sends a batch of transfers using eDMA.
+ *
+ * This function starts the two TCD chains of the batch. This is a non-blocking function, which returns right away.
+ * The eDMA moves the command words and the data of all the transfers without the CPU, and the callback function is
+ * called once, when all the data of the batch is received. LPSPI_MasterTransferGetCountEDMA() does not count the
+ * bytes of a batch.
+ *
+ * param base LPSPI peripheral base address.
+ * param handle pointer to lpspi_master_edma_handle_t structure which stores the transfer state.
+ * param batch pointer to lpspi_master_edma_batch_t structure compiled by LPSPI_MasterTransferCreateBatchEDMA().
+ * return status of status_t.
+ */
+status_t LPSPI_MasterTransferBatchEDMA(LPSPI_Type *base,
+                                       lpspi_master_edma_handle_t *handle,
+                                       lpspi_master_edma_batch_t *batch)
+{
+    assert(handle);
+    assert(batch);
+
+    uint32_t instance       = LPSPI_GetInstance(base);
+    edma_tcd_t *softwareTCD = (edma_tcd_t *)((uint32_t)(&batch->lpspiSoftwareTCD[1]) & (~0x1FU));
+
+    if (batch->transferNum == 0U)
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* Check that we're not busy.*/
+    if (handle->state == (uint8_t)kLPSPI_Busy)
+    {
+        return kStatus_LPSPI_Busy;
+    }
+
+    /*Transfers will stall when transmit FIFO is empty or receive FIFO is full. */
+    LPSPI_Enable(base, false);
+    base->CFGR1 &= (~LPSPI_CFGR1_NOSTALL_MASK);
+    LPSPI_Enable(base, true);
+
+    handle->state = (uint8_t)kLPSPI_Busy;
+
+    /* The Rx chain reads all the data, and the byte count of the handle does not follow a batch. */
+    handle->isThereExtraRxBytes = false;
+    handle->totalByteCount      = 0U;
+    handle->nbytes              = 0U;
+
+    /*The TX and RX FIFO sizes are always the same*/
+    handle->fifoSize = LPSPI_GetRxFifoSize(base);
+
+    /*Because DMA is fast enough , so set the RX and TX watermarks to 0 .*/
+    LPSPI_SetFifoWatermarks(base, 0U, 0U);
+
+    /*Flush FIFO , clear status , disable all the inerrupts.*/
+    LPSPI_FlushFifo(base, true, true);
+    LPSPI_ClearStatusFlags(base, (uint32_t)kLPSPI_AllStatusFlag);
+    LPSPI_DisableInterrupts(base, (uint32_t)kLPSPI_AllInterruptEnable);
+
+    LPSPI_DisableDMA(base, (uint32_t)kLPSPI_RxDmaEnable | (uint32_t)kLPSPI_TxDmaEnable);
+
+    EDMA_SetCallback(handle->edmaRxRegToRxDataHandle, EDMA_LpspiMasterCallback,
+                     &s_lpspiMasterEdmaPrivateHandle[instance]);
+
+    /*Rx*/
+    EDMA_ResetChannel(handle->edmaRxRegToRxDataHandle->base, handle->edmaRxRegToRxDataHandle->channel);
+    EDMA_InstallTCD(handle->edmaRxRegToRxDataHandle->base, handle->edmaRxRegToRxDataHandle->channel,
+                    &softwareTCD[(2U * batch->transferNum) + 1U]);
+
+    /*Tx*/
+    EDMA_ResetChannel(handle->edmaTxDataToTxRegHandle->base, handle->edmaTxDataToTxRegHandle->channel);
+    EDMA_InstallTCD(handle->edmaTxDataToTxRegHandle->base, handle->edmaTxDataToTxRegHandle->channel, &softwareTCD[0]);
+
+    EDMA_StartTransfer(handle->edmaTxDataToTxRegHandle);
+    EDMA_StartTransfer(handle->edmaRxRegToRxDataHandle);
+
+    LPSPI_EnableDMA(base, (uint32_t)kLPSPI_RxDmaEnable | (uint32_t)kLPSPI_TxDmaEnable);
+
+    return kStatus_Success;
+}
+
 /*!
  * brief Initializes the LPSPI slave eDMA handle.
  *
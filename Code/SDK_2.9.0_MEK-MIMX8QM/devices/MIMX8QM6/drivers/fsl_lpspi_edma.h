@@ -22,9 +22,14 @@
 /*! @name Driver version */
 /*@{*/
 /*! @brief LPSPI EDMA driver version. */
-#define FSL_LPSPI_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 1, 0))
+#define FSL_LPSPI_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 2, 0))
 /*@}*/
 
+/*! @brief Maximum number of transfers in a batch. */
+#ifndef LPSPI_EDMA_BATCH_SIZE
+#define LPSPI_EDMA_BATCH_SIZE (8U)
+#endif
+
 /*!
  * @brief Forward declaration of the _lpspi_master_edma_handle typedefs.
  */
@@ -105,6 +110,26 @@ struct _lpspi_master_edma_handle
     edma_tcd_t lpspiSoftwareTCD[3]; /*!<SoftwareTCD, internal used*/
 };
 
+/*!
+ * @brief LPSPI master eDMA batch, a list of transfers compiled into linked TCDs.
+ *
+ * The Tx TCD chain writes, for each transfer, the transmit command word to the TCR and the data to the TDR, then a
+ * last command word ending the batch. The Rx TCD chain reads the data of each transfer from the RDR. Users should not
+ * touch the content of the batch.
+ */
+typedef struct _lpspi_master_edma_batch
+{
+    uint32_t transferNum;    /*!< Number of transfers in the batch. */
+    uint32_t totalByteCount; /*!< Number of bytes of all the transfers. */
+
+    uint32_t txBuffIfNull; /*!< Sent by the transfers without txData. */
+    uint32_t rxBuffIfNull; /*!< Receives the data of the transfers without rxData. */
+
+    uint32_t transmitCommand[LPSPI_EDMA_BATCH_SIZE + 1U]; /*!< TCR command words, the last one ends the batch. */
+
+    edma_tcd_t lpspiSoftwareTCD[(3U * LPSPI_EDMA_BATCH_SIZE) + 2U]; /*!< Tx and Rx chains, plus one for alignment. */
+} lpspi_master_edma_batch_t;
+
 /*! @brief LPSPI slave eDMA transfer handle structure used for transactional API.*/
 struct _lpspi_slave_edma_handle
 {
@@ -224,6 +249,47 @@ void LPSPI_MasterTransferAbortEDMA(LPSPI_Type *base, lpspi_master_edma_handle_t
  */
 status_t LPSPI_MasterTransferGetCountEDMA(LPSPI_Type *base, lpspi_master_edma_handle_t *handle, size_t *count);
 
+/*!
+ * @brief Compiles a list of LPSPI master transfers into an eDMA batch.
+ *
+ * Each transfer keeps its own PCS, kLPSPI_MasterPcsContinuous and kLPSPI_MasterByteSwap flags, which are written to
+ * the TCR by the eDMA before the data of the transfer. The other TCR settings, such as the frame size, clock polarity
+ * and prescaler, are taken from the TCR when the batch is compiled, and the TCR is set back to them at the end of
+ * the batch. The batch can be sent any number of times with LPSPI_MasterTransferBatchEDMA() while its buffers
+ * stay valid.
+ *
+ * Note:
+ * The frame size should be 1, 2 or 4 bytes, and the data size of each transfer an integer multiple of it. The
+ * 3-wire modes are not supported.
+ *
+ * @param base LPSPI peripheral base address.
+ * @param batch pointer to lpspi_master_edma_batch_t structure to compile the transfers into.
+ * @param transfers pointer to the array of lpspi_transfer_t structures.
+ * @param transferNum Number of transfers, from 1 to LPSPI_EDMA_BATCH_SIZE.
+ * @return status of status_t.
+ */
+status_t LPSPI_MasterTransferCreateBatchEDMA(LPSPI_Type *base,
+                                             lpspi_master_edma_batch_t *batch,
+                                             lpspi_transfer_t *transfers,
+                                             uint32_t transferNum);
+
+/*!
+ * @brief LPSPI master sends a batch of transfers using eDMA.
+ *
+ * This function starts the two TCD chains of the batch. This is a non-blocking function, which returns right away.
+ * The eDMA moves the command words and the data of all the transfers without the CPU, and the callback function is
+ * called once, when all the data of the batch is received. LPSPI_MasterTransferGetCountEDMA() does not count the
+ * bytes of a batch.
+ *
+ * @param base LPSPI peripheral base address.
+ * @param handle pointer to lpspi_master_edma_handle_t structure which stores the transfer state.
+ * @param batch pointer to lpspi_master_edma_batch_t structure compiled by LPSPI_MasterTransferCreateBatchEDMA().
+ * @return status of status_t.
+ */
+status_t LPSPI_MasterTransferBatchEDMA(LPSPI_Type *base,
+                                       lpspi_master_edma_handle_t *handle,
+                                       lpspi_master_edma_batch_t *batch);
+
 /*!
  * @brief Initializes the LPSPI slave eDMA handle.
  *
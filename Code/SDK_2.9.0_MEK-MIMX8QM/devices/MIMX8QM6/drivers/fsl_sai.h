@@ -22,7 +22,7 @@
 
 /*! @name Driver version */
 /*@{*/
-#define FSL_SAI_DRIVER_VERSION (MAKE_VERSION(2, 3, 2)) /*!< Version 2.3.2 */
+#define FSL_SAI_DRIVER_VERSION (MAKE_VERSION(2, 3, 3)) /*!< Version 2.3.3 */
 /*@}*/
 
 /*! @brief _sai_status_t, SAI return status.*/
@@ -34,7 +34,9 @@ enum
     kStatus_SAI_RxError   = MAKE_STATUS(kStatusGroup_SAI, 3), /*!< SAI Rx FIFO error. */
     kStatus_SAI_QueueFull = MAKE_STATUS(kStatusGroup_SAI, 4), /*!< SAI transfer queue is full. */
     kStatus_SAI_TxIdle    = MAKE_STATUS(kStatusGroup_SAI, 5), /*!< SAI Tx is idle */
-    kStatus_SAI_RxIdle    = MAKE_STATUS(kStatusGroup_SAI, 6)  /*!< SAI Rx is idle */
+    kStatus_SAI_RxIdle    = MAKE_STATUS(kStatusGroup_SAI, 6), /*!< SAI Rx is idle */
+    kStatus_SAI_TxPeriod  = MAKE_STATUS(kStatusGroup_SAI, 7), /*!< SAI Tx stream sent periods, still running */
+    kStatus_SAI_RxPeriod  = MAKE_STATUS(kStatusGroup_SAI, 8)  /*!< SAI Rx stream received periods, still running */
 };
 
 /*! @brief _sai_channel_mask,.sai channel mask value, actual channel numbers is depend soc specific */
@@ -7,6 +7,7 @@
  */
 
 #include "fsl_sai_edma.h"
+#include "fsl_memory.h"
 
 /* Component ID definition, used by tools. */
 #ifndef FSL_COMPONENT_ID
@@ -68,6 +69,47 @@ static void SAI_TxEDMACallback(edma_handle_t *handle, void *userData, bool done,
  */
 static void SAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
 
+/*!
+ * @brief SAI EDMA callback for the circular stream send.
+ *
+ * @param handle pointer to sai_edma_handle_t structure which stores the transfer state.
+ * @param userData Parameter for user callback.
+ * @param done If the DMA transfer finished.
+ * @param tcds The TCD index.
+ */
+static void SAI_TxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
+
+/*!
+ * @brief SAI EDMA callback for the circular stream receive.
+ *
+ * @param handle pointer to sai_edma_handle_t structure which stores the transfer state.
+ * @param userData Parameter for user callback.
+ * @param done If the DMA transfer finished.
+ * @param tcds The TCD index.
+ */
+static void SAI_RxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds);
+
+/*!
+ * @brief Builds the looped TCD chain of a circular stream and starts the eDMA channel.
+ *
+ * @param handle SAI eDMA handle pointer.
+ * @param config Pointer to the stream configuration.
+ * @param fifoAddr Address of the SAI data register.
+ * @param type Transfer direction.
+ */
+static status_t SAI_StartStreamEDMA(sai_edma_handle_t *handle,
+                                    const sai_edma_stream_config_t *config,
+                                    uint32_t fifoAddr,
+                                    edma_transfer_type_t type);
+
+/*!
+ * @brief Gives the TCD pool back to the transfer queue after a circular stream.
+ *
+ * @param handle SAI eDMA handle pointer.
+ * @param callback The eDMA callback of the transfer queue.
+ */
+static void SAI_StopStreamEDMA(sai_edma_handle_t *handle, edma_callback callback);
+
 /*******************************************************************************
  * Code
  ******************************************************************************/
@@ -133,6 +175,119 @@ static void SAI_RxEDMACallback(edma_handle_t *handle, void *userData, bool done,
     }
 }
 
+static void SAI_TxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds)
+{
+    sai_edma_private_handle_t *privHandle = (sai_edma_private_handle_t *)userData;
+    sai_edma_handle_t *saiHandle          = privHandle->handle;
+
+    /* The next TCD of the ring is already loaded, only the DONE bit is left from the finished one. */
+    handle->base->CH[handle->channel].CH_CSR |= DMA_CH_CSR_DONE_MASK;
+
+    if (saiHandle->callback != NULL)
+    {
+        (saiHandle->callback)(privHandle->base, saiHandle, kStatus_SAI_TxPeriod, saiHandle->userData);
+    }
+}
+
+static void SAI_RxStreamEDMACallback(edma_handle_t *handle, void *userData, bool done, uint32_t tcds)
+{
+    sai_edma_private_handle_t *privHandle = (sai_edma_private_handle_t *)userData;
+    sai_edma_handle_t *saiHandle          = privHandle->handle;
+
+    /* The next TCD of the ring is already loaded, only the DONE bit is left from the finished one. */
+    handle->base->CH[handle->channel].CH_CSR |= DMA_CH_CSR_DONE_MASK;
+
+    if (saiHandle->callback != NULL)
+    {
+        (saiHandle->callback)(privHandle->base, saiHandle, kStatus_SAI_RxPeriod, saiHandle->userData);
+    }
+}
+
+static status_t SAI_StartStreamEDMA(sai_edma_handle_t *handle,
+                                    const sai_edma_stream_config_t *config,
+                                    uint32_t fifoAddr,
+                                    edma_transfer_type_t type)
+{
+    edma_transfer_config_t transfer = {0};
+    edma_tcd_t *tcd                 = STCD_ADDR(handle->tcd);
+    uint32_t nbytes                 = (uint32_t)handle->count * handle->bytesPerFrame;
+    uint32_t tcdNum;
+    size_t tcdSize;
+    uint8_t *data;
+    uint32_t i;
+
+    if ((config->buffer == NULL) || (config->periodNum < 2U) || (config->periodSize == 0U) ||
+        ((config->periodSize % nbytes) != 0U))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    /* One TCD per interrupt, or a single TCD looping on itself without interrupts. */
+    if (config->periodsPerIrq == 0U)
+    {
+        tcdNum = 1U;
+    }
+    else if ((config->periodNum % config->periodsPerIrq) == 0U)
+    {
+        tcdNum = config->periodNum / config->periodsPerIrq;
+    }
+    else
+    {
+        return kStatus_InvalidArgument;
+    }
+    tcdSize = config->periodSize * config->periodNum / tcdNum;
+    if ((tcdNum > SAI_XFER_QUEUE_SIZE) ||
+        ((tcdSize / nbytes) > (DMA_TCD_CITER_ELINKNO_CITER_MASK >> DMA_TCD_CITER_ELINKNO_CITER_SHIFT)))
+    {
+        return kStatus_InvalidArgument;
+    }
+
+    for (i = 0U; i < tcdNum; i++)
+    {
+        data = &config->buffer[i * tcdSize];
+        if (type == kEDMA_MemoryToPeripheral)
+        {
+            EDMA_PrepareTransfer(&transfer, data, handle->bytesPerFrame, (uint32_t *)fifoAddr, handle->bytesPerFrame,
+                                 nbytes, tcdSize, type);
+        }
+        else
+        {
+            EDMA_PrepareTransfer(&transfer, (uint32_t *)fifoAddr, handle->bytesPerFrame, data, handle->bytesPerFrame,
+                                 nbytes, tcdSize, type);
+        }
+        /* The last TCD links back to the first one, the chain never ends. */
+        EDMA_TcdReset(&tcd[i]);
+        EDMA_TcdSetTransferConfig(&tcd[i], &transfer, &tcd[(i + 1U) % tcdNum]);
+        if (config->periodsPerIrq != 0U)
+        {
+            EDMA_TcdEnableInterrupts(&tcd[i], (uint32_t)kEDMA_MajorInterruptEnable);
+        }
+    }
+
+    handle->state         = (uint32_t)kSAI_Busy;
+    handle->nbytes        = (uint8_t)nbytes;
+    handle->streamSize    = config->periodSize * config->periodNum;
+    handle->streamTcdSize = tcdSize;
+
+    /* The ring is not a queue of transfers: detach the pool so that the eDMA IRQ handler only calls back. */
+    EDMA_InstallTCDMemory(handle->dmaHandle, NULL, 0U);
+    EDMA_ResetChannel(handle->dmaHandle->base, handle->dmaHandle->channel);
+    EDMA_InstallTCD(handle->dmaHandle->base, handle->dmaHandle->channel, &tcd[0]);
+    EDMA_StartTransfer(handle->dmaHandle);
+
+    return kStatus_Success;
+}
+
+static void SAI_StopStreamEDMA(sai_edma_handle_t *handle, edma_callback callback)
+{
+    /* Need to use scatter gather */
+    EDMA_InstallTCDMemory(handle->dmaHandle, STCD_ADDR(handle->tcd), SAI_XFER_QUEUE_SIZE);
+    EDMA_SetCallback(handle->dmaHandle, callback, handle->dmaHandle->userData);
+
+    handle->streamSize    = 0U;
+    handle->streamTcdSize = 0U;
+}
+
 /*!
  * brief Initializes the SAI eDMA handle.
  *
@@ -410,6 +565,12 @@ status_t SAI_TransferSendEDMA(I2S_Type *base, sai_edma_handle_t *handle, sai_tra
         return kStatus_InvalidArgument;
     }
 
+    /* The TCD pool runs a circular stream */
+    if (handle->streamSize != 0U)
+    {
+        return kStatus_SAI_TxBusy;
+    }
+
     if (handle->saiQueue[handle->queueUser].data != NULL)
     {
         return kStatus_SAI_QueueFull;
@@ -477,6 +638,12 @@ status_t SAI_TransferReceiveEDMA(I2S_Type *base, sai_edma_handle_t *handle, sai_
         return kStatus_InvalidArgument;
     }
 
+    /* The TCD pool runs a circular stream */
+    if (handle->streamSize != 0U)
+    {
+        return kStatus_SAI_RxBusy;
+    }
+
     if (handle->saiQueue[handle->queueUser].data != NULL)
     {
         return kStatus_SAI_QueueFull;
@@ -550,9 +717,16 @@ void SAI_TransferAbortSendEDMA(I2S_Type *base, sai_edma_handle_t *handle)
         base->TCSR &= ~I2S_TCSR_SR_MASK;
     }
 
-    /* Handle the queue index */
-    (void)memset(&handle->saiQueue[handle->queueDriver], 0, sizeof(sai_transfer_t));
-    handle->queueDriver = (handle->queueDriver + 1U) % SAI_XFER_QUEUE_SIZE;
+    if (handle->streamSize != 0U)
+    {
+        SAI_StopStreamEDMA(handle, SAI_TxEDMACallback);
+    }
+    else
+    {
+        /* Handle the queue index */
+        (void)memset(&handle->saiQueue[handle->queueDriver], 0, sizeof(sai_transfer_t));
+        handle->queueDriver = (handle->queueDriver + 1U) % SAI_XFER_QUEUE_SIZE;
+    }
 
     /* Set the handle state */
     handle->state = (uint32_t)kSAI_Idle;
@@ -590,9 +764,16 @@ void SAI_TransferAbortReceiveEDMA(I2S_Type *base, sai_edma_handle_t *handle)
         base->RCSR &= ~I2S_RCSR_SR_MASK;
     }
 
-    /* Handle the queue index */
-    (void)memset(&handle->saiQueue[handle->queueDriver], 0, sizeof(sai_transfer_t));
-    handle->queueDriver = (handle->queueDriver + 1U) % SAI_XFER_QUEUE_SIZE;
+    if (handle->streamSize != 0U)
+    {
+        SAI_StopStreamEDMA(handle, SAI_RxEDMACallback);
+    }
+    else
+    {
+        /* Handle the queue index */
+        (void)memset(&handle->saiQueue[handle->queueDriver], 0, sizeof(sai_transfer_t));
+        handle->queueDriver = (handle->queueDriver + 1U) % SAI_XFER_QUEUE_SIZE;
+    }
 
     /* Set the handle state */
     handle->state = (uint32_t)kSAI_Idle;
@@ -705,3 +886,163 @@ status_t SAI_TransferGetReceiveCountEDMA(I2S_Type *base, sai_edma_handle_t *hand
 
     return status;
 }
+
+/*!
+ * brief Starts a gapless SAI send of a ring buffer using eDMA.
+ *
+ * The eDMA sends the ring continuously, with no transfer to resubmit. The application fills the whole ring before the
+ * call, then refills the periods the eDMA has sent, which it finds with SAI_TransferGetStreamPositionEDMA(). The
+ * callback is called with kStatus_SAI_TxPeriod every config->periodsPerIrq periods. The stream never reports
+ * kStatus_SAI_TxIdle, it runs until it is stopped with SAI_TransferAbortSendEDMA() or SAI_TransferTerminateSendEDMA().
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ * param config Pointer to the stream configuration.
+ * retval kStatus_Success Start the stream successfully.
+ * retval kStatus_InvalidArgument The configuration does not fit the eDMA minor loop or the TCD pool.
+ * retval kStatus_SAI_TxBusy SAI is busy sending data.
+ */
+status_t SAI_TransferSendStreamEDMA(I2S_Type *base, sai_edma_handle_t *handle, const sai_edma_stream_config_t *config)
+{
+    assert((handle != NULL) && (config != NULL));
+
+    uint32_t instance = SAI_GetInstance(base);
+    status_t status;
+
+    if (handle->state == (uint32_t)kSAI_Busy)
+    {
+        return kStatus_SAI_TxBusy;
+    }
+
+    EDMA_SetCallback(handle->dmaHandle, SAI_TxStreamEDMACallback, &s_edmaPrivateHandle[instance][0]);
+    status = SAI_StartStreamEDMA(handle, config, SAI_TxGetDataRegisterAddress(base, handle->channel),
+                                 kEDMA_MemoryToPeripheral);
+    if (status != kStatus_Success)
+    {
+        EDMA_SetCallback(handle->dmaHandle, SAI_TxEDMACallback, &s_edmaPrivateHandle[instance][0]);
+        return status;
+    }
+
+    /* Enable DMA enable bit */
+    SAI_TxEnableDMA(base, kSAI_FIFORequestDMAEnable, true);
+
+    /* Enable SAI Tx clock */
+    SAI_TxEnable(base, true);
+
+    /* Enable the channel FIFO */
+    base->TCR3 |= I2S_TCR3_TCE(1UL << handle->channel);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Starts a gapless SAI receive into a ring buffer using eDMA.
+ *
+ * The eDMA fills the ring continuously, with no transfer to resubmit. The application reads the periods the eDMA has
+ * filled, which it finds with SAI_TransferGetStreamPositionEDMA(). The callback is called with kStatus_SAI_RxPeriod
+ * every config->periodsPerIrq periods. The stream never reports kStatus_SAI_RxIdle, it runs until it is stopped with
+ * SAI_TransferAbortReceiveEDMA() or SAI_TransferTerminateReceiveEDMA().
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ * param config Pointer to the stream configuration.
+ * retval kStatus_Success Start the stream successfully.
+ * retval kStatus_InvalidArgument The configuration does not fit the eDMA minor loop or the TCD pool.
+ * retval kStatus_SAI_RxBusy SAI is busy receiving data.
+ */
+status_t SAI_TransferReceiveStreamEDMA(I2S_Type *base,
+                                       sai_edma_handle_t *handle,
+                                       const sai_edma_stream_config_t *config)
+{
+    assert((handle != NULL) && (config != NULL));
+
+    uint32_t instance = SAI_GetInstance(base);
+    status_t status;
+
+    if (handle->state == (uint32_t)kSAI_Busy)
+    {
+        return kStatus_SAI_RxBusy;
+    }
+
+    EDMA_SetCallback(handle->dmaHandle, SAI_RxStreamEDMACallback, &s_edmaPrivateHandle[instance][1]);
+    status = SAI_StartStreamEDMA(handle, config, SAI_RxGetDataRegisterAddress(base, handle->channel),
+                                 kEDMA_PeripheralToMemory);
+    if (status != kStatus_Success)
+    {
+        EDMA_SetCallback(handle->dmaHandle, SAI_RxEDMACallback, &s_edmaPrivateHandle[instance][1]);
+        return status;
+    }
+
+    /* Enable DMA enable bit */
+    SAI_RxEnableDMA(base, kSAI_FIFORequestDMAEnable, true);
+
+    /* Enable the channel FIFO */
+    base->RCR3 |= I2S_RCR3_RCE(1UL << handle->channel);
+
+    /* Enable SAI Rx clock */
+    SAI_RxEnable(base, true);
+
+    return kStatus_Success;
+}
+
+/*!
+ * brief Gets the position of the eDMA in the ring of a circular stream.
+ *
+ * The position is read from the eDMA registers, with a minor loop resolution. The period at the position is
+ * in transfer. For a send, the periods before it back to the last one refilled are free; for a receive, they
+ * hold new data.
+ *
+ * param base SAI base pointer.
+ * param handle SAI eDMA handle pointer.
+ * param position Offset in bytes of the next eDMA transfer in the ring.
+ * retval kStatus_Success Succeed get the position.
+ * retval kStatus_NoTransferInProgress There is no circular stream in progress.
+ */
+status_t SAI_TransferGetStreamPositionEDMA(I2S_Type *base, sai_edma_handle_t *handle, size_t *position)
+{
+    assert((handle != NULL) && (position != NULL));
+
+    DMA_Type *dmaBase = handle->dmaHandle->base;
+    uint32_t channel  = handle->dmaHandle->channel;
+    uint32_t tcdNum;
+    uint32_t major;
+    uint32_t remaining;
+    uint32_t pool;
+    uint32_t sga;
+    uint32_t index;
+
+    if (handle->streamSize == 0U)
+    {
+        return kStatus_NoTransferInProgress;
+    }
+
+#if defined FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET && FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET
+    pool = MEMORY_ConvertMemoryMapAddress((uint32_t)STCD_ADDR(handle->tcd), kMEMORY_Local2DMA);
+#else
+    pool = (uint32_t)STCD_ADDR(handle->tcd);
+#endif /* FSL_FEATURE_MEMORY_HAS_ADDRESS_OFFSET */
+    tcdNum = handle->streamSize / handle->streamTcdSize;
+    major  = handle->streamTcdSize / handle->nbytes;
+
+    /* Read the count again if a TCD was loaded in between, the count must belong to the linked TCD. */
+    do
+    {
+        sga       = dmaBase->CH[channel].TCD_DLAST_SGA;
+        remaining = EDMA_GetRemainingMajorLoopCount(dmaBase, channel);
+    } while (sga != dmaBase->CH[channel].TCD_DLAST_SGA);
+
+    /*
+     * In the ring the major count is reloaded with the next TCD, it is never 0: a 0 is a DONE bit left from the
+     * previous TCD, before the next one starts.
+     */
+    if (remaining == 0U)
+    {
+        remaining = major;
+    }
+
+    /* The registers hold the TCD before the one DLAST_SGA links to. */
+    index     = ((sga - pool) / sizeof(edma_tcd_t) + tcdNum - 1U) % tcdNum;
+    *position = index * handle->streamTcdSize + (major - remaining) * handle->nbytes;
+
+    return kStatus_Success;
+}
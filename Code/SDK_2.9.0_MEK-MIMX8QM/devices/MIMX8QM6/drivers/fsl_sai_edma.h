@@ -22,11 +22,26 @@
 
 /*! @name Driver version */
 /*@{*/
-#define FSL_SAI_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 3, 1)) /*!< Version 2.3.1 */
+#define FSL_SAI_EDMA_DRIVER_VERSION (MAKE_VERSION(2, 4, 0)) /*!< Version 2.4.0 */
 /*@}*/
 
 typedef struct sai_edma_handle sai_edma_handle_t;
 
+/*!
+ * @brief SAI eDMA circular stream configuration.
+ *
+ * The eDMA runs through the ring of periods continuously. The ring is split into periodNum / periodsPerIrq
+ * TCDs linked in a loop, each one raising an interrupt at its end, so that periodNum / periodsPerIrq must not
+ * exceed SAI_XFER_QUEUE_SIZE.
+ */
+typedef struct _sai_edma_stream_config
+{
+    uint8_t *buffer;        /*!< Ring buffer of periodNum periods. */
+    size_t periodSize;      /*!< Bytes of a period, a multiple of the eDMA minor loop bytes. */
+    uint32_t periodNum;     /*!< Number of periods in the ring, at least 2. */
+    uint32_t periodsPerIrq; /*!< Periods between two callbacks, a divider of periodNum. 0 disables the interrupts. */
+} sai_edma_stream_config_t;
+
 /*! @brief SAI eDMA transfer callback function for finish and error */
 typedef void (*sai_edma_callback_t)(I2S_Type *base, sai_edma_handle_t *handle, status_t status, void *userData);
 
@@ -46,6 +61,8 @@ struct sai_edma_handle
     size_t transferSize[SAI_XFER_QUEUE_SIZE];                     /*!< Data bytes need to transfer */
     volatile uint8_t queueUser;                                   /*!< Index for user to queue transfer. */
     volatile uint8_t queueDriver; /*!< Index for driver to get the transfer data and size */
+    size_t streamSize;            /*!< Bytes of the circular stream ring, 0 when no stream runs. */
+    size_t streamTcdSize;         /*!< Bytes transferred by each TCD of the circular stream. */
 };
 
 /*******************************************************************************
@@ -258,6 +275,64 @@ status_t SAI_TransferGetReceiveCountEDMA(I2S_Type *base, sai_edma_handle_t *hand
 
 /*! @} */
 
+/*!
+ * @name eDMA Circular Stream
+ * @{
+ */
+
+/*!
+ * @brief Starts a gapless SAI send of a ring buffer using eDMA.
+ *
+ * The eDMA sends the ring continuously, with no transfer to resubmit. The application fills the whole ring before the
+ * call, then refills the periods the eDMA has sent, which it finds with SAI_TransferGetStreamPositionEDMA(). The
+ * callback is called with kStatus_SAI_TxPeriod every config->periodsPerIrq periods. The stream never reports
+ * kStatus_SAI_TxIdle, it runs until it is stopped with SAI_TransferAbortSendEDMA() or SAI_TransferTerminateSendEDMA().
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ * @param config Pointer to the stream configuration.
+ * @retval kStatus_Success Start the stream successfully.
+ * @retval kStatus_InvalidArgument The configuration does not fit the eDMA minor loop or the TCD pool.
+ * @retval kStatus_SAI_TxBusy SAI is busy sending data.
+ */
+status_t SAI_TransferSendStreamEDMA(I2S_Type *base, sai_edma_handle_t *handle, const sai_edma_stream_config_t *config);
+
+/*!
+ * @brief Starts a gapless SAI receive into a ring buffer using eDMA.
+ *
+ * The eDMA fills the ring continuously, with no transfer to resubmit. The application reads the periods the eDMA has
+ * filled, which it finds with SAI_TransferGetStreamPositionEDMA(). The callback is called with kStatus_SAI_RxPeriod
+ * every config->periodsPerIrq periods. The stream never reports kStatus_SAI_RxIdle, it runs until it is stopped with
+ * SAI_TransferAbortReceiveEDMA() or SAI_TransferTerminateReceiveEDMA().
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ * @param config Pointer to the stream configuration.
+ * @retval kStatus_Success Start the stream successfully.
+ * @retval kStatus_InvalidArgument The configuration does not fit the eDMA minor loop or the TCD pool.
+ * @retval kStatus_SAI_RxBusy SAI is busy receiving data.
+ */
+status_t SAI_TransferReceiveStreamEDMA(I2S_Type *base,
+                                       sai_edma_handle_t *handle,
+                                       const sai_edma_stream_config_t *config);
+
+/*!
+ * @brief Gets the position of the eDMA in the ring of a circular stream.
+ *
+ * The position is read from the eDMA registers, with a minor loop resolution. The period at the position is
+ * in transfer. For a send, the periods before it back to the last one refilled are free; for a receive, they
+ * hold new data.
+ *
+ * @param base SAI base pointer.
+ * @param handle SAI eDMA handle pointer.
+ * @param position Offset in bytes of the next eDMA transfer in the ring.
+ * @retval kStatus_Success Succeed get the position.
+ * @retval kStatus_NoTransferInProgress There is no circular stream in progress.
+ */
+status_t SAI_TransferGetStreamPositionEDMA(I2S_Type *base, sai_edma_handle_t *handle, size_t *position);
+
+/*! @} */
+
 #if defined(__cplusplus)
 }
 #endif
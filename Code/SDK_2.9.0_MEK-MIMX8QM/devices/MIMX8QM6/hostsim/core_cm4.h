@@ -0,0 +1,331 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _HOSTSIM_CORE_CM4_H_
+#define _HOSTSIM_CORE_CM4_H_
+
+/*
+ * Cortex-M4 core header of the host simulation.
+ *
+ * The host build puts this directory first on the include path. This file replaces the compiler
+ * specific part of CMSIS, the intrinsics of cmsis_gcc.h, by their simulated equivalents and then
+ * includes the CMSIS core_cm4.h itself: the core registers (NVIC, SCB, SysTick, DWT) and the CMSIS
+ * functions accessing them are the real ones, the registers are modelled by the simulation.
+ */
+
+#include <stdint.h>
+
+#include "fsl_hostsim.h"
+
+/* The CMSIS core_cm4.h includes cmsis_compiler.h, which would select the ARM intrinsics. */
+#define __CMSIS_COMPILER_H
+
+#ifndef __has_builtin
+#define __has_builtin(x) (0)
+#endif
+
+#ifndef __ASM
+#define __ASM __asm
+#endif
+#ifndef __INLINE
+#define __INLINE inline
+#endif
+#ifndef __STATIC_INLINE
+#define __STATIC_INLINE static inline
+#endif
+#ifndef __STATIC_FORCEINLINE
+#define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#endif
+#ifndef __NO_RETURN
+#define __NO_RETURN __attribute__((__noreturn__))
+#endif
+#ifndef __USED
+#define __USED __attribute__((used))
+#endif
+#ifndef __WEAK
+#define __WEAK __attribute__((weak))
+#endif
+#ifndef __PACKED
+#define __PACKED __attribute__((packed, aligned(1)))
+#endif
+#ifndef __PACKED_STRUCT
+#define __PACKED_STRUCT struct __attribute__((packed, aligned(1)))
+#endif
+#ifndef __PACKED_UNION
+#define __PACKED_UNION union __attribute__((packed, aligned(1)))
+#endif
+#ifndef __ALIGNED
+#define __ALIGNED(x) __attribute__((aligned(x)))
+#endif
+#ifndef __RESTRICT
+#define __RESTRICT __restrict
+#endif
+#ifndef __COMPILER_BARRIER
+#define __COMPILER_BARRIER() __ASM volatile("" ::: "memory")
+#endif
+
+#ifndef __UNALIGNED_UINT16_READ
+#define __UNALIGNED_UINT16_READ(addr) (((const struct { uint16_t v; } __PACKED *)(const void *)(addr))->v)
+#endif
+#ifndef __UNALIGNED_UINT16_WRITE
+#define __UNALIGNED_UINT16_WRITE(addr, val) \
+    (void)((((struct { uint16_t v; } __PACKED *)(void *)(addr))->v) = (val))
+#endif
+#ifndef __UNALIGNED_UINT32_READ
+#define __UNALIGNED_UINT32_READ(addr) (((const struct { uint32_t v; } __PACKED *)(const void *)(addr))->v)
+#endif
+#ifndef __UNALIGNED_UINT32_WRITE
+#define __UNALIGNED_UINT32_WRITE(addr, val) \
+    (void)((((struct { uint32_t v; } __PACKED *)(void *)(addr))->v) = (val))
+#endif
+
+/* Core registers */
+
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+    HOSTSIM_SetPrimask(0U);
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+    HOSTSIM_SetPrimask(1U);
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+    return HOSTSIM_GetPrimask();
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+    HOSTSIM_SetPrimask(priMask);
+}
+
+/* FAULTMASK masks the same exceptions as PRIMASK in the simulation, which has no fault exceptions. */
+__STATIC_FORCEINLINE void __enable_fault_irq(void)
+{
+    HOSTSIM_SetPrimask(0U);
+}
+
+__STATIC_FORCEINLINE void __disable_fault_irq(void)
+{
+    HOSTSIM_SetPrimask(1U);
+}
+
+__STATIC_FORCEINLINE uint32_t __get_FAULTMASK(void)
+{
+    return HOSTSIM_GetPrimask();
+}
+
+__STATIC_FORCEINLINE void __set_FAULTMASK(uint32_t faultMask)
+{
+    HOSTSIM_SetPrimask(faultMask);
+}
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)
+{
+    return HOSTSIM_GetBasepri();
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri)
+{
+    HOSTSIM_SetBasepri(basePri);
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI_MAX(uint32_t basePri)
+{
+    uint32_t current = HOSTSIM_GetBasepri();
+
+    if ((basePri != 0U) && ((current == 0U) || (basePri < current)))
+    {
+        HOSTSIM_SetBasepri(basePri);
+    }
+}
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+    return HOSTSIM_GetIpsr();
+}
+
+__STATIC_FORCEINLINE uint32_t __get_xPSR(void)
+{
+    return HOSTSIM_GetIpsr();
+}
+
+__STATIC_FORCEINLINE uint32_t __get_APSR(void)
+{
+    return 0U;
+}
+
+/* The simulated code always runs privileged, on the main stack. */
+__STATIC_FORCEINLINE uint32_t __get_CONTROL(void)
+{
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __set_CONTROL(uint32_t control)
+{
+    (void)control;
+}
+
+/* Hints and barriers */
+
+#define __NOP() __COMPILER_BARRIER()
+#define __WFI() HOSTSIM_WaitForInterrupt()
+#define __WFE() HOSTSIM_WaitForInterrupt()
+#define __SEV() __COMPILER_BARRIER()
+#define __BKPT(value) __builtin_trap()
+
+__STATIC_FORCEINLINE void __ISB(void)
+{
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __DSB(void)
+{
+    __sync_synchronize();
+}
+
+__STATIC_FORCEINLINE void __DMB(void)
+{
+    __sync_synchronize();
+}
+
+/* Data processing */
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00U) >> 8U) | ((value & 0x00FF00FFU) << 8U);
+}
+
+__STATIC_FORCEINLINE int16_t __REVSH(int16_t value)
+{
+    return (int16_t)__builtin_bswap16((uint16_t)value);
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+    op2 %= 32U;
+    return (op2 == 0U) ? op1 : ((op1 >> op2) | (op1 << (32U - op2)));
+}
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+    uint32_t result = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < 32U; i++)
+    {
+        result = (result << 1U) | ((value >> i) & 1U);
+    }
+    return result;
+}
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+    return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t value, uint32_t sat)
+{
+    if ((sat >= 1U) && (sat <= 32U))
+    {
+        const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+        const int32_t min = -1 - max;
+
+        if (value > max)
+        {
+            return max;
+        }
+        if (value < min)
+        {
+            return min;
+        }
+    }
+    return value;
+}
+
+__STATIC_FORCEINLINE uint32_t __USAT(int32_t value, uint32_t sat)
+{
+    if (sat <= 31U)
+    {
+        const uint32_t max = ((1U << sat) - 1U);
+
+        if (value > (int32_t)max)
+        {
+            return max;
+        }
+        if (value < 0)
+        {
+            return 0U;
+        }
+    }
+    return (uint32_t)value;
+}
+
+/* Exclusive accesses: the monitor is cleared by any exception taken in between. */
+
+__STATIC_FORCEINLINE uint8_t __LDREXB(volatile uint8_t *addr)
+{
+    HOSTSIM_ExclusiveLoad();
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint16_t __LDREXH(volatile uint16_t *addr)
+{
+    HOSTSIM_ExclusiveLoad();
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    HOSTSIM_ExclusiveLoad();
+    return *addr;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXB(uint8_t value, volatile uint8_t *addr)
+{
+    if (!HOSTSIM_ExclusiveStore())
+    {
+        return 1U;
+    }
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXH(uint16_t value, volatile uint16_t *addr)
+{
+    if (!HOSTSIM_ExclusiveStore())
+    {
+        return 1U;
+    }
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    if (!HOSTSIM_ExclusiveStore())
+    {
+        return 1U;
+    }
+    *addr = value;
+    return 0U;
+}
+
+__STATIC_FORCEINLINE void __CLREX(void)
+{
+    HOSTSIM_ExclusiveClear();
+}
+
+#include_next <core_cm4.h>
+
+#endif /* _HOSTSIM_CORE_CM4_H_ */
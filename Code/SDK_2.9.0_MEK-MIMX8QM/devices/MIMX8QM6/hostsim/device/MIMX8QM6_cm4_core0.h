@@ -0,0 +1,3745 @@
+/*
+** ###################################################################
+**     Processor:           MIMX8QM6AVUFF
+**     Compiler:            GNU C Compiler, host simulation
+**
+**     Reference manual:    IMX8QMRM, Rev. E, Jun. 2018
+**
+**     Abstract:
+**         Peripheral Access Layer of the host simulation for MIMX8QM6_cm4_core0
+**
+**     Copyright 2020 NXP
+**     All rights reserved.
+**
+**     SPDX-License-Identifier: BSD-3-Clause
+**
+** ###################################################################
+*/
+
+/*!
+ * @file MIMX8QM6_cm4_core0.h
+ * @brief Peripheral Access Layer of the host simulation for MIMX8QM6_cm4_core0
+ *
+ * The host build finds this header before the device one. It only describes the peripherals with a model
+ * in the simulation, eDMA, ENET, FlexCAN, LMEM, LPUART and MU, plus the watchdog that SystemInit()
+ * disables, with the registers and bit fields their drivers and models use. The interrupt numbers are
+ * those of the vector table, the LPCG base addresses are only there for the clock names of fsl_clock.h.
+ */
+
+#if !defined(MIMX8QM6_CM4_CORE0_H_)
+#define MIMX8QM6_CM4_CORE0_H_                    /**< Symbol preventing repeated inclusion */
+
+/** Memory map major version (memory maps with equal major version number are
+ * compatible) */
+#define MCU_MEM_MAP_VERSION 0x0400U
+/** Memory map minor version */
+#define MCU_MEM_MAP_VERSION_MINOR 0x0000U
+
+/** Core of the device, selects the core specific parts of the drivers. */
+#define MIMX8QM_CM4_CORE0
+
+/* ----------------------------------------------------------------------------
+   -- Interrupt vector numbers
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup Interrupt_vector_numbers Interrupt vector numbers
+ * @{
+ */
+
+/** Interrupt Number Definitions */
+#define NUMBER_OF_INT_VECTORS 640                /**< Number of interrupts in the Vector table */
+
+typedef enum IRQn {
+  /* Auxiliary constants */
+  NotAvail_IRQn                = -128,             /**< Not available device specific interrupt */
+
+  /* Core interrupts */
+  NonMaskableInt_IRQn          = -14,              /**< Non Maskable Interrupt */
+  HardFault_IRQn               = -13,              /**< Cortex-M4 SV Hard Fault Interrupt */
+  MemoryManagement_IRQn        = -12,              /**< Cortex-M4 Memory Management Interrupt */
+  BusFault_IRQn                = -11,              /**< Cortex-M4 Bus Fault Interrupt */
+  UsageFault_IRQn              = -10,              /**< Cortex-M4 Usage Fault Interrupt */
+  SVCall_IRQn                  = -5,               /**< Cortex-M4 SV Call Interrupt */
+  DebugMonitor_IRQn            = -4,               /**< Cortex-M4 Debug Monitor Interrupt */
+  PendSV_IRQn                  = -2,               /**< Cortex-M4 Pend SV Interrupt */
+  SysTick_IRQn                 = -1,               /**< Cortex-M4 System Tick Interrupt */
+
+  /* Device specific interrupts */
+  Reserved16_IRQn              = 0,                  /**< Reserved */
+  Reserved17_IRQn              = 1,                  /**< Reserved */
+  Reserved18_IRQn              = 2,                  /**< Reserved */
+  Reserved19_IRQn              = 3,                  /**< Reserved */
+  Reserved20_IRQn              = 4,                  /**< Reserved */
+  M4_0_MCM_IRQn                = 5,                  /**< MCM IRQ */
+  Reserved22_IRQn              = 6,                  /**< Reserved */
+  Reserved23_IRQn              = 7,                  /**< Reserved */
+  Reserved24_IRQn              = 8,                  /**< Reserved */
+  Reserved25_IRQn              = 9,                  /**< Reserved */
+  Reserved26_IRQn              = 10,                 /**< Reserved */
+  Reserved27_IRQn              = 11,                 /**< Reserved */
+  Reserved28_IRQn              = 12,                 /**< Reserved */
+  Reserved29_IRQn              = 13,                 /**< Reserved */
+  Reserved30_IRQn              = 14,                 /**< Reserved */
+  Reserved31_IRQn              = 15,                 /**< Reserved */
+  Reserved32_IRQn              = 16,                 /**< Reserved */
+  Reserved33_IRQn              = 17,                 /**< Reserved */
+  Reserved34_IRQn              = 18,                 /**< Reserved */
+  M4_0_TPM_IRQn                = 19,                 /**< Timer PWM Module */
+  Reserved36_IRQn              = 20,                 /**< Reserved */
+  Reserved37_IRQn              = 21,                 /**< Reserved */
+  M4_0_LPIT_IRQn               = 22,                 /**< Low-Power Periodic Interrupt Timer */
+  Reserved39_IRQn              = 23,                 /**< Reserved */
+  Reserved40_IRQn              = 24,                 /**< Reserved */
+  M4_0_LPUART_IRQn             = 25,                 /**< Low Power UART */
+  Reserved42_IRQn              = 26,                 /**< Reserved */
+  M4_0_LPI2C_IRQn              = 27,                 /**< Low-Power I2C - Logical OR of master and slave interrupts */
+  Reserved44_IRQn              = 28,                 /**< Reserved */
+  M4_0_MU0_B0_IRQn             = 29,                 /**< Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 0, Logical OR of all general-purpose, TX, and RX interrupts */
+  Reserved46_IRQn              = 30,                 /**< Reserved */
+  Reserved47_IRQn              = 31,                 /**< Reserved */
+  IRQSTEER_0_IRQn              = 32,                 /**< External interrupt 0 */
+  IRQSTEER_1_IRQn              = 33,                 /**< External interrupt 1 */
+  IRQSTEER_2_IRQn              = 34,                 /**< External interrupt 2 */
+  IRQSTEER_3_IRQn              = 35,                 /**< External interrupt 3 */
+  IRQSTEER_4_IRQn              = 36,                 /**< External interrupt 4 */
+  IRQSTEER_5_IRQn              = 37,                 /**< External interrupt 5 */
+  IRQSTEER_6_IRQn              = 38,                 /**< External interrupt 6 */
+  IRQSTEER_7_IRQn              = 39,                 /**< External interrupt 7 */
+  Reserved56_IRQn              = 40,                 /**< Reserved */
+  Reserved57_IRQn              = 41,                 /**< Reserved */
+  Reserved58_IRQn              = 42,                 /**< Reserved */
+  Reserved59_IRQn              = 43,                 /**< Reserved */
+  M4_0_MU0_B1_IRQn             = 44,                 /**< Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 1, Logical OR of all general-purpose, TX, and RX interrupts */
+  M4_0_MU0_B2_IRQn             = 45,                 /**< Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 2, Logical OR of all general-purpose, TX, and RX interrupts */
+  M4_0_MU0_B3_IRQn             = 46,                 /**< Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 3, Logical OR of all general-purpose, TX, and RX interrupts */
+  Reserved63_IRQn              = 47,                 /**< Reserved */
+  Reserved64_IRQn              = 48,                 /**< Reserved */
+  M4_0_MU1_A_IRQn              = 49,                 /**< Messaging Unit 1 (IPC with System Controller) - Side A (MCU), Logical OR of all general-purpose, TX, and RX interrupts */
+  M4_0_SW_IRQn                 = 50,                 /**< Software interrupt (asserted/cleared via NVIC registers, INTISR[50] input tied low) */
+  Reserved67_IRQn              = 51,                 /**< xxx Interrupt 67 */
+  Reserved68_IRQn              = 52,                 /**< xxx Interrupt 68 */
+  Reserved69_IRQn              = 53,                 /**< xxx Interrupt 69 */
+  Reserved70_IRQn              = 54,                 /**< xxx Interrupt 70 */
+  Reserved71_IRQn              = 55,                 /**< xxx Interrupt 71 */
+  Reserved72_IRQn              = 56,                 /**< xxx Interrupt 72 */
+  Reserved73_IRQn              = 57,                 /**< xxx Interrupt 73 */
+  Reserved74_IRQn              = 58,                 /**< xxx Interrupt 74 */
+  Reserved75_IRQn              = 59,                 /**< xxx Interrupt 75 */
+  Reserved76_IRQn              = 60,                 /**< xxx Interrupt 76 */
+  Reserved77_IRQn              = 61,                 /**< xxx Interrupt 77 */
+  Reserved78_IRQn              = 62,                 /**< xxx Interrupt 78 */
+  Reserved79_IRQn              = 63,                 /**< xxx Interrupt 79 */
+  Reserved80_IRQn              = 64,                 /**< xxx Interrupt 80 */
+  Reserved81_IRQn              = 65,                 /**< xxx Interrupt 81 */
+  Reserved82_IRQn              = 66,                 /**< xxx Interrupt 82 */
+  Reserved83_IRQn              = 67,                 /**< xxx Interrupt 83 */
+  Reserved84_IRQn              = 68,                 /**< xxx Interrupt 84 */
+  Reserved85_IRQn              = 69,                 /**< xxx Interrupt 85 */
+  Reserved86_IRQn              = 70,                 /**< xxx Interrupt 86 */
+  Reserved87_IRQn              = 71,                 /**< xxx Interrupt 87 */
+  Reserved88_IRQn              = 72,                 /**< xxx Interrupt 88 */
+  Reserved89_IRQn              = 73,                 /**< xxx Interrupt 89 */
+  Reserved90_IRQn              = 74,                 /**< xxx Interrupt 90 */
+  Reserved91_IRQn              = 75,                 /**< xxx Interrupt 91 */
+  Reserved92_IRQn              = 76,                 /**< xxx Interrupt 92 */
+  Reserved93_IRQn              = 77,                 /**< xxx Interrupt 93 */
+  Reserved94_IRQn              = 78,                 /**< xxx Interrupt 94 */
+  Reserved95_IRQn              = 79,                 /**< xxx Interrupt 95 */
+  Reserved96_IRQn              = 80,                 /**< xxx Interrupt 96 */
+  Reserved97_IRQn              = 81,                 /**< xxx Interrupt 97 */
+  Reserved98_IRQn              = 82,                 /**< xxx Interrupt 98 */
+  A53_NEXTERRIRQ_IRQn          = 83,                 /**< Shared Int Source nEXTERRIRQ from A53 Sub-System */
+  A53_NINTERRIRQ_IRQn          = 84,                 /**< Shared Int Source nINTERRIRQ from A53 Sub-System */
+  A72_NEXTERRIRQ_IRQn          = 85,                 /**< Shared Int Source nEXTERRIRQ from A72 Sub-System */
+  A72_NINTERRIRQ_IRQn          = 86,                 /**< Shared Int Source nINTERRIRQ from A72 Sub-System */
+  VPU_NEXTERRIRQ_IRQn          = 87,                 /**< Shared Int Source nEXTERRIRQ from VPU Sub-System */
+  Reserved104_IRQn             = 88,                 /**< xxx Interrupt 104 */
+  Reserved105_IRQn             = 89,                 /**< xxx Interrupt 105 */
+  Reserved106_IRQn             = 90,                 /**< xxx Interrupt 106 */
+  CCI_NERRORIRQ_IRQn           = 91,                 /**< Shared Int Source nERRORIRQ from CCI Sub-System */
+  CCI_NEVNTCNTOVERFLOW0_IRQn   = 92,                 /**< Shared Int Source nEVNTCNTOVERFLOW[0] from CCI Sub-System */
+  CCI_NEVNTCNTOVERFLOW1_IRQn   = 93,                 /**< Shared Int Source nEVNTCNTOVERFLOW[1] from CCI Sub-System */
+  CCI_NEVNTCNTOVERFLOW2_IRQn   = 94,                 /**< Shared Int Source nEVNTCNTOVERFLOW[2] from CCI Sub-System */
+  CCI_NEVNTCNTOVERFLOW3_IRQn   = 95,                 /**< Shared Int Source nEVNTCNTOVERFLOW[3] from CCI Sub-System */
+  CCI_NEVNTCNTOVERFLOW4_IRQn   = 96,                 /**< Shared Int Source nEVNTCNTOVERFLOW[4] from CCI Sub-System */
+  Reserved113_IRQn             = 97,                 /**< xxx Interrupt 113 */
+  Reserved114_IRQn             = 98,                 /**< xxx Interrupt 114 */
+  M4_0_INT_OUT0_IRQn           = 99,                 /**< Shared Int Source INT_OUT[0] from M4_0 Sub-System */
+  M4_0_INT_OUT1_IRQn           = 100,                /**< Shared Int Source INT_OUT[1] from M4_0 Sub-System */
+  M4_0_INT_OUT2_IRQn           = 101,                /**< Shared Int Source INT_OUT[2] from M4_0 Sub-System */
+  M4_0_INT_OUT3_IRQn           = 102,                /**< Shared Int Source INT_OUT[3] from M4_0 Sub-System */
+  M4_0_INT_OUT4_IRQn           = 103,                /**< Shared Int Source INT_OUT[4] from M4_0 Sub-System */
+  M4_0_INT_OUT5_IRQn           = 104,                /**< Shared Int Source INT_OUT[5] from M4_0 Sub-System */
+  M4_0_INT_OUT6_IRQn           = 105,                /**< Shared Int Source INT_OUT[6] from M4_0 Sub-System */
+  M4_0_INT_OUT7_IRQn           = 106,                /**< Shared Int Source INT_OUT[7] from M4_0 Sub-System */
+  M4_1_INT_OUT0_IRQn           = 107,                /**< Shared Int Source INT_OUT[0] from M4_1 Sub-System */
+  M4_1_INT_OUT1_IRQn           = 108,                /**< Shared Int Source INT_OUT[1] from M4_1 Sub-System */
+  M4_1_INT_OUT2_IRQn           = 109,                /**< Shared Int Source INT_OUT[2] from M4_1 Sub-System */
+  M4_1_INT_OUT3_IRQn           = 110,                /**< Shared Int Source INT_OUT[3] from M4_1 Sub-System */
+  M4_1_INT_OUT4_IRQn           = 111,                /**< Shared Int Source INT_OUT[4] from M4_1 Sub-System */
+  M4_1_INT_OUT5_IRQn           = 112,                /**< Shared Int Source INT_OUT[5] from M4_1 Sub-System */
+  M4_1_INT_OUT6_IRQn           = 113,                /**< Shared Int Source INT_OUT[6] from M4_1 Sub-System */
+  M4_1_INT_OUT7_IRQn           = 114,                /**< Shared Int Source INT_OUT[7] from M4_1 Sub-System */
+  DBLOG_COMB_IRPT_NS_IRQn      = 115,                /**< Shared Int Source comb_irpt_ns from DBLog Sub-System */
+  DBLOG_COMB_IRPT_S_IRQn       = 116,                /**< Shared Int Source comb_irpt_s from DBLog Sub-System */
+  DBLOG_GBL_FLT_IRPT_NS_IRQn   = 117,                /**< Shared Int Source gbl_flt_irpt_ns from DBLog Sub-System */
+  DBLOG_GBL_FLT_IRPT_S_IRQn    = 118,                /**< Shared Int Source gbl_flt_irpt_s from DBLog Sub-System */
+  DBLOG_PERF_IRPT_IMX8_0_IRQn  = 119,                /**< Shared Int Source perf_irpt_imx8_0 from DBLog Sub-System */
+  DBLOG_PERF_IRPT_IMX8_1_IRQn  = 120,                /**< Shared Int Source perf_irpt_imx8_1 from DBLog Sub-System */
+  DBLOG_PERF_IRPT_IMX8_2_IRQn  = 121,                /**< Shared Int Source perf_irpt_imx8_2 from DBLog Sub-System */
+  DBLOG_PERF_IRPT_IMX8_3_IRQn  = 122,                /**< Shared Int Source perf_irpt_imx8_3 from DBLog Sub-System */
+  DISPLAY0_INT_OUT0_IRQn       = 123,                /**< Shared Int Source INT_OUT[0] from Display0 Sub-System */
+  DISPLAY0_INT_OUT1_IRQn       = 124,                /**< Shared Int Source INT_OUT[1] from Display0 Sub-System */
+  DISPLAY0_INT_OUT2_IRQn       = 125,                /**< Shared Int Source INT_OUT[2] from Display0 Sub-System */
+  DISPLAY0_INT_OUT3_IRQn       = 126,                /**< Shared Int Source INT_OUT[3] from Display0 Sub-System */
+  DISPLAY0_INT_OUT4_IRQn       = 127,                /**< Shared Int Source INT_OUT[4] from Display0 Sub-System */
+  DISPLAY0_INT_OUT5_IRQn       = 128,                /**< Shared Int Source INT_OUT[5] from Display0 Sub-System */
+  DISPLAY0_INT_OUT6_IRQn       = 129,                /**< Shared Int Source INT_OUT[6] from Display0 Sub-System */
+  DISPLAY0_INT_OUT7_IRQn       = 130,                /**< Shared Int Source INT_OUT[7] from Display0 Sub-System */
+  DISPLAY0_RESERVED_IRQn       = 131,                /**< Shared Int Source Reserved from Display0 Sub-System */
+  DISPLAY0_INT_OUT9_IRQn       = 132,                /**< Shared Int Source INT_OUT[9] from Display0 Sub-System */
+  DISPLAY0_INT_OUT10_IRQn      = 133,                /**< Shared Int Source INT_OUT[10] from Display0 Sub-System */
+  DISPLAY0_INT_OUT11_IRQn      = 134,                /**< Shared Int Source INT_OUT[11] from Display0 Sub-System */
+  DISPLAY0_INT_OUT12_IRQn      = 135,                /**< Shared Int Source INT_OUT[12] from Display0 Sub-System */
+  Reserved152_IRQn             = 136,                /**< xxx Interrupt 152 */
+  Reserved153_IRQn             = 137,                /**< xxx Interrupt 153 */
+  Reserved154_IRQn             = 138,                /**< xxx Interrupt 154 */
+  Reserved155_IRQn             = 139,                /**< xxx Interrupt 155 */
+  LVDS0_INT_OUT_IRQn           = 140,                /**< Shared Int Source INT_OUT from LVDS0 Sub-System */
+  LVDS1_INT_OUT_IRQn           = 141,                /**< Shared Int Source INT_OUT from LVDS1 Sub-System */
+  MIPI_DSI0_INT_OUT_IRQn       = 142,                /**< Shared Int Source INT_OUT from MIPI_DSI0 Sub-System */
+  MIPI_DSI1_INT_OUT_IRQn       = 143,                /**< Shared Int Source INT_OUT from MIPI_DSI1 Sub-System */
+  HDMI_TX_INT_OUT_IRQn         = 144,                /**< Shared Int Source INT_OUT from HDMI_TX Sub-System */
+  Reserved161_IRQn             = 145,                /**< xxx Interrupt 161 */
+  Reserved162_IRQn             = 146,                /**< xxx Interrupt 162 */
+  GPU0_XAQ2_INTR_IRQn          = 147,                /**< Shared Int Source xaq2_intr from GPU0 Sub-System */
+  GPU1_XAQ2_INTR_IRQn          = 148,                /**< Shared Int Source xaq2_intr from GPU1 Sub-System */
+  DMA_EDMA0_INT_IRQn           = 149,                /**< Shared Int Source eDMA0_INT from DMA Sub-System */
+  DMA_EDMA0_ERR_INT_IRQn       = 150,                /**< Shared Int Source eDMA0_ERR_INT from DMA Sub-System */
+  DMA_EDMA1_INT_IRQn           = 151,                /**< Shared Int Source eDMA1_INT from DMA Sub-System */
+  DMA_EDMA1_ERR_INT_IRQn       = 152,                /**< Shared Int Source eDMA1_ERR_INT from DMA Sub-System */
+  HSIO_PCIEA_MSI_CTRL_INT_IRQn = 153,                /**< Shared Int Source PCIeA_MSI_CTRL_INT from HSIO Sub-System */
+  HSIO_PCIEA_CLK_REQ_INT_IRQn  = 154,                /**< Shared Int Source PCIeA_CLK_REQ_INT from HSIO Sub-System */
+  HSIO_PCIEA_DMA_INT_IRQn      = 155,                /**< Shared Int Source PCIeA_DMA_INT from HSIO Sub-System */
+  HSIO_PCIEA_INT_D_IRQn        = 156,                /**< Shared Int Source PCIeA_INT_D from HSIO Sub-System */
+  HSIO_PCIEA_INT_C_IRQn        = 157,                /**< Shared Int Source PCIeA_INT_C from HSIO Sub-System */
+  HSIO_PCIEA_INT_B_IRQn        = 158,                /**< Shared Int Source PCIeA_INT_B from HSIO Sub-System */
+  HSIO_PCIEA_INT_A_IRQn        = 159,                /**< Shared Int Source PCIeA_INT_A from HSIO Sub-System */
+  HSIO_PCIEA_SMLH_REQ_RST_IRQn = 160,                /**< Shared Int Source PCIeA_SMLH_REQ_RST from HSIO Sub-System */
+  HSIO_PCIEA_GPIO_WAKEUP0_IRQn = 161,                /**< Shared Int Source PCIeA_GPIO_WAKEUP[0] from HSIO Sub-System */
+  HSIO_PCIEA_GPIO_WAKEUP1_IRQn = 162,                /**< Shared Int Source PCIeA_GPIO_WAKEUP[1] from HSIO Sub-System */
+  LSIO_GPT0_INT_IRQn           = 163,                /**< Shared Int Source GPT0_INT from LSIO Sub-System */
+  LSIO_GPT1_INT_IRQn           = 164,                /**< Shared Int Source GPT1_INT from LSIO Sub-System */
+  LSIO_GPT2_INT_IRQn           = 165,                /**< Shared Int Source GPT2_INT from LSIO Sub-System */
+  LSIO_GPT3_INT_IRQn           = 166,                /**< Shared Int Source GPT3_INT from LSIO Sub-System */
+  LSIO_GPT4_INT_IRQn           = 167,                /**< Shared Int Source GPT4_INT from LSIO Sub-System */
+  LSIO_KPP_INT_IRQn            = 168,                /**< Shared Int Source KPP_INT from LSIO Sub-System */
+  Reserved185_IRQn             = 169,                /**< xxx Interrupt 185 */
+  Reserved186_IRQn             = 170,                /**< xxx Interrupt 186 */
+  HSIO_SATA_INT0_IRQn          = 171,                /**< Shared Int Source SATA_INT[0] from HSIO Sub-System */
+  HSIO_SATA_INT2_IRQn          = 172,                /**< Shared Int Source SATA_INT[2] from HSIO Sub-System */
+  Reserved189_IRQn             = 173,                /**< xxx Interrupt 189 */
+  Reserved190_IRQn             = 174,                /**< xxx Interrupt 190 */
+  LSIO_OCTASPI0_INT_IRQn       = 175,                /**< Shared Int Source OctaSPI0_INT from LSIO Sub-System */
+  LSIO_OCTASPI1_INT_IRQn       = 176,                /**< Shared Int Source OctaSPI1_INT from LSIO Sub-System */
+  LSIO_PWM0_INT_IRQn           = 177,                /**< Shared Int Source PWM0_INT from LSIO Sub-System */
+  LSIO_PWM1_INT_IRQn           = 178,                /**< Shared Int Source PWM1_INT from LSIO Sub-System */
+  LSIO_PWM2_INT_IRQn           = 179,                /**< Shared Int Source PWM2_INT from LSIO Sub-System */
+  LSIO_PWM3_INT_IRQn           = 180,                /**< Shared Int Source PWM3_INT from LSIO Sub-System */
+  LSIO_PWM4_INT_IRQn           = 181,                /**< Shared Int Source PWM4_INT from LSIO Sub-System */
+  LSIO_PWM5_INT_IRQn           = 182,                /**< Shared Int Source PWM5_INT from LSIO Sub-System */
+  LSIO_PWM6_INT_IRQn           = 183,                /**< Shared Int Source PWM6_INT from LSIO Sub-System */
+  LSIO_PWM7_INT_IRQn           = 184,                /**< Shared Int Source PWM7_INT from LSIO Sub-System */
+  HSIO_PCIEB_MSI_CTRL_INT_IRQn = 185,                /**< Shared Int Source PCIeB_MSI_CTRL_INT from HSIO Sub-System */
+  HSIO_PCIEB_CLK_REQ_INT_IRQn  = 186,                /**< Shared Int Source PCIeB_CLK_REQ_INT from HSIO Sub-System */
+  HSIO_PCIEB_DMA_INT_IRQn      = 187,                /**< Shared Int Source PCIeB_DMA_INT from HSIO Sub-System */
+  HSIO_PCIEB_INT_D_IRQn        = 188,                /**< Shared Int Source PCIeB_INT_D from HSIO Sub-System */
+  HSIO_PCIEB_INT_C_IRQn        = 189,                /**< Shared Int Source PCIeB_INT_C from HSIO Sub-System */
+  HSIO_PCIEB_INT_B_IRQn        = 190,                /**< Shared Int Source PCIeB_INT_B from HSIO Sub-System */
+  HSIO_PCIEB_INT_A_IRQn        = 191,                /**< Shared Int Source PCIeB_INT_A from HSIO Sub-System */
+  HSIO_PCIEB_SMLH_REQ_RST_IRQn = 192,                /**< Shared Int Source PCIeB_SMLH_REQ_RST from HSIO Sub-System */
+  HSIO_PCIEB_GPIO_WAKEUP0_IRQn = 193,                /**< Shared Int Source PCIeB_GPIO_WAKEUP[0] from HSIO Sub-System */
+  HSIO_PCIEB_GPIO_WAKEUP1_IRQn = 194,                /**< Shared Int Source PCIeB_GPIO_WAKEUP[1] from HSIO Sub-System */
+  SCU_INT_OUT0_IRQn            = 195,                /**< Shared Int Source INT_OUT[0] from SCU Sub-System */
+  SCU_INT_OUT1_IRQn            = 196,                /**< Shared Int Source INT_OUT[1] from SCU Sub-System */
+  SCU_INT_OUT2_IRQn            = 197,                /**< Shared Int Source INT_OUT[2] from SCU Sub-System */
+  SCU_INT_OUT3_IRQn            = 198,                /**< Shared Int Source INT_OUT[3] from SCU Sub-System */
+  SCU_INT_OUT4_IRQn            = 199,                /**< Shared Int Source INT_OUT[4] from SCU Sub-System */
+  SCU_INT_OUT5_IRQn            = 200,                /**< Shared Int Source INT_OUT[5] from SCU Sub-System */
+  SCU_INT_OUT6_IRQn            = 201,                /**< Shared Int Source INT_OUT[6] from SCU Sub-System */
+  SCU_INT_OUT7_IRQn            = 202,                /**< Shared Int Source INT_OUT[7] from SCU Sub-System */
+  SCU_SYS_COUNT_INT0_IRQn      = 203,                /**< Shared Int Source SYS_COUNT_INT[0] from SCU Sub-System */
+  SCU_SYS_COUNT_INT1_IRQn      = 204,                /**< Shared Int Source SYS_COUNT_INT[1] from SCU Sub-System */
+  SCU_SYS_COUNT_INT2_IRQn      = 205,                /**< Shared Int Source SYS_COUNT_INT[2] from SCU Sub-System */
+  SCU_SYS_COUNT_INT3_IRQn      = 206,                /**< Shared Int Source SYS_COUNT_INT[3] from SCU Sub-System */
+  Reserved223_IRQn             = 207,                /**< xxx Interrupt 223 */
+  Reserved224_IRQn             = 208,                /**< xxx Interrupt 224 */
+  Reserved225_IRQn             = 209,                /**< xxx Interrupt 225 */
+  Reserved226_IRQn             = 210,                /**< xxx Interrupt 226 */
+  DRC0_DFI_ALERT_ERR_IRQn      = 211,                /**< Shared Int Source DFI_ALERT_ERR from DRC0 Sub-System */
+  DRC1_DFI_ALERT_ERR_IRQn      = 212,                /**< Shared Int Source DFI_ALERT_ERR from DRC1 Sub-System */
+  DRC0_PERF_CNT_FULL_IRQn      = 213,                /**< Shared Int Source PERF_CNT_FULL from DRC0 Sub-System */
+  DRC1_PERF_CNT_FULL_IRQn      = 214,                /**< Shared Int Source PERF_CNT_FULL from DRC1 Sub-System */
+  Reserved231_IRQn             = 215,                /**< xxx Interrupt 231 */
+  Reserved232_IRQn             = 216,                /**< xxx Interrupt 232 */
+  Reserved233_IRQn             = 217,                /**< xxx Interrupt 233 */
+  Reserved234_IRQn             = 218,                /**< xxx Interrupt 234 */
+  LSIO_GPIO_INT0_IRQn          = 219,                /**< Shared Int Source GPIO_INT[0] from LSIO Sub-System */
+  LSIO_GPIO_INT1_IRQn          = 220,                /**< Shared Int Source GPIO_INT[1] from LSIO Sub-System */
+  LSIO_GPIO_INT2_IRQn          = 221,                /**< Shared Int Source GPIO_INT[2] from LSIO Sub-System */
+  LSIO_GPIO_INT3_IRQn          = 222,                /**< Shared Int Source GPIO_INT[3] from LSIO Sub-System */
+  LSIO_GPIO_INT4_IRQn          = 223,                /**< Shared Int Source GPIO_INT[4] from LSIO Sub-System */
+  LSIO_GPIO_INT5_IRQn          = 224,                /**< Shared Int Source GPIO_INT[5] from LSIO Sub-System */
+  LSIO_GPIO_INT6_IRQn          = 225,                /**< Shared Int Source GPIO_INT[6] from LSIO Sub-System */
+  LSIO_GPIO_INT7_IRQn          = 226,                /**< Shared Int Source GPIO_INT[7] from LSIO Sub-System */
+  Reserved243_IRQn             = 227,                /**< xxx Interrupt 243 */
+  Reserved244_IRQn             = 228,                /**< xxx Interrupt 244 */
+  Reserved245_IRQn             = 229,                /**< xxx Interrupt 245 */
+  Reserved246_IRQn             = 230,                /**< xxx Interrupt 246 */
+  Reserved247_IRQn             = 231,                /**< xxx Interrupt 247 */
+  Reserved248_IRQn             = 232,                /**< xxx Interrupt 248 */
+  Reserved249_IRQn             = 233,                /**< xxx Interrupt 249 */
+  Reserved250_IRQn             = 234,                /**< xxx Interrupt 250 */
+  DISPLAY1_INT_OUT0_IRQn       = 235,                /**< Shared Int Source INT_OUT[0] from Display1 Sub-System */
+  DISPLAY1_INT_OUT1_IRQn       = 236,                /**< Shared Int Source INT_OUT[1] from Display1 Sub-System */
+  DISPLAY1_INT_OUT2_IRQn       = 237,                /**< Shared Int Source INT_OUT[2] from Display1 Sub-System */
+  DISPLAY1_INT_OUT3_IRQn       = 238,                /**< Shared Int Source INT_OUT[3] from Display1 Sub-System */
+  DISPLAY1_INT_OUT4_IRQn       = 239,                /**< Shared Int Source INT_OUT[4] from Display1 Sub-System */
+  DISPLAY1_INT_OUT5_IRQn       = 240,                /**< Shared Int Source INT_OUT[5] from Display1 Sub-System */
+  DISPLAY1_INT_OUT6_IRQn       = 241,                /**< Shared Int Source INT_OUT[6] from Display1 Sub-System */
+  DISPLAY1_INT_OUT7_IRQn       = 242,                /**< Shared Int Source INT_OUT[7] from Display1 Sub-System */
+  DISPLAY1_RESERVED_IRQn       = 243,                /**< Shared Int Source Reserved from Display1 Sub-System */
+  DISPLAY1_INT_OUT9_IRQn       = 244,                /**< Shared Int Source INT_OUT[9] from Display1 Sub-System */
+  DISPLAY1_INT_OUT10_IRQn      = 245,                /**< Shared Int Source INT_OUT[10] from Display1 Sub-System */
+  DISPLAY1_INT_OUT11_IRQn      = 246,                /**< Shared Int Source INT_OUT[11] from Display1 Sub-System */
+  DISPLAY1_INT_OUT12_IRQn      = 247,                /**< Shared Int Source INT_OUT[12] from Display1 Sub-System */
+  Reserved264_IRQn             = 248,                /**< xxx Interrupt 264 */
+  Reserved265_IRQn             = 249,                /**< xxx Interrupt 265 */
+  Reserved266_IRQn             = 250,                /**< xxx Interrupt 266 */
+  VPU_SYS_INT0_IRQn            = 251,                /**< Shared Int Source SYS_INT[0] from VPU Sub-System */
+  VPU_SYS_INT1_IRQn            = 252,                /**< Shared Int Source SYS_INT[1] from VPU Sub-System */
+  Reserved269_IRQn             = 253,                /**< xxx Interrupt 269 */
+  Reserved270_IRQn             = 254,                /**< xxx Interrupt 270 */
+  Reserved271_IRQn             = 255,                /**< xxx Interrupt 271 */
+  Reserved272_IRQn             = 256,                /**< xxx Interrupt 272 */
+  Reserved273_IRQn             = 257,                /**< xxx Interrupt 273 */
+  Reserved274_IRQn             = 258,                /**< xxx Interrupt 274 */
+  LSIO_MU0_INT_IRQn            = 259,                /**< Shared Int Source MU0_INT from LSIO Sub-System */
+  LSIO_MU1_INT_IRQn            = 260,                /**< Shared Int Source MU1_INT from LSIO Sub-System */
+  LSIO_MU2_INT_IRQn            = 261,                /**< Shared Int Source MU2_INT from LSIO Sub-System */
+  LSIO_MU3_INT_IRQn            = 262,                /**< Shared Int Source MU3_INT from LSIO Sub-System */
+  LSIO_MU4_INT_IRQn            = 263,                /**< Shared Int Source MU4_INT from LSIO Sub-System */
+  Reserved280_IRQn             = 264,                /**< xxx Interrupt 280 */
+  Reserved281_IRQn             = 265,                /**< xxx Interrupt 281 */
+  Reserved282_IRQn             = 266,                /**< xxx Interrupt 282 */
+  LSIO_MU5_INT_A_IRQn          = 267,                /**< Shared Int Source MU5_INT_A from LSIO Sub-System */
+  LSIO_MU6_INT_A_IRQn          = 268,                /**< Shared Int Source MU6_INT_A from LSIO Sub-System */
+  LSIO_MU7_INT_A_IRQn          = 269,                /**< Shared Int Source MU7_INT_A from LSIO Sub-System */
+  LSIO_MU8_INT_A_IRQn          = 270,                /**< Shared Int Source MU8_INT_A from LSIO Sub-System */
+  LSIO_MU9_INT_A_IRQn          = 271,                /**< Shared Int Source MU9_INT_A from LSIO Sub-System */
+  LSIO_MU10_INT_A_IRQn         = 272,                /**< Shared Int Source MU10_INT_A from LSIO Sub-System */
+  LSIO_MU11_INT_A_IRQn         = 273,                /**< Shared Int Source MU11_INT_A from LSIO Sub-System */
+  LSIO_MU12_INT_A_IRQn         = 274,                /**< Shared Int Source MU12_INT_A from LSIO Sub-System */
+  LSIO_MU13_INT_A_IRQn         = 275,                /**< Shared Int Source MU13_INT_A from LSIO Sub-System */
+  Reserved292_IRQn             = 276,                /**< xxx Interrupt 292 */
+  Reserved293_IRQn             = 277,                /**< xxx Interrupt 293 */
+  Reserved294_IRQn             = 278,                /**< xxx Interrupt 294 */
+  Reserved295_IRQn             = 279,                /**< xxx Interrupt 295 */
+  Reserved296_IRQn             = 280,                /**< xxx Interrupt 296 */
+  Reserved297_IRQn             = 281,                /**< xxx Interrupt 297 */
+  Reserved298_IRQn             = 282,                /**< xxx Interrupt 298 */
+  LSIO_MU5_INT_B_IRQn          = 283,                /**< Shared Int Source MU5_INT_B from LSIO Sub-System */
+  LSIO_MU6_INT_B_IRQn          = 284,                /**< Shared Int Source MU6_INT_B from LSIO Sub-System */
+  LSIO_MU7_INT_B_IRQn          = 285,                /**< Shared Int Source MU7_INT_B from LSIO Sub-System */
+  LSIO_MU8_INT_B_IRQn          = 286,                /**< Shared Int Source MU8_INT_B from LSIO Sub-System */
+  LSIO_MU9_INT_B_IRQn          = 287,                /**< Shared Int Source MU9_INT_B from LSIO Sub-System */
+  LSIO_MU10_INT_B_IRQn         = 288,                /**< Shared Int Source MU10_INT_B from LSIO Sub-System */
+  LSIO_MU11_INT_B_IRQn         = 289,                /**< Shared Int Source MU11_INT_B from LSIO Sub-System */
+  LSIO_MU12_INT_B_IRQn         = 290,                /**< Shared Int Source MU12_INT_B from LSIO Sub-System */
+  LSIO_MU13_INT_B_IRQn         = 291,                /**< Shared Int Source MU13_INT_B from LSIO Sub-System */
+  Reserved308_IRQn             = 292,                /**< xxx Interrupt 308 */
+  Reserved309_IRQn             = 293,                /**< xxx Interrupt 309 */
+  Reserved310_IRQn             = 294,                /**< xxx Interrupt 310 */
+  Reserved311_IRQn             = 295,                /**< xxx Interrupt 311 */
+  Reserved312_IRQn             = 296,                /**< xxx Interrupt 312 */
+  Reserved313_IRQn             = 297,                /**< xxx Interrupt 313 */
+  Reserved314_IRQn             = 298,                /**< xxx Interrupt 314 */
+  DMA_SPI0_INT_IRQn            = 299,                /**< Shared Int Source SPI0_INT from DMA Sub-System */
+  DMA_SPI1_INT_IRQn            = 300,                /**< Shared Int Source SPI1_INT from DMA Sub-System */
+  DMA_SPI2_INT_IRQn            = 301,                /**< Shared Int Source SPI2_INT from DMA Sub-System */
+  DMA_SPI3_INT_IRQn            = 302,                /**< Shared Int Source SPI3_INT from DMA Sub-System */
+  DMA_I2C0_INT_IRQn            = 303,                /**< Shared Int Source I2C0_INT from DMA Sub-System */
+  DMA_I2C1_INT_IRQn            = 304,                /**< Shared Int Source I2C1_INT from DMA Sub-System */
+  DMA_I2C2_INT_IRQn            = 305,                /**< Shared Int Source I2C2_INT from DMA Sub-System */
+  DMA_I2C3_INT_IRQn            = 306,                /**< Shared Int Source I2C3_INT from DMA Sub-System */
+  DMA_I2C4_INT_IRQn            = 307,                /**< Shared Int Source I2C4_INT from DMA Sub-System */
+  DMA_UART0_INT_IRQn           = 308,                /**< Shared Int Source UART0_INT from DMA Sub-System */
+  DMA_UART1_INT_IRQn           = 309,                /**< Shared Int Source UART1_INT from DMA Sub-System */
+  DMA_UART2_INT_IRQn           = 310,                /**< Shared Int Source UART2_INT from DMA Sub-System */
+  DMA_UART3_INT_IRQn           = 311,                /**< Shared Int Source UART3_INT from DMA Sub-System */
+  DMA_UART4_INT_IRQn           = 312,                /**< Shared Int Source UART4_INT from DMA Sub-System */
+  DMA_SIM0_INT_IRQn            = 313,                /**< Shared Int Source SIM0_INT from DMA Sub-System */
+  DMA_SIM1_INT_IRQn            = 314,                /**< Shared Int Source SIM1_INT from DMA Sub-System */
+  CONNECTIVITY_USDHC0_INT_IRQn = 315,                /**< Shared Int Source uSDHC0_INT from Connectivity Sub-System */
+  CONNECTIVITY_USDHC1_INT_IRQn = 316,                /**< Shared Int Source uSDHC1_INT from Connectivity Sub-System */
+  CONNECTIVITY_USDHC2_INT_IRQn = 317,                /**< Shared Int Source uSDHC2_INT from Connectivity Sub-System */
+  DMA_FLEXCAN0_INT_IRQn        = 318,                /**< Shared Int Source FlexCAN0_INT from DMA Sub-System */
+  DMA_FLEXCAN1_INT_IRQn        = 319,                /**< Shared Int Source FlexCAN1_INT from DMA Sub-System */
+  DMA_FLEXCAN2_INT_IRQn        = 320,                /**< Shared Int Source FlexCAN2_INT from DMA Sub-System */
+  DMA_FTM0_INT_IRQn            = 321,                /**< Shared Int Source FTM0_INT from DMA Sub-System */
+  DMA_FTM1_INT_IRQn            = 322,                /**< Shared Int Source FTM1_INT from DMA Sub-System */
+  DMA_ADC0_INT_IRQn            = 323,                /**< Shared Int Source ADC0_INT from DMA Sub-System */
+  DMA_ADC1_INT_IRQn            = 324,                /**< Shared Int Source ADC1_INT from DMA Sub-System */
+  DMA_EXTERNAL_DMA_INT_0_IRQn  = 325,                /**< Shared Int Source EXTERNAL_DMA_INT_0 from DMA Sub-System */
+  DMA_EXTERNAL_DMA_INT_1_IRQn  = 326,                /**< Shared Int Source EXTERNAL_DMA_INT_1 from DMA Sub-System */
+  DMA_EXTERNAL_DMA_INT_2_IRQn  = 327,                /**< Shared Int Source EXTERNAL_DMA_INT_2 from DMA Sub-System */
+  DMA_EXTERNAL_DMA_INT_3_IRQn  = 328,                /**< Shared Int Source EXTERNAL_DMA_INT_3 from DMA Sub-System */
+  DMA_EXTERNAL_DMA_INT_4_IRQn  = 329,                /**< Shared Int Source EXTERNAL_DMA_INT_4 from DMA Sub-System */
+  DMA_EXTERNAL_DMA_INT_5_IRQn  = 330,                /**< Shared Int Source EXTERNAL_DMA_INT_5 from DMA Sub-System */
+  Reserved347_IRQn             = 331,                /**< xxx Interrupt 347 */
+  Reserved348_IRQn             = 332,                /**< xxx Interrupt 348 */
+  Reserved349_IRQn             = 333,                /**< xxx Interrupt 349 */
+  Reserved350_IRQn             = 334,                /**< xxx Interrupt 350 */
+  Reserved351_IRQn             = 335,                /**< xxx Interrupt 351 */
+  Reserved352_IRQn             = 336,                /**< xxx Interrupt 352 */
+  Reserved353_IRQn             = 337,                /**< xxx Interrupt 353 */
+  Reserved354_IRQn             = 338,                /**< xxx Interrupt 354 */
+  CONNECTIVITY_ENET0_FRAME1_INT_IRQn= 339,           /**< Shared Int Source ENET0_FRAME1_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET0_FRAME2_INT_IRQn= 340,           /**< Shared Int Source ENET0_FRAME2_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQn= 341,     /**< Shared Int Source ENET0_FRAME0_EVENT_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET0_TIMER_INT_IRQn= 342,            /**< Shared Int Source ENET0_TIMER_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET1_FRAME1_INT_IRQn= 343,           /**< Shared Int Source ENET1_FRAME1_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET1_FRAME2_INT_IRQn= 344,           /**< Shared Int Source ENET1_FRAME2_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQn= 345,     /**< Shared Int Source ENET1_FRAME0_EVENT_INT from Connectivity Sub-System */
+  CONNECTIVITY_ENET1_TIMER_INT_IRQn= 346,            /**< Shared Int Source ENET1_TIMER_INT from Connectivity Sub-System */
+  CONNECTIVITY_DTCP_INT_IRQn   = 347,                /**< Shared Int Source DTCP_INT from Connectivity Sub-System */
+  CONNECTIVITY_MLB_INT_IRQn    = 348,                /**< Shared Int Source MLB_INT from Connectivity Sub-System */
+  CONNECTIVITY_MLB_AHB_INT_IRQn= 349,                /**< Shared Int Source MLB_AHB_INT from Connectivity Sub-System */
+  CONNECTIVITY_USB_OTG_INT_IRQn= 350,                /**< Shared Int Source USB_OTG_INT from Connectivity Sub-System */
+  CONNECTIVITY_USB_HOST_INT_IRQn= 351,               /**< Shared Int Source USB_HOST_INT from Connectivity Sub-System */
+  CONNECTIVITY_UTMI_INT_IRQn   = 352,                /**< Shared Int Source UTMI_INT from Connectivity Sub-System */
+  CONNECTIVITY_WAKEUP_INT_IRQn = 353,                /**< Shared Int Source WAKEUP_INT from Connectivity Sub-System */
+  CONNECTIVITY_USB3_INT_IRQn   = 354,                /**< Shared Int Source USB3_INT from Connectivity Sub-System */
+  CONNECTIVITY_ND_FLASH_BCH_INT_IRQn= 355,           /**< Shared Int Source ND_FLASH_BCH_INT from Connectivity Sub-System */
+  CONNECTIVITY_ND_FLASH_GPMI_INT_IRQn= 356,          /**< Shared Int Source ND_FLASH_GPMI_INT from Connectivity Sub-System */
+  CONNECTIVITY_APBHDMA_IRQn    = 357,                /**< Shared Int Source APBHDMA from Connectivity Sub-System */
+  CONNECTIVITY_DMA_INT_IRQn    = 358,                /**< Shared Int Source DMA_INT from Connectivity Sub-System */
+  CONNECTIVITY_DMA_ERR_INT_IRQn= 359,                /**< Shared Int Source DMA_ERR_INT from Connectivity Sub-System */
+  Reserved376_IRQn             = 360,                /**< xxx Interrupt 376 */
+  Reserved377_IRQn             = 361,                /**< xxx Interrupt 377 */
+  Reserved378_IRQn             = 362,                /**< xxx Interrupt 378 */
+  Reserved379_IRQn             = 363,                /**< xxx Interrupt 379 */
+  Reserved380_IRQn             = 364,                /**< xxx Interrupt 380 */
+  Reserved381_IRQn             = 365,                /**< xxx Interrupt 381 */
+  Reserved382_IRQn             = 366,                /**< xxx Interrupt 382 */
+  Reserved383_IRQn             = 367,                /**< xxx Interrupt 383 */
+  Reserved384_IRQn             = 368,                /**< xxx Interrupt 384 */
+  Reserved385_IRQn             = 369,                /**< xxx Interrupt 385 */
+  Reserved386_IRQn             = 370,                /**< xxx Interrupt 386 */
+  IMAGING_MSI_INT_IRQn         = 371,                /**< Shared Int Source MSI_INT from Imaging Sub-System */
+  Reserved388_IRQn             = 372,                /**< xxx Interrupt 388 */
+  Reserved389_IRQn             = 373,                /**< xxx Interrupt 389 */
+  Reserved390_IRQn             = 374,                /**< xxx Interrupt 390 */
+  Reserved391_IRQn             = 375,                /**< xxx Interrupt 391 */
+  Reserved392_IRQn             = 376,                /**< xxx Interrupt 392 */
+  Reserved393_IRQn             = 377,                /**< xxx Interrupt 393 */
+  Reserved394_IRQn             = 378,                /**< xxx Interrupt 394 */
+  Reserved395_IRQn             = 379,                /**< xxx Interrupt 395 */
+  IMAGING_PDMA_STREAM0_INT_IRQn= 380,                /**< Shared Int Source PDMA_STREAM0_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM1_INT_IRQn= 381,                /**< Shared Int Source PDMA_STREAM1_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM2_INT_IRQn= 382,                /**< Shared Int Source PDMA_STREAM2_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM3_INT_IRQn= 383,                /**< Shared Int Source PDMA_STREAM3_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM4_INT_IRQn= 384,                /**< Shared Int Source PDMA_STREAM4_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM5_INT_IRQn= 385,                /**< Shared Int Source PDMA_STREAM5_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM6_INT_IRQn= 386,                /**< Shared Int Source PDMA_STREAM6_INT from Imaging Sub-System */
+  IMAGING_PDMA_STREAM7_INT_IRQn= 387,                /**< Shared Int Source PDMA_STREAM7_INT from Imaging Sub-System */
+  IMAGING_MJPEG_ENC0_INT_IRQn  = 388,                /**< Shared Int Source MJPEG_ENC0_INT from Imaging Sub-System */
+  IMAGING_MJPEG_ENC1_INT_IRQn  = 389,                /**< Shared Int Source MJPEG_ENC1_INT from Imaging Sub-System */
+  IMAGING_MJPEG_ENC2_INT_IRQn  = 390,                /**< Shared Int Source MJPEG_ENC2_INT from Imaging Sub-System */
+  IMAGING_MJPEG_ENC3_INT_IRQn  = 391,                /**< Shared Int Source MJPEG_ENC3_INT from Imaging Sub-System */
+  IMAGING_MJPEG_DEC0_INT_IRQn  = 392,                /**< Shared Int Source MJPEG_DEC0_INT from Imaging Sub-System */
+  IMAGING_MJPEG_DEC1_INT_IRQn  = 393,                /**< Shared Int Source MJPEG_DEC1_INT from Imaging Sub-System */
+  IMAGING_MJPEG_DEC2_INT_IRQn  = 394,                /**< Shared Int Source MJPEG_DEC2_INT from Imaging Sub-System */
+  IMAGING_MJPEG_DEC3_INT_IRQn  = 395,                /**< Shared Int Source MJPEG_DEC3_INT from Imaging Sub-System */
+  Reserved412_IRQn             = 396,                /**< xxx Interrupt 412 */
+  AUDIO_SAI0_MOD_INT_IRQn      = 397,                /**< Shared Int Source SAI0_MOD_INT from Audio Sub-System */
+  AUDIO_SAI0_DMA_INT_IRQn      = 398,                /**< Shared Int Source SAI0_DMA_INT from Audio Sub-System */
+  AUDIO_SAI1_MOD_INT_IRQn      = 399,                /**< Shared Int Source SAI1_MOD_INT from Audio Sub-System */
+  AUDIO_SAI1_DMA_INT_IRQn      = 400,                /**< Shared Int Source SAI1_DMA_INT from Audio Sub-System */
+  AUDIO_SAI2_MOD_INT_IRQn      = 401,                /**< Shared Int Source SAI2_MOD_INT from Audio Sub-System */
+  AUDIO_SAI2_DMA_INT_IRQn      = 402,                /**< Shared Int Source SAI2_DMA_INT from Audio Sub-System */
+  MIPI_CSI0_OUT_INT_IRQn       = 403,                /**< Shared Int Source OUT_INT from MIPI_CSI0 Sub-System */
+  MIPI_CSI1_OUT_INT_IRQn       = 404,                /**< Shared Int Source OUT_INT from MIPI_CSI1 Sub-System */
+  HDMI_RX_OUT_INT_IRQn         = 405,                /**< Shared Int Source OUT_INT from HDMI_RX Sub-System */
+  AUDIO_SAI3_MOD_INT_IRQn      = 406,                /**< Shared Int Source SAI3_MOD_INT from Audio Sub-System */
+  AUDIO_SAI3_DMA_INT_IRQn      = 407,                /**< Shared Int Source SAI3_DMA_INT from Audio Sub-System */
+  AUDIO_SAI_HDMI_RX_MOD_INT_IRQn= 408,               /**< Shared Int Source SAI_HDMI_RX_MOD_INT from Audio Sub-System */
+  AUDIO_SAI_HDMI_RX_DMA_INT_IRQn= 409,               /**< Shared Int Source SAI_HDMI_RX_DMA_INT from Audio Sub-System */
+  AUDIO_SAI_HDMI_TX_MOD_INT_IRQn= 410,               /**< Shared Int Source SAI_HDMI_TX_MOD_INT from Audio Sub-System */
+  AUDIO_SAI_HDMI_TX_DMA_INT_IRQn= 411,               /**< Shared Int Source SAI_HDMI_TX_DMA_INT from Audio Sub-System */
+  AUDIO_SAI6_MOD_INT_IRQn      = 412,                /**< Shared Int Source SAI6_MOD_INT from Audio Sub-System */
+  AUDIO_SAI6_DMA_INT_IRQn      = 413,                /**< Shared Int Source SAI6_DMA_INT from Audio Sub-System */
+  AUDIO_SAI7_MOD_INT_IRQn      = 414,                /**< Shared Int Source SAI7_MOD_INT from Audio Sub-System */
+  AUDIO_SAI7_DMA_INT_IRQn      = 415,                /**< Shared Int Source SAI7_DMA_INT from Audio Sub-System */
+  Reserved432_IRQn             = 416,                /**< xxx Interrupt 432 */
+  Reserved433_IRQn             = 417,                /**< xxx Interrupt 433 */
+  Reserved434_IRQn             = 418,                /**< xxx Interrupt 434 */
+  DMA_SPI0_MOD_INT_IRQn        = 419,                /**< Shared Int Source SPI0_MOD_INT from DMA Sub-System */
+  DMA_SPI1_MOD_INT_IRQn        = 420,                /**< Shared Int Source SPI1_MOD_INT from DMA Sub-System */
+  DMA_SPI2_MOD_INT_IRQn        = 421,                /**< Shared Int Source SPI2_MOD_INT from DMA Sub-System */
+  DMA_SPI3_MOD_INT_IRQn        = 422,                /**< Shared Int Source SPI3_MOD_INT from DMA Sub-System */
+  DMA_I2C0_MOD_INT_IRQn        = 423,                /**< Shared Int Source I2C0_MOD_INT from DMA Sub-System */
+  DMA_I2C1_MOD_INT_IRQn        = 424,                /**< Shared Int Source I2C1_MOD_INT from DMA Sub-System */
+  DMA_I2C2_MOD_INT_IRQn        = 425,                /**< Shared Int Source I2C2_MOD_INT from DMA Sub-System */
+  DMA_I2C3_MOD_INT_IRQn        = 426,                /**< Shared Int Source I2C3_MOD_INT from DMA Sub-System */
+  DMA_I2C4_MOD_INT_IRQn        = 427,                /**< Shared Int Source I2C4_MOD_INT from DMA Sub-System */
+  DMA_UART0_MOD_INT_IRQn       = 428,                /**< Shared Int Source UART0_MOD_INT from DMA Sub-System */
+  DMA_UART1_MOD_INT_IRQn       = 429,                /**< Shared Int Source UART1_MOD_INT from DMA Sub-System */
+  DMA_UART2_MOD_INT_IRQn       = 430,                /**< Shared Int Source UART2_MOD_INT from DMA Sub-System */
+  DMA_UART3_MOD_INT_IRQn       = 431,                /**< Shared Int Source UART3_MOD_INT from DMA Sub-System */
+  DMA_UART4_MOD_INT_IRQn       = 432,                /**< Shared Int Source UART4_MOD_INT from DMA Sub-System */
+  DMA_SIM0_MOD_INT_IRQn        = 433,                /**< Shared Int Source SIM0_MOD_INT from DMA Sub-System */
+  DMA_SIM1_MOD_INT_IRQn        = 434,                /**< Shared Int Source SIM1_MOD_INT from DMA Sub-System */
+  DMA_FLEXCAN0_MOD_INT_IRQn    = 435,                /**< Shared Int Source FLEXCAN0_MOD_INT from DMA Sub-System */
+  DMA_FLEXCAN1_MOD_INT_IRQn    = 436,                /**< Shared Int Source FLEXCAN1_MOD_INT from DMA Sub-System */
+  DMA_FLEXCAN2_MOD_INT_IRQn    = 437,                /**< Shared Int Source FLEXCAN2_MOD_INT from DMA Sub-System */
+  DMA_FTM0_MOD_INT_IRQn        = 438,                /**< Shared Int Source FTM0_MOD_INT from DMA Sub-System */
+  DMA_FTM1_MOD_INT_IRQn        = 439,                /**< Shared Int Source FTM1_MOD_INT from DMA Sub-System */
+  DMA_ADC0_MOD_INT_IRQn        = 440,                /**< Shared Int Source ADC0_MOD_INT from DMA Sub-System */
+  DMA_ADC1_MOD_INT_IRQn        = 441,                /**< Shared Int Source ADC1_MOD_INT from DMA Sub-System */
+  DMA_FLEXCAN0_DMA_INT_IRQn    = 442,                /**< Shared Int Source FLEXCAN0_DMA_INT from DMA Sub-System */
+  DMA_FLEXCAN1_DMA_INT_IRQn    = 443,                /**< Shared Int Source FLEXCAN1_DMA_INT from DMA Sub-System */
+  DMA_FLEXCAN2_DMA_INT_IRQn    = 444,                /**< Shared Int Source FLEXCAN2_DMA_INT from DMA Sub-System */
+  DMA_FTM0_DMA_INT_IRQn        = 445,                /**< Shared Int Source FTM0_DMA_INT from DMA Sub-System */
+  DMA_FTM1_DMA_INT_IRQn        = 446,                /**< Shared Int Source FTM1_DMA_INT from DMA Sub-System */
+  DMA_ADC0_DMA_INT_IRQn        = 447,                /**< Shared Int Source ADC0_DMA_INT from DMA Sub-System */
+  DMA_ADC1_DMA_INT_IRQn        = 448,                /**< Shared Int Source ADC1_DMA_INT from DMA Sub-System */
+  Reserved465_IRQn             = 449,                /**< xxx Interrupt 465 */
+  Reserved466_IRQn             = 450,                /**< xxx Interrupt 466 */
+  AUDIO_EDMA0_INT_IRQn         = 451,                /**< Shared Int Source eDMA0_INT from Audio Sub-System */
+  AUDIO_EDMA0_ERR_INT_IRQn     = 452,                /**< Shared Int Source eDMA0_ERR_INT from Audio Sub-System */
+  AUDIO_EDMA1_INT_IRQn         = 453,                /**< Shared Int Source eDMA1_INT from Audio Sub-System */
+  AUDIO_EDMA1_ERR_INT_IRQn     = 454,                /**< Shared Int Source eDMA1_ERR_INT from Audio Sub-System */
+  AUDIO_ASRC0_INT1_IRQn        = 455,                /**< Shared Int Source ASRC0_INT1 from Audio Sub-System */
+  AUDIO_ASRC0_INT2_IRQn        = 456,                /**< Shared Int Source ASRC0_INT2 from Audio Sub-System */
+  AUDIO_DMA0_CH0_INT_IRQn      = 457,                /**< Shared Int Source DMA0_CH0_INT from Audio Sub-System */
+  AUDIO_DMA0_CH1_INT_IRQn      = 458,                /**< Shared Int Source DMA0_CH1_INT from Audio Sub-System */
+  AUDIO_DMA0_CH2_INT_IRQn      = 459,                /**< Shared Int Source DMA0_CH2_INT from Audio Sub-System */
+  AUDIO_DMA0_CH3_INT_IRQn      = 460,                /**< Shared Int Source DMA0_CH3_INT from Audio Sub-System */
+  AUDIO_DMA0_CH4_INT_IRQn      = 461,                /**< Shared Int Source DMA0_CH4_INT from Audio Sub-System */
+  AUDIO_DMA0_CH5_INT_IRQn      = 462,                /**< Shared Int Source DMA0_CH5_INT from Audio Sub-System */
+  AUDIO_ASRC1_INT1_IRQn        = 463,                /**< Shared Int Source ASRC1_INT1 from Audio Sub-System */
+  AUDIO_ASRC1_INT2_IRQn        = 464,                /**< Shared Int Source ASRC1_INT2 from Audio Sub-System */
+  AUDIO_DMA1_CH0_INT_IRQn      = 465,                /**< Shared Int Source DMA1_CH0_INT from Audio Sub-System */
+  AUDIO_DMA1_CH1_INT_IRQn      = 466,                /**< Shared Int Source DMA1_CH1_INT from Audio Sub-System */
+  AUDIO_DMA1_CH2_INT_IRQn      = 467,                /**< Shared Int Source DMA1_CH2_INT from Audio Sub-System */
+  AUDIO_DMA1_CH3_INT_IRQn      = 468,                /**< Shared Int Source DMA1_CH3_INT from Audio Sub-System */
+  AUDIO_DMA1_CH4_INT_IRQn      = 469,                /**< Shared Int Source DMA1_CH4_INT from Audio Sub-System */
+  AUDIO_DMA1_CH5_INT_IRQn      = 470,                /**< Shared Int Source DMA1_CH5_INT from Audio Sub-System */
+  AUDIO_ESAI0_INT_IRQn         = 471,                /**< Shared Int Source ESAI0_INT from Audio Sub-System */
+  AUDIO_ESAI1_INT_IRQn         = 472,                /**< Shared Int Source ESAI1_INT  from Audio Sub-System */
+  AUDIO_UNUSED_IRQn            = 473,                /**< Shared Int Source Unused from Audio Sub-System */
+  AUDIO_GPT0_INT_IRQn          = 474,                /**< Shared Int Source GPT0_INT from Audio Sub-System */
+  AUDIO_GPT1_INT_IRQn          = 475,                /**< Shared Int Source GPT1_INT from Audio Sub-System */
+  AUDIO_GPT2_INT_IRQn          = 476,                /**< Shared Int Source GPT2_INT from Audio Sub-System */
+  AUDIO_GPT3_INT_IRQn          = 477,                /**< Shared Int Source GPT3_INT from Audio Sub-System */
+  AUDIO_GPT4_INT_IRQn          = 478,                /**< Shared Int Source GPT4_INT from Audio Sub-System */
+  AUDIO_GPT5_INT_IRQn          = 479,                /**< Shared Int Source GPT5_INT from Audio Sub-System */
+  AUDIO_SAI0_INT_IRQn          = 480,                /**< Shared Int Source SAI0_INT from Audio Sub-System */
+  AUDIO_SAI1_INT_IRQn          = 481,                /**< Shared Int Source SAI1_INT from Audio Sub-System */
+  AUDIO_SAI2_INT_IRQn          = 482,                /**< Shared Int Source SAI2_INT from Audio Sub-System */
+  AUDIO_SAI3_INT_IRQn          = 483,                /**< Shared Int Source SAI3_INT from Audio Sub-System */
+  AUDIO_SAI_HDMI_RX_INT_IRQn   = 484,                /**< Shared Int Source SAI_HDMI_RX_INT from Audio Sub-System */
+  AUDIO_SAI_HDMI_TX_INT_IRQn   = 485,                /**< Shared Int Source SAI_HDMI_TX_INT from Audio Sub-System */
+  AUDIO_SAI6_INT_IRQn          = 486,                /**< Shared Int Source SAI6_INT from Audio Sub-System */
+  AUDIO_SAI7_INT_IRQn          = 487,                /**< Shared Int Source SAI7_INT from Audio Sub-System */
+  AUDIO_SPDIF0_RX_INT_IRQn     = 488,                /**< Shared Int Source SPDIF0_RX_INT from Audio Sub-System */
+  AUDIO_SPDIF0_TX_INT_IRQn     = 489,                /**< Shared Int Source SPDIF0_TX_INT from Audio Sub-System */
+  AUDIO_SPDIF1_RX_INT_IRQn     = 490,                /**< Shared Int Source SPDIF1_RX_INT from Audio Sub-System */
+  AUDIO_SPDIF1_TX_INT_IRQn     = 491,                /**< Shared Int Source SPDIF1_TX_INT from Audio Sub-System */
+  AUDIO_ESAI0_MOD_INT_IRQn     = 492,                /**< Shared Int Source ESAI0_MOD_INT from Audio Sub-System */
+  AUDIO_ESAI0_DMA_INT_IRQn     = 493,                /**< Shared Int Source ESAI0_DMA_INT from Audio Sub-System */
+  AUDIO_ESAI1_MOD_INT_IRQn     = 494,                /**< Shared Int Source ESAI1_MOD_INT from Audio Sub-System */
+  AUDIO_ESAI1_DMA_INT_IRQn     = 495,                /**< Shared Int Source ESAI1_DMA_INT from Audio Sub-System */
+  Reserved512_IRQn             = 496,                /**< xxx Interrupt 512 */
+  Reserved513_IRQn             = 497,                /**< xxx Interrupt 513 */
+  Reserved514_IRQn             = 498,                /**< xxx Interrupt 514 */
+  DMA_SPI0_DMA_RX_INT_IRQn     = 499,                /**< Shared Int Source SPI0_DMA_RX_INT from DMA Sub-System */
+  DMA_SPI0_DMA_TX_INT_IRQn     = 500,                /**< Shared Int Source SPI0_DMA_TX_INT from DMA Sub-System */
+  DMA_SPI1_DMA_RX_INT_IRQn     = 501,                /**< Shared Int Source SPI1_DMA_RX_INT from DMA Sub-System */
+  DMA_SPI1_DMA_TX_INT_IRQn     = 502,                /**< Shared Int Source SPI1_DMA_TX_INT from DMA Sub-System */
+  DMA_SPI2_DMA_RX_INT_IRQn     = 503,                /**< Shared Int Source SPI2_DMA_RX_INT from DMA Sub-System */
+  DMA_SPI2_DMA_TX_INT_IRQn     = 504,                /**< Shared Int Source SPI2_DMA_TX_INT from DMA Sub-System */
+  DMA_SPI3_DMA_RX_INT_IRQn     = 505,                /**< Shared Int Source SPI3_DMA_RX_INT from DMA Sub-System */
+  DMA_SPI3_DMA_TX_INT_IRQn     = 506,                /**< Shared Int Source SPI3_DMA_TX_INT from DMA Sub-System */
+  DMA_I2C0_DMA_RX_INT_IRQn     = 507,                /**< Shared Int Source I2C0_DMA_RX_INT from DMA Sub-System */
+  DMA_I2C0_DMA_TX_INT_IRQn     = 508,                /**< Shared Int Source I2C0_DMA_TX_INT from DMA Sub-System */
+  DMA_I2C1_DMA_RX_INT_IRQn     = 509,                /**< Shared Int Source I2C1_DMA_RX_INT from DMA Sub-System */
+  DMA_I2C1_DMA_TX_INT_IRQn     = 510,                /**< Shared Int Source I2C1_DMA_TX_INT from DMA Sub-System */
+  DMA_I2C2_DMA_RX_INT_IRQn     = 511,                /**< Shared Int Source I2C2_DMA_RX_INT from DMA Sub-System */
+  DMA_I2C2_DMA_TX_INT_IRQn     = 512,                /**< Shared Int Source I2C2_DMA_TX_INT from DMA Sub-System */
+  DMA_I2C3_DMA_RX_INT_IRQn     = 513,                /**< Shared Int Source I2C3_DMA_RX_INT from DMA Sub-System */
+  DMA_I2C3_DMA_TX_INT_IRQn     = 514,                /**< Shared Int Source I2C3_DMA_TX_INT from DMA Sub-System */
+  DMA_I2C4_DMA_RX_INT_IRQn     = 515,                /**< Shared Int Source I2C4_DMA_RX_INT from DMA Sub-System */
+  DMA_I2C4_DMA_TX_INT_IRQn     = 516,                /**< Shared Int Source I2C4_DMA_TX_INT from DMA Sub-System */
+  DMA_UART0_DMA_RX_INT_IRQn    = 517,                /**< Shared Int Source UART0_DMA_RX_INT from DMA Sub-System */
+  DMA_UART0_DMA_TX_INT_IRQn    = 518,                /**< Shared Int Source UART0_DMA_TX_INT from DMA Sub-System */
+  DMA_UART1_DMA_RX_INT_IRQn    = 519,                /**< Shared Int Source UART1_DMA_RX_INT from DMA Sub-System */
+  DMA_UART1_DMA_TX_INT_IRQn    = 520,                /**< Shared Int Source UART1_DMA_TX_INT from DMA Sub-System */
+  DMA_UART2_DMA_RX_INT_IRQn    = 521,                /**< Shared Int Source UART2_DMA_RX_INT from DMA Sub-System */
+  DMA_UART2_DMA_TX_INT_IRQn    = 522,                /**< Shared Int Source UART2_DMA_TX_INT from DMA Sub-System */
+  DMA_UART3_DMA_RX_INT_IRQn    = 523,                /**< Shared Int Source UART3_DMA_RX_INT from DMA Sub-System */
+  DMA_UART3_DMA_TX_INT_IRQn    = 524,                /**< Shared Int Source UART3_DMA_TX_INT from DMA Sub-System */
+  DMA_UART4_DMA_RX_INT_IRQn    = 525,                /**< Shared Int Source UART4_DMA_RX_INT from DMA Sub-System */
+  DMA_UART4_DMA_TX_INT_IRQn    = 526,                /**< Shared Int Source UART4_DMA_TX_INT from DMA Sub-System */
+  DMA_SIM0_DMA_RX_INT_IRQn     = 527,                /**< Shared Int Source SIM0_DMA_RX_INT from DMA Sub-System */
+  DMA_SIM0_DMA_TX_INT_IRQn     = 528,                /**< Shared Int Source SIM0_DMA_TX_INT from DMA Sub-System */
+  DMA_SIM1_DMA_RX_INT_IRQn     = 529,                /**< Shared Int Source SIM1_DMA_RX_INT from DMA Sub-System */
+  DMA_SIM1_DMA_TX_INT_IRQn     = 530,                /**< Shared Int Source SIM1_DMA_TX_INT from DMA Sub-System */
+  SECURITY_MU1_A_INT_IRQn      = 531,                /**< Shared Int Source MU1_A_INT from Security Sub-System */
+  SECURITY_MU2_A_INT_IRQn      = 532,                /**< Shared Int Source MU2_A_INT from Security Sub-System */
+  SECURITY_MU3_A_INT_IRQn      = 533,                /**< Shared Int Source MU3_A_INT from Security Sub-System */
+  SECURITY_CAAM_INT0_IRQn      = 534,                /**< Shared Int Source CAAM_INT0 from Security Sub-System */
+  SECURITY_CAAM_INT1_IRQn      = 535,                /**< Shared Int Source CAAM_INT1 from Security Sub-System */
+  SECURITY_CAAM_INT2_IRQn      = 536,                /**< Shared Int Source CAAM_INT2 from Security Sub-System */
+  SECURITY_CAAM_INT3_IRQn      = 537,                /**< Shared Int Source CAAM_INT3 from Security Sub-System */
+  SECURITY_CAAM_RTIC_INT_IRQn  = 538,                /**< Shared Int Source CAAM_RTIC_INT from Security Sub-System */
+  AUDIO_SPDIF0_RX_MOD_INT_IRQn = 539,                /**< Shared Int Source SPDIF0_RX_MOD_INT from Audio Sub-System */
+  AUDIO_SPDIF0_RX_DMA_INT_IRQn = 540,                /**< Shared Int Source SPDIF0_RX_DMA_INT from Audio Sub-System */
+  AUDIO_SPDIF0_TX_MOD_INT_IRQn = 541,                /**< Shared Int Source SPDIF0_TX_MOD_INT from Audio Sub-System */
+  AUDIO_SPDIF0_TX_DMA_INT_IRQn = 542,                /**< Shared Int Source SPDIF0_TX_DMA_INT from Audio Sub-System */
+  AUDIO_SPDIF1_RX_MOD_INT_IRQn = 543,                /**< Shared Int Source SPDIF1_RX_MOD_INT from Audio Sub-System */
+  AUDIO_SPDIF1_RX_DMA_INT_IRQn = 544,                /**< Shared Int Source SPDIF1_RX_DMA_INT from Audio Sub-System */
+  AUDIO_SPDIF1_TX_MOD_INT_IRQn = 545,                /**< Shared Int Source SPDIF1_TX_MOD_INT from Audio Sub-System */
+  AUDIO_SPDIF1_TX_DMA_INT_IRQn = 546,                /**< Shared Int Source SPDIF1_TX_DMA_INT from Audio Sub-System */
+  VPU_VPU_INT_0_IRQn           = 547,                /**< Shared Int Source VPU_INT_0 from VPU Sub-System */
+  VPU_VPU_INT_1_IRQn           = 548,                /**< Shared Int Source VPU_INT_1 from VPU Sub-System */
+  VPU_VPU_INT_2_IRQn           = 549,                /**< Shared Int Source VPU_INT_2 from VPU Sub-System */
+  VPU_VPU_INT_3_IRQn           = 550,                /**< Shared Int Source VPU_INT_3 from VPU Sub-System */
+  VPU_VPU_INT_4_IRQn           = 551,                /**< Shared Int Source VPU_INT_4 from VPU Sub-System */
+  VPU_VPU_INT_5_IRQn           = 552,                /**< Shared Int Source VPU_INT_5 from VPU Sub-System */
+  VPU_VPU_INT_6_IRQn           = 553,                /**< Shared Int Source VPU_INT_6 from VPU Sub-System */
+  VPU_VPU_INT_7_IRQn           = 554,                /**< Shared Int Source VPU_INT_7 from VPU Sub-System */
+  Reserved571_IRQn             = 555,                /**< xxx Interrupt 571 */
+  Reserved572_IRQn             = 556,                /**< xxx Interrupt 572 */
+  Reserved573_IRQn             = 557,                /**< xxx Interrupt 573 */
+  Reserved574_IRQn             = 558,                /**< xxx Interrupt 574 */
+  Reserved575_IRQn             = 559,                /**< xxx Interrupt 575 */
+  Reserved576_IRQn             = 560,                /**< xxx Interrupt 576 */
+  Reserved577_IRQn             = 561,                /**< xxx Interrupt 577 */
+  Reserved578_IRQn             = 562,                /**< xxx Interrupt 578 */
+  Reserved579_IRQn             = 563,                /**< xxx Interrupt 579 */
+  M4_0_INTMUX_SOURCE_TPM_IRQn  = 564,                /**< INTMUX Input source: TPM Interrupt */
+  Reserved581_IRQn             = 565,                /**< xxx Interrupt 581 */
+  Reserved582_IRQn             = 566,                /**< xxx Interrupt 582 */
+  M4_0_INTMUX_SOURCE_LPIT_IRQn = 567,                /**< INTMUX Input source: LPIT Interrupt */
+  Reserved584_IRQn             = 568,                /**< xxx Interrupt 584 */
+  Reserved585_IRQn             = 569,                /**< xxx Interrupt 585 */
+  M4_0_INTMUX_SOURCE_LPUART_IRQn= 570,               /**< INTMUX Input source: LPUART Interrupt */
+  Reserved587_IRQn             = 571,                /**< xxx Interrupt 587 */
+  M4_0_INTMUX_SOURCE_LPI2C_IRQn= 572,                /**< INTMUX Input source: LPI2C Interrupt */
+  Reserved589_IRQn             = 573,                /**< xxx Interrupt 589 */
+  Reserved590_IRQn             = 574,                /**< xxx Interrupt 590 */
+  Reserved591_IRQn             = 575,                /**< xxx Interrupt 591 */
+  Reserved592_IRQn             = 576,                /**< xxx Interrupt 592 */
+  Reserved593_IRQn             = 577,                /**< xxx Interrupt 593 */
+  Reserved594_IRQn             = 578,                /**< xxx Interrupt 594 */
+  Reserved595_IRQn             = 579,                /**< xxx Interrupt 595 */
+  Reserved596_IRQn             = 580,                /**< xxx Interrupt 596 */
+  Reserved597_IRQn             = 581,                /**< xxx Interrupt 597 */
+  Reserved598_IRQn             = 582,                /**< xxx Interrupt 598 */
+  Reserved599_IRQn             = 583,                /**< xxx Interrupt 599 */
+  Reserved600_IRQn             = 584,                /**< xxx Interrupt 600 */
+  Reserved601_IRQn             = 585,                /**< xxx Interrupt 601 */
+  Reserved602_IRQn             = 586,                /**< xxx Interrupt 602 */
+  Reserved603_IRQn             = 587,                /**< xxx Interrupt 603 */
+  Reserved604_IRQn             = 588,                /**< xxx Interrupt 604 */
+  Reserved605_IRQn             = 589,                /**< xxx Interrupt 605 */
+  Reserved606_IRQn             = 590,                /**< xxx Interrupt 606 */
+  M4_0_INTMUX_SOURCE_MU0_A3_IRQn= 591,               /**< INTMUX Input source: MU0_A3 Interrupt */
+  M4_0_INTMUX_SOURCE_MU0_A2_IRQn= 592,               /**< INTMUX Input source: MU0_A2 Interrupt */
+  M4_0_INTMUX_SOURCE_MU0_A1_IRQn= 593,               /**< INTMUX Input source: MU0_A1 Interrupt */
+  M4_0_INTMUX_SOURCE_MU0_A0_IRQn= 594                /**< INTMUX Input source: MU0_A0 Interrupt */
+} IRQn_Type;
+
+/*!
+ * @}
+ */ /* end of group Interrupt_vector_numbers */
+
+/* ----------------------------------------------------------------------------
+   -- Cortex M4 Core Configuration
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup Cortex_Core_Configuration Cortex M4 Core Configuration
+ * @{
+ */
+
+#define __MPU_PRESENT                  1         /**< Defines if an MPU is present or not */
+#define __NVIC_PRIO_BITS               4         /**< Number of priority bits implemented in the NVIC */
+#define __Vendor_SysTickConfig         0         /**< Vendor specific implementation of SysTickConfig is defined */
+#define __FPU_PRESENT                  1         /**< Defines if an FPU is present or not */
+
+#include "core_cm4.h"                  /* Core Peripheral Access Layer */
+#include "system_MIMX8QM6_cm4_core0.h" /* Device specific configuration file */
+
+/*!
+ * @}
+ */ /* end of group Cortex_Core_Configuration */
+
+/* ----------------------------------------------------------------------------
+   -- Mapping Information
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup Mapping_Information Mapping Information
+ * @{
+ */
+
+/** Mapping Information */
+/*!
+ * @brief Power mode of the other core, MU_SR[PM].
+ */
+typedef enum _mu_power_mode
+{
+    kMU_PowerModeRun  = 0x00U, /**< Run mode. */
+    kMU_PowerModeWait = 0x01U, /**< WAIT mode. */
+    kMU_PowerModeStop = 0x02U, /**< STOP mode. */
+    kMU_PowerModeDsm  = 0x03U, /**< DSM mode. */
+} mu_power_mode_t;
+
+/*!
+ * @brief Boot mode of the other core, MU_CR[BOOT].
+ */
+typedef enum _mu_core_boot_mode
+{
+    kMU_CoreBootFromAddr0 = 0x00U, /**< Boot from 0x00. */
+    kMU_CoreBootFromDmem  = 0x01U, /**< Boot from DMEM base. */
+    kMU_CoreBootFromImem  = 0x02U, /**< Boot from IMEM base. */
+} mu_core_boot_mode_t;
+
+/*!
+ * @}
+ */ /* end of group Mapping_Information */
+
+/* ----------------------------------------------------------------------------
+   -- Device Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup Peripheral_access_layer Device Peripheral Access Layer
+ * @{
+ */
+
+/* ----------------------------------------------------------------------------
+   -- DMA Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup DMA_Peripheral_Access_Layer DMA Peripheral Access Layer
+ * @{
+ */
+
+/** DMA - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t MP_CSR;                            /**< Management Page Control, offset: 0x0 */
+  __I  uint32_t MP_ES;                             /**< Management Page Error Status, offset: 0x4 */
+  __I  uint32_t MP_INT;                            /**< Management Page Interrupt Request Status, offset: 0x8 */
+  __I  uint32_t MP_HRS;                            /**< Management Page Hardware Request Status, offset: 0xC */
+       uint8_t RESERVED_0[240];
+  __IO uint32_t CH_GRPRI[32];                      /**< Channel Arbitration Group, array offset: 0x100, array step: 0x4 */
+       uint8_t RESERVED_1[65152];
+  struct {                                         /* offset: 0x10000, array step: 0x10000 */
+    __IO uint32_t CH_CSR;                            /**< Channel Control and Status, array offset: 0x10000, array step: 0x10000 */
+    __IO uint32_t CH_ES;                             /**< Channel Error Status, array offset: 0x10004, array step: 0x10000 */
+    __IO uint32_t CH_INT;                            /**< Channel Interrupt Status, array offset: 0x10008, array step: 0x10000 */
+    __IO uint32_t CH_SBR;                            /**< Channel System Bus, array offset: 0x1000C, array step: 0x10000 */
+    __IO uint32_t CH_PRI;                            /**< Channel Priority, array offset: 0x10010, array step: 0x10000 */
+         uint8_t RESERVED_0[12];
+    __IO uint32_t TCD_SADDR;                         /**< TCD Source Address, array offset: 0x10020, array step: 0x10000 */
+    __IO uint16_t TCD_SOFF;                          /**< TCD Signed Source Address Offset, array offset: 0x10024, array step: 0x10000 */
+    __IO uint16_t TCD_ATTR;                          /**< TCD Transfer Attributes, array offset: 0x10026, array step: 0x10000 */
+    union {                                          /* offset: 0x10028, array step: 0x10000 */
+      __IO uint32_t TCD_NBYTES_MLOFFNO;                /**< TCD Transfer Size Without Minor Loop Offsets, array offset: 0x10028, array step: 0x10000 */
+      __IO uint32_t TCD_NBYTES_MLOFFYES;               /**< TCD Transfer Size with Minor Loop Offsets, array offset: 0x10028, array step: 0x10000 */
+    };
+    __IO uint32_t TCD_SLAST_SDA;                     /**< TCD Last Source Address Adjustment / Store DADDR Address, array offset: 0x1002C, array step: 0x10000 */
+    __IO uint32_t TCD_DADDR;                         /**< TCD Destination Address, array offset: 0x10030, array step: 0x10000 */
+    __IO uint16_t TCD_DOFF;                          /**< TCD Signed Destination Address Offset, array offset: 0x10034, array step: 0x10000 */
+    union {                                          /* offset: 0x10036, array step: 0x10000 */
+      __IO uint16_t TCD_CITER_ELINKNO;                 /**< TCD Current Minor Loop Link, Major Loop Count (Minor Loop Channel Linking Disabled), array offset: 0x10036, array step: 0x10000 */
+      __IO uint16_t TCD_CITER_ELINKYES;                /**< TCD Current Minor Loop Link, Major Loop Count (Minor Loop Channel Linking Enabled), array offset: 0x10036, array step: 0x10000 */
+    };
+    __IO uint32_t TCD_DLAST_SGA;                     /**< TCD Last Destination Address Adjustment / Scatter Gather Address, array offset: 0x10038, array step: 0x10000 */
+    __IO uint16_t TCD_CSR;                           /**< TCD Control and Status, array offset: 0x1003C, array step: 0x10000 */
+    union {                                          /* offset: 0x1003E, array step: 0x10000 */
+      __IO uint16_t TCD_BITER_ELINKNO;                 /**< TCD Beginning Minor Loop Link, Major Loop Count (Minor Loop Channel Linking Disabled), array offset: 0x1003E, array step: 0x10000 */
+      __IO uint16_t TCD_BITER_ELINKYES;                /**< TCD Beginning Minor Loop Link, Major Loop Count (Minor Loop Channel Linking Enabled), array offset: 0x1003E, array step: 0x10000 */
+    };
+         uint8_t RESERVED_1[65472];
+  } CH[32];
+} DMA_Type;
+
+/* ----------------------------------------------------------------------------
+   -- DMA Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup DMA_Register_Masks DMA Register Masks
+ * @{
+ */
+
+/*! @name MP_CSR */
+/*! @{ */
+#define DMA_MP_CSR_EBW_MASK                             (0x1U)
+#define DMA_MP_CSR_EBW_SHIFT                            (0U)
+#define DMA_MP_CSR_EBW(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_EBW_SHIFT)) & DMA_MP_CSR_EBW_MASK)
+#define DMA_MP_CSR_EDBG_MASK                            (0x2U)
+#define DMA_MP_CSR_EDBG_SHIFT                           (1U)
+#define DMA_MP_CSR_EDBG(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_EDBG_SHIFT)) & DMA_MP_CSR_EDBG_MASK)
+#define DMA_MP_CSR_ERCA_MASK                            (0x4U)
+#define DMA_MP_CSR_ERCA_SHIFT                           (2U)
+#define DMA_MP_CSR_ERCA(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_ERCA_SHIFT)) & DMA_MP_CSR_ERCA_MASK)
+#define DMA_MP_CSR_HAE_MASK                             (0x10U)
+#define DMA_MP_CSR_HAE_SHIFT                            (4U)
+#define DMA_MP_CSR_HAE(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_HAE_SHIFT)) & DMA_MP_CSR_HAE_MASK)
+#define DMA_MP_CSR_HALT_MASK                            (0x20U)
+#define DMA_MP_CSR_HALT_SHIFT                           (5U)
+#define DMA_MP_CSR_HALT(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_HALT_SHIFT)) & DMA_MP_CSR_HALT_MASK)
+#define DMA_MP_CSR_GCLC_MASK                            (0x40U)
+#define DMA_MP_CSR_GCLC_SHIFT                           (6U)
+#define DMA_MP_CSR_GCLC(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_GCLC_SHIFT)) & DMA_MP_CSR_GCLC_MASK)
+#define DMA_MP_CSR_GMRC_MASK                            (0x80U)
+#define DMA_MP_CSR_GMRC_SHIFT                           (7U)
+#define DMA_MP_CSR_GMRC(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_GMRC_SHIFT)) & DMA_MP_CSR_GMRC_MASK)
+#define DMA_MP_CSR_ECX_MASK                             (0x100U)
+#define DMA_MP_CSR_ECX_SHIFT                            (8U)
+#define DMA_MP_CSR_ECX(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_ECX_SHIFT)) & DMA_MP_CSR_ECX_MASK)
+#define DMA_MP_CSR_CX_MASK                              (0x200U)
+#define DMA_MP_CSR_CX_SHIFT                             (9U)
+#define DMA_MP_CSR_CX(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_CX_SHIFT)) & DMA_MP_CSR_CX_MASK)
+#define DMA_MP_CSR_ACTIVE_ID_MASK                       (0x1F000000U)
+#define DMA_MP_CSR_ACTIVE_ID_SHIFT                      (24U)
+#define DMA_MP_CSR_ACTIVE_ID(x)                         (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_ACTIVE_ID_SHIFT)) & DMA_MP_CSR_ACTIVE_ID_MASK)
+#define DMA_MP_CSR_ACTIVE_MASK                          (0x80000000U)
+#define DMA_MP_CSR_ACTIVE_SHIFT                         (31U)
+#define DMA_MP_CSR_ACTIVE(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_MP_CSR_ACTIVE_SHIFT)) & DMA_MP_CSR_ACTIVE_MASK)
+/*! @} */
+
+/*! @name MP_ES */
+/*! @{ */
+#define DMA_MP_ES_DBE_MASK                              (0x1U)
+#define DMA_MP_ES_DBE_SHIFT                             (0U)
+#define DMA_MP_ES_DBE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_DBE_SHIFT)) & DMA_MP_ES_DBE_MASK)
+#define DMA_MP_ES_SBE_MASK                              (0x2U)
+#define DMA_MP_ES_SBE_SHIFT                             (1U)
+#define DMA_MP_ES_SBE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_SBE_SHIFT)) & DMA_MP_ES_SBE_MASK)
+#define DMA_MP_ES_SGE_MASK                              (0x4U)
+#define DMA_MP_ES_SGE_SHIFT                             (2U)
+#define DMA_MP_ES_SGE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_SGE_SHIFT)) & DMA_MP_ES_SGE_MASK)
+#define DMA_MP_ES_NCE_MASK                              (0x8U)
+#define DMA_MP_ES_NCE_SHIFT                             (3U)
+#define DMA_MP_ES_NCE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_NCE_SHIFT)) & DMA_MP_ES_NCE_MASK)
+#define DMA_MP_ES_DOE_MASK                              (0x10U)
+#define DMA_MP_ES_DOE_SHIFT                             (4U)
+#define DMA_MP_ES_DOE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_DOE_SHIFT)) & DMA_MP_ES_DOE_MASK)
+#define DMA_MP_ES_DAE_MASK                              (0x20U)
+#define DMA_MP_ES_DAE_SHIFT                             (5U)
+#define DMA_MP_ES_DAE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_DAE_SHIFT)) & DMA_MP_ES_DAE_MASK)
+#define DMA_MP_ES_SOE_MASK                              (0x40U)
+#define DMA_MP_ES_SOE_SHIFT                             (6U)
+#define DMA_MP_ES_SOE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_SOE_SHIFT)) & DMA_MP_ES_SOE_MASK)
+#define DMA_MP_ES_SAE_MASK                              (0x80U)
+#define DMA_MP_ES_SAE_SHIFT                             (7U)
+#define DMA_MP_ES_SAE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_SAE_SHIFT)) & DMA_MP_ES_SAE_MASK)
+#define DMA_MP_ES_ECX_MASK                              (0x100U)
+#define DMA_MP_ES_ECX_SHIFT                             (8U)
+#define DMA_MP_ES_ECX(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_ECX_SHIFT)) & DMA_MP_ES_ECX_MASK)
+#define DMA_MP_ES_ERRCHN_MASK                           (0x1F000000U)
+#define DMA_MP_ES_ERRCHN_SHIFT                          (24U)
+#define DMA_MP_ES_ERRCHN(x)                             (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_ERRCHN_SHIFT)) & DMA_MP_ES_ERRCHN_MASK)
+#define DMA_MP_ES_VLD_MASK                              (0x80000000U)
+#define DMA_MP_ES_VLD_SHIFT                             (31U)
+#define DMA_MP_ES_VLD(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_MP_ES_VLD_SHIFT)) & DMA_MP_ES_VLD_MASK)
+/*! @} */
+
+/*! @name MP_INT */
+/*! @{ */
+#define DMA_MP_INT_INT_MASK                             (0xFFFFFFFFU)
+#define DMA_MP_INT_INT_SHIFT                            (0U)
+#define DMA_MP_INT_INT(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_MP_INT_INT_SHIFT)) & DMA_MP_INT_INT_MASK)
+/*! @} */
+
+/*! @name MP_HRS */
+/*! @{ */
+#define DMA_MP_HRS_HRS_MASK                             (0xFFFFFFFFU)
+#define DMA_MP_HRS_HRS_SHIFT                            (0U)
+#define DMA_MP_HRS_HRS(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_MP_HRS_HRS_SHIFT)) & DMA_MP_HRS_HRS_MASK)
+/*! @} */
+
+/*! @name CH_GRPRI */
+/*! @{ */
+#define DMA_CH_GRPRI_GRPRI_MASK                         (0x1FU)
+#define DMA_CH_GRPRI_GRPRI_SHIFT                        (0U)
+#define DMA_CH_GRPRI_GRPRI(x)                           (((uint32_t)(((uint32_t)(x)) << DMA_CH_GRPRI_GRPRI_SHIFT)) & DMA_CH_GRPRI_GRPRI_MASK)
+/*! @} */
+
+/*! @name CH_CSR */
+/*! @{ */
+#define DMA_CH_CSR_ERQ_MASK                             (0x1U)
+#define DMA_CH_CSR_ERQ_SHIFT                            (0U)
+#define DMA_CH_CSR_ERQ(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_CSR_ERQ_SHIFT)) & DMA_CH_CSR_ERQ_MASK)
+#define DMA_CH_CSR_EARQ_MASK                            (0x2U)
+#define DMA_CH_CSR_EARQ_SHIFT                           (1U)
+#define DMA_CH_CSR_EARQ(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_CH_CSR_EARQ_SHIFT)) & DMA_CH_CSR_EARQ_MASK)
+#define DMA_CH_CSR_EEI_MASK                             (0x4U)
+#define DMA_CH_CSR_EEI_SHIFT                            (2U)
+#define DMA_CH_CSR_EEI(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_CSR_EEI_SHIFT)) & DMA_CH_CSR_EEI_MASK)
+#define DMA_CH_CSR_EBW_MASK                             (0x8U)
+#define DMA_CH_CSR_EBW_SHIFT                            (3U)
+#define DMA_CH_CSR_EBW(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_CSR_EBW_SHIFT)) & DMA_CH_CSR_EBW_MASK)
+#define DMA_CH_CSR_DONE_MASK                            (0x40000000U)
+#define DMA_CH_CSR_DONE_SHIFT                           (30U)
+#define DMA_CH_CSR_DONE(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_CH_CSR_DONE_SHIFT)) & DMA_CH_CSR_DONE_MASK)
+#define DMA_CH_CSR_ACTIVE_MASK                          (0x80000000U)
+#define DMA_CH_CSR_ACTIVE_SHIFT                         (31U)
+#define DMA_CH_CSR_ACTIVE(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_CH_CSR_ACTIVE_SHIFT)) & DMA_CH_CSR_ACTIVE_MASK)
+/*! @} */
+
+/*! @name CH_ES */
+/*! @{ */
+#define DMA_CH_ES_DBE_MASK                              (0x1U)
+#define DMA_CH_ES_DBE_SHIFT                             (0U)
+#define DMA_CH_ES_DBE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_DBE_SHIFT)) & DMA_CH_ES_DBE_MASK)
+#define DMA_CH_ES_SBE_MASK                              (0x2U)
+#define DMA_CH_ES_SBE_SHIFT                             (1U)
+#define DMA_CH_ES_SBE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_SBE_SHIFT)) & DMA_CH_ES_SBE_MASK)
+#define DMA_CH_ES_SGE_MASK                              (0x4U)
+#define DMA_CH_ES_SGE_SHIFT                             (2U)
+#define DMA_CH_ES_SGE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_SGE_SHIFT)) & DMA_CH_ES_SGE_MASK)
+#define DMA_CH_ES_NCE_MASK                              (0x8U)
+#define DMA_CH_ES_NCE_SHIFT                             (3U)
+#define DMA_CH_ES_NCE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_NCE_SHIFT)) & DMA_CH_ES_NCE_MASK)
+#define DMA_CH_ES_DOE_MASK                              (0x10U)
+#define DMA_CH_ES_DOE_SHIFT                             (4U)
+#define DMA_CH_ES_DOE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_DOE_SHIFT)) & DMA_CH_ES_DOE_MASK)
+#define DMA_CH_ES_DAE_MASK                              (0x20U)
+#define DMA_CH_ES_DAE_SHIFT                             (5U)
+#define DMA_CH_ES_DAE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_DAE_SHIFT)) & DMA_CH_ES_DAE_MASK)
+#define DMA_CH_ES_SOE_MASK                              (0x40U)
+#define DMA_CH_ES_SOE_SHIFT                             (6U)
+#define DMA_CH_ES_SOE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_SOE_SHIFT)) & DMA_CH_ES_SOE_MASK)
+#define DMA_CH_ES_SAE_MASK                              (0x80U)
+#define DMA_CH_ES_SAE_SHIFT                             (7U)
+#define DMA_CH_ES_SAE(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_SAE_SHIFT)) & DMA_CH_ES_SAE_MASK)
+#define DMA_CH_ES_ERR_MASK                              (0x80000000U)
+#define DMA_CH_ES_ERR_SHIFT                             (31U)
+#define DMA_CH_ES_ERR(x)                                (((uint32_t)(((uint32_t)(x)) << DMA_CH_ES_ERR_SHIFT)) & DMA_CH_ES_ERR_MASK)
+/*! @} */
+
+/*! @name CH_INT */
+/*! @{ */
+#define DMA_CH_INT_INT_MASK                             (0x1U)
+#define DMA_CH_INT_INT_SHIFT                            (0U)
+#define DMA_CH_INT_INT(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_INT_INT_SHIFT)) & DMA_CH_INT_INT_MASK)
+/*! @} */
+
+/*! @name CH_SBR */
+/*! @{ */
+#define DMA_CH_SBR_MID_MASK                             (0x3FU)
+#define DMA_CH_SBR_MID_SHIFT                            (0U)
+#define DMA_CH_SBR_MID(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_SBR_MID_SHIFT)) & DMA_CH_SBR_MID_MASK)
+#define DMA_CH_SBR_PAL_MASK                             (0x8000U)
+#define DMA_CH_SBR_PAL_SHIFT                            (15U)
+#define DMA_CH_SBR_PAL(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_SBR_PAL_SHIFT)) & DMA_CH_SBR_PAL_MASK)
+#define DMA_CH_SBR_EMI_MASK                             (0x10000U)
+#define DMA_CH_SBR_EMI_SHIFT                            (16U)
+#define DMA_CH_SBR_EMI(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_SBR_EMI_SHIFT)) & DMA_CH_SBR_EMI_MASK)
+#define DMA_CH_SBR_ATTR_MASK                            (0xE0000U)
+#define DMA_CH_SBR_ATTR_SHIFT                           (17U)
+#define DMA_CH_SBR_ATTR(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_CH_SBR_ATTR_SHIFT)) & DMA_CH_SBR_ATTR_MASK)
+/*! @} */
+
+/*! @name CH_PRI */
+/*! @{ */
+#define DMA_CH_PRI_APL_MASK                             (0x7U)
+#define DMA_CH_PRI_APL_SHIFT                            (0U)
+#define DMA_CH_PRI_APL(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_PRI_APL_SHIFT)) & DMA_CH_PRI_APL_MASK)
+#define DMA_CH_PRI_DPA_MASK                             (0x40000000U)
+#define DMA_CH_PRI_DPA_SHIFT                            (30U)
+#define DMA_CH_PRI_DPA(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_PRI_DPA_SHIFT)) & DMA_CH_PRI_DPA_MASK)
+#define DMA_CH_PRI_ECP_MASK                             (0x80000000U)
+#define DMA_CH_PRI_ECP_SHIFT                            (31U)
+#define DMA_CH_PRI_ECP(x)                               (((uint32_t)(((uint32_t)(x)) << DMA_CH_PRI_ECP_SHIFT)) & DMA_CH_PRI_ECP_MASK)
+/*! @} */
+
+/*! @name TCD_SADDR */
+/*! @{ */
+#define DMA_TCD_SADDR_SADDR_MASK                        (0xFFFFFFFFU)
+#define DMA_TCD_SADDR_SADDR_SHIFT                       (0U)
+#define DMA_TCD_SADDR_SADDR(x)                          (((uint32_t)(((uint32_t)(x)) << DMA_TCD_SADDR_SADDR_SHIFT)) & DMA_TCD_SADDR_SADDR_MASK)
+/*! @} */
+
+/*! @name TCD_SOFF */
+/*! @{ */
+#define DMA_TCD_SOFF_SOFF_MASK                          (0xFFFFU)
+#define DMA_TCD_SOFF_SOFF_SHIFT                         (0U)
+#define DMA_TCD_SOFF_SOFF(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_TCD_SOFF_SOFF_SHIFT)) & DMA_TCD_SOFF_SOFF_MASK)
+/*! @} */
+
+/*! @name TCD_ATTR */
+/*! @{ */
+#define DMA_TCD_ATTR_DSIZE_MASK                         (0x7U)
+#define DMA_TCD_ATTR_DSIZE_SHIFT                        (0U)
+#define DMA_TCD_ATTR_DSIZE(x)                           (((uint32_t)(((uint32_t)(x)) << DMA_TCD_ATTR_DSIZE_SHIFT)) & DMA_TCD_ATTR_DSIZE_MASK)
+#define DMA_TCD_ATTR_DMOD_MASK                          (0xF8U)
+#define DMA_TCD_ATTR_DMOD_SHIFT                         (3U)
+#define DMA_TCD_ATTR_DMOD(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_TCD_ATTR_DMOD_SHIFT)) & DMA_TCD_ATTR_DMOD_MASK)
+#define DMA_TCD_ATTR_SSIZE_MASK                         (0x700U)
+#define DMA_TCD_ATTR_SSIZE_SHIFT                        (8U)
+#define DMA_TCD_ATTR_SSIZE(x)                           (((uint32_t)(((uint32_t)(x)) << DMA_TCD_ATTR_SSIZE_SHIFT)) & DMA_TCD_ATTR_SSIZE_MASK)
+#define DMA_TCD_ATTR_SMOD_MASK                          (0xF800U)
+#define DMA_TCD_ATTR_SMOD_SHIFT                         (11U)
+#define DMA_TCD_ATTR_SMOD(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_TCD_ATTR_SMOD_SHIFT)) & DMA_TCD_ATTR_SMOD_MASK)
+/*! @} */
+
+/*! @name TCD_NBYTES_MLOFFNO */
+/*! @{ */
+#define DMA_TCD_NBYTES_MLOFFNO_NBYTES_MASK              (0x3FFFFFFFU)
+#define DMA_TCD_NBYTES_MLOFFNO_NBYTES_SHIFT             (0U)
+#define DMA_TCD_NBYTES_MLOFFNO_NBYTES(x)                (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFNO_NBYTES_SHIFT)) & DMA_TCD_NBYTES_MLOFFNO_NBYTES_MASK)
+#define DMA_TCD_NBYTES_MLOFFNO_DMLOE_MASK               (0x40000000U)
+#define DMA_TCD_NBYTES_MLOFFNO_DMLOE_SHIFT              (30U)
+#define DMA_TCD_NBYTES_MLOFFNO_DMLOE(x)                 (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFNO_DMLOE_SHIFT)) & DMA_TCD_NBYTES_MLOFFNO_DMLOE_MASK)
+#define DMA_TCD_NBYTES_MLOFFNO_SMLOE_MASK               (0x80000000U)
+#define DMA_TCD_NBYTES_MLOFFNO_SMLOE_SHIFT              (31U)
+#define DMA_TCD_NBYTES_MLOFFNO_SMLOE(x)                 (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFNO_SMLOE_SHIFT)) & DMA_TCD_NBYTES_MLOFFNO_SMLOE_MASK)
+/*! @} */
+
+/*! @name TCD_NBYTES_MLOFFYES */
+/*! @{ */
+#define DMA_TCD_NBYTES_MLOFFYES_NBYTES_MASK             (0x3FFU)
+#define DMA_TCD_NBYTES_MLOFFYES_NBYTES_SHIFT            (0U)
+#define DMA_TCD_NBYTES_MLOFFYES_NBYTES(x)               (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFYES_NBYTES_SHIFT)) & DMA_TCD_NBYTES_MLOFFYES_NBYTES_MASK)
+#define DMA_TCD_NBYTES_MLOFFYES_MLOFF_MASK              (0x3FFFFC00U)
+#define DMA_TCD_NBYTES_MLOFFYES_MLOFF_SHIFT             (10U)
+#define DMA_TCD_NBYTES_MLOFFYES_MLOFF(x)                (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFYES_MLOFF_SHIFT)) & DMA_TCD_NBYTES_MLOFFYES_MLOFF_MASK)
+#define DMA_TCD_NBYTES_MLOFFYES_DMLOE_MASK              (0x40000000U)
+#define DMA_TCD_NBYTES_MLOFFYES_DMLOE_SHIFT             (30U)
+#define DMA_TCD_NBYTES_MLOFFYES_DMLOE(x)                (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFYES_DMLOE_SHIFT)) & DMA_TCD_NBYTES_MLOFFYES_DMLOE_MASK)
+#define DMA_TCD_NBYTES_MLOFFYES_SMLOE_MASK              (0x80000000U)
+#define DMA_TCD_NBYTES_MLOFFYES_SMLOE_SHIFT             (31U)
+#define DMA_TCD_NBYTES_MLOFFYES_SMLOE(x)                (((uint32_t)(((uint32_t)(x)) << DMA_TCD_NBYTES_MLOFFYES_SMLOE_SHIFT)) & DMA_TCD_NBYTES_MLOFFYES_SMLOE_MASK)
+/*! @} */
+
+/*! @name TCD_SLAST_SDA */
+/*! @{ */
+#define DMA_TCD_SLAST_SDA_SLAST_SDA_MASK                (0xFFFFFFFFU)
+#define DMA_TCD_SLAST_SDA_SLAST_SDA_SHIFT               (0U)
+#define DMA_TCD_SLAST_SDA_SLAST_SDA(x)                  (((uint32_t)(((uint32_t)(x)) << DMA_TCD_SLAST_SDA_SLAST_SDA_SHIFT)) & DMA_TCD_SLAST_SDA_SLAST_SDA_MASK)
+/*! @} */
+
+/*! @name TCD_DADDR */
+/*! @{ */
+#define DMA_TCD_DADDR_DADDR_MASK                        (0xFFFFFFFFU)
+#define DMA_TCD_DADDR_DADDR_SHIFT                       (0U)
+#define DMA_TCD_DADDR_DADDR(x)                          (((uint32_t)(((uint32_t)(x)) << DMA_TCD_DADDR_DADDR_SHIFT)) & DMA_TCD_DADDR_DADDR_MASK)
+/*! @} */
+
+/*! @name TCD_DOFF */
+/*! @{ */
+#define DMA_TCD_DOFF_DOFF_MASK                          (0xFFFFU)
+#define DMA_TCD_DOFF_DOFF_SHIFT                         (0U)
+#define DMA_TCD_DOFF_DOFF(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_TCD_DOFF_DOFF_SHIFT)) & DMA_TCD_DOFF_DOFF_MASK)
+/*! @} */
+
+/*! @name TCD_CITER_ELINKNO */
+/*! @{ */
+#define DMA_TCD_CITER_ELINKNO_CITER_MASK                (0x7FFFU)
+#define DMA_TCD_CITER_ELINKNO_CITER_SHIFT               (0U)
+#define DMA_TCD_CITER_ELINKNO_CITER(x)                  (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CITER_ELINKNO_CITER_SHIFT)) & DMA_TCD_CITER_ELINKNO_CITER_MASK)
+#define DMA_TCD_CITER_ELINKNO_ELINK_MASK                (0x8000U)
+#define DMA_TCD_CITER_ELINKNO_ELINK_SHIFT               (15U)
+#define DMA_TCD_CITER_ELINKNO_ELINK(x)                  (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CITER_ELINKNO_ELINK_SHIFT)) & DMA_TCD_CITER_ELINKNO_ELINK_MASK)
+/*! @} */
+
+/*! @name TCD_CITER_ELINKYES */
+/*! @{ */
+#define DMA_TCD_CITER_ELINKYES_CITER_MASK               (0x1FFU)
+#define DMA_TCD_CITER_ELINKYES_CITER_SHIFT              (0U)
+#define DMA_TCD_CITER_ELINKYES_CITER(x)                 (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CITER_ELINKYES_CITER_SHIFT)) & DMA_TCD_CITER_ELINKYES_CITER_MASK)
+#define DMA_TCD_CITER_ELINKYES_LINKCH_MASK              (0x3E00U)
+#define DMA_TCD_CITER_ELINKYES_LINKCH_SHIFT             (9U)
+#define DMA_TCD_CITER_ELINKYES_LINKCH(x)                (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CITER_ELINKYES_LINKCH_SHIFT)) & DMA_TCD_CITER_ELINKYES_LINKCH_MASK)
+#define DMA_TCD_CITER_ELINKYES_ELINK_MASK               (0x8000U)
+#define DMA_TCD_CITER_ELINKYES_ELINK_SHIFT              (15U)
+#define DMA_TCD_CITER_ELINKYES_ELINK(x)                 (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CITER_ELINKYES_ELINK_SHIFT)) & DMA_TCD_CITER_ELINKYES_ELINK_MASK)
+/*! @} */
+
+/*! @name TCD_DLAST_SGA */
+/*! @{ */
+#define DMA_TCD_DLAST_SGA_DLAST_SGA_MASK                (0xFFFFFFFFU)
+#define DMA_TCD_DLAST_SGA_DLAST_SGA_SHIFT               (0U)
+#define DMA_TCD_DLAST_SGA_DLAST_SGA(x)                  (((uint32_t)(((uint32_t)(x)) << DMA_TCD_DLAST_SGA_DLAST_SGA_SHIFT)) & DMA_TCD_DLAST_SGA_DLAST_SGA_MASK)
+/*! @} */
+
+/*! @name TCD_CSR */
+/*! @{ */
+#define DMA_TCD_CSR_START_MASK                          (0x1U)
+#define DMA_TCD_CSR_START_SHIFT                         (0U)
+#define DMA_TCD_CSR_START(x)                            (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_START_SHIFT)) & DMA_TCD_CSR_START_MASK)
+#define DMA_TCD_CSR_INTMAJOR_MASK                       (0x2U)
+#define DMA_TCD_CSR_INTMAJOR_SHIFT                      (1U)
+#define DMA_TCD_CSR_INTMAJOR(x)                         (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_INTMAJOR_SHIFT)) & DMA_TCD_CSR_INTMAJOR_MASK)
+#define DMA_TCD_CSR_INTHALF_MASK                        (0x4U)
+#define DMA_TCD_CSR_INTHALF_SHIFT                       (2U)
+#define DMA_TCD_CSR_INTHALF(x)                          (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_INTHALF_SHIFT)) & DMA_TCD_CSR_INTHALF_MASK)
+#define DMA_TCD_CSR_DREQ_MASK                           (0x8U)
+#define DMA_TCD_CSR_DREQ_SHIFT                          (3U)
+#define DMA_TCD_CSR_DREQ(x)                             (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_DREQ_SHIFT)) & DMA_TCD_CSR_DREQ_MASK)
+#define DMA_TCD_CSR_ESG_MASK                            (0x10U)
+#define DMA_TCD_CSR_ESG_SHIFT                           (4U)
+#define DMA_TCD_CSR_ESG(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_ESG_SHIFT)) & DMA_TCD_CSR_ESG_MASK)
+#define DMA_TCD_CSR_MAJORELINK_MASK                     (0x20U)
+#define DMA_TCD_CSR_MAJORELINK_SHIFT                    (5U)
+#define DMA_TCD_CSR_MAJORELINK(x)                       (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_MAJORELINK_SHIFT)) & DMA_TCD_CSR_MAJORELINK_MASK)
+#define DMA_TCD_CSR_EEOP_MASK                           (0x40U)
+#define DMA_TCD_CSR_EEOP_SHIFT                          (6U)
+#define DMA_TCD_CSR_EEOP(x)                             (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_EEOP_SHIFT)) & DMA_TCD_CSR_EEOP_MASK)
+#define DMA_TCD_CSR_ESDA_MASK                           (0x80U)
+#define DMA_TCD_CSR_ESDA_SHIFT                          (7U)
+#define DMA_TCD_CSR_ESDA(x)                             (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_ESDA_SHIFT)) & DMA_TCD_CSR_ESDA_MASK)
+#define DMA_TCD_CSR_MAJORLINKCH_MASK                    (0x1F00U)
+#define DMA_TCD_CSR_MAJORLINKCH_SHIFT                   (8U)
+#define DMA_TCD_CSR_MAJORLINKCH(x)                      (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_MAJORLINKCH_SHIFT)) & DMA_TCD_CSR_MAJORLINKCH_MASK)
+#define DMA_TCD_CSR_BWC_MASK                            (0xC000U)
+#define DMA_TCD_CSR_BWC_SHIFT                           (14U)
+#define DMA_TCD_CSR_BWC(x)                              (((uint32_t)(((uint32_t)(x)) << DMA_TCD_CSR_BWC_SHIFT)) & DMA_TCD_CSR_BWC_MASK)
+/*! @} */
+
+/*! @name TCD_BITER_ELINKNO */
+/*! @{ */
+#define DMA_TCD_BITER_ELINKNO_BITER_MASK                (0x7FFFU)
+#define DMA_TCD_BITER_ELINKNO_BITER_SHIFT               (0U)
+#define DMA_TCD_BITER_ELINKNO_BITER(x)                  (((uint32_t)(((uint32_t)(x)) << DMA_TCD_BITER_ELINKNO_BITER_SHIFT)) & DMA_TCD_BITER_ELINKNO_BITER_MASK)
+#define DMA_TCD_BITER_ELINKNO_ELINK_MASK                (0x8000U)
+#define DMA_TCD_BITER_ELINKNO_ELINK_SHIFT               (15U)
+#define DMA_TCD_BITER_ELINKNO_ELINK(x)                  (((uint32_t)(((uint32_t)(x)) << DMA_TCD_BITER_ELINKNO_ELINK_SHIFT)) & DMA_TCD_BITER_ELINKNO_ELINK_MASK)
+/*! @} */
+
+/*! @name TCD_BITER_ELINKYES */
+/*! @{ */
+#define DMA_TCD_BITER_ELINKYES_BITER_MASK               (0x1FFU)
+#define DMA_TCD_BITER_ELINKYES_BITER_SHIFT              (0U)
+#define DMA_TCD_BITER_ELINKYES_BITER(x)                 (((uint32_t)(((uint32_t)(x)) << DMA_TCD_BITER_ELINKYES_BITER_SHIFT)) & DMA_TCD_BITER_ELINKYES_BITER_MASK)
+#define DMA_TCD_BITER_ELINKYES_LINKCH_MASK              (0x3E00U)
+#define DMA_TCD_BITER_ELINKYES_LINKCH_SHIFT             (9U)
+#define DMA_TCD_BITER_ELINKYES_LINKCH(x)                (((uint32_t)(((uint32_t)(x)) << DMA_TCD_BITER_ELINKYES_LINKCH_SHIFT)) & DMA_TCD_BITER_ELINKYES_LINKCH_MASK)
+#define DMA_TCD_BITER_ELINKYES_ELINK_MASK               (0x8000U)
+#define DMA_TCD_BITER_ELINKYES_ELINK_SHIFT              (15U)
+#define DMA_TCD_BITER_ELINKYES_ELINK(x)                 (((uint32_t)(((uint32_t)(x)) << DMA_TCD_BITER_ELINKYES_ELINK_SHIFT)) & DMA_TCD_BITER_ELINKYES_ELINK_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group DMA_Register_Masks */
+
+/* DMA - Peripheral instance base addresses */
+/** Peripheral AUDIO__EDMA0 base address */
+#define AUDIO__EDMA0_BASE                               (0x591F0000u)
+/** Peripheral AUDIO__EDMA0 base pointer */
+#define AUDIO__EDMA0                                    ((DMA_Type *)AUDIO__EDMA0_BASE)
+/** Peripheral AUDIO__EDMA1 base address */
+#define AUDIO__EDMA1_BASE                               (0x599F0000u)
+/** Peripheral AUDIO__EDMA1 base pointer */
+#define AUDIO__EDMA1                                    ((DMA_Type *)AUDIO__EDMA1_BASE)
+/** Peripheral CONNECTIVITY__EDMA base address */
+#define CONNECTIVITY__EDMA_BASE                         (0x5B1F0000u)
+/** Peripheral CONNECTIVITY__EDMA base pointer */
+#define CONNECTIVITY__EDMA                              ((DMA_Type *)CONNECTIVITY__EDMA_BASE)
+/** Peripheral DMA__EDMA0 base address */
+#define DMA__EDMA0_BASE                                 (0x5A1F0000u)
+/** Peripheral DMA__EDMA0 base pointer */
+#define DMA__EDMA0                                      ((DMA_Type *)DMA__EDMA0_BASE)
+/** Peripheral DMA__EDMA1 base address */
+#define DMA__EDMA1_BASE                                 (0x5A9F0000u)
+/** Peripheral DMA__EDMA1 base pointer */
+#define DMA__EDMA1                                      ((DMA_Type *)DMA__EDMA1_BASE)
+/** Array initializer of DMA peripheral base addresses */
+#define DMA_BASE_ADDRS                           { AUDIO__EDMA0_BASE, AUDIO__EDMA1_BASE, CONNECTIVITY__EDMA_BASE, DMA__EDMA0_BASE, DMA__EDMA1_BASE }
+/** Array initializer of DMA peripheral base pointers */
+#define DMA_BASE_PTRS                            { AUDIO__EDMA0, AUDIO__EDMA1, CONNECTIVITY__EDMA, DMA__EDMA0, DMA__EDMA1 }
+/** Interrupt vectors for the DMA peripheral type, one per channel */
+#define DMA_IRQS                                 { { AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn, AUDIO_EDMA0_INT_IRQn }, \
+                                                  { AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn, AUDIO_EDMA1_INT_IRQn }, \
+                                                  { CONNECTIVITY_DMA_INT_IRQn, CONNECTIVITY_DMA_INT_IRQn, CONNECTIVITY_DMA_INT_IRQn, CONNECTIVITY_DMA_INT_IRQn, CONNECTIVITY_DMA_INT_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn, NotAvail_IRQn }, \
+                                                  { DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn, DMA_EDMA0_INT_IRQn }, \
+                                                  { DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn, DMA_EDMA1_INT_IRQn } }
+#define DMA_ERROR_IRQS                           { AUDIO_EDMA0_ERR_INT_IRQn, AUDIO_EDMA1_ERR_INT_IRQn, CONNECTIVITY_DMA_ERR_INT_IRQn, DMA_EDMA0_ERR_INT_IRQn, DMA_EDMA1_ERR_INT_IRQn }
+
+/*!
+ * @}
+ */ /* end of group DMA_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- ENET Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup ENET_Peripheral_Access_Layer ENET Peripheral Access Layer
+ * @{
+ */
+
+/** ENET - Register Layout Typedef */
+typedef struct {
+       uint8_t RESERVED_0[4];
+  __IO uint32_t EIR;                               /**< Interrupt Event Register, offset: 0x4 */
+  __IO uint32_t EIMR;                              /**< Interrupt Mask Register, offset: 0x8 */
+       uint8_t RESERVED_1[4];
+  __IO uint32_t RDAR;                              /**< Receive Descriptor Active Register - Ring 0, offset: 0x10 */
+  __IO uint32_t TDAR;                              /**< Transmit Descriptor Active Register - Ring 0, offset: 0x14 */
+       uint8_t RESERVED_2[12];
+  __IO uint32_t ECR;                               /**< Ethernet Control Register, offset: 0x24 */
+       uint8_t RESERVED_3[24];
+  __IO uint32_t MMFR;                              /**< MII Management Frame Register, offset: 0x40 */
+  __IO uint32_t MSCR;                              /**< MII Speed Control Register, offset: 0x44 */
+       uint8_t RESERVED_4[28];
+  __IO uint32_t MIBC;                              /**< MIB Control Register, offset: 0x64 */
+       uint8_t RESERVED_5[28];
+  __IO uint32_t RCR;                               /**< Receive Control Register, offset: 0x84 */
+       uint8_t RESERVED_6[60];
+  __IO uint32_t TCR;                               /**< Transmit Control Register, offset: 0xC4 */
+       uint8_t RESERVED_7[28];
+  __IO uint32_t PALR;                              /**< Physical Address Lower Register, offset: 0xE4 */
+  __IO uint32_t PAUR;                              /**< Physical Address Upper Register, offset: 0xE8 */
+  __IO uint32_t OPD;                               /**< Opcode/Pause Duration Register, offset: 0xEC */
+  __IO uint32_t TXIC[3];                           /**< Transmit Interrupt Coalescing Register, array offset: 0xF0, array step: 0x4 */
+       uint8_t RESERVED_8[4];
+  __IO uint32_t RXIC[3];                           /**< Receive Interrupt Coalescing Register, array offset: 0x100, array step: 0x4 */
+       uint8_t RESERVED_9[12];
+  __IO uint32_t IAUR;                              /**< Descriptor Individual Upper Address Register, offset: 0x118 */
+  __IO uint32_t IALR;                              /**< Descriptor Individual Lower Address Register, offset: 0x11C */
+  __IO uint32_t GAUR;                              /**< Descriptor Group Upper Address Register, offset: 0x120 */
+  __IO uint32_t GALR;                              /**< Descriptor Group Lower Address Register, offset: 0x124 */
+       uint8_t RESERVED_10[28];
+  __IO uint32_t TFWR;                              /**< Transmit FIFO Watermark Register, offset: 0x144 */
+       uint8_t RESERVED_11[24];
+  __IO uint32_t RDAR1;                             /**< Receive Descriptor Active Register - Ring 1, offset: 0x160 */
+  __IO uint32_t TDAR1;                             /**< Transmit Descriptor Active Register - Ring 1, offset: 0x164 */
+  __IO uint32_t RDAR2;                             /**< Receive Descriptor Active Register - Ring 2, offset: 0x168 */
+  __IO uint32_t TDAR2;                             /**< Transmit Descriptor Active Register - Ring 2, offset: 0x16C */
+  __IO uint32_t QOS;                               /**< QOS Scheme, offset: 0x170 */
+       uint8_t RESERVED_12[12];
+  __IO uint32_t RDSR;                              /**< Receive Descriptor Ring 0 Start Register, offset: 0x180 */
+  __IO uint32_t TDSR;                              /**< Transmit Buffer Descriptor Ring 0 Start Register, offset: 0x184 */
+  __IO uint32_t MRBR;                              /**< Maximum Receive Buffer Size Register - Ring 0, offset: 0x188 */
+       uint8_t RESERVED_13[4];
+  __IO uint32_t RSFL;                              /**< Receive FIFO Section Full Threshold, offset: 0x190 */
+  __IO uint32_t RSEM;                              /**< Receive FIFO Section Empty Threshold, offset: 0x194 */
+  __IO uint32_t RAEM;                              /**< Receive FIFO Almost Empty Threshold, offset: 0x198 */
+  __IO uint32_t RAFL;                              /**< Receive FIFO Almost Full Threshold, offset: 0x19C */
+  __IO uint32_t TSEM;                              /**< Transmit FIFO Section Empty Threshold, offset: 0x1A0 */
+  __IO uint32_t TAEM;                              /**< Transmit FIFO Almost Empty Threshold, offset: 0x1A4 */
+  __IO uint32_t TAFL;                              /**< Transmit FIFO Almost Full Threshold, offset: 0x1A8 */
+  __IO uint32_t TIPG;                              /**< Transmit Inter-Packet Gap, offset: 0x1AC */
+  __IO uint32_t FTRL;                              /**< Frame Truncation Length, offset: 0x1B0 */
+       uint8_t RESERVED_14[12];
+  __IO uint32_t TACC;                              /**< Transmit Accelerator Function Configuration, offset: 0x1C0 */
+  __IO uint32_t RACC;                              /**< Receive Accelerator Function Configuration, offset: 0x1C4 */
+  __IO uint32_t RCMR[2];                           /**< Receive Classification Match Register for Class n, array offset: 0x1C8, array step: 0x4 */
+       uint8_t RESERVED_15[8];
+  __IO uint32_t DMACFG[2];                         /**< DMA Class Based Configuration, array offset: 0x1D8, array step: 0x4 */
+  __IO uint32_t RDSR1;                             /**< Receive Descriptor Ring 1 Start Register, offset: 0x1E0 */
+  __IO uint32_t TDSR1;                             /**< Transmit Buffer Descriptor Ring 1 Start Register, offset: 0x1E4 */
+  __IO uint32_t MRBR1;                             /**< Maximum Receive Buffer Size Register - Ring 1, offset: 0x1E8 */
+  __IO uint32_t RDSR2;                             /**< Receive Descriptor Ring 2 Start Register, offset: 0x1EC */
+  __IO uint32_t TDSR2;                             /**< Transmit Buffer Descriptor Ring 2 Start Register, offset: 0x1F0 */
+  __IO uint32_t MRBR2;                             /**< Maximum Receive Buffer Size Register - Ring 2, offset: 0x1F4 */
+       uint8_t RESERVED_16[520];
+  __IO uint32_t ATCR;                              /**< Adjustable Timer Control Register, offset: 0x400 */
+  __IO uint32_t ATVR;                              /**< Timer Value Register, offset: 0x404 */
+  __IO uint32_t ATOFF;                             /**< Timer Offset Register, offset: 0x408 */
+  __IO uint32_t ATPER;                             /**< Timer Period Register, offset: 0x40C */
+  __IO uint32_t ATCOR;                             /**< Timer Correction Register, offset: 0x410 */
+  __IO uint32_t ATINC;                             /**< Time-Stamping Clock Period Register, offset: 0x414 */
+  __I  uint32_t ATSTMP;                            /**< Timestamp of Last Transmitted Frame, offset: 0x418 */
+       uint8_t RESERVED_17[488];
+  __IO uint32_t TGSR;                              /**< Timer Global Status Register, offset: 0x604 */
+  struct {                                         /* offset: 0x608, array step: 0x8 */
+    __IO uint32_t TCSR;                              /**< Timer Control Status Register, array offset: 0x608, array step: 0x8 */
+    __IO uint32_t TCCR;                              /**< Timer Compare Capture Register, array offset: 0x60C, array step: 0x8 */
+  } CHANNEL[4];
+} ENET_Type;
+
+/* ----------------------------------------------------------------------------
+   -- ENET Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup ENET_Register_Masks ENET Register Masks
+ * @{
+ */
+
+/*! @name EIR */
+/*! @{ */
+#define ENET_EIR_RXB1_MASK                              (0x1U)
+#define ENET_EIR_RXB1_SHIFT                             (0U)
+#define ENET_EIR_RXB1(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXB1_SHIFT)) & ENET_EIR_RXB1_MASK)
+#define ENET_EIR_RXF1_MASK                              (0x2U)
+#define ENET_EIR_RXF1_SHIFT                             (1U)
+#define ENET_EIR_RXF1(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXF1_SHIFT)) & ENET_EIR_RXF1_MASK)
+#define ENET_EIR_TXB1_MASK                              (0x4U)
+#define ENET_EIR_TXB1_SHIFT                             (2U)
+#define ENET_EIR_TXB1(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TXB1_SHIFT)) & ENET_EIR_TXB1_MASK)
+#define ENET_EIR_TXF1_MASK                              (0x8U)
+#define ENET_EIR_TXF1_SHIFT                             (3U)
+#define ENET_EIR_TXF1(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TXF1_SHIFT)) & ENET_EIR_TXF1_MASK)
+#define ENET_EIR_RXB2_MASK                              (0x10U)
+#define ENET_EIR_RXB2_SHIFT                             (4U)
+#define ENET_EIR_RXB2(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXB2_SHIFT)) & ENET_EIR_RXB2_MASK)
+#define ENET_EIR_RXF2_MASK                              (0x20U)
+#define ENET_EIR_RXF2_SHIFT                             (5U)
+#define ENET_EIR_RXF2(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXF2_SHIFT)) & ENET_EIR_RXF2_MASK)
+#define ENET_EIR_TXB2_MASK                              (0x40U)
+#define ENET_EIR_TXB2_SHIFT                             (6U)
+#define ENET_EIR_TXB2(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TXB2_SHIFT)) & ENET_EIR_TXB2_MASK)
+#define ENET_EIR_TXF2_MASK                              (0x80U)
+#define ENET_EIR_TXF2_SHIFT                             (7U)
+#define ENET_EIR_TXF2(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TXF2_SHIFT)) & ENET_EIR_TXF2_MASK)
+#define ENET_EIR_RXFLUSH_0_MASK                         (0x1000U)
+#define ENET_EIR_RXFLUSH_0_SHIFT                        (12U)
+#define ENET_EIR_RXFLUSH_0(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXFLUSH_0_SHIFT)) & ENET_EIR_RXFLUSH_0_MASK)
+#define ENET_EIR_RXFLUSH_1_MASK                         (0x2000U)
+#define ENET_EIR_RXFLUSH_1_SHIFT                        (13U)
+#define ENET_EIR_RXFLUSH_1(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXFLUSH_1_SHIFT)) & ENET_EIR_RXFLUSH_1_MASK)
+#define ENET_EIR_RXFLUSH_2_MASK                         (0x4000U)
+#define ENET_EIR_RXFLUSH_2_SHIFT                        (14U)
+#define ENET_EIR_RXFLUSH_2(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXFLUSH_2_SHIFT)) & ENET_EIR_RXFLUSH_2_MASK)
+#define ENET_EIR_TS_TIMER_MASK                          (0x8000U)
+#define ENET_EIR_TS_TIMER_SHIFT                         (15U)
+#define ENET_EIR_TS_TIMER(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TS_TIMER_SHIFT)) & ENET_EIR_TS_TIMER_MASK)
+#define ENET_EIR_TS_AVAIL_MASK                          (0x10000U)
+#define ENET_EIR_TS_AVAIL_SHIFT                         (16U)
+#define ENET_EIR_TS_AVAIL(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TS_AVAIL_SHIFT)) & ENET_EIR_TS_AVAIL_MASK)
+#define ENET_EIR_WAKEUP_MASK                            (0x20000U)
+#define ENET_EIR_WAKEUP_SHIFT                           (17U)
+#define ENET_EIR_WAKEUP(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_EIR_WAKEUP_SHIFT)) & ENET_EIR_WAKEUP_MASK)
+#define ENET_EIR_PLR_MASK                               (0x40000U)
+#define ENET_EIR_PLR_SHIFT                              (18U)
+#define ENET_EIR_PLR(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_PLR_SHIFT)) & ENET_EIR_PLR_MASK)
+#define ENET_EIR_UN_MASK                                (0x80000U)
+#define ENET_EIR_UN_SHIFT                               (19U)
+#define ENET_EIR_UN(x)                                  (((uint32_t)(((uint32_t)(x)) << ENET_EIR_UN_SHIFT)) & ENET_EIR_UN_MASK)
+#define ENET_EIR_RL_MASK                                (0x100000U)
+#define ENET_EIR_RL_SHIFT                               (20U)
+#define ENET_EIR_RL(x)                                  (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RL_SHIFT)) & ENET_EIR_RL_MASK)
+#define ENET_EIR_LC_MASK                                (0x200000U)
+#define ENET_EIR_LC_SHIFT                               (21U)
+#define ENET_EIR_LC(x)                                  (((uint32_t)(((uint32_t)(x)) << ENET_EIR_LC_SHIFT)) & ENET_EIR_LC_MASK)
+#define ENET_EIR_EBERR_MASK                             (0x400000U)
+#define ENET_EIR_EBERR_SHIFT                            (22U)
+#define ENET_EIR_EBERR(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIR_EBERR_SHIFT)) & ENET_EIR_EBERR_MASK)
+#define ENET_EIR_MII_MASK                               (0x800000U)
+#define ENET_EIR_MII_SHIFT                              (23U)
+#define ENET_EIR_MII(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_MII_SHIFT)) & ENET_EIR_MII_MASK)
+#define ENET_EIR_RXB_MASK                               (0x1000000U)
+#define ENET_EIR_RXB_SHIFT                              (24U)
+#define ENET_EIR_RXB(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXB_SHIFT)) & ENET_EIR_RXB_MASK)
+#define ENET_EIR_RXF_MASK                               (0x2000000U)
+#define ENET_EIR_RXF_SHIFT                              (25U)
+#define ENET_EIR_RXF(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_RXF_SHIFT)) & ENET_EIR_RXF_MASK)
+#define ENET_EIR_TXB_MASK                               (0x4000000U)
+#define ENET_EIR_TXB_SHIFT                              (26U)
+#define ENET_EIR_TXB(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TXB_SHIFT)) & ENET_EIR_TXB_MASK)
+#define ENET_EIR_TXF_MASK                               (0x8000000U)
+#define ENET_EIR_TXF_SHIFT                              (27U)
+#define ENET_EIR_TXF(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_TXF_SHIFT)) & ENET_EIR_TXF_MASK)
+#define ENET_EIR_GRA_MASK                               (0x10000000U)
+#define ENET_EIR_GRA_SHIFT                              (28U)
+#define ENET_EIR_GRA(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIR_GRA_SHIFT)) & ENET_EIR_GRA_MASK)
+#define ENET_EIR_BABT_MASK                              (0x20000000U)
+#define ENET_EIR_BABT_SHIFT                             (29U)
+#define ENET_EIR_BABT(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_BABT_SHIFT)) & ENET_EIR_BABT_MASK)
+#define ENET_EIR_BABR_MASK                              (0x40000000U)
+#define ENET_EIR_BABR_SHIFT                             (30U)
+#define ENET_EIR_BABR(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIR_BABR_SHIFT)) & ENET_EIR_BABR_MASK)
+/*! @} */
+
+/*! @name EIMR */
+/*! @{ */
+#define ENET_EIMR_RXB1_MASK                             (0x1U)
+#define ENET_EIMR_RXB1_SHIFT                            (0U)
+#define ENET_EIMR_RXB1(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXB1_SHIFT)) & ENET_EIMR_RXB1_MASK)
+#define ENET_EIMR_RXF1_MASK                             (0x2U)
+#define ENET_EIMR_RXF1_SHIFT                            (1U)
+#define ENET_EIMR_RXF1(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXF1_SHIFT)) & ENET_EIMR_RXF1_MASK)
+#define ENET_EIMR_TXB1_MASK                             (0x4U)
+#define ENET_EIMR_TXB1_SHIFT                            (2U)
+#define ENET_EIMR_TXB1(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TXB1_SHIFT)) & ENET_EIMR_TXB1_MASK)
+#define ENET_EIMR_TXF1_MASK                             (0x8U)
+#define ENET_EIMR_TXF1_SHIFT                            (3U)
+#define ENET_EIMR_TXF1(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TXF1_SHIFT)) & ENET_EIMR_TXF1_MASK)
+#define ENET_EIMR_RXB2_MASK                             (0x10U)
+#define ENET_EIMR_RXB2_SHIFT                            (4U)
+#define ENET_EIMR_RXB2(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXB2_SHIFT)) & ENET_EIMR_RXB2_MASK)
+#define ENET_EIMR_RXF2_MASK                             (0x20U)
+#define ENET_EIMR_RXF2_SHIFT                            (5U)
+#define ENET_EIMR_RXF2(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXF2_SHIFT)) & ENET_EIMR_RXF2_MASK)
+#define ENET_EIMR_TXB2_MASK                             (0x40U)
+#define ENET_EIMR_TXB2_SHIFT                            (6U)
+#define ENET_EIMR_TXB2(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TXB2_SHIFT)) & ENET_EIMR_TXB2_MASK)
+#define ENET_EIMR_TXF2_MASK                             (0x80U)
+#define ENET_EIMR_TXF2_SHIFT                            (7U)
+#define ENET_EIMR_TXF2(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TXF2_SHIFT)) & ENET_EIMR_TXF2_MASK)
+#define ENET_EIMR_RXFLUSH_0_MASK                        (0x1000U)
+#define ENET_EIMR_RXFLUSH_0_SHIFT                       (12U)
+#define ENET_EIMR_RXFLUSH_0(x)                          (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXFLUSH_0_SHIFT)) & ENET_EIMR_RXFLUSH_0_MASK)
+#define ENET_EIMR_RXFLUSH_1_MASK                        (0x2000U)
+#define ENET_EIMR_RXFLUSH_1_SHIFT                       (13U)
+#define ENET_EIMR_RXFLUSH_1(x)                          (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXFLUSH_1_SHIFT)) & ENET_EIMR_RXFLUSH_1_MASK)
+#define ENET_EIMR_RXFLUSH_2_MASK                        (0x4000U)
+#define ENET_EIMR_RXFLUSH_2_SHIFT                       (14U)
+#define ENET_EIMR_RXFLUSH_2(x)                          (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXFLUSH_2_SHIFT)) & ENET_EIMR_RXFLUSH_2_MASK)
+#define ENET_EIMR_TS_TIMER_MASK                         (0x8000U)
+#define ENET_EIMR_TS_TIMER_SHIFT                        (15U)
+#define ENET_EIMR_TS_TIMER(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TS_TIMER_SHIFT)) & ENET_EIMR_TS_TIMER_MASK)
+#define ENET_EIMR_TS_AVAIL_MASK                         (0x10000U)
+#define ENET_EIMR_TS_AVAIL_SHIFT                        (16U)
+#define ENET_EIMR_TS_AVAIL(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TS_AVAIL_SHIFT)) & ENET_EIMR_TS_AVAIL_MASK)
+#define ENET_EIMR_WAKEUP_MASK                           (0x20000U)
+#define ENET_EIMR_WAKEUP_SHIFT                          (17U)
+#define ENET_EIMR_WAKEUP(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_WAKEUP_SHIFT)) & ENET_EIMR_WAKEUP_MASK)
+#define ENET_EIMR_PLR_MASK                              (0x40000U)
+#define ENET_EIMR_PLR_SHIFT                             (18U)
+#define ENET_EIMR_PLR(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_PLR_SHIFT)) & ENET_EIMR_PLR_MASK)
+#define ENET_EIMR_UN_MASK                               (0x80000U)
+#define ENET_EIMR_UN_SHIFT                              (19U)
+#define ENET_EIMR_UN(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_UN_SHIFT)) & ENET_EIMR_UN_MASK)
+#define ENET_EIMR_RL_MASK                               (0x100000U)
+#define ENET_EIMR_RL_SHIFT                              (20U)
+#define ENET_EIMR_RL(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RL_SHIFT)) & ENET_EIMR_RL_MASK)
+#define ENET_EIMR_LC_MASK                               (0x200000U)
+#define ENET_EIMR_LC_SHIFT                              (21U)
+#define ENET_EIMR_LC(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_LC_SHIFT)) & ENET_EIMR_LC_MASK)
+#define ENET_EIMR_EBERR_MASK                            (0x400000U)
+#define ENET_EIMR_EBERR_SHIFT                           (22U)
+#define ENET_EIMR_EBERR(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_EBERR_SHIFT)) & ENET_EIMR_EBERR_MASK)
+#define ENET_EIMR_MII_MASK                              (0x800000U)
+#define ENET_EIMR_MII_SHIFT                             (23U)
+#define ENET_EIMR_MII(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_MII_SHIFT)) & ENET_EIMR_MII_MASK)
+#define ENET_EIMR_RXB_MASK                              (0x1000000U)
+#define ENET_EIMR_RXB_SHIFT                             (24U)
+#define ENET_EIMR_RXB(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXB_SHIFT)) & ENET_EIMR_RXB_MASK)
+#define ENET_EIMR_RXF_MASK                              (0x2000000U)
+#define ENET_EIMR_RXF_SHIFT                             (25U)
+#define ENET_EIMR_RXF(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_RXF_SHIFT)) & ENET_EIMR_RXF_MASK)
+#define ENET_EIMR_TXB_MASK                              (0x4000000U)
+#define ENET_EIMR_TXB_SHIFT                             (26U)
+#define ENET_EIMR_TXB(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TXB_SHIFT)) & ENET_EIMR_TXB_MASK)
+#define ENET_EIMR_TXF_MASK                              (0x8000000U)
+#define ENET_EIMR_TXF_SHIFT                             (27U)
+#define ENET_EIMR_TXF(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_TXF_SHIFT)) & ENET_EIMR_TXF_MASK)
+#define ENET_EIMR_GRA_MASK                              (0x10000000U)
+#define ENET_EIMR_GRA_SHIFT                             (28U)
+#define ENET_EIMR_GRA(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_GRA_SHIFT)) & ENET_EIMR_GRA_MASK)
+#define ENET_EIMR_BABT_MASK                             (0x20000000U)
+#define ENET_EIMR_BABT_SHIFT                            (29U)
+#define ENET_EIMR_BABT(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_BABT_SHIFT)) & ENET_EIMR_BABT_MASK)
+#define ENET_EIMR_BABR_MASK                             (0x40000000U)
+#define ENET_EIMR_BABR_SHIFT                            (30U)
+#define ENET_EIMR_BABR(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_EIMR_BABR_SHIFT)) & ENET_EIMR_BABR_MASK)
+/*! @} */
+
+/*! @name RDAR */
+/*! @{ */
+#define ENET_RDAR_RDAR_MASK                             (0x1000000U)
+#define ENET_RDAR_RDAR_SHIFT                            (24U)
+#define ENET_RDAR_RDAR(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RDAR_RDAR_SHIFT)) & ENET_RDAR_RDAR_MASK)
+/*! @} */
+
+/*! @name TDAR */
+/*! @{ */
+#define ENET_TDAR_TDAR_MASK                             (0x1000000U)
+#define ENET_TDAR_TDAR_SHIFT                            (24U)
+#define ENET_TDAR_TDAR(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TDAR_TDAR_SHIFT)) & ENET_TDAR_TDAR_MASK)
+/*! @} */
+
+/*! @name ECR */
+/*! @{ */
+#define ENET_ECR_RESET_MASK                             (0x1U)
+#define ENET_ECR_RESET_SHIFT                            (0U)
+#define ENET_ECR_RESET(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ECR_RESET_SHIFT)) & ENET_ECR_RESET_MASK)
+#define ENET_ECR_ETHEREN_MASK                           (0x2U)
+#define ENET_ECR_ETHEREN_SHIFT                          (1U)
+#define ENET_ECR_ETHEREN(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ECR_ETHEREN_SHIFT)) & ENET_ECR_ETHEREN_MASK)
+#define ENET_ECR_MAGICEN_MASK                           (0x4U)
+#define ENET_ECR_MAGICEN_SHIFT                          (2U)
+#define ENET_ECR_MAGICEN(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ECR_MAGICEN_SHIFT)) & ENET_ECR_MAGICEN_MASK)
+#define ENET_ECR_SLEEP_MASK                             (0x8U)
+#define ENET_ECR_SLEEP_SHIFT                            (3U)
+#define ENET_ECR_SLEEP(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ECR_SLEEP_SHIFT)) & ENET_ECR_SLEEP_MASK)
+#define ENET_ECR_EN1588_MASK                            (0x10U)
+#define ENET_ECR_EN1588_SHIFT                           (4U)
+#define ENET_ECR_EN1588(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_ECR_EN1588_SHIFT)) & ENET_ECR_EN1588_MASK)
+#define ENET_ECR_SPEED_MASK                             (0x20U)
+#define ENET_ECR_SPEED_SHIFT                            (5U)
+#define ENET_ECR_SPEED(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ECR_SPEED_SHIFT)) & ENET_ECR_SPEED_MASK)
+#define ENET_ECR_DBGEN_MASK                             (0x40U)
+#define ENET_ECR_DBGEN_SHIFT                            (6U)
+#define ENET_ECR_DBGEN(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ECR_DBGEN_SHIFT)) & ENET_ECR_DBGEN_MASK)
+#define ENET_ECR_DBSWP_MASK                             (0x100U)
+#define ENET_ECR_DBSWP_SHIFT                            (8U)
+#define ENET_ECR_DBSWP(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ECR_DBSWP_SHIFT)) & ENET_ECR_DBSWP_MASK)
+#define ENET_ECR_SVLANEN_MASK                           (0x200U)
+#define ENET_ECR_SVLANEN_SHIFT                          (9U)
+#define ENET_ECR_SVLANEN(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ECR_SVLANEN_SHIFT)) & ENET_ECR_SVLANEN_MASK)
+#define ENET_ECR_VLANUSE2ND_MASK                        (0x400U)
+#define ENET_ECR_VLANUSE2ND_SHIFT                       (10U)
+#define ENET_ECR_VLANUSE2ND(x)                          (((uint32_t)(((uint32_t)(x)) << ENET_ECR_VLANUSE2ND_SHIFT)) & ENET_ECR_VLANUSE2ND_MASK)
+#define ENET_ECR_SVLANDBL_MASK                          (0x800U)
+#define ENET_ECR_SVLANDBL_SHIFT                         (11U)
+#define ENET_ECR_SVLANDBL(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_ECR_SVLANDBL_SHIFT)) & ENET_ECR_SVLANDBL_MASK)
+#define ENET_ECR_TXC_DLY_MASK                           (0x10000U)
+#define ENET_ECR_TXC_DLY_SHIFT                          (16U)
+#define ENET_ECR_TXC_DLY(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ECR_TXC_DLY_SHIFT)) & ENET_ECR_TXC_DLY_MASK)
+#define ENET_ECR_RXC_DLY_MASK                           (0x20000U)
+#define ENET_ECR_RXC_DLY_SHIFT                          (17U)
+#define ENET_ECR_RXC_DLY(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ECR_RXC_DLY_SHIFT)) & ENET_ECR_RXC_DLY_MASK)
+/*! @} */
+
+/*! @name MMFR */
+/*! @{ */
+#define ENET_MMFR_DATA_MASK                             (0xFFFFU)
+#define ENET_MMFR_DATA_SHIFT                            (0U)
+#define ENET_MMFR_DATA(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_MMFR_DATA_SHIFT)) & ENET_MMFR_DATA_MASK)
+#define ENET_MMFR_TA_MASK                               (0x30000U)
+#define ENET_MMFR_TA_SHIFT                              (16U)
+#define ENET_MMFR_TA(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_MMFR_TA_SHIFT)) & ENET_MMFR_TA_MASK)
+#define ENET_MMFR_RA_MASK                               (0x7C0000U)
+#define ENET_MMFR_RA_SHIFT                              (18U)
+#define ENET_MMFR_RA(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_MMFR_RA_SHIFT)) & ENET_MMFR_RA_MASK)
+#define ENET_MMFR_PA_MASK                               (0xF800000U)
+#define ENET_MMFR_PA_SHIFT                              (23U)
+#define ENET_MMFR_PA(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_MMFR_PA_SHIFT)) & ENET_MMFR_PA_MASK)
+#define ENET_MMFR_OP_MASK                               (0x30000000U)
+#define ENET_MMFR_OP_SHIFT                              (28U)
+#define ENET_MMFR_OP(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_MMFR_OP_SHIFT)) & ENET_MMFR_OP_MASK)
+#define ENET_MMFR_ST_MASK                               (0xC0000000U)
+#define ENET_MMFR_ST_SHIFT                              (30U)
+#define ENET_MMFR_ST(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_MMFR_ST_SHIFT)) & ENET_MMFR_ST_MASK)
+/*! @} */
+
+/*! @name MSCR */
+/*! @{ */
+#define ENET_MSCR_MII_SPEED_MASK                        (0x7EU)
+#define ENET_MSCR_MII_SPEED_SHIFT                       (1U)
+#define ENET_MSCR_MII_SPEED(x)                          (((uint32_t)(((uint32_t)(x)) << ENET_MSCR_MII_SPEED_SHIFT)) & ENET_MSCR_MII_SPEED_MASK)
+#define ENET_MSCR_DIS_PRE_MASK                          (0x80U)
+#define ENET_MSCR_DIS_PRE_SHIFT                         (7U)
+#define ENET_MSCR_DIS_PRE(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_MSCR_DIS_PRE_SHIFT)) & ENET_MSCR_DIS_PRE_MASK)
+#define ENET_MSCR_HOLDTIME_MASK                         (0x700U)
+#define ENET_MSCR_HOLDTIME_SHIFT                        (8U)
+#define ENET_MSCR_HOLDTIME(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_MSCR_HOLDTIME_SHIFT)) & ENET_MSCR_HOLDTIME_MASK)
+/*! @} */
+
+/*! @name RCR */
+/*! @{ */
+#define ENET_RCR_LOOP_MASK                              (0x1U)
+#define ENET_RCR_LOOP_SHIFT                             (0U)
+#define ENET_RCR_LOOP(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_RCR_LOOP_SHIFT)) & ENET_RCR_LOOP_MASK)
+#define ENET_RCR_DRT_MASK                               (0x2U)
+#define ENET_RCR_DRT_SHIFT                              (1U)
+#define ENET_RCR_DRT(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_RCR_DRT_SHIFT)) & ENET_RCR_DRT_MASK)
+#define ENET_RCR_MII_MODE_MASK                          (0x4U)
+#define ENET_RCR_MII_MODE_SHIFT                         (2U)
+#define ENET_RCR_MII_MODE(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_RCR_MII_MODE_SHIFT)) & ENET_RCR_MII_MODE_MASK)
+#define ENET_RCR_PROM_MASK                              (0x8U)
+#define ENET_RCR_PROM_SHIFT                             (3U)
+#define ENET_RCR_PROM(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_RCR_PROM_SHIFT)) & ENET_RCR_PROM_MASK)
+#define ENET_RCR_BC_REJ_MASK                            (0x10U)
+#define ENET_RCR_BC_REJ_SHIFT                           (4U)
+#define ENET_RCR_BC_REJ(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RCR_BC_REJ_SHIFT)) & ENET_RCR_BC_REJ_MASK)
+#define ENET_RCR_FCE_MASK                               (0x20U)
+#define ENET_RCR_FCE_SHIFT                              (5U)
+#define ENET_RCR_FCE(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_RCR_FCE_SHIFT)) & ENET_RCR_FCE_MASK)
+#define ENET_RCR_RGMII_EN_MASK                          (0x40U)
+#define ENET_RCR_RGMII_EN_SHIFT                         (6U)
+#define ENET_RCR_RGMII_EN(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_RCR_RGMII_EN_SHIFT)) & ENET_RCR_RGMII_EN_MASK)
+#define ENET_RCR_RMII_MODE_MASK                         (0x100U)
+#define ENET_RCR_RMII_MODE_SHIFT                        (8U)
+#define ENET_RCR_RMII_MODE(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_RCR_RMII_MODE_SHIFT)) & ENET_RCR_RMII_MODE_MASK)
+#define ENET_RCR_RMII_10T_MASK                          (0x200U)
+#define ENET_RCR_RMII_10T_SHIFT                         (9U)
+#define ENET_RCR_RMII_10T(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_RCR_RMII_10T_SHIFT)) & ENET_RCR_RMII_10T_MASK)
+#define ENET_RCR_PADEN_MASK                             (0x1000U)
+#define ENET_RCR_PADEN_SHIFT                            (12U)
+#define ENET_RCR_PADEN(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RCR_PADEN_SHIFT)) & ENET_RCR_PADEN_MASK)
+#define ENET_RCR_PAUFWD_MASK                            (0x2000U)
+#define ENET_RCR_PAUFWD_SHIFT                           (13U)
+#define ENET_RCR_PAUFWD(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RCR_PAUFWD_SHIFT)) & ENET_RCR_PAUFWD_MASK)
+#define ENET_RCR_CRCFWD_MASK                            (0x4000U)
+#define ENET_RCR_CRCFWD_SHIFT                           (14U)
+#define ENET_RCR_CRCFWD(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RCR_CRCFWD_SHIFT)) & ENET_RCR_CRCFWD_MASK)
+#define ENET_RCR_CFEN_MASK                              (0x8000U)
+#define ENET_RCR_CFEN_SHIFT                             (15U)
+#define ENET_RCR_CFEN(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_RCR_CFEN_SHIFT)) & ENET_RCR_CFEN_MASK)
+#define ENET_RCR_MAX_FL_MASK                            (0x3FFF0000U)
+#define ENET_RCR_MAX_FL_SHIFT                           (16U)
+#define ENET_RCR_MAX_FL(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RCR_MAX_FL_SHIFT)) & ENET_RCR_MAX_FL_MASK)
+#define ENET_RCR_NLC_MASK                               (0x40000000U)
+#define ENET_RCR_NLC_SHIFT                              (30U)
+#define ENET_RCR_NLC(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_RCR_NLC_SHIFT)) & ENET_RCR_NLC_MASK)
+#define ENET_RCR_GRS_MASK                               (0x80000000U)
+#define ENET_RCR_GRS_SHIFT                              (31U)
+#define ENET_RCR_GRS(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_RCR_GRS_SHIFT)) & ENET_RCR_GRS_MASK)
+/*! @} */
+
+/*! @name TCR */
+/*! @{ */
+#define ENET_TCR_GTS_MASK                               (0x1U)
+#define ENET_TCR_GTS_SHIFT                              (0U)
+#define ENET_TCR_GTS(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_TCR_GTS_SHIFT)) & ENET_TCR_GTS_MASK)
+#define ENET_TCR_FDEN_MASK                              (0x4U)
+#define ENET_TCR_FDEN_SHIFT                             (2U)
+#define ENET_TCR_FDEN(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_TCR_FDEN_SHIFT)) & ENET_TCR_FDEN_MASK)
+#define ENET_TCR_TFC_PAUSE_MASK                         (0x8U)
+#define ENET_TCR_TFC_PAUSE_SHIFT                        (3U)
+#define ENET_TCR_TFC_PAUSE(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_TCR_TFC_PAUSE_SHIFT)) & ENET_TCR_TFC_PAUSE_MASK)
+#define ENET_TCR_RFC_PAUSE_MASK                         (0x10U)
+#define ENET_TCR_RFC_PAUSE_SHIFT                        (4U)
+#define ENET_TCR_RFC_PAUSE(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_TCR_RFC_PAUSE_SHIFT)) & ENET_TCR_RFC_PAUSE_MASK)
+#define ENET_TCR_ADDSEL_MASK                            (0xE0U)
+#define ENET_TCR_ADDSEL_SHIFT                           (5U)
+#define ENET_TCR_ADDSEL(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TCR_ADDSEL_SHIFT)) & ENET_TCR_ADDSEL_MASK)
+#define ENET_TCR_ADDINS_MASK                            (0x100U)
+#define ENET_TCR_ADDINS_SHIFT                           (8U)
+#define ENET_TCR_ADDINS(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TCR_ADDINS_SHIFT)) & ENET_TCR_ADDINS_MASK)
+#define ENET_TCR_CRCFWD_MASK                            (0x200U)
+#define ENET_TCR_CRCFWD_SHIFT                           (9U)
+#define ENET_TCR_CRCFWD(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TCR_CRCFWD_SHIFT)) & ENET_TCR_CRCFWD_MASK)
+/*! @} */
+
+/*! @name PALR */
+/*! @{ */
+#define ENET_PALR_PADDR1_MASK                           (0xFFFFFFFFU)
+#define ENET_PALR_PADDR1_SHIFT                          (0U)
+#define ENET_PALR_PADDR1(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_PALR_PADDR1_SHIFT)) & ENET_PALR_PADDR1_MASK)
+/*! @} */
+
+/*! @name PAUR */
+/*! @{ */
+#define ENET_PAUR_TYPE_MASK                             (0xFFFFU)
+#define ENET_PAUR_TYPE_SHIFT                            (0U)
+#define ENET_PAUR_TYPE(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_PAUR_TYPE_SHIFT)) & ENET_PAUR_TYPE_MASK)
+#define ENET_PAUR_PADDR2_MASK                           (0xFFFF0000U)
+#define ENET_PAUR_PADDR2_SHIFT                          (16U)
+#define ENET_PAUR_PADDR2(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_PAUR_PADDR2_SHIFT)) & ENET_PAUR_PADDR2_MASK)
+/*! @} */
+
+/*! @name OPD */
+/*! @{ */
+#define ENET_OPD_PAUSE_DUR_MASK                         (0xFFFFU)
+#define ENET_OPD_PAUSE_DUR_SHIFT                        (0U)
+#define ENET_OPD_PAUSE_DUR(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_OPD_PAUSE_DUR_SHIFT)) & ENET_OPD_PAUSE_DUR_MASK)
+#define ENET_OPD_OPCODE_MASK                            (0xFFFF0000U)
+#define ENET_OPD_OPCODE_SHIFT                           (16U)
+#define ENET_OPD_OPCODE(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_OPD_OPCODE_SHIFT)) & ENET_OPD_OPCODE_MASK)
+/*! @} */
+
+/*! @name TXIC */
+/*! @{ */
+#define ENET_TXIC_ICTT_MASK                             (0xFFFFU)
+#define ENET_TXIC_ICTT_SHIFT                            (0U)
+#define ENET_TXIC_ICTT(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TXIC_ICTT_SHIFT)) & ENET_TXIC_ICTT_MASK)
+#define ENET_TXIC_ICFT_MASK                             (0xFF00000U)
+#define ENET_TXIC_ICFT_SHIFT                            (20U)
+#define ENET_TXIC_ICFT(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TXIC_ICFT_SHIFT)) & ENET_TXIC_ICFT_MASK)
+#define ENET_TXIC_ICCS_MASK                             (0x40000000U)
+#define ENET_TXIC_ICCS_SHIFT                            (30U)
+#define ENET_TXIC_ICCS(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TXIC_ICCS_SHIFT)) & ENET_TXIC_ICCS_MASK)
+#define ENET_TXIC_ICEN_MASK                             (0x80000000U)
+#define ENET_TXIC_ICEN_SHIFT                            (31U)
+#define ENET_TXIC_ICEN(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TXIC_ICEN_SHIFT)) & ENET_TXIC_ICEN_MASK)
+/*! @} */
+
+/*! @name RXIC */
+/*! @{ */
+#define ENET_RXIC_ICTT_MASK                             (0xFFFFU)
+#define ENET_RXIC_ICTT_SHIFT                            (0U)
+#define ENET_RXIC_ICTT(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RXIC_ICTT_SHIFT)) & ENET_RXIC_ICTT_MASK)
+#define ENET_RXIC_ICFT_MASK                             (0xFF00000U)
+#define ENET_RXIC_ICFT_SHIFT                            (20U)
+#define ENET_RXIC_ICFT(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RXIC_ICFT_SHIFT)) & ENET_RXIC_ICFT_MASK)
+#define ENET_RXIC_ICCS_MASK                             (0x40000000U)
+#define ENET_RXIC_ICCS_SHIFT                            (30U)
+#define ENET_RXIC_ICCS(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RXIC_ICCS_SHIFT)) & ENET_RXIC_ICCS_MASK)
+#define ENET_RXIC_ICEN_MASK                             (0x80000000U)
+#define ENET_RXIC_ICEN_SHIFT                            (31U)
+#define ENET_RXIC_ICEN(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RXIC_ICEN_SHIFT)) & ENET_RXIC_ICEN_MASK)
+/*! @} */
+
+/*! @name TFWR */
+/*! @{ */
+#define ENET_TFWR_TFWR_MASK                             (0x3FU)
+#define ENET_TFWR_TFWR_SHIFT                            (0U)
+#define ENET_TFWR_TFWR(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TFWR_TFWR_SHIFT)) & ENET_TFWR_TFWR_MASK)
+#define ENET_TFWR_STRFWD_MASK                           (0x100U)
+#define ENET_TFWR_STRFWD_SHIFT                          (8U)
+#define ENET_TFWR_STRFWD(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_TFWR_STRFWD_SHIFT)) & ENET_TFWR_STRFWD_MASK)
+/*! @} */
+
+/*! @name RDAR1 */
+/*! @{ */
+#define ENET_RDAR1_RDAR_MASK                            (0x1000000U)
+#define ENET_RDAR1_RDAR_SHIFT                           (24U)
+#define ENET_RDAR1_RDAR(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RDAR1_RDAR_SHIFT)) & ENET_RDAR1_RDAR_MASK)
+/*! @} */
+
+/*! @name TDAR1 */
+/*! @{ */
+#define ENET_TDAR1_TDAR_MASK                            (0x1000000U)
+#define ENET_TDAR1_TDAR_SHIFT                           (24U)
+#define ENET_TDAR1_TDAR(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TDAR1_TDAR_SHIFT)) & ENET_TDAR1_TDAR_MASK)
+/*! @} */
+
+/*! @name RDAR2 */
+/*! @{ */
+#define ENET_RDAR2_RDAR_MASK                            (0x1000000U)
+#define ENET_RDAR2_RDAR_SHIFT                           (24U)
+#define ENET_RDAR2_RDAR(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RDAR2_RDAR_SHIFT)) & ENET_RDAR2_RDAR_MASK)
+/*! @} */
+
+/*! @name TDAR2 */
+/*! @{ */
+#define ENET_TDAR2_TDAR_MASK                            (0x1000000U)
+#define ENET_TDAR2_TDAR_SHIFT                           (24U)
+#define ENET_TDAR2_TDAR(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TDAR2_TDAR_SHIFT)) & ENET_TDAR2_TDAR_MASK)
+/*! @} */
+
+/*! @name QOS */
+/*! @{ */
+#define ENET_QOS_TX_SCHEME_MASK                         (0x7U)
+#define ENET_QOS_TX_SCHEME_SHIFT                        (0U)
+#define ENET_QOS_TX_SCHEME(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_QOS_TX_SCHEME_SHIFT)) & ENET_QOS_TX_SCHEME_MASK)
+#define ENET_QOS_RX_FLUSH0_MASK                         (0x8U)
+#define ENET_QOS_RX_FLUSH0_SHIFT                        (3U)
+#define ENET_QOS_RX_FLUSH0(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_QOS_RX_FLUSH0_SHIFT)) & ENET_QOS_RX_FLUSH0_MASK)
+#define ENET_QOS_RX_FLUSH1_MASK                         (0x10U)
+#define ENET_QOS_RX_FLUSH1_SHIFT                        (4U)
+#define ENET_QOS_RX_FLUSH1(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_QOS_RX_FLUSH1_SHIFT)) & ENET_QOS_RX_FLUSH1_MASK)
+#define ENET_QOS_RX_FLUSH2_MASK                         (0x20U)
+#define ENET_QOS_RX_FLUSH2_SHIFT                        (5U)
+#define ENET_QOS_RX_FLUSH2(x)                           (((uint32_t)(((uint32_t)(x)) << ENET_QOS_RX_FLUSH2_SHIFT)) & ENET_QOS_RX_FLUSH2_MASK)
+/*! @} */
+
+/*! @name MRBR */
+/*! @{ */
+#define ENET_MRBR_R_BUF_SIZE_MASK                       (0x3FF0U)
+#define ENET_MRBR_R_BUF_SIZE_SHIFT                      (4U)
+#define ENET_MRBR_R_BUF_SIZE(x)                         (((uint32_t)(((uint32_t)(x)) << ENET_MRBR_R_BUF_SIZE_SHIFT)) & ENET_MRBR_R_BUF_SIZE_MASK)
+/*! @} */
+
+/*! @name RSFL */
+/*! @{ */
+#define ENET_RSFL_RX_SECTION_FULL_MASK                  (0xFFU)
+#define ENET_RSFL_RX_SECTION_FULL_SHIFT                 (0U)
+#define ENET_RSFL_RX_SECTION_FULL(x)                    (((uint32_t)(((uint32_t)(x)) << ENET_RSFL_RX_SECTION_FULL_SHIFT)) & ENET_RSFL_RX_SECTION_FULL_MASK)
+/*! @} */
+
+/*! @name RSEM */
+/*! @{ */
+#define ENET_RSEM_RX_SECTION_EMPTY_MASK                 (0xFFU)
+#define ENET_RSEM_RX_SECTION_EMPTY_SHIFT                (0U)
+#define ENET_RSEM_RX_SECTION_EMPTY(x)                   (((uint32_t)(((uint32_t)(x)) << ENET_RSEM_RX_SECTION_EMPTY_SHIFT)) & ENET_RSEM_RX_SECTION_EMPTY_MASK)
+#define ENET_RSEM_STAT_SECTION_EMPTY_MASK               (0x1F0000U)
+#define ENET_RSEM_STAT_SECTION_EMPTY_SHIFT              (16U)
+#define ENET_RSEM_STAT_SECTION_EMPTY(x)                 (((uint32_t)(((uint32_t)(x)) << ENET_RSEM_STAT_SECTION_EMPTY_SHIFT)) & ENET_RSEM_STAT_SECTION_EMPTY_MASK)
+/*! @} */
+
+/*! @name TACC */
+/*! @{ */
+#define ENET_TACC_SHIFT16_MASK                          (0x1U)
+#define ENET_TACC_SHIFT16_SHIFT                         (0U)
+#define ENET_TACC_SHIFT16(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_TACC_SHIFT16_SHIFT)) & ENET_TACC_SHIFT16_MASK)
+#define ENET_TACC_IPCHK_MASK                            (0x8U)
+#define ENET_TACC_IPCHK_SHIFT                           (3U)
+#define ENET_TACC_IPCHK(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TACC_IPCHK_SHIFT)) & ENET_TACC_IPCHK_MASK)
+#define ENET_TACC_PROCHK_MASK                           (0x10U)
+#define ENET_TACC_PROCHK_SHIFT                          (4U)
+#define ENET_TACC_PROCHK(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_TACC_PROCHK_SHIFT)) & ENET_TACC_PROCHK_MASK)
+/*! @} */
+
+/*! @name RACC */
+/*! @{ */
+#define ENET_RACC_PADREM_MASK                           (0x1U)
+#define ENET_RACC_PADREM_SHIFT                          (0U)
+#define ENET_RACC_PADREM(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_RACC_PADREM_SHIFT)) & ENET_RACC_PADREM_MASK)
+#define ENET_RACC_IPDIS_MASK                            (0x2U)
+#define ENET_RACC_IPDIS_SHIFT                           (1U)
+#define ENET_RACC_IPDIS(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_RACC_IPDIS_SHIFT)) & ENET_RACC_IPDIS_MASK)
+#define ENET_RACC_PRODIS_MASK                           (0x4U)
+#define ENET_RACC_PRODIS_SHIFT                          (2U)
+#define ENET_RACC_PRODIS(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_RACC_PRODIS_SHIFT)) & ENET_RACC_PRODIS_MASK)
+#define ENET_RACC_LINEDIS_MASK                          (0x40U)
+#define ENET_RACC_LINEDIS_SHIFT                         (6U)
+#define ENET_RACC_LINEDIS(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_RACC_LINEDIS_SHIFT)) & ENET_RACC_LINEDIS_MASK)
+#define ENET_RACC_SHIFT16_MASK                          (0x80U)
+#define ENET_RACC_SHIFT16_SHIFT                         (7U)
+#define ENET_RACC_SHIFT16(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_RACC_SHIFT16_SHIFT)) & ENET_RACC_SHIFT16_MASK)
+/*! @} */
+
+/*! @name RCMR */
+/*! @{ */
+#define ENET_RCMR_CMP0_MASK                             (0x7U)
+#define ENET_RCMR_CMP0_SHIFT                            (0U)
+#define ENET_RCMR_CMP0(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RCMR_CMP0_SHIFT)) & ENET_RCMR_CMP0_MASK)
+#define ENET_RCMR_CMP1_MASK                             (0x70U)
+#define ENET_RCMR_CMP1_SHIFT                            (4U)
+#define ENET_RCMR_CMP1(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RCMR_CMP1_SHIFT)) & ENET_RCMR_CMP1_MASK)
+#define ENET_RCMR_CMP2_MASK                             (0x700U)
+#define ENET_RCMR_CMP2_SHIFT                            (8U)
+#define ENET_RCMR_CMP2(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RCMR_CMP2_SHIFT)) & ENET_RCMR_CMP2_MASK)
+#define ENET_RCMR_CMP3_MASK                             (0x7000U)
+#define ENET_RCMR_CMP3_SHIFT                            (12U)
+#define ENET_RCMR_CMP3(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_RCMR_CMP3_SHIFT)) & ENET_RCMR_CMP3_MASK)
+#define ENET_RCMR_MATCHEN_MASK                          (0x10000U)
+#define ENET_RCMR_MATCHEN_SHIFT                         (16U)
+#define ENET_RCMR_MATCHEN(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_RCMR_MATCHEN_SHIFT)) & ENET_RCMR_MATCHEN_MASK)
+/*! @} */
+
+/*! @name DMACFG */
+/*! @{ */
+#define ENET_DMACFG_IDLE_SLOPE_MASK                     (0xFFFFU)
+#define ENET_DMACFG_IDLE_SLOPE_SHIFT                    (0U)
+#define ENET_DMACFG_IDLE_SLOPE(x)                       (((uint32_t)(((uint32_t)(x)) << ENET_DMACFG_IDLE_SLOPE_SHIFT)) & ENET_DMACFG_IDLE_SLOPE_MASK)
+#define ENET_DMACFG_DMA_CLASS_EN_MASK                   (0x10000U)
+#define ENET_DMACFG_DMA_CLASS_EN_SHIFT                  (16U)
+#define ENET_DMACFG_DMA_CLASS_EN(x)                     (((uint32_t)(((uint32_t)(x)) << ENET_DMACFG_DMA_CLASS_EN_SHIFT)) & ENET_DMACFG_DMA_CLASS_EN_MASK)
+#define ENET_DMACFG_CALC_NOIPG_MASK                     (0x20000U)
+#define ENET_DMACFG_CALC_NOIPG_SHIFT                    (17U)
+#define ENET_DMACFG_CALC_NOIPG(x)                       (((uint32_t)(((uint32_t)(x)) << ENET_DMACFG_CALC_NOIPG_SHIFT)) & ENET_DMACFG_CALC_NOIPG_MASK)
+/*! @} */
+
+/*! @name MRBR1 */
+/*! @{ */
+#define ENET_MRBR1_R_BUF_SIZE_MASK                      (0x3FF0U)
+#define ENET_MRBR1_R_BUF_SIZE_SHIFT                     (4U)
+#define ENET_MRBR1_R_BUF_SIZE(x)                        (((uint32_t)(((uint32_t)(x)) << ENET_MRBR1_R_BUF_SIZE_SHIFT)) & ENET_MRBR1_R_BUF_SIZE_MASK)
+/*! @} */
+
+/*! @name MRBR2 */
+/*! @{ */
+#define ENET_MRBR2_R_BUF_SIZE_MASK                      (0x3FF0U)
+#define ENET_MRBR2_R_BUF_SIZE_SHIFT                     (4U)
+#define ENET_MRBR2_R_BUF_SIZE(x)                        (((uint32_t)(((uint32_t)(x)) << ENET_MRBR2_R_BUF_SIZE_SHIFT)) & ENET_MRBR2_R_BUF_SIZE_MASK)
+/*! @} */
+
+/*! @name ATCR */
+/*! @{ */
+#define ENET_ATCR_EN_MASK                               (0x1U)
+#define ENET_ATCR_EN_SHIFT                              (0U)
+#define ENET_ATCR_EN(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_EN_SHIFT)) & ENET_ATCR_EN_MASK)
+#define ENET_ATCR_OFFEN_MASK                            (0x4U)
+#define ENET_ATCR_OFFEN_SHIFT                           (2U)
+#define ENET_ATCR_OFFEN(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_OFFEN_SHIFT)) & ENET_ATCR_OFFEN_MASK)
+#define ENET_ATCR_OFFRST_MASK                           (0x8U)
+#define ENET_ATCR_OFFRST_SHIFT                          (3U)
+#define ENET_ATCR_OFFRST(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_OFFRST_SHIFT)) & ENET_ATCR_OFFRST_MASK)
+#define ENET_ATCR_PEREN_MASK                            (0x10U)
+#define ENET_ATCR_PEREN_SHIFT                           (4U)
+#define ENET_ATCR_PEREN(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_PEREN_SHIFT)) & ENET_ATCR_PEREN_MASK)
+#define ENET_ATCR_PINPER_MASK                           (0x80U)
+#define ENET_ATCR_PINPER_SHIFT                          (7U)
+#define ENET_ATCR_PINPER(x)                             (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_PINPER_SHIFT)) & ENET_ATCR_PINPER_MASK)
+#define ENET_ATCR_RESTART_MASK                          (0x200U)
+#define ENET_ATCR_RESTART_SHIFT                         (9U)
+#define ENET_ATCR_RESTART(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_RESTART_SHIFT)) & ENET_ATCR_RESTART_MASK)
+#define ENET_ATCR_CAPTURE_MASK                          (0x800U)
+#define ENET_ATCR_CAPTURE_SHIFT                         (11U)
+#define ENET_ATCR_CAPTURE(x)                            (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_CAPTURE_SHIFT)) & ENET_ATCR_CAPTURE_MASK)
+#define ENET_ATCR_SLAVE_MASK                            (0x2000U)
+#define ENET_ATCR_SLAVE_SHIFT                           (13U)
+#define ENET_ATCR_SLAVE(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_ATCR_SLAVE_SHIFT)) & ENET_ATCR_SLAVE_MASK)
+/*! @} */
+
+/*! @name ATCOR */
+/*! @{ */
+#define ENET_ATCOR_COR_MASK                             (0x7FFFFFFFU)
+#define ENET_ATCOR_COR_SHIFT                            (0U)
+#define ENET_ATCOR_COR(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ATCOR_COR_SHIFT)) & ENET_ATCOR_COR_MASK)
+/*! @} */
+
+/*! @name ATINC */
+/*! @{ */
+#define ENET_ATINC_INC_MASK                             (0x7FU)
+#define ENET_ATINC_INC_SHIFT                            (0U)
+#define ENET_ATINC_INC(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_ATINC_INC_SHIFT)) & ENET_ATINC_INC_MASK)
+#define ENET_ATINC_INC_CORR_MASK                        (0x7F00U)
+#define ENET_ATINC_INC_CORR_SHIFT                       (8U)
+#define ENET_ATINC_INC_CORR(x)                          (((uint32_t)(((uint32_t)(x)) << ENET_ATINC_INC_CORR_SHIFT)) & ENET_ATINC_INC_CORR_MASK)
+/*! @} */
+
+/*! @name TGSR */
+/*! @{ */
+#define ENET_TGSR_TF0_MASK                              (0x1U)
+#define ENET_TGSR_TF0_SHIFT                             (0U)
+#define ENET_TGSR_TF0(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_TGSR_TF0_SHIFT)) & ENET_TGSR_TF0_MASK)
+#define ENET_TGSR_TF1_MASK                              (0x2U)
+#define ENET_TGSR_TF1_SHIFT                             (1U)
+#define ENET_TGSR_TF1(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_TGSR_TF1_SHIFT)) & ENET_TGSR_TF1_MASK)
+#define ENET_TGSR_TF2_MASK                              (0x4U)
+#define ENET_TGSR_TF2_SHIFT                             (2U)
+#define ENET_TGSR_TF2(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_TGSR_TF2_SHIFT)) & ENET_TGSR_TF2_MASK)
+#define ENET_TGSR_TF3_MASK                              (0x8U)
+#define ENET_TGSR_TF3_SHIFT                             (3U)
+#define ENET_TGSR_TF3(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_TGSR_TF3_SHIFT)) & ENET_TGSR_TF3_MASK)
+/*! @} */
+
+/*! @name TCSR */
+/*! @{ */
+#define ENET_TCSR_TDRE_MASK                             (0x1U)
+#define ENET_TCSR_TDRE_SHIFT                            (0U)
+#define ENET_TCSR_TDRE(x)                               (((uint32_t)(((uint32_t)(x)) << ENET_TCSR_TDRE_SHIFT)) & ENET_TCSR_TDRE_MASK)
+#define ENET_TCSR_TMODE_MASK                            (0x3CU)
+#define ENET_TCSR_TMODE_SHIFT                           (2U)
+#define ENET_TCSR_TMODE(x)                              (((uint32_t)(((uint32_t)(x)) << ENET_TCSR_TMODE_SHIFT)) & ENET_TCSR_TMODE_MASK)
+#define ENET_TCSR_TIE_MASK                              (0x40U)
+#define ENET_TCSR_TIE_SHIFT                             (6U)
+#define ENET_TCSR_TIE(x)                                (((uint32_t)(((uint32_t)(x)) << ENET_TCSR_TIE_SHIFT)) & ENET_TCSR_TIE_MASK)
+#define ENET_TCSR_TF_MASK                               (0x80U)
+#define ENET_TCSR_TF_SHIFT                              (7U)
+#define ENET_TCSR_TF(x)                                 (((uint32_t)(((uint32_t)(x)) << ENET_TCSR_TF_SHIFT)) & ENET_TCSR_TF_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group ENET_Register_Masks */
+
+/* ENET - Peripheral instance base addresses */
+/** Peripheral CONNECTIVITY__ENET0 base address */
+#define CONNECTIVITY__ENET0_BASE                        (0x5B040000u)
+/** Peripheral CONNECTIVITY__ENET0 base pointer */
+#define CONNECTIVITY__ENET0                             ((ENET_Type *)CONNECTIVITY__ENET0_BASE)
+/** Peripheral CONNECTIVITY__ENET1 base address */
+#define CONNECTIVITY__ENET1_BASE                        (0x5B050000u)
+/** Peripheral CONNECTIVITY__ENET1 base pointer */
+#define CONNECTIVITY__ENET1                             ((ENET_Type *)CONNECTIVITY__ENET1_BASE)
+/** Array initializer of ENET peripheral base addresses */
+#define ENET_BASE_ADDRS                          { CONNECTIVITY__ENET0_BASE, CONNECTIVITY__ENET1_BASE }
+/** Array initializer of ENET peripheral base pointers */
+#define ENET_BASE_PTRS                           { CONNECTIVITY__ENET0, CONNECTIVITY__ENET1 }
+/** Interrupt vectors for the ENET peripheral type */
+#define ENET_Transmit_IRQS                       { CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQn, CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQn }
+#define ENET_Receive_IRQS                        { CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQn, CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQn }
+#define ENET_Error_IRQS                          { CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQn, CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQn }
+#define ENET_1588_Timer_IRQS                     { CONNECTIVITY_ENET0_TIMER_INT_IRQn, CONNECTIVITY_ENET1_TIMER_INT_IRQn }
+/* ENET Buffer Descriptor and Buffer Address Alignment. */
+#define ENET_BUFF_ALIGNMENT                      (64U)
+
+/*!
+ * @}
+ */ /* end of group ENET_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- CAN Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup CAN_Peripheral_Access_Layer CAN Peripheral Access Layer
+ * @{
+ */
+
+/** CAN - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t MCR;                               /**< Module Configuration register, offset: 0x0 */
+  __IO uint32_t CTRL1;                             /**< Control 1 register, offset: 0x4 */
+  __IO uint32_t TIMER;                             /**< Free Running Timer, offset: 0x8 */
+       uint8_t RESERVED_0[4];
+  __IO uint32_t RXMGMASK;                          /**< Rx Mailboxes Global Mask register, offset: 0x10 */
+  __IO uint32_t RX14MASK;                          /**< Rx 14 Mask register, offset: 0x14 */
+  __IO uint32_t RX15MASK;                          /**< Rx 15 Mask register, offset: 0x18 */
+  __IO uint32_t ECR;                               /**< Error Counter, offset: 0x1C */
+  __IO uint32_t ESR1;                              /**< Error and Status 1 register, offset: 0x20 */
+  __IO uint32_t IMASK2;                            /**< Interrupt Masks 2 register, offset: 0x24 */
+  __IO uint32_t IMASK1;                            /**< Interrupt Masks 1 register, offset: 0x28 */
+  __IO uint32_t IFLAG2;                            /**< Interrupt Flags 2 register, offset: 0x2C */
+  __IO uint32_t IFLAG1;                            /**< Interrupt Flags 1 register, offset: 0x30 */
+  __IO uint32_t CTRL2;                             /**< Control 2 register, offset: 0x34 */
+  __I  uint32_t ESR2;                              /**< Error and Status 2 register, offset: 0x38 */
+       uint8_t RESERVED_1[8];
+  __I  uint32_t CRCR;                              /**< CRC Register, offset: 0x44 */
+  __IO uint32_t RXFGMASK;                          /**< Rx FIFO Global Mask register, offset: 0x48 */
+  __I  uint32_t RXFIR;                             /**< Rx FIFO Information Register, offset: 0x4C */
+  __IO uint32_t CBT;                               /**< CAN Bit Timing Register, offset: 0x50 */
+       uint8_t RESERVED_2[4];
+  __I  uint32_t DBG1;                              /**< Debug 1 register, offset: 0x58 */
+  __I  uint32_t DBG2;                              /**< Debug 2 register, offset: 0x5C */
+       uint8_t RESERVED_3[32];
+  struct {                                         /* offset: 0x80, array step: 0x10 */
+    __IO uint32_t CS;                                /**< Message Buffer 0 CS Register..Message Buffer 63 CS Register, array offset: 0x80, array step: 0x10 */
+    __IO uint32_t ID;                                /**< Message Buffer 0 ID Register..Message Buffer 63 ID Register, array offset: 0x84, array step: 0x10 */
+    __IO uint32_t WORD0;                             /**< Message Buffer 0 WORD0 Register..Message Buffer 63 WORD0 Register, array offset: 0x88, array step: 0x10 */
+    __IO uint32_t WORD1;                             /**< Message Buffer 0 WORD1 Register..Message Buffer 63 WORD1 Register, array offset: 0x8C, array step: 0x10 */
+  } MB[64];
+       uint8_t RESERVED_4[1024];
+  __IO uint32_t RXIMR[64];                         /**< Rx Individual Mask Registers, array offset: 0x880, array step: 0x4 */
+       uint8_t RESERVED_5[352];
+  __IO uint32_t MECR;                              /**< Memory Error Control Register, offset: 0xAE0 */
+  __IO uint32_t ERRIAR;                            /**< Error Injection Address Register, offset: 0xAE4 */
+  __IO uint32_t ERRIDPR;                           /**< Error Injection Data Pattern Register, offset: 0xAE8 */
+  __IO uint32_t ERRIPPR;                           /**< Error Injection Parity Pattern Register, offset: 0xAEC */
+  __I  uint32_t RERRAR;                            /**< Error Report Address Register, offset: 0xAF0 */
+  __I  uint32_t RERRDR;                            /**< Error Report Data Register, offset: 0xAF4 */
+  __I  uint32_t RERRSYNR;                          /**< Error Report Syndrome Register, offset: 0xAF8 */
+  __IO uint32_t ERRSR;                             /**< Error Status Register, offset: 0xAFC */
+       uint8_t RESERVED_6[256];
+  __IO uint32_t FDCTRL;                            /**< CAN FD Control Register, offset: 0xC00 */
+  __IO uint32_t FDCBT;                             /**< CAN FD Bit Timing Register, offset: 0xC04 */
+  __I  uint32_t FDCRC;                             /**< CAN FD CRC Register, offset: 0xC08 */
+} CAN_Type;
+
+/* ----------------------------------------------------------------------------
+   -- CAN Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup CAN_Register_Masks CAN Register Masks
+ * @{
+ */
+
+/*! @name MCR */
+/*! @{ */
+#define CAN_MCR_MAXMB_MASK                              (0x7FU)
+#define CAN_MCR_MAXMB_SHIFT                             (0U)
+#define CAN_MCR_MAXMB(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_MCR_MAXMB_SHIFT)) & CAN_MCR_MAXMB_MASK)
+#define CAN_MCR_IDAM_MASK                               (0x300U)
+#define CAN_MCR_IDAM_SHIFT                              (8U)
+#define CAN_MCR_IDAM(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_IDAM_SHIFT)) & CAN_MCR_IDAM_MASK)
+#define CAN_MCR_FDEN_MASK                               (0x800U)
+#define CAN_MCR_FDEN_SHIFT                              (11U)
+#define CAN_MCR_FDEN(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_FDEN_SHIFT)) & CAN_MCR_FDEN_MASK)
+#define CAN_MCR_AEN_MASK                                (0x1000U)
+#define CAN_MCR_AEN_SHIFT                               (12U)
+#define CAN_MCR_AEN(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_MCR_AEN_SHIFT)) & CAN_MCR_AEN_MASK)
+#define CAN_MCR_LPRIOEN_MASK                            (0x2000U)
+#define CAN_MCR_LPRIOEN_SHIFT                           (13U)
+#define CAN_MCR_LPRIOEN(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_MCR_LPRIOEN_SHIFT)) & CAN_MCR_LPRIOEN_MASK)
+#define CAN_MCR_PNET_EN_MASK                            (0x4000U)
+#define CAN_MCR_PNET_EN_SHIFT                           (14U)
+#define CAN_MCR_PNET_EN(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_MCR_PNET_EN_SHIFT)) & CAN_MCR_PNET_EN_MASK)
+#define CAN_MCR_DMA_MASK                                (0x8000U)
+#define CAN_MCR_DMA_SHIFT                               (15U)
+#define CAN_MCR_DMA(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_MCR_DMA_SHIFT)) & CAN_MCR_DMA_MASK)
+#define CAN_MCR_IRMQ_MASK                               (0x10000U)
+#define CAN_MCR_IRMQ_SHIFT                              (16U)
+#define CAN_MCR_IRMQ(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_IRMQ_SHIFT)) & CAN_MCR_IRMQ_MASK)
+#define CAN_MCR_SRXDIS_MASK                             (0x20000U)
+#define CAN_MCR_SRXDIS_SHIFT                            (17U)
+#define CAN_MCR_SRXDIS(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_SRXDIS_SHIFT)) & CAN_MCR_SRXDIS_MASK)
+#define CAN_MCR_DOZE_MASK                               (0x40000U)
+#define CAN_MCR_DOZE_SHIFT                              (18U)
+#define CAN_MCR_DOZE(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_DOZE_SHIFT)) & CAN_MCR_DOZE_MASK)
+#define CAN_MCR_WAKSRC_MASK                             (0x80000U)
+#define CAN_MCR_WAKSRC_SHIFT                            (19U)
+#define CAN_MCR_WAKSRC(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_WAKSRC_SHIFT)) & CAN_MCR_WAKSRC_MASK)
+#define CAN_MCR_LPMACK_MASK                             (0x100000U)
+#define CAN_MCR_LPMACK_SHIFT                            (20U)
+#define CAN_MCR_LPMACK(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_LPMACK_SHIFT)) & CAN_MCR_LPMACK_MASK)
+#define CAN_MCR_WRNEN_MASK                              (0x200000U)
+#define CAN_MCR_WRNEN_SHIFT                             (21U)
+#define CAN_MCR_WRNEN(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_MCR_WRNEN_SHIFT)) & CAN_MCR_WRNEN_MASK)
+#define CAN_MCR_SLFWAK_MASK                             (0x400000U)
+#define CAN_MCR_SLFWAK_SHIFT                            (22U)
+#define CAN_MCR_SLFWAK(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_SLFWAK_SHIFT)) & CAN_MCR_SLFWAK_MASK)
+#define CAN_MCR_SUPV_MASK                               (0x800000U)
+#define CAN_MCR_SUPV_SHIFT                              (23U)
+#define CAN_MCR_SUPV(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_SUPV_SHIFT)) & CAN_MCR_SUPV_MASK)
+#define CAN_MCR_FRZACK_MASK                             (0x1000000U)
+#define CAN_MCR_FRZACK_SHIFT                            (24U)
+#define CAN_MCR_FRZACK(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_FRZACK_SHIFT)) & CAN_MCR_FRZACK_MASK)
+#define CAN_MCR_SOFTRST_MASK                            (0x2000000U)
+#define CAN_MCR_SOFTRST_SHIFT                           (25U)
+#define CAN_MCR_SOFTRST(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_MCR_SOFTRST_SHIFT)) & CAN_MCR_SOFTRST_MASK)
+#define CAN_MCR_WAKMSK_MASK                             (0x4000000U)
+#define CAN_MCR_WAKMSK_SHIFT                            (26U)
+#define CAN_MCR_WAKMSK(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_WAKMSK_SHIFT)) & CAN_MCR_WAKMSK_MASK)
+#define CAN_MCR_NOTRDY_MASK                             (0x8000000U)
+#define CAN_MCR_NOTRDY_SHIFT                            (27U)
+#define CAN_MCR_NOTRDY(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_MCR_NOTRDY_SHIFT)) & CAN_MCR_NOTRDY_MASK)
+#define CAN_MCR_HALT_MASK                               (0x10000000U)
+#define CAN_MCR_HALT_SHIFT                              (28U)
+#define CAN_MCR_HALT(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_HALT_SHIFT)) & CAN_MCR_HALT_MASK)
+#define CAN_MCR_RFEN_MASK                               (0x20000000U)
+#define CAN_MCR_RFEN_SHIFT                              (29U)
+#define CAN_MCR_RFEN(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_RFEN_SHIFT)) & CAN_MCR_RFEN_MASK)
+#define CAN_MCR_FRZ_MASK                                (0x40000000U)
+#define CAN_MCR_FRZ_SHIFT                               (30U)
+#define CAN_MCR_FRZ(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_MCR_FRZ_SHIFT)) & CAN_MCR_FRZ_MASK)
+#define CAN_MCR_MDIS_MASK                               (0x80000000U)
+#define CAN_MCR_MDIS_SHIFT                              (31U)
+#define CAN_MCR_MDIS(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_MCR_MDIS_SHIFT)) & CAN_MCR_MDIS_MASK)
+/*! @} */
+
+/*! @name CTRL1 */
+/*! @{ */
+#define CAN_CTRL1_PROPSEG_MASK                          (0x7U)
+#define CAN_CTRL1_PROPSEG_SHIFT                         (0U)
+#define CAN_CTRL1_PROPSEG(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_PROPSEG_SHIFT)) & CAN_CTRL1_PROPSEG_MASK)
+#define CAN_CTRL1_LOM_MASK                              (0x8U)
+#define CAN_CTRL1_LOM_SHIFT                             (3U)
+#define CAN_CTRL1_LOM(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_LOM_SHIFT)) & CAN_CTRL1_LOM_MASK)
+#define CAN_CTRL1_LBUF_MASK                             (0x10U)
+#define CAN_CTRL1_LBUF_SHIFT                            (4U)
+#define CAN_CTRL1_LBUF(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_LBUF_SHIFT)) & CAN_CTRL1_LBUF_MASK)
+#define CAN_CTRL1_TSYN_MASK                             (0x20U)
+#define CAN_CTRL1_TSYN_SHIFT                            (5U)
+#define CAN_CTRL1_TSYN(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_TSYN_SHIFT)) & CAN_CTRL1_TSYN_MASK)
+#define CAN_CTRL1_BOFFREC_MASK                          (0x40U)
+#define CAN_CTRL1_BOFFREC_SHIFT                         (6U)
+#define CAN_CTRL1_BOFFREC(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_BOFFREC_SHIFT)) & CAN_CTRL1_BOFFREC_MASK)
+#define CAN_CTRL1_SMP_MASK                              (0x80U)
+#define CAN_CTRL1_SMP_SHIFT                             (7U)
+#define CAN_CTRL1_SMP(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_SMP_SHIFT)) & CAN_CTRL1_SMP_MASK)
+#define CAN_CTRL1_RWRNMSK_MASK                          (0x400U)
+#define CAN_CTRL1_RWRNMSK_SHIFT                         (10U)
+#define CAN_CTRL1_RWRNMSK(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_RWRNMSK_SHIFT)) & CAN_CTRL1_RWRNMSK_MASK)
+#define CAN_CTRL1_TWRNMSK_MASK                          (0x800U)
+#define CAN_CTRL1_TWRNMSK_SHIFT                         (11U)
+#define CAN_CTRL1_TWRNMSK(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_TWRNMSK_SHIFT)) & CAN_CTRL1_TWRNMSK_MASK)
+#define CAN_CTRL1_LPB_MASK                              (0x1000U)
+#define CAN_CTRL1_LPB_SHIFT                             (12U)
+#define CAN_CTRL1_LPB(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_LPB_SHIFT)) & CAN_CTRL1_LPB_MASK)
+#define CAN_CTRL1_CLKSRC_MASK                           (0x2000U)
+#define CAN_CTRL1_CLKSRC_SHIFT                          (13U)
+#define CAN_CTRL1_CLKSRC(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_CLKSRC_SHIFT)) & CAN_CTRL1_CLKSRC_MASK)
+#define CAN_CTRL1_ERRMSK_MASK                           (0x4000U)
+#define CAN_CTRL1_ERRMSK_SHIFT                          (14U)
+#define CAN_CTRL1_ERRMSK(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_ERRMSK_SHIFT)) & CAN_CTRL1_ERRMSK_MASK)
+#define CAN_CTRL1_BOFFMSK_MASK                          (0x8000U)
+#define CAN_CTRL1_BOFFMSK_SHIFT                         (15U)
+#define CAN_CTRL1_BOFFMSK(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_BOFFMSK_SHIFT)) & CAN_CTRL1_BOFFMSK_MASK)
+#define CAN_CTRL1_PSEG2_MASK                            (0x70000U)
+#define CAN_CTRL1_PSEG2_SHIFT                           (16U)
+#define CAN_CTRL1_PSEG2(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_PSEG2_SHIFT)) & CAN_CTRL1_PSEG2_MASK)
+#define CAN_CTRL1_PSEG1_MASK                            (0x380000U)
+#define CAN_CTRL1_PSEG1_SHIFT                           (19U)
+#define CAN_CTRL1_PSEG1(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_PSEG1_SHIFT)) & CAN_CTRL1_PSEG1_MASK)
+#define CAN_CTRL1_RJW_MASK                              (0xC00000U)
+#define CAN_CTRL1_RJW_SHIFT                             (22U)
+#define CAN_CTRL1_RJW(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_RJW_SHIFT)) & CAN_CTRL1_RJW_MASK)
+#define CAN_CTRL1_PRESDIV_MASK                          (0xFF000000U)
+#define CAN_CTRL1_PRESDIV_SHIFT                         (24U)
+#define CAN_CTRL1_PRESDIV(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL1_PRESDIV_SHIFT)) & CAN_CTRL1_PRESDIV_MASK)
+/*! @} */
+
+/*! @name TIMER */
+/*! @{ */
+#define CAN_TIMER_TIMER_MASK                            (0xFFFFU)
+#define CAN_TIMER_TIMER_SHIFT                           (0U)
+#define CAN_TIMER_TIMER(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_TIMER_TIMER_SHIFT)) & CAN_TIMER_TIMER_MASK)
+/*! @} */
+
+/*! @name ECR */
+/*! @{ */
+#define CAN_ECR_TXERRCNT_MASK                           (0xFFU)
+#define CAN_ECR_TXERRCNT_SHIFT                          (0U)
+#define CAN_ECR_TXERRCNT(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ECR_TXERRCNT_SHIFT)) & CAN_ECR_TXERRCNT_MASK)
+#define CAN_ECR_RXERRCNT_MASK                           (0xFF00U)
+#define CAN_ECR_RXERRCNT_SHIFT                          (8U)
+#define CAN_ECR_RXERRCNT(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ECR_RXERRCNT_SHIFT)) & CAN_ECR_RXERRCNT_MASK)
+#define CAN_ECR_TXERRCNT_FAST_MASK                      (0xFF0000U)
+#define CAN_ECR_TXERRCNT_FAST_SHIFT                     (16U)
+#define CAN_ECR_TXERRCNT_FAST(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_ECR_TXERRCNT_FAST_SHIFT)) & CAN_ECR_TXERRCNT_FAST_MASK)
+#define CAN_ECR_RXERRCNT_FAST_MASK                      (0xFF000000U)
+#define CAN_ECR_RXERRCNT_FAST_SHIFT                     (24U)
+#define CAN_ECR_RXERRCNT_FAST(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_ECR_RXERRCNT_FAST_SHIFT)) & CAN_ECR_RXERRCNT_FAST_MASK)
+/*! @} */
+
+/*! @name ESR1 */
+/*! @{ */
+#define CAN_ESR1_WAKINT_MASK                            (0x1U)
+#define CAN_ESR1_WAKINT_SHIFT                           (0U)
+#define CAN_ESR1_WAKINT(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_WAKINT_SHIFT)) & CAN_ESR1_WAKINT_MASK)
+#define CAN_ESR1_ERRINT_MASK                            (0x2U)
+#define CAN_ESR1_ERRINT_SHIFT                           (1U)
+#define CAN_ESR1_ERRINT(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_ERRINT_SHIFT)) & CAN_ESR1_ERRINT_MASK)
+#define CAN_ESR1_BOFFINT_MASK                           (0x4U)
+#define CAN_ESR1_BOFFINT_SHIFT                          (2U)
+#define CAN_ESR1_BOFFINT(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_BOFFINT_SHIFT)) & CAN_ESR1_BOFFINT_MASK)
+#define CAN_ESR1_RX_MASK                                (0x8U)
+#define CAN_ESR1_RX_SHIFT                               (3U)
+#define CAN_ESR1_RX(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_RX_SHIFT)) & CAN_ESR1_RX_MASK)
+#define CAN_ESR1_FLTCONF_MASK                           (0x30U)
+#define CAN_ESR1_FLTCONF_SHIFT                          (4U)
+#define CAN_ESR1_FLTCONF(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_FLTCONF_SHIFT)) & CAN_ESR1_FLTCONF_MASK)
+#define CAN_ESR1_TX_MASK                                (0x40U)
+#define CAN_ESR1_TX_SHIFT                               (6U)
+#define CAN_ESR1_TX(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_TX_SHIFT)) & CAN_ESR1_TX_MASK)
+#define CAN_ESR1_IDLE_MASK                              (0x80U)
+#define CAN_ESR1_IDLE_SHIFT                             (7U)
+#define CAN_ESR1_IDLE(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_IDLE_SHIFT)) & CAN_ESR1_IDLE_MASK)
+#define CAN_ESR1_RXWRN_MASK                             (0x100U)
+#define CAN_ESR1_RXWRN_SHIFT                            (8U)
+#define CAN_ESR1_RXWRN(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_RXWRN_SHIFT)) & CAN_ESR1_RXWRN_MASK)
+#define CAN_ESR1_TXWRN_MASK                             (0x200U)
+#define CAN_ESR1_TXWRN_SHIFT                            (9U)
+#define CAN_ESR1_TXWRN(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_TXWRN_SHIFT)) & CAN_ESR1_TXWRN_MASK)
+#define CAN_ESR1_STFERR_MASK                            (0x400U)
+#define CAN_ESR1_STFERR_SHIFT                           (10U)
+#define CAN_ESR1_STFERR(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_STFERR_SHIFT)) & CAN_ESR1_STFERR_MASK)
+#define CAN_ESR1_FRMERR_MASK                            (0x800U)
+#define CAN_ESR1_FRMERR_SHIFT                           (11U)
+#define CAN_ESR1_FRMERR(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_FRMERR_SHIFT)) & CAN_ESR1_FRMERR_MASK)
+#define CAN_ESR1_CRCERR_MASK                            (0x1000U)
+#define CAN_ESR1_CRCERR_SHIFT                           (12U)
+#define CAN_ESR1_CRCERR(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_CRCERR_SHIFT)) & CAN_ESR1_CRCERR_MASK)
+#define CAN_ESR1_ACKERR_MASK                            (0x2000U)
+#define CAN_ESR1_ACKERR_SHIFT                           (13U)
+#define CAN_ESR1_ACKERR(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_ACKERR_SHIFT)) & CAN_ESR1_ACKERR_MASK)
+#define CAN_ESR1_BIT0ERR_MASK                           (0x4000U)
+#define CAN_ESR1_BIT0ERR_SHIFT                          (14U)
+#define CAN_ESR1_BIT0ERR(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_BIT0ERR_SHIFT)) & CAN_ESR1_BIT0ERR_MASK)
+#define CAN_ESR1_BIT1ERR_MASK                           (0x8000U)
+#define CAN_ESR1_BIT1ERR_SHIFT                          (15U)
+#define CAN_ESR1_BIT1ERR(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_BIT1ERR_SHIFT)) & CAN_ESR1_BIT1ERR_MASK)
+#define CAN_ESR1_RWRNINT_MASK                           (0x10000U)
+#define CAN_ESR1_RWRNINT_SHIFT                          (16U)
+#define CAN_ESR1_RWRNINT(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_RWRNINT_SHIFT)) & CAN_ESR1_RWRNINT_MASK)
+#define CAN_ESR1_TWRNINT_MASK                           (0x20000U)
+#define CAN_ESR1_TWRNINT_SHIFT                          (17U)
+#define CAN_ESR1_TWRNINT(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_TWRNINT_SHIFT)) & CAN_ESR1_TWRNINT_MASK)
+#define CAN_ESR1_SYNCH_MASK                             (0x40000U)
+#define CAN_ESR1_SYNCH_SHIFT                            (18U)
+#define CAN_ESR1_SYNCH(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_SYNCH_SHIFT)) & CAN_ESR1_SYNCH_MASK)
+#define CAN_ESR1_BOFFDONEINT_MASK                       (0x80000U)
+#define CAN_ESR1_BOFFDONEINT_SHIFT                      (19U)
+#define CAN_ESR1_BOFFDONEINT(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_BOFFDONEINT_SHIFT)) & CAN_ESR1_BOFFDONEINT_MASK)
+#define CAN_ESR1_ERRINT_FAST_MASK                       (0x100000U)
+#define CAN_ESR1_ERRINT_FAST_SHIFT                      (20U)
+#define CAN_ESR1_ERRINT_FAST(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_ERRINT_FAST_SHIFT)) & CAN_ESR1_ERRINT_FAST_MASK)
+#define CAN_ESR1_ERROVR_MASK                            (0x200000U)
+#define CAN_ESR1_ERROVR_SHIFT                           (21U)
+#define CAN_ESR1_ERROVR(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_ERROVR_SHIFT)) & CAN_ESR1_ERROVR_MASK)
+#define CAN_ESR1_STFERR_FAST_MASK                       (0x4000000U)
+#define CAN_ESR1_STFERR_FAST_SHIFT                      (26U)
+#define CAN_ESR1_STFERR_FAST(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_STFERR_FAST_SHIFT)) & CAN_ESR1_STFERR_FAST_MASK)
+#define CAN_ESR1_FRMERR_FAST_MASK                       (0x8000000U)
+#define CAN_ESR1_FRMERR_FAST_SHIFT                      (27U)
+#define CAN_ESR1_FRMERR_FAST(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_FRMERR_FAST_SHIFT)) & CAN_ESR1_FRMERR_FAST_MASK)
+#define CAN_ESR1_CRCERR_FAST_MASK                       (0x10000000U)
+#define CAN_ESR1_CRCERR_FAST_SHIFT                      (28U)
+#define CAN_ESR1_CRCERR_FAST(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_CRCERR_FAST_SHIFT)) & CAN_ESR1_CRCERR_FAST_MASK)
+#define CAN_ESR1_BIT0ERR_FAST_MASK                      (0x40000000U)
+#define CAN_ESR1_BIT0ERR_FAST_SHIFT                     (30U)
+#define CAN_ESR1_BIT0ERR_FAST(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_BIT0ERR_FAST_SHIFT)) & CAN_ESR1_BIT0ERR_FAST_MASK)
+#define CAN_ESR1_BIT1ERR_FAST_MASK                      (0x80000000U)
+#define CAN_ESR1_BIT1ERR_FAST_SHIFT                     (31U)
+#define CAN_ESR1_BIT1ERR_FAST(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_ESR1_BIT1ERR_FAST_SHIFT)) & CAN_ESR1_BIT1ERR_FAST_MASK)
+/*! @} */
+
+/*! @name IFLAG1 */
+/*! @{ */
+#define CAN_IFLAG1_BUF0I_MASK                           (0x1U)
+#define CAN_IFLAG1_BUF0I_SHIFT                          (0U)
+#define CAN_IFLAG1_BUF0I(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_IFLAG1_BUF0I_SHIFT)) & CAN_IFLAG1_BUF0I_MASK)
+#define CAN_IFLAG1_BUF4TO1I_MASK                        (0x1EU)
+#define CAN_IFLAG1_BUF4TO1I_SHIFT                       (1U)
+#define CAN_IFLAG1_BUF4TO1I(x)                          (((uint32_t)(((uint32_t)(x)) << CAN_IFLAG1_BUF4TO1I_SHIFT)) & CAN_IFLAG1_BUF4TO1I_MASK)
+#define CAN_IFLAG1_BUF5I_MASK                           (0x20U)
+#define CAN_IFLAG1_BUF5I_SHIFT                          (5U)
+#define CAN_IFLAG1_BUF5I(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_IFLAG1_BUF5I_SHIFT)) & CAN_IFLAG1_BUF5I_MASK)
+#define CAN_IFLAG1_BUF6I_MASK                           (0x40U)
+#define CAN_IFLAG1_BUF6I_SHIFT                          (6U)
+#define CAN_IFLAG1_BUF6I(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_IFLAG1_BUF6I_SHIFT)) & CAN_IFLAG1_BUF6I_MASK)
+#define CAN_IFLAG1_BUF7I_MASK                           (0x80U)
+#define CAN_IFLAG1_BUF7I_SHIFT                          (7U)
+#define CAN_IFLAG1_BUF7I(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_IFLAG1_BUF7I_SHIFT)) & CAN_IFLAG1_BUF7I_MASK)
+#define CAN_IFLAG1_BUF31TO8I_MASK                       (0xFFFFFF00U)
+#define CAN_IFLAG1_BUF31TO8I_SHIFT                      (8U)
+#define CAN_IFLAG1_BUF31TO8I(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_IFLAG1_BUF31TO8I_SHIFT)) & CAN_IFLAG1_BUF31TO8I_MASK)
+/*! @} */
+
+/*! @name CTRL2 */
+/*! @{ */
+#define CAN_CTRL2_EDFLTDIS_MASK                         (0x800U)
+#define CAN_CTRL2_EDFLTDIS_SHIFT                        (11U)
+#define CAN_CTRL2_EDFLTDIS(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_EDFLTDIS_SHIFT)) & CAN_CTRL2_EDFLTDIS_MASK)
+#define CAN_CTRL2_ISOCANFDEN_MASK                       (0x1000U)
+#define CAN_CTRL2_ISOCANFDEN_SHIFT                      (12U)
+#define CAN_CTRL2_ISOCANFDEN(x)                         (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_ISOCANFDEN_SHIFT)) & CAN_CTRL2_ISOCANFDEN_MASK)
+#define CAN_CTRL2_PREXCEN_MASK                          (0x4000U)
+#define CAN_CTRL2_PREXCEN_SHIFT                         (14U)
+#define CAN_CTRL2_PREXCEN(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_PREXCEN_SHIFT)) & CAN_CTRL2_PREXCEN_MASK)
+#define CAN_CTRL2_TIMER_SRC_MASK                        (0x8000U)
+#define CAN_CTRL2_TIMER_SRC_SHIFT                       (15U)
+#define CAN_CTRL2_TIMER_SRC(x)                          (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_TIMER_SRC_SHIFT)) & CAN_CTRL2_TIMER_SRC_MASK)
+#define CAN_CTRL2_EACEN_MASK                            (0x10000U)
+#define CAN_CTRL2_EACEN_SHIFT                           (16U)
+#define CAN_CTRL2_EACEN(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_EACEN_SHIFT)) & CAN_CTRL2_EACEN_MASK)
+#define CAN_CTRL2_RRS_MASK                              (0x20000U)
+#define CAN_CTRL2_RRS_SHIFT                             (17U)
+#define CAN_CTRL2_RRS(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_RRS_SHIFT)) & CAN_CTRL2_RRS_MASK)
+#define CAN_CTRL2_MRP_MASK                              (0x40000U)
+#define CAN_CTRL2_MRP_SHIFT                             (18U)
+#define CAN_CTRL2_MRP(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_MRP_SHIFT)) & CAN_CTRL2_MRP_MASK)
+#define CAN_CTRL2_TASD_MASK                             (0xF80000U)
+#define CAN_CTRL2_TASD_SHIFT                            (19U)
+#define CAN_CTRL2_TASD(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_TASD_SHIFT)) & CAN_CTRL2_TASD_MASK)
+#define CAN_CTRL2_RFFN_MASK                             (0xF000000U)
+#define CAN_CTRL2_RFFN_SHIFT                            (24U)
+#define CAN_CTRL2_RFFN(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_RFFN_SHIFT)) & CAN_CTRL2_RFFN_MASK)
+#define CAN_CTRL2_WRMFRZ_MASK                           (0x10000000U)
+#define CAN_CTRL2_WRMFRZ_SHIFT                          (28U)
+#define CAN_CTRL2_WRMFRZ(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_WRMFRZ_SHIFT)) & CAN_CTRL2_WRMFRZ_MASK)
+#define CAN_CTRL2_ECRWRE_MASK                           (0x20000000U)
+#define CAN_CTRL2_ECRWRE_SHIFT                          (29U)
+#define CAN_CTRL2_ECRWRE(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_ECRWRE_SHIFT)) & CAN_CTRL2_ECRWRE_MASK)
+#define CAN_CTRL2_BOFFDONEMSK_MASK                      (0x40000000U)
+#define CAN_CTRL2_BOFFDONEMSK_SHIFT                     (30U)
+#define CAN_CTRL2_BOFFDONEMSK(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_BOFFDONEMSK_SHIFT)) & CAN_CTRL2_BOFFDONEMSK_MASK)
+#define CAN_CTRL2_ERRMSK_FAST_MASK                      (0x80000000U)
+#define CAN_CTRL2_ERRMSK_FAST_SHIFT                     (31U)
+#define CAN_CTRL2_ERRMSK_FAST(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_CTRL2_ERRMSK_FAST_SHIFT)) & CAN_CTRL2_ERRMSK_FAST_MASK)
+/*! @} */
+
+/*! @name RXFIR */
+/*! @{ */
+#define CAN_RXFIR_IDHIT_MASK                            (0x1FFU)
+#define CAN_RXFIR_IDHIT_SHIFT                           (0U)
+#define CAN_RXFIR_IDHIT(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_RXFIR_IDHIT_SHIFT)) & CAN_RXFIR_IDHIT_MASK)
+/*! @} */
+
+/*! @name CBT */
+/*! @{ */
+#define CAN_CBT_EPSEG2_MASK                             (0x1FU)
+#define CAN_CBT_EPSEG2_SHIFT                            (0U)
+#define CAN_CBT_EPSEG2(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_CBT_EPSEG2_SHIFT)) & CAN_CBT_EPSEG2_MASK)
+#define CAN_CBT_EPSEG1_MASK                             (0x3E0U)
+#define CAN_CBT_EPSEG1_SHIFT                            (5U)
+#define CAN_CBT_EPSEG1(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_CBT_EPSEG1_SHIFT)) & CAN_CBT_EPSEG1_MASK)
+#define CAN_CBT_EPROPSEG_MASK                           (0xFC00U)
+#define CAN_CBT_EPROPSEG_SHIFT                          (10U)
+#define CAN_CBT_EPROPSEG(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_CBT_EPROPSEG_SHIFT)) & CAN_CBT_EPROPSEG_MASK)
+#define CAN_CBT_ERJW_MASK                               (0x1F0000U)
+#define CAN_CBT_ERJW_SHIFT                              (16U)
+#define CAN_CBT_ERJW(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_CBT_ERJW_SHIFT)) & CAN_CBT_ERJW_MASK)
+#define CAN_CBT_EPRESDIV_MASK                           (0x7FE00000U)
+#define CAN_CBT_EPRESDIV_SHIFT                          (21U)
+#define CAN_CBT_EPRESDIV(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_CBT_EPRESDIV_SHIFT)) & CAN_CBT_EPRESDIV_MASK)
+#define CAN_CBT_BTF_MASK                                (0x80000000U)
+#define CAN_CBT_BTF_SHIFT                               (31U)
+#define CAN_CBT_BTF(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_CBT_BTF_SHIFT)) & CAN_CBT_BTF_MASK)
+/*! @} */
+
+/*! @name DBG1 */
+/*! @{ */
+#define CAN_DBG1_CFSM_MASK                              (0x7FU)
+#define CAN_DBG1_CFSM_SHIFT                             (0U)
+#define CAN_DBG1_CFSM(x)                                (((uint32_t)(((uint32_t)(x)) << CAN_DBG1_CFSM_SHIFT)) & CAN_DBG1_CFSM_MASK)
+#define CAN_DBG1_CBN_MASK                               (0x1F000000U)
+#define CAN_DBG1_CBN_SHIFT                              (24U)
+#define CAN_DBG1_CBN(x)                                 (((uint32_t)(((uint32_t)(x)) << CAN_DBG1_CBN_SHIFT)) & CAN_DBG1_CBN_MASK)
+/*! @} */
+
+/*! @name CS */
+/*! @{ */
+#define CAN_CS_TIME_STAMP_MASK                          (0xFFFFU)
+#define CAN_CS_TIME_STAMP_SHIFT                         (0U)
+#define CAN_CS_TIME_STAMP(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_CS_TIME_STAMP_SHIFT)) & CAN_CS_TIME_STAMP_MASK)
+#define CAN_CS_DLC_MASK                                 (0xF0000U)
+#define CAN_CS_DLC_SHIFT                                (16U)
+#define CAN_CS_DLC(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_DLC_SHIFT)) & CAN_CS_DLC_MASK)
+#define CAN_CS_RTR_MASK                                 (0x100000U)
+#define CAN_CS_RTR_SHIFT                                (20U)
+#define CAN_CS_RTR(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_RTR_SHIFT)) & CAN_CS_RTR_MASK)
+#define CAN_CS_IDE_MASK                                 (0x200000U)
+#define CAN_CS_IDE_SHIFT                                (21U)
+#define CAN_CS_IDE(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_IDE_SHIFT)) & CAN_CS_IDE_MASK)
+#define CAN_CS_SRR_MASK                                 (0x400000U)
+#define CAN_CS_SRR_SHIFT                                (22U)
+#define CAN_CS_SRR(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_SRR_SHIFT)) & CAN_CS_SRR_MASK)
+#define CAN_CS_CODE_MASK                                (0xF000000U)
+#define CAN_CS_CODE_SHIFT                               (24U)
+#define CAN_CS_CODE(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_CS_CODE_SHIFT)) & CAN_CS_CODE_MASK)
+#define CAN_CS_ESI_MASK                                 (0x20000000U)
+#define CAN_CS_ESI_SHIFT                                (29U)
+#define CAN_CS_ESI(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_ESI_SHIFT)) & CAN_CS_ESI_MASK)
+#define CAN_CS_BRS_MASK                                 (0x40000000U)
+#define CAN_CS_BRS_SHIFT                                (30U)
+#define CAN_CS_BRS(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_BRS_SHIFT)) & CAN_CS_BRS_MASK)
+#define CAN_CS_EDL_MASK                                 (0x80000000U)
+#define CAN_CS_EDL_SHIFT                                (31U)
+#define CAN_CS_EDL(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_CS_EDL_SHIFT)) & CAN_CS_EDL_MASK)
+/*! @} */
+
+/*! @name ID */
+/*! @{ */
+#define CAN_ID_EXT_MASK                                 (0x3FFFFU)
+#define CAN_ID_EXT_SHIFT                                (0U)
+#define CAN_ID_EXT(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_ID_EXT_SHIFT)) & CAN_ID_EXT_MASK)
+#define CAN_ID_STD_MASK                                 (0x1FFC0000U)
+#define CAN_ID_STD_SHIFT                                (18U)
+#define CAN_ID_STD(x)                                   (((uint32_t)(((uint32_t)(x)) << CAN_ID_STD_SHIFT)) & CAN_ID_STD_MASK)
+#define CAN_ID_PRIO_MASK                                (0xE0000000U)
+#define CAN_ID_PRIO_SHIFT                               (29U)
+#define CAN_ID_PRIO(x)                                  (((uint32_t)(((uint32_t)(x)) << CAN_ID_PRIO_SHIFT)) & CAN_ID_PRIO_MASK)
+/*! @} */
+
+/*! @name WORD0 */
+/*! @{ */
+#define CAN_WORD0_DATA_BYTE_3_MASK                      (0xFFU)
+#define CAN_WORD0_DATA_BYTE_3_SHIFT                     (0U)
+#define CAN_WORD0_DATA_BYTE_3(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD0_DATA_BYTE_3_SHIFT)) & CAN_WORD0_DATA_BYTE_3_MASK)
+#define CAN_WORD0_DATA_BYTE_2_MASK                      (0xFF00U)
+#define CAN_WORD0_DATA_BYTE_2_SHIFT                     (8U)
+#define CAN_WORD0_DATA_BYTE_2(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD0_DATA_BYTE_2_SHIFT)) & CAN_WORD0_DATA_BYTE_2_MASK)
+#define CAN_WORD0_DATA_BYTE_1_MASK                      (0xFF0000U)
+#define CAN_WORD0_DATA_BYTE_1_SHIFT                     (16U)
+#define CAN_WORD0_DATA_BYTE_1(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD0_DATA_BYTE_1_SHIFT)) & CAN_WORD0_DATA_BYTE_1_MASK)
+#define CAN_WORD0_DATA_BYTE_0_MASK                      (0xFF000000U)
+#define CAN_WORD0_DATA_BYTE_0_SHIFT                     (24U)
+#define CAN_WORD0_DATA_BYTE_0(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD0_DATA_BYTE_0_SHIFT)) & CAN_WORD0_DATA_BYTE_0_MASK)
+/*! @} */
+
+/*! @name WORD1 */
+/*! @{ */
+#define CAN_WORD1_DATA_BYTE_7_MASK                      (0xFFU)
+#define CAN_WORD1_DATA_BYTE_7_SHIFT                     (0U)
+#define CAN_WORD1_DATA_BYTE_7(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD1_DATA_BYTE_7_SHIFT)) & CAN_WORD1_DATA_BYTE_7_MASK)
+#define CAN_WORD1_DATA_BYTE_6_MASK                      (0xFF00U)
+#define CAN_WORD1_DATA_BYTE_6_SHIFT                     (8U)
+#define CAN_WORD1_DATA_BYTE_6(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD1_DATA_BYTE_6_SHIFT)) & CAN_WORD1_DATA_BYTE_6_MASK)
+#define CAN_WORD1_DATA_BYTE_5_MASK                      (0xFF0000U)
+#define CAN_WORD1_DATA_BYTE_5_SHIFT                     (16U)
+#define CAN_WORD1_DATA_BYTE_5(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD1_DATA_BYTE_5_SHIFT)) & CAN_WORD1_DATA_BYTE_5_MASK)
+#define CAN_WORD1_DATA_BYTE_4_MASK                      (0xFF000000U)
+#define CAN_WORD1_DATA_BYTE_4_SHIFT                     (24U)
+#define CAN_WORD1_DATA_BYTE_4(x)                        (((uint32_t)(((uint32_t)(x)) << CAN_WORD1_DATA_BYTE_4_SHIFT)) & CAN_WORD1_DATA_BYTE_4_MASK)
+/*! @} */
+
+/*! @name MECR */
+/*! @{ */
+#define CAN_MECR_NCEFAFRZ_MASK                          (0x80U)
+#define CAN_MECR_NCEFAFRZ_SHIFT                         (7U)
+#define CAN_MECR_NCEFAFRZ(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_MECR_NCEFAFRZ_SHIFT)) & CAN_MECR_NCEFAFRZ_MASK)
+#define CAN_MECR_ECCDIS_MASK                            (0x100U)
+#define CAN_MECR_ECCDIS_SHIFT                           (8U)
+#define CAN_MECR_ECCDIS(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_MECR_ECCDIS_SHIFT)) & CAN_MECR_ECCDIS_MASK)
+#define CAN_MECR_RERRDIS_MASK                           (0x200U)
+#define CAN_MECR_RERRDIS_SHIFT                          (9U)
+#define CAN_MECR_RERRDIS(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_MECR_RERRDIS_SHIFT)) & CAN_MECR_RERRDIS_MASK)
+#define CAN_MECR_EXTERRIE_MASK                          (0x2000U)
+#define CAN_MECR_EXTERRIE_SHIFT                         (13U)
+#define CAN_MECR_EXTERRIE(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_MECR_EXTERRIE_SHIFT)) & CAN_MECR_EXTERRIE_MASK)
+#define CAN_MECR_FAERRIE_MASK                           (0x4000U)
+#define CAN_MECR_FAERRIE_SHIFT                          (14U)
+#define CAN_MECR_FAERRIE(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_MECR_FAERRIE_SHIFT)) & CAN_MECR_FAERRIE_MASK)
+#define CAN_MECR_HAERRIE_MASK                           (0x8000U)
+#define CAN_MECR_HAERRIE_SHIFT                          (15U)
+#define CAN_MECR_HAERRIE(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_MECR_HAERRIE_SHIFT)) & CAN_MECR_HAERRIE_MASK)
+#define CAN_MECR_CEI_MSK_MASK                           (0x10000U)
+#define CAN_MECR_CEI_MSK_SHIFT                          (16U)
+#define CAN_MECR_CEI_MSK(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_MECR_CEI_MSK_SHIFT)) & CAN_MECR_CEI_MSK_MASK)
+#define CAN_MECR_FANCEI_MSK_MASK                        (0x40000U)
+#define CAN_MECR_FANCEI_MSK_SHIFT                       (18U)
+#define CAN_MECR_FANCEI_MSK(x)                          (((uint32_t)(((uint32_t)(x)) << CAN_MECR_FANCEI_MSK_SHIFT)) & CAN_MECR_FANCEI_MSK_MASK)
+#define CAN_MECR_HANCEI_MSK_MASK                        (0x80000U)
+#define CAN_MECR_HANCEI_MSK_SHIFT                       (19U)
+#define CAN_MECR_HANCEI_MSK(x)                          (((uint32_t)(((uint32_t)(x)) << CAN_MECR_HANCEI_MSK_SHIFT)) & CAN_MECR_HANCEI_MSK_MASK)
+#define CAN_MECR_ECRWRDIS_MASK                          (0x80000000U)
+#define CAN_MECR_ECRWRDIS_SHIFT                         (31U)
+#define CAN_MECR_ECRWRDIS(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_MECR_ECRWRDIS_SHIFT)) & CAN_MECR_ECRWRDIS_MASK)
+/*! @} */
+
+/*! @name RERRAR */
+/*! @{ */
+#define CAN_RERRAR_ERRADDR_MASK                         (0x3FFFU)
+#define CAN_RERRAR_ERRADDR_SHIFT                        (0U)
+#define CAN_RERRAR_ERRADDR(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_RERRAR_ERRADDR_SHIFT)) & CAN_RERRAR_ERRADDR_MASK)
+#define CAN_RERRAR_SAID_MASK                            (0x70000U)
+#define CAN_RERRAR_SAID_SHIFT                           (16U)
+#define CAN_RERRAR_SAID(x)                              (((uint32_t)(((uint32_t)(x)) << CAN_RERRAR_SAID_SHIFT)) & CAN_RERRAR_SAID_MASK)
+#define CAN_RERRAR_NCE_MASK                             (0x1000000U)
+#define CAN_RERRAR_NCE_SHIFT                            (24U)
+#define CAN_RERRAR_NCE(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_RERRAR_NCE_SHIFT)) & CAN_RERRAR_NCE_MASK)
+/*! @} */
+
+/*! @name RERRSYNR */
+/*! @{ */
+#define CAN_RERRSYNR_SYND0_MASK                         (0x1FU)
+#define CAN_RERRSYNR_SYND0_SHIFT                        (0U)
+#define CAN_RERRSYNR_SYND0(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_SYND0_SHIFT)) & CAN_RERRSYNR_SYND0_MASK)
+#define CAN_RERRSYNR_BE0_MASK                           (0x80U)
+#define CAN_RERRSYNR_BE0_SHIFT                          (7U)
+#define CAN_RERRSYNR_BE0(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_BE0_SHIFT)) & CAN_RERRSYNR_BE0_MASK)
+#define CAN_RERRSYNR_SYND1_MASK                         (0x1F00U)
+#define CAN_RERRSYNR_SYND1_SHIFT                        (8U)
+#define CAN_RERRSYNR_SYND1(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_SYND1_SHIFT)) & CAN_RERRSYNR_SYND1_MASK)
+#define CAN_RERRSYNR_BE1_MASK                           (0x8000U)
+#define CAN_RERRSYNR_BE1_SHIFT                          (15U)
+#define CAN_RERRSYNR_BE1(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_BE1_SHIFT)) & CAN_RERRSYNR_BE1_MASK)
+#define CAN_RERRSYNR_SYND2_MASK                         (0x1F0000U)
+#define CAN_RERRSYNR_SYND2_SHIFT                        (16U)
+#define CAN_RERRSYNR_SYND2(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_SYND2_SHIFT)) & CAN_RERRSYNR_SYND2_MASK)
+#define CAN_RERRSYNR_BE2_MASK                           (0x800000U)
+#define CAN_RERRSYNR_BE2_SHIFT                          (23U)
+#define CAN_RERRSYNR_BE2(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_BE2_SHIFT)) & CAN_RERRSYNR_BE2_MASK)
+#define CAN_RERRSYNR_SYND3_MASK                         (0x1F000000U)
+#define CAN_RERRSYNR_SYND3_SHIFT                        (24U)
+#define CAN_RERRSYNR_SYND3(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_SYND3_SHIFT)) & CAN_RERRSYNR_SYND3_MASK)
+#define CAN_RERRSYNR_BE3_MASK                           (0x80000000U)
+#define CAN_RERRSYNR_BE3_SHIFT                          (31U)
+#define CAN_RERRSYNR_BE3(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_RERRSYNR_BE3_SHIFT)) & CAN_RERRSYNR_BE3_MASK)
+/*! @} */
+
+/*! @name FDCTRL */
+/*! @{ */
+#define CAN_FDCTRL_TDCVAL_MASK                          (0x3FU)
+#define CAN_FDCTRL_TDCVAL_SHIFT                         (0U)
+#define CAN_FDCTRL_TDCVAL(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_TDCVAL_SHIFT)) & CAN_FDCTRL_TDCVAL_MASK)
+#define CAN_FDCTRL_TDCOFF_MASK                          (0x1F00U)
+#define CAN_FDCTRL_TDCOFF_SHIFT                         (8U)
+#define CAN_FDCTRL_TDCOFF(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_TDCOFF_SHIFT)) & CAN_FDCTRL_TDCOFF_MASK)
+#define CAN_FDCTRL_TDCFAIL_MASK                         (0x4000U)
+#define CAN_FDCTRL_TDCFAIL_SHIFT                        (14U)
+#define CAN_FDCTRL_TDCFAIL(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_TDCFAIL_SHIFT)) & CAN_FDCTRL_TDCFAIL_MASK)
+#define CAN_FDCTRL_TDCEN_MASK                           (0x8000U)
+#define CAN_FDCTRL_TDCEN_SHIFT                          (15U)
+#define CAN_FDCTRL_TDCEN(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_TDCEN_SHIFT)) & CAN_FDCTRL_TDCEN_MASK)
+#define CAN_FDCTRL_MBDSR0_MASK                          (0x30000U)
+#define CAN_FDCTRL_MBDSR0_SHIFT                         (16U)
+#define CAN_FDCTRL_MBDSR0(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_MBDSR0_SHIFT)) & CAN_FDCTRL_MBDSR0_MASK)
+#define CAN_FDCTRL_MBDSR1_MASK                          (0x180000U)
+#define CAN_FDCTRL_MBDSR1_SHIFT                         (19U)
+#define CAN_FDCTRL_MBDSR1(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_MBDSR1_SHIFT)) & CAN_FDCTRL_MBDSR1_MASK)
+#define CAN_FDCTRL_MBDSR2_MASK                          (0xC00000U)
+#define CAN_FDCTRL_MBDSR2_SHIFT                         (22U)
+#define CAN_FDCTRL_MBDSR2(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_MBDSR2_SHIFT)) & CAN_FDCTRL_MBDSR2_MASK)
+#define CAN_FDCTRL_MBDSR3_MASK                          (0x6000000U)
+#define CAN_FDCTRL_MBDSR3_SHIFT                         (25U)
+#define CAN_FDCTRL_MBDSR3(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_MBDSR3_SHIFT)) & CAN_FDCTRL_MBDSR3_MASK)
+#define CAN_FDCTRL_FDRATE_MASK                          (0x80000000U)
+#define CAN_FDCTRL_FDRATE_SHIFT                         (31U)
+#define CAN_FDCTRL_FDRATE(x)                            (((uint32_t)(((uint32_t)(x)) << CAN_FDCTRL_FDRATE_SHIFT)) & CAN_FDCTRL_FDRATE_MASK)
+/*! @} */
+
+/*! @name FDCBT */
+/*! @{ */
+#define CAN_FDCBT_FPSEG2_MASK                           (0x7U)
+#define CAN_FDCBT_FPSEG2_SHIFT                          (0U)
+#define CAN_FDCBT_FPSEG2(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_FDCBT_FPSEG2_SHIFT)) & CAN_FDCBT_FPSEG2_MASK)
+#define CAN_FDCBT_FPSEG1_MASK                           (0xE0U)
+#define CAN_FDCBT_FPSEG1_SHIFT                          (5U)
+#define CAN_FDCBT_FPSEG1(x)                             (((uint32_t)(((uint32_t)(x)) << CAN_FDCBT_FPSEG1_SHIFT)) & CAN_FDCBT_FPSEG1_MASK)
+#define CAN_FDCBT_FPROPSEG_MASK                         (0x7C00U)
+#define CAN_FDCBT_FPROPSEG_SHIFT                        (10U)
+#define CAN_FDCBT_FPROPSEG(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_FDCBT_FPROPSEG_SHIFT)) & CAN_FDCBT_FPROPSEG_MASK)
+#define CAN_FDCBT_FRJW_MASK                             (0x70000U)
+#define CAN_FDCBT_FRJW_SHIFT                            (16U)
+#define CAN_FDCBT_FRJW(x)                               (((uint32_t)(((uint32_t)(x)) << CAN_FDCBT_FRJW_SHIFT)) & CAN_FDCBT_FRJW_MASK)
+#define CAN_FDCBT_FPRESDIV_MASK                         (0x3FF00000U)
+#define CAN_FDCBT_FPRESDIV_SHIFT                        (20U)
+#define CAN_FDCBT_FPRESDIV(x)                           (((uint32_t)(((uint32_t)(x)) << CAN_FDCBT_FPRESDIV_SHIFT)) & CAN_FDCBT_FPRESDIV_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group CAN_Register_Masks */
+
+/* CAN - Peripheral instance base addresses */
+/** Peripheral DMA__CAN0 base address */
+#define DMA__CAN0_BASE                                  (0x5A8D0000u)
+/** Peripheral DMA__CAN0 base pointer */
+#define DMA__CAN0                                       ((CAN_Type *)DMA__CAN0_BASE)
+/** Peripheral DMA__CAN1 base address */
+#define DMA__CAN1_BASE                                  (0x5A8E0000u)
+/** Peripheral DMA__CAN1 base pointer */
+#define DMA__CAN1                                       ((CAN_Type *)DMA__CAN1_BASE)
+/** Peripheral DMA__CAN2 base address */
+#define DMA__CAN2_BASE                                  (0x5A8F0000u)
+/** Peripheral DMA__CAN2 base pointer */
+#define DMA__CAN2                                       ((CAN_Type *)DMA__CAN2_BASE)
+/* The count of CAN_CS, CAN_ID, CAN_WORD0 and CAN_WORD1 */
+#define CAN_CS_COUNT                             (64U)
+#define CAN_ID_COUNT                             (64U)
+#define CAN_WORD0_COUNT                          (64U)
+#define CAN_WORD1_COUNT                          (64U)
+/* The count of CAN_RXIMR */
+#define CAN_RXIMR_COUNT                          (64U)
+/** Array initializer of CAN peripheral base addresses */
+#define CAN_BASE_ADDRS                           { DMA__CAN0_BASE, DMA__CAN1_BASE, DMA__CAN2_BASE }
+/** Array initializer of CAN peripheral base pointers */
+#define CAN_BASE_PTRS                            { DMA__CAN0, DMA__CAN1, DMA__CAN2 }
+/** Interrupt vectors for the CAN peripheral type */
+#define CAN_Rx_Warning_IRQS                      { DMA_FLEXCAN0_INT_IRQn, DMA_FLEXCAN1_INT_IRQn, DMA_FLEXCAN2_INT_IRQn }
+#define CAN_Tx_Warning_IRQS                      { DMA_FLEXCAN0_INT_IRQn, DMA_FLEXCAN1_INT_IRQn, DMA_FLEXCAN2_INT_IRQn }
+#define CAN_Wake_Up_IRQS                         { DMA_FLEXCAN0_INT_IRQn, DMA_FLEXCAN1_INT_IRQn, DMA_FLEXCAN2_INT_IRQn }
+#define CAN_Error_IRQS                           { DMA_FLEXCAN0_INT_IRQn, DMA_FLEXCAN1_INT_IRQn, DMA_FLEXCAN2_INT_IRQn }
+#define CAN_Bus_Off_IRQS                         { DMA_FLEXCAN0_INT_IRQn, DMA_FLEXCAN1_INT_IRQn, DMA_FLEXCAN2_INT_IRQn }
+#define CAN_ORed_Message_buffer_IRQS             { DMA_FLEXCAN0_INT_IRQn, DMA_FLEXCAN1_INT_IRQn, DMA_FLEXCAN2_INT_IRQn }
+
+/*!
+ * @}
+ */ /* end of group CAN_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- LMEM Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LMEM_Peripheral_Access_Layer LMEM Peripheral Access Layer
+ * @{
+ */
+
+/** LMEM - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t PCCCR;                             /**< Cache control register, offset: 0x0 */
+  __IO uint32_t PCCLCR;                            /**< Cache line control register, offset: 0x4 */
+  __IO uint32_t PCCSAR;                            /**< Cache search address register, offset: 0x8 */
+  __IO uint32_t PCCCVR;                            /**< Cache read/write value register, offset: 0xC */
+       uint8_t RESERVED_0[16];
+  __IO uint32_t PCCRMR;                            /**< Cache regions mode register, offset: 0x20 */
+       uint8_t RESERVED_1[2012];
+  __IO uint32_t PSCCR;                             /**< Cache control register, offset: 0x800 */
+  __IO uint32_t PSCLCR;                            /**< Cache line control register, offset: 0x804 */
+  __IO uint32_t PSCSAR;                            /**< Cache search address register, offset: 0x808 */
+  __IO uint32_t PSCCVR;                            /**< Cache read/write value register, offset: 0x80C */
+       uint8_t RESERVED_2[16];
+  __IO uint32_t PSCRMR;                            /**< Cache regions mode register, offset: 0x820 */
+} LMEM_Type;
+
+/* ----------------------------------------------------------------------------
+   -- LMEM Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LMEM_Register_Masks LMEM Register Masks
+ * @{
+ */
+
+/*! @name PCCCR */
+/*! @{ */
+#define LMEM_PCCCR_ENCACHE_MASK                         (0x1U)
+#define LMEM_PCCCR_ENCACHE_SHIFT                        (0U)
+#define LMEM_PCCCR_ENCACHE(x)                           (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_ENCACHE_SHIFT)) & LMEM_PCCCR_ENCACHE_MASK)
+#define LMEM_PCCCR_ENWRBUF_MASK                         (0x2U)
+#define LMEM_PCCCR_ENWRBUF_SHIFT                        (1U)
+#define LMEM_PCCCR_ENWRBUF(x)                           (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_ENWRBUF_SHIFT)) & LMEM_PCCCR_ENWRBUF_MASK)
+#define LMEM_PCCCR_PCCR2_MASK                           (0x4U)
+#define LMEM_PCCCR_PCCR2_SHIFT                          (2U)
+#define LMEM_PCCCR_PCCR2(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_PCCR2_SHIFT)) & LMEM_PCCCR_PCCR2_MASK)
+#define LMEM_PCCCR_PCCR3_MASK                           (0x8U)
+#define LMEM_PCCCR_PCCR3_SHIFT                          (3U)
+#define LMEM_PCCCR_PCCR3(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_PCCR3_SHIFT)) & LMEM_PCCCR_PCCR3_MASK)
+#define LMEM_PCCCR_INVW0_MASK                           (0x1000000U)
+#define LMEM_PCCCR_INVW0_SHIFT                          (24U)
+#define LMEM_PCCCR_INVW0(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_INVW0_SHIFT)) & LMEM_PCCCR_INVW0_MASK)
+#define LMEM_PCCCR_PUSHW0_MASK                          (0x2000000U)
+#define LMEM_PCCCR_PUSHW0_SHIFT                         (25U)
+#define LMEM_PCCCR_PUSHW0(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_PUSHW0_SHIFT)) & LMEM_PCCCR_PUSHW0_MASK)
+#define LMEM_PCCCR_INVW1_MASK                           (0x4000000U)
+#define LMEM_PCCCR_INVW1_SHIFT                          (26U)
+#define LMEM_PCCCR_INVW1(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_INVW1_SHIFT)) & LMEM_PCCCR_INVW1_MASK)
+#define LMEM_PCCCR_PUSHW1_MASK                          (0x8000000U)
+#define LMEM_PCCCR_PUSHW1_SHIFT                         (27U)
+#define LMEM_PCCCR_PUSHW1(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_PUSHW1_SHIFT)) & LMEM_PCCCR_PUSHW1_MASK)
+#define LMEM_PCCCR_GO_MASK                              (0x80000000U)
+#define LMEM_PCCCR_GO_SHIFT                             (31U)
+#define LMEM_PCCCR_GO(x)                                (((uint32_t)(((uint32_t)(x)) << LMEM_PCCCR_GO_SHIFT)) & LMEM_PCCCR_GO_MASK)
+/*! @} */
+
+/*! @name PCCLCR */
+/*! @{ */
+#define LMEM_PCCLCR_LGO_MASK                            (0x1U)
+#define LMEM_PCCLCR_LGO_SHIFT                           (0U)
+#define LMEM_PCCLCR_LGO(x)                              (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LGO_SHIFT)) & LMEM_PCCLCR_LGO_MASK)
+#define LMEM_PCCLCR_CACHEADDR_MASK                      (0x3FFCU)
+#define LMEM_PCCLCR_CACHEADDR_SHIFT                     (2U)
+#define LMEM_PCCLCR_CACHEADDR(x)                        (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_CACHEADDR_SHIFT)) & LMEM_PCCLCR_CACHEADDR_MASK)
+#define LMEM_PCCLCR_WSEL_MASK                           (0x4000U)
+#define LMEM_PCCLCR_WSEL_SHIFT                          (14U)
+#define LMEM_PCCLCR_WSEL(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_WSEL_SHIFT)) & LMEM_PCCLCR_WSEL_MASK)
+#define LMEM_PCCLCR_TDSEL_MASK                          (0x10000U)
+#define LMEM_PCCLCR_TDSEL_SHIFT                         (16U)
+#define LMEM_PCCLCR_TDSEL(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_TDSEL_SHIFT)) & LMEM_PCCLCR_TDSEL_MASK)
+#define LMEM_PCCLCR_LCIVB_MASK                          (0x100000U)
+#define LMEM_PCCLCR_LCIVB_SHIFT                         (20U)
+#define LMEM_PCCLCR_LCIVB(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LCIVB_SHIFT)) & LMEM_PCCLCR_LCIVB_MASK)
+#define LMEM_PCCLCR_LCIMB_MASK                          (0x200000U)
+#define LMEM_PCCLCR_LCIMB_SHIFT                         (21U)
+#define LMEM_PCCLCR_LCIMB(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LCIMB_SHIFT)) & LMEM_PCCLCR_LCIMB_MASK)
+#define LMEM_PCCLCR_LCWAY_MASK                          (0x400000U)
+#define LMEM_PCCLCR_LCWAY_SHIFT                         (22U)
+#define LMEM_PCCLCR_LCWAY(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LCWAY_SHIFT)) & LMEM_PCCLCR_LCWAY_MASK)
+#define LMEM_PCCLCR_LCMD_MASK                           (0x3000000U)
+#define LMEM_PCCLCR_LCMD_SHIFT                          (24U)
+#define LMEM_PCCLCR_LCMD(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LCMD_SHIFT)) & LMEM_PCCLCR_LCMD_MASK)
+#define LMEM_PCCLCR_LADSEL_MASK                         (0x4000000U)
+#define LMEM_PCCLCR_LADSEL_SHIFT                        (26U)
+#define LMEM_PCCLCR_LADSEL(x)                           (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LADSEL_SHIFT)) & LMEM_PCCLCR_LADSEL_MASK)
+#define LMEM_PCCLCR_LACC_MASK                           (0x8000000U)
+#define LMEM_PCCLCR_LACC_SHIFT                          (27U)
+#define LMEM_PCCLCR_LACC(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PCCLCR_LACC_SHIFT)) & LMEM_PCCLCR_LACC_MASK)
+/*! @} */
+
+/*! @name PCCSAR */
+/*! @{ */
+#define LMEM_PCCSAR_LGO_MASK                            (0x1U)
+#define LMEM_PCCSAR_LGO_SHIFT                           (0U)
+#define LMEM_PCCSAR_LGO(x)                              (((uint32_t)(((uint32_t)(x)) << LMEM_PCCSAR_LGO_SHIFT)) & LMEM_PCCSAR_LGO_MASK)
+#define LMEM_PCCSAR_PHYADDR_MASK                        (0xFFFFFFFCU)
+#define LMEM_PCCSAR_PHYADDR_SHIFT                       (2U)
+#define LMEM_PCCSAR_PHYADDR(x)                          (((uint32_t)(((uint32_t)(x)) << LMEM_PCCSAR_PHYADDR_SHIFT)) & LMEM_PCCSAR_PHYADDR_MASK)
+/*! @} */
+
+/*! @name PSCCR */
+/*! @{ */
+#define LMEM_PSCCR_ENCACHE_MASK                         (0x1U)
+#define LMEM_PSCCR_ENCACHE_SHIFT                        (0U)
+#define LMEM_PSCCR_ENCACHE(x)                           (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_ENCACHE_SHIFT)) & LMEM_PSCCR_ENCACHE_MASK)
+#define LMEM_PSCCR_ENWRBUF_MASK                         (0x2U)
+#define LMEM_PSCCR_ENWRBUF_SHIFT                        (1U)
+#define LMEM_PSCCR_ENWRBUF(x)                           (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_ENWRBUF_SHIFT)) & LMEM_PSCCR_ENWRBUF_MASK)
+#define LMEM_PSCCR_PCCR2_MASK                           (0x4U)
+#define LMEM_PSCCR_PCCR2_SHIFT                          (2U)
+#define LMEM_PSCCR_PCCR2(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_PCCR2_SHIFT)) & LMEM_PSCCR_PCCR2_MASK)
+#define LMEM_PSCCR_PCCR3_MASK                           (0x8U)
+#define LMEM_PSCCR_PCCR3_SHIFT                          (3U)
+#define LMEM_PSCCR_PCCR3(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_PCCR3_SHIFT)) & LMEM_PSCCR_PCCR3_MASK)
+#define LMEM_PSCCR_INVW0_MASK                           (0x1000000U)
+#define LMEM_PSCCR_INVW0_SHIFT                          (24U)
+#define LMEM_PSCCR_INVW0(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_INVW0_SHIFT)) & LMEM_PSCCR_INVW0_MASK)
+#define LMEM_PSCCR_PUSHW0_MASK                          (0x2000000U)
+#define LMEM_PSCCR_PUSHW0_SHIFT                         (25U)
+#define LMEM_PSCCR_PUSHW0(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_PUSHW0_SHIFT)) & LMEM_PSCCR_PUSHW0_MASK)
+#define LMEM_PSCCR_INVW1_MASK                           (0x4000000U)
+#define LMEM_PSCCR_INVW1_SHIFT                          (26U)
+#define LMEM_PSCCR_INVW1(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_INVW1_SHIFT)) & LMEM_PSCCR_INVW1_MASK)
+#define LMEM_PSCCR_PUSHW1_MASK                          (0x8000000U)
+#define LMEM_PSCCR_PUSHW1_SHIFT                         (27U)
+#define LMEM_PSCCR_PUSHW1(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_PUSHW1_SHIFT)) & LMEM_PSCCR_PUSHW1_MASK)
+#define LMEM_PSCCR_GO_MASK                              (0x80000000U)
+#define LMEM_PSCCR_GO_SHIFT                             (31U)
+#define LMEM_PSCCR_GO(x)                                (((uint32_t)(((uint32_t)(x)) << LMEM_PSCCR_GO_SHIFT)) & LMEM_PSCCR_GO_MASK)
+/*! @} */
+
+/*! @name PSCLCR */
+/*! @{ */
+#define LMEM_PSCLCR_LGO_MASK                            (0x1U)
+#define LMEM_PSCLCR_LGO_SHIFT                           (0U)
+#define LMEM_PSCLCR_LGO(x)                              (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LGO_SHIFT)) & LMEM_PSCLCR_LGO_MASK)
+#define LMEM_PSCLCR_CACHEADDR_MASK                      (0x3FFCU)
+#define LMEM_PSCLCR_CACHEADDR_SHIFT                     (2U)
+#define LMEM_PSCLCR_CACHEADDR(x)                        (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_CACHEADDR_SHIFT)) & LMEM_PSCLCR_CACHEADDR_MASK)
+#define LMEM_PSCLCR_WSEL_MASK                           (0x4000U)
+#define LMEM_PSCLCR_WSEL_SHIFT                          (14U)
+#define LMEM_PSCLCR_WSEL(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_WSEL_SHIFT)) & LMEM_PSCLCR_WSEL_MASK)
+#define LMEM_PSCLCR_TDSEL_MASK                          (0x10000U)
+#define LMEM_PSCLCR_TDSEL_SHIFT                         (16U)
+#define LMEM_PSCLCR_TDSEL(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_TDSEL_SHIFT)) & LMEM_PSCLCR_TDSEL_MASK)
+#define LMEM_PSCLCR_LCIVB_MASK                          (0x100000U)
+#define LMEM_PSCLCR_LCIVB_SHIFT                         (20U)
+#define LMEM_PSCLCR_LCIVB(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LCIVB_SHIFT)) & LMEM_PSCLCR_LCIVB_MASK)
+#define LMEM_PSCLCR_LCIMB_MASK                          (0x200000U)
+#define LMEM_PSCLCR_LCIMB_SHIFT                         (21U)
+#define LMEM_PSCLCR_LCIMB(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LCIMB_SHIFT)) & LMEM_PSCLCR_LCIMB_MASK)
+#define LMEM_PSCLCR_LCWAY_MASK                          (0x400000U)
+#define LMEM_PSCLCR_LCWAY_SHIFT                         (22U)
+#define LMEM_PSCLCR_LCWAY(x)                            (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LCWAY_SHIFT)) & LMEM_PSCLCR_LCWAY_MASK)
+#define LMEM_PSCLCR_LCMD_MASK                           (0x3000000U)
+#define LMEM_PSCLCR_LCMD_SHIFT                          (24U)
+#define LMEM_PSCLCR_LCMD(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LCMD_SHIFT)) & LMEM_PSCLCR_LCMD_MASK)
+#define LMEM_PSCLCR_LADSEL_MASK                         (0x4000000U)
+#define LMEM_PSCLCR_LADSEL_SHIFT                        (26U)
+#define LMEM_PSCLCR_LADSEL(x)                           (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LADSEL_SHIFT)) & LMEM_PSCLCR_LADSEL_MASK)
+#define LMEM_PSCLCR_LACC_MASK                           (0x8000000U)
+#define LMEM_PSCLCR_LACC_SHIFT                          (27U)
+#define LMEM_PSCLCR_LACC(x)                             (((uint32_t)(((uint32_t)(x)) << LMEM_PSCLCR_LACC_SHIFT)) & LMEM_PSCLCR_LACC_MASK)
+/*! @} */
+
+/*! @name PSCSAR */
+/*! @{ */
+#define LMEM_PSCSAR_LGO_MASK                            (0x1U)
+#define LMEM_PSCSAR_LGO_SHIFT                           (0U)
+#define LMEM_PSCSAR_LGO(x)                              (((uint32_t)(((uint32_t)(x)) << LMEM_PSCSAR_LGO_SHIFT)) & LMEM_PSCSAR_LGO_MASK)
+#define LMEM_PSCSAR_PHYADDR_MASK                        (0xFFFFFFFCU)
+#define LMEM_PSCSAR_PHYADDR_SHIFT                       (2U)
+#define LMEM_PSCSAR_PHYADDR(x)                          (((uint32_t)(((uint32_t)(x)) << LMEM_PSCSAR_PHYADDR_SHIFT)) & LMEM_PSCSAR_PHYADDR_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group LMEM_Register_Masks */
+
+/* LMEM - Peripheral instance base addresses */
+/** Peripheral LMEM base address */
+#define LMEM_BASE                                       (0xE0082000u)
+/** Peripheral LMEM base pointer */
+#define LMEM                                            ((LMEM_Type *)LMEM_BASE)
+/** Array initializer of LMEM peripheral base addresses */
+#define LMEM_BASE_ADDRS                          { LMEM_BASE }
+/** Array initializer of LMEM peripheral base pointers */
+#define LMEM_BASE_PTRS                           { LMEM }
+
+/*!
+ * @}
+ */ /* end of group LMEM_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- LPCG Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LPCG_Peripheral_Access_Layer LPCG Peripheral Access Layer
+ * @{
+ */
+
+/* LPCG - Peripheral instance base addresses, used by the clock names of fsl_clock.h */
+#define AUDIO__LPCG_ESAI0_BASE                          (0x59410000u)
+#define AUDIO__LPCG_ESAI1_BASE                          (0x59810000u)
+#define AUDIO__LPCG_GPT0_BASE                           (0x59500000u)
+#define AUDIO__LPCG_GPT1_BASE                           (0x59510000u)
+#define AUDIO__LPCG_GPT2_BASE                           (0x59520000u)
+#define AUDIO__LPCG_GPT3_BASE                           (0x59530000u)
+#define AUDIO__LPCG_GPT4_BASE                           (0x59540000u)
+#define AUDIO__LPCG_GPT5_BASE                           (0x59550000u)
+#define AUDIO__LPCG_SAI0_BASE                           (0x59440000u)
+#define AUDIO__LPCG_SAI1_BASE                           (0x59450000u)
+#define AUDIO__LPCG_SAI2_BASE                           (0x59460000u)
+#define AUDIO__LPCG_SAI3_BASE                           (0x59470000u)
+#define AUDIO__LPCG_SAI_HDMIRX0_BASE                    (0x59480000u)
+#define AUDIO__LPCG_SAI_HDMITX0_BASE                    (0x59490000u)
+#define AUDIO__LPCG_SAI6_BASE                           (0x59820000u)
+#define AUDIO__LPCG_SAI7_BASE                           (0x59830000u)
+#define CM4_0__LPCG_TPM_BASE                            (0x41820000u)
+#define CM4_0__LPCG_LPIT_BASE                           (0x41830000u)
+#define CM4_0__LPCG_LPUART_BASE                         (0x41840000u)
+#define CM4_0__LPCG_LPI2C_BASE                          (0x41850000u)
+#define CM4_1__LPCG_TPM_BASE                            (0x45820000u)
+#define CM4_1__LPCG_LPIT_BASE                           (0x45830000u)
+#define CM4_1__LPCG_LPUART_BASE                         (0x45840000u)
+#define CM4_1__LPCG_LPI2C_BASE                          (0x45850000u)
+#define CONNECTIVITY__LPCG_ENET0_BASE                   (0x5B230000u)
+#define CONNECTIVITY__LPCG_ENET1_BASE                   (0x5B240000u)
+#define DC_0__LPCG_DSP0_CLK_BASE                        (0x56010000u)
+#define DC_1__LPCG_DSP0_CLK_BASE                        (0x57010000u)
+#define DI_HDMI__LPCG_CLK_BASE                          (0x56263000u)
+#define DI_LVDS_0__LPCG_CLK_BASE                        (0x56243000u)
+#define DI_LVDS_1__LPCG_CLK_BASE                        (0x57243000u)
+#define DI_MIPI_0__LPCG_CLK_BASE                        (0x56223000u)
+#define DI_MIPI_1__LPCG_CLK_BASE                        (0x57223000u)
+#define DMA__LPCG_LPSPI0_BASE                           (0x5A400000u)
+#define DMA__LPCG_LPSPI1_BASE                           (0x5A410000u)
+#define DMA__LPCG_LPSPI2_BASE                           (0x5A420000u)
+#define DMA__LPCG_LPSPI3_BASE                           (0x5A430000u)
+#define DMA__LPCG_LPUART0_BASE                          (0x5A460000u)
+#define DMA__LPCG_LPUART1_BASE                          (0x5A470000u)
+#define DMA__LPCG_LPUART2_BASE                          (0x5A480000u)
+#define DMA__LPCG_LPUART3_BASE                          (0x5A490000u)
+#define DMA__LPCG_LPUART4_BASE                          (0x5A4A0000u)
+#define DMA__LPCG_EMV_SIM0_BASE                         (0x5A4D0000u)
+#define DMA__LPCG_EMV_SIM1_BASE                         (0x5A4E0000u)
+#define DMA__LPCG_LPI2C0_BASE                           (0x5AC00000u)
+#define DMA__LPCG_LPI2C1_BASE                           (0x5AC10000u)
+#define DMA__LPCG_LPI2C2_BASE                           (0x5AC20000u)
+#define DMA__LPCG_LPI2C3_BASE                           (0x5AC30000u)
+#define DMA__LPCG_LPI2C4_BASE                           (0x5AC40000u)
+#define DMA__LPCG_ADC0_BASE                             (0x5AC80000u)
+#define DMA__LPCG_ADC1_BASE                             (0x5AC90000u)
+#define DMA__LPCG_FTM0_BASE                             (0x5ACA0000u)
+#define DMA__LPCG_FTM1_BASE                             (0x5ACB0000u)
+#define DMA__LPCG_CAN0_BASE                             (0x5ACD0000u)
+#define DMA__LPCG_CAN1_BASE                             (0x5ACE0000u)
+#define DMA__LPCG_CAN2_BASE                             (0x5ACF0000u)
+#define HSIO__LPCG_GPIO_BASE                            (0x5F100000u)
+#define LSIO__LPCG_GPIO0_BASE                           (0x5D480000u)
+#define LSIO__LPCG_GPIO1_BASE                           (0x5D490000u)
+#define LSIO__LPCG_GPIO2_BASE                           (0x5D4A0000u)
+#define LSIO__LPCG_GPIO3_BASE                           (0x5D4B0000u)
+#define LSIO__LPCG_GPIO4_BASE                           (0x5D4C0000u)
+#define LSIO__LPCG_GPIO5_BASE                           (0x5D4D0000u)
+#define LSIO__LPCG_GPIO6_BASE                           (0x5D4E0000u)
+#define LSIO__LPCG_GPIO7_BASE                           (0x5D4F0000u)
+#define LSIO__LPCG_GPT0_BASE                            (0x5D540000u)
+#define LSIO__LPCG_GPT1_BASE                            (0x5D550000u)
+#define LSIO__LPCG_GPT2_BASE                            (0x5D560000u)
+#define LSIO__LPCG_GPT3_BASE                            (0x5D570000u)
+#define LSIO__LPCG_GPT4_BASE                            (0x5D580000u)
+#define LSIO__LPCG_QSPI0_BASE                           (0x5D520000u)
+#define LSIO__LPCG_QSPI1_BASE                           (0x5D530000u)
+#define LSIO__LPCG_MU5_MCU_BASE                         (0x5D600000u)
+#define LSIO__LPCG_MU6_MCU_BASE                         (0x5D610000u)
+#define LSIO__LPCG_MU7_MCU_BASE                         (0x5D620000u)
+#define LSIO__LPCG_MU8_MCU_BASE                         (0x5D630000u)
+#define LSIO__LPCG_MU9_MCU_BASE                         (0x5D640000u)
+#define LSIO__LPCG_MU10_MCU_BASE                        (0x5D650000u)
+#define LSIO__LPCG_MU11_MCU_BASE                        (0x5D660000u)
+#define LSIO__LPCG_MU12_MCU_BASE                        (0x5D670000u)
+#define LSIO__LPCG_MU13_MCU_BASE                        (0x5D680000u)
+#define LSIO__LPCG_MU5_DSP_BASE                         (0x5D690000u)
+#define LSIO__LPCG_MU6_DSP_BASE                         (0x5D6A0000u)
+#define LSIO__LPCG_MU7_DSP_BASE                         (0x5D6B0000u)
+#define LSIO__LPCG_MU8_DSP_BASE                         (0x5D6C0000u)
+#define LSIO__LPCG_MU9_DSP_BASE                         (0x5D6D0000u)
+#define LSIO__LPCG_MU10_DSP_BASE                        (0x5D6E0000u)
+#define LSIO__LPCG_MU11_DSP_BASE                        (0x5D6F0000u)
+#define LSIO__LPCG_MU12_DSP_BASE                        (0x5D700000u)
+#define LSIO__LPCG_MU13_DSP_BASE                        (0x5D710000u)
+#define MIPI_CSI_0__LPCG_CLK_BASE                       (0x58223000u)
+#define MIPI_CSI_1__LPCG_CLK_BASE                       (0x58243000u)
+#define RX_HDMI__LPCG_GPIO_IPG_CLK_S_BASE               (0x58263000u)
+#define SCU__LPCG_TPM_BASE                              (0x33820000u)
+#define SCU__LPCG_LPIT_BASE                             (0x33830000u)
+#define SCU__LPCG_LPUART_BASE                           (0x33840000u)
+#define SCU__LPCG_LPI2C_BASE                            (0x33850000u)
+
+/*!
+ * @}
+ */ /* end of group LPCG_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- LPUART Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LPUART_Peripheral_Access_Layer LPUART Peripheral Access Layer
+ * @{
+ */
+
+/** LPUART - Register Layout Typedef */
+typedef struct {
+  __I  uint32_t VERID;                             /**< Version ID Register, offset: 0x0 */
+  __I  uint32_t PARAM;                             /**< Parameter Register, offset: 0x4 */
+  __IO uint32_t GLOBAL;                            /**< LPUART Global Register, offset: 0x8 */
+  __IO uint32_t PINCFG;                            /**< LPUART Pin Configuration Register, offset: 0xC */
+  __IO uint32_t BAUD;                              /**< LPUART Baud Rate Register, offset: 0x10 */
+  __IO uint32_t STAT;                              /**< LPUART Status Register, offset: 0x14 */
+  __IO uint32_t CTRL;                              /**< LPUART Control Register, offset: 0x18 */
+  __IO uint32_t DATA;                              /**< LPUART Data Register, offset: 0x1C */
+  __IO uint32_t MATCH;                             /**< LPUART Match Address Register, offset: 0x20 */
+  __IO uint32_t MODIR;                             /**< LPUART Modem IrDA Register, offset: 0x24 */
+  __IO uint32_t FIFO;                              /**< LPUART FIFO Register, offset: 0x28 */
+  __IO uint32_t WATER;                             /**< LPUART Watermark Register, offset: 0x2C */
+} LPUART_Type;
+
+/* ----------------------------------------------------------------------------
+   -- LPUART Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup LPUART_Register_Masks LPUART Register Masks
+ * @{
+ */
+
+/*! @name GLOBAL */
+/*! @{ */
+#define LPUART_GLOBAL_RST_MASK                          (0x2U)
+#define LPUART_GLOBAL_RST_SHIFT                         (1U)
+#define LPUART_GLOBAL_RST(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_GLOBAL_RST_SHIFT)) & LPUART_GLOBAL_RST_MASK)
+/*! @} */
+
+/*! @name PINCFG */
+/*! @{ */
+#define LPUART_PINCFG_TRGSEL_MASK                       (0x3U)
+#define LPUART_PINCFG_TRGSEL_SHIFT                      (0U)
+#define LPUART_PINCFG_TRGSEL(x)                         (((uint32_t)(((uint32_t)(x)) << LPUART_PINCFG_TRGSEL_SHIFT)) & LPUART_PINCFG_TRGSEL_MASK)
+/*! @} */
+
+/*! @name BAUD */
+/*! @{ */
+#define LPUART_BAUD_SBR_MASK                            (0x1FFFU)
+#define LPUART_BAUD_SBR_SHIFT                           (0U)
+#define LPUART_BAUD_SBR(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_SBR_SHIFT)) & LPUART_BAUD_SBR_MASK)
+#define LPUART_BAUD_SBNS_MASK                           (0x2000U)
+#define LPUART_BAUD_SBNS_SHIFT                          (13U)
+#define LPUART_BAUD_SBNS(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_SBNS_SHIFT)) & LPUART_BAUD_SBNS_MASK)
+#define LPUART_BAUD_RXEDGIE_MASK                        (0x4000U)
+#define LPUART_BAUD_RXEDGIE_SHIFT                       (14U)
+#define LPUART_BAUD_RXEDGIE(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_RXEDGIE_SHIFT)) & LPUART_BAUD_RXEDGIE_MASK)
+#define LPUART_BAUD_LBKDIE_MASK                         (0x8000U)
+#define LPUART_BAUD_LBKDIE_SHIFT                        (15U)
+#define LPUART_BAUD_LBKDIE(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_LBKDIE_SHIFT)) & LPUART_BAUD_LBKDIE_MASK)
+#define LPUART_BAUD_RESYNCDIS_MASK                      (0x10000U)
+#define LPUART_BAUD_RESYNCDIS_SHIFT                     (16U)
+#define LPUART_BAUD_RESYNCDIS(x)                        (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_RESYNCDIS_SHIFT)) & LPUART_BAUD_RESYNCDIS_MASK)
+#define LPUART_BAUD_BOTHEDGE_MASK                       (0x20000U)
+#define LPUART_BAUD_BOTHEDGE_SHIFT                      (17U)
+#define LPUART_BAUD_BOTHEDGE(x)                         (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_BOTHEDGE_SHIFT)) & LPUART_BAUD_BOTHEDGE_MASK)
+#define LPUART_BAUD_MATCFG_MASK                         (0xC0000U)
+#define LPUART_BAUD_MATCFG_SHIFT                        (18U)
+#define LPUART_BAUD_MATCFG(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_MATCFG_SHIFT)) & LPUART_BAUD_MATCFG_MASK)
+#define LPUART_BAUD_RIDMAE_MASK                         (0x100000U)
+#define LPUART_BAUD_RIDMAE_SHIFT                        (20U)
+#define LPUART_BAUD_RIDMAE(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_RIDMAE_SHIFT)) & LPUART_BAUD_RIDMAE_MASK)
+#define LPUART_BAUD_RDMAE_MASK                          (0x200000U)
+#define LPUART_BAUD_RDMAE_SHIFT                         (21U)
+#define LPUART_BAUD_RDMAE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_RDMAE_SHIFT)) & LPUART_BAUD_RDMAE_MASK)
+#define LPUART_BAUD_TDMAE_MASK                          (0x800000U)
+#define LPUART_BAUD_TDMAE_SHIFT                         (23U)
+#define LPUART_BAUD_TDMAE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_TDMAE_SHIFT)) & LPUART_BAUD_TDMAE_MASK)
+#define LPUART_BAUD_OSR_MASK                            (0x1F000000U)
+#define LPUART_BAUD_OSR_SHIFT                           (24U)
+#define LPUART_BAUD_OSR(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_OSR_SHIFT)) & LPUART_BAUD_OSR_MASK)
+#define LPUART_BAUD_M10_MASK                            (0x20000000U)
+#define LPUART_BAUD_M10_SHIFT                           (29U)
+#define LPUART_BAUD_M10(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_M10_SHIFT)) & LPUART_BAUD_M10_MASK)
+#define LPUART_BAUD_MAEN2_MASK                          (0x40000000U)
+#define LPUART_BAUD_MAEN2_SHIFT                         (30U)
+#define LPUART_BAUD_MAEN2(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_MAEN2_SHIFT)) & LPUART_BAUD_MAEN2_MASK)
+#define LPUART_BAUD_MAEN1_MASK                          (0x80000000U)
+#define LPUART_BAUD_MAEN1_SHIFT                         (31U)
+#define LPUART_BAUD_MAEN1(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_BAUD_MAEN1_SHIFT)) & LPUART_BAUD_MAEN1_MASK)
+/*! @} */
+
+/*! @name STAT */
+/*! @{ */
+#define LPUART_STAT_MA2F_MASK                           (0x4000U)
+#define LPUART_STAT_MA2F_SHIFT                          (14U)
+#define LPUART_STAT_MA2F(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_MA2F_SHIFT)) & LPUART_STAT_MA2F_MASK)
+#define LPUART_STAT_MA1F_MASK                           (0x8000U)
+#define LPUART_STAT_MA1F_SHIFT                          (15U)
+#define LPUART_STAT_MA1F(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_MA1F_SHIFT)) & LPUART_STAT_MA1F_MASK)
+#define LPUART_STAT_PF_MASK                             (0x10000U)
+#define LPUART_STAT_PF_SHIFT                            (16U)
+#define LPUART_STAT_PF(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_PF_SHIFT)) & LPUART_STAT_PF_MASK)
+#define LPUART_STAT_FE_MASK                             (0x20000U)
+#define LPUART_STAT_FE_SHIFT                            (17U)
+#define LPUART_STAT_FE(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_FE_SHIFT)) & LPUART_STAT_FE_MASK)
+#define LPUART_STAT_NF_MASK                             (0x40000U)
+#define LPUART_STAT_NF_SHIFT                            (18U)
+#define LPUART_STAT_NF(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_NF_SHIFT)) & LPUART_STAT_NF_MASK)
+#define LPUART_STAT_OR_MASK                             (0x80000U)
+#define LPUART_STAT_OR_SHIFT                            (19U)
+#define LPUART_STAT_OR(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_OR_SHIFT)) & LPUART_STAT_OR_MASK)
+#define LPUART_STAT_IDLE_MASK                           (0x100000U)
+#define LPUART_STAT_IDLE_SHIFT                          (20U)
+#define LPUART_STAT_IDLE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_IDLE_SHIFT)) & LPUART_STAT_IDLE_MASK)
+#define LPUART_STAT_RDRF_MASK                           (0x200000U)
+#define LPUART_STAT_RDRF_SHIFT                          (21U)
+#define LPUART_STAT_RDRF(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_RDRF_SHIFT)) & LPUART_STAT_RDRF_MASK)
+#define LPUART_STAT_TC_MASK                             (0x400000U)
+#define LPUART_STAT_TC_SHIFT                            (22U)
+#define LPUART_STAT_TC(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_TC_SHIFT)) & LPUART_STAT_TC_MASK)
+#define LPUART_STAT_TDRE_MASK                           (0x800000U)
+#define LPUART_STAT_TDRE_SHIFT                          (23U)
+#define LPUART_STAT_TDRE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_TDRE_SHIFT)) & LPUART_STAT_TDRE_MASK)
+#define LPUART_STAT_RAF_MASK                            (0x1000000U)
+#define LPUART_STAT_RAF_SHIFT                           (24U)
+#define LPUART_STAT_RAF(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_RAF_SHIFT)) & LPUART_STAT_RAF_MASK)
+#define LPUART_STAT_LBKDE_MASK                          (0x2000000U)
+#define LPUART_STAT_LBKDE_SHIFT                         (25U)
+#define LPUART_STAT_LBKDE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_LBKDE_SHIFT)) & LPUART_STAT_LBKDE_MASK)
+#define LPUART_STAT_BRK13_MASK                          (0x4000000U)
+#define LPUART_STAT_BRK13_SHIFT                         (26U)
+#define LPUART_STAT_BRK13(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_BRK13_SHIFT)) & LPUART_STAT_BRK13_MASK)
+#define LPUART_STAT_RWUID_MASK                          (0x8000000U)
+#define LPUART_STAT_RWUID_SHIFT                         (27U)
+#define LPUART_STAT_RWUID(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_RWUID_SHIFT)) & LPUART_STAT_RWUID_MASK)
+#define LPUART_STAT_RXINV_MASK                          (0x10000000U)
+#define LPUART_STAT_RXINV_SHIFT                         (28U)
+#define LPUART_STAT_RXINV(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_RXINV_SHIFT)) & LPUART_STAT_RXINV_MASK)
+#define LPUART_STAT_MSBF_MASK                           (0x20000000U)
+#define LPUART_STAT_MSBF_SHIFT                          (29U)
+#define LPUART_STAT_MSBF(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_MSBF_SHIFT)) & LPUART_STAT_MSBF_MASK)
+#define LPUART_STAT_RXEDGIF_MASK                        (0x40000000U)
+#define LPUART_STAT_RXEDGIF_SHIFT                       (30U)
+#define LPUART_STAT_RXEDGIF(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_RXEDGIF_SHIFT)) & LPUART_STAT_RXEDGIF_MASK)
+#define LPUART_STAT_LBKDIF_MASK                         (0x80000000U)
+#define LPUART_STAT_LBKDIF_SHIFT                        (31U)
+#define LPUART_STAT_LBKDIF(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_STAT_LBKDIF_SHIFT)) & LPUART_STAT_LBKDIF_MASK)
+/*! @} */
+
+/*! @name CTRL */
+/*! @{ */
+#define LPUART_CTRL_PT_MASK                             (0x1U)
+#define LPUART_CTRL_PT_SHIFT                            (0U)
+#define LPUART_CTRL_PT(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_PT_SHIFT)) & LPUART_CTRL_PT_MASK)
+#define LPUART_CTRL_PE_MASK                             (0x2U)
+#define LPUART_CTRL_PE_SHIFT                            (1U)
+#define LPUART_CTRL_PE(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_PE_SHIFT)) & LPUART_CTRL_PE_MASK)
+#define LPUART_CTRL_ILT_MASK                            (0x4U)
+#define LPUART_CTRL_ILT_SHIFT                           (2U)
+#define LPUART_CTRL_ILT(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_ILT_SHIFT)) & LPUART_CTRL_ILT_MASK)
+#define LPUART_CTRL_WAKE_MASK                           (0x8U)
+#define LPUART_CTRL_WAKE_SHIFT                          (3U)
+#define LPUART_CTRL_WAKE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_WAKE_SHIFT)) & LPUART_CTRL_WAKE_MASK)
+#define LPUART_CTRL_M_MASK                              (0x10U)
+#define LPUART_CTRL_M_SHIFT                             (4U)
+#define LPUART_CTRL_M(x)                                (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_M_SHIFT)) & LPUART_CTRL_M_MASK)
+#define LPUART_CTRL_RSRC_MASK                           (0x20U)
+#define LPUART_CTRL_RSRC_SHIFT                          (5U)
+#define LPUART_CTRL_RSRC(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_RSRC_SHIFT)) & LPUART_CTRL_RSRC_MASK)
+#define LPUART_CTRL_DOZEEN_MASK                         (0x40U)
+#define LPUART_CTRL_DOZEEN_SHIFT                        (6U)
+#define LPUART_CTRL_DOZEEN(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_DOZEEN_SHIFT)) & LPUART_CTRL_DOZEEN_MASK)
+#define LPUART_CTRL_LOOPS_MASK                          (0x80U)
+#define LPUART_CTRL_LOOPS_SHIFT                         (7U)
+#define LPUART_CTRL_LOOPS(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_LOOPS_SHIFT)) & LPUART_CTRL_LOOPS_MASK)
+#define LPUART_CTRL_IDLECFG_MASK                        (0x700U)
+#define LPUART_CTRL_IDLECFG_SHIFT                       (8U)
+#define LPUART_CTRL_IDLECFG(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_IDLECFG_SHIFT)) & LPUART_CTRL_IDLECFG_MASK)
+#define LPUART_CTRL_M7_MASK                             (0x800U)
+#define LPUART_CTRL_M7_SHIFT                            (11U)
+#define LPUART_CTRL_M7(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_M7_SHIFT)) & LPUART_CTRL_M7_MASK)
+#define LPUART_CTRL_MA2IE_MASK                          (0x4000U)
+#define LPUART_CTRL_MA2IE_SHIFT                         (14U)
+#define LPUART_CTRL_MA2IE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_MA2IE_SHIFT)) & LPUART_CTRL_MA2IE_MASK)
+#define LPUART_CTRL_MA1IE_MASK                          (0x8000U)
+#define LPUART_CTRL_MA1IE_SHIFT                         (15U)
+#define LPUART_CTRL_MA1IE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_MA1IE_SHIFT)) & LPUART_CTRL_MA1IE_MASK)
+#define LPUART_CTRL_SBK_MASK                            (0x10000U)
+#define LPUART_CTRL_SBK_SHIFT                           (16U)
+#define LPUART_CTRL_SBK(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_SBK_SHIFT)) & LPUART_CTRL_SBK_MASK)
+#define LPUART_CTRL_RWU_MASK                            (0x20000U)
+#define LPUART_CTRL_RWU_SHIFT                           (17U)
+#define LPUART_CTRL_RWU(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_RWU_SHIFT)) & LPUART_CTRL_RWU_MASK)
+#define LPUART_CTRL_RE_MASK                             (0x40000U)
+#define LPUART_CTRL_RE_SHIFT                            (18U)
+#define LPUART_CTRL_RE(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_RE_SHIFT)) & LPUART_CTRL_RE_MASK)
+#define LPUART_CTRL_TE_MASK                             (0x80000U)
+#define LPUART_CTRL_TE_SHIFT                            (19U)
+#define LPUART_CTRL_TE(x)                               (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_TE_SHIFT)) & LPUART_CTRL_TE_MASK)
+#define LPUART_CTRL_ILIE_MASK                           (0x100000U)
+#define LPUART_CTRL_ILIE_SHIFT                          (20U)
+#define LPUART_CTRL_ILIE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_ILIE_SHIFT)) & LPUART_CTRL_ILIE_MASK)
+#define LPUART_CTRL_RIE_MASK                            (0x200000U)
+#define LPUART_CTRL_RIE_SHIFT                           (21U)
+#define LPUART_CTRL_RIE(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_RIE_SHIFT)) & LPUART_CTRL_RIE_MASK)
+#define LPUART_CTRL_TCIE_MASK                           (0x400000U)
+#define LPUART_CTRL_TCIE_SHIFT                          (22U)
+#define LPUART_CTRL_TCIE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_TCIE_SHIFT)) & LPUART_CTRL_TCIE_MASK)
+#define LPUART_CTRL_TIE_MASK                            (0x800000U)
+#define LPUART_CTRL_TIE_SHIFT                           (23U)
+#define LPUART_CTRL_TIE(x)                              (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_TIE_SHIFT)) & LPUART_CTRL_TIE_MASK)
+#define LPUART_CTRL_PEIE_MASK                           (0x1000000U)
+#define LPUART_CTRL_PEIE_SHIFT                          (24U)
+#define LPUART_CTRL_PEIE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_PEIE_SHIFT)) & LPUART_CTRL_PEIE_MASK)
+#define LPUART_CTRL_FEIE_MASK                           (0x2000000U)
+#define LPUART_CTRL_FEIE_SHIFT                          (25U)
+#define LPUART_CTRL_FEIE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_FEIE_SHIFT)) & LPUART_CTRL_FEIE_MASK)
+#define LPUART_CTRL_NEIE_MASK                           (0x4000000U)
+#define LPUART_CTRL_NEIE_SHIFT                          (26U)
+#define LPUART_CTRL_NEIE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_NEIE_SHIFT)) & LPUART_CTRL_NEIE_MASK)
+#define LPUART_CTRL_ORIE_MASK                           (0x8000000U)
+#define LPUART_CTRL_ORIE_SHIFT                          (27U)
+#define LPUART_CTRL_ORIE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_ORIE_SHIFT)) & LPUART_CTRL_ORIE_MASK)
+#define LPUART_CTRL_TXINV_MASK                          (0x10000000U)
+#define LPUART_CTRL_TXINV_SHIFT                         (28U)
+#define LPUART_CTRL_TXINV(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_TXINV_SHIFT)) & LPUART_CTRL_TXINV_MASK)
+#define LPUART_CTRL_TXDIR_MASK                          (0x20000000U)
+#define LPUART_CTRL_TXDIR_SHIFT                         (29U)
+#define LPUART_CTRL_TXDIR(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_TXDIR_SHIFT)) & LPUART_CTRL_TXDIR_MASK)
+#define LPUART_CTRL_R9T8_MASK                           (0x40000000U)
+#define LPUART_CTRL_R9T8_SHIFT                          (30U)
+#define LPUART_CTRL_R9T8(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_R9T8_SHIFT)) & LPUART_CTRL_R9T8_MASK)
+#define LPUART_CTRL_R8T9_MASK                           (0x80000000U)
+#define LPUART_CTRL_R8T9_SHIFT                          (31U)
+#define LPUART_CTRL_R8T9(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_CTRL_R8T9_SHIFT)) & LPUART_CTRL_R8T9_MASK)
+/*! @} */
+
+/*! @name DATA */
+/*! @{ */
+#define LPUART_DATA_R0T0_MASK                           (0x1U)
+#define LPUART_DATA_R0T0_SHIFT                          (0U)
+#define LPUART_DATA_R0T0(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R0T0_SHIFT)) & LPUART_DATA_R0T0_MASK)
+#define LPUART_DATA_R1T1_MASK                           (0x2U)
+#define LPUART_DATA_R1T1_SHIFT                          (1U)
+#define LPUART_DATA_R1T1(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R1T1_SHIFT)) & LPUART_DATA_R1T1_MASK)
+#define LPUART_DATA_R2T2_MASK                           (0x4U)
+#define LPUART_DATA_R2T2_SHIFT                          (2U)
+#define LPUART_DATA_R2T2(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R2T2_SHIFT)) & LPUART_DATA_R2T2_MASK)
+#define LPUART_DATA_R3T3_MASK                           (0x8U)
+#define LPUART_DATA_R3T3_SHIFT                          (3U)
+#define LPUART_DATA_R3T3(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R3T3_SHIFT)) & LPUART_DATA_R3T3_MASK)
+#define LPUART_DATA_R4T4_MASK                           (0x10U)
+#define LPUART_DATA_R4T4_SHIFT                          (4U)
+#define LPUART_DATA_R4T4(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R4T4_SHIFT)) & LPUART_DATA_R4T4_MASK)
+#define LPUART_DATA_R5T5_MASK                           (0x20U)
+#define LPUART_DATA_R5T5_SHIFT                          (5U)
+#define LPUART_DATA_R5T5(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R5T5_SHIFT)) & LPUART_DATA_R5T5_MASK)
+#define LPUART_DATA_R6T6_MASK                           (0x40U)
+#define LPUART_DATA_R6T6_SHIFT                          (6U)
+#define LPUART_DATA_R6T6(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R6T6_SHIFT)) & LPUART_DATA_R6T6_MASK)
+#define LPUART_DATA_R7T7_MASK                           (0x80U)
+#define LPUART_DATA_R7T7_SHIFT                          (7U)
+#define LPUART_DATA_R7T7(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R7T7_SHIFT)) & LPUART_DATA_R7T7_MASK)
+#define LPUART_DATA_R8T8_MASK                           (0x100U)
+#define LPUART_DATA_R8T8_SHIFT                          (8U)
+#define LPUART_DATA_R8T8(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R8T8_SHIFT)) & LPUART_DATA_R8T8_MASK)
+#define LPUART_DATA_R9T9_MASK                           (0x200U)
+#define LPUART_DATA_R9T9_SHIFT                          (9U)
+#define LPUART_DATA_R9T9(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_R9T9_SHIFT)) & LPUART_DATA_R9T9_MASK)
+#define LPUART_DATA_IDLINE_MASK                         (0x800U)
+#define LPUART_DATA_IDLINE_SHIFT                        (11U)
+#define LPUART_DATA_IDLINE(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_IDLINE_SHIFT)) & LPUART_DATA_IDLINE_MASK)
+#define LPUART_DATA_RXEMPT_MASK                         (0x1000U)
+#define LPUART_DATA_RXEMPT_SHIFT                        (12U)
+#define LPUART_DATA_RXEMPT(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_RXEMPT_SHIFT)) & LPUART_DATA_RXEMPT_MASK)
+#define LPUART_DATA_FRETSC_MASK                         (0x2000U)
+#define LPUART_DATA_FRETSC_SHIFT                        (13U)
+#define LPUART_DATA_FRETSC(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_FRETSC_SHIFT)) & LPUART_DATA_FRETSC_MASK)
+#define LPUART_DATA_PARITYE_MASK                        (0x4000U)
+#define LPUART_DATA_PARITYE_SHIFT                       (14U)
+#define LPUART_DATA_PARITYE(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_PARITYE_SHIFT)) & LPUART_DATA_PARITYE_MASK)
+#define LPUART_DATA_NOISY_MASK                          (0x8000U)
+#define LPUART_DATA_NOISY_SHIFT                         (15U)
+#define LPUART_DATA_NOISY(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_DATA_NOISY_SHIFT)) & LPUART_DATA_NOISY_MASK)
+/*! @} */
+
+/*! @name MATCH */
+/*! @{ */
+#define LPUART_MATCH_MA1_MASK                           (0x3FFU)
+#define LPUART_MATCH_MA1_SHIFT                          (0U)
+#define LPUART_MATCH_MA1(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_MATCH_MA1_SHIFT)) & LPUART_MATCH_MA1_MASK)
+#define LPUART_MATCH_MA2_MASK                           (0x3FF0000U)
+#define LPUART_MATCH_MA2_SHIFT                          (16U)
+#define LPUART_MATCH_MA2(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_MATCH_MA2_SHIFT)) & LPUART_MATCH_MA2_MASK)
+/*! @} */
+
+/*! @name MODIR */
+/*! @{ */
+#define LPUART_MODIR_TXCTSE_MASK                        (0x1U)
+#define LPUART_MODIR_TXCTSE_SHIFT                       (0U)
+#define LPUART_MODIR_TXCTSE(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_TXCTSE_SHIFT)) & LPUART_MODIR_TXCTSE_MASK)
+#define LPUART_MODIR_TXRTSE_MASK                        (0x2U)
+#define LPUART_MODIR_TXRTSE_SHIFT                       (1U)
+#define LPUART_MODIR_TXRTSE(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_TXRTSE_SHIFT)) & LPUART_MODIR_TXRTSE_MASK)
+#define LPUART_MODIR_TXRTSPOL_MASK                      (0x4U)
+#define LPUART_MODIR_TXRTSPOL_SHIFT                     (2U)
+#define LPUART_MODIR_TXRTSPOL(x)                        (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_TXRTSPOL_SHIFT)) & LPUART_MODIR_TXRTSPOL_MASK)
+#define LPUART_MODIR_RXRTSE_MASK                        (0x8U)
+#define LPUART_MODIR_RXRTSE_SHIFT                       (3U)
+#define LPUART_MODIR_RXRTSE(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_RXRTSE_SHIFT)) & LPUART_MODIR_RXRTSE_MASK)
+#define LPUART_MODIR_TXCTSC_MASK                        (0x10U)
+#define LPUART_MODIR_TXCTSC_SHIFT                       (4U)
+#define LPUART_MODIR_TXCTSC(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_TXCTSC_SHIFT)) & LPUART_MODIR_TXCTSC_MASK)
+#define LPUART_MODIR_TXCTSSRC_MASK                      (0x20U)
+#define LPUART_MODIR_TXCTSSRC_SHIFT                     (5U)
+#define LPUART_MODIR_TXCTSSRC(x)                        (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_TXCTSSRC_SHIFT)) & LPUART_MODIR_TXCTSSRC_MASK)
+#define LPUART_MODIR_RTSWATER_MASK                      (0x300U)
+#define LPUART_MODIR_RTSWATER_SHIFT                     (8U)
+#define LPUART_MODIR_RTSWATER(x)                        (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_RTSWATER_SHIFT)) & LPUART_MODIR_RTSWATER_MASK)
+#define LPUART_MODIR_TNP_MASK                           (0x30000U)
+#define LPUART_MODIR_TNP_SHIFT                          (16U)
+#define LPUART_MODIR_TNP(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_TNP_SHIFT)) & LPUART_MODIR_TNP_MASK)
+#define LPUART_MODIR_IREN_MASK                          (0x40000U)
+#define LPUART_MODIR_IREN_SHIFT                         (18U)
+#define LPUART_MODIR_IREN(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_MODIR_IREN_SHIFT)) & LPUART_MODIR_IREN_MASK)
+/*! @} */
+
+/*! @name FIFO */
+/*! @{ */
+#define LPUART_FIFO_RXFIFOSIZE_MASK                     (0x7U)
+#define LPUART_FIFO_RXFIFOSIZE_SHIFT                    (0U)
+#define LPUART_FIFO_RXFIFOSIZE(x)                       (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXFIFOSIZE_SHIFT)) & LPUART_FIFO_RXFIFOSIZE_MASK)
+#define LPUART_FIFO_RXFE_MASK                           (0x8U)
+#define LPUART_FIFO_RXFE_SHIFT                          (3U)
+#define LPUART_FIFO_RXFE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXFE_SHIFT)) & LPUART_FIFO_RXFE_MASK)
+#define LPUART_FIFO_TXFIFOSIZE_MASK                     (0x70U)
+#define LPUART_FIFO_TXFIFOSIZE_SHIFT                    (4U)
+#define LPUART_FIFO_TXFIFOSIZE(x)                       (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_TXFIFOSIZE_SHIFT)) & LPUART_FIFO_TXFIFOSIZE_MASK)
+#define LPUART_FIFO_TXFE_MASK                           (0x80U)
+#define LPUART_FIFO_TXFE_SHIFT                          (7U)
+#define LPUART_FIFO_TXFE(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_TXFE_SHIFT)) & LPUART_FIFO_TXFE_MASK)
+#define LPUART_FIFO_RXUFE_MASK                          (0x100U)
+#define LPUART_FIFO_RXUFE_SHIFT                         (8U)
+#define LPUART_FIFO_RXUFE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXUFE_SHIFT)) & LPUART_FIFO_RXUFE_MASK)
+#define LPUART_FIFO_TXOFE_MASK                          (0x200U)
+#define LPUART_FIFO_TXOFE_SHIFT                         (9U)
+#define LPUART_FIFO_TXOFE(x)                            (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_TXOFE_SHIFT)) & LPUART_FIFO_TXOFE_MASK)
+#define LPUART_FIFO_RXIDEN_MASK                         (0x1C00U)
+#define LPUART_FIFO_RXIDEN_SHIFT                        (10U)
+#define LPUART_FIFO_RXIDEN(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXIDEN_SHIFT)) & LPUART_FIFO_RXIDEN_MASK)
+#define LPUART_FIFO_RXFLUSH_MASK                        (0x4000U)
+#define LPUART_FIFO_RXFLUSH_SHIFT                       (14U)
+#define LPUART_FIFO_RXFLUSH(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXFLUSH_SHIFT)) & LPUART_FIFO_RXFLUSH_MASK)
+#define LPUART_FIFO_TXFLUSH_MASK                        (0x8000U)
+#define LPUART_FIFO_TXFLUSH_SHIFT                       (15U)
+#define LPUART_FIFO_TXFLUSH(x)                          (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_TXFLUSH_SHIFT)) & LPUART_FIFO_TXFLUSH_MASK)
+#define LPUART_FIFO_RXUF_MASK                           (0x10000U)
+#define LPUART_FIFO_RXUF_SHIFT                          (16U)
+#define LPUART_FIFO_RXUF(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXUF_SHIFT)) & LPUART_FIFO_RXUF_MASK)
+#define LPUART_FIFO_TXOF_MASK                           (0x20000U)
+#define LPUART_FIFO_TXOF_SHIFT                          (17U)
+#define LPUART_FIFO_TXOF(x)                             (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_TXOF_SHIFT)) & LPUART_FIFO_TXOF_MASK)
+#define LPUART_FIFO_RXEMPT_MASK                         (0x400000U)
+#define LPUART_FIFO_RXEMPT_SHIFT                        (22U)
+#define LPUART_FIFO_RXEMPT(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_RXEMPT_SHIFT)) & LPUART_FIFO_RXEMPT_MASK)
+#define LPUART_FIFO_TXEMPT_MASK                         (0x800000U)
+#define LPUART_FIFO_TXEMPT_SHIFT                        (23U)
+#define LPUART_FIFO_TXEMPT(x)                           (((uint32_t)(((uint32_t)(x)) << LPUART_FIFO_TXEMPT_SHIFT)) & LPUART_FIFO_TXEMPT_MASK)
+/*! @} */
+
+/*! @name WATER */
+/*! @{ */
+#define LPUART_WATER_TXWATER_MASK                       (0x3FU)
+#define LPUART_WATER_TXWATER_SHIFT                      (0U)
+#define LPUART_WATER_TXWATER(x)                         (((uint32_t)(((uint32_t)(x)) << LPUART_WATER_TXWATER_SHIFT)) & LPUART_WATER_TXWATER_MASK)
+#define LPUART_WATER_TXCOUNT_MASK                       (0x7F00U)
+#define LPUART_WATER_TXCOUNT_SHIFT                      (8U)
+#define LPUART_WATER_TXCOUNT(x)                         (((uint32_t)(((uint32_t)(x)) << LPUART_WATER_TXCOUNT_SHIFT)) & LPUART_WATER_TXCOUNT_MASK)
+#define LPUART_WATER_RXWATER_MASK                       (0x3F0000U)
+#define LPUART_WATER_RXWATER_SHIFT                      (16U)
+#define LPUART_WATER_RXWATER(x)                         (((uint32_t)(((uint32_t)(x)) << LPUART_WATER_RXWATER_SHIFT)) & LPUART_WATER_RXWATER_MASK)
+#define LPUART_WATER_RXCOUNT_MASK                       (0x7F000000U)
+#define LPUART_WATER_RXCOUNT_SHIFT                      (24U)
+#define LPUART_WATER_RXCOUNT(x)                         (((uint32_t)(((uint32_t)(x)) << LPUART_WATER_RXCOUNT_SHIFT)) & LPUART_WATER_RXCOUNT_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group LPUART_Register_Masks */
+
+/* LPUART - Peripheral instance base addresses */
+/** Peripheral CM4_0__LPUART base address */
+#define CM4_0__LPUART_BASE                              (0x41220000u)
+/** Peripheral CM4_0__LPUART base pointer */
+#define CM4_0__LPUART                                   ((LPUART_Type *)CM4_0__LPUART_BASE)
+/** Peripheral CM4_1__LPUART base address */
+#define CM4_1__LPUART_BASE                              (0x45220000u)
+/** Peripheral CM4_1__LPUART base pointer */
+#define CM4_1__LPUART                                   ((LPUART_Type *)CM4_1__LPUART_BASE)
+/** Peripheral DMA__LPUART0 base address */
+#define DMA__LPUART0_BASE                               (0x5A060000u)
+/** Peripheral DMA__LPUART0 base pointer */
+#define DMA__LPUART0                                    ((LPUART_Type *)DMA__LPUART0_BASE)
+/** Peripheral DMA__LPUART1 base address */
+#define DMA__LPUART1_BASE                               (0x5A070000u)
+/** Peripheral DMA__LPUART1 base pointer */
+#define DMA__LPUART1                                    ((LPUART_Type *)DMA__LPUART1_BASE)
+/** Peripheral DMA__LPUART2 base address */
+#define DMA__LPUART2_BASE                               (0x5A080000u)
+/** Peripheral DMA__LPUART2 base pointer */
+#define DMA__LPUART2                                    ((LPUART_Type *)DMA__LPUART2_BASE)
+/** Peripheral DMA__LPUART3 base address */
+#define DMA__LPUART3_BASE                               (0x5A090000u)
+/** Peripheral DMA__LPUART3 base pointer */
+#define DMA__LPUART3                                    ((LPUART_Type *)DMA__LPUART3_BASE)
+/** Peripheral DMA__LPUART4 base address */
+#define DMA__LPUART4_BASE                               (0x5A0A0000u)
+/** Peripheral DMA__LPUART4 base pointer */
+#define DMA__LPUART4                                    ((LPUART_Type *)DMA__LPUART4_BASE)
+/** Peripheral SCU__LPUART base address */
+#define SCU__LPUART_BASE                                (0x33220000u)
+/** Peripheral SCU__LPUART base pointer */
+#define SCU__LPUART                                     ((LPUART_Type *)SCU__LPUART_BASE)
+/** Array initializer of LPUART peripheral base addresses */
+#define LPUART_BASE_ADDRS                        { CM4_0__LPUART_BASE, CM4_1__LPUART_BASE, DMA__LPUART0_BASE, DMA__LPUART1_BASE, DMA__LPUART2_BASE, DMA__LPUART3_BASE, DMA__LPUART4_BASE, SCU__LPUART_BASE }
+/** Array initializer of LPUART peripheral base pointers */
+#define LPUART_BASE_PTRS                         { CM4_0__LPUART, CM4_1__LPUART, DMA__LPUART0, DMA__LPUART1, DMA__LPUART2, DMA__LPUART3, DMA__LPUART4, SCU__LPUART }
+/** Interrupt vectors for the LPUART peripheral type */
+#define LPUART_RX_TX_IRQS                        { M4_0_LPUART_IRQn, NotAvail_IRQn, DMA_UART0_INT_IRQn, DMA_UART1_INT_IRQn, DMA_UART2_INT_IRQn, DMA_UART3_INT_IRQn, DMA_UART4_INT_IRQn, NotAvail_IRQn }
+
+/*!
+ * @}
+ */ /* end of group LPUART_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- MU Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup MU_Peripheral_Access_Layer MU Peripheral Access Layer
+ * @{
+ */
+
+/** MU - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t TR[4];                             /**< Transmit Register, array offset: 0x0, array step: 0x4 */
+  __I  uint32_t RR[4];                             /**< Receive Register, array offset: 0x10, array step: 0x4 */
+  __IO uint32_t SR;                                /**< Status Register, offset: 0x20 */
+  __IO uint32_t CR;                                /**< Control Register, offset: 0x24 */
+} MU_Type;
+
+/* ----------------------------------------------------------------------------
+   -- MU Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup MU_Register_Masks MU Register Masks
+ * @{
+ */
+
+/*! @name SR */
+/*! @{ */
+#define MU_SR_Fn_MASK                                   (0x7U)
+#define MU_SR_Fn_SHIFT                                  (0U)
+#define MU_SR_Fn(x)                                     (((uint32_t)(((uint32_t)(x)) << MU_SR_Fn_SHIFT)) & MU_SR_Fn_MASK)
+#define MU_SR_NMIC_MASK                                 (0x8U)
+#define MU_SR_NMIC_SHIFT                                (3U)
+#define MU_SR_NMIC(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_SR_NMIC_SHIFT)) & MU_SR_NMIC_MASK)
+#define MU_SR_EP_MASK                                   (0x10U)
+#define MU_SR_EP_SHIFT                                  (4U)
+#define MU_SR_EP(x)                                     (((uint32_t)(((uint32_t)(x)) << MU_SR_EP_SHIFT)) & MU_SR_EP_MASK)
+#define MU_SR_PM_MASK                                   (0x60U)
+#define MU_SR_PM_SHIFT                                  (5U)
+#define MU_SR_PM(x)                                     (((uint32_t)(((uint32_t)(x)) << MU_SR_PM_SHIFT)) & MU_SR_PM_MASK)
+#define MU_SR_RS_MASK                                   (0x80U)
+#define MU_SR_RS_SHIFT                                  (7U)
+#define MU_SR_RS(x)                                     (((uint32_t)(((uint32_t)(x)) << MU_SR_RS_SHIFT)) & MU_SR_RS_MASK)
+#define MU_SR_FUP_MASK                                  (0x100U)
+#define MU_SR_FUP_SHIFT                                 (8U)
+#define MU_SR_FUP(x)                                    (((uint32_t)(((uint32_t)(x)) << MU_SR_FUP_SHIFT)) & MU_SR_FUP_MASK)
+#define MU_SR_RDIP_MASK                                 (0x200U)
+#define MU_SR_RDIP_SHIFT                                (9U)
+#define MU_SR_RDIP(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_SR_RDIP_SHIFT)) & MU_SR_RDIP_MASK)
+#define MU_SR_RAIP_MASK                                 (0x400U)
+#define MU_SR_RAIP_SHIFT                                (10U)
+#define MU_SR_RAIP(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_SR_RAIP_SHIFT)) & MU_SR_RAIP_MASK)
+#define MU_SR_TEn_MASK                                  (0xF00000U)
+#define MU_SR_TEn_SHIFT                                 (20U)
+#define MU_SR_TEn(x)                                    (((uint32_t)(((uint32_t)(x)) << MU_SR_TEn_SHIFT)) & MU_SR_TEn_MASK)
+#define MU_SR_RFn_MASK                                  (0xF000000U)
+#define MU_SR_RFn_SHIFT                                 (24U)
+#define MU_SR_RFn(x)                                    (((uint32_t)(((uint32_t)(x)) << MU_SR_RFn_SHIFT)) & MU_SR_RFn_MASK)
+#define MU_SR_GIPn_MASK                                 (0xF0000000U)
+#define MU_SR_GIPn_SHIFT                                (28U)
+#define MU_SR_GIPn(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_SR_GIPn_SHIFT)) & MU_SR_GIPn_MASK)
+/*! @} */
+
+/*! @name CR */
+/*! @{ */
+#define MU_CR_Fn_MASK                                   (0x7U)
+#define MU_CR_Fn_SHIFT                                  (0U)
+#define MU_CR_Fn(x)                                     (((uint32_t)(((uint32_t)(x)) << MU_CR_Fn_SHIFT)) & MU_CR_Fn_MASK)
+#define MU_CR_NMI_MASK                                  (0x8U)
+#define MU_CR_NMI_SHIFT                                 (3U)
+#define MU_CR_NMI(x)                                    (((uint32_t)(((uint32_t)(x)) << MU_CR_NMI_SHIFT)) & MU_CR_NMI_MASK)
+#define MU_CR_HR_MASK                                   (0x10U)
+#define MU_CR_HR_SHIFT                                  (4U)
+#define MU_CR_HR(x)                                     (((uint32_t)(((uint32_t)(x)) << MU_CR_HR_SHIFT)) & MU_CR_HR_MASK)
+#define MU_CR_MUR_MASK                                  (0x20U)
+#define MU_CR_MUR_SHIFT                                 (5U)
+#define MU_CR_MUR(x)                                    (((uint32_t)(((uint32_t)(x)) << MU_CR_MUR_SHIFT)) & MU_CR_MUR_MASK)
+#define MU_CR_RSTH_MASK                                 (0x80U)
+#define MU_CR_RSTH_SHIFT                                (7U)
+#define MU_CR_RSTH(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_RSTH_SHIFT)) & MU_CR_RSTH_MASK)
+#define MU_CR_CLKE_MASK                                 (0x100U)
+#define MU_CR_CLKE_SHIFT                                (8U)
+#define MU_CR_CLKE(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_CLKE_SHIFT)) & MU_CR_CLKE_MASK)
+#define MU_CR_BOOT_MASK                                 (0x600U)
+#define MU_CR_BOOT_SHIFT                                (9U)
+#define MU_CR_BOOT(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_BOOT_SHIFT)) & MU_CR_BOOT_MASK)
+#define MU_CR_HRM_MASK                                  (0x800U)
+#define MU_CR_HRM_SHIFT                                 (11U)
+#define MU_CR_HRM(x)                                    (((uint32_t)(((uint32_t)(x)) << MU_CR_HRM_SHIFT)) & MU_CR_HRM_MASK)
+#define MU_CR_BBOOT_MASK                                (0x3000U)
+#define MU_CR_BBOOT_SHIFT                               (12U)
+#define MU_CR_BBOOT(x)                                  (((uint32_t)(((uint32_t)(x)) << MU_CR_BBOOT_SHIFT)) & MU_CR_BBOOT_MASK)
+#define MU_CR_GIRn_MASK                                 (0xF0000U)
+#define MU_CR_GIRn_SHIFT                                (16U)
+#define MU_CR_GIRn(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_GIRn_SHIFT)) & MU_CR_GIRn_MASK)
+#define MU_CR_TIEn_MASK                                 (0xF00000U)
+#define MU_CR_TIEn_SHIFT                                (20U)
+#define MU_CR_TIEn(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_TIEn_SHIFT)) & MU_CR_TIEn_MASK)
+#define MU_CR_RIEn_MASK                                 (0xF000000U)
+#define MU_CR_RIEn_SHIFT                                (24U)
+#define MU_CR_RIEn(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_RIEn_SHIFT)) & MU_CR_RIEn_MASK)
+#define MU_CR_GIEn_MASK                                 (0xF0000000U)
+#define MU_CR_GIEn_SHIFT                                (28U)
+#define MU_CR_GIEn(x)                                   (((uint32_t)(((uint32_t)(x)) << MU_CR_GIEn_SHIFT)) & MU_CR_GIEn_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group MU_Register_Masks */
+
+/* MU - Peripheral instance base addresses */
+/** Peripheral CM4_0__MU0_B0 base address */
+#define CM4_0__MU0_B0_BASE                              (0x414B0000u)
+/** Peripheral CM4_0__MU0_B0 base pointer */
+#define CM4_0__MU0_B0                                   ((MU_Type *)CM4_0__MU0_B0_BASE)
+/** Peripheral CM4_0__MU0_B1 base address */
+#define CM4_0__MU0_B1_BASE                              (0x414C0000u)
+/** Peripheral CM4_0__MU0_B1 base pointer */
+#define CM4_0__MU0_B1                                   ((MU_Type *)CM4_0__MU0_B1_BASE)
+/** Peripheral CM4_0__MU0_B2 base address */
+#define CM4_0__MU0_B2_BASE                              (0x414D0000u)
+/** Peripheral CM4_0__MU0_B2 base pointer */
+#define CM4_0__MU0_B2                                   ((MU_Type *)CM4_0__MU0_B2_BASE)
+/** Peripheral CM4_0__MU0_B3 base address */
+#define CM4_0__MU0_B3_BASE                              (0x414E0000u)
+/** Peripheral CM4_0__MU0_B3 base pointer */
+#define CM4_0__MU0_B3                                   ((MU_Type *)CM4_0__MU0_B3_BASE)
+/** Peripheral CM4_0__MU0_A0 base address */
+#define CM4_0__MU0_A0_BASE                              (0x41430000u)
+/** Peripheral CM4_0__MU0_A0 base pointer */
+#define CM4_0__MU0_A0                                   ((MU_Type *)CM4_0__MU0_A0_BASE)
+/** Peripheral CM4_0__MU0_A1 base address */
+#define CM4_0__MU0_A1_BASE                              (0x41440000u)
+/** Peripheral CM4_0__MU0_A1 base pointer */
+#define CM4_0__MU0_A1                                   ((MU_Type *)CM4_0__MU0_A1_BASE)
+/** Peripheral CM4_0__MU0_A2 base address */
+#define CM4_0__MU0_A2_BASE                              (0x41450000u)
+/** Peripheral CM4_0__MU0_A2 base pointer */
+#define CM4_0__MU0_A2                                   ((MU_Type *)CM4_0__MU0_A2_BASE)
+/** Peripheral CM4_0__MU0_A3 base address */
+#define CM4_0__MU0_A3_BASE                              (0x41460000u)
+/** Peripheral CM4_0__MU0_A3 base pointer */
+#define CM4_0__MU0_A3                                   ((MU_Type *)CM4_0__MU0_A3_BASE)
+/** Peripheral CM4_0__MU1_A base address */
+#define CM4_0__MU1_A_BASE                               (0x41480000u)
+/** Peripheral CM4_0__MU1_A base pointer */
+#define CM4_0__MU1_A                                    ((MU_Type *)CM4_0__MU1_A_BASE)
+/** Peripheral CM4_1__MU0_B0 base address */
+#define CM4_1__MU0_B0_BASE                              (0x454B0000u)
+/** Peripheral CM4_1__MU0_B0 base pointer */
+#define CM4_1__MU0_B0                                   ((MU_Type *)CM4_1__MU0_B0_BASE)
+/** Peripheral CM4_1__MU0_B1 base address */
+#define CM4_1__MU0_B1_BASE                              (0x454C0000u)
+/** Peripheral CM4_1__MU0_B1 base pointer */
+#define CM4_1__MU0_B1                                   ((MU_Type *)CM4_1__MU0_B1_BASE)
+/** Peripheral CM4_1__MU0_B2 base address */
+#define CM4_1__MU0_B2_BASE                              (0x454D0000u)
+/** Peripheral CM4_1__MU0_B2 base pointer */
+#define CM4_1__MU0_B2                                   ((MU_Type *)CM4_1__MU0_B2_BASE)
+/** Peripheral CM4_1__MU0_B3 base address */
+#define CM4_1__MU0_B3_BASE                              (0x454E0000u)
+/** Peripheral CM4_1__MU0_B3 base pointer */
+#define CM4_1__MU0_B3                                   ((MU_Type *)CM4_1__MU0_B3_BASE)
+/** Peripheral CM4_1__MU0_A0 base address */
+#define CM4_1__MU0_A0_BASE                              (0x45430000u)
+/** Peripheral CM4_1__MU0_A0 base pointer */
+#define CM4_1__MU0_A0                                   ((MU_Type *)CM4_1__MU0_A0_BASE)
+/** Peripheral CM4_1__MU0_A1 base address */
+#define CM4_1__MU0_A1_BASE                              (0x45440000u)
+/** Peripheral CM4_1__MU0_A1 base pointer */
+#define CM4_1__MU0_A1                                   ((MU_Type *)CM4_1__MU0_A1_BASE)
+/** Peripheral CM4_1__MU0_A2 base address */
+#define CM4_1__MU0_A2_BASE                              (0x45450000u)
+/** Peripheral CM4_1__MU0_A2 base pointer */
+#define CM4_1__MU0_A2                                   ((MU_Type *)CM4_1__MU0_A2_BASE)
+/** Peripheral CM4_1__MU0_A3 base address */
+#define CM4_1__MU0_A3_BASE                              (0x45460000u)
+/** Peripheral CM4_1__MU0_A3 base pointer */
+#define CM4_1__MU0_A3                                   ((MU_Type *)CM4_1__MU0_A3_BASE)
+/** Peripheral CM4_1__MU1_A base address */
+#define CM4_1__MU1_A_BASE                               (0x45480000u)
+/** Peripheral CM4_1__MU1_A base pointer */
+#define CM4_1__MU1_A                                    ((MU_Type *)CM4_1__MU1_A_BASE)
+/** Peripheral LSIO__MU0_A base address */
+#define LSIO__MU0_A_BASE                                (0x5D1B0000u)
+/** Peripheral LSIO__MU0_A base pointer */
+#define LSIO__MU0_A                                     ((MU_Type *)LSIO__MU0_A_BASE)
+/** Peripheral LSIO__MU1_A base address */
+#define LSIO__MU1_A_BASE                                (0x5D1C0000u)
+/** Peripheral LSIO__MU1_A base pointer */
+#define LSIO__MU1_A                                     ((MU_Type *)LSIO__MU1_A_BASE)
+/** Peripheral LSIO__MU2_A base address */
+#define LSIO__MU2_A_BASE                                (0x5D1D0000u)
+/** Peripheral LSIO__MU2_A base pointer */
+#define LSIO__MU2_A                                     ((MU_Type *)LSIO__MU2_A_BASE)
+/** Peripheral LSIO__MU3_A base address */
+#define LSIO__MU3_A_BASE                                (0x5D1E0000u)
+/** Peripheral LSIO__MU3_A base pointer */
+#define LSIO__MU3_A                                     ((MU_Type *)LSIO__MU3_A_BASE)
+/** Peripheral LSIO__MU4_A base address */
+#define LSIO__MU4_A_BASE                                (0x5D1F0000u)
+/** Peripheral LSIO__MU4_A base pointer */
+#define LSIO__MU4_A                                     ((MU_Type *)LSIO__MU4_A_BASE)
+/** Peripheral LSIO__MU5_A base address */
+#define LSIO__MU5_A_BASE                                (0x5D200000u)
+/** Peripheral LSIO__MU5_A base pointer */
+#define LSIO__MU5_A                                     ((MU_Type *)LSIO__MU5_A_BASE)
+/** Peripheral LSIO__MU6_A base address */
+#define LSIO__MU6_A_BASE                                (0x5D210000u)
+/** Peripheral LSIO__MU6_A base pointer */
+#define LSIO__MU6_A                                     ((MU_Type *)LSIO__MU6_A_BASE)
+/** Peripheral LSIO__MU7_A base address */
+#define LSIO__MU7_A_BASE                                (0x5D220000u)
+/** Peripheral LSIO__MU7_A base pointer */
+#define LSIO__MU7_A                                     ((MU_Type *)LSIO__MU7_A_BASE)
+/** Peripheral LSIO__MU8_A base address */
+#define LSIO__MU8_A_BASE                                (0x5D230000u)
+/** Peripheral LSIO__MU8_A base pointer */
+#define LSIO__MU8_A                                     ((MU_Type *)LSIO__MU8_A_BASE)
+/** Peripheral LSIO__MU9_A base address */
+#define LSIO__MU9_A_BASE                                (0x5D240000u)
+/** Peripheral LSIO__MU9_A base pointer */
+#define LSIO__MU9_A                                     ((MU_Type *)LSIO__MU9_A_BASE)
+/** Peripheral LSIO__MU10_A base address */
+#define LSIO__MU10_A_BASE                               (0x5D250000u)
+/** Peripheral LSIO__MU10_A base pointer */
+#define LSIO__MU10_A                                    ((MU_Type *)LSIO__MU10_A_BASE)
+/** Peripheral LSIO__MU11_A base address */
+#define LSIO__MU11_A_BASE                               (0x5D260000u)
+/** Peripheral LSIO__MU11_A base pointer */
+#define LSIO__MU11_A                                    ((MU_Type *)LSIO__MU11_A_BASE)
+/** Peripheral LSIO__MU12_A base address */
+#define LSIO__MU12_A_BASE                               (0x5D270000u)
+/** Peripheral LSIO__MU12_A base pointer */
+#define LSIO__MU12_A                                    ((MU_Type *)LSIO__MU12_A_BASE)
+/** Peripheral LSIO__MU13_A base address */
+#define LSIO__MU13_A_BASE                               (0x5D280000u)
+/** Peripheral LSIO__MU13_A base pointer */
+#define LSIO__MU13_A                                    ((MU_Type *)LSIO__MU13_A_BASE)
+/** Peripheral LSIO__MU5_B base address */
+#define LSIO__MU5_B_BASE                                (0x5D290000u)
+/** Peripheral LSIO__MU5_B base pointer */
+#define LSIO__MU5_B                                     ((MU_Type *)LSIO__MU5_B_BASE)
+/** Peripheral LSIO__MU6_B base address */
+#define LSIO__MU6_B_BASE                                (0x5D2A0000u)
+/** Peripheral LSIO__MU6_B base pointer */
+#define LSIO__MU6_B                                     ((MU_Type *)LSIO__MU6_B_BASE)
+/** Peripheral LSIO__MU7_B base address */
+#define LSIO__MU7_B_BASE                                (0x5D2B0000u)
+/** Peripheral LSIO__MU7_B base pointer */
+#define LSIO__MU7_B                                     ((MU_Type *)LSIO__MU7_B_BASE)
+/** Peripheral LSIO__MU8_B base address */
+#define LSIO__MU8_B_BASE                                (0x5D2C0000u)
+/** Peripheral LSIO__MU8_B base pointer */
+#define LSIO__MU8_B                                     ((MU_Type *)LSIO__MU8_B_BASE)
+/** Peripheral LSIO__MU9_B base address */
+#define LSIO__MU9_B_BASE                                (0x5D2D0000u)
+/** Peripheral LSIO__MU9_B base pointer */
+#define LSIO__MU9_B                                     ((MU_Type *)LSIO__MU9_B_BASE)
+/** Peripheral LSIO__MU10_B base address */
+#define LSIO__MU10_B_BASE                               (0x5D2E0000u)
+/** Peripheral LSIO__MU10_B base pointer */
+#define LSIO__MU10_B                                    ((MU_Type *)LSIO__MU10_B_BASE)
+/** Peripheral LSIO__MU11_B base address */
+#define LSIO__MU11_B_BASE                               (0x5D2F0000u)
+/** Peripheral LSIO__MU11_B base pointer */
+#define LSIO__MU11_B                                    ((MU_Type *)LSIO__MU11_B_BASE)
+/** Peripheral LSIO__MU12_B base address */
+#define LSIO__MU12_B_BASE                               (0x5D300000u)
+/** Peripheral LSIO__MU12_B base pointer */
+#define LSIO__MU12_B                                    ((MU_Type *)LSIO__MU12_B_BASE)
+/** Peripheral LSIO__MU13_B base address */
+#define LSIO__MU13_B_BASE                               (0x5D310000u)
+/** Peripheral LSIO__MU13_B base pointer */
+#define LSIO__MU13_B                                    ((MU_Type *)LSIO__MU13_B_BASE)
+/* The count of MU_TR and MU_RR */
+#define MU_TR_COUNT                              (4U)
+#define MU_RR_COUNT                              (4U)
+/** Array initializer of MU peripheral base addresses */
+#define MU_BASE_ADDRS                            { CM4_0__MU0_B0_BASE, CM4_0__MU0_B1_BASE, CM4_0__MU0_B2_BASE, CM4_0__MU0_B3_BASE, CM4_0__MU0_A0_BASE, CM4_0__MU0_A1_BASE, CM4_0__MU0_A2_BASE, CM4_0__MU0_A3_BASE, CM4_0__MU1_A_BASE, CM4_1__MU0_B0_BASE, CM4_1__MU0_B1_BASE, CM4_1__MU0_B2_BASE, CM4_1__MU0_B3_BASE, CM4_1__MU0_A0_BASE, CM4_1__MU0_A1_BASE, CM4_1__MU0_A2_BASE, CM4_1__MU0_A3_BASE, CM4_1__MU1_A_BASE, LSIO__MU0_A_BASE, LSIO__MU1_A_BASE, LSIO__MU2_A_BASE, LSIO__MU3_A_BASE, LSIO__MU4_A_BASE, LSIO__MU5_A_BASE, LSIO__MU6_A_BASE, LSIO__MU7_A_BASE, LSIO__MU8_A_BASE, LSIO__MU9_A_BASE, LSIO__MU10_A_BASE, LSIO__MU11_A_BASE, LSIO__MU12_A_BASE, LSIO__MU13_A_BASE, LSIO__MU5_B_BASE, LSIO__MU6_B_BASE, LSIO__MU7_B_BASE, LSIO__MU8_B_BASE, LSIO__MU9_B_BASE, LSIO__MU10_B_BASE, LSIO__MU11_B_BASE, LSIO__MU12_B_BASE, LSIO__MU13_B_BASE }
+/** Array initializer of MU peripheral base pointers */
+#define MU_BASE_PTRS                             { CM4_0__MU0_B0, CM4_0__MU0_B1, CM4_0__MU0_B2, CM4_0__MU0_B3, CM4_0__MU0_A0, CM4_0__MU0_A1, CM4_0__MU0_A2, CM4_0__MU0_A3, CM4_0__MU1_A, CM4_1__MU0_B0, CM4_1__MU0_B1, CM4_1__MU0_B2, CM4_1__MU0_B3, CM4_1__MU0_A0, CM4_1__MU0_A1, CM4_1__MU0_A2, CM4_1__MU0_A3, CM4_1__MU1_A, LSIO__MU0_A, LSIO__MU1_A, LSIO__MU2_A, LSIO__MU3_A, LSIO__MU4_A, LSIO__MU5_A, LSIO__MU6_A, LSIO__MU7_A, LSIO__MU8_A, LSIO__MU9_A, LSIO__MU10_A, LSIO__MU11_A, LSIO__MU12_A, LSIO__MU13_A, LSIO__MU5_B, LSIO__MU6_B, LSIO__MU7_B, LSIO__MU8_B, LSIO__MU9_B, LSIO__MU10_B, LSIO__MU11_B, LSIO__MU12_B, LSIO__MU13_B }
+
+/*!
+ * @}
+ */ /* end of group MU_Peripheral_Access_Layer */
+
+
+/* ----------------------------------------------------------------------------
+   -- WDOG Peripheral Access Layer
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup WDOG_Peripheral_Access_Layer WDOG Peripheral Access Layer
+ * @{
+ */
+
+/** WDOG - Register Layout Typedef */
+typedef struct {
+  __IO uint32_t CS;                                /**< Watchdog Control and Status Register, offset: 0x0 */
+  __IO uint32_t CNT;                               /**< Watchdog Counter Register, offset: 0x4 */
+  __IO uint32_t TOVAL;                             /**< Watchdog Timeout Value Register, offset: 0x8 */
+  __IO uint32_t WIN;                               /**< Watchdog Window Register, offset: 0xC */
+} WDOG_Type;
+
+/* ----------------------------------------------------------------------------
+   -- WDOG Register Masks
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup WDOG_Register_Masks WDOG Register Masks
+ * @{
+ */
+
+/*! @name CS */
+/*! @{ */
+#define WDOG_CS_STOP_MASK                               (0x1U)
+#define WDOG_CS_STOP_SHIFT                              (0U)
+#define WDOG_CS_STOP(x)                                 (((uint32_t)(((uint32_t)(x)) << WDOG_CS_STOP_SHIFT)) & WDOG_CS_STOP_MASK)
+#define WDOG_CS_WAIT_MASK                               (0x2U)
+#define WDOG_CS_WAIT_SHIFT                              (1U)
+#define WDOG_CS_WAIT(x)                                 (((uint32_t)(((uint32_t)(x)) << WDOG_CS_WAIT_SHIFT)) & WDOG_CS_WAIT_MASK)
+#define WDOG_CS_DBG_MASK                                (0x4U)
+#define WDOG_CS_DBG_SHIFT                               (2U)
+#define WDOG_CS_DBG(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_DBG_SHIFT)) & WDOG_CS_DBG_MASK)
+#define WDOG_CS_TST_MASK                                (0x18U)
+#define WDOG_CS_TST_SHIFT                               (3U)
+#define WDOG_CS_TST(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_TST_SHIFT)) & WDOG_CS_TST_MASK)
+#define WDOG_CS_UPDATE_MASK                             (0x20U)
+#define WDOG_CS_UPDATE_SHIFT                            (5U)
+#define WDOG_CS_UPDATE(x)                               (((uint32_t)(((uint32_t)(x)) << WDOG_CS_UPDATE_SHIFT)) & WDOG_CS_UPDATE_MASK)
+#define WDOG_CS_INT_MASK                                (0x40U)
+#define WDOG_CS_INT_SHIFT                               (6U)
+#define WDOG_CS_INT(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_INT_SHIFT)) & WDOG_CS_INT_MASK)
+#define WDOG_CS_EN_MASK                                 (0x80U)
+#define WDOG_CS_EN_SHIFT                                (7U)
+#define WDOG_CS_EN(x)                                   (((uint32_t)(((uint32_t)(x)) << WDOG_CS_EN_SHIFT)) & WDOG_CS_EN_MASK)
+#define WDOG_CS_CLK_MASK                                (0x300U)
+#define WDOG_CS_CLK_SHIFT                               (8U)
+#define WDOG_CS_CLK(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_CLK_SHIFT)) & WDOG_CS_CLK_MASK)
+#define WDOG_CS_RCS_MASK                                (0x400U)
+#define WDOG_CS_RCS_SHIFT                               (10U)
+#define WDOG_CS_RCS(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_RCS_SHIFT)) & WDOG_CS_RCS_MASK)
+#define WDOG_CS_ULK_MASK                                (0x800U)
+#define WDOG_CS_ULK_SHIFT                               (11U)
+#define WDOG_CS_ULK(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_ULK_SHIFT)) & WDOG_CS_ULK_MASK)
+#define WDOG_CS_PRES_MASK                               (0x1000U)
+#define WDOG_CS_PRES_SHIFT                              (12U)
+#define WDOG_CS_PRES(x)                                 (((uint32_t)(((uint32_t)(x)) << WDOG_CS_PRES_SHIFT)) & WDOG_CS_PRES_MASK)
+#define WDOG_CS_CMD32EN_MASK                            (0x2000U)
+#define WDOG_CS_CMD32EN_SHIFT                           (13U)
+#define WDOG_CS_CMD32EN(x)                              (((uint32_t)(((uint32_t)(x)) << WDOG_CS_CMD32EN_SHIFT)) & WDOG_CS_CMD32EN_MASK)
+#define WDOG_CS_FLG_MASK                                (0x4000U)
+#define WDOG_CS_FLG_SHIFT                               (14U)
+#define WDOG_CS_FLG(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_FLG_SHIFT)) & WDOG_CS_FLG_MASK)
+#define WDOG_CS_WIN_MASK                                (0x8000U)
+#define WDOG_CS_WIN_SHIFT                               (15U)
+#define WDOG_CS_WIN(x)                                  (((uint32_t)(((uint32_t)(x)) << WDOG_CS_WIN_SHIFT)) & WDOG_CS_WIN_MASK)
+/*! @} */
+
+/*!
+ * @}
+ */ /* end of group WDOG_Register_Masks */
+
+/* WDOG - Peripheral instance base addresses */
+/** Peripheral CM4_0__WDOG base address */
+#define CM4_0__WDOG_BASE                                (0x41420000u)
+/** Peripheral CM4_0__WDOG base pointer */
+#define CM4_0__WDOG                                     ((WDOG_Type *)CM4_0__WDOG_BASE)
+/** Array initializer of WDOG peripheral base addresses */
+#define WDOG_BASE_ADDRS                          { CM4_0__WDOG_BASE }
+/** Array initializer of WDOG peripheral base pointers */
+#define WDOG_BASE_PTRS                           { CM4_0__WDOG }
+/* Extra definition */
+#define WDOG_UPDATE_KEY                          (0xD928C520U)
+#define WDOG_REFRESH_KEY                         (0xB480A602U)
+
+/*!
+ * @}
+ */ /* end of group WDOG_Peripheral_Access_Layer */
+
+
+/*!
+ * @}
+ */ /* end of group Peripheral_access_layer */
+
+/* ----------------------------------------------------------------------------
+   -- SDK Compatibility
+   ---------------------------------------------------------------------------- */
+
+/*!
+ * @addtogroup SDK_Compatibility_Symbols SDK Compatibility
+ * @{
+ */
+
+/* No SDK compatibility issues. */
+
+/*!
+ * @}
+ */ /* end of group SDK_Compatibility_Symbols */
+
+#endif  /* MIMX8QM6_CM4_CORE0_H_ */
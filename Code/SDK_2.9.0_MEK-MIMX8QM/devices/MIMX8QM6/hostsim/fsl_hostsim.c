@@ -0,0 +1,1307 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "fsl_hostsim.h"
+
+/*
+ * Every access of the drivers to a simulated register faults, as the driver view of the region has no
+ * access. The SIGSEGV handler gives the model the chance to refresh the register, opens the page and
+ * sets the trap flag; the instruction runs on the shared memory and the SIGTRAP handler closes the page
+ * again, passes the access to the model, advances the simulated time and, when an interrupt became
+ * deliverable, makes the interrupted context call HOSTSIM_TrampolineEntry before its next instruction,
+ * as the core would take the exception.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#if !defined(__i386__) && !defined(__x86_64__)
+#error "The host simulation supports x86 hosts only."
+#endif
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0x100000
+#endif
+
+/* Number of exceptions: the system exceptions and the device interrupts. */
+#define HOSTSIM_EXCEPTION_COUNT (16U + HOSTSIM_IRQ_COUNT)
+#define HOSTSIM_EXCEPTION_WORDS ((HOSTSIM_EXCEPTION_COUNT + 31U) / 32U)
+
+/* Thread mode priority, lower than any exception. */
+#define HOSTSIM_THREAD_PRIORITY (256U)
+
+#define HOSTSIM_PENDSV_EXCEPTION  (14U)
+#define HOSTSIM_SYSTICK_EXCEPTION (15U)
+
+#define HOSTSIM_EFLAGS_TF (0x100U)
+#define HOSTSIM_PF_WRITE  (0x2U)
+
+#if defined(__x86_64__)
+#define HOSTSIM_REG_PC REG_RIP
+#define HOSTSIM_REG_SP REG_RSP
+/* The interrupted code may use the red zone below its stack pointer. */
+#define HOSTSIM_RED_ZONE (128U)
+#else
+#define HOSTSIM_REG_PC REG_EIP
+#define HOSTSIM_REG_SP REG_ESP
+#define HOSTSIM_RED_ZONE (0U)
+#endif
+
+/* System control space and data watchpoint unit of the Cortex-M4. */
+#define HOSTSIM_SCS_BASE (0xE000E000U)
+#define HOSTSIM_DWT_BASE (0xE0001000U)
+
+#define HOSTSIM_SYST_CSR   (0x010U)
+#define HOSTSIM_SYST_RVR   (0x014U)
+#define HOSTSIM_SYST_CVR   (0x018U)
+#define HOSTSIM_SYST_CALIB (0x01CU)
+#define HOSTSIM_NVIC_ISER  (0x100U)
+#define HOSTSIM_NVIC_ICER  (0x180U)
+#define HOSTSIM_NVIC_ISPR  (0x200U)
+#define HOSTSIM_NVIC_ICPR  (0x280U)
+#define HOSTSIM_NVIC_IABR  (0x300U)
+#define HOSTSIM_NVIC_IPR   (0x400U)
+#define HOSTSIM_NVIC_WORDS (32U)
+#define HOSTSIM_SCB_CPUID  (0xD00U)
+#define HOSTSIM_SCB_ICSR   (0xD04U)
+#define HOSTSIM_SCB_VTOR   (0xD08U)
+#define HOSTSIM_SCB_AIRCR  (0xD0CU)
+#define HOSTSIM_SCB_SHPR   (0xD18U)
+#define HOSTSIM_NVIC_STIR  (0xF00U)
+#define HOSTSIM_DWT_CTRL   (0x000U)
+#define HOSTSIM_DWT_CYCCNT (0x004U)
+
+#define HOSTSIM_SYST_CSR_ENABLE    (1U << 0U)
+#define HOSTSIM_SYST_CSR_TICKINT   (1U << 1U)
+#define HOSTSIM_SYST_CSR_CLKSOURCE (1U << 2U)
+#define HOSTSIM_SYST_CSR_COUNTFLAG (1U << 16U)
+#define HOSTSIM_SCB_ICSR_PENDSTCLR (1U << 25U)
+#define HOSTSIM_SCB_ICSR_PENDSTSET (1U << 26U)
+#define HOSTSIM_SCB_ICSR_PENDSVCLR (1U << 27U)
+#define HOSTSIM_SCB_ICSR_PENDSVSET (1U << 28U)
+#define HOSTSIM_SCB_AIRCR_SYSRESETREQ (1U << 2U)
+#define HOSTSIM_DWT_CTRL_CYCCNTENA (1U << 0U)
+#define HOSTSIM_DWT_CTRL_NUMCOMP   (4U << 28U)
+
+/* Cortex-M4 r0p1. */
+#define HOSTSIM_CPUID (0x410FC241U)
+
+/* Core clock when the system file does not define SystemCoreClock. */
+#define HOSTSIM_DEFAULT_CORE_CLOCK (264000000U)
+
+/* Stack of main() below 4 GB, as the device RAM. */
+#define HOSTSIM_MAIN_STACK_SIZE (8U * 1024U * 1024U)
+
+/* Access in flight, between the SIGSEGV and the SIGTRAP. */
+typedef struct _hostsim_trap
+{
+    hostsim_region_t *region;
+    uintptr_t page;
+    uint32_t offset;
+    uint32_t oldValue;
+    bool write;
+} hostsim_trap_t;
+
+/* Previous access, for the detection of polling loops. */
+typedef struct _hostsim_last_access
+{
+    const hostsim_region_t *region;
+    uint32_t offset;
+    uint32_t value;
+    bool write;
+} hostsim_last_access_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+void HOSTSIM_TrampolineEntry(void) __attribute__((visibility("hidden"), used));
+extern void HOSTSIM_IrqTrampoline(void) __attribute__((visibility("hidden")));
+
+static void HOSTSIM_ScsRefresh(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_ScsReadDone(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_ScsWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+static void HOSTSIM_DwtRefresh(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_DwtWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+
+#if defined(__x86_64__)
+int __real_main(int argc, char **argv);
+int __wrap_main(int argc, char **argv);
+#endif
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* Defined by the system file of the device. */
+extern uint32_t SystemCoreClock __attribute__((weak));
+
+static bool s_initialized;
+static size_t s_pageSize;
+static hostsim_region_t *s_regions;
+static hostsim_trap_t s_trap;
+static hostsim_last_access_t s_lastAccess;
+static uint64_t s_pollStepNs = HOSTSIM_ACCESS_TIME_NS;
+
+static uint64_t s_timeNs;
+static hostsim_event_t *s_events;
+
+static uint32_t s_enabled[HOSTSIM_EXCEPTION_WORDS];
+static uint32_t s_pending[HOSTSIM_EXCEPTION_WORDS];
+static uint32_t s_level[HOSTSIM_EXCEPTION_WORDS];
+static uint32_t s_active[HOSTSIM_EXCEPTION_WORDS];
+static uint8_t s_priority[HOSTSIM_EXCEPTION_COUNT];
+static uint32_t s_runningPriority = HOSTSIM_THREAD_PRIORITY;
+static uint32_t s_ipsr;
+static uint32_t s_primask;
+static uint32_t s_basepri;
+static bool s_exclusive;
+static bool s_wfiWarned;
+
+#if defined(__x86_64__)
+static ucontext_t s_mainContext;
+static ucontext_t s_hostContext;
+static int s_mainArgc;
+static char **s_mainArgv;
+static int s_mainResult;
+#endif
+
+static hostsim_region_t s_scsRegion;
+static hostsim_region_t s_dwtRegion;
+static hostsim_event_t s_systickEvent;
+static uint64_t s_systickReloadNs;
+static uint64_t s_cyccntBaseNs;
+static uint32_t s_cyccntBase;
+
+static const hostsim_region_ops_t s_scsOps = {
+    .refresh  = HOSTSIM_ScsRefresh,
+    .readDone = HOSTSIM_ScsReadDone,
+    .write    = HOSTSIM_ScsWrite,
+};
+
+static const hostsim_region_ops_t s_dwtOps = {
+    .refresh  = HOSTSIM_DwtRefresh,
+    .readDone = NULL,
+    .write    = HOSTSIM_DwtWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void HOSTSIM_Log(const char *format, va_list args)
+{
+    char message[256];
+    int length;
+
+    /* May run in the trap handlers: format on the stack and write(2) the result. */
+    length = vsnprintf(message, sizeof(message) - 1U, format, args);
+    if (length < 0)
+    {
+        return;
+    }
+    if ((size_t)length > (sizeof(message) - 2U))
+    {
+        length = (int)(sizeof(message) - 2U);
+    }
+    message[length++] = '\n';
+    (void)write(STDERR_FILENO, "hostsim: ", 9U);
+    (void)write(STDERR_FILENO, message, (size_t)length);
+}
+
+static void HOSTSIM_Warn(const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    HOSTSIM_Log(format, args);
+    va_end(args);
+}
+
+void HOSTSIM_Fatal(const char *format, ...)
+{
+    va_list args;
+
+    va_start(args, format);
+    HOSTSIM_Log(format, args);
+    va_end(args);
+    abort();
+}
+
+static inline bool HOSTSIM_BitGet(const uint32_t *map, uint32_t index)
+{
+    return (map[index / 32U] & (1U << (index % 32U))) != 0U;
+}
+
+static inline void HOSTSIM_BitSet(uint32_t *map, uint32_t index)
+{
+    map[index / 32U] |= 1U << (index % 32U);
+}
+
+static inline void HOSTSIM_BitClear(uint32_t *map, uint32_t index)
+{
+    map[index / 32U] &= ~(1U << (index % 32U));
+}
+
+static uint32_t HOSTSIM_GetCoreClock(void)
+{
+    if ((&SystemCoreClock != NULL) && (SystemCoreClock != 0U))
+    {
+        return SystemCoreClock;
+    }
+    return HOSTSIM_DEFAULT_CORE_CLOCK;
+}
+
+static uint64_t HOSTSIM_CyclesToNs(uint64_t cycles)
+{
+    return (cycles * 1000000000ULL) / HOSTSIM_GetCoreClock();
+}
+
+static uint64_t HOSTSIM_NsToCycles(uint64_t ns)
+{
+    return (ns * HOSTSIM_GetCoreClock()) / 1000000000ULL;
+}
+
+/* ---------------------------------------------------------------------------------------------------
+ * Simulated time
+ * ------------------------------------------------------------------------------------------------- */
+
+uint64_t HOSTSIM_GetTimeNs(void)
+{
+    return s_timeNs;
+}
+
+void HOSTSIM_EventCancel(hostsim_event_t *event)
+{
+    hostsim_event_t **link;
+
+    if (!event->scheduled)
+    {
+        return;
+    }
+    for (link = &s_events; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == event)
+        {
+            *link = event->next;
+            break;
+        }
+    }
+    event->next      = NULL;
+    event->scheduled = false;
+}
+
+void HOSTSIM_EventSchedule(hostsim_event_t *event, uint64_t delayNs, hostsim_event_callback_t callback, void *param)
+{
+    hostsim_event_t **link;
+
+    HOSTSIM_EventCancel(event);
+
+    event->dueNs    = s_timeNs + delayNs;
+    event->callback = callback;
+    event->param    = param;
+
+    /* Events due at the same time run in the order they were scheduled. */
+    link = &s_events;
+    while ((*link != NULL) && ((*link)->dueNs <= event->dueNs))
+    {
+        link = &(*link)->next;
+    }
+    event->next      = *link;
+    *link            = event;
+    event->scheduled = true;
+}
+
+static void HOSTSIM_AdvanceTo(uint64_t timeNs)
+{
+    hostsim_event_t *event;
+
+    while ((s_events != NULL) && (s_events->dueNs <= timeNs))
+    {
+        event            = s_events;
+        s_events         = event->next;
+        event->next      = NULL;
+        event->scheduled = false;
+        if (event->dueNs > s_timeNs)
+        {
+            s_timeNs = event->dueNs;
+        }
+        event->callback(event->param);
+    }
+    if (timeNs > s_timeNs)
+    {
+        s_timeNs = timeNs;
+    }
+}
+
+/* Charges the time of a register access, stepping faster through polling loops. */
+static void HOSTSIM_AccountAccess(hostsim_region_t *region, uint32_t offset, uint32_t value, bool write)
+{
+    uint64_t stepNs = HOSTSIM_ACCESS_TIME_NS;
+
+    if ((!write) && (!s_lastAccess.write) && (region == s_lastAccess.region) && (offset == s_lastAccess.offset) &&
+        ((value == s_lastAccess.value) || ((region->flags & (uint32_t)kHOSTSIM_RegionFlagClock) != 0U)))
+    {
+        s_pollStepNs *= 2U;
+        if (s_pollStepNs > HOSTSIM_POLL_STEP_MAX_NS)
+        {
+            s_pollStepNs = HOSTSIM_POLL_STEP_MAX_NS;
+        }
+        stepNs = s_pollStepNs;
+        if ((s_events != NULL) && (s_events->dueNs > s_timeNs) && ((s_events->dueNs - s_timeNs) < stepNs))
+        {
+            stepNs = s_events->dueNs - s_timeNs;
+        }
+    }
+    else
+    {
+        s_pollStepNs = HOSTSIM_ACCESS_TIME_NS;
+    }
+
+    s_lastAccess.region = region;
+    s_lastAccess.offset = offset;
+    s_lastAccess.value  = value;
+    s_lastAccess.write  = write;
+
+    HOSTSIM_AdvanceTo(s_timeNs + stepNs);
+}
+
+/* ---------------------------------------------------------------------------------------------------
+ * Exceptions
+ * ------------------------------------------------------------------------------------------------- */
+
+/* Highest priority exception pending, ignoring PRIMASK, or -1. */
+static int32_t HOSTSIM_NextException(void)
+{
+    uint32_t limit = s_runningPriority;
+    uint32_t word;
+    uint32_t bits;
+    uint32_t index;
+    int32_t next = -1;
+
+    if ((s_basepri != 0U) && (s_basepri < limit))
+    {
+        limit = s_basepri;
+    }
+
+    for (word = 0U; word < HOSTSIM_EXCEPTION_WORDS; word++)
+    {
+        bits = (s_pending[word] | s_level[word]) & s_enabled[word] & ~s_active[word];
+        while (bits != 0U)
+        {
+            index = (word * 32U) + (uint32_t)__builtin_ctz(bits);
+            bits &= bits - 1U;
+            /* Strictly higher priority; at equal priority the lower exception number comes first. */
+            if ((uint32_t)s_priority[index] < limit)
+            {
+                limit = s_priority[index];
+                next  = (int32_t)index;
+            }
+        }
+    }
+
+    return next;
+}
+
+hostsim_handler_t __attribute__((weak)) HOSTSIM_GetVector(uint32_t exception)
+{
+    const uint32_t *table = (const uint32_t *)(uintptr_t)HOSTSIM_Read32(&s_scsRegion, HOSTSIM_SCB_VTOR);
+
+    if (table == NULL)
+    {
+        return NULL;
+    }
+    return (hostsim_handler_t)(uintptr_t)table[exception];
+}
+
+static void HOSTSIM_EnterException(uint32_t exception)
+{
+    uint32_t runningPriority = s_runningPriority;
+    uint32_t ipsr            = s_ipsr;
+    hostsim_handler_t handler;
+
+    HOSTSIM_BitClear(s_pending, exception);
+    HOSTSIM_BitSet(s_active, exception);
+    s_runningPriority = s_priority[exception];
+    s_ipsr            = exception;
+    s_exclusive       = false;
+
+    handler = HOSTSIM_GetVector(exception);
+    if (handler == NULL)
+    {
+        HOSTSIM_Fatal("no handler for exception %u (IRQ %d)", (unsigned)exception, (int)exception - 16);
+    }
+    handler();
+
+    HOSTSIM_BitClear(s_active, exception);
+    s_runningPriority = runningPriority;
+    s_ipsr            = ipsr;
+    s_exclusive       = false;
+}
+
+/* Takes the exceptions deliverable now. Returns true if any was taken. */
+static bool HOSTSIM_TakeExceptions(void)
+{
+    bool taken = false;
+    int32_t exception;
+
+    while (s_primask == 0U)
+    {
+        exception = HOSTSIM_NextException();
+        if (exception < 0)
+        {
+            break;
+        }
+        HOSTSIM_EnterException((uint32_t)exception);
+        taken = true;
+    }
+
+    return taken;
+}
+
+void HOSTSIM_TrampolineEntry(void)
+{
+    (void)HOSTSIM_TakeExceptions();
+}
+
+void HOSTSIM_SetIrqLevel(int32_t irq, bool asserted)
+{
+    uint32_t exception = (uint32_t)(irq + 16);
+
+    if ((irq < 0) || (exception >= HOSTSIM_EXCEPTION_COUNT))
+    {
+        return;
+    }
+    if (asserted)
+    {
+        HOSTSIM_BitSet(s_level, exception);
+    }
+    else
+    {
+        HOSTSIM_BitClear(s_level, exception);
+    }
+}
+
+void HOSTSIM_PendIrq(int32_t irq)
+{
+    uint32_t exception = (uint32_t)(irq + 16);
+
+    if ((irq >= 0) && (exception < HOSTSIM_EXCEPTION_COUNT))
+    {
+        HOSTSIM_BitSet(s_pending, exception);
+    }
+}
+
+uint32_t HOSTSIM_GetPrimask(void)
+{
+    return s_primask;
+}
+
+void HOSTSIM_SetPrimask(uint32_t primask)
+{
+    s_primask = primask & 1U;
+    (void)HOSTSIM_TakeExceptions();
+}
+
+uint32_t HOSTSIM_GetBasepri(void)
+{
+    return s_basepri;
+}
+
+void HOSTSIM_SetBasepri(uint32_t basepri)
+{
+    s_basepri = basepri & 0xFFU;
+    (void)HOSTSIM_TakeExceptions();
+}
+
+uint32_t HOSTSIM_GetIpsr(void)
+{
+    return s_ipsr;
+}
+
+void HOSTSIM_WaitForInterrupt(void)
+{
+    for (;;)
+    {
+        /* An exception masked by PRIMASK still wakes the core up. */
+        if (HOSTSIM_TakeExceptions() || (HOSTSIM_NextException() >= 0))
+        {
+            return;
+        }
+        if (s_events == NULL)
+        {
+            if (!s_wfiWarned)
+            {
+                HOSTSIM_Warn("WFI with no event scheduled, nothing can wake the core up");
+                s_wfiWarned = true;
+            }
+            return;
+        }
+        HOSTSIM_AdvanceTo(s_events->dueNs);
+    }
+}
+
+void HOSTSIM_ExclusiveLoad(void)
+{
+    s_exclusive = true;
+}
+
+bool HOSTSIM_ExclusiveStore(void)
+{
+    bool exclusive = s_exclusive;
+
+    s_exclusive = false;
+    return exclusive;
+}
+
+void HOSTSIM_ExclusiveClear(void)
+{
+    s_exclusive = false;
+}
+
+void HOSTSIM_Run(uint64_t durationNs)
+{
+    uint64_t endNs = s_timeNs + durationNs;
+
+    (void)HOSTSIM_TakeExceptions();
+    while ((s_events != NULL) && (s_events->dueNs <= endNs))
+    {
+        HOSTSIM_AdvanceTo(s_events->dueNs);
+        (void)HOSTSIM_TakeExceptions();
+    }
+    HOSTSIM_AdvanceTo(endNs);
+}
+
+bool HOSTSIM_RunNextEvent(void)
+{
+    if (s_events == NULL)
+    {
+        return false;
+    }
+    HOSTSIM_AdvanceTo(s_events->dueNs);
+    (void)HOSTSIM_TakeExceptions();
+    return true;
+}
+
+/* ---------------------------------------------------------------------------------------------------
+ * System control space: NVIC, SysTick, SCB
+ * ------------------------------------------------------------------------------------------------- */
+
+static uint64_t HOSTSIM_SystickPeriodNs(void)
+{
+    uint64_t cycles = (uint64_t)(HOSTSIM_Read32(&s_scsRegion, HOSTSIM_SYST_RVR) & 0xFFFFFFU) + 1U;
+    uint64_t periodNs;
+
+    /* The external reference clock is not modelled, both sources count the core clock. */
+    periodNs = HOSTSIM_CyclesToNs(cycles);
+    return (periodNs == 0U) ? 1U : periodNs;
+}
+
+static void HOSTSIM_SystickWrap(void *param)
+{
+    uint32_t csr = HOSTSIM_Read32(&s_scsRegion, HOSTSIM_SYST_CSR);
+
+    (void)param;
+    if ((csr & HOSTSIM_SYST_CSR_ENABLE) == 0U)
+    {
+        return;
+    }
+    HOSTSIM_Write32(&s_scsRegion, HOSTSIM_SYST_CSR, csr | HOSTSIM_SYST_CSR_COUNTFLAG);
+    if ((csr & HOSTSIM_SYST_CSR_TICKINT) != 0U)
+    {
+        HOSTSIM_BitSet(s_pending, HOSTSIM_SYSTICK_EXCEPTION);
+    }
+    s_systickReloadNs = s_timeNs;
+    HOSTSIM_EventSchedule(&s_systickEvent, HOSTSIM_SystickPeriodNs(), HOSTSIM_SystickWrap, NULL);
+}
+
+static void HOSTSIM_SystickRestart(void)
+{
+    s_systickReloadNs = s_timeNs;
+    if ((HOSTSIM_Read32(&s_scsRegion, HOSTSIM_SYST_CSR) & HOSTSIM_SYST_CSR_ENABLE) != 0U)
+    {
+        HOSTSIM_EventSchedule(&s_systickEvent, HOSTSIM_SystickPeriodNs(), HOSTSIM_SystickWrap, NULL);
+    }
+    else
+    {
+        HOSTSIM_EventCancel(&s_systickEvent);
+    }
+}
+
+/* NVIC register of 32 interrupt lines, from one of the exception bitmaps. */
+static uint32_t HOSTSIM_NvicWord(const uint32_t *map, uint32_t word)
+{
+    uint32_t value = 0U;
+    uint32_t bit;
+    uint32_t exception;
+
+    for (bit = 0U; bit < 32U; bit++)
+    {
+        exception = 16U + (word * 32U) + bit;
+        if ((exception < HOSTSIM_EXCEPTION_COUNT) && HOSTSIM_BitGet(map, exception))
+        {
+            value |= 1U << bit;
+        }
+    }
+    return value;
+}
+
+static void HOSTSIM_NvicUpdate(uint32_t *map, uint32_t word, uint32_t bits, bool set)
+{
+    uint32_t bit;
+    uint32_t exception;
+
+    for (bit = 0U; bit < 32U; bit++)
+    {
+        exception = 16U + (word * 32U) + bit;
+        if (((bits & (1U << bit)) == 0U) || (exception >= HOSTSIM_EXCEPTION_COUNT))
+        {
+            continue;
+        }
+        if (set)
+        {
+            HOSTSIM_BitSet(map, exception);
+        }
+        else
+        {
+            HOSTSIM_BitClear(map, exception);
+        }
+    }
+}
+
+static uint32_t HOSTSIM_NvicPendingWord(uint32_t word)
+{
+    uint32_t levels[HOSTSIM_EXCEPTION_WORDS];
+    uint32_t i;
+
+    for (i = 0U; i < HOSTSIM_EXCEPTION_WORDS; i++)
+    {
+        levels[i] = s_pending[i] | s_level[i];
+    }
+    return HOSTSIM_NvicWord(levels, word);
+}
+
+static void HOSTSIM_ScsRefresh(hostsim_region_t *region, uint32_t offset)
+{
+    uint64_t elapsed;
+    uint32_t reload;
+    uint32_t word;
+    uint32_t value;
+    int32_t next;
+
+    if (offset == HOSTSIM_SYST_CVR)
+    {
+        value = 0U;
+        if ((HOSTSIM_Read32(region, HOSTSIM_SYST_CSR) & HOSTSIM_SYST_CSR_ENABLE) != 0U)
+        {
+            reload  = HOSTSIM_Read32(region, HOSTSIM_SYST_RVR) & 0xFFFFFFU;
+            elapsed = HOSTSIM_NsToCycles(s_timeNs - s_systickReloadNs);
+            value   = (elapsed >= reload) ? 0U : (uint32_t)(reload - elapsed);
+        }
+        HOSTSIM_Write32(region, offset, value);
+    }
+    else if ((offset >= HOSTSIM_NVIC_ISER) && (offset < (HOSTSIM_NVIC_IPR)))
+    {
+        word = (offset % (HOSTSIM_NVIC_WORDS * 4U)) / 4U;
+        switch ((offset - HOSTSIM_NVIC_ISER) / (HOSTSIM_NVIC_WORDS * 4U))
+        {
+            case 0U: /* ISER */
+            case 1U: /* ICER */
+                value = HOSTSIM_NvicWord(s_enabled, word);
+                break;
+            case 2U: /* ISPR */
+            case 3U: /* ICPR */
+                value = HOSTSIM_NvicPendingWord(word);
+                break;
+            default: /* IABR */
+                value = HOSTSIM_NvicWord(s_active, word);
+                break;
+        }
+        HOSTSIM_Write32(region, offset, value);
+    }
+    else if (offset == HOSTSIM_SCB_ICSR)
+    {
+        value = HOSTSIM_Read32(region, offset) & ~0x007FF1FFU;
+        value |= s_ipsr & 0x1FFU;
+        next = HOSTSIM_NextException();
+        if (next >= 0)
+        {
+            value |= ((uint32_t)next & 0x1FFU) << 12U;
+            value |= (1U << 22U);
+        }
+        value &= ~(HOSTSIM_SCB_ICSR_PENDSVSET | HOSTSIM_SCB_ICSR_PENDSTSET);
+        if (HOSTSIM_BitGet(s_pending, HOSTSIM_PENDSV_EXCEPTION))
+        {
+            value |= HOSTSIM_SCB_ICSR_PENDSVSET;
+        }
+        if (HOSTSIM_BitGet(s_pending, HOSTSIM_SYSTICK_EXCEPTION))
+        {
+            value |= HOSTSIM_SCB_ICSR_PENDSTSET;
+        }
+        HOSTSIM_Write32(region, offset, value);
+    }
+    else
+    {
+        /* The other registers hold their value. */
+    }
+}
+
+static void HOSTSIM_ScsReadDone(hostsim_region_t *region, uint32_t offset)
+{
+    /* COUNTFLAG clears on read. */
+    if (offset == HOSTSIM_SYST_CSR)
+    {
+        HOSTSIM_Write32(region, offset, HOSTSIM_Read32(region, offset) & ~HOSTSIM_SYST_CSR_COUNTFLAG);
+    }
+}
+
+static void HOSTSIM_ScsWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    uint32_t word;
+    uint32_t i;
+
+    if (offset == HOSTSIM_SYST_CSR)
+    {
+        newValue = (newValue & (HOSTSIM_SYST_CSR_ENABLE | HOSTSIM_SYST_CSR_TICKINT | HOSTSIM_SYST_CSR_CLKSOURCE)) |
+                   (oldValue & HOSTSIM_SYST_CSR_COUNTFLAG);
+        HOSTSIM_Write32(region, offset, newValue);
+        if (((oldValue ^ newValue) & HOSTSIM_SYST_CSR_ENABLE) != 0U)
+        {
+            HOSTSIM_SystickRestart();
+        }
+    }
+    else if (offset == HOSTSIM_SYST_CVR)
+    {
+        /* Any write clears the counter and COUNTFLAG, the count restarts from the reload value. */
+        HOSTSIM_Write32(region, offset, 0U);
+        HOSTSIM_Write32(region, HOSTSIM_SYST_CSR,
+                        HOSTSIM_Read32(region, HOSTSIM_SYST_CSR) & ~HOSTSIM_SYST_CSR_COUNTFLAG);
+        HOSTSIM_SystickRestart();
+    }
+    else if ((offset == HOSTSIM_SYST_CALIB) || (offset == HOSTSIM_SCB_CPUID))
+    {
+        HOSTSIM_Write32(region, offset, oldValue);
+    }
+    else if ((offset >= HOSTSIM_NVIC_ISER) && (offset < HOSTSIM_NVIC_IPR))
+    {
+        word = (offset % (HOSTSIM_NVIC_WORDS * 4U)) / 4U;
+        switch ((offset - HOSTSIM_NVIC_ISER) / (HOSTSIM_NVIC_WORDS * 4U))
+        {
+            case 0U:
+                HOSTSIM_NvicUpdate(s_enabled, word, newValue, true);
+                break;
+            case 1U:
+                HOSTSIM_NvicUpdate(s_enabled, word, newValue, false);
+                break;
+            case 2U:
+                HOSTSIM_NvicUpdate(s_pending, word, newValue, true);
+                break;
+            case 3U:
+                /* A line still asserted stays pending. */
+                HOSTSIM_NvicUpdate(s_pending, word, newValue, false);
+                break;
+            default:
+                break;
+        }
+        HOSTSIM_ScsRefresh(region, offset);
+    }
+    else if ((offset >= HOSTSIM_NVIC_IPR) && (offset < (HOSTSIM_NVIC_IPR + HOSTSIM_IRQ_COUNT)))
+    {
+        for (i = 0U; i < 4U; i++)
+        {
+            if ((offset - HOSTSIM_NVIC_IPR + i) < HOSTSIM_IRQ_COUNT)
+            {
+                s_priority[16U + offset - HOSTSIM_NVIC_IPR + i] = (uint8_t)(newValue >> (8U * i));
+            }
+        }
+    }
+    else if (offset == HOSTSIM_SCB_ICSR)
+    {
+        if ((newValue & HOSTSIM_SCB_ICSR_PENDSVSET) != 0U)
+        {
+            HOSTSIM_BitSet(s_pending, HOSTSIM_PENDSV_EXCEPTION);
+        }
+        if ((newValue & HOSTSIM_SCB_ICSR_PENDSVCLR) != 0U)
+        {
+            HOSTSIM_BitClear(s_pending, HOSTSIM_PENDSV_EXCEPTION);
+        }
+        if ((newValue & HOSTSIM_SCB_ICSR_PENDSTSET) != 0U)
+        {
+            HOSTSIM_BitSet(s_pending, HOSTSIM_SYSTICK_EXCEPTION);
+        }
+        if ((newValue & HOSTSIM_SCB_ICSR_PENDSTCLR) != 0U)
+        {
+            HOSTSIM_BitClear(s_pending, HOSTSIM_SYSTICK_EXCEPTION);
+        }
+        HOSTSIM_ScsRefresh(region, offset);
+    }
+    else if (offset == HOSTSIM_SCB_AIRCR)
+    {
+        if (((newValue >> 16U) == 0x05FAU) && ((newValue & HOSTSIM_SCB_AIRCR_SYSRESETREQ) != 0U))
+        {
+            HOSTSIM_Warn("system reset requested at %llu ns", (unsigned long long)s_timeNs);
+            exit(EXIT_SUCCESS);
+        }
+        HOSTSIM_Write32(region, offset, (0xFA05U << 16U) | (newValue & 0xFFFFU));
+    }
+    else if ((offset >= HOSTSIM_SCB_SHPR) && (offset < (HOSTSIM_SCB_SHPR + 12U)))
+    {
+        for (i = 0U; i < 4U; i++)
+        {
+            s_priority[4U + offset - HOSTSIM_SCB_SHPR + i] = (uint8_t)(newValue >> (8U * i));
+        }
+    }
+    else if (offset == HOSTSIM_NVIC_STIR)
+    {
+        HOSTSIM_PendIrq((int32_t)(newValue & 0x1FFU));
+        HOSTSIM_Write32(region, offset, 0U);
+    }
+    else
+    {
+        /* The other registers hold the value written. */
+    }
+}
+
+static void HOSTSIM_DwtRefresh(hostsim_region_t *region, uint32_t offset)
+{
+    uint32_t cycles = s_cyccntBase;
+
+    if (offset == HOSTSIM_DWT_CYCCNT)
+    {
+        if ((HOSTSIM_Read32(region, HOSTSIM_DWT_CTRL) & HOSTSIM_DWT_CTRL_CYCCNTENA) != 0U)
+        {
+            cycles += (uint32_t)HOSTSIM_NsToCycles(s_timeNs - s_cyccntBaseNs);
+        }
+        HOSTSIM_Write32(region, offset, cycles);
+    }
+}
+
+static void HOSTSIM_DwtWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    if (offset == HOSTSIM_DWT_CTRL)
+    {
+        /* NUMCOMP and NOCYCCNT are read-only. */
+        HOSTSIM_Write32(region, offset, (newValue & 0x0FFFFFFFU) | HOSTSIM_DWT_CTRL_NUMCOMP);
+        if (((oldValue ^ newValue) & HOSTSIM_DWT_CTRL_CYCCNTENA) != 0U)
+        {
+            HOSTSIM_DwtRefresh(region, HOSTSIM_DWT_CYCCNT);
+            s_cyccntBase   = HOSTSIM_Read32(region, HOSTSIM_DWT_CYCCNT);
+            s_cyccntBaseNs = s_timeNs;
+        }
+    }
+    else if (offset == HOSTSIM_DWT_CYCCNT)
+    {
+        s_cyccntBase   = newValue;
+        s_cyccntBaseNs = s_timeNs;
+    }
+    else
+    {
+        /* The comparators are not modelled. */
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------------
+ * Register regions and traps
+ * ------------------------------------------------------------------------------------------------- */
+
+static hostsim_region_t *HOSTSIM_FindRegion(uintptr_t address)
+{
+    hostsim_region_t *region;
+
+    for (region = s_regions; region != NULL; region = region->next)
+    {
+        if ((address >= region->base) && ((address - region->base) < region->size))
+        {
+            return region;
+        }
+    }
+    return NULL;
+}
+
+void HOSTSIM_RegionInit(hostsim_region_t *region,
+                        const char *name,
+                        uintptr_t base,
+                        size_t size,
+                        const hostsim_region_ops_t *ops,
+                        void *model)
+{
+    void *driverView;
+    void *modelView;
+    int fd;
+
+    HOSTSIM_Init();
+
+    if ((base % s_pageSize) != 0U)
+    {
+        HOSTSIM_Fatal("%s: base 0x%08lx is not page aligned", name, (unsigned long)base);
+    }
+    size = (size + s_pageSize - 1U) & ~(s_pageSize - 1U);
+
+    fd = memfd_create(name, MFD_CLOEXEC);
+    if ((fd < 0) || (ftruncate(fd, (off_t)size) != 0))
+    {
+        HOSTSIM_Fatal("%s: cannot create the registers: %s", name, strerror(errno));
+    }
+
+    driverView = mmap((void *)base, size, PROT_NONE, MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+    if (driverView != (void *)base)
+    {
+        HOSTSIM_Fatal("%s: cannot map the registers at 0x%08lx, the address is in use", name, (unsigned long)base);
+    }
+    modelView = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (modelView == MAP_FAILED)
+    {
+        HOSTSIM_Fatal("%s: cannot map the model view: %s", name, strerror(errno));
+    }
+    (void)close(fd);
+
+    region->name  = name;
+    region->base  = base;
+    region->size  = size;
+    region->regs  = (volatile uint8_t *)modelView;
+    region->ops   = ops;
+    region->model = model;
+    region->next  = s_regions;
+    s_regions     = region;
+}
+
+/* Maps the page of an unmodelled peripheral as plain memory. */
+static bool HOSTSIM_MapUnmodelled(uintptr_t address)
+{
+    uintptr_t page = address & ~(uintptr_t)(s_pageSize - 1U);
+
+    if ((address < HOSTSIM_UNMODELLED_BEGIN) || (address >= HOSTSIM_UNMODELLED_END))
+    {
+        return false;
+    }
+    return mmap((void *)page, s_pageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE,
+                -1, 0) == (void *)page;
+}
+
+/* Copies between a buffer and the registers of a region, word by word, with the side effects of the access. */
+static void HOSTSIM_BusAccessRegion(hostsim_region_t *region, uint32_t offset, uint8_t *data, size_t size, bool write)
+{
+    uint32_t word;
+    uint32_t oldValue;
+    size_t count;
+
+    while (size != 0U)
+    {
+        word  = offset & ~3U;
+        count = 4U - (offset - word);
+        if (count > size)
+        {
+            count = size;
+        }
+        if ((region->ops != NULL) && (region->ops->refresh != NULL))
+        {
+            region->ops->refresh(region, word);
+        }
+        oldValue = HOSTSIM_Read32(region, word);
+        if (write)
+        {
+            (void)memcpy((void *)(uintptr_t)(region->regs + offset), data, count);
+            if ((region->ops != NULL) && (region->ops->write != NULL))
+            {
+                region->ops->write(region, word, oldValue, HOSTSIM_Read32(region, word));
+            }
+        }
+        else
+        {
+            (void)memcpy(data, (const void *)(uintptr_t)(region->regs + offset), count);
+            if ((region->ops != NULL) && (region->ops->readDone != NULL))
+            {
+                region->ops->readDone(region, word);
+            }
+        }
+        offset += (uint32_t)count;
+        data += count;
+        size -= count;
+    }
+}
+
+static void HOSTSIM_BusAccess(uintptr_t address, uint8_t *data, size_t size, bool write)
+{
+    hostsim_region_t *region = HOSTSIM_FindRegion(address);
+
+    if (region != NULL)
+    {
+        HOSTSIM_BusAccessRegion(region, (uint32_t)(address - region->base), data, size, write);
+        return;
+    }
+    (void)HOSTSIM_MapUnmodelled(address);
+    if (write)
+    {
+        (void)memcpy((void *)address, data, size);
+    }
+    else
+    {
+        (void)memcpy(data, (const void *)address, size);
+    }
+}
+
+void HOSTSIM_BusRead(uintptr_t address, void *data, size_t size)
+{
+    HOSTSIM_BusAccess(address, (uint8_t *)data, size, false);
+}
+
+void HOSTSIM_BusWrite(uintptr_t address, const void *data, size_t size)
+{
+    HOSTSIM_BusAccess(address, (uint8_t *)(uintptr_t)data, size, true);
+}
+
+static void HOSTSIM_DefaultSignal(int signal)
+{
+    struct sigaction action;
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_DFL;
+    (void)sigaction(signal, &action, NULL);
+}
+
+static void HOSTSIM_SegvHandler(int signal, siginfo_t *info, void *context)
+{
+    ucontext_t *uc    = (ucontext_t *)context;
+    uintptr_t address = (uintptr_t)info->si_addr;
+    uintptr_t page    = address & ~(uintptr_t)(s_pageSize - 1U);
+    hostsim_region_t *region;
+
+    region = HOSTSIM_FindRegion(address);
+    if ((region == NULL) || (s_trap.region != NULL))
+    {
+        if ((region == NULL) && HOSTSIM_MapUnmodelled(address))
+        {
+            /* Unmodelled peripheral, the instruction runs again on plain memory. */
+            return;
+        }
+        /* Not a register access: crash as without the simulation. */
+        HOSTSIM_DefaultSignal(signal);
+        return;
+    }
+
+    s_trap.region = region;
+    s_trap.page   = page;
+    s_trap.offset = (uint32_t)((address - region->base) & ~(uintptr_t)3U);
+    s_trap.write  = ((uint32_t)uc->uc_mcontext.gregs[REG_ERR] & HOSTSIM_PF_WRITE) != 0U;
+
+    /* Read-modify-write instructions fault as stores: refresh for both. */
+    if ((region->ops != NULL) && (region->ops->refresh != NULL))
+    {
+        region->ops->refresh(region, s_trap.offset);
+    }
+    s_trap.oldValue = HOSTSIM_Read32(region, s_trap.offset);
+
+    if (mprotect((void *)page, s_pageSize, PROT_READ | PROT_WRITE) != 0)
+    {
+        HOSTSIM_Fatal("%s: mprotect failed: %s", region->name, strerror(errno));
+    }
+    uc->uc_mcontext.gregs[REG_EFL] |= HOSTSIM_EFLAGS_TF;
+}
+
+static void HOSTSIM_TrapHandler(int signal, siginfo_t *info, void *context)
+{
+    ucontext_t *uc           = (ucontext_t *)context;
+    hostsim_region_t *region = s_trap.region;
+    uint32_t value;
+    uintptr_t sp;
+
+    (void)info;
+    if (region == NULL)
+    {
+        HOSTSIM_DefaultSignal(signal);
+        (void)raise(signal);
+        return;
+    }
+
+    uc->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)HOSTSIM_EFLAGS_TF;
+    (void)mprotect((void *)s_trap.page, s_pageSize, PROT_NONE);
+    s_trap.region = NULL;
+
+    value = HOSTSIM_Read32(region, s_trap.offset);
+    if (region->ops != NULL)
+    {
+        if (s_trap.write)
+        {
+            if (region->ops->write != NULL)
+            {
+                region->ops->write(region, s_trap.offset, s_trap.oldValue, value);
+            }
+        }
+        else if (region->ops->readDone != NULL)
+        {
+            region->ops->readDone(region, s_trap.offset);
+        }
+        else
+        {
+            /* Nothing to do on the read. */
+        }
+    }
+
+    HOSTSIM_AccountAccess(region, s_trap.offset, value, s_trap.write);
+
+    /* Take the interrupt before the next instruction, as the core would. */
+    if ((s_primask == 0U) && (HOSTSIM_NextException() >= 0))
+    {
+        sp = (uintptr_t)uc->uc_mcontext.gregs[HOSTSIM_REG_SP] - HOSTSIM_RED_ZONE - sizeof(uintptr_t);
+        *(uintptr_t *)sp                            = (uintptr_t)uc->uc_mcontext.gregs[HOSTSIM_REG_PC];
+        uc->uc_mcontext.gregs[HOSTSIM_REG_SP]       = (greg_t)sp;
+        uc->uc_mcontext.gregs[HOSTSIM_REG_PC]       = (greg_t)(uintptr_t)HOSTSIM_IrqTrampoline;
+    }
+}
+
+/*
+ * Calls HOSTSIM_TrampolineEntry with the whole state of the interrupted code saved: flags, scratch
+ * registers and the SSE state. The return address was pushed by the trap handler below the red zone.
+ */
+#if defined(__x86_64__)
+__asm__(
+    "    .text\n"
+    "    .p2align 4\n"
+    "    .hidden HOSTSIM_IrqTrampoline\n"
+    "    .globl HOSTSIM_IrqTrampoline\n"
+    "    .type HOSTSIM_IrqTrampoline, @function\n"
+    "HOSTSIM_IrqTrampoline:\n"
+    "    pushfq\n"
+    "    pushq %rax\n"
+    "    pushq %rcx\n"
+    "    pushq %rdx\n"
+    "    pushq %rsi\n"
+    "    pushq %rdi\n"
+    "    pushq %r8\n"
+    "    pushq %r9\n"
+    "    pushq %r10\n"
+    "    pushq %r11\n"
+    "    pushq %rbx\n"
+    "    movq %rsp, %rbx\n"
+    "    subq $512, %rsp\n"
+    "    andq $-16, %rsp\n"
+    "    fxsave (%rsp)\n"
+    "    cld\n"
+    "    call HOSTSIM_TrampolineEntry\n"
+    "    fxrstor (%rsp)\n"
+    "    movq %rbx, %rsp\n"
+    "    popq %rbx\n"
+    "    popq %r11\n"
+    "    popq %r10\n"
+    "    popq %r9\n"
+    "    popq %r8\n"
+    "    popq %rdi\n"
+    "    popq %rsi\n"
+    "    popq %rdx\n"
+    "    popq %rcx\n"
+    "    popq %rax\n"
+    "    popfq\n"
+    "    ret $128\n"
+    "    .size HOSTSIM_IrqTrampoline, . - HOSTSIM_IrqTrampoline\n");
+#else
+__asm__(
+    "    .text\n"
+    "    .p2align 4\n"
+    "    .hidden HOSTSIM_IrqTrampoline\n"
+    "    .globl HOSTSIM_IrqTrampoline\n"
+    "    .type HOSTSIM_IrqTrampoline, @function\n"
+    "HOSTSIM_IrqTrampoline:\n"
+    "    pushfl\n"
+    "    pushal\n"
+    "    movl %esp, %ebx\n"
+    "    subl $512, %esp\n"
+    "    andl $-16, %esp\n"
+    "    fxsave (%esp)\n"
+    "    cld\n"
+    "    call HOSTSIM_TrampolineEntry\n"
+    "    fxrstor (%esp)\n"
+    "    movl %ebx, %esp\n"
+    "    popal\n"
+    "    popfl\n"
+    "    ret\n"
+    "    .size HOSTSIM_IrqTrampoline, . - HOSTSIM_IrqTrampoline\n");
+#endif
+
+__attribute__((constructor(101))) void HOSTSIM_Init(void)
+{
+    struct sigaction action;
+    uint32_t exception;
+
+    if (s_initialized)
+    {
+        return;
+    }
+    s_initialized = true;
+    s_pageSize    = (size_t)sysconf(_SC_PAGESIZE);
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_flags     = SA_SIGINFO;
+    (void)sigemptyset(&action.sa_mask);
+    action.sa_sigaction = HOSTSIM_SegvHandler;
+    (void)sigaction(SIGSEGV, &action, NULL);
+    (void)sigaction(SIGBUS, &action, NULL);
+    action.sa_sigaction = HOSTSIM_TrapHandler;
+    (void)sigaction(SIGTRAP, &action, NULL);
+
+    /* The system exceptions cannot be disabled. */
+    for (exception = 1U; exception < 16U; exception++)
+    {
+        HOSTSIM_BitSet(s_enabled, exception);
+    }
+
+    HOSTSIM_RegionInit(&s_scsRegion, "SCS", HOSTSIM_SCS_BASE, 0x1000U, &s_scsOps, NULL);
+    HOSTSIM_Write32(&s_scsRegion, HOSTSIM_SCB_CPUID, HOSTSIM_CPUID);
+    HOSTSIM_Write32(&s_scsRegion, HOSTSIM_SCB_AIRCR, 0xFA05U << 16U);
+    HOSTSIM_RegionInit(&s_dwtRegion, "DWT", HOSTSIM_DWT_BASE, 0x1000U, &s_dwtOps, NULL);
+    s_dwtRegion.flags = (uint32_t)kHOSTSIM_RegionFlagClock;
+    HOSTSIM_Write32(&s_dwtRegion, HOSTSIM_DWT_CTRL, HOSTSIM_DWT_CTRL_NUMCOMP);
+}
+
+#if defined(__x86_64__)
+static void HOSTSIM_MainEntry(void)
+{
+    s_mainResult = __real_main(s_mainArgc, s_mainArgv);
+}
+
+/*
+ * The drivers pass the addresses of their locals through uint32_t, as the timing configuration of
+ * FLEXCAN_SetBaudRate(): the link wraps main(), which runs on a stack mapped below 4 GB. The interrupt
+ * handlers run on the stack of the interrupted context, so on the same one.
+ */
+int __wrap_main(int argc, char **argv)
+{
+    void *stack;
+
+    stack = mmap(NULL, HOSTSIM_MAIN_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1,
+                 0);
+    if (stack == MAP_FAILED)
+    {
+        HOSTSIM_Fatal("cannot map the stack of main(): %s", strerror(errno));
+    }
+
+    s_mainArgc = argc;
+    s_mainArgv = argv;
+    (void)getcontext(&s_mainContext);
+    s_mainContext.uc_stack.ss_sp   = stack;
+    s_mainContext.uc_stack.ss_size = HOSTSIM_MAIN_STACK_SIZE;
+    s_mainContext.uc_link          = &s_hostContext;
+    makecontext(&s_mainContext, HOSTSIM_MainEntry, 0);
+    (void)swapcontext(&s_hostContext, &s_mainContext);
+
+    return s_mainResult;
+}
+#endif
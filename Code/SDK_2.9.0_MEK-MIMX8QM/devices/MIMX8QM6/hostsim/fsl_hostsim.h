@@ -0,0 +1,399 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HOSTSIM_H_
+#define _FSL_HOSTSIM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup hostsim
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @brief Number of the device interrupts, after the 16 system exceptions.
+ *
+ * The shared interrupts of the subsystems are routed by the IRQSTEER on the device. The simulation
+ * does not model the IRQSTEER, every IRQn of the device header is an interrupt line of the simulated NVIC.
+ * EnableIRQ() leaves the shared interrupts to the IRQSTEER: where the application calls
+ * IRQSTEER_EnableInterrupt(), the simulation needs NVIC_EnableIRQ().
+ */
+#ifndef HOSTSIM_IRQ_COUNT
+#define HOSTSIM_IRQ_COUNT (624U)
+#endif
+
+/*! @brief Simulated time charged to each access of a peripheral register, in ns. */
+#ifndef HOSTSIM_ACCESS_TIME_NS
+#define HOSTSIM_ACCESS_TIME_NS (20U)
+#endif
+
+/*!
+ * @brief Largest step of the simulated time on a polling loop, in ns.
+ *
+ * A register read repeatedly, with no other access in between, is a polling loop: the time step of
+ * each read doubles up to this value, and stops at the next scheduled event.
+ */
+#ifndef HOSTSIM_POLL_STEP_MAX_NS
+#define HOSTSIM_POLL_STEP_MAX_NS (10000U)
+#endif
+
+/*!
+ * @brief Address range of the peripherals with no model.
+ *
+ * A page of this range accessed before any model registers it is mapped as zero-filled memory, so that
+ * the drivers of unmodelled peripherals (clock gating, pin mux) read back what they write.
+ */
+#ifndef HOSTSIM_UNMODELLED_BEGIN
+#define HOSTSIM_UNMODELLED_BEGIN (0x40000000U)
+#endif
+#ifndef HOSTSIM_UNMODELLED_END
+#define HOSTSIM_UNMODELLED_END (0x60000000U)
+#endif
+
+typedef struct _hostsim_region hostsim_region_t;
+
+/*! @brief Exception handler, as in the vector table. */
+typedef void (*hostsim_handler_t)(void);
+
+/*!
+ * @brief Read callback of a register region.
+ *
+ * @param region The register region.
+ * @param offset Offset of the 32-bit register accessed, in bytes.
+ */
+typedef void (*hostsim_read_callback_t)(hostsim_region_t *region, uint32_t offset);
+
+/*!
+ * @brief Write callback of a register region.
+ *
+ * Called once the store completed, with the value of the register before the store and the value
+ * stored. The callback implements the register semantics (write 1 to clear, read-only fields, actions)
+ * by updating the register in the model view.
+ *
+ * @param region The register region.
+ * @param offset Offset of the 32-bit register accessed, in bytes.
+ * @param oldValue Value of the register before the store.
+ * @param newValue Value of the register after the store.
+ */
+typedef void (*hostsim_write_callback_t)(hostsim_region_t *region,
+                                         uint32_t offset,
+                                         uint32_t oldValue,
+                                         uint32_t newValue);
+
+/*! @brief Behaviour of a register region. Any callback can be NULL. */
+typedef struct _hostsim_region_ops
+{
+    hostsim_read_callback_t refresh;  /*!< Before any load or store: update the register from the model. */
+    hostsim_read_callback_t readDone; /*!< After a load: side effect of the read, FIFO pop for example. */
+    hostsim_write_callback_t write;   /*!< After a store. */
+} hostsim_region_ops_t;
+
+/*! @brief Register region flags. */
+enum _hostsim_region_flags
+{
+    kHOSTSIM_RegionFlagClock = 1U << 0U, /*!< The region holds a free running counter: reading the same register
+                                              repeatedly is a polling loop even if the value changes. */
+};
+
+/*!
+ * @brief Register region of a simulated peripheral.
+ *
+ * The registers are mapped twice: at the base address of the peripheral with no access, so that every
+ * access of the drivers traps to the model, and at @ref regs for the model itself.
+ */
+struct _hostsim_region
+{
+    const char *name;                 /*!< Name, for diagnostics. */
+    uintptr_t base;                   /*!< Base address of the peripheral. */
+    size_t size;                      /*!< Size of the region, rounded up to pages. */
+    uint32_t flags;                   /*!< Logical OR of @ref _hostsim_region_flags. */
+    volatile uint8_t *regs;           /*!< Model view of the registers. */
+    const hostsim_region_ops_t *ops;  /*!< Behaviour of the region. */
+    void *model;                      /*!< Model instance. */
+    struct _hostsim_region *next;     /*!< Next registered region. */
+};
+
+/*! @brief Event callback. */
+typedef void (*hostsim_event_callback_t)(void *param);
+
+/*! @brief Event of the simulated time, embedded in the model that schedules it. */
+typedef struct _hostsim_event
+{
+    uint64_t dueNs;                   /*!< Simulated time of the event. */
+    hostsim_event_callback_t callback; /*!< Called at the time of the event. */
+    void *param;                      /*!< Parameter of the callback. */
+    struct _hostsim_event *next;      /*!< Next scheduled event. */
+    bool scheduled;                   /*!< The event is in the schedule. */
+} hostsim_event_t;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @name Initialization
+ * @{
+ */
+
+/*!
+ * @brief Initializes the simulation.
+ *
+ * Installs the trap handlers and maps the system control space of the core. It runs as a constructor
+ * before the models register their peripherals, so applications do not call it.
+ */
+void HOSTSIM_Init(void);
+
+/*!
+ * @brief Registers the register region of a peripheral.
+ *
+ * Maps the registers at @p base and the model view. A region cannot be registered twice, nor after the
+ * drivers accessed its page as an unmodelled peripheral; the models register theirs in constructors.
+ *
+ * @param region Region to register; its storage must persist.
+ * @param name Name of the peripheral, for diagnostics.
+ * @param base Base address of the peripheral, page aligned.
+ * @param size Size of the register map, in bytes.
+ * @param ops Behaviour of the region.
+ * @param model Model instance, passed back through @p region.
+ */
+void HOSTSIM_RegionInit(hostsim_region_t *region,
+                        const char *name,
+                        uintptr_t base,
+                        size_t size,
+                        const hostsim_region_ops_t *ops,
+                        void *model);
+
+/*!
+ * @brief Reports a fatal error of the simulation and aborts.
+ *
+ * @param format printf-like format of the message.
+ */
+void HOSTSIM_Fatal(const char *format, ...) __attribute__((noreturn, format(printf, 1, 2)));
+
+/*! @} */
+
+/*!
+ * @name Registers
+ * @{
+ */
+
+/*!
+ * @brief Reads a register through the model view.
+ *
+ * @param region The register region.
+ * @param offset Offset of the register, in bytes.
+ * @return The register value.
+ */
+static inline uint32_t HOSTSIM_Read32(const hostsim_region_t *region, uint32_t offset)
+{
+    return *(volatile uint32_t *)(uintptr_t)(region->regs + offset);
+}
+
+/*!
+ * @brief Writes a register through the model view.
+ *
+ * @param region The register region.
+ * @param offset Offset of the register, in bytes.
+ * @param value The register value.
+ */
+static inline void HOSTSIM_Write32(hostsim_region_t *region, uint32_t offset, uint32_t value)
+{
+    *(volatile uint32_t *)(uintptr_t)(region->regs + offset) = value;
+}
+
+/*!
+ * @brief Reads memory as a bus master of the simulation, the eDMA or the ENET for example.
+ *
+ * The registers of the simulated peripherals are read through their model, with the side effects of the
+ * read, as the accesses of the drivers. The access is split at the 32-bit register boundaries.
+ *
+ * @param address Address to read.
+ * @param data Buffer receiving the data.
+ * @param size Number of bytes to read.
+ */
+void HOSTSIM_BusRead(uintptr_t address, void *data, size_t size);
+
+/*!
+ * @brief Writes memory as a bus master of the simulation.
+ *
+ * @param address Address to write.
+ * @param data Data to write.
+ * @param size Number of bytes to write.
+ */
+void HOSTSIM_BusWrite(uintptr_t address, const void *data, size_t size);
+
+/*! @} */
+
+/*!
+ * @name Simulated time
+ * @{
+ */
+
+/*!
+ * @brief Gets the simulated time.
+ *
+ * @return The simulated time since the start, in ns.
+ */
+uint64_t HOSTSIM_GetTimeNs(void);
+
+/*!
+ * @brief Schedules an event.
+ *
+ * An event already scheduled is moved to the new time.
+ *
+ * @param event The event.
+ * @param delayNs Delay from now, in ns.
+ * @param callback Called at the time of the event.
+ * @param param Parameter of the callback.
+ */
+void HOSTSIM_EventSchedule(hostsim_event_t *event, uint64_t delayNs, hostsim_event_callback_t callback, void *param);
+
+/*!
+ * @brief Cancels a scheduled event. Does nothing if the event is not scheduled.
+ *
+ * @param event The event.
+ */
+void HOSTSIM_EventCancel(hostsim_event_t *event);
+
+/*!
+ * @brief Runs the simulation for some time.
+ *
+ * Advances the simulated time, running the events and taking the interrupts on the way. This is the
+ * idle loop of an application waiting for interrupts.
+ *
+ * @param durationNs Simulated time to run, in ns.
+ */
+void HOSTSIM_Run(uint64_t durationNs);
+
+/*!
+ * @brief Runs the simulation until the next scheduled event.
+ *
+ * @retval true An event ran.
+ * @retval false No event is scheduled.
+ */
+bool HOSTSIM_RunNextEvent(void);
+
+/*! @} */
+
+/*!
+ * @name Interrupts
+ * @{
+ */
+
+/*!
+ * @brief Sets the level of an interrupt line.
+ *
+ * An asserted line is pending in the NVIC until it is deasserted, as the level interrupts of the
+ * peripherals.
+ *
+ * @param irq The IRQ number.
+ * @param asserted true if the line is asserted.
+ */
+void HOSTSIM_SetIrqLevel(int32_t irq, bool asserted);
+
+/*!
+ * @brief Sets an interrupt pending, as a pulse on its line.
+ *
+ * @param irq The IRQ number.
+ */
+void HOSTSIM_PendIrq(int32_t irq);
+
+/*!
+ * @brief Gets the PRIMASK register of the simulated core.
+ *
+ * @return 1 if the interrupts are masked, 0 otherwise.
+ */
+uint32_t HOSTSIM_GetPrimask(void);
+
+/*!
+ * @brief Sets the PRIMASK register of the simulated core.
+ *
+ * Unmasking takes the pending interrupts before returning.
+ *
+ * @param primask 1 to mask the interrupts, 0 to unmask them.
+ */
+void HOSTSIM_SetPrimask(uint32_t primask);
+
+/*!
+ * @brief Gets the BASEPRI register of the simulated core.
+ *
+ * @return The BASEPRI value.
+ */
+uint32_t HOSTSIM_GetBasepri(void);
+
+/*!
+ * @brief Sets the BASEPRI register of the simulated core.
+ *
+ * @param basepri The BASEPRI value, 0 for no masking.
+ */
+void HOSTSIM_SetBasepri(uint32_t basepri);
+
+/*!
+ * @brief Gets the number of the exception the simulated core is running, as the IPSR register.
+ *
+ * @return The exception number, 0 in thread mode.
+ */
+uint32_t HOSTSIM_GetIpsr(void);
+
+/*!
+ * @brief Waits for an interrupt.
+ *
+ * Advances the simulated time to the next event until an interrupt is pending, and takes it if
+ * PRIMASK allows. Returns after the first event if no interrupt comes.
+ */
+void HOSTSIM_WaitForInterrupt(void);
+
+/*!
+ * @brief Marks the start of an exclusive access, as LDREX.
+ */
+void HOSTSIM_ExclusiveLoad(void);
+
+/*!
+ * @brief Checks the end of an exclusive access, as STREX.
+ *
+ * The exclusive access fails if an exception was taken since @ref HOSTSIM_ExclusiveLoad.
+ *
+ * @retval true The store can proceed.
+ * @retval false The exclusive access failed.
+ */
+bool HOSTSIM_ExclusiveStore(void);
+
+/*!
+ * @brief Clears the exclusive access, as CLREX.
+ */
+void HOSTSIM_ExclusiveClear(void);
+
+/*!
+ * @brief Gets the handler of an exception from the vector table.
+ *
+ * The default implementation reads the vector table at the VTOR register. It is weak, for hosts
+ * whose pointers do not fit the 32-bit vector table.
+ *
+ * @param exception The exception number, IRQ number plus 16.
+ * @return The handler, NULL if none.
+ */
+hostsim_handler_t HOSTSIM_GetVector(uint32_t exception);
+
+/*! @} */
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HOSTSIM_H_ */
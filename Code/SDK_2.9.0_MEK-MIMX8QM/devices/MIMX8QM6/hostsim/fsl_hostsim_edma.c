@@ -0,0 +1,456 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_hostsim_edma.h"
+#include "fsl_edma.h"
+#include "fsl_memory.h"
+
+/*
+ * eDMA model: the channels execute their TCD one minor loop per service request, a DMA request of a
+ * peripheral model or the START bit, with the source and destination offsets, modulos, minor loop
+ * offsets, last adjustments, scatter/gather and the minor and major channel links. The accesses go
+ * through the bus of the simulation, so that the peripheral registers see them as DMA accesses.
+ *
+ * The channels run concurrently, with no arbitration and no bandwidth control. The only error detected
+ * is a minor loop size that is not a multiple of the transfer sizes.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/* Offset of a channel register in the channel block. */
+#define HOSTSIM_EDMA_CH_REG(reg) (offsetof(DMA_Type, CH[0].reg) - offsetof(DMA_Type, CH[0]))
+#define HOSTSIM_EDMA_CH_STRIDE   (offsetof(DMA_Type, CH[1]) - offsetof(DMA_Type, CH[0]))
+
+/* TCD_CSR bits that can only be set while the channel is not done. */
+#define HOSTSIM_EDMA_TCD_CSR_LINKS (DMA_TCD_CSR_ESG_MASK | DMA_TCD_CSR_MAJORELINK_MASK)
+
+/* Largest beat of a transfer, 64 bytes. */
+#define HOSTSIM_EDMA_BEAT_MAX (64U)
+
+typedef struct _hostsim_edma hostsim_edma_t;
+
+typedef struct _hostsim_edma_channel
+{
+    hostsim_edma_t *edma;
+    uint32_t index;
+    bool request;
+    bool busy;
+    hostsim_event_t event;
+} hostsim_edma_channel_t;
+
+struct _hostsim_edma
+{
+    hostsim_region_t region;
+    DMA_Type *base;
+    uint32_t channelCount;
+    const IRQn_Type *irqs;
+    hostsim_edma_channel_t channels[FSL_FEATURE_EDMA_MODULE_CHANNEL];
+};
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void HOSTSIM_EdmaWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+static void HOSTSIM_EdmaMinorLoop(void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static DMA_Type *const s_edmaBases[]                              = DMA_BASE_PTRS;
+static const IRQn_Type s_edmaIrqs[][FSL_FEATURE_EDMA_MODULE_CHANNEL] = DMA_IRQS;
+static hostsim_edma_t s_edmas[ARRAY_SIZE(s_edmaBases)];
+
+static const hostsim_region_ops_t s_edmaOps = {
+    .refresh  = NULL,
+    .readDone = NULL,
+    .write    = HOSTSIM_EdmaWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static hostsim_edma_t *HOSTSIM_EdmaGet(DMA_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_edmaBases); instance++)
+    {
+        if (s_edmaBases[instance] == base)
+        {
+            return &s_edmas[instance];
+        }
+    }
+    HOSTSIM_Fatal("eDMA 0x%08x is not simulated", (unsigned)(uintptr_t)base);
+}
+
+static inline DMA_Type *HOSTSIM_EdmaRegs(hostsim_edma_t *edma)
+{
+    return (DMA_Type *)(uintptr_t)edma->region.regs;
+}
+
+/* The interrupt lines are shared by several channels. */
+static void HOSTSIM_EdmaUpdateIrqs(hostsim_edma_t *edma)
+{
+    DMA_Type *regs = HOSTSIM_EdmaRegs(edma);
+    uint32_t channel;
+    uint32_t other;
+    bool asserted;
+
+    for (channel = 0U; channel < edma->channelCount; channel++)
+    {
+        for (other = 0U; other < channel; other++)
+        {
+            if (edma->irqs[other] == edma->irqs[channel])
+            {
+                break;
+            }
+        }
+        if (other != channel)
+        {
+            /* Line done with an earlier channel. */
+            continue;
+        }
+        asserted = false;
+        for (other = channel; other < edma->channelCount; other++)
+        {
+            if ((edma->irqs[other] == edma->irqs[channel]) && ((regs->CH[other].CH_INT & DMA_CH_INT_INT_MASK) != 0U))
+            {
+                asserted = true;
+                break;
+            }
+        }
+        HOSTSIM_SetIrqLevel((int32_t)edma->irqs[channel], asserted);
+    }
+}
+
+/* Size of the minor loop, in bytes, and its signed minor loop offset. */
+static uint32_t HOSTSIM_EdmaMinorLoopBytes(uint32_t nbytes, uint32_t *minorOffset)
+{
+    uint32_t offset = 0U;
+
+    if ((nbytes & (DMA_TCD_NBYTES_MLOFFYES_SMLOE_MASK | DMA_TCD_NBYTES_MLOFFYES_DMLOE_MASK)) == 0U)
+    {
+        nbytes &= DMA_TCD_NBYTES_MLOFFNO_NBYTES_MASK;
+    }
+    else
+    {
+        offset = (nbytes & DMA_TCD_NBYTES_MLOFFYES_MLOFF_MASK) >> DMA_TCD_NBYTES_MLOFFYES_MLOFF_SHIFT;
+        offset = (offset ^ 0x80000U) - 0x80000U;
+        nbytes &= DMA_TCD_NBYTES_MLOFFYES_NBYTES_MASK;
+    }
+    if (minorOffset != NULL)
+    {
+        *minorOffset = offset;
+    }
+    return nbytes;
+}
+
+/* Starts the next minor loop of a channel if it has a service request. */
+static void HOSTSIM_EdmaKick(hostsim_edma_channel_t *channel)
+{
+    DMA_Type *regs = HOSTSIM_EdmaRegs(channel->edma);
+    uint32_t chCsr = regs->CH[channel->index].CH_CSR;
+    uint32_t nbytes;
+    uint32_t beats;
+    uint32_t sourceSize;
+    uint32_t destSize;
+
+    if (channel->busy || channel->event.scheduled)
+    {
+        return;
+    }
+    if (((regs->CH[channel->index].TCD_CSR & DMA_TCD_CSR_START_MASK) == 0U) &&
+        (((chCsr & DMA_CH_CSR_ERQ_MASK) == 0U) || (!channel->request)))
+    {
+        return;
+    }
+
+    nbytes     = HOSTSIM_EdmaMinorLoopBytes(regs->CH[channel->index].TCD_NBYTES_MLOFFNO, NULL);
+    sourceSize = 1U << ((regs->CH[channel->index].TCD_ATTR & DMA_TCD_ATTR_SSIZE_MASK) >> DMA_TCD_ATTR_SSIZE_SHIFT);
+    destSize   = 1U << ((regs->CH[channel->index].TCD_ATTR & DMA_TCD_ATTR_DSIZE_MASK) >> DMA_TCD_ATTR_DSIZE_SHIFT);
+    beats      = (nbytes / sourceSize) + (nbytes / destSize);
+
+    /* The channel is activated: START and DONE clear. */
+    regs->CH[channel->index].TCD_CSR &= ~(uint16_t)DMA_TCD_CSR_START_MASK;
+    regs->CH[channel->index].CH_CSR = (chCsr & ~DMA_CH_CSR_DONE_MASK) | DMA_CH_CSR_ACTIVE_MASK;
+    HOSTSIM_EventSchedule(&channel->event, (uint64_t)beats * HOSTSIM_EDMA_BEAT_TIME_NS, HOSTSIM_EdmaMinorLoop,
+                          channel);
+}
+
+static void HOSTSIM_EdmaError(hostsim_edma_channel_t *channel, uint32_t error)
+{
+    DMA_Type *regs = HOSTSIM_EdmaRegs(channel->edma);
+
+    regs->CH[channel->index].CH_ES |= error | DMA_CH_ES_ERR_MASK;
+    regs->CH[channel->index].CH_CSR &= ~(DMA_CH_CSR_ERQ_MASK | DMA_CH_CSR_ACTIVE_MASK);
+    if ((regs->CH[channel->index].CH_CSR & DMA_CH_CSR_EEI_MASK) != 0U)
+    {
+        regs->CH[channel->index].CH_INT |= DMA_CH_INT_INT_MASK;
+    }
+}
+
+/* Next address after an access, with the modulo of the address. */
+static uint32_t HOSTSIM_EdmaNextAddress(uint32_t address, int32_t offset, uint32_t modulo)
+{
+    uint32_t next = address + (uint32_t)offset;
+    uint32_t mask;
+
+    if (modulo != 0U)
+    {
+        mask = (1U << modulo) - 1U;
+        next = (address & ~mask) | (next & mask);
+    }
+    return next;
+}
+
+/* Mask of the major loop iteration count in CITER/BITER. */
+static uint32_t HOSTSIM_EdmaIterMask(uint16_t iter)
+{
+    return ((iter & DMA_TCD_CITER_ELINKNO_ELINK_MASK) != 0U) ? DMA_TCD_CITER_ELINKYES_CITER_MASK :
+                                                               DMA_TCD_CITER_ELINKNO_CITER_MASK;
+}
+
+static void HOSTSIM_EdmaLink(hostsim_edma_t *edma, uint32_t linkedChannel)
+{
+    DMA_Type *regs = HOSTSIM_EdmaRegs(edma);
+
+    if (linkedChannel < edma->channelCount)
+    {
+        regs->CH[linkedChannel].TCD_CSR |= (uint16_t)DMA_TCD_CSR_START_MASK;
+        HOSTSIM_EdmaKick(&edma->channels[linkedChannel]);
+    }
+}
+
+/* Loads the next TCD of a scatter/gather chain. */
+static void HOSTSIM_EdmaLoadTcd(hostsim_edma_channel_t *channel, uint32_t address)
+{
+    DMA_Type *regs = HOSTSIM_EdmaRegs(channel->edma);
+    edma_tcd_t tcd;
+
+    HOSTSIM_BusRead(MEMORY_ConvertMemoryMapAddress(address, kMEMORY_DMA2Local), &tcd, sizeof(tcd));
+    regs->CH[channel->index].TCD_SADDR          = tcd.SADDR;
+    regs->CH[channel->index].TCD_SOFF           = tcd.SOFF;
+    regs->CH[channel->index].TCD_ATTR           = tcd.ATTR;
+    regs->CH[channel->index].TCD_NBYTES_MLOFFNO = tcd.NBYTES;
+    regs->CH[channel->index].TCD_SLAST_SDA      = tcd.SLAST;
+    regs->CH[channel->index].TCD_DADDR          = tcd.DADDR;
+    regs->CH[channel->index].TCD_DOFF           = tcd.DOFF;
+    regs->CH[channel->index].TCD_CITER_ELINKNO  = tcd.CITER;
+    regs->CH[channel->index].TCD_DLAST_SGA      = tcd.DLAST_SGA;
+    regs->CH[channel->index].TCD_CSR            = tcd.CSR;
+    regs->CH[channel->index].TCD_BITER_ELINKNO  = tcd.BITER;
+}
+
+static void HOSTSIM_EdmaMinorLoop(void *param)
+{
+    hostsim_edma_channel_t *channel = (hostsim_edma_channel_t *)param;
+    hostsim_edma_t *edma            = channel->edma;
+    DMA_Type *regs                  = HOSTSIM_EdmaRegs(edma);
+    uint8_t beat[HOSTSIM_EDMA_BEAT_MAX];
+    uint32_t nbytes      = regs->CH[channel->index].TCD_NBYTES_MLOFFNO;
+    uint32_t attr        = regs->CH[channel->index].TCD_ATTR;
+    uint32_t sourceSize  = 1U << ((attr & DMA_TCD_ATTR_SSIZE_MASK) >> DMA_TCD_ATTR_SSIZE_SHIFT);
+    uint32_t destSize    = 1U << ((attr & DMA_TCD_ATTR_DSIZE_MASK) >> DMA_TCD_ATTR_DSIZE_SHIFT);
+    uint32_t sourceMod   = (attr & DMA_TCD_ATTR_SMOD_MASK) >> DMA_TCD_ATTR_SMOD_SHIFT;
+    uint32_t destMod     = (attr & DMA_TCD_ATTR_DMOD_MASK) >> DMA_TCD_ATTR_DMOD_SHIFT;
+    uint32_t source      = regs->CH[channel->index].TCD_SADDR;
+    uint32_t dest        = regs->CH[channel->index].TCD_DADDR;
+    int32_t sourceOffset = (int16_t)regs->CH[channel->index].TCD_SOFF;
+    int32_t destOffset   = (int16_t)regs->CH[channel->index].TCD_DOFF;
+    uint32_t beatSize    = (sourceSize > destSize) ? sourceSize : destSize;
+    uint32_t minorOffset;
+    uint16_t citer;
+    uint16_t csr;
+    uint32_t iterMask;
+    uint32_t count;
+    uint32_t done;
+    uint32_t i;
+
+    channel->busy = true;
+
+    count = HOSTSIM_EdmaMinorLoopBytes(nbytes, &minorOffset);
+    if ((count == 0U) || (beatSize > HOSTSIM_EDMA_BEAT_MAX) || ((count % beatSize) != 0U))
+    {
+        HOSTSIM_EdmaError(channel, DMA_CH_ES_NCE_MASK);
+        channel->busy = false;
+        HOSTSIM_EdmaUpdateIrqs(edma);
+        return;
+    }
+
+    /* The minor loop, in beats of the larger of the source and destination sizes. */
+    for (done = 0U; done < count; done += beatSize)
+    {
+        for (i = 0U; i < beatSize; i += sourceSize)
+        {
+            HOSTSIM_BusRead(MEMORY_ConvertMemoryMapAddress(source, kMEMORY_DMA2Local), &beat[i], sourceSize);
+            source = HOSTSIM_EdmaNextAddress(source, sourceOffset, sourceMod);
+        }
+        for (i = 0U; i < beatSize; i += destSize)
+        {
+            HOSTSIM_BusWrite(MEMORY_ConvertMemoryMapAddress(dest, kMEMORY_DMA2Local), &beat[i], destSize);
+            dest = HOSTSIM_EdmaNextAddress(dest, destOffset, destMod);
+        }
+    }
+    if ((nbytes & DMA_TCD_NBYTES_MLOFFYES_SMLOE_MASK) != 0U)
+    {
+        source += minorOffset;
+    }
+    if ((nbytes & DMA_TCD_NBYTES_MLOFFYES_DMLOE_MASK) != 0U)
+    {
+        dest += minorOffset;
+    }
+
+    citer    = regs->CH[channel->index].TCD_CITER_ELINKNO;
+    iterMask = HOSTSIM_EdmaIterMask(citer);
+    citer    = (uint16_t)((citer & ~iterMask) | (((citer & iterMask) - 1U) & iterMask));
+    csr      = regs->CH[channel->index].TCD_CSR;
+
+    regs->CH[channel->index].CH_CSR &= ~DMA_CH_CSR_ACTIVE_MASK;
+    if ((citer & iterMask) != 0U)
+    {
+        regs->CH[channel->index].TCD_SADDR         = source;
+        regs->CH[channel->index].TCD_DADDR         = dest;
+        regs->CH[channel->index].TCD_CITER_ELINKNO = citer;
+        if (((csr & DMA_TCD_CSR_INTHALF_MASK) != 0U) &&
+            ((citer & iterMask) == ((regs->CH[channel->index].TCD_BITER_ELINKNO & iterMask) >> 1U)))
+        {
+            regs->CH[channel->index].CH_INT |= DMA_CH_INT_INT_MASK;
+        }
+        if ((citer & DMA_TCD_CITER_ELINKNO_ELINK_MASK) != 0U)
+        {
+            HOSTSIM_EdmaLink(edma, ((uint32_t)citer & DMA_TCD_CITER_ELINKYES_LINKCH_MASK) >>
+                                       DMA_TCD_CITER_ELINKYES_LINKCH_SHIFT);
+        }
+    }
+    else
+    {
+        /* Major loop done. */
+        regs->CH[channel->index].TCD_SADDR = source + regs->CH[channel->index].TCD_SLAST_SDA;
+        if ((csr & DMA_TCD_CSR_INTMAJOR_MASK) != 0U)
+        {
+            regs->CH[channel->index].CH_INT |= DMA_CH_INT_INT_MASK;
+        }
+        if ((csr & DMA_TCD_CSR_DREQ_MASK) != 0U)
+        {
+            regs->CH[channel->index].CH_CSR &= ~DMA_CH_CSR_ERQ_MASK;
+        }
+        if ((csr & DMA_TCD_CSR_ESG_MASK) != 0U)
+        {
+            HOSTSIM_EdmaLoadTcd(channel, regs->CH[channel->index].TCD_DLAST_SGA);
+        }
+        else
+        {
+            regs->CH[channel->index].TCD_DADDR         = dest + regs->CH[channel->index].TCD_DLAST_SGA;
+            regs->CH[channel->index].TCD_CITER_ELINKNO = regs->CH[channel->index].TCD_BITER_ELINKNO;
+            regs->CH[channel->index].CH_CSR |= DMA_CH_CSR_DONE_MASK;
+        }
+        if ((csr & DMA_TCD_CSR_MAJORELINK_MASK) != 0U)
+        {
+            HOSTSIM_EdmaLink(edma, ((uint32_t)csr & DMA_TCD_CSR_MAJORLINKCH_MASK) >> DMA_TCD_CSR_MAJORLINKCH_SHIFT);
+        }
+    }
+
+    channel->busy = false;
+    HOSTSIM_EdmaUpdateIrqs(edma);
+    HOSTSIM_EdmaKick(channel);
+}
+
+static void HOSTSIM_EdmaWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    hostsim_edma_t *edma = (hostsim_edma_t *)region->model;
+    DMA_Type *regs       = HOSTSIM_EdmaRegs(edma);
+    hostsim_edma_channel_t *channel;
+    uint32_t index;
+    uint32_t reg;
+    uint32_t links;
+
+    if (offset < offsetof(DMA_Type, CH[0]))
+    {
+        /* Management page: the values written are kept. */
+        return;
+    }
+    index = (uint32_t)((offset - offsetof(DMA_Type, CH[0])) / HOSTSIM_EDMA_CH_STRIDE);
+    reg   = (uint32_t)((offset - offsetof(DMA_Type, CH[0])) % HOSTSIM_EDMA_CH_STRIDE);
+    if (index >= edma->channelCount)
+    {
+        return;
+    }
+    channel = &edma->channels[index];
+
+    if (reg == HOSTSIM_EDMA_CH_REG(CH_CSR))
+    {
+        regs->CH[channel->index].CH_CSR =
+            (newValue & ~(DMA_CH_CSR_DONE_MASK | DMA_CH_CSR_ACTIVE_MASK)) |
+            (oldValue & DMA_CH_CSR_ACTIVE_MASK) | (oldValue & DMA_CH_CSR_DONE_MASK & ~newValue);
+    }
+    else if (reg == HOSTSIM_EDMA_CH_REG(CH_ES))
+    {
+        regs->CH[channel->index].CH_ES = oldValue & ~(newValue & DMA_CH_ES_ERR_MASK);
+    }
+    else if (reg == HOSTSIM_EDMA_CH_REG(CH_INT))
+    {
+        regs->CH[channel->index].CH_INT = oldValue & ~(newValue & DMA_CH_INT_INT_MASK);
+    }
+    else if (reg == HOSTSIM_EDMA_CH_REG(TCD_CSR))
+    {
+        /* Scatter/gather and the major link cannot be enabled once the channel is done. */
+        if ((regs->CH[channel->index].CH_CSR & DMA_CH_CSR_DONE_MASK) != 0U)
+        {
+            links = HOSTSIM_EDMA_TCD_CSR_LINKS & newValue & oldValue;
+            regs->CH[channel->index].TCD_CSR =
+                (uint16_t)((newValue & ~HOSTSIM_EDMA_TCD_CSR_LINKS) | links);
+        }
+    }
+    else
+    {
+        /* TCD registers hold the value written. */
+    }
+
+    HOSTSIM_EdmaKick(channel);
+    HOSTSIM_EdmaUpdateIrqs(edma);
+}
+
+void HOSTSIM_EdmaSetRequest(DMA_Type *base, uint32_t channel, bool asserted)
+{
+    hostsim_edma_t *edma = HOSTSIM_EdmaGet(base);
+
+    if (channel >= edma->channelCount)
+    {
+        HOSTSIM_Fatal("eDMA 0x%08x has no channel %u", (unsigned)(uintptr_t)base, (unsigned)channel);
+    }
+    edma->channels[channel].request = asserted;
+    if (asserted)
+    {
+        HOSTSIM_EdmaKick(&edma->channels[channel]);
+    }
+}
+
+__attribute__((constructor(102))) static void HOSTSIM_EdmaInit(void)
+{
+    hostsim_edma_t *edma;
+    uint32_t instance;
+    uint32_t channel;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_edmaBases); instance++)
+    {
+        edma               = &s_edmas[instance];
+        edma->base         = s_edmaBases[instance];
+        edma->irqs         = s_edmaIrqs[instance];
+        edma->channelCount = (uint32_t)FSL_FEATURE_EDMA_INSTANCE_CHANNELn(edma->base);
+        for (channel = 0U; channel < edma->channelCount; channel++)
+        {
+            edma->channels[channel].edma  = edma;
+            edma->channels[channel].index = channel;
+        }
+        HOSTSIM_RegionInit(&edma->region, "eDMA", (uintptr_t)edma->base, sizeof(DMA_Type), &s_edmaOps, edma);
+    }
+}
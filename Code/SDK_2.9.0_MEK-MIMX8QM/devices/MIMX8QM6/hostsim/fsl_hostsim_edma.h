@@ -0,0 +1,53 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HOSTSIM_EDMA_H_
+#define _FSL_HOSTSIM_EDMA_H_
+
+#include "fsl_device_registers.h"
+#include "fsl_hostsim.h"
+
+/*!
+ * @addtogroup hostsim_edma
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Simulated time of each read or write of a minor loop, in ns. */
+#ifndef HOSTSIM_EDMA_BEAT_TIME_NS
+#define HOSTSIM_EDMA_BEAT_TIME_NS (5U)
+#endif
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Sets the level of the DMA request of a channel.
+ *
+ * The peripheral models call it with the state of their DMA request. While the request is asserted and
+ * the channel request is enabled, the channel runs one minor loop after the other.
+ *
+ * @param base The eDMA peripheral base address.
+ * @param channel The eDMA channel.
+ * @param asserted true if the request is asserted.
+ */
+void HOSTSIM_EdmaSetRequest(DMA_Type *base, uint32_t channel, bool asserted);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HOSTSIM_EDMA_H_ */
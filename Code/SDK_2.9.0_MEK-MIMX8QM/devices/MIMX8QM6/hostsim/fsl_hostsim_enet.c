@@ -0,0 +1,957 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "fsl_hostsim_enet.h"
+#include "fsl_enet.h"
+#include "fsl_memory.h"
+
+/*
+ * ENET model: the uDMA walks the transmit and receive buffer descriptor rings, legacy or enhanced as
+ * selected by ECR[EN1588], with the frames timed by the line rate. Received frames go through the
+ * individual, group and broadcast address filters, then into the ring of the first receive classifier (RCMR)
+ * matching their VLAN priority, ring 0 for the others. The MII management interface reaches a Clause 22 PHY
+ * register file. The 1588 timer counts the simulated time, with its period event and the timestamps of
+ * the enhanced descriptors.
+ *
+ * The transmit rings are served in order of their number, with no credit based shaping. The checksum
+ * offloads, the interrupt coalescing, the pause frames and the MIB counters are not modelled; the
+ * Clause 45 MDIO frames complete but do not reach the PHY.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_ENET_RINGS ((uint32_t)FSL_FEATURE_ENET_QUEUE)
+
+/* Buffer descriptor fields, from the start of the descriptor. */
+#define HOSTSIM_ENET_BD_LENGTH      ((uint32_t)offsetof(hostsim_enet_rx_bd_t, length))
+#define HOSTSIM_ENET_BD_CONTROL     ((uint32_t)offsetof(hostsim_enet_rx_bd_t, control))
+#define HOSTSIM_ENET_BD_BUFFER      ((uint32_t)offsetof(hostsim_enet_rx_bd_t, buffer))
+#define HOSTSIM_ENET_BD_EXTEND0     ((uint32_t)offsetof(hostsim_enet_rx_bd_t, controlExtend0))
+#define HOSTSIM_ENET_BD_EXTEND1     ((uint32_t)offsetof(hostsim_enet_rx_bd_t, controlExtend1))
+#define HOSTSIM_ENET_RXBD_TIMESTAMP ((uint32_t)offsetof(hostsim_enet_rx_bd_t, timestamp))
+#define HOSTSIM_ENET_TXBD_TIMESTAMP ((uint32_t)offsetof(hostsim_enet_tx_bd_t, timestamp))
+#define HOSTSIM_ENET_BD_SIZE        HOSTSIM_ENET_BD_EXTEND0
+#define HOSTSIM_ENET_RXBD_SIZE_EXT  ((uint32_t)sizeof(hostsim_enet_rx_bd_t))
+#define HOSTSIM_ENET_TXBD_SIZE_EXT  ((uint32_t)sizeof(hostsim_enet_tx_bd_t))
+
+/*
+ * Enhanced buffer descriptors as fsl_enet.h lays them out in the host process. The pointers have the size of
+ * a host pointer, the fields after them are not at the offsets of the device: the model follows the layout of
+ * the driver. The legacy descriptors end before controlExtend0.
+ */
+typedef struct _hostsim_enet_rx_bd
+{
+    uint16_t length;
+    uint16_t control;
+    uint8_t *buffer;
+    uint16_t controlExtend0;
+    uint16_t controlExtend1;
+    uint16_t payloadCheckSum;
+    uint8_t headerLength;
+    uint8_t protocolType;
+    uint16_t reserved0;
+    uint16_t controlExtend2;
+    uint32_t timestamp;
+    uint16_t reserved1[4];
+} hostsim_enet_rx_bd_t;
+
+typedef struct _hostsim_enet_tx_bd
+{
+    uint16_t length;
+    uint16_t control;
+    uint8_t *buffer;
+    uint16_t controlExtend0;
+    uint16_t controlExtend1;
+#if defined(FSL_FEATURE_ENET_HAS_AVB) && FSL_FEATURE_ENET_HAS_AVB
+    int8_t *txLaunchTime;
+#else
+    uint16_t reserved0[2];
+#endif /* FSL_FEATURE_ENET_HAS_AVB */
+    uint16_t reserved2;
+    uint16_t controlExtend2;
+    uint32_t timestamp;
+    uint16_t reserved3[4];
+} hostsim_enet_tx_bd_t;
+
+/* Bits of the enhanced descriptors, which fsl_enet.h only defines in ENET_ENHANCEDBUFFERDESCRIPTOR_MODE. */
+#define HOSTSIM_ENET_BD_RX_INTERRUPT_MASK (0x0080U)
+#define HOSTSIM_ENET_BD_TX_INTERRUPT_MASK (0x4000U)
+#define HOSTSIM_ENET_BD_TX_TIMESTAMP_MASK (0x2000U)
+
+/* VLAN tag: tag protocol identifier, then the priority in the upper three bits of the next byte. */
+#define HOSTSIM_ENET_VLAN_TPID_OFFSET (12U)
+#define HOSTSIM_ENET_VLAN_TCI_OFFSET  (14U)
+#define HOSTSIM_ENET_VLAN_TPID        (0x8100U)
+
+/* Preamble, start of frame delimiter and inter-frame gap, in bytes. */
+#define HOSTSIM_ENET_FRAME_OVERHEAD (20U)
+#define HOSTSIM_ENET_FCS_LEN        (4U)
+
+/* Interrupt lines of an instance. */
+#define HOSTSIM_ENET_IRQ_FRAME0 (0U)
+#define HOSTSIM_ENET_IRQ_FRAME1 (1U)
+#define HOSTSIM_ENET_IRQ_FRAME2 (2U)
+#define HOSTSIM_ENET_IRQ_TIMER  (3U)
+#define HOSTSIM_ENET_IRQ_COUNT  (4U)
+
+/* Clause 22 MDIO operations. */
+#define HOSTSIM_ENET_MDIO_WRITE (1U)
+#define HOSTSIM_ENET_MDIO_READ  (2U)
+
+/* Clause 22 PHY registers and bits. */
+#define HOSTSIM_ENET_PHY_BMCR            (0x00U)
+#define HOSTSIM_ENET_PHY_BMSR            (0x01U)
+#define HOSTSIM_ENET_PHY_ID1             (0x02U)
+#define HOSTSIM_ENET_PHY_ID2             (0x03U)
+#define HOSTSIM_ENET_PHY_SPECIFIC_STATUS (0x11U)
+#define HOSTSIM_ENET_PHY_BMCR_SPEED1     (0x0040U)
+#define HOSTSIM_ENET_PHY_BMCR_DUPLEX     (0x0100U)
+#define HOSTSIM_ENET_PHY_BMCR_RESTART_AN (0x0200U)
+#define HOSTSIM_ENET_PHY_BMCR_AN_ENABLE  (0x1000U)
+#define HOSTSIM_ENET_PHY_BMCR_LOOPBACK   (0x4000U)
+#define HOSTSIM_ENET_PHY_BMCR_RESET      (0x8000U)
+
+/* AR8031 after reset with the link up at 1 Gbit/s full duplex: basic status, identifier, specific status. */
+#define HOSTSIM_ENET_AR8031_BMSR            (0x796DU)
+#define HOSTSIM_ENET_AR8031_ID1             (0x004DU)
+#define HOSTSIM_ENET_AR8031_ID2             (0xD074U)
+#define HOSTSIM_ENET_AR8031_SPECIFIC_STATUS (0xAC00U)
+
+/* Reset values of the registers the drivers do not set. */
+#define HOSTSIM_ENET_ECR_RESET (0x70000000U)
+#define HOSTSIM_ENET_RCR_RESET (0x05EE0001U)
+
+typedef struct _hostsim_enet_frame
+{
+    uint32_t length;
+    uint8_t data[HOSTSIM_ENET_FRAME_MAX + HOSTSIM_ENET_FCS_LEN];
+} hostsim_enet_frame_t;
+
+typedef struct _hostsim_enet
+{
+    hostsim_region_t region;
+    ENET_Type *base;
+    IRQn_Type irqs[HOSTSIM_ENET_IRQ_COUNT];
+
+    uint32_t txBd[HOSTSIM_ENET_RINGS];
+    uint32_t rxBd[HOSTSIM_ENET_RINGS];
+    uint32_t txRing;
+    bool txBusy;
+    hostsim_enet_frame_t txFrame;
+    hostsim_event_t txEvent;
+
+    hostsim_enet_frame_t input[HOSTSIM_ENET_INPUT_FRAMES];
+    uint32_t inputHead;
+    uint32_t inputCount;
+    hostsim_event_t rxEvent;
+
+    uint16_t phy[32];
+    hostsim_event_t mdioEvent;
+
+    uint64_t timerStartNs;
+    uint32_t timerStart;
+    hostsim_event_t timerEvent;
+
+    hostsim_enet_output_callback_t output;
+    void *outputUserData;
+} hostsim_enet_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void HOSTSIM_EnetRefresh(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_EnetWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+static void HOSTSIM_EnetTxDone(void *param);
+static void HOSTSIM_EnetRxArrive(void *param);
+static void HOSTSIM_EnetTimerWrap(void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static ENET_Type *const s_enetBases[] = ENET_BASE_PTRS;
+static hostsim_enet_t s_enets[ARRAY_SIZE(s_enetBases)];
+
+static const struct
+{
+    ENET_Type *base;
+    IRQn_Type irqs[HOSTSIM_ENET_IRQ_COUNT];
+} s_enetIrqs[] = {
+#if defined(CONNECTIVITY__ENET0)
+    {CONNECTIVITY__ENET0,
+     {CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQn, CONNECTIVITY_ENET0_FRAME1_INT_IRQn, CONNECTIVITY_ENET0_FRAME2_INT_IRQn,
+      CONNECTIVITY_ENET0_TIMER_INT_IRQn}},
+#endif
+#if defined(CONNECTIVITY__ENET1)
+    {CONNECTIVITY__ENET1,
+     {CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQn, CONNECTIVITY_ENET1_FRAME1_INT_IRQn, CONNECTIVITY_ENET1_FRAME2_INT_IRQn,
+      CONNECTIVITY_ENET1_TIMER_INT_IRQn}},
+#endif
+};
+
+/* Interrupt flags of the rings: transmit frame and buffer, receive frame and buffer. */
+static const uint32_t s_enetTxfMask[] = {ENET_EIR_TXF_MASK, ENET_EIR_TXF1_MASK, ENET_EIR_TXF2_MASK};
+static const uint32_t s_enetTxbMask[] = {ENET_EIR_TXB_MASK, ENET_EIR_TXB1_MASK, ENET_EIR_TXB2_MASK};
+static const uint32_t s_enetRxfMask[] = {ENET_EIR_RXF_MASK, ENET_EIR_RXF1_MASK, ENET_EIR_RXF2_MASK};
+static const uint32_t s_enetRxbMask[] = {ENET_EIR_RXB_MASK, ENET_EIR_RXB1_MASK, ENET_EIR_RXB2_MASK};
+
+static const hostsim_region_ops_t s_enetOps = {
+    .refresh  = HOSTSIM_EnetRefresh,
+    .readDone = NULL,
+    .write    = HOSTSIM_EnetWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static hostsim_enet_t *HOSTSIM_EnetGet(ENET_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_enetBases); instance++)
+    {
+        if (s_enetBases[instance] == base)
+        {
+            return &s_enets[instance];
+        }
+    }
+    HOSTSIM_Fatal("ENET 0x%08x is not simulated", (unsigned)(uintptr_t)base);
+}
+
+static inline ENET_Type *HOSTSIM_EnetRegs(hostsim_enet_t *enet)
+{
+    return (ENET_Type *)(uintptr_t)enet->region.regs;
+}
+
+/* Ring registers: descriptor ring start, descriptor active and receive buffer size. */
+static volatile uint32_t *HOSTSIM_EnetTdsr(ENET_Type *regs, uint32_t ringId)
+{
+#if FSL_FEATURE_ENET_QUEUE > 1
+    if (ringId == 1U)
+    {
+        return &regs->TDSR1;
+    }
+    if (ringId == 2U)
+    {
+        return &regs->TDSR2;
+    }
+#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+    return &regs->TDSR;
+}
+
+static volatile uint32_t *HOSTSIM_EnetRdsr(ENET_Type *regs, uint32_t ringId)
+{
+#if FSL_FEATURE_ENET_QUEUE > 1
+    if (ringId == 1U)
+    {
+        return &regs->RDSR1;
+    }
+    if (ringId == 2U)
+    {
+        return &regs->RDSR2;
+    }
+#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+    return &regs->RDSR;
+}
+
+static volatile uint32_t *HOSTSIM_EnetTdar(ENET_Type *regs, uint32_t ringId)
+{
+#if FSL_FEATURE_ENET_QUEUE > 1
+    if (ringId == 1U)
+    {
+        return &regs->TDAR1;
+    }
+    if (ringId == 2U)
+    {
+        return &regs->TDAR2;
+    }
+#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+    return &regs->TDAR;
+}
+
+static volatile uint32_t *HOSTSIM_EnetRdar(ENET_Type *regs, uint32_t ringId)
+{
+#if FSL_FEATURE_ENET_QUEUE > 1
+    if (ringId == 1U)
+    {
+        return &regs->RDAR1;
+    }
+    if (ringId == 2U)
+    {
+        return &regs->RDAR2;
+    }
+#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+    return &regs->RDAR;
+}
+
+static uint32_t HOSTSIM_EnetMrbr(ENET_Type *regs, uint32_t ringId)
+{
+#if FSL_FEATURE_ENET_QUEUE > 1
+    if (ringId == 1U)
+    {
+        return regs->MRBR1 & ENET_MRBR_R_BUF_SIZE_MASK;
+    }
+    if (ringId == 2U)
+    {
+        return regs->MRBR2 & ENET_MRBR_R_BUF_SIZE_MASK;
+    }
+#endif /* FSL_FEATURE_ENET_QUEUE > 1 */
+    return regs->MRBR & ENET_MRBR_R_BUF_SIZE_MASK;
+}
+
+/* Buffer descriptors are in the memory of the application, at DMA addresses. */
+static uint16_t HOSTSIM_EnetBdRead16(uint32_t bd, uint32_t field)
+{
+    uint16_t value;
+
+    HOSTSIM_BusRead(MEMORY_ConvertMemoryMapAddress(bd + field, kMEMORY_DMA2Local), &value, sizeof(value));
+    return value;
+}
+
+static uint32_t HOSTSIM_EnetBdRead32(uint32_t bd, uint32_t field)
+{
+    uint32_t value;
+
+    HOSTSIM_BusRead(MEMORY_ConvertMemoryMapAddress(bd + field, kMEMORY_DMA2Local), &value, sizeof(value));
+    return value;
+}
+
+static void HOSTSIM_EnetBdWrite16(uint32_t bd, uint32_t field, uint16_t value)
+{
+    HOSTSIM_BusWrite(MEMORY_ConvertMemoryMapAddress(bd + field, kMEMORY_DMA2Local), &value, sizeof(value));
+}
+
+static void HOSTSIM_EnetBdWrite32(uint32_t bd, uint32_t field, uint32_t value)
+{
+    HOSTSIM_BusWrite(MEMORY_ConvertMemoryMapAddress(bd + field, kMEMORY_DMA2Local), &value, sizeof(value));
+}
+
+static bool HOSTSIM_EnetEnhanced(hostsim_enet_t *enet)
+{
+    return (HOSTSIM_EnetRegs(enet)->ECR & ENET_ECR_EN1588_MASK) != 0U;
+}
+
+/* Next descriptor of a ring, after the wrap bit, sizeExt the size of its enhanced descriptors. */
+static uint32_t HOSTSIM_EnetNextBd(
+    hostsim_enet_t *enet, uint32_t bd, uint16_t control, uint32_t ringStart, uint32_t sizeExt)
+{
+    if ((control & ENET_BUFFDESCRIPTOR_TX_WRAP_MASK) != 0U)
+    {
+        return ringStart;
+    }
+    return bd + (HOSTSIM_EnetEnhanced(enet) ? sizeExt : HOSTSIM_ENET_BD_SIZE);
+}
+
+/* Duration of a byte on the line, in ns. */
+static uint64_t HOSTSIM_EnetByteTimeNs(hostsim_enet_t *enet)
+{
+    ENET_Type *regs = HOSTSIM_EnetRegs(enet);
+
+    if ((regs->ECR & ENET_ECR_SPEED_MASK) != 0U)
+    {
+        return 8U;
+    }
+    return ((regs->RCR & ENET_RCR_RMII_10T_MASK) != 0U) ? 800U : 80U;
+}
+
+/* CRC-32 of the frame check sequence and of the address hash, not inverted. */
+static uint32_t HOSTSIM_EnetCrc(const uint8_t *data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFFU;
+    size_t i;
+    uint32_t bit;
+
+    for (i = 0U; i < length; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ 0xEDB88320U) : (crc >> 1U);
+        }
+    }
+    return crc;
+}
+
+/* Value of the 1588 timer, in ns. */
+static uint32_t HOSTSIM_EnetTimerNs(hostsim_enet_t *enet)
+{
+    ENET_Type *regs = HOSTSIM_EnetRegs(enet);
+    uint64_t period = regs->ATPER;
+
+    if ((regs->ATCR & ENET_ATCR_EN_MASK) == 0U)
+    {
+        return enet->timerStart;
+    }
+    if (period == 0U)
+    {
+        period = 1ULL << 32U;
+    }
+    return (uint32_t)((enet->timerStart + (HOSTSIM_GetTimeNs() - enet->timerStartNs)) % period);
+}
+
+static void HOSTSIM_EnetTimerRestart(hostsim_enet_t *enet, uint32_t value)
+{
+    ENET_Type *regs = HOSTSIM_EnetRegs(enet);
+
+    enet->timerStart   = value;
+    enet->timerStartNs = HOSTSIM_GetTimeNs();
+    HOSTSIM_EventCancel(&enet->timerEvent);
+    if (((regs->ATCR & ENET_ATCR_EN_MASK) != 0U) && (regs->ATPER > value))
+    {
+        HOSTSIM_EventSchedule(&enet->timerEvent, regs->ATPER - value, HOSTSIM_EnetTimerWrap, enet);
+    }
+}
+
+static void HOSTSIM_EnetTimerWrap(void *param)
+{
+    hostsim_enet_t *enet = (hostsim_enet_t *)param;
+
+    HOSTSIM_EnetRegs(enet)->EIR |= ENET_EIR_TS_TIMER_MASK;
+    HOSTSIM_EnetTimerRestart(enet, 0U);
+}
+
+static void HOSTSIM_EnetUpdateIrqs(hostsim_enet_t *enet)
+{
+    ENET_Type *regs      = HOSTSIM_EnetRegs(enet);
+    uint32_t events      = regs->EIR & regs->EIMR;
+    uint32_t timerEvents = ENET_EIR_TS_TIMER_MASK | ENET_EIR_TS_AVAIL_MASK;
+    uint32_t ring1Events = ENET_EIR_TXF1_MASK | ENET_EIR_TXB1_MASK | ENET_EIR_RXF1_MASK | ENET_EIR_RXB1_MASK;
+    uint32_t ring2Events = ENET_EIR_TXF2_MASK | ENET_EIR_TXB2_MASK | ENET_EIR_RXF2_MASK | ENET_EIR_RXB2_MASK;
+
+    HOSTSIM_SetIrqLevel((int32_t)enet->irqs[HOSTSIM_ENET_IRQ_FRAME0],
+                        (events & ~(timerEvents | ring1Events | ring2Events)) != 0U);
+    HOSTSIM_SetIrqLevel((int32_t)enet->irqs[HOSTSIM_ENET_IRQ_FRAME1], (events & ring1Events) != 0U);
+    HOSTSIM_SetIrqLevel((int32_t)enet->irqs[HOSTSIM_ENET_IRQ_FRAME2], (events & ring2Events) != 0U);
+    HOSTSIM_SetIrqLevel((int32_t)enet->irqs[HOSTSIM_ENET_IRQ_TIMER], (events & timerEvents) != 0U);
+}
+
+/* Receive address filters. */
+static bool HOSTSIM_EnetAccept(hostsim_enet_t *enet, const uint8_t *frame)
+{
+    ENET_Type *regs = HOSTSIM_EnetRegs(enet);
+    uint32_t crc;
+    uint32_t hashLow;
+    uint32_t hashHigh;
+    uint32_t address;
+
+    if ((regs->RCR & ENET_RCR_PROM_MASK) != 0U)
+    {
+        return true;
+    }
+    if ((frame[0] & frame[1] & frame[2] & frame[3] & frame[4] & frame[5]) == 0xFFU)
+    {
+        return (regs->RCR & ENET_RCR_BC_REJ_MASK) == 0U;
+    }
+    if ((frame[0] & 1U) == 0U)
+    {
+        address = ((uint32_t)frame[0] << 24U) | ((uint32_t)frame[1] << 16U) | ((uint32_t)frame[2] << 8U) | frame[3];
+        if ((address == regs->PALR) &&
+            ((((uint32_t)frame[4] << 8U) | frame[5]) ==
+             ((regs->PAUR & ENET_PAUR_PADDR2_MASK) >> ENET_PAUR_PADDR2_SHIFT)))
+        {
+            return true;
+        }
+        hashLow  = regs->IALR;
+        hashHigh = regs->IAUR;
+    }
+    else
+    {
+        hashLow  = regs->GALR;
+        hashHigh = regs->GAUR;
+    }
+
+    crc = HOSTSIM_EnetCrc(frame, 6U);
+    return ((((crc >> 31U) != 0U) ? hashHigh : hashLow) & (1U << ((crc >> 26U) & 0x1FU))) != 0U;
+}
+
+/* Receive ring of a frame: the ring of the first classifier matching its VLAN priority, else ring 0. */
+static uint32_t HOSTSIM_EnetRxRing(ENET_Type *regs, const uint8_t *data, uint32_t length)
+{
+    uint32_t ringId;
+    uint32_t rcmr;
+    uint32_t pcp;
+    uint32_t i;
+
+    if ((length < (HOSTSIM_ENET_VLAN_TCI_OFFSET + 2U)) ||
+        ((((uint32_t)data[HOSTSIM_ENET_VLAN_TPID_OFFSET] << 8U) | data[HOSTSIM_ENET_VLAN_TPID_OFFSET + 1U]) !=
+         HOSTSIM_ENET_VLAN_TPID))
+    {
+        return 0U;
+    }
+
+    pcp = (uint32_t)data[HOSTSIM_ENET_VLAN_TCI_OFFSET] >> 5U;
+    for (ringId = 1U; ringId < HOSTSIM_ENET_RINGS; ringId++)
+    {
+        rcmr = regs->RCMR[ringId - 1U];
+        if ((rcmr & ENET_RCMR_MATCHEN_MASK) == 0U)
+        {
+            continue;
+        }
+        /* Compare fields CMP0..CMP3, four bits apart. */
+        for (i = 0U; i < 4U; i++)
+        {
+            if (((rcmr >> (4U * i)) & 0x7U) == pcp)
+            {
+                return ringId;
+            }
+        }
+    }
+
+    return 0U;
+}
+
+/* Writes a frame to its receive ring. Dropped if the ring has not enough empty descriptors. */
+static void HOSTSIM_EnetReceive(hostsim_enet_t *enet, const uint8_t *data, uint32_t length)
+{
+    ENET_Type *regs     = HOSTSIM_EnetRegs(enet);
+    bool enhanced       = HOSTSIM_EnetEnhanced(enet);
+    uint32_t ringId     = HOSTSIM_EnetRxRing(regs, data, length);
+    uint32_t bufferSize = HOSTSIM_EnetMrbr(regs, ringId);
+    uint32_t ringStart  = *HOSTSIM_EnetRdsr(regs, ringId);
+    uint8_t frame[HOSTSIM_ENET_FRAME_MAX + HOSTSIM_ENET_FCS_LEN];
+    uint32_t total = length;
+    uint32_t done;
+    uint32_t chunk;
+    uint32_t bd;
+    uint32_t crc;
+    uint16_t control;
+    bool interrupt;
+
+    if (((regs->ECR & ENET_ECR_ETHEREN_MASK) == 0U) ||
+        ((*HOSTSIM_EnetRdar(regs, ringId) & ENET_RDAR_RDAR_MASK) == 0U) || (length < 6U) || (bufferSize == 0U) ||
+        (!HOSTSIM_EnetAccept(enet, data)))
+    {
+        return;
+    }
+
+    (void)memcpy(frame, data, length);
+    if ((regs->RCR & ENET_RCR_CRCFWD_MASK) == 0U)
+    {
+        crc = ~HOSTSIM_EnetCrc(frame, length);
+        (void)memcpy(&frame[length], &crc, HOSTSIM_ENET_FCS_LEN);
+        total += HOSTSIM_ENET_FCS_LEN;
+    }
+
+    /* The whole frame must fit in empty descriptors. */
+    bd = enet->rxBd[ringId];
+    for (done = 0U; done < total; done += bufferSize)
+    {
+        control = HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_CONTROL);
+        if ((control & ENET_BUFFDESCRIPTOR_RX_EMPTY_MASK) == 0U)
+        {
+            /* No empty descriptor: the receive descriptor active flag clears, the frame is dropped. */
+            *HOSTSIM_EnetRdar(regs, ringId) = 0U;
+            return;
+        }
+        bd = HOSTSIM_EnetNextBd(enet, bd, control, ringStart, HOSTSIM_ENET_RXBD_SIZE_EXT);
+    }
+
+    for (done = 0U; done < total; done += chunk)
+    {
+        bd      = enet->rxBd[ringId];
+        chunk   = ((total - done) < bufferSize) ? (total - done) : bufferSize;
+        control = HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_CONTROL);
+        HOSTSIM_BusWrite(MEMORY_ConvertMemoryMapAddress(HOSTSIM_EnetBdRead32(bd, HOSTSIM_ENET_BD_BUFFER),
+                                                        kMEMORY_DMA2Local),
+                         &frame[done], chunk);
+
+        control &= (uint16_t)(ENET_BUFFDESCRIPTOR_RX_WRAP_MASK | ENET_BUFFDESCRIPTOR_RX_SOFTOWNER1_MASK |
+                              ENET_BUFFDESCRIPTOR_RX_SOFTOWNER2_Mask);
+        interrupt = true;
+        if (enhanced)
+        {
+            interrupt =
+                (HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_EXTEND1) & HOSTSIM_ENET_BD_RX_INTERRUPT_MASK) != 0U;
+            HOSTSIM_EnetBdWrite16(bd, HOSTSIM_ENET_BD_EXTEND0, 0U);
+            HOSTSIM_EnetBdWrite32(bd, HOSTSIM_ENET_RXBD_TIMESTAMP, HOSTSIM_EnetTimerNs(enet));
+        }
+        if ((done + chunk) == total)
+        {
+            control |= ENET_BUFFDESCRIPTOR_RX_LAST_MASK;
+            if ((frame[0] & 1U) != 0U)
+            {
+                control |= ((frame[0] & frame[1] & frame[2] & frame[3] & frame[4] & frame[5]) == 0xFFU) ?
+                               ENET_BUFFDESCRIPTOR_RX_BROADCAST_MASK :
+                               ENET_BUFFDESCRIPTOR_RX_MULTICAST_MASK;
+            }
+            HOSTSIM_EnetBdWrite16(bd, HOSTSIM_ENET_BD_LENGTH, (uint16_t)total);
+            regs->EIR |= interrupt ? s_enetRxfMask[ringId] : 0U;
+        }
+        else
+        {
+            HOSTSIM_EnetBdWrite16(bd, HOSTSIM_ENET_BD_LENGTH, (uint16_t)chunk);
+        }
+        HOSTSIM_EnetBdWrite16(bd, HOSTSIM_ENET_BD_CONTROL, control);
+        regs->EIR |= interrupt ? s_enetRxbMask[ringId] : 0U;
+        enet->rxBd[ringId] = HOSTSIM_EnetNextBd(enet, bd, control, ringStart, HOSTSIM_ENET_RXBD_SIZE_EXT);
+    }
+}
+
+/* Starts the transmission of the next frame ready in a transmit ring. */
+static void HOSTSIM_EnetTxStart(hostsim_enet_t *enet)
+{
+    ENET_Type *regs = HOSTSIM_EnetRegs(enet);
+    uint32_t ringId;
+    uint32_t length;
+    uint32_t bd;
+    uint16_t control;
+
+    if (enet->txBusy || ((regs->ECR & ENET_ECR_ETHEREN_MASK) == 0U))
+    {
+        return;
+    }
+
+    for (ringId = 0U; ringId < HOSTSIM_ENET_RINGS; ringId++)
+    {
+        if ((*HOSTSIM_EnetTdar(regs, ringId) & ENET_TDAR_TDAR_MASK) == 0U)
+        {
+            continue;
+        }
+
+        enet->txFrame.length = 0U;
+        bd                   = enet->txBd[ringId];
+        do
+        {
+            control = HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_CONTROL);
+            if ((control & ENET_BUFFDESCRIPTOR_TX_READY_MASK) == 0U)
+            {
+                break;
+            }
+            length = HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_LENGTH);
+            if ((enet->txFrame.length + length) > HOSTSIM_ENET_FRAME_MAX)
+            {
+                length = HOSTSIM_ENET_FRAME_MAX - enet->txFrame.length;
+            }
+            HOSTSIM_BusRead(MEMORY_ConvertMemoryMapAddress(HOSTSIM_EnetBdRead32(bd, HOSTSIM_ENET_BD_BUFFER),
+                                                           kMEMORY_DMA2Local),
+                            &enet->txFrame.data[enet->txFrame.length], length);
+            enet->txFrame.length += length;
+            bd = HOSTSIM_EnetNextBd(enet, bd, control, *HOSTSIM_EnetTdsr(regs, ringId), HOSTSIM_ENET_TXBD_SIZE_EXT);
+        } while ((control & ENET_BUFFDESCRIPTOR_TX_LAST_MASK) == 0U);
+
+        if ((control & (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK)) !=
+            (ENET_BUFFDESCRIPTOR_TX_READY_MASK | ENET_BUFFDESCRIPTOR_TX_LAST_MASK))
+        {
+            /* No complete frame ready: the transmit descriptor active flag clears. */
+            *HOSTSIM_EnetTdar(regs, ringId) = 0U;
+            continue;
+        }
+
+        enet->txRing = ringId;
+        enet->txBusy = true;
+        HOSTSIM_EventSchedule(&enet->txEvent,
+                              (enet->txFrame.length + HOSTSIM_ENET_FCS_LEN + HOSTSIM_ENET_FRAME_OVERHEAD) *
+                                  HOSTSIM_EnetByteTimeNs(enet),
+                              HOSTSIM_EnetTxDone, enet);
+        return;
+    }
+}
+
+static void HOSTSIM_EnetTxDone(void *param)
+{
+    hostsim_enet_t *enet = (hostsim_enet_t *)param;
+    ENET_Type *regs      = HOSTSIM_EnetRegs(enet);
+    uint32_t ringId      = enet->txRing;
+    bool enhanced        = HOSTSIM_EnetEnhanced(enet);
+    uint32_t bd;
+    uint16_t control;
+    uint16_t extend1;
+    bool interrupt = true;
+
+    /* Give the descriptors of the frame back to the application. */
+    do
+    {
+        bd      = enet->txBd[ringId];
+        control = HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_CONTROL);
+        if (enhanced)
+        {
+            extend1   = HOSTSIM_EnetBdRead16(bd, HOSTSIM_ENET_BD_EXTEND1);
+            interrupt = (extend1 & HOSTSIM_ENET_BD_TX_INTERRUPT_MASK) != 0U;
+            HOSTSIM_EnetBdWrite16(bd, HOSTSIM_ENET_BD_EXTEND0, 0U);
+            if ((extend1 & HOSTSIM_ENET_BD_TX_TIMESTAMP_MASK) != 0U)
+            {
+                HOSTSIM_Write32(&enet->region, (uint32_t)offsetof(ENET_Type, ATSTMP), HOSTSIM_EnetTimerNs(enet));
+                regs->EIR |= ENET_EIR_TS_AVAIL_MASK;
+                HOSTSIM_EnetBdWrite32(bd, HOSTSIM_ENET_TXBD_TIMESTAMP, regs->ATSTMP);
+            }
+        }
+        HOSTSIM_EnetBdWrite16(bd, HOSTSIM_ENET_BD_CONTROL, control & (uint16_t)~ENET_BUFFDESCRIPTOR_TX_READY_MASK);
+        regs->EIR |= interrupt ? s_enetTxbMask[ringId] : 0U;
+        enet->txBd[ringId] =
+            HOSTSIM_EnetNextBd(enet, bd, control, *HOSTSIM_EnetTdsr(regs, ringId), HOSTSIM_ENET_TXBD_SIZE_EXT);
+    } while ((control & ENET_BUFFDESCRIPTOR_TX_LAST_MASK) == 0U);
+    regs->EIR |= interrupt ? s_enetTxfMask[ringId] : 0U;
+
+    if (((regs->RCR & ENET_RCR_LOOP_MASK) != 0U) ||
+        ((enet->phy[HOSTSIM_ENET_PHY_BMCR] & HOSTSIM_ENET_PHY_BMCR_LOOPBACK) != 0U))
+    {
+        HOSTSIM_EnetReceive(enet, enet->txFrame.data, enet->txFrame.length);
+    }
+    else if (enet->output != NULL)
+    {
+        enet->output(enet->base, ringId, enet->txFrame.data, enet->txFrame.length, enet->outputUserData);
+    }
+    else
+    {
+        /* Nobody listens on the line. */
+    }
+
+    enet->txBusy = false;
+    HOSTSIM_EnetTxStart(enet);
+    HOSTSIM_EnetUpdateIrqs(enet);
+}
+
+static void HOSTSIM_EnetScheduleRx(hostsim_enet_t *enet)
+{
+    hostsim_enet_frame_t *frame;
+
+    if ((enet->inputCount == 0U) || enet->rxEvent.scheduled)
+    {
+        return;
+    }
+    frame = &enet->input[enet->inputHead];
+    HOSTSIM_EventSchedule(&enet->rxEvent,
+                          (frame->length + HOSTSIM_ENET_FCS_LEN + HOSTSIM_ENET_FRAME_OVERHEAD) *
+                              HOSTSIM_EnetByteTimeNs(enet),
+                          HOSTSIM_EnetRxArrive, enet);
+}
+
+static void HOSTSIM_EnetRxArrive(void *param)
+{
+    hostsim_enet_t *enet         = (hostsim_enet_t *)param;
+    hostsim_enet_frame_t *frame = &enet->input[enet->inputHead];
+
+    HOSTSIM_EnetReceive(enet, frame->data, frame->length);
+    enet->inputHead = (enet->inputHead + 1U) % HOSTSIM_ENET_INPUT_FRAMES;
+    enet->inputCount--;
+    HOSTSIM_EnetScheduleRx(enet);
+    HOSTSIM_EnetUpdateIrqs(enet);
+}
+
+static void HOSTSIM_EnetMdioDone(void *param)
+{
+    hostsim_enet_t *enet = (hostsim_enet_t *)param;
+    ENET_Type *regs      = HOSTSIM_EnetRegs(enet);
+    uint32_t mmfr        = regs->MMFR;
+    uint32_t phyReg      = (mmfr & ENET_MMFR_RA_MASK) >> ENET_MMFR_RA_SHIFT;
+    uint32_t operation   = (mmfr & ENET_MMFR_OP_MASK) >> ENET_MMFR_OP_SHIFT;
+
+    /* Clause 22 frames only, start of frame 01. */
+    if (((mmfr & ENET_MMFR_ST_MASK) >> ENET_MMFR_ST_SHIFT) == 1U)
+    {
+        if (operation == HOSTSIM_ENET_MDIO_WRITE)
+        {
+            enet->phy[phyReg] = (uint16_t)(mmfr & ENET_MMFR_DATA_MASK);
+            if (phyReg == HOSTSIM_ENET_PHY_BMCR)
+            {
+                /* Reset and restart of the auto-negotiation complete at once. */
+                enet->phy[phyReg] &= (uint16_t)~(HOSTSIM_ENET_PHY_BMCR_RESET | HOSTSIM_ENET_PHY_BMCR_RESTART_AN);
+            }
+        }
+        else if (operation == HOSTSIM_ENET_MDIO_READ)
+        {
+            regs->MMFR = (mmfr & ~ENET_MMFR_DATA_MASK) | enet->phy[phyReg];
+        }
+        else
+        {
+            /* Not a Clause 22 operation. */
+        }
+    }
+    regs->EIR |= ENET_EIR_MII_MASK;
+    HOSTSIM_EnetUpdateIrqs(enet);
+}
+
+static void HOSTSIM_EnetReset(hostsim_enet_t *enet)
+{
+    ENET_Type *regs = HOSTSIM_EnetRegs(enet);
+    uint32_t ringId;
+
+    HOSTSIM_EventCancel(&enet->txEvent);
+    HOSTSIM_EventCancel(&enet->mdioEvent);
+    HOSTSIM_EventCancel(&enet->timerEvent);
+    enet->txBusy = false;
+    (void)memset((void *)(uintptr_t)enet->region.regs, 0, sizeof(ENET_Type));
+    regs->ECR = HOSTSIM_ENET_ECR_RESET;
+    regs->RCR = HOSTSIM_ENET_RCR_RESET;
+    for (ringId = 0U; ringId < HOSTSIM_ENET_RINGS; ringId++)
+    {
+        enet->txBd[ringId] = 0U;
+        enet->rxBd[ringId] = 0U;
+    }
+    enet->timerStart = 0U;
+}
+
+static void HOSTSIM_EnetRefresh(hostsim_region_t *region, uint32_t offset)
+{
+    hostsim_enet_t *enet = (hostsim_enet_t *)region->model;
+
+    if ((offset == offsetof(ENET_Type, ATVR)) && ((HOSTSIM_EnetRegs(enet)->ATCR & ENET_ATCR_EN_MASK) == 0U))
+    {
+        /* Timer stopped: reads back its value. */
+        HOSTSIM_EnetRegs(enet)->ATVR = enet->timerStart;
+    }
+}
+
+static void HOSTSIM_EnetWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    hostsim_enet_t *enet = (hostsim_enet_t *)region->model;
+    ENET_Type *regs      = HOSTSIM_EnetRegs(enet);
+    uint32_t ringId;
+
+    if (offset == offsetof(ENET_Type, EIR))
+    {
+        regs->EIR = oldValue & ~newValue;
+    }
+    else if (offset == offsetof(ENET_Type, ECR))
+    {
+        if ((newValue & ENET_ECR_RESET_MASK) != 0U)
+        {
+            HOSTSIM_EnetReset(enet);
+        }
+        else if ((newValue & ENET_ECR_ETHEREN_MASK) != (oldValue & ENET_ECR_ETHEREN_MASK))
+        {
+            /* The uDMA restarts from the start of the rings. */
+            for (ringId = 0U; ringId < HOSTSIM_ENET_RINGS; ringId++)
+            {
+                enet->txBd[ringId]                = *HOSTSIM_EnetTdsr(regs, ringId);
+                enet->rxBd[ringId]                = *HOSTSIM_EnetRdsr(regs, ringId);
+                *HOSTSIM_EnetTdar(regs, ringId) = 0U;
+                *HOSTSIM_EnetRdar(regs, ringId) = 0U;
+            }
+        }
+        else
+        {
+            /* Configuration only. */
+        }
+    }
+    else if (offset == offsetof(ENET_Type, MMFR))
+    {
+        HOSTSIM_EventSchedule(&enet->mdioEvent, HOSTSIM_ENET_MDIO_TIME_NS, HOSTSIM_EnetMdioDone, enet);
+    }
+    else if (offset == offsetof(ENET_Type, ATCR))
+    {
+        if ((newValue & ENET_ATCR_RESTART_MASK) != 0U)
+        {
+            HOSTSIM_EnetTimerRestart(enet, 0U);
+        }
+        else if ((newValue & ENET_ATCR_EN_MASK) != (oldValue & ENET_ATCR_EN_MASK))
+        {
+            HOSTSIM_EnetTimerRestart(enet, enet->timerStart);
+        }
+        else
+        {
+            /* Configuration only. */
+        }
+        if ((newValue & ENET_ATCR_CAPTURE_MASK) != 0U)
+        {
+            regs->ATVR = HOSTSIM_EnetTimerNs(enet);
+        }
+        regs->ATCR = newValue & ~(ENET_ATCR_CAPTURE_MASK | ENET_ATCR_RESTART_MASK);
+    }
+    else if (offset == offsetof(ENET_Type, ATVR))
+    {
+        HOSTSIM_EnetTimerRestart(enet, newValue);
+    }
+    else
+    {
+        for (ringId = 0U; ringId < HOSTSIM_ENET_RINGS; ringId++)
+        {
+            if (offset == (uint32_t)((uintptr_t)HOSTSIM_EnetTdar(regs, ringId) - (uintptr_t)regs))
+            {
+                *HOSTSIM_EnetTdar(regs, ringId) =
+                    ((regs->ECR & ENET_ECR_ETHEREN_MASK) != 0U) ? ENET_TDAR_TDAR_MASK : 0U;
+            }
+            else if (offset == (uint32_t)((uintptr_t)HOSTSIM_EnetRdar(regs, ringId) - (uintptr_t)regs))
+            {
+                *HOSTSIM_EnetRdar(regs, ringId) =
+                    ((regs->ECR & ENET_ECR_ETHEREN_MASK) != 0U) ? ENET_RDAR_RDAR_MASK : 0U;
+            }
+            else if (offset == (uint32_t)((uintptr_t)HOSTSIM_EnetTdsr(regs, ringId) - (uintptr_t)regs))
+            {
+                enet->txBd[ringId] = newValue;
+            }
+            else if (offset == (uint32_t)((uintptr_t)HOSTSIM_EnetRdsr(regs, ringId) - (uintptr_t)regs))
+            {
+                enet->rxBd[ringId] = newValue;
+            }
+            else
+            {
+                /* Not a register of this ring. */
+            }
+        }
+    }
+
+    HOSTSIM_EnetTxStart(enet);
+    HOSTSIM_EnetUpdateIrqs(enet);
+}
+
+void HOSTSIM_EnetSetOutput(ENET_Type *base, hostsim_enet_output_callback_t callback, void *userData)
+{
+    hostsim_enet_t *enet = HOSTSIM_EnetGet(base);
+
+    enet->output         = callback;
+    enet->outputUserData = userData;
+}
+
+bool HOSTSIM_EnetSend(ENET_Type *base, const uint8_t *frame, size_t length)
+{
+    hostsim_enet_t *enet = HOSTSIM_EnetGet(base);
+    hostsim_enet_frame_t *input;
+
+    if ((enet->inputCount == HOSTSIM_ENET_INPUT_FRAMES) || (length > HOSTSIM_ENET_FRAME_MAX))
+    {
+        return false;
+    }
+    input         = &enet->input[(enet->inputHead + enet->inputCount) % HOSTSIM_ENET_INPUT_FRAMES];
+    input->length = (uint32_t)length;
+    (void)memcpy(input->data, frame, length);
+    enet->inputCount++;
+    HOSTSIM_EnetScheduleRx(enet);
+    return true;
+}
+
+void HOSTSIM_EnetSetPhyRegister(ENET_Type *base, uint32_t phyReg, uint16_t value)
+{
+    HOSTSIM_EnetGet(base)->phy[phyReg & 0x1FU] = value;
+}
+
+__attribute__((constructor(102))) static void HOSTSIM_EnetInit(void)
+{
+    hostsim_enet_t *enet;
+    uint32_t instance;
+    uint32_t i;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_enetBases); instance++)
+    {
+        enet       = &s_enets[instance];
+        enet->base = s_enetBases[instance];
+        for (i = 0U; i < ARRAY_SIZE(s_enetIrqs); i++)
+        {
+            if (s_enetIrqs[i].base == enet->base)
+            {
+                (void)memcpy(enet->irqs, s_enetIrqs[i].irqs, sizeof(enet->irqs));
+            }
+        }
+
+        enet->phy[HOSTSIM_ENET_PHY_BMCR] =
+            HOSTSIM_ENET_PHY_BMCR_AN_ENABLE | HOSTSIM_ENET_PHY_BMCR_DUPLEX | HOSTSIM_ENET_PHY_BMCR_SPEED1;
+        enet->phy[HOSTSIM_ENET_PHY_BMSR]            = HOSTSIM_ENET_AR8031_BMSR;
+        enet->phy[HOSTSIM_ENET_PHY_ID1]             = HOSTSIM_ENET_AR8031_ID1;
+        enet->phy[HOSTSIM_ENET_PHY_ID2]             = HOSTSIM_ENET_AR8031_ID2;
+        enet->phy[HOSTSIM_ENET_PHY_SPECIFIC_STATUS] = HOSTSIM_ENET_AR8031_SPECIFIC_STATUS;
+
+        HOSTSIM_RegionInit(&enet->region, "ENET", (uintptr_t)enet->base, sizeof(ENET_Type), &s_enetOps, enet);
+        HOSTSIM_EnetReset(enet);
+    }
+}
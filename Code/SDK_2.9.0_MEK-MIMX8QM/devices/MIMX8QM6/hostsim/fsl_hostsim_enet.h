@@ -0,0 +1,104 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HOSTSIM_ENET_H_
+#define _FSL_HOSTSIM_ENET_H_
+
+#include "fsl_device_registers.h"
+#include "fsl_hostsim.h"
+
+/*!
+ * @addtogroup hostsim_enet
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Largest frame the simulated ENET instances transmit or receive, in bytes. */
+#ifndef HOSTSIM_ENET_FRAME_MAX
+#define HOSTSIM_ENET_FRAME_MAX (2048U)
+#endif
+
+/*! @brief Number of the frames sent by the host that an ENET instance queues. */
+#ifndef HOSTSIM_ENET_INPUT_FRAMES
+#define HOSTSIM_ENET_INPUT_FRAMES (32U)
+#endif
+
+/*! @brief Duration of an MDIO frame, in ns. */
+#ifndef HOSTSIM_ENET_MDIO_TIME_NS
+#define HOSTSIM_ENET_MDIO_TIME_NS (25600U)
+#endif
+
+/*!
+ * @brief Output callback, called with each frame the ENET transmitted.
+ *
+ * @param base The ENET peripheral base address.
+ * @param ringId The transmit ring the frame was sent from.
+ * @param frame The frame, from the destination address to the payload, without the FCS.
+ * @param length Length of the frame, in bytes.
+ * @param userData Parameter of the callback.
+ */
+typedef void (*hostsim_enet_output_callback_t)(ENET_Type *base,
+                                               uint32_t ringId,
+                                               const uint8_t *frame,
+                                               size_t length,
+                                               void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Sets the callback receiving the frames an ENET transmits.
+ *
+ * By default the frames are discarded. The frames transmitted in MAC or PHY loopback are received by the
+ * ENET itself instead.
+ *
+ * @param base The ENET peripheral base address.
+ * @param callback The callback, NULL to discard the frames.
+ * @param userData Parameter of the callback.
+ */
+void HOSTSIM_EnetSetOutput(ENET_Type *base, hostsim_enet_output_callback_t callback, void *userData);
+
+/*!
+ * @brief Sends a frame to an ENET.
+ *
+ * The frames arrive one after the other at the line rate, filtered by the receive address filters, in the
+ * buffer descriptors of the receive ring selected by the receive classification (RCMR): VLAN tagged frames
+ * go to the ring of the first classifier matching their priority, the other frames to ring 0.
+ *
+ * @param base The ENET peripheral base address.
+ * @param frame The frame, from the destination address to the payload, without the FCS.
+ * @param length Length of the frame, in bytes.
+ * @retval true The frame is queued.
+ * @retval false The input queue is full, or the frame is too long.
+ */
+bool HOSTSIM_EnetSend(ENET_Type *base, const uint8_t *frame, size_t length);
+
+/*!
+ * @brief Sets a register of the PHY of an ENET.
+ *
+ * The PHY answers on every MDIO address. It starts as an AR8031 with the link up at 1 Gbit/s full duplex.
+ *
+ * @param base The ENET peripheral base address.
+ * @param phyReg The Clause 22 PHY register.
+ * @param value The register value.
+ */
+void HOSTSIM_EnetSetPhyRegister(ENET_Type *base, uint32_t phyReg, uint16_t value);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HOSTSIM_ENET_H_ */
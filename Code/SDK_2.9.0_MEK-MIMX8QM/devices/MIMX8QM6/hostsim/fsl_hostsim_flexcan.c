@@ -0,0 +1,993 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_hostsim_flexcan.h"
+#include "fsl_common.h"
+
+/*
+ * FlexCAN model: the message buffers, with the 8, 16, 32 or 64 byte payloads of CAN FD, and the legacy
+ * Rx FIFO with its filter table in formats A to D. The simulated instances and the host share one bus,
+ * where the frame with the lowest identifier wins the arbitration, and the frames last the number of bits
+ * of their format at the bit rates of the sender, without stuff bits.
+ *
+ * Reading the control and status word of a message buffer locks it until the free running timer is read,
+ * a frame for a locked buffer waits in the serial message buffer. The bus errors, the error counters, the
+ * remote request answers, the Rx FIFO DMA and the low power modes other than the module disable are not
+ * modelled.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_FLEXCAN_MB_MAX ((uint32_t)FSL_FEATURE_FLEXCAN_HAS_MESSAGE_BUFFER_MAX_NUMBERn(0))
+
+/* The message buffer RAM is made of 512 byte blocks, from offset 0x80. */
+#define HOSTSIM_FLEXCAN_RAM_OFFSET  ((uint32_t)offsetof(CAN_Type, MB))
+#define HOSTSIM_FLEXCAN_BLOCK_SIZE  (512U)
+#define HOSTSIM_FLEXCAN_BLOCK_COUNT (HOSTSIM_FLEXCAN_MB_MAX * 16U / HOSTSIM_FLEXCAN_BLOCK_SIZE)
+
+/* Words of a message buffer. */
+#define HOSTSIM_FLEXCAN_MB_CS   (0U)
+#define HOSTSIM_FLEXCAN_MB_ID   (1U)
+#define HOSTSIM_FLEXCAN_MB_DATA (2U)
+
+/* Message buffer codes. */
+#define HOSTSIM_FLEXCAN_CODE_RX_EMPTY    (0x4U)
+#define HOSTSIM_FLEXCAN_CODE_RX_FULL     (0x2U)
+#define HOSTSIM_FLEXCAN_CODE_RX_OVERRUN  (0x6U)
+#define HOSTSIM_FLEXCAN_CODE_TX_INACTIVE (0x8U)
+#define HOSTSIM_FLEXCAN_CODE_TX_DATA     (0xCU)
+
+/* Legacy Rx FIFO: depth, filter table from message buffer 6, and the formats of the table elements. */
+#define HOSTSIM_FLEXCAN_FIFO_DEPTH    (6U)
+#define HOSTSIM_FLEXCAN_FIFO_WARNING  (5U)
+#define HOSTSIM_FLEXCAN_FIFO_TABLE_MB (6U)
+#define HOSTSIM_FLEXCAN_FIFO_IMR_MAX  (32U)
+#define HOSTSIM_FLEXCAN_FIFO_FORMAT_A (0U)
+#define HOSTSIM_FLEXCAN_FIFO_FORMAT_B (1U)
+#define HOSTSIM_FLEXCAN_FIFO_FORMAT_C (2U)
+
+/* Frame lengths, in bits: classic standard and extended frames, then the CAN FD arbitration and data phases. */
+#define HOSTSIM_FLEXCAN_BITS_STD          (47U)
+#define HOSTSIM_FLEXCAN_BITS_EXT          (67U)
+#define HOSTSIM_FLEXCAN_BITS_FD_STD       (42U)
+#define HOSTSIM_FLEXCAN_BITS_FD_EXT       (61U)
+#define HOSTSIM_FLEXCAN_BITS_FD_CRC17     (27U)
+#define HOSTSIM_FLEXCAN_BITS_FD_CRC21     (32U)
+#define HOSTSIM_FLEXCAN_BITS_INTERMISSION (3U)
+
+/* Value of MCR after a soft reset, but MDIS. */
+#define HOSTSIM_FLEXCAN_MCR_SOFTRST (0x5880000FU)
+
+/* Interrupt flags cleared by writing one in ESR1. */
+#define HOSTSIM_FLEXCAN_ESR1_W1C                                                                       \
+    (CAN_ESR1_ERRINT_MASK | CAN_ESR1_BOFFINT_MASK | CAN_ESR1_RWRNINT_MASK | CAN_ESR1_TWRNINT_MASK | \
+     CAN_ESR1_WAKINT_MASK | CAN_ESR1_BOFFDONEINT_MASK | CAN_ESR1_ERRINT_FAST_MASK | CAN_ESR1_ERROVR_MASK)
+
+typedef struct _hostsim_flexcan_fifo_entry
+{
+    hostsim_flexcan_frame_t frame;
+    uint16_t timestamp;
+    uint16_t idhit;
+} hostsim_flexcan_fifo_entry_t;
+
+typedef struct _hostsim_flexcan
+{
+    hostsim_region_t region;
+    CAN_Type *base;
+    IRQn_Type irq;
+    uint32_t clockHz;
+    uint64_t timerStartNs;
+
+    hostsim_flexcan_fifo_entry_t fifo[HOSTSIM_FLEXCAN_FIFO_DEPTH];
+    uint32_t fifoHead;
+    uint32_t fifoCount;
+
+    int32_t lockedMb;
+    bool smbValid;
+    hostsim_flexcan_frame_t smb;
+} hostsim_flexcan_t;
+
+typedef struct _hostsim_flexcan_bus
+{
+    bool busy;
+    hostsim_event_t event;
+    hostsim_flexcan_t *sender; /* NULL while the host sends. */
+    uint32_t senderMb;
+    hostsim_flexcan_frame_t frame;
+
+    hostsim_flexcan_frame_t input[HOSTSIM_FLEXCAN_INPUT_FRAMES];
+    uint32_t inputHead;
+    uint32_t inputCount;
+
+    hostsim_flexcan_output_callback_t output;
+    void *outputUserData;
+} hostsim_flexcan_bus_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void HOSTSIM_FlexcanRefresh(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_FlexcanReadDone(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_FlexcanWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+static void HOSTSIM_FlexcanBusDone(void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static CAN_Type *const s_flexcanBases[]   = CAN_BASE_PTRS;
+static const IRQn_Type s_flexcanMbIrqs[] = CAN_ORed_Message_buffer_IRQS;
+static hostsim_flexcan_t s_flexcans[ARRAY_SIZE(s_flexcanBases)];
+static hostsim_flexcan_bus_t s_flexcanBus;
+
+/* Data length of the DLC codes. */
+static const uint8_t s_flexcanDlcLength[16] = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U};
+
+/* Message buffer size of the MBDSR codes, in bytes. */
+static const uint32_t s_flexcanMbSize[4] = {16U, 24U, 40U, 72U};
+
+static const hostsim_region_ops_t s_flexcanOps = {
+    .refresh  = HOSTSIM_FlexcanRefresh,
+    .readDone = HOSTSIM_FlexcanReadDone,
+    .write    = HOSTSIM_FlexcanWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static hostsim_flexcan_t *HOSTSIM_FlexcanGet(CAN_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_flexcanBases); instance++)
+    {
+        if (s_flexcanBases[instance] == base)
+        {
+            return &s_flexcans[instance];
+        }
+    }
+    HOSTSIM_Fatal("FlexCAN 0x%08x is not simulated", (unsigned)(uintptr_t)base);
+}
+
+static inline CAN_Type *HOSTSIM_FlexcanRegs(hostsim_flexcan_t *flexcan)
+{
+    return (CAN_Type *)(uintptr_t)flexcan->region.regs;
+}
+
+/* Size of the message buffers of a RAM block, 16 bytes unless CAN FD is enabled. */
+static uint32_t HOSTSIM_FlexcanMbSize(hostsim_flexcan_t *flexcan, uint32_t block)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+    uint32_t field = (regs->FDCTRL & CAN_FDCTRL_MBDSR0_MASK) >> CAN_FDCTRL_MBDSR0_SHIFT;
+
+    if ((regs->MCR & CAN_MCR_FDEN_MASK) == 0U)
+    {
+        return s_flexcanMbSize[0];
+    }
+#if defined(CAN_FDCTRL_MBDSR1_MASK)
+    if (block == 1U)
+    {
+        field = (regs->FDCTRL & CAN_FDCTRL_MBDSR1_MASK) >> CAN_FDCTRL_MBDSR1_SHIFT;
+    }
+#else
+    (void)block;
+#endif /* CAN_FDCTRL_MBDSR1_MASK */
+    return s_flexcanMbSize[field];
+}
+
+/* Number of message buffers, limited by MCR[MAXMB] and by the RAM. */
+static uint32_t HOSTSIM_FlexcanMbCount(hostsim_flexcan_t *flexcan)
+{
+    uint32_t count = 0U;
+    uint32_t block;
+    uint32_t maxMb = ((HOSTSIM_FlexcanRegs(flexcan)->MCR & CAN_MCR_MAXMB_MASK) >> CAN_MCR_MAXMB_SHIFT) + 1U;
+
+    for (block = 0U; block < HOSTSIM_FLEXCAN_BLOCK_COUNT; block++)
+    {
+        count += HOSTSIM_FLEXCAN_BLOCK_SIZE / HOSTSIM_FlexcanMbSize(flexcan, block);
+    }
+    return (maxMb < count) ? maxMb : count;
+}
+
+/* Word of a message buffer. */
+static volatile uint32_t *HOSTSIM_FlexcanMbWord(hostsim_flexcan_t *flexcan, uint32_t mbIdx, uint32_t word)
+{
+    uint32_t offset = HOSTSIM_FLEXCAN_RAM_OFFSET;
+    uint32_t block;
+    uint32_t perBlock;
+
+    for (block = 0U; block < HOSTSIM_FLEXCAN_BLOCK_COUNT; block++)
+    {
+        perBlock = HOSTSIM_FLEXCAN_BLOCK_SIZE / HOSTSIM_FlexcanMbSize(flexcan, block);
+        if (mbIdx < perBlock)
+        {
+            offset += mbIdx * HOSTSIM_FlexcanMbSize(flexcan, block);
+            break;
+        }
+        mbIdx -= perBlock;
+        offset += HOSTSIM_FLEXCAN_BLOCK_SIZE;
+    }
+    return (volatile uint32_t *)(uintptr_t)(flexcan->region.regs + offset + (word * sizeof(uint32_t)));
+}
+
+/* Message buffer of a control and status word, -1 for any other offset. */
+static int32_t HOSTSIM_FlexcanCsMb(hostsim_flexcan_t *flexcan, uint32_t offset)
+{
+    uint32_t block;
+    uint32_t mbSize;
+    uint32_t inBlock;
+    uint32_t mbIdx = 0U;
+
+    if ((offset < HOSTSIM_FLEXCAN_RAM_OFFSET) ||
+        (offset >= (HOSTSIM_FLEXCAN_RAM_OFFSET + (HOSTSIM_FLEXCAN_BLOCK_COUNT * HOSTSIM_FLEXCAN_BLOCK_SIZE))))
+    {
+        return -1;
+    }
+
+    block   = (offset - HOSTSIM_FLEXCAN_RAM_OFFSET) / HOSTSIM_FLEXCAN_BLOCK_SIZE;
+    inBlock = (offset - HOSTSIM_FLEXCAN_RAM_OFFSET) % HOSTSIM_FLEXCAN_BLOCK_SIZE;
+    mbSize  = HOSTSIM_FlexcanMbSize(flexcan, block);
+    if (((inBlock % mbSize) != 0U) || ((inBlock / mbSize) >= (HOSTSIM_FLEXCAN_BLOCK_SIZE / mbSize)))
+    {
+        return -1;
+    }
+    while (block > 0U)
+    {
+        block--;
+        mbIdx += HOSTSIM_FLEXCAN_BLOCK_SIZE / HOSTSIM_FlexcanMbSize(flexcan, block);
+    }
+    mbIdx += inBlock / mbSize;
+    return (mbIdx < HOSTSIM_FlexcanMbCount(flexcan)) ? (int32_t)mbIdx : -1;
+}
+
+/* First message buffer after the Rx FIFO and its filter table. */
+static uint32_t HOSTSIM_FlexcanFirstMb(hostsim_flexcan_t *flexcan)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+
+    if ((regs->MCR & CAN_MCR_RFEN_MASK) == 0U)
+    {
+        return 0U;
+    }
+    return HOSTSIM_FLEXCAN_FIFO_TABLE_MB + (((regs->CTRL2 & CAN_CTRL2_RFFN_MASK) >> CAN_CTRL2_RFFN_SHIFT) + 1U) * 2U;
+}
+
+static void HOSTSIM_FlexcanSetMbFlag(hostsim_flexcan_t *flexcan, uint32_t mbIdx)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+
+    if (mbIdx < 32U)
+    {
+        regs->IFLAG1 |= 1UL << mbIdx;
+    }
+    else
+    {
+        regs->IFLAG2 |= 1UL << (mbIdx - 32U);
+    }
+}
+
+/* A full message buffer is serviced, free to receive again, once its flag is cleared. */
+static bool HOSTSIM_FlexcanMbServiced(hostsim_flexcan_t *flexcan, uint32_t mbIdx)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+
+    if (mbIdx < 32U)
+    {
+        return (regs->IFLAG1 & (1UL << mbIdx)) == 0U;
+    }
+    return (regs->IFLAG2 & (1UL << (mbIdx - 32U))) == 0U;
+}
+
+static void HOSTSIM_FlexcanUpdateIrq(hostsim_flexcan_t *flexcan)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+
+    HOSTSIM_SetIrqLevel((int32_t)flexcan->irq,
+                        ((regs->IFLAG1 & regs->IMASK1) | (regs->IFLAG2 & regs->IMASK2)) != 0U);
+}
+
+/* The instance takes part in the bus: enabled, out of freeze mode. */
+static bool HOSTSIM_FlexcanOnBus(hostsim_flexcan_t *flexcan)
+{
+    return (HOSTSIM_FlexcanRegs(flexcan)->MCR & (CAN_MCR_MDIS_MASK | CAN_MCR_FRZACK_MASK)) == 0U;
+}
+
+/* Nominal and data phase bit times, in ns. */
+static uint64_t HOSTSIM_FlexcanBitTimeNs(hostsim_flexcan_t *flexcan, bool dataPhase)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+    uint64_t prescaler;
+    uint64_t quanta;
+
+    if (dataPhase)
+    {
+        prescaler = ((regs->FDCBT & CAN_FDCBT_FPRESDIV_MASK) >> CAN_FDCBT_FPRESDIV_SHIFT) + 1U;
+        quanta    = 1U + ((regs->FDCBT & CAN_FDCBT_FPROPSEG_MASK) >> CAN_FDCBT_FPROPSEG_SHIFT) +
+                 ((regs->FDCBT & CAN_FDCBT_FPSEG1_MASK) >> CAN_FDCBT_FPSEG1_SHIFT) + 1U +
+                 ((regs->FDCBT & CAN_FDCBT_FPSEG2_MASK) >> CAN_FDCBT_FPSEG2_SHIFT) + 1U;
+    }
+    else if ((regs->CBT & CAN_CBT_BTF_MASK) != 0U)
+    {
+        prescaler = ((regs->CBT & CAN_CBT_EPRESDIV_MASK) >> CAN_CBT_EPRESDIV_SHIFT) + 1U;
+        quanta    = 1U + ((regs->CBT & CAN_CBT_EPROPSEG_MASK) >> CAN_CBT_EPROPSEG_SHIFT) + 1U +
+                 ((regs->CBT & CAN_CBT_EPSEG1_MASK) >> CAN_CBT_EPSEG1_SHIFT) + 1U +
+                 ((regs->CBT & CAN_CBT_EPSEG2_MASK) >> CAN_CBT_EPSEG2_SHIFT) + 1U;
+    }
+    else
+    {
+        prescaler = ((regs->CTRL1 & CAN_CTRL1_PRESDIV_MASK) >> CAN_CTRL1_PRESDIV_SHIFT) + 1U;
+        quanta    = 1U + ((regs->CTRL1 & CAN_CTRL1_PROPSEG_MASK) >> CAN_CTRL1_PROPSEG_SHIFT) + 1U +
+                 ((regs->CTRL1 & CAN_CTRL1_PSEG1_MASK) >> CAN_CTRL1_PSEG1_SHIFT) + 1U +
+                 ((regs->CTRL1 & CAN_CTRL1_PSEG2_MASK) >> CAN_CTRL1_PSEG2_SHIFT) + 1U;
+    }
+    return (prescaler * quanta * 1000000000ULL) / flexcan->clockHz;
+}
+
+/* Free running timer, counting the nominal bits. */
+static uint16_t HOSTSIM_FlexcanTimer(hostsim_flexcan_t *flexcan)
+{
+    uint64_t bitTimeNs = HOSTSIM_FlexcanBitTimeNs(flexcan, false);
+
+    return (uint16_t)((HOSTSIM_GetTimeNs() - flexcan->timerStartNs) / ((bitTimeNs != 0U) ? bitTimeNs : 1U));
+}
+
+/* Duration of a frame on the bus, sent with the bit timing of an instance or, for the host, of the first
+ * instance on the bus. */
+static uint64_t HOSTSIM_FlexcanFrameTimeNs(hostsim_flexcan_t *sender, const hostsim_flexcan_frame_t *frame)
+{
+    uint64_t nominalNs = HOSTSIM_FLEXCAN_BIT_TIME_NS;
+    uint64_t dataNs    = HOSTSIM_FLEXCAN_BIT_TIME_NS;
+    uint32_t length    = frame->remote ? 0U : frame->length;
+    uint32_t instance;
+    uint64_t nominalBits;
+    uint64_t dataBits;
+
+    for (instance = 0U; (sender == NULL) && (instance < ARRAY_SIZE(s_flexcans)); instance++)
+    {
+        if (HOSTSIM_FlexcanOnBus(&s_flexcans[instance]))
+        {
+            sender = &s_flexcans[instance];
+        }
+    }
+    if (sender != NULL)
+    {
+        nominalNs = HOSTSIM_FlexcanBitTimeNs(sender, false);
+        dataNs    = frame->brs ? HOSTSIM_FlexcanBitTimeNs(sender, true) : nominalNs;
+    }
+
+    if (frame->fd)
+    {
+        nominalBits = frame->extended ? HOSTSIM_FLEXCAN_BITS_FD_EXT : HOSTSIM_FLEXCAN_BITS_FD_STD;
+        dataBits    = (8U * (uint64_t)length) +
+                   ((length > 16U) ? HOSTSIM_FLEXCAN_BITS_FD_CRC21 : HOSTSIM_FLEXCAN_BITS_FD_CRC17);
+    }
+    else
+    {
+        nominalBits = (frame->extended ? HOSTSIM_FLEXCAN_BITS_EXT : HOSTSIM_FLEXCAN_BITS_STD) + (8U * (uint64_t)length);
+        dataBits    = 0U;
+    }
+    return ((nominalBits + HOSTSIM_FLEXCAN_BITS_INTERMISSION) * nominalNs) + (dataBits * dataNs);
+}
+
+/* Arbitration field: the base identifier, SRR and IDE, the identifier extension, RTR. Lowest wins. */
+static uint64_t HOSTSIM_FlexcanArbitration(const hostsim_flexcan_frame_t *frame)
+{
+    uint64_t field;
+
+    if (frame->extended)
+    {
+        field = ((uint64_t)(frame->id >> 18U) << 21U) | (3ULL << 19U) | ((uint64_t)(frame->id & 0x3FFFFU) << 1U);
+    }
+    else
+    {
+        field = (uint64_t)frame->id << 21U;
+    }
+    return field | (frame->remote ? 1U : 0U);
+}
+
+/* Identifier in the layout of the ID word of the message buffers. */
+static uint32_t HOSTSIM_FlexcanIdWord(const hostsim_flexcan_frame_t *frame)
+{
+    return frame->extended ? (frame->id & (CAN_ID_STD_MASK | CAN_ID_EXT_MASK)) :
+                             ((frame->id << CAN_ID_STD_SHIFT) & CAN_ID_STD_MASK);
+}
+
+static void HOSTSIM_FlexcanReadMb(hostsim_flexcan_t *flexcan, uint32_t mbIdx, hostsim_flexcan_frame_t *frame)
+{
+    uint32_t cs = *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_CS);
+    uint32_t id = *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_ID);
+    uint32_t word;
+    uint32_t i;
+
+    frame->extended = (cs & CAN_CS_IDE_MASK) != 0U;
+    frame->remote   = (cs & CAN_CS_RTR_MASK) != 0U;
+    frame->fd       = (cs & CAN_CS_EDL_MASK) != 0U;
+    frame->brs      = frame->fd && ((cs & CAN_CS_BRS_MASK) != 0U);
+    frame->id       = frame->extended ? (id & (CAN_ID_STD_MASK | CAN_ID_EXT_MASK)) :
+                                        ((id & CAN_ID_STD_MASK) >> CAN_ID_STD_SHIFT);
+    frame->length   = s_flexcanDlcLength[(cs & CAN_CS_DLC_MASK) >> CAN_CS_DLC_SHIFT];
+    if ((!frame->fd) && (frame->length > 8U))
+    {
+        frame->length = 8U;
+    }
+
+    /* The data words are big endian. */
+    for (i = 0U; i < frame->length; i++)
+    {
+        word           = *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_DATA + (i / 4U));
+        frame->data[i] = (uint8_t)(word >> (24U - (8U * (i % 4U))));
+    }
+}
+
+static void HOSTSIM_FlexcanWriteMb(hostsim_flexcan_t *flexcan,
+                                   uint32_t mbIdx,
+                                   uint32_t code,
+                                   const hostsim_flexcan_frame_t *frame,
+                                   uint16_t timestamp)
+{
+    uint32_t cs  = CAN_CS_CODE(code) | CAN_CS_TIME_STAMP(timestamp);
+    uint32_t dlc = 0U;
+    uint32_t word;
+    uint32_t i;
+
+    while ((dlc < 15U) && (s_flexcanDlcLength[dlc] < frame->length))
+    {
+        dlc++;
+    }
+    cs |= CAN_CS_DLC(dlc) | (frame->extended ? (CAN_CS_IDE_MASK | CAN_CS_SRR_MASK) : 0U) |
+          (frame->remote ? CAN_CS_RTR_MASK : 0U) | (frame->fd ? CAN_CS_EDL_MASK : 0U) |
+          (frame->brs ? CAN_CS_BRS_MASK : 0U);
+
+    for (i = 0U; i < ((frame->length + 3U) / 4U); i++)
+    {
+        word = ((uint32_t)frame->data[4U * i] << 24U) | ((uint32_t)frame->data[(4U * i) + 1U] << 16U) |
+               ((uint32_t)frame->data[(4U * i) + 2U] << 8U) | frame->data[(4U * i) + 3U];
+        *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_DATA + i) = word;
+    }
+    *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_ID) = HOSTSIM_FlexcanIdWord(frame);
+    *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_CS) = cs;
+}
+
+/* Shows the frame at the head of the Rx FIFO in message buffer 0. */
+static void HOSTSIM_FlexcanFifoShowHead(hostsim_flexcan_t *flexcan)
+{
+    hostsim_flexcan_fifo_entry_t *entry = &flexcan->fifo[flexcan->fifoHead];
+    CAN_Type *regs                      = HOSTSIM_FlexcanRegs(flexcan);
+
+    if (flexcan->fifoCount == 0U)
+    {
+        return;
+    }
+    HOSTSIM_FlexcanWriteMb(flexcan, 0U, 0U, &entry->frame, entry->timestamp);
+    HOSTSIM_Write32(&flexcan->region, (uint32_t)offsetof(CAN_Type, RXFIR), entry->idhit);
+    regs->IFLAG1 |= CAN_IFLAG1_BUF5I_MASK;
+}
+
+/* Match of a frame with an element of the Rx FIFO filter table. */
+static bool HOSTSIM_FlexcanFifoMatch(uint32_t format,
+                                     uint32_t element,
+                                     uint32_t mask,
+                                     const hostsim_flexcan_frame_t *frame)
+{
+    uint32_t flags = (frame->remote ? 0x80000000U : 0U) | (frame->extended ? 0x40000000U : 0U);
+    uint32_t candidate;
+    uint32_t slots;
+    uint32_t shift;
+
+    switch (format)
+    {
+        case HOSTSIM_FLEXCAN_FIFO_FORMAT_A:
+            candidate = flags | (frame->extended ? ((frame->id & 0x1FFFFFFFU) << 1U) : ((frame->id & 0x7FFU) << 19U));
+            return ((candidate ^ element) & mask) == 0U;
+
+        case HOSTSIM_FLEXCAN_FIFO_FORMAT_B:
+            candidate = flags | (frame->extended ? ((frame->id >> 15U) << 16U) : ((frame->id & 0x7FFU) << 19U));
+            slots     = candidate | (candidate >> 16U);
+            return ((((slots ^ element) & mask) & 0xFFFF0000U) == 0U) ||
+                   ((((slots ^ element) & mask) & 0x0000FFFFU) == 0U);
+
+        case HOSTSIM_FLEXCAN_FIFO_FORMAT_C:
+            candidate = frame->extended ? ((frame->id >> 21U) & 0xFFU) : ((frame->id >> 3U) & 0xFFU);
+            for (shift = 0U; shift < 32U; shift += 8U)
+            {
+                if ((((candidate << shift) ^ element) & mask & (0xFFUL << shift)) == 0U)
+                {
+                    return true;
+                }
+            }
+            return false;
+
+        default:
+            /* Format D rejects all the frames. */
+            return false;
+    }
+}
+
+static bool HOSTSIM_FlexcanFifoReceive(hostsim_flexcan_t *flexcan, const hostsim_flexcan_frame_t *frame)
+{
+    CAN_Type *regs   = HOSTSIM_FlexcanRegs(flexcan);
+    uint32_t format  = (regs->MCR & CAN_MCR_IDAM_MASK) >> CAN_MCR_IDAM_SHIFT;
+    uint32_t count   = (((regs->CTRL2 & CAN_CTRL2_RFFN_MASK) >> CAN_CTRL2_RFFN_SHIFT) + 1U) * 8U;
+    uint32_t imrNum;
+    uint32_t element;
+    uint32_t mask;
+    uint32_t i;
+    hostsim_flexcan_fifo_entry_t *entry;
+
+    if (((regs->MCR & CAN_MCR_RFEN_MASK) == 0U) || frame->fd)
+    {
+        return false;
+    }
+
+    /* With individual masking, the elements of the message buffers taken by the Rx FIFO, 8 + 2 * RFFN up to
+     * 32, use their own mask. */
+    imrNum = HOSTSIM_FlexcanFirstMb(flexcan);
+    if ((regs->MCR & CAN_MCR_IRMQ_MASK) == 0U)
+    {
+        imrNum = 0U;
+    }
+    else if (imrNum > HOSTSIM_FLEXCAN_FIFO_IMR_MAX)
+    {
+        imrNum = HOSTSIM_FLEXCAN_FIFO_IMR_MAX;
+    }
+    else
+    {
+        /* Less than 32 elements have their own mask. */
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        element = *HOSTSIM_FlexcanMbWord(flexcan, HOSTSIM_FLEXCAN_FIFO_TABLE_MB + (i / 4U), i % 4U);
+        mask    = (i < imrNum) ? regs->RXIMR[i] : regs->RXFGMASK;
+        if (!HOSTSIM_FlexcanFifoMatch(format, element, mask, frame))
+        {
+            continue;
+        }
+
+        if (flexcan->fifoCount == HOSTSIM_FLEXCAN_FIFO_DEPTH)
+        {
+            regs->IFLAG1 |= CAN_IFLAG1_BUF7I_MASK;
+            return true;
+        }
+        entry = &flexcan->fifo[(flexcan->fifoHead + flexcan->fifoCount) % HOSTSIM_FLEXCAN_FIFO_DEPTH];
+        entry->frame     = *frame;
+        entry->timestamp = HOSTSIM_FlexcanTimer(flexcan);
+        entry->idhit     = (uint16_t)i;
+        flexcan->fifoCount++;
+        if (flexcan->fifoCount == HOSTSIM_FLEXCAN_FIFO_WARNING)
+        {
+            regs->IFLAG1 |= CAN_IFLAG1_BUF6I_MASK;
+        }
+        if (flexcan->fifoCount == 1U)
+        {
+            HOSTSIM_FlexcanFifoShowHead(flexcan);
+        }
+        return true;
+    }
+    return false;
+}
+
+static uint32_t HOSTSIM_FlexcanMbMask(hostsim_flexcan_t *flexcan, uint32_t mbIdx)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+
+    if ((regs->MCR & CAN_MCR_IRMQ_MASK) != 0U)
+    {
+        return regs->RXIMR[mbIdx];
+    }
+    if (mbIdx == 14U)
+    {
+        return regs->RX14MASK;
+    }
+    if (mbIdx == 15U)
+    {
+        return regs->RX15MASK;
+    }
+    return regs->RXMGMASK;
+}
+
+/*
+ * Moves a frame in the first empty or serviced matching message buffer, else in the last full one, which is
+ * overrun.
+ * A locked buffer is skipped; if it is the only match, the frame waits in the serial message buffer.
+ */
+static bool HOSTSIM_FlexcanMbReceive(hostsim_flexcan_t *flexcan, const hostsim_flexcan_frame_t *frame)
+{
+    uint32_t idWord  = HOSTSIM_FlexcanIdWord(frame);
+    uint32_t count   = HOSTSIM_FlexcanMbCount(flexcan);
+    int32_t full     = -1;
+    bool lockedMatch = false;
+    uint32_t mbIdx;
+    uint32_t cs;
+    uint32_t code;
+
+    for (mbIdx = HOSTSIM_FlexcanFirstMb(flexcan); mbIdx < count; mbIdx++)
+    {
+        cs   = *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_CS);
+        code = (cs & CAN_CS_CODE_MASK) >> CAN_CS_CODE_SHIFT;
+        if (((code != HOSTSIM_FLEXCAN_CODE_RX_EMPTY) && (code != HOSTSIM_FLEXCAN_CODE_RX_FULL) &&
+             (code != HOSTSIM_FLEXCAN_CODE_RX_OVERRUN)) ||
+            (((cs & CAN_CS_IDE_MASK) != 0U) != frame->extended) ||
+            (((idWord ^ *HOSTSIM_FlexcanMbWord(flexcan, mbIdx, HOSTSIM_FLEXCAN_MB_ID)) &
+              HOSTSIM_FlexcanMbMask(flexcan, mbIdx) & (CAN_ID_STD_MASK | CAN_ID_EXT_MASK)) != 0U))
+        {
+            continue;
+        }
+        if ((int32_t)mbIdx == flexcan->lockedMb)
+        {
+            lockedMatch = true;
+            continue;
+        }
+        if ((code == HOSTSIM_FLEXCAN_CODE_RX_EMPTY) || HOSTSIM_FlexcanMbServiced(flexcan, mbIdx))
+        {
+            HOSTSIM_FlexcanWriteMb(flexcan, mbIdx, HOSTSIM_FLEXCAN_CODE_RX_FULL, frame, HOSTSIM_FlexcanTimer(flexcan));
+            HOSTSIM_FlexcanSetMbFlag(flexcan, mbIdx);
+            return true;
+        }
+        full = (int32_t)mbIdx;
+    }
+
+    if (lockedMatch)
+    {
+        flexcan->smb      = *frame;
+        flexcan->smbValid = true;
+        return true;
+    }
+    if (full >= 0)
+    {
+        HOSTSIM_FlexcanWriteMb(flexcan, (uint32_t)full, HOSTSIM_FLEXCAN_CODE_RX_OVERRUN, frame,
+                               HOSTSIM_FlexcanTimer(flexcan));
+        HOSTSIM_FlexcanSetMbFlag(flexcan, (uint32_t)full);
+        return true;
+    }
+    return false;
+}
+
+static void HOSTSIM_FlexcanReceive(hostsim_flexcan_t *flexcan, const hostsim_flexcan_frame_t *frame)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+
+    if (frame->fd && ((regs->MCR & CAN_MCR_FDEN_MASK) == 0U))
+    {
+        /* A classic CAN node sees a form error. */
+        return;
+    }
+
+    /* Matching priority: the Rx FIFO first, unless CTRL2[MRP]. */
+    if ((regs->CTRL2 & CAN_CTRL2_MRP_MASK) == 0U)
+    {
+        if (!HOSTSIM_FlexcanFifoReceive(flexcan, frame))
+        {
+            (void)HOSTSIM_FlexcanMbReceive(flexcan, frame);
+        }
+    }
+    else if (!HOSTSIM_FlexcanMbReceive(flexcan, frame))
+    {
+        (void)HOSTSIM_FlexcanFifoReceive(flexcan, frame);
+    }
+    else
+    {
+        /* Received in a message buffer. */
+    }
+}
+
+static void HOSTSIM_FlexcanUnlock(hostsim_flexcan_t *flexcan)
+{
+    flexcan->lockedMb = -1;
+    if (flexcan->smbValid)
+    {
+        flexcan->smbValid = false;
+        (void)HOSTSIM_FlexcanMbReceive(flexcan, &flexcan->smb);
+        HOSTSIM_FlexcanUpdateIrq(flexcan);
+    }
+}
+
+/* Pending transmit message buffer of an instance: lowest identifier, or lowest number with CTRL1[LBUF]. */
+static bool HOSTSIM_FlexcanNextTx(hostsim_flexcan_t *flexcan, uint32_t *mbIdx, hostsim_flexcan_frame_t *frame)
+{
+    uint32_t count  = HOSTSIM_FlexcanMbCount(flexcan);
+    bool lowestMb   = (HOSTSIM_FlexcanRegs(flexcan)->CTRL1 & CAN_CTRL1_LBUF_MASK) != 0U;
+    bool found      = false;
+    hostsim_flexcan_frame_t candidate;
+    uint32_t i;
+
+    for (i = HOSTSIM_FlexcanFirstMb(flexcan); i < count; i++)
+    {
+        if (((*HOSTSIM_FlexcanMbWord(flexcan, i, HOSTSIM_FLEXCAN_MB_CS) & CAN_CS_CODE_MASK) >> CAN_CS_CODE_SHIFT) !=
+            HOSTSIM_FLEXCAN_CODE_TX_DATA)
+        {
+            continue;
+        }
+        HOSTSIM_FlexcanReadMb(flexcan, i, &candidate);
+        if ((!found) || (HOSTSIM_FlexcanArbitration(&candidate) < HOSTSIM_FlexcanArbitration(frame)))
+        {
+            *frame = candidate;
+            *mbIdx = i;
+            found  = true;
+            if (lowestMb)
+            {
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+/* Starts the frame that wins the arbitration between the instances on the bus and the host. */
+static void HOSTSIM_FlexcanBusStart(void)
+{
+    hostsim_flexcan_bus_t *bus = &s_flexcanBus;
+    hostsim_flexcan_frame_t frame;
+    uint32_t mbIdx = 0U;
+    uint32_t instance;
+    bool found = false;
+
+    if (bus->busy)
+    {
+        return;
+    }
+
+    if (bus->inputCount != 0U)
+    {
+        bus->frame  = bus->input[bus->inputHead];
+        bus->sender = NULL;
+        found       = true;
+    }
+    for (instance = 0U; instance < ARRAY_SIZE(s_flexcans); instance++)
+    {
+        if (HOSTSIM_FlexcanOnBus(&s_flexcans[instance]) &&
+            HOSTSIM_FlexcanNextTx(&s_flexcans[instance], &mbIdx, &frame) &&
+            ((!found) || (HOSTSIM_FlexcanArbitration(&frame) < HOSTSIM_FlexcanArbitration(&bus->frame))))
+        {
+            bus->frame    = frame;
+            bus->sender   = &s_flexcans[instance];
+            bus->senderMb = mbIdx;
+            found         = true;
+        }
+    }
+    if (!found)
+    {
+        return;
+    }
+
+    bus->busy = true;
+    HOSTSIM_EventSchedule(&bus->event, HOSTSIM_FlexcanFrameTimeNs(bus->sender, &bus->frame), HOSTSIM_FlexcanBusDone,
+                          bus);
+}
+
+static void HOSTSIM_FlexcanBusDone(void *param)
+{
+    hostsim_flexcan_bus_t *bus = (hostsim_flexcan_bus_t *)param;
+    hostsim_flexcan_t *sender  = bus->sender;
+    hostsim_flexcan_t *flexcan;
+    volatile uint32_t *cs;
+    uint32_t instance;
+    bool loopback = false;
+
+    if (sender == NULL)
+    {
+        bus->inputHead = (bus->inputHead + 1U) % HOSTSIM_FLEXCAN_INPUT_FRAMES;
+        bus->inputCount--;
+    }
+    else
+    {
+        /* The message buffer may have been aborted by the application meanwhile. */
+        cs = HOSTSIM_FlexcanMbWord(sender, bus->senderMb, HOSTSIM_FLEXCAN_MB_CS);
+        if (((*cs & CAN_CS_CODE_MASK) >> CAN_CS_CODE_SHIFT) == HOSTSIM_FLEXCAN_CODE_TX_DATA)
+        {
+            *cs = (*cs & ~(CAN_CS_CODE_MASK | CAN_CS_TIME_STAMP_MASK)) |
+                  CAN_CS_CODE(HOSTSIM_FLEXCAN_CODE_TX_INACTIVE) | CAN_CS_TIME_STAMP(HOSTSIM_FlexcanTimer(sender));
+            HOSTSIM_FlexcanSetMbFlag(sender, bus->senderMb);
+        }
+        loopback = (HOSTSIM_FlexcanRegs(sender)->CTRL1 & CAN_CTRL1_LPB_MASK) != 0U;
+    }
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_flexcans); instance++)
+    {
+        flexcan = &s_flexcans[instance];
+        if (!HOSTSIM_FlexcanOnBus(flexcan))
+        {
+            continue;
+        }
+        if (flexcan == sender)
+        {
+            if (loopback || ((HOSTSIM_FlexcanRegs(flexcan)->MCR & CAN_MCR_SRXDIS_MASK) == 0U))
+            {
+                HOSTSIM_FlexcanReceive(flexcan, &bus->frame);
+            }
+        }
+        else if ((!loopback) && ((HOSTSIM_FlexcanRegs(flexcan)->CTRL1 & CAN_CTRL1_LPB_MASK) == 0U))
+        {
+            HOSTSIM_FlexcanReceive(flexcan, &bus->frame);
+        }
+        else
+        {
+            /* Not connected to this frame. */
+        }
+    }
+    if ((sender != NULL) && (!loopback) && (bus->output != NULL))
+    {
+        bus->output(sender->base, &bus->frame, bus->outputUserData);
+    }
+
+    bus->busy = false;
+    HOSTSIM_FlexcanBusStart();
+    for (instance = 0U; instance < ARRAY_SIZE(s_flexcans); instance++)
+    {
+        HOSTSIM_FlexcanUpdateIrq(&s_flexcans[instance]);
+    }
+}
+
+/* Acknowledges the mode requests of MCR. */
+static void HOSTSIM_FlexcanUpdateMode(hostsim_flexcan_t *flexcan)
+{
+    CAN_Type *regs = HOSTSIM_FlexcanRegs(flexcan);
+    uint32_t mcr   = regs->MCR & ~(CAN_MCR_LPMACK_MASK | CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK);
+
+    if ((mcr & CAN_MCR_MDIS_MASK) != 0U)
+    {
+        mcr |= CAN_MCR_LPMACK_MASK | CAN_MCR_NOTRDY_MASK;
+    }
+    else if ((mcr & (CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK)) == (CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK))
+    {
+        mcr |= CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK;
+    }
+    else
+    {
+        /* Synchronized with the bus at once. */
+        regs->ESR1 |= CAN_ESR1_SYNCH_MASK | CAN_ESR1_IDLE_MASK;
+    }
+    if ((mcr & (CAN_MCR_LPMACK_MASK | CAN_MCR_FRZACK_MASK)) != 0U)
+    {
+        regs->ESR1 &= ~(CAN_ESR1_SYNCH_MASK | CAN_ESR1_IDLE_MASK);
+    }
+    regs->MCR = mcr;
+}
+
+static void HOSTSIM_FlexcanRefresh(hostsim_region_t *region, uint32_t offset)
+{
+    hostsim_flexcan_t *flexcan = (hostsim_flexcan_t *)region->model;
+
+    if (offset == offsetof(CAN_Type, TIMER))
+    {
+        HOSTSIM_FlexcanRegs(flexcan)->TIMER = HOSTSIM_FlexcanTimer(flexcan);
+    }
+}
+
+static void HOSTSIM_FlexcanReadDone(hostsim_region_t *region, uint32_t offset)
+{
+    hostsim_flexcan_t *flexcan = (hostsim_flexcan_t *)region->model;
+    int32_t mbIdx;
+
+    if (offset == offsetof(CAN_Type, TIMER))
+    {
+        HOSTSIM_FlexcanUnlock(flexcan);
+        return;
+    }
+
+    mbIdx = HOSTSIM_FlexcanCsMb(flexcan, offset);
+    if ((mbIdx >= 0) && ((HOSTSIM_FlexcanRegs(flexcan)->MCR & CAN_MCR_FRZACK_MASK) == 0U))
+    {
+        /* Reading another buffer releases the previous lock. */
+        if ((flexcan->lockedMb >= 0) && (flexcan->lockedMb != mbIdx))
+        {
+            HOSTSIM_FlexcanUnlock(flexcan);
+        }
+        flexcan->lockedMb = mbIdx;
+    }
+}
+
+static void HOSTSIM_FlexcanWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    hostsim_flexcan_t *flexcan = (hostsim_flexcan_t *)region->model;
+    CAN_Type *regs             = HOSTSIM_FlexcanRegs(flexcan);
+    int32_t mbIdx;
+
+    if (offset == offsetof(CAN_Type, MCR))
+    {
+        if ((newValue & CAN_MCR_SOFTRST_MASK) != 0U)
+        {
+            regs->MCR    = HOSTSIM_FLEXCAN_MCR_SOFTRST | (newValue & CAN_MCR_MDIS_MASK);
+            regs->IMASK1 = 0U;
+            regs->IMASK2 = 0U;
+            regs->IFLAG1 = 0U;
+            regs->IFLAG2 = 0U;
+            regs->ESR1   = 0U;
+            regs->ECR    = 0U;
+            flexcan->fifoCount = 0U;
+            flexcan->lockedMb  = -1;
+            flexcan->smbValid  = false;
+        }
+        HOSTSIM_FlexcanUpdateMode(flexcan);
+    }
+    else if (offset == offsetof(CAN_Type, IFLAG1))
+    {
+        regs->IFLAG1 = oldValue & ~newValue;
+        if (((regs->MCR & CAN_MCR_RFEN_MASK) != 0U) && ((newValue & CAN_IFLAG1_BUF5I_MASK) != 0U) &&
+            (flexcan->fifoCount != 0U))
+        {
+            /* Clearing the frame available flag pops the Rx FIFO. */
+            flexcan->fifoHead = (flexcan->fifoHead + 1U) % HOSTSIM_FLEXCAN_FIFO_DEPTH;
+            flexcan->fifoCount--;
+            HOSTSIM_FlexcanFifoShowHead(flexcan);
+        }
+    }
+    else if (offset == offsetof(CAN_Type, IFLAG2))
+    {
+        regs->IFLAG2 = oldValue & ~newValue;
+    }
+    else if (offset == offsetof(CAN_Type, ESR1))
+    {
+        regs->ESR1 = oldValue & ~(newValue & HOSTSIM_FLEXCAN_ESR1_W1C);
+    }
+    else if (offset == offsetof(CAN_Type, TIMER))
+    {
+        flexcan->timerStartNs = HOSTSIM_GetTimeNs() - (newValue * HOSTSIM_FlexcanBitTimeNs(flexcan, false));
+    }
+    else
+    {
+        mbIdx = HOSTSIM_FlexcanCsMb(flexcan, offset);
+        if ((mbIdx >= 0) && (flexcan->lockedMb == mbIdx) &&
+            (((newValue & CAN_CS_CODE_MASK) >> CAN_CS_CODE_SHIFT) == HOSTSIM_FLEXCAN_CODE_RX_EMPTY))
+        {
+            /* Rearming a locked buffer releases it. */
+            HOSTSIM_FlexcanUnlock(flexcan);
+        }
+    }
+
+    HOSTSIM_FlexcanBusStart();
+    HOSTSIM_FlexcanUpdateIrq(flexcan);
+}
+
+void HOSTSIM_FlexcanSetClock(CAN_Type *base, uint32_t srcClock_Hz)
+{
+    HOSTSIM_FlexcanGet(base)->clockHz = srcClock_Hz;
+}
+
+void HOSTSIM_FlexcanSetOutput(hostsim_flexcan_output_callback_t callback, void *userData)
+{
+    s_flexcanBus.output         = callback;
+    s_flexcanBus.outputUserData = userData;
+}
+
+bool HOSTSIM_FlexcanSend(const hostsim_flexcan_frame_t *frame)
+{
+    hostsim_flexcan_bus_t *bus = &s_flexcanBus;
+
+    if (bus->inputCount == HOSTSIM_FLEXCAN_INPUT_FRAMES)
+    {
+        return false;
+    }
+    bus->input[(bus->inputHead + bus->inputCount) % HOSTSIM_FLEXCAN_INPUT_FRAMES] = *frame;
+    bus->inputCount++;
+    HOSTSIM_FlexcanBusStart();
+    return true;
+}
+
+__attribute__((constructor(102))) static void HOSTSIM_FlexcanInit(void)
+{
+    hostsim_flexcan_t *flexcan;
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_flexcanBases); instance++)
+    {
+        flexcan           = &s_flexcans[instance];
+        flexcan->base     = s_flexcanBases[instance];
+        flexcan->irq      = s_flexcanMbIrqs[instance];
+        flexcan->clockHz  = HOSTSIM_FLEXCAN_CLOCK_HZ;
+        flexcan->lockedMb = -1;
+        HOSTSIM_RegionInit(&flexcan->region, "FlexCAN", (uintptr_t)flexcan->base, sizeof(CAN_Type), &s_flexcanOps,
+                           flexcan);
+        /* Out of reset the module is disabled. */
+        HOSTSIM_FlexcanRegs(flexcan)->MCR = HOSTSIM_FLEXCAN_MCR_SOFTRST | CAN_MCR_MDIS_MASK;
+        HOSTSIM_FlexcanUpdateMode(flexcan);
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HOSTSIM_FLEXCAN_H_
+#define _FSL_HOSTSIM_FLEXCAN_H_
+
+#include "fsl_device_registers.h"
+#include "fsl_hostsim.h"
+
+/*!
+ * @addtogroup hostsim_flexcan
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Protocol engine clock of the simulated FlexCAN instances, until @ref HOSTSIM_FlexcanSetClock. */
+#ifndef HOSTSIM_FLEXCAN_CLOCK_HZ
+#define HOSTSIM_FLEXCAN_CLOCK_HZ (40000000U)
+#endif
+
+/*! @brief Number of the frames sent by the host that the bus queues. */
+#ifndef HOSTSIM_FLEXCAN_INPUT_FRAMES
+#define HOSTSIM_FLEXCAN_INPUT_FRAMES (64U)
+#endif
+
+/*! @brief Bit time of the frames sent by the host while no FlexCAN is on the bus, in ns. */
+#ifndef HOSTSIM_FLEXCAN_BIT_TIME_NS
+#define HOSTSIM_FLEXCAN_BIT_TIME_NS (1000U)
+#endif
+
+/*! @brief CAN frame on the simulated bus. */
+typedef struct _hostsim_flexcan_frame
+{
+    uint32_t id;      /*!< Identifier, 11 or 29 bits. */
+    bool extended;    /*!< Extended identifier. */
+    bool remote;      /*!< Remote frame. */
+    bool fd;          /*!< CAN FD frame. */
+    bool brs;         /*!< CAN FD frame with the bit rate switch. */
+    uint8_t length;   /*!< Data length, in bytes: 0 to 8, then 12, 16, 20, 24, 32, 48 or 64 for CAN FD. */
+    uint8_t data[64]; /*!< Data. */
+} hostsim_flexcan_frame_t;
+
+/*!
+ * @brief Output callback, called with each frame a FlexCAN transmitted on the bus.
+ *
+ * @param base The FlexCAN peripheral base address.
+ * @param frame The frame.
+ * @param userData Parameter of the callback.
+ */
+typedef void (*hostsim_flexcan_output_callback_t)(CAN_Type *base,
+                                                  const hostsim_flexcan_frame_t *frame,
+                                                  void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Sets the protocol engine clock of a FlexCAN, which times the bits with the bit timing registers.
+ *
+ * @param base The FlexCAN peripheral base address.
+ * @param srcClock_Hz The clock, in Hz.
+ */
+void HOSTSIM_FlexcanSetClock(CAN_Type *base, uint32_t srcClock_Hz);
+
+/*!
+ * @brief Sets the callback receiving the frames the FlexCAN instances transmit on the bus.
+ *
+ * All the simulated FlexCAN instances share one bus, arbitrated by identifier. The frames transmitted in
+ * loopback mode do not reach the bus.
+ *
+ * @param callback The callback, NULL to discard the frames.
+ * @param userData Parameter of the callback.
+ */
+void HOSTSIM_FlexcanSetOutput(hostsim_flexcan_output_callback_t callback, void *userData);
+
+/*!
+ * @brief Sends a frame on the bus.
+ *
+ * The frame takes part in the arbitration with the frames of the FlexCAN instances, and is received by all
+ * the instances on the bus.
+ *
+ * @param frame The frame.
+ * @retval true The frame is queued.
+ * @retval false The input queue is full.
+ */
+bool HOSTSIM_FlexcanSend(const hostsim_flexcan_frame_t *frame);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HOSTSIM_FLEXCAN_H_ */
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_device_registers.h"
+#include "fsl_hostsim.h"
+
+/*
+ * LMEM model: the memory of the host is coherent, the cache commands of the code and system buses complete
+ * at once.
+ */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void HOSTSIM_LmemWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static hostsim_region_t s_lmemRegion;
+
+static const hostsim_region_ops_t s_lmemOps = {
+    .refresh  = NULL,
+    .readDone = NULL,
+    .write    = HOSTSIM_LmemWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void HOSTSIM_LmemWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    LMEM_Type *regs = (LMEM_Type *)(uintptr_t)region->regs;
+
+    (void)oldValue;
+
+    if (offset == offsetof(LMEM_Type, PCCCR))
+    {
+        regs->PCCCR = newValue & ~LMEM_PCCCR_GO_MASK;
+    }
+    else if (offset == offsetof(LMEM_Type, PCCSAR))
+    {
+        regs->PCCSAR = newValue & ~LMEM_PCCSAR_LGO_MASK;
+    }
+    else if (offset == offsetof(LMEM_Type, PSCCR))
+    {
+        regs->PSCCR = newValue & ~LMEM_PSCCR_GO_MASK;
+    }
+    else if (offset == offsetof(LMEM_Type, PSCSAR))
+    {
+        regs->PSCSAR = newValue & ~LMEM_PSCSAR_LGO_MASK;
+    }
+    else
+    {
+        /* Other registers are storage. */
+    }
+}
+
+__attribute__((constructor(102))) static void HOSTSIM_LmemInit(void)
+{
+    HOSTSIM_RegionInit(&s_lmemRegion, "LMEM", (uintptr_t)LMEM, sizeof(LMEM_Type), &s_lmemOps, NULL);
+}
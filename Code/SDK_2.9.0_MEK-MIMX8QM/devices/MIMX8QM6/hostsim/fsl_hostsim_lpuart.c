@@ -0,0 +1,527 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <unistd.h>
+
+#include "fsl_hostsim_lpuart.h"
+#include "fsl_common.h"
+#include "fsl_hostsim_edma.h"
+
+/*
+ * LPUART model: transmit and receive FIFOs with their watermarks, characters timed by the baud rate
+ * divider, idle line detection, overrun, and the interrupt and DMA requests of the status flags. The
+ * address match, LIN break, IrDA and modem signals are not modelled.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_LPUART_FIFO_MAX (256U)
+
+/* Status flags cleared by writing 1. */
+#define HOSTSIM_LPUART_STAT_W1C                                                                              \
+    (LPUART_STAT_LBKDIF_MASK | LPUART_STAT_RXEDGIF_MASK | LPUART_STAT_IDLE_MASK | LPUART_STAT_OR_MASK |      \
+     LPUART_STAT_NF_MASK | LPUART_STAT_FE_MASK | LPUART_STAT_PF_MASK | LPUART_STAT_MA1F_MASK |              \
+     LPUART_STAT_MA2F_MASK)
+
+/* Status flags computed by the model. */
+#define HOSTSIM_LPUART_STAT_RO (LPUART_STAT_TDRE_MASK | LPUART_STAT_TC_MASK | LPUART_STAT_RDRF_MASK)
+
+/* FIFO fields computed by the model, flags cleared by writing 1 and actions. */
+#define HOSTSIM_LPUART_FIFO_RO                                                                  \
+    (LPUART_FIFO_TXEMPT_MASK | LPUART_FIFO_RXEMPT_MASK | LPUART_FIFO_TXFIFOSIZE_MASK | \
+     LPUART_FIFO_RXFIFOSIZE_MASK)
+#define HOSTSIM_LPUART_FIFO_W1C (LPUART_FIFO_TXOF_MASK | LPUART_FIFO_RXUF_MASK)
+#define HOSTSIM_LPUART_FIFO_ACTIONS (LPUART_FIFO_TXFLUSH_MASK | LPUART_FIFO_RXFLUSH_MASK)
+
+typedef struct _hostsim_lpuart
+{
+    hostsim_region_t region;
+    LPUART_Type *base;
+    IRQn_Type irq;
+    uint32_t fifoSize;
+    uint32_t clockHz;
+
+    uint16_t txFifo[HOSTSIM_LPUART_FIFO_MAX];
+    uint32_t txHead;
+    uint32_t txCount;
+    uint16_t shifter;
+    bool txBusy;
+
+    uint16_t rxFifo[HOSTSIM_LPUART_FIFO_MAX];
+    uint32_t rxHead;
+    uint32_t rxCount;
+
+    uint8_t input[HOSTSIM_LPUART_INPUT_SIZE];
+    uint32_t inputHead;
+    uint32_t inputCount;
+
+    hostsim_event_t txEvent;
+    hostsim_event_t rxEvent;
+    hostsim_event_t idleEvent;
+
+    hostsim_lpuart_output_callback_t output;
+    void *outputUserData;
+
+    DMA_Type *dma;
+    uint32_t rxChannel;
+    uint32_t txChannel;
+} hostsim_lpuart_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void HOSTSIM_LpuartRefresh(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_LpuartReadDone(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_LpuartWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+static void HOSTSIM_LpuartTxDone(void *param);
+static void HOSTSIM_LpuartRxArrive(void *param);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static LPUART_Type *const s_lpuartBases[] = LPUART_BASE_PTRS;
+static const IRQn_Type s_lpuartIrqs[]     = LPUART_RX_TX_IRQS;
+static hostsim_lpuart_t s_lpuarts[ARRAY_SIZE(s_lpuartBases)];
+
+static const hostsim_region_ops_t s_lpuartOps = {
+    .refresh  = HOSTSIM_LpuartRefresh,
+    .readDone = HOSTSIM_LpuartReadDone,
+    .write    = HOSTSIM_LpuartWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static hostsim_lpuart_t *HOSTSIM_LpuartGet(LPUART_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_lpuartBases); instance++)
+    {
+        if (s_lpuartBases[instance] == base)
+        {
+            return &s_lpuarts[instance];
+        }
+    }
+    HOSTSIM_Fatal("LPUART 0x%08x is not simulated", (unsigned)(uintptr_t)base);
+}
+
+static inline LPUART_Type *HOSTSIM_LpuartRegs(hostsim_lpuart_t *lpuart)
+{
+    return (LPUART_Type *)(uintptr_t)lpuart->region.regs;
+}
+
+static void HOSTSIM_LpuartDefaultOutput(LPUART_Type *base, uint16_t data, void *userData)
+{
+    uint8_t character = (uint8_t)data;
+
+    (void)base;
+    (void)userData;
+    (void)write(STDOUT_FILENO, &character, 1U);
+}
+
+/* FIFO size field: 1, 4, 8, ... 256 characters. */
+static uint32_t HOSTSIM_LpuartFifoSizeField(uint32_t size)
+{
+    uint32_t field = 0U;
+
+    if (size > 1U)
+    {
+        field = 1U;
+        while ((4U << (field - 1U)) < size)
+        {
+            field++;
+        }
+    }
+    return field;
+}
+
+static uint32_t HOSTSIM_LpuartTxCapacity(hostsim_lpuart_t *lpuart)
+{
+    return ((HOSTSIM_LpuartRegs(lpuart)->FIFO & LPUART_FIFO_TXFE_MASK) != 0U) ? lpuart->fifoSize : 1U;
+}
+
+static uint32_t HOSTSIM_LpuartRxCapacity(hostsim_lpuart_t *lpuart)
+{
+    return ((HOSTSIM_LpuartRegs(lpuart)->FIFO & LPUART_FIFO_RXFE_MASK) != 0U) ? lpuart->fifoSize : 1U;
+}
+
+/* Duration of one character, start to stop bits, in ns. 0 if the baud rate generator is off. */
+static uint64_t HOSTSIM_LpuartCharTimeNs(hostsim_lpuart_t *lpuart)
+{
+    LPUART_Type *regs = HOSTSIM_LpuartRegs(lpuart);
+    uint32_t baud     = regs->BAUD;
+    uint32_t ctrl     = regs->CTRL;
+    uint64_t sbr      = (baud & LPUART_BAUD_SBR_MASK) >> LPUART_BAUD_SBR_SHIFT;
+    uint64_t osr      = ((baud & LPUART_BAUD_OSR_MASK) >> LPUART_BAUD_OSR_SHIFT) + 1U;
+    uint64_t bits     = 10U;
+
+    if ((sbr == 0U) || (lpuart->clockHz == 0U))
+    {
+        return 0U;
+    }
+    /* An OSR of 1 to 3 is reserved, and samples 16 times. */
+    if (osr < 4U)
+    {
+        osr = 16U;
+    }
+    if ((baud & LPUART_BAUD_M10_MASK) != 0U)
+    {
+        bits += 2U;
+    }
+    else if ((ctrl & LPUART_CTRL_M_MASK) != 0U)
+    {
+        bits += 1U;
+    }
+    else if ((ctrl & LPUART_CTRL_M7_MASK) != 0U)
+    {
+        bits -= 1U;
+    }
+    else
+    {
+        /* 8 data bits. */
+    }
+    if ((baud & LPUART_BAUD_SBNS_MASK) != 0U)
+    {
+        bits += 1U;
+    }
+
+    return (bits * sbr * osr * 1000000000ULL) / lpuart->clockHz;
+}
+
+/* Recomputes the status flags, the counts and the requests. */
+static void HOSTSIM_LpuartUpdate(hostsim_lpuart_t *lpuart)
+{
+    LPUART_Type *regs = HOSTSIM_LpuartRegs(lpuart);
+    uint32_t ctrl     = regs->CTRL;
+    uint32_t fifo     = regs->FIFO;
+    uint32_t water    = regs->WATER;
+    uint32_t stat     = regs->STAT & ~HOSTSIM_LPUART_STAT_RO;
+    uint32_t txWater  = (water & LPUART_WATER_TXWATER_MASK) >> LPUART_WATER_TXWATER_SHIFT;
+    uint32_t rxWater  = (water & LPUART_WATER_RXWATER_MASK) >> LPUART_WATER_RXWATER_SHIFT;
+    bool irq;
+
+    if ((fifo & LPUART_FIFO_TXFE_MASK) != 0U)
+    {
+        stat |= (lpuart->txCount <= txWater) ? LPUART_STAT_TDRE_MASK : 0U;
+    }
+    else
+    {
+        stat |= (lpuart->txCount == 0U) ? LPUART_STAT_TDRE_MASK : 0U;
+    }
+    if ((lpuart->txCount == 0U) && (!lpuart->txBusy))
+    {
+        stat |= LPUART_STAT_TC_MASK;
+    }
+    if ((fifo & LPUART_FIFO_RXFE_MASK) != 0U)
+    {
+        stat |= (lpuart->rxCount > rxWater) ? LPUART_STAT_RDRF_MASK : 0U;
+    }
+    else
+    {
+        stat |= (lpuart->rxCount != 0U) ? LPUART_STAT_RDRF_MASK : 0U;
+    }
+    regs->STAT = stat;
+
+    water &= ~(LPUART_WATER_TXCOUNT_MASK | LPUART_WATER_RXCOUNT_MASK);
+    water |= (lpuart->txCount << LPUART_WATER_TXCOUNT_SHIFT) & LPUART_WATER_TXCOUNT_MASK;
+    water |= (lpuart->rxCount << LPUART_WATER_RXCOUNT_SHIFT) & LPUART_WATER_RXCOUNT_MASK;
+    regs->WATER = water;
+
+    fifo &= ~(HOSTSIM_LPUART_FIFO_RO | HOSTSIM_LPUART_FIFO_ACTIONS);
+    fifo |= (lpuart->txCount == 0U) ? LPUART_FIFO_TXEMPT_MASK : 0U;
+    fifo |= (lpuart->rxCount == 0U) ? LPUART_FIFO_RXEMPT_MASK : 0U;
+    fifo |= LPUART_FIFO_TXFIFOSIZE(HOSTSIM_LpuartFifoSizeField(lpuart->fifoSize));
+    fifo |= LPUART_FIFO_RXFIFOSIZE(HOSTSIM_LpuartFifoSizeField(lpuart->fifoSize));
+    regs->FIFO = fifo;
+
+    irq = (((ctrl & LPUART_CTRL_TIE_MASK) != 0U) && ((stat & LPUART_STAT_TDRE_MASK) != 0U)) ||
+          (((ctrl & LPUART_CTRL_TCIE_MASK) != 0U) && ((stat & LPUART_STAT_TC_MASK) != 0U)) ||
+          (((ctrl & LPUART_CTRL_RIE_MASK) != 0U) && ((stat & LPUART_STAT_RDRF_MASK) != 0U)) ||
+          (((ctrl & LPUART_CTRL_ILIE_MASK) != 0U) && ((stat & LPUART_STAT_IDLE_MASK) != 0U)) ||
+          (((ctrl & LPUART_CTRL_ORIE_MASK) != 0U) && ((stat & LPUART_STAT_OR_MASK) != 0U)) ||
+          (((fifo & LPUART_FIFO_TXOFE_MASK) != 0U) && ((fifo & LPUART_FIFO_TXOF_MASK) != 0U)) ||
+          (((fifo & LPUART_FIFO_RXUFE_MASK) != 0U) && ((fifo & LPUART_FIFO_RXUF_MASK) != 0U));
+    HOSTSIM_SetIrqLevel((int32_t)lpuart->irq, irq);
+
+    if (lpuart->dma != NULL)
+    {
+        HOSTSIM_EdmaSetRequest(lpuart->dma, lpuart->txChannel,
+                               ((regs->BAUD & LPUART_BAUD_TDMAE_MASK) != 0U) &&
+                                   ((stat & LPUART_STAT_TDRE_MASK) != 0U) && ((ctrl & LPUART_CTRL_TE_MASK) != 0U));
+        HOSTSIM_EdmaSetRequest(lpuart->dma, lpuart->rxChannel,
+                               ((regs->BAUD & LPUART_BAUD_RDMAE_MASK) != 0U) &&
+                                   ((stat & LPUART_STAT_RDRF_MASK) != 0U));
+    }
+}
+
+static void HOSTSIM_LpuartStartTx(hostsim_lpuart_t *lpuart)
+{
+    uint64_t charTimeNs;
+
+    if (lpuart->txBusy || (lpuart->txCount == 0U) || ((HOSTSIM_LpuartRegs(lpuart)->CTRL & LPUART_CTRL_TE_MASK) == 0U))
+    {
+        return;
+    }
+    charTimeNs = HOSTSIM_LpuartCharTimeNs(lpuart);
+    if (charTimeNs == 0U)
+    {
+        return;
+    }
+    lpuart->shifter = lpuart->txFifo[lpuart->txHead];
+    lpuart->txHead  = (lpuart->txHead + 1U) % HOSTSIM_LPUART_FIFO_MAX;
+    lpuart->txCount--;
+    lpuart->txBusy = true;
+    HOSTSIM_EventSchedule(&lpuart->txEvent, charTimeNs, HOSTSIM_LpuartTxDone, lpuart);
+}
+
+/* A character received from the line: into the receive FIFO, or overrun. */
+static void HOSTSIM_LpuartReceive(hostsim_lpuart_t *lpuart, uint16_t data)
+{
+    LPUART_Type *regs = HOSTSIM_LpuartRegs(lpuart);
+
+    if ((regs->CTRL & LPUART_CTRL_RE_MASK) == 0U)
+    {
+        return;
+    }
+    if (lpuart->rxCount >= HOSTSIM_LpuartRxCapacity(lpuart))
+    {
+        regs->STAT |= LPUART_STAT_OR_MASK;
+        return;
+    }
+    lpuart->rxFifo[(lpuart->rxHead + lpuart->rxCount) % HOSTSIM_LPUART_FIFO_MAX] = data;
+    lpuart->rxCount++;
+}
+
+static void HOSTSIM_LpuartIdle(void *param)
+{
+    hostsim_lpuart_t *lpuart = (hostsim_lpuart_t *)param;
+
+    HOSTSIM_LpuartRegs(lpuart)->STAT |= LPUART_STAT_IDLE_MASK;
+    HOSTSIM_LpuartUpdate(lpuart);
+}
+
+static void HOSTSIM_LpuartTxDone(void *param)
+{
+    hostsim_lpuart_t *lpuart = (hostsim_lpuart_t *)param;
+
+    lpuart->txBusy = false;
+    if ((HOSTSIM_LpuartRegs(lpuart)->CTRL & LPUART_CTRL_LOOPS_MASK) != 0U)
+    {
+        HOSTSIM_LpuartReceive(lpuart, lpuart->shifter);
+        HOSTSIM_EventSchedule(&lpuart->idleEvent, HOSTSIM_LpuartCharTimeNs(lpuart), HOSTSIM_LpuartIdle, lpuart);
+    }
+    else if (lpuart->output != NULL)
+    {
+        lpuart->output(lpuart->base, lpuart->shifter, lpuart->outputUserData);
+    }
+    else
+    {
+        /* Nobody listens on the line. */
+    }
+    HOSTSIM_LpuartStartTx(lpuart);
+    HOSTSIM_LpuartUpdate(lpuart);
+}
+
+static void HOSTSIM_LpuartScheduleRx(hostsim_lpuart_t *lpuart)
+{
+    uint64_t charTimeNs;
+
+    if ((lpuart->inputCount == 0U) || lpuart->rxEvent.scheduled)
+    {
+        return;
+    }
+    charTimeNs = HOSTSIM_LpuartCharTimeNs(lpuart);
+    if (charTimeNs != 0U)
+    {
+        HOSTSIM_EventCancel(&lpuart->idleEvent);
+        HOSTSIM_EventSchedule(&lpuart->rxEvent, charTimeNs, HOSTSIM_LpuartRxArrive, lpuart);
+    }
+}
+
+static void HOSTSIM_LpuartRxArrive(void *param)
+{
+    hostsim_lpuart_t *lpuart = (hostsim_lpuart_t *)param;
+
+    HOSTSIM_LpuartReceive(lpuart, lpuart->input[lpuart->inputHead]);
+    lpuart->inputHead = (lpuart->inputHead + 1U) % HOSTSIM_LPUART_INPUT_SIZE;
+    lpuart->inputCount--;
+
+    if (lpuart->inputCount != 0U)
+    {
+        HOSTSIM_LpuartScheduleRx(lpuart);
+    }
+    else
+    {
+        /* The line is idle one character after the last one. */
+        HOSTSIM_EventSchedule(&lpuart->idleEvent, HOSTSIM_LpuartCharTimeNs(lpuart), HOSTSIM_LpuartIdle, lpuart);
+    }
+    HOSTSIM_LpuartUpdate(lpuart);
+}
+
+static void HOSTSIM_LpuartRefresh(hostsim_region_t *region, uint32_t offset)
+{
+    hostsim_lpuart_t *lpuart = (hostsim_lpuart_t *)region->model;
+    LPUART_Type *regs        = HOSTSIM_LpuartRegs(lpuart);
+
+    if (offset == offsetof(LPUART_Type, DATA))
+    {
+        regs->DATA = (lpuart->rxCount != 0U) ? lpuart->rxFifo[lpuart->rxHead] : LPUART_DATA_RXEMPT_MASK;
+    }
+}
+
+static void HOSTSIM_LpuartReadDone(hostsim_region_t *region, uint32_t offset)
+{
+    hostsim_lpuart_t *lpuart = (hostsim_lpuart_t *)region->model;
+    LPUART_Type *regs        = HOSTSIM_LpuartRegs(lpuart);
+
+    if (offset != offsetof(LPUART_Type, DATA))
+    {
+        return;
+    }
+    if (lpuart->rxCount != 0U)
+    {
+        lpuart->rxHead = (lpuart->rxHead + 1U) % HOSTSIM_LPUART_FIFO_MAX;
+        lpuart->rxCount--;
+    }
+    else if ((regs->FIFO & LPUART_FIFO_RXFE_MASK) != 0U)
+    {
+        regs->FIFO |= LPUART_FIFO_RXUF_MASK;
+    }
+    else
+    {
+        /* Reading the empty data register has no effect. */
+    }
+    HOSTSIM_LpuartUpdate(lpuart);
+}
+
+static void HOSTSIM_LpuartWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    hostsim_lpuart_t *lpuart = (hostsim_lpuart_t *)region->model;
+    LPUART_Type *regs        = HOSTSIM_LpuartRegs(lpuart);
+
+    if (offset == offsetof(LPUART_Type, STAT))
+    {
+        regs->STAT = (oldValue & ~HOSTSIM_LPUART_STAT_W1C & HOSTSIM_LPUART_STAT_RO) |
+                     (newValue & ~(HOSTSIM_LPUART_STAT_W1C | HOSTSIM_LPUART_STAT_RO)) |
+                     (oldValue & HOSTSIM_LPUART_STAT_W1C & ~newValue);
+    }
+    else if (offset == offsetof(LPUART_Type, FIFO))
+    {
+        regs->FIFO = (newValue & ~(HOSTSIM_LPUART_FIFO_RO | HOSTSIM_LPUART_FIFO_W1C | HOSTSIM_LPUART_FIFO_ACTIONS)) |
+                     (oldValue & HOSTSIM_LPUART_FIFO_W1C & ~newValue);
+        if ((newValue & LPUART_FIFO_TXFLUSH_MASK) != 0U)
+        {
+            lpuart->txCount = 0U;
+        }
+        if ((newValue & LPUART_FIFO_RXFLUSH_MASK) != 0U)
+        {
+            lpuart->rxCount = 0U;
+        }
+    }
+    else if (offset == offsetof(LPUART_Type, WATER))
+    {
+        regs->WATER = newValue & (LPUART_WATER_TXWATER_MASK | LPUART_WATER_RXWATER_MASK);
+    }
+    else if (offset == offsetof(LPUART_Type, DATA))
+    {
+        if ((regs->CTRL & LPUART_CTRL_TE_MASK) != 0U)
+        {
+            if (lpuart->txCount < HOSTSIM_LpuartTxCapacity(lpuart))
+            {
+                lpuart->txFifo[(lpuart->txHead + lpuart->txCount) % HOSTSIM_LPUART_FIFO_MAX] =
+                    (uint16_t)(newValue & 0x3FFU);
+                lpuart->txCount++;
+            }
+            else if ((regs->FIFO & LPUART_FIFO_TXFE_MASK) != 0U)
+            {
+                regs->FIFO |= LPUART_FIFO_TXOF_MASK;
+            }
+            else
+            {
+                /* The write to a full data register is ignored. */
+            }
+        }
+        HOSTSIM_LpuartStartTx(lpuart);
+    }
+    else if ((offset == offsetof(LPUART_Type, CTRL)) || (offset == offsetof(LPUART_Type, BAUD)))
+    {
+        if (((regs->CTRL & LPUART_CTRL_TE_MASK) == 0U) && (offset == offsetof(LPUART_Type, CTRL)))
+        {
+            /* Disabling the transmitter completes the character being sent and drops the FIFO. */
+            lpuart->txCount = 0U;
+        }
+        HOSTSIM_LpuartStartTx(lpuart);
+        HOSTSIM_LpuartScheduleRx(lpuart);
+    }
+    else
+    {
+        /* The other registers hold the value written. */
+    }
+    HOSTSIM_LpuartUpdate(lpuart);
+}
+
+void HOSTSIM_LpuartSetClock(LPUART_Type *base, uint32_t srcClock_Hz)
+{
+    HOSTSIM_LpuartGet(base)->clockHz = srcClock_Hz;
+}
+
+void HOSTSIM_LpuartSetOutput(LPUART_Type *base, hostsim_lpuart_output_callback_t callback, void *userData)
+{
+    hostsim_lpuart_t *lpuart = HOSTSIM_LpuartGet(base);
+
+    lpuart->output         = callback;
+    lpuart->outputUserData = userData;
+}
+
+size_t HOSTSIM_LpuartSend(LPUART_Type *base, const uint8_t *data, size_t length)
+{
+    hostsim_lpuart_t *lpuart = HOSTSIM_LpuartGet(base);
+    size_t count;
+
+    for (count = 0U; (count < length) && (lpuart->inputCount < HOSTSIM_LPUART_INPUT_SIZE); count++)
+    {
+        lpuart->input[(lpuart->inputHead + lpuart->inputCount) % HOSTSIM_LPUART_INPUT_SIZE] = data[count];
+        lpuart->inputCount++;
+    }
+    HOSTSIM_LpuartScheduleRx(lpuart);
+    return count;
+}
+
+void HOSTSIM_LpuartSetDmaRequest(LPUART_Type *base, DMA_Type *dma, uint32_t rxChannel, uint32_t txChannel)
+{
+    hostsim_lpuart_t *lpuart = HOSTSIM_LpuartGet(base);
+
+    lpuart->dma       = dma;
+    lpuart->rxChannel = rxChannel;
+    lpuart->txChannel = txChannel;
+    HOSTSIM_LpuartUpdate(lpuart);
+}
+
+__attribute__((constructor(102))) static void HOSTSIM_LpuartInit(void)
+{
+    hostsim_lpuart_t *lpuart;
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_lpuartBases); instance++)
+    {
+        lpuart           = &s_lpuarts[instance];
+        lpuart->base     = s_lpuartBases[instance];
+        lpuart->irq      = s_lpuartIrqs[instance];
+        lpuart->fifoSize = (uint32_t)FSL_FEATURE_LPUART_FIFO_SIZEn(lpuart->base);
+        lpuart->clockHz  = HOSTSIM_LPUART_CLOCK_HZ;
+        lpuart->output   = HOSTSIM_LpuartDefaultOutput;
+        HOSTSIM_RegionInit(&lpuart->region, "LPUART", (uintptr_t)lpuart->base, sizeof(LPUART_Type), &s_lpuartOps,
+                           lpuart);
+        HOSTSIM_LpuartUpdate(lpuart);
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HOSTSIM_LPUART_H_
+#define _FSL_HOSTSIM_LPUART_H_
+
+#include "fsl_device_registers.h"
+#include "fsl_hostsim.h"
+
+/*!
+ * @addtogroup hostsim_lpuart
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Functional clock of the simulated LPUART instances, until @ref HOSTSIM_LpuartSetClock. */
+#ifndef HOSTSIM_LPUART_CLOCK_HZ
+#define HOSTSIM_LPUART_CLOCK_HZ (80000000U)
+#endif
+
+/*! @brief Size of the queue of the characters sent to an LPUART by the host, in characters. */
+#ifndef HOSTSIM_LPUART_INPUT_SIZE
+#define HOSTSIM_LPUART_INPUT_SIZE (4096U)
+#endif
+
+/*!
+ * @brief Output callback, called with each character the LPUART transmitted.
+ *
+ * @param base The LPUART peripheral base address.
+ * @param data The character, 7 to 10 bits.
+ * @param userData Parameter of the callback.
+ */
+typedef void (*hostsim_lpuart_output_callback_t)(LPUART_Type *base, uint16_t data, void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Sets the functional clock of an LPUART, which times the characters with the baud rate divider.
+ *
+ * @param base The LPUART peripheral base address.
+ * @param srcClock_Hz The clock, in Hz.
+ */
+void HOSTSIM_LpuartSetClock(LPUART_Type *base, uint32_t srcClock_Hz);
+
+/*!
+ * @brief Sets the callback receiving the characters an LPUART transmits.
+ *
+ * By default the characters are written to the standard output of the host.
+ *
+ * @param base The LPUART peripheral base address.
+ * @param callback The callback, NULL to discard the characters.
+ * @param userData Parameter of the callback.
+ */
+void HOSTSIM_LpuartSetOutput(LPUART_Type *base, hostsim_lpuart_output_callback_t callback, void *userData);
+
+/*!
+ * @brief Sends characters to an LPUART.
+ *
+ * The characters arrive on the receive line one by one at the baud rate, from the end of the previous
+ * ones. The characters that do not fit in the input queue are dropped.
+ *
+ * @param base The LPUART peripheral base address.
+ * @param data The characters.
+ * @param length Number of characters.
+ * @return Number of characters queued.
+ */
+size_t HOSTSIM_LpuartSend(LPUART_Type *base, const uint8_t *data, size_t length);
+
+/*!
+ * @brief Connects the DMA requests of an LPUART to eDMA channels.
+ *
+ * @param base The LPUART peripheral base address.
+ * @param dma The eDMA peripheral base address, NULL to disconnect.
+ * @param rxChannel Channel of the receive request.
+ * @param txChannel Channel of the transmit request.
+ */
+void HOSTSIM_LpuartSetDmaRequest(LPUART_Type *base, DMA_Type *dma, uint32_t rxChannel, uint32_t txChannel);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HOSTSIM_LPUART_H_ */
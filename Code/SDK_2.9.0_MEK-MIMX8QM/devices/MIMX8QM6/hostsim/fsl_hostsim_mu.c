@@ -0,0 +1,372 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_hostsim_mu.h"
+#include "fsl_common.h"
+
+/*
+ * MU model: the side of the MU seen by the core, with the host on the other side. The messages, the general
+ * purpose interrupts and the flags reach the other side after a fixed latency. The reset of the other core,
+ * the boot and the NMI are not modelled.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_MU_REG_COUNT (4U)
+
+/* Bit of register or interrupt n in a 4-bit field of SR or CR: n = 0 is the most significant bit. */
+#define HOSTSIM_MU_BIT(shift, n) (1UL << ((shift) + 3U - (n)))
+
+typedef struct _hostsim_mu
+{
+    hostsim_region_t region;
+    MU_Type *base;
+    int32_t irq;
+
+    hostsim_event_t txEvent[HOSTSIM_MU_REG_COUNT];
+    hostsim_event_t interruptEvent;
+    hostsim_event_t flagsEvent;
+
+    uint32_t input[HOSTSIM_MU_REG_COUNT][HOSTSIM_MU_INPUT_SIZE];
+    uint32_t inputHead[HOSTSIM_MU_REG_COUNT];
+    uint32_t inputCount[HOSTSIM_MU_REG_COUNT];
+
+    hostsim_mu_callback_t callback;
+    void *userData;
+} hostsim_mu_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void HOSTSIM_MuReadDone(hostsim_region_t *region, uint32_t offset);
+static void HOSTSIM_MuWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static MU_Type *const s_muBases[] = MU_BASE_PTRS;
+static hostsim_mu_t s_mus[ARRAY_SIZE(s_muBases)];
+
+/* The device header has no table of the MU interrupts: both sides of the LSIO MUs with two sides. */
+#define HOSTSIM_MU_IRQ(n, side) {LSIO__MU##n##_##side, LSIO_MU##n##_INT_##side##_IRQn}
+static const struct
+{
+    MU_Type *base;
+    IRQn_Type irq;
+} s_muIrqs[] = {
+#if defined(LSIO__MU5_A)
+    HOSTSIM_MU_IRQ(5, A),  HOSTSIM_MU_IRQ(5, B),
+#endif
+#if defined(LSIO__MU6_A)
+    HOSTSIM_MU_IRQ(6, A),  HOSTSIM_MU_IRQ(6, B),
+#endif
+#if defined(LSIO__MU7_A)
+    HOSTSIM_MU_IRQ(7, A),  HOSTSIM_MU_IRQ(7, B),
+#endif
+#if defined(LSIO__MU8_A)
+    HOSTSIM_MU_IRQ(8, A),  HOSTSIM_MU_IRQ(8, B),
+#endif
+#if defined(LSIO__MU9_A)
+    HOSTSIM_MU_IRQ(9, A),  HOSTSIM_MU_IRQ(9, B),
+#endif
+#if defined(LSIO__MU10_A)
+    HOSTSIM_MU_IRQ(10, A), HOSTSIM_MU_IRQ(10, B),
+#endif
+#if defined(LSIO__MU11_A)
+    HOSTSIM_MU_IRQ(11, A), HOSTSIM_MU_IRQ(11, B),
+#endif
+#if defined(LSIO__MU12_A)
+    HOSTSIM_MU_IRQ(12, A), HOSTSIM_MU_IRQ(12, B),
+#endif
+#if defined(LSIO__MU13_A)
+    HOSTSIM_MU_IRQ(13, A), HOSTSIM_MU_IRQ(13, B),
+#endif
+};
+
+static const hostsim_region_ops_t s_muOps = {
+    .refresh  = NULL,
+    .readDone = HOSTSIM_MuReadDone,
+    .write    = HOSTSIM_MuWrite,
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static hostsim_mu_t *HOSTSIM_MuGet(MU_Type *base)
+{
+    uint32_t instance;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_muBases); instance++)
+    {
+        if (s_muBases[instance] == base)
+        {
+            return &s_mus[instance];
+        }
+    }
+    HOSTSIM_Fatal("MU 0x%08x is not simulated", (unsigned)(uintptr_t)base);
+}
+
+static inline MU_Type *HOSTSIM_MuRegs(hostsim_mu_t *mu)
+{
+    return (MU_Type *)(uintptr_t)mu->region.regs;
+}
+
+static void HOSTSIM_MuUpdateIrq(hostsim_mu_t *mu)
+{
+    MU_Type *regs = HOSTSIM_MuRegs(mu);
+    uint32_t full;
+    uint32_t empty;
+    uint32_t pending;
+
+    if (mu->irq < 0)
+    {
+        return;
+    }
+    full    = ((regs->SR & MU_SR_RFn_MASK) >> MU_SR_RFn_SHIFT) & ((regs->CR & MU_CR_RIEn_MASK) >> MU_CR_RIEn_SHIFT);
+    empty   = ((regs->SR & MU_SR_TEn_MASK) >> MU_SR_TEn_SHIFT) & ((regs->CR & MU_CR_TIEn_MASK) >> MU_CR_TIEn_SHIFT);
+    pending = ((regs->SR & MU_SR_GIPn_MASK) >> MU_SR_GIPn_SHIFT) & ((regs->CR & MU_CR_GIEn_MASK) >> MU_CR_GIEn_SHIFT);
+    HOSTSIM_SetIrqLevel(mu->irq, (full | empty | pending) != 0U);
+}
+
+/* Moves the next message sent by the host in an empty receive register. */
+static void HOSTSIM_MuDeliver(hostsim_mu_t *mu, uint32_t regIndex)
+{
+    MU_Type *regs = HOSTSIM_MuRegs(mu);
+
+    if ((mu->inputCount[regIndex] == 0U) || ((regs->SR & HOSTSIM_MU_BIT(MU_SR_RFn_SHIFT, regIndex)) != 0U))
+    {
+        return;
+    }
+    HOSTSIM_Write32(&mu->region, (uint32_t)offsetof(MU_Type, RR) + (regIndex * sizeof(uint32_t)),
+                    mu->input[regIndex][mu->inputHead[regIndex]]);
+    regs->SR |= HOSTSIM_MU_BIT(MU_SR_RFn_SHIFT, regIndex);
+    mu->inputHead[regIndex] = (mu->inputHead[regIndex] + 1U) % HOSTSIM_MU_INPUT_SIZE;
+    mu->inputCount[regIndex]--;
+}
+
+/* A message reached the other side. */
+static void HOSTSIM_MuTxArrive(void *param)
+{
+    hostsim_event_t *event = (hostsim_event_t *)param;
+    hostsim_mu_t *mu       = NULL;
+    uint32_t regIndex      = 0U;
+    uint32_t instance;
+
+    for (instance = 0U; (mu == NULL) && (instance < ARRAY_SIZE(s_mus)); instance++)
+    {
+        for (regIndex = 0U; regIndex < HOSTSIM_MU_REG_COUNT; regIndex++)
+        {
+            if (event == &s_mus[instance].txEvent[regIndex])
+            {
+                mu = &s_mus[instance];
+                break;
+            }
+        }
+    }
+
+    if ((mu != NULL) && (mu->callback != NULL))
+    {
+        HOSTSIM_MuRegs(mu)->SR |= HOSTSIM_MU_BIT(MU_SR_TEn_SHIFT, regIndex);
+        mu->callback(mu->base, kHOSTSIM_MuMessage, regIndex, HOSTSIM_MuRegs(mu)->TR[regIndex], mu->userData);
+        HOSTSIM_MuUpdateIrq(mu);
+    }
+}
+
+/* The general purpose interrupts reached the other side, which accepts them. */
+static void HOSTSIM_MuInterruptArrive(void *param)
+{
+    hostsim_mu_t *mu = (hostsim_mu_t *)param;
+    MU_Type *regs    = HOSTSIM_MuRegs(mu);
+    uint32_t requests = regs->CR & MU_CR_GIRn_MASK;
+    uint32_t index;
+
+    regs->CR &= ~MU_CR_GIRn_MASK;
+    for (index = 0U; (index < HOSTSIM_MU_REG_COUNT) && (mu->callback != NULL); index++)
+    {
+        if ((requests & HOSTSIM_MU_BIT(MU_CR_GIRn_SHIFT, index)) != 0U)
+        {
+            mu->callback(mu->base, kHOSTSIM_MuGeneralInterrupt, index, 0U, mu->userData);
+        }
+    }
+}
+
+static void HOSTSIM_MuFlagsArrive(void *param)
+{
+    hostsim_mu_t *mu = (hostsim_mu_t *)param;
+    MU_Type *regs    = HOSTSIM_MuRegs(mu);
+
+    regs->SR &= ~MU_SR_FUP_MASK;
+    if (mu->callback != NULL)
+    {
+        mu->callback(mu->base, kHOSTSIM_MuFlags, 0U, (regs->CR & MU_CR_Fn_MASK) >> MU_CR_Fn_SHIFT, mu->userData);
+    }
+}
+
+static void HOSTSIM_MuReset(hostsim_mu_t *mu)
+{
+    MU_Type *regs = HOSTSIM_MuRegs(mu);
+    uint32_t regIndex;
+
+    for (regIndex = 0U; regIndex < HOSTSIM_MU_REG_COUNT; regIndex++)
+    {
+        HOSTSIM_EventCancel(&mu->txEvent[regIndex]);
+        mu->inputCount[regIndex] = 0U;
+    }
+    HOSTSIM_EventCancel(&mu->interruptEvent);
+    HOSTSIM_EventCancel(&mu->flagsEvent);
+    regs->CR = 0U;
+    regs->SR = MU_SR_TEn_MASK;
+}
+
+static void HOSTSIM_MuReadDone(hostsim_region_t *region, uint32_t offset)
+{
+    hostsim_mu_t *mu = (hostsim_mu_t *)region->model;
+    uint32_t regIndex;
+
+    if ((offset - (uint32_t)offsetof(MU_Type, RR)) < sizeof(HOSTSIM_MuRegs(mu)->RR))
+    {
+        regIndex = (offset - (uint32_t)offsetof(MU_Type, RR)) / sizeof(uint32_t);
+        HOSTSIM_MuRegs(mu)->SR &= ~HOSTSIM_MU_BIT(MU_SR_RFn_SHIFT, regIndex);
+        HOSTSIM_MuDeliver(mu, regIndex);
+        HOSTSIM_MuUpdateIrq(mu);
+    }
+}
+
+static void HOSTSIM_MuWrite(hostsim_region_t *region, uint32_t offset, uint32_t oldValue, uint32_t newValue)
+{
+    hostsim_mu_t *mu = (hostsim_mu_t *)region->model;
+    MU_Type *regs    = HOSTSIM_MuRegs(mu);
+    uint32_t regIndex;
+
+    if ((offset - (uint32_t)offsetof(MU_Type, TR)) < sizeof(regs->TR))
+    {
+        regIndex = (offset - (uint32_t)offsetof(MU_Type, TR)) / sizeof(uint32_t);
+        regs->SR &= ~HOSTSIM_MU_BIT(MU_SR_TEn_SHIFT, regIndex);
+        HOSTSIM_EventSchedule(&mu->txEvent[regIndex], HOSTSIM_MU_LATENCY_NS, HOSTSIM_MuTxArrive,
+                              &mu->txEvent[regIndex]);
+    }
+    else if ((offset - (uint32_t)offsetof(MU_Type, RR)) < sizeof(regs->RR))
+    {
+        /* Read only. */
+        HOSTSIM_Write32(&mu->region, offset, oldValue);
+    }
+    else if (offset == offsetof(MU_Type, SR))
+    {
+        /* The general purpose interrupt pending bits are cleared by writing one, the others are read only. */
+        regs->SR = oldValue & ~(newValue & MU_SR_GIPn_MASK);
+    }
+    else if (offset == offsetof(MU_Type, CR))
+    {
+#if defined(MU_CR_MUR_MASK)
+        if ((newValue & MU_CR_MUR_MASK) != 0U)
+        {
+            HOSTSIM_MuReset(mu);
+            HOSTSIM_MuUpdateIrq(mu);
+            return;
+        }
+#endif /* MU_CR_MUR_MASK */
+        /* Writing zero to a general purpose interrupt request has no effect. */
+        regs->CR = newValue | (oldValue & MU_CR_GIRn_MASK);
+        if ((newValue & ~oldValue & MU_CR_GIRn_MASK) != 0U)
+        {
+            HOSTSIM_EventSchedule(&mu->interruptEvent, HOSTSIM_MU_LATENCY_NS, HOSTSIM_MuInterruptArrive, mu);
+        }
+        if (((newValue ^ oldValue) & MU_CR_Fn_MASK) != 0U)
+        {
+            regs->SR |= MU_SR_FUP_MASK;
+            HOSTSIM_EventSchedule(&mu->flagsEvent, HOSTSIM_MU_LATENCY_NS, HOSTSIM_MuFlagsArrive, mu);
+        }
+    }
+    else
+    {
+        /* Other registers are storage. */
+    }
+    HOSTSIM_MuUpdateIrq(mu);
+}
+
+void HOSTSIM_MuSetRemote(MU_Type *base, hostsim_mu_callback_t callback, void *userData)
+{
+    hostsim_mu_t *mu = HOSTSIM_MuGet(base);
+
+    mu->callback = callback;
+    mu->userData = userData;
+}
+
+bool HOSTSIM_MuRemoteSend(MU_Type *base, uint32_t regIndex, uint32_t msg)
+{
+    hostsim_mu_t *mu = HOSTSIM_MuGet(base);
+
+    if ((regIndex >= HOSTSIM_MU_REG_COUNT) || (mu->inputCount[regIndex] == HOSTSIM_MU_INPUT_SIZE))
+    {
+        return false;
+    }
+    mu->input[regIndex][(mu->inputHead[regIndex] + mu->inputCount[regIndex]) % HOSTSIM_MU_INPUT_SIZE] = msg;
+    mu->inputCount[regIndex]++;
+    HOSTSIM_MuDeliver(mu, regIndex);
+    HOSTSIM_MuUpdateIrq(mu);
+    return true;
+}
+
+bool HOSTSIM_MuRemoteReceive(MU_Type *base, uint32_t regIndex, uint32_t *msg)
+{
+    hostsim_mu_t *mu = HOSTSIM_MuGet(base);
+    MU_Type *regs    = HOSTSIM_MuRegs(mu);
+
+    /* The message is readable once it reached the other side. */
+    if ((regIndex >= HOSTSIM_MU_REG_COUNT) || ((regs->SR & HOSTSIM_MU_BIT(MU_SR_TEn_SHIFT, regIndex)) != 0U) ||
+        mu->txEvent[regIndex].scheduled)
+    {
+        return false;
+    }
+    *msg = regs->TR[regIndex];
+    regs->SR |= HOSTSIM_MU_BIT(MU_SR_TEn_SHIFT, regIndex);
+    HOSTSIM_MuUpdateIrq(mu);
+    return true;
+}
+
+void HOSTSIM_MuRemoteTriggerInterrupt(MU_Type *base, uint32_t index)
+{
+    hostsim_mu_t *mu = HOSTSIM_MuGet(base);
+
+    HOSTSIM_MuRegs(mu)->SR |= HOSTSIM_MU_BIT(MU_SR_GIPn_SHIFT, index & 3U);
+    HOSTSIM_MuUpdateIrq(mu);
+}
+
+void HOSTSIM_MuRemoteSetFlags(MU_Type *base, uint32_t flags)
+{
+    MU_Type *regs = HOSTSIM_MuRegs(HOSTSIM_MuGet(base));
+
+    regs->SR = (regs->SR & ~MU_SR_Fn_MASK) | ((flags << MU_SR_Fn_SHIFT) & MU_SR_Fn_MASK);
+}
+
+__attribute__((constructor(102))) static void HOSTSIM_MuInit(void)
+{
+    hostsim_mu_t *mu;
+    uint32_t instance;
+    uint32_t i;
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_muBases); instance++)
+    {
+        mu       = &s_mus[instance];
+        mu->base = s_muBases[instance];
+        mu->irq  = -1;
+        for (i = 0U; i < ARRAY_SIZE(s_muIrqs); i++)
+        {
+            if (s_muIrqs[i].base == mu->base)
+            {
+                mu->irq = (int32_t)s_muIrqs[i].irq;
+            }
+        }
+        HOSTSIM_RegionInit(&mu->region, "MU", (uintptr_t)mu->base, sizeof(MU_Type), &s_muOps, mu);
+        HOSTSIM_MuReset(mu);
+    }
+}
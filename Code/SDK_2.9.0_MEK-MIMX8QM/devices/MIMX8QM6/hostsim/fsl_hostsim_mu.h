@@ -0,0 +1,119 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef _FSL_HOSTSIM_MU_H_
+#define _FSL_HOSTSIM_MU_H_
+
+#include "fsl_device_registers.h"
+#include "fsl_hostsim.h"
+
+/*!
+ * @addtogroup hostsim_mu
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Time for a message, a general purpose interrupt or the flags to reach the other side, in ns. */
+#ifndef HOSTSIM_MU_LATENCY_NS
+#define HOSTSIM_MU_LATENCY_NS (100U)
+#endif
+
+/*! @brief Number of the messages sent by the host that each receive register of an MU queues. */
+#ifndef HOSTSIM_MU_INPUT_SIZE
+#define HOSTSIM_MU_INPUT_SIZE (16U)
+#endif
+
+/*! @brief Events of the simulated MU reaching the other side. */
+typedef enum _hostsim_mu_event
+{
+    kHOSTSIM_MuMessage          = 0U, /*!< A transmit register was written: index of the register, value. */
+    kHOSTSIM_MuGeneralInterrupt = 1U, /*!< A general purpose interrupt was triggered: index of the interrupt. */
+    kHOSTSIM_MuFlags            = 2U, /*!< The 3-bit flags were set: value. */
+} hostsim_mu_event_t;
+
+/*!
+ * @brief Callback of the other side of an MU, the host.
+ *
+ * @param base The MU peripheral base address.
+ * @param event The event.
+ * @param index Index of the register or of the general purpose interrupt.
+ * @param value The message or the flags.
+ * @param userData Parameter of the callback.
+ */
+typedef void (*hostsim_mu_callback_t)(
+    MU_Type *base, hostsim_mu_event_t event, uint32_t index, uint32_t value, void *userData);
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Sets the callback of the other side of an MU.
+ *
+ * The other side reads each message when it arrives, so that the transmit register becomes empty again,
+ * and acknowledges each general purpose interrupt. Without callback the messages stay in the transmit
+ * registers until @ref HOSTSIM_MuRemoteReceive.
+ *
+ * @param base The MU peripheral base address.
+ * @param callback The callback, NULL to read the messages with @ref HOSTSIM_MuRemoteReceive.
+ * @param userData Parameter of the callback.
+ */
+void HOSTSIM_MuSetRemote(MU_Type *base, hostsim_mu_callback_t callback, void *userData);
+
+/*!
+ * @brief Sends a message from the other side of an MU.
+ *
+ * The message arrives in the receive register once it is empty, after the previous messages.
+ *
+ * @param base The MU peripheral base address.
+ * @param regIndex Index of the receive register.
+ * @param msg The message.
+ * @retval true The message is queued.
+ * @retval false The queue of the receive register is full.
+ */
+bool HOSTSIM_MuRemoteSend(MU_Type *base, uint32_t regIndex, uint32_t msg);
+
+/*!
+ * @brief Reads a message on the other side of an MU, which empties the transmit register.
+ *
+ * @param base The MU peripheral base address.
+ * @param regIndex Index of the transmit register.
+ * @param msg The message.
+ * @retval true A message was read.
+ * @retval false The transmit register is empty.
+ */
+bool HOSTSIM_MuRemoteReceive(MU_Type *base, uint32_t regIndex, uint32_t *msg);
+
+/*!
+ * @brief Triggers a general purpose interrupt from the other side of an MU.
+ *
+ * @param base The MU peripheral base address.
+ * @param index Index of the general purpose interrupt.
+ */
+void HOSTSIM_MuRemoteTriggerInterrupt(MU_Type *base, uint32_t index);
+
+/*!
+ * @brief Sets the 3-bit flags from the other side of an MU.
+ *
+ * @param base The MU peripheral base address.
+ * @param flags The flags.
+ */
+void HOSTSIM_MuRemoteSetFlags(MU_Type *base, uint32_t flags);
+
+#if defined(__cplusplus)
+}
+#endif
+
+/*! @}*/
+
+#endif /* _FSL_HOSTSIM_MU_H_ */
@@ -0,0 +1,1452 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_device_registers.h"
+
+/*
+ * Vector table of the host simulation, generated from gcc/startup_MIMX8QM6_cm4_core0.S: the same weak
+ * handlers forward to the same driver handlers, and the table is laid out as on the device so that
+ * InstallIRQHandler() and the NVIC functions work unchanged.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define HOSTSIM_VECTOR_COUNT (640U)
+
+/*
+ * Entry of the vector table. The handlers are 32-bit addresses as on the device, which only a non-PIE
+ * host executable provides: the table is assembled, as a C initializer could not truncate the addresses,
+ * and a PIE link fails on its 32-bit relocations.
+ */
+#define HOSTSIM_VECTOR(handler) "    .long " #handler "\n"
+
+/* Handler with no implementation: weak alias of the default handler. */
+#define HOSTSIM_DEFAULT_HANDLER(handler) void handler(void) __attribute__((weak, alias("HOSTSIM_DefaultHandler")));
+
+/* Handler of a shared interrupt, forwarding to the handler of the driver. */
+#define HOSTSIM_FORWARD_HANDLER(handler, driverHandler) \
+    void handler(void) __attribute__((weak));           \
+    void handler(void)                                  \
+    {                                                   \
+        driverHandler();                                \
+    }
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+void HOSTSIM_DefaultHandler(void);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+void HOSTSIM_DefaultHandler(void)
+{
+    HOSTSIM_Fatal("unhandled exception %u", (unsigned)__get_IPSR());
+}
+
+HOSTSIM_DEFAULT_HANDLER(NMI_Handler)
+HOSTSIM_DEFAULT_HANDLER(HardFault_Handler)
+HOSTSIM_DEFAULT_HANDLER(MemManage_Handler)
+HOSTSIM_DEFAULT_HANDLER(BusFault_Handler)
+HOSTSIM_DEFAULT_HANDLER(UsageFault_Handler)
+HOSTSIM_DEFAULT_HANDLER(SVC_Handler)
+HOSTSIM_DEFAULT_HANDLER(DebugMon_Handler)
+HOSTSIM_DEFAULT_HANDLER(PendSV_Handler)
+HOSTSIM_DEFAULT_HANDLER(SysTick_Handler)
+HOSTSIM_DEFAULT_HANDLER(Reserved16_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved17_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved18_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved19_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved20_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_MCM_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved22_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved23_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved24_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved25_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved26_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved27_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved28_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved29_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved30_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved31_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved32_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved33_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved34_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_TPM_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved36_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved37_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_LPIT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved39_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved40_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved42_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved44_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_MU0_B0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved46_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved47_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved56_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved57_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved58_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved59_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_MU0_B1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_MU0_B2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_MU0_B3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved63_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved64_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_MU1_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_SW_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved67_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved68_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved69_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved70_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved71_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved72_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved73_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved74_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved75_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved76_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved77_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved78_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved79_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved80_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved81_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved82_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved83_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved84_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved85_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved86_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved87_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved88_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved89_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved90_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved91_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved92_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved93_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved94_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved95_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved96_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved97_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved98_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(A53_NEXTERRIRQ_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(A53_NINTERRIRQ_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(A72_NEXTERRIRQ_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(A72_NINTERRIRQ_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_NEXTERRIRQ_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved104_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved105_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved106_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CCI_NERRORIRQ_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CCI_NEVNTCNTOVERFLOW0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CCI_NEVNTCNTOVERFLOW1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CCI_NEVNTCNTOVERFLOW2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CCI_NEVNTCNTOVERFLOW3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CCI_NEVNTCNTOVERFLOW4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved113_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved114_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INT_OUT7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_1_INT_OUT7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_COMB_IRPT_NS_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_COMB_IRPT_S_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_GBL_FLT_IRPT_NS_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_GBL_FLT_IRPT_S_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_PERF_IRPT_IMX8_0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_PERF_IRPT_IMX8_1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_PERF_IRPT_IMX8_2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DBLOG_PERF_IRPT_IMX8_3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_RESERVED_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT9_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT10_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT11_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY0_INT_OUT12_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved152_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved153_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved154_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved155_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LVDS0_INT_OUT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LVDS1_INT_OUT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HDMI_TX_INT_OUT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved161_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved162_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(GPU0_XAQ2_INTR_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(GPU1_XAQ2_INTR_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_MSI_CTRL_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_CLK_REQ_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_INT_D_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_INT_C_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_SMLH_REQ_RST_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_GPIO_WAKEUP0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_GPIO_WAKEUP1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPT0_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPT1_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPT2_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPT3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPT4_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_KPP_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved185_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved186_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_SATA_INT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_SATA_INT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved189_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved190_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM0_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM1_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM2_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM4_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM5_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM6_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_PWM7_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_MSI_CTRL_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_CLK_REQ_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_INT_D_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_INT_C_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_SMLH_REQ_RST_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_GPIO_WAKEUP0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_GPIO_WAKEUP1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_INT_OUT7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_SYS_COUNT_INT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_SYS_COUNT_INT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_SYS_COUNT_INT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SCU_SYS_COUNT_INT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved223_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved224_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved225_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved226_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DRC0_DFI_ALERT_ERR_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DRC1_DFI_ALERT_ERR_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DRC0_PERF_CNT_FULL_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DRC1_PERF_CNT_FULL_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved231_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved232_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved233_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved234_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_GPIO_INT7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved243_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved244_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved245_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved246_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved247_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved248_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved249_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved250_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_RESERVED_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT9_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT10_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT11_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DISPLAY1_INT_OUT12_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved264_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved265_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved266_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_SYS_INT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_SYS_INT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved269_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved270_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved271_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved272_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved273_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved274_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU0_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU1_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU2_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU4_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved280_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved281_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved282_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU5_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU6_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU7_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU8_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU9_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU10_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU11_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU12_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU13_INT_A_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved292_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved293_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved294_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved295_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved296_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved297_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved298_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU5_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU6_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU7_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU8_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU9_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU10_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU11_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU12_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_MU13_INT_B_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved308_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved309_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved310_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved311_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved312_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved313_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved314_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved347_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved348_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved349_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved350_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved351_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved352_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved353_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved354_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_DTCP_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_MLB_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_MLB_AHB_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_USB_OTG_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_USB_HOST_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_UTMI_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_WAKEUP_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_USB3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ND_FLASH_BCH_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ND_FLASH_GPMI_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved376_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved377_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved378_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved379_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved380_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved381_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved382_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved383_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved384_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved385_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved386_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MSI_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved388_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved389_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved390_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved391_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved392_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved393_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved394_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved395_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_ENC0_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_ENC1_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_ENC2_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_ENC3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_DEC0_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_DEC1_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_DEC2_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_MJPEG_DEC3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved412_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(MIPI_CSI0_OUT_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(MIPI_CSI1_OUT_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HDMI_RX_OUT_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved432_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved433_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved434_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved465_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved466_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ASRC0_INT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ASRC0_INT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ASRC1_INT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ASRC1_INT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_UNUSED_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_GPT0_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_GPT1_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_GPT2_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_GPT3_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_GPT4_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_GPT5_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved512_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved513_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved514_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_MU1_A_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_MU2_A_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_MU3_A_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_CAAM_INT0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_CAAM_INT1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_CAAM_INT2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_CAAM_INT3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(SECURITY_CAAM_RTIC_INT_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_0_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_1_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_2_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_3_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_4_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_5_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_6_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(VPU_VPU_INT_7_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved571_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved572_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved573_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved574_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved575_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved576_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved577_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved578_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved579_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved581_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved582_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved584_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved585_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved587_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved589_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved590_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved591_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved592_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved593_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved594_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved595_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved596_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved597_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved598_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved599_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved600_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved601_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved602_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved603_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved604_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved605_IRQHandler)
+HOSTSIM_DEFAULT_HANDLER(Reserved606_IRQHandler)
+
+HOSTSIM_DEFAULT_HANDLER(M4_0_LPUART_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_LPI2C_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_0_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_1_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_2_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_3_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_4_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_5_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_6_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IRQSTEER_7_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(MIPI_DSI0_INT_OUT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(MIPI_DSI1_INT_OUT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEA_DMA_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_OCTASPI0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(LSIO_OCTASPI1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(HSIO_PCIEB_DMA_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI3_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C3_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C4_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART3_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART4_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SIM0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SIM1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_USDHC0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_USDHC1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_USDHC2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FLEXCAN0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FLEXCAN1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FLEXCAN2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FTM0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FTM1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_ADC0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_ADC1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET0_FRAME1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET0_FRAME2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET0_FRAME0_EVENT_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET0_TIMER_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET1_FRAME1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET1_FRAME2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET1_FRAME0_EVENT_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_ENET1_TIMER_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_APBHDMA_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(CONNECTIVITY_DMA_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM3_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM4_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM5_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM6_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(IMAGING_PDMA_STREAM7_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI2_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI3_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI_HDMI_RX_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI_HDMI_TX_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI6_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI7_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI2_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SPI3_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C2_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C3_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_I2C4_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART2_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART3_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_UART4_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SIM0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_SIM1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FLEXCAN0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FLEXCAN1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FLEXCAN2_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FTM0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_FTM1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_ADC0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(DMA_ADC1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ESAI0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ESAI1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI0_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI1_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI2_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI3_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI_HDMI_RX_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI_HDMI_TX_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI6_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SAI7_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF0_RX_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF0_TX_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF1_RX_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF1_TX_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ESAI0_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_ESAI1_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF0_RX_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF0_TX_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF1_RX_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(AUDIO_SPDIF1_TX_MOD_INT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_TPM_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_LPIT_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_LPUART_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_LPI2C_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_MU0_A3_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_MU0_A2_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_MU0_A1_DriverIRQHandler)
+HOSTSIM_DEFAULT_HANDLER(M4_0_INTMUX_SOURCE_MU0_A0_DriverIRQHandler)
+
+HOSTSIM_FORWARD_HANDLER(M4_0_LPUART_IRQHandler, M4_0_LPUART_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_LPI2C_IRQHandler, M4_0_LPI2C_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_0_IRQHandler, IRQSTEER_0_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_1_IRQHandler, IRQSTEER_1_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_2_IRQHandler, IRQSTEER_2_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_3_IRQHandler, IRQSTEER_3_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_4_IRQHandler, IRQSTEER_4_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_5_IRQHandler, IRQSTEER_5_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_6_IRQHandler, IRQSTEER_6_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IRQSTEER_7_IRQHandler, IRQSTEER_7_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(MIPI_DSI0_INT_OUT_IRQHandler, MIPI_DSI0_INT_OUT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(MIPI_DSI1_INT_OUT_IRQHandler, MIPI_DSI1_INT_OUT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EDMA0_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EDMA0_ERR_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EDMA1_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EDMA1_ERR_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(HSIO_PCIEA_DMA_INT_IRQHandler, HSIO_PCIEA_DMA_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(LSIO_OCTASPI0_INT_IRQHandler, LSIO_OCTASPI0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(LSIO_OCTASPI1_INT_IRQHandler, LSIO_OCTASPI1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(HSIO_PCIEB_DMA_INT_IRQHandler, HSIO_PCIEB_DMA_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI0_INT_IRQHandler, DMA_SPI0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI1_INT_IRQHandler, DMA_SPI1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI2_INT_IRQHandler, DMA_SPI2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI3_INT_IRQHandler, DMA_SPI3_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C0_INT_IRQHandler, DMA_I2C0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C1_INT_IRQHandler, DMA_I2C1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C2_INT_IRQHandler, DMA_I2C2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C3_INT_IRQHandler, DMA_I2C3_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C4_INT_IRQHandler, DMA_I2C4_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART0_INT_IRQHandler, DMA_UART0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART1_INT_IRQHandler, DMA_UART1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART2_INT_IRQHandler, DMA_UART2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART3_INT_IRQHandler, DMA_UART3_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART4_INT_IRQHandler, DMA_UART4_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM0_INT_IRQHandler, DMA_SIM0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM1_INT_IRQHandler, DMA_SIM1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_USDHC0_INT_IRQHandler, CONNECTIVITY_USDHC0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_USDHC1_INT_IRQHandler, CONNECTIVITY_USDHC1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_USDHC2_INT_IRQHandler, CONNECTIVITY_USDHC2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN0_INT_IRQHandler, DMA_FLEXCAN0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN1_INT_IRQHandler, DMA_FLEXCAN1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN2_INT_IRQHandler, DMA_FLEXCAN2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FTM0_INT_IRQHandler, DMA_FTM0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FTM1_INT_IRQHandler, DMA_FTM1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_ADC0_INT_IRQHandler, DMA_ADC0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_ADC1_INT_IRQHandler, DMA_ADC1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EXTERNAL_DMA_INT_0_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EXTERNAL_DMA_INT_1_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EXTERNAL_DMA_INT_2_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EXTERNAL_DMA_INT_3_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EXTERNAL_DMA_INT_4_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_EXTERNAL_DMA_INT_5_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET0_FRAME1_INT_IRQHandler, CONNECTIVITY_ENET0_FRAME1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET0_FRAME2_INT_IRQHandler, CONNECTIVITY_ENET0_FRAME2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQHandler, CONNECTIVITY_ENET0_FRAME0_EVENT_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET0_TIMER_INT_IRQHandler, CONNECTIVITY_ENET0_TIMER_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET1_FRAME1_INT_IRQHandler, CONNECTIVITY_ENET1_FRAME1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET1_FRAME2_INT_IRQHandler, CONNECTIVITY_ENET1_FRAME2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQHandler, CONNECTIVITY_ENET1_FRAME0_EVENT_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_ENET1_TIMER_INT_IRQHandler, CONNECTIVITY_ENET1_TIMER_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_APBHDMA_IRQHandler, CONNECTIVITY_APBHDMA_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_DMA_INT_IRQHandler, CONNECTIVITY_DMA_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(CONNECTIVITY_DMA_ERR_INT_IRQHandler, CONNECTIVITY_DMA_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM0_INT_IRQHandler, IMAGING_PDMA_STREAM0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM1_INT_IRQHandler, IMAGING_PDMA_STREAM1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM2_INT_IRQHandler, IMAGING_PDMA_STREAM2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM3_INT_IRQHandler, IMAGING_PDMA_STREAM3_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM4_INT_IRQHandler, IMAGING_PDMA_STREAM4_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM5_INT_IRQHandler, IMAGING_PDMA_STREAM5_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM6_INT_IRQHandler, IMAGING_PDMA_STREAM6_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(IMAGING_PDMA_STREAM7_INT_IRQHandler, IMAGING_PDMA_STREAM7_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI0_MOD_INT_IRQHandler, AUDIO_SAI0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI0_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI1_MOD_INT_IRQHandler, AUDIO_SAI1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI1_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI2_MOD_INT_IRQHandler, AUDIO_SAI2_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI2_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI3_MOD_INT_IRQHandler, AUDIO_SAI3_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI3_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI_HDMI_RX_MOD_INT_IRQHandler, AUDIO_SAI_HDMI_RX_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI_HDMI_RX_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI_HDMI_TX_MOD_INT_IRQHandler, AUDIO_SAI_HDMI_TX_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI_HDMI_TX_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI6_MOD_INT_IRQHandler, AUDIO_SAI6_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI6_DMA_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI7_MOD_INT_IRQHandler, AUDIO_SAI7_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI7_DMA_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI0_MOD_INT_IRQHandler, DMA_SPI0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI1_MOD_INT_IRQHandler, DMA_SPI1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI2_MOD_INT_IRQHandler, DMA_SPI2_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI3_MOD_INT_IRQHandler, DMA_SPI3_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C0_MOD_INT_IRQHandler, DMA_I2C0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C1_MOD_INT_IRQHandler, DMA_I2C1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C2_MOD_INT_IRQHandler, DMA_I2C2_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C3_MOD_INT_IRQHandler, DMA_I2C3_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C4_MOD_INT_IRQHandler, DMA_I2C4_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART0_MOD_INT_IRQHandler, DMA_UART0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART1_MOD_INT_IRQHandler, DMA_UART1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART2_MOD_INT_IRQHandler, DMA_UART2_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART3_MOD_INT_IRQHandler, DMA_UART3_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART4_MOD_INT_IRQHandler, DMA_UART4_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM0_MOD_INT_IRQHandler, DMA_SIM0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM1_MOD_INT_IRQHandler, DMA_SIM1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN0_MOD_INT_IRQHandler, DMA_FLEXCAN0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN1_MOD_INT_IRQHandler, DMA_FLEXCAN1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN2_MOD_INT_IRQHandler, DMA_FLEXCAN2_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FTM0_MOD_INT_IRQHandler, DMA_FTM0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FTM1_MOD_INT_IRQHandler, DMA_FTM1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_ADC0_MOD_INT_IRQHandler, DMA_ADC0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_ADC1_MOD_INT_IRQHandler, DMA_ADC1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN0_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN1_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FLEXCAN2_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FTM0_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_FTM1_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_ADC0_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_ADC1_DMA_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_EDMA0_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_EDMA0_ERR_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_EDMA1_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_EDMA1_ERR_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA0_CH0_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA0_CH1_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA0_CH2_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA0_CH3_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA0_CH4_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA0_CH5_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA1_CH0_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA1_CH1_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA1_CH2_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA1_CH3_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA1_CH4_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_DMA1_CH5_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_ESAI0_INT_IRQHandler, AUDIO_ESAI0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_ESAI1_INT_IRQHandler, AUDIO_ESAI1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI0_INT_IRQHandler, AUDIO_SAI0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI1_INT_IRQHandler, AUDIO_SAI1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI2_INT_IRQHandler, AUDIO_SAI2_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI3_INT_IRQHandler, AUDIO_SAI3_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI_HDMI_RX_INT_IRQHandler, AUDIO_SAI_HDMI_RX_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI_HDMI_TX_INT_IRQHandler, AUDIO_SAI_HDMI_TX_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI6_INT_IRQHandler, AUDIO_SAI6_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SAI7_INT_IRQHandler, AUDIO_SAI7_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF0_RX_INT_IRQHandler, AUDIO_SPDIF0_RX_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF0_TX_INT_IRQHandler, AUDIO_SPDIF0_TX_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF1_RX_INT_IRQHandler, AUDIO_SPDIF1_RX_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF1_TX_INT_IRQHandler, AUDIO_SPDIF1_TX_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_ESAI0_MOD_INT_IRQHandler, AUDIO_ESAI0_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_ESAI0_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_ESAI1_MOD_INT_IRQHandler, AUDIO_ESAI1_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_ESAI1_DMA_INT_IRQHandler, AUDIO_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI0_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI0_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI1_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI1_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI2_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI2_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI3_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SPI3_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C0_DMA_RX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C0_DMA_TX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C1_DMA_RX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C1_DMA_TX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C2_DMA_RX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C2_DMA_TX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C3_DMA_RX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C3_DMA_TX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C4_DMA_RX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_I2C4_DMA_TX_INT_IRQHandler, DMA_EDMA1_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART0_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART0_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART1_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART1_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART2_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART2_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART3_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART3_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART4_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_UART4_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM0_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM0_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM1_DMA_RX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(DMA_SIM1_DMA_TX_INT_IRQHandler, DMA_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF0_RX_MOD_INT_IRQHandler, AUDIO_SPDIF0_RX_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF0_RX_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF0_TX_MOD_INT_IRQHandler, AUDIO_SPDIF0_TX_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF0_TX_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF1_RX_MOD_INT_IRQHandler, AUDIO_SPDIF1_RX_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF1_RX_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF1_TX_MOD_INT_IRQHandler, AUDIO_SPDIF1_TX_MOD_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(AUDIO_SPDIF1_TX_DMA_INT_IRQHandler, AUDIO_EDMA0_INT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_TPM_IRQHandler, M4_0_INTMUX_SOURCE_TPM_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_LPIT_IRQHandler, M4_0_INTMUX_SOURCE_LPIT_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_LPUART_IRQHandler, M4_0_INTMUX_SOURCE_LPUART_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_LPI2C_IRQHandler, M4_0_INTMUX_SOURCE_LPI2C_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_MU0_A3_IRQHandler, M4_0_INTMUX_SOURCE_MU0_A3_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_MU0_A2_IRQHandler, M4_0_INTMUX_SOURCE_MU0_A2_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_MU0_A1_IRQHandler, M4_0_INTMUX_SOURCE_MU0_A1_DriverIRQHandler)
+HOSTSIM_FORWARD_HANDLER(M4_0_INTMUX_SOURCE_MU0_A0_IRQHandler, M4_0_INTMUX_SOURCE_MU0_A0_DriverIRQHandler)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern uint32_t __VECTOR_TABLE[HOSTSIM_VECTOR_COUNT];
+
+__asm__(
+    "    .pushsection .data\n"
+    "    .balign 4\n"
+    "    .globl __VECTOR_TABLE\n"
+    "    .type __VECTOR_TABLE, @object\n"
+    "__VECTOR_TABLE:\n"
+    HOSTSIM_VECTOR(0)                                         /* Top of Stack, the host stack is used */
+    HOSTSIM_VECTOR(0)                                         /* Reset Handler, the host runs main() */
+    HOSTSIM_VECTOR(NMI_Handler)                               /* NMI Handler */
+    HOSTSIM_VECTOR(HardFault_Handler)                         /* Hard Fault Handler */
+    HOSTSIM_VECTOR(MemManage_Handler)                         /* MPU Fault Handler */
+    HOSTSIM_VECTOR(BusFault_Handler)                          /* Bus Fault Handler */
+    HOSTSIM_VECTOR(UsageFault_Handler)                        /* Usage Fault Handler */
+    HOSTSIM_VECTOR(0)                                         /* Reserved */
+    HOSTSIM_VECTOR(0)                                         /* Reserved */
+    HOSTSIM_VECTOR(0)                                         /* Reserved */
+    HOSTSIM_VECTOR(0)                                         /* Reserved */
+    HOSTSIM_VECTOR(SVC_Handler)                               /* SVCall Handler */
+    HOSTSIM_VECTOR(DebugMon_Handler)                          /* Debug Monitor Handler */
+    HOSTSIM_VECTOR(0)                                         /* Reserved */
+    HOSTSIM_VECTOR(PendSV_Handler)                            /* PendSV Handler */
+    HOSTSIM_VECTOR(SysTick_Handler)                           /* SysTick Handler */
+    HOSTSIM_VECTOR(Reserved16_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved17_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved18_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved19_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved20_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_MCM_IRQHandler)                       /* MCM IRQ */
+    HOSTSIM_VECTOR(Reserved22_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved23_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved24_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved25_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved26_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved27_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved28_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved29_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved30_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved31_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved32_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved33_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved34_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_TPM_IRQHandler)                       /* Timer PWM Module */
+    HOSTSIM_VECTOR(Reserved36_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved37_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_LPIT_IRQHandler)                      /* Low-Power Periodic Interrupt Timer */
+    HOSTSIM_VECTOR(Reserved39_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved40_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_LPUART_IRQHandler)                    /* Low Power UART */
+    HOSTSIM_VECTOR(Reserved42_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_LPI2C_IRQHandler)                     /* Low-Power I2C - Logical OR of master and slave interrupts */
+    HOSTSIM_VECTOR(Reserved44_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_MU0_B0_IRQHandler)                    /* Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 0, Logical OR of all general-purpose, TX, and RX interrupts */
+    HOSTSIM_VECTOR(Reserved46_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved47_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(IRQSTEER_0_IRQHandler)                     /* External interrupt 0 */
+    HOSTSIM_VECTOR(IRQSTEER_1_IRQHandler)                     /* External interrupt 1 */
+    HOSTSIM_VECTOR(IRQSTEER_2_IRQHandler)                     /* External interrupt 2 */
+    HOSTSIM_VECTOR(IRQSTEER_3_IRQHandler)                     /* External interrupt 3 */
+    HOSTSIM_VECTOR(IRQSTEER_4_IRQHandler)                     /* External interrupt 4 */
+    HOSTSIM_VECTOR(IRQSTEER_5_IRQHandler)                     /* External interrupt 5 */
+    HOSTSIM_VECTOR(IRQSTEER_6_IRQHandler)                     /* External interrupt 6 */
+    HOSTSIM_VECTOR(IRQSTEER_7_IRQHandler)                     /* External interrupt 7 */
+    HOSTSIM_VECTOR(Reserved56_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved57_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved58_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved59_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_MU0_B1_IRQHandler)                    /* Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 1, Logical OR of all general-purpose, TX, and RX interrupts */
+    HOSTSIM_VECTOR(M4_0_MU0_B2_IRQHandler)                    /* Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 2, Logical OR of all general-purpose, TX, and RX interrupts */
+    HOSTSIM_VECTOR(M4_0_MU0_B3_IRQHandler)                    /* Messaging Unit 0 (IPC with other subsystems) - Side B (local), Port 3, Logical OR of all general-purpose, TX, and RX interrupts */
+    HOSTSIM_VECTOR(Reserved63_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(Reserved64_IRQHandler)                     /* Reserved */
+    HOSTSIM_VECTOR(M4_0_MU1_A_IRQHandler)                     /* Messaging Unit 1 (IPC with System Controller) - Side A (MCU), Logical OR of all general-purpose, TX, and RX interrupts */
+    HOSTSIM_VECTOR(M4_0_SW_IRQHandler)                        /* Software interrupt (asserted/cleared via NVIC registers, INTISR[50] input tied low) */
+    HOSTSIM_VECTOR(Reserved67_IRQHandler)                     /* xxx Interrupt 67 */
+    HOSTSIM_VECTOR(Reserved68_IRQHandler)                     /* xxx Interrupt 68 */
+    HOSTSIM_VECTOR(Reserved69_IRQHandler)                     /* xxx Interrupt 69 */
+    HOSTSIM_VECTOR(Reserved70_IRQHandler)                     /* xxx Interrupt 70 */
+    HOSTSIM_VECTOR(Reserved71_IRQHandler)                     /* xxx Interrupt 71 */
+    HOSTSIM_VECTOR(Reserved72_IRQHandler)                     /* xxx Interrupt 72 */
+    HOSTSIM_VECTOR(Reserved73_IRQHandler)                     /* xxx Interrupt 73 */
+    HOSTSIM_VECTOR(Reserved74_IRQHandler)                     /* xxx Interrupt 74 */
+    HOSTSIM_VECTOR(Reserved75_IRQHandler)                     /* xxx Interrupt 75 */
+    HOSTSIM_VECTOR(Reserved76_IRQHandler)                     /* xxx Interrupt 76 */
+    HOSTSIM_VECTOR(Reserved77_IRQHandler)                     /* xxx Interrupt 77 */
+    HOSTSIM_VECTOR(Reserved78_IRQHandler)                     /* xxx Interrupt 78 */
+    HOSTSIM_VECTOR(Reserved79_IRQHandler)                     /* xxx Interrupt 79 */
+    HOSTSIM_VECTOR(Reserved80_IRQHandler)                     /* xxx Interrupt 80 */
+    HOSTSIM_VECTOR(Reserved81_IRQHandler)                     /* xxx Interrupt 81 */
+    HOSTSIM_VECTOR(Reserved82_IRQHandler)                     /* xxx Interrupt 82 */
+    HOSTSIM_VECTOR(Reserved83_IRQHandler)                     /* xxx Interrupt 83 */
+    HOSTSIM_VECTOR(Reserved84_IRQHandler)                     /* xxx Interrupt 84 */
+    HOSTSIM_VECTOR(Reserved85_IRQHandler)                     /* xxx Interrupt 85 */
+    HOSTSIM_VECTOR(Reserved86_IRQHandler)                     /* xxx Interrupt 86 */
+    HOSTSIM_VECTOR(Reserved87_IRQHandler)                     /* xxx Interrupt 87 */
+    HOSTSIM_VECTOR(Reserved88_IRQHandler)                     /* xxx Interrupt 88 */
+    HOSTSIM_VECTOR(Reserved89_IRQHandler)                     /* xxx Interrupt 89 */
+    HOSTSIM_VECTOR(Reserved90_IRQHandler)                     /* xxx Interrupt 90 */
+    HOSTSIM_VECTOR(Reserved91_IRQHandler)                     /* xxx Interrupt 91 */
+    HOSTSIM_VECTOR(Reserved92_IRQHandler)                     /* xxx Interrupt 92 */
+    HOSTSIM_VECTOR(Reserved93_IRQHandler)                     /* xxx Interrupt 93 */
+    HOSTSIM_VECTOR(Reserved94_IRQHandler)                     /* xxx Interrupt 94 */
+    HOSTSIM_VECTOR(Reserved95_IRQHandler)                     /* xxx Interrupt 95 */
+    HOSTSIM_VECTOR(Reserved96_IRQHandler)                     /* xxx Interrupt 96 */
+    HOSTSIM_VECTOR(Reserved97_IRQHandler)                     /* xxx Interrupt 97 */
+    HOSTSIM_VECTOR(Reserved98_IRQHandler)                     /* xxx Interrupt 98 */
+    HOSTSIM_VECTOR(A53_NEXTERRIRQ_IRQHandler)                 /* Shared Int Source nEXTERRIRQ from A53 Sub-System */
+    HOSTSIM_VECTOR(A53_NINTERRIRQ_IRQHandler)                 /* Shared Int Source nINTERRIRQ from A53 Sub-System */
+    HOSTSIM_VECTOR(A72_NEXTERRIRQ_IRQHandler)                 /* Shared Int Source nEXTERRIRQ from A72 Sub-System */
+    HOSTSIM_VECTOR(A72_NINTERRIRQ_IRQHandler)                 /* Shared Int Source nINTERRIRQ from A72 Sub-System */
+    HOSTSIM_VECTOR(VPU_NEXTERRIRQ_IRQHandler)                 /* Shared Int Source nEXTERRIRQ from VPU Sub-System */
+    HOSTSIM_VECTOR(Reserved104_IRQHandler)                    /* xxx Interrupt 104 */
+    HOSTSIM_VECTOR(Reserved105_IRQHandler)                    /* xxx Interrupt 105 */
+    HOSTSIM_VECTOR(Reserved106_IRQHandler)                    /* xxx Interrupt 106 */
+    HOSTSIM_VECTOR(CCI_NERRORIRQ_IRQHandler)                  /* Shared Int Source nERRORIRQ from CCI Sub-System */
+    HOSTSIM_VECTOR(CCI_NEVNTCNTOVERFLOW0_IRQHandler)          /* Shared Int Source nEVNTCNTOVERFLOW[0] from CCI Sub-System */
+    HOSTSIM_VECTOR(CCI_NEVNTCNTOVERFLOW1_IRQHandler)          /* Shared Int Source nEVNTCNTOVERFLOW[1] from CCI Sub-System */
+    HOSTSIM_VECTOR(CCI_NEVNTCNTOVERFLOW2_IRQHandler)          /* Shared Int Source nEVNTCNTOVERFLOW[2] from CCI Sub-System */
+    HOSTSIM_VECTOR(CCI_NEVNTCNTOVERFLOW3_IRQHandler)          /* Shared Int Source nEVNTCNTOVERFLOW[3] from CCI Sub-System */
+    HOSTSIM_VECTOR(CCI_NEVNTCNTOVERFLOW4_IRQHandler)          /* Shared Int Source nEVNTCNTOVERFLOW[4] from CCI Sub-System */
+    HOSTSIM_VECTOR(Reserved113_IRQHandler)                    /* xxx Interrupt 113 */
+    HOSTSIM_VECTOR(Reserved114_IRQHandler)                    /* xxx Interrupt 114 */
+    HOSTSIM_VECTOR(M4_0_INT_OUT0_IRQHandler)                  /* Shared Int Source INT_OUT[0] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT1_IRQHandler)                  /* Shared Int Source INT_OUT[1] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT2_IRQHandler)                  /* Shared Int Source INT_OUT[2] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT3_IRQHandler)                  /* Shared Int Source INT_OUT[3] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT4_IRQHandler)                  /* Shared Int Source INT_OUT[4] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT5_IRQHandler)                  /* Shared Int Source INT_OUT[5] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT6_IRQHandler)                  /* Shared Int Source INT_OUT[6] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_0_INT_OUT7_IRQHandler)                  /* Shared Int Source INT_OUT[7] from M4_0 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT0_IRQHandler)                  /* Shared Int Source INT_OUT[0] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT1_IRQHandler)                  /* Shared Int Source INT_OUT[1] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT2_IRQHandler)                  /* Shared Int Source INT_OUT[2] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT3_IRQHandler)                  /* Shared Int Source INT_OUT[3] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT4_IRQHandler)                  /* Shared Int Source INT_OUT[4] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT5_IRQHandler)                  /* Shared Int Source INT_OUT[5] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT6_IRQHandler)                  /* Shared Int Source INT_OUT[6] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(M4_1_INT_OUT7_IRQHandler)                  /* Shared Int Source INT_OUT[7] from M4_1 Sub-System */
+    HOSTSIM_VECTOR(DBLOG_COMB_IRPT_NS_IRQHandler)             /* Shared Int Source comb_irpt_ns from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_COMB_IRPT_S_IRQHandler)              /* Shared Int Source comb_irpt_s from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_GBL_FLT_IRPT_NS_IRQHandler)          /* Shared Int Source gbl_flt_irpt_ns from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_GBL_FLT_IRPT_S_IRQHandler)           /* Shared Int Source gbl_flt_irpt_s from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_PERF_IRPT_IMX8_0_IRQHandler)         /* Shared Int Source perf_irpt_imx8_0 from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_PERF_IRPT_IMX8_1_IRQHandler)         /* Shared Int Source perf_irpt_imx8_1 from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_PERF_IRPT_IMX8_2_IRQHandler)         /* Shared Int Source perf_irpt_imx8_2 from DBLog Sub-System */
+    HOSTSIM_VECTOR(DBLOG_PERF_IRPT_IMX8_3_IRQHandler)         /* Shared Int Source perf_irpt_imx8_3 from DBLog Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT0_IRQHandler)              /* Shared Int Source INT_OUT[0] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT1_IRQHandler)              /* Shared Int Source INT_OUT[1] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT2_IRQHandler)              /* Shared Int Source INT_OUT[2] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT3_IRQHandler)              /* Shared Int Source INT_OUT[3] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT4_IRQHandler)              /* Shared Int Source INT_OUT[4] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT5_IRQHandler)              /* Shared Int Source INT_OUT[5] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT6_IRQHandler)              /* Shared Int Source INT_OUT[6] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT7_IRQHandler)              /* Shared Int Source INT_OUT[7] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_RESERVED_IRQHandler)              /* Shared Int Source Reserved from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT9_IRQHandler)              /* Shared Int Source INT_OUT[9] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT10_IRQHandler)             /* Shared Int Source INT_OUT[10] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT11_IRQHandler)             /* Shared Int Source INT_OUT[11] from Display0 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY0_INT_OUT12_IRQHandler)             /* Shared Int Source INT_OUT[12] from Display0 Sub-System */
+    HOSTSIM_VECTOR(Reserved152_IRQHandler)                    /* xxx Interrupt 152 */
+    HOSTSIM_VECTOR(Reserved153_IRQHandler)                    /* xxx Interrupt 153 */
+    HOSTSIM_VECTOR(Reserved154_IRQHandler)                    /* xxx Interrupt 154 */
+    HOSTSIM_VECTOR(Reserved155_IRQHandler)                    /* xxx Interrupt 155 */
+    HOSTSIM_VECTOR(LVDS0_INT_OUT_IRQHandler)                  /* Shared Int Source INT_OUT from LVDS0 Sub-System */
+    HOSTSIM_VECTOR(LVDS1_INT_OUT_IRQHandler)                  /* Shared Int Source INT_OUT from LVDS1 Sub-System */
+    HOSTSIM_VECTOR(MIPI_DSI0_INT_OUT_IRQHandler)              /* Shared Int Source INT_OUT from MIPI_DSI0 Sub-System */
+    HOSTSIM_VECTOR(MIPI_DSI1_INT_OUT_IRQHandler)              /* Shared Int Source INT_OUT from MIPI_DSI1 Sub-System */
+    HOSTSIM_VECTOR(HDMI_TX_INT_OUT_IRQHandler)                /* Shared Int Source INT_OUT from HDMI_TX Sub-System */
+    HOSTSIM_VECTOR(Reserved161_IRQHandler)                    /* xxx Interrupt 161 */
+    HOSTSIM_VECTOR(Reserved162_IRQHandler)                    /* xxx Interrupt 162 */
+    HOSTSIM_VECTOR(GPU0_XAQ2_INTR_IRQHandler)                 /* Shared Int Source xaq2_intr from GPU0 Sub-System */
+    HOSTSIM_VECTOR(GPU1_XAQ2_INTR_IRQHandler)                 /* Shared Int Source xaq2_intr from GPU1 Sub-System */
+    HOSTSIM_VECTOR(DMA_EDMA0_INT_IRQHandler)                  /* Shared Int Source eDMA0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EDMA0_ERR_INT_IRQHandler)              /* Shared Int Source eDMA0_ERR_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EDMA1_INT_IRQHandler)                  /* Shared Int Source eDMA1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EDMA1_ERR_INT_IRQHandler)              /* Shared Int Source eDMA1_ERR_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_MSI_CTRL_INT_IRQHandler)        /* Shared Int Source PCIeA_MSI_CTRL_INT from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_CLK_REQ_INT_IRQHandler)         /* Shared Int Source PCIeA_CLK_REQ_INT from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_DMA_INT_IRQHandler)             /* Shared Int Source PCIeA_DMA_INT from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_INT_D_IRQHandler)               /* Shared Int Source PCIeA_INT_D from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_INT_C_IRQHandler)               /* Shared Int Source PCIeA_INT_C from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_INT_B_IRQHandler)               /* Shared Int Source PCIeA_INT_B from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_INT_A_IRQHandler)               /* Shared Int Source PCIeA_INT_A from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_SMLH_REQ_RST_IRQHandler)        /* Shared Int Source PCIeA_SMLH_REQ_RST from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_GPIO_WAKEUP0_IRQHandler)        /* Shared Int Source PCIeA_GPIO_WAKEUP[0] from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEA_GPIO_WAKEUP1_IRQHandler)        /* Shared Int Source PCIeA_GPIO_WAKEUP[1] from HSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPT0_INT_IRQHandler)                  /* Shared Int Source GPT0_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPT1_INT_IRQHandler)                  /* Shared Int Source GPT1_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPT2_INT_IRQHandler)                  /* Shared Int Source GPT2_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPT3_INT_IRQHandler)                  /* Shared Int Source GPT3_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPT4_INT_IRQHandler)                  /* Shared Int Source GPT4_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_KPP_INT_IRQHandler)                   /* Shared Int Source KPP_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(Reserved185_IRQHandler)                    /* xxx Interrupt 185 */
+    HOSTSIM_VECTOR(Reserved186_IRQHandler)                    /* xxx Interrupt 186 */
+    HOSTSIM_VECTOR(HSIO_SATA_INT0_IRQHandler)                 /* Shared Int Source SATA_INT[0] from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_SATA_INT2_IRQHandler)                 /* Shared Int Source SATA_INT[2] from HSIO Sub-System */
+    HOSTSIM_VECTOR(Reserved189_IRQHandler)                    /* xxx Interrupt 189 */
+    HOSTSIM_VECTOR(Reserved190_IRQHandler)                    /* xxx Interrupt 190 */
+    HOSTSIM_VECTOR(LSIO_OCTASPI0_INT_IRQHandler)              /* Shared Int Source OctaSPI0_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_OCTASPI1_INT_IRQHandler)              /* Shared Int Source OctaSPI1_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM0_INT_IRQHandler)                  /* Shared Int Source PWM0_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM1_INT_IRQHandler)                  /* Shared Int Source PWM1_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM2_INT_IRQHandler)                  /* Shared Int Source PWM2_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM3_INT_IRQHandler)                  /* Shared Int Source PWM3_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM4_INT_IRQHandler)                  /* Shared Int Source PWM4_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM5_INT_IRQHandler)                  /* Shared Int Source PWM5_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM6_INT_IRQHandler)                  /* Shared Int Source PWM6_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_PWM7_INT_IRQHandler)                  /* Shared Int Source PWM7_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_MSI_CTRL_INT_IRQHandler)        /* Shared Int Source PCIeB_MSI_CTRL_INT from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_CLK_REQ_INT_IRQHandler)         /* Shared Int Source PCIeB_CLK_REQ_INT from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_DMA_INT_IRQHandler)             /* Shared Int Source PCIeB_DMA_INT from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_INT_D_IRQHandler)               /* Shared Int Source PCIeB_INT_D from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_INT_C_IRQHandler)               /* Shared Int Source PCIeB_INT_C from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_INT_B_IRQHandler)               /* Shared Int Source PCIeB_INT_B from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_INT_A_IRQHandler)               /* Shared Int Source PCIeB_INT_A from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_SMLH_REQ_RST_IRQHandler)        /* Shared Int Source PCIeB_SMLH_REQ_RST from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_GPIO_WAKEUP0_IRQHandler)        /* Shared Int Source PCIeB_GPIO_WAKEUP[0] from HSIO Sub-System */
+    HOSTSIM_VECTOR(HSIO_PCIEB_GPIO_WAKEUP1_IRQHandler)        /* Shared Int Source PCIeB_GPIO_WAKEUP[1] from HSIO Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT0_IRQHandler)                   /* Shared Int Source INT_OUT[0] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT1_IRQHandler)                   /* Shared Int Source INT_OUT[1] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT2_IRQHandler)                   /* Shared Int Source INT_OUT[2] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT3_IRQHandler)                   /* Shared Int Source INT_OUT[3] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT4_IRQHandler)                   /* Shared Int Source INT_OUT[4] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT5_IRQHandler)                   /* Shared Int Source INT_OUT[5] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT6_IRQHandler)                   /* Shared Int Source INT_OUT[6] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_INT_OUT7_IRQHandler)                   /* Shared Int Source INT_OUT[7] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_SYS_COUNT_INT0_IRQHandler)             /* Shared Int Source SYS_COUNT_INT[0] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_SYS_COUNT_INT1_IRQHandler)             /* Shared Int Source SYS_COUNT_INT[1] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_SYS_COUNT_INT2_IRQHandler)             /* Shared Int Source SYS_COUNT_INT[2] from SCU Sub-System */
+    HOSTSIM_VECTOR(SCU_SYS_COUNT_INT3_IRQHandler)             /* Shared Int Source SYS_COUNT_INT[3] from SCU Sub-System */
+    HOSTSIM_VECTOR(Reserved223_IRQHandler)                    /* xxx Interrupt 223 */
+    HOSTSIM_VECTOR(Reserved224_IRQHandler)                    /* xxx Interrupt 224 */
+    HOSTSIM_VECTOR(Reserved225_IRQHandler)                    /* xxx Interrupt 225 */
+    HOSTSIM_VECTOR(Reserved226_IRQHandler)                    /* xxx Interrupt 226 */
+    HOSTSIM_VECTOR(DRC0_DFI_ALERT_ERR_IRQHandler)             /* Shared Int Source DFI_ALERT_ERR from DRC0 Sub-System */
+    HOSTSIM_VECTOR(DRC1_DFI_ALERT_ERR_IRQHandler)             /* Shared Int Source DFI_ALERT_ERR from DRC1 Sub-System */
+    HOSTSIM_VECTOR(DRC0_PERF_CNT_FULL_IRQHandler)             /* Shared Int Source PERF_CNT_FULL from DRC0 Sub-System */
+    HOSTSIM_VECTOR(DRC1_PERF_CNT_FULL_IRQHandler)             /* Shared Int Source PERF_CNT_FULL from DRC1 Sub-System */
+    HOSTSIM_VECTOR(Reserved231_IRQHandler)                    /* xxx Interrupt 231 */
+    HOSTSIM_VECTOR(Reserved232_IRQHandler)                    /* xxx Interrupt 232 */
+    HOSTSIM_VECTOR(Reserved233_IRQHandler)                    /* xxx Interrupt 233 */
+    HOSTSIM_VECTOR(Reserved234_IRQHandler)                    /* xxx Interrupt 234 */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT0_IRQHandler)                 /* Shared Int Source GPIO_INT[0] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT1_IRQHandler)                 /* Shared Int Source GPIO_INT[1] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT2_IRQHandler)                 /* Shared Int Source GPIO_INT[2] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT3_IRQHandler)                 /* Shared Int Source GPIO_INT[3] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT4_IRQHandler)                 /* Shared Int Source GPIO_INT[4] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT5_IRQHandler)                 /* Shared Int Source GPIO_INT[5] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT6_IRQHandler)                 /* Shared Int Source GPIO_INT[6] from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_GPIO_INT7_IRQHandler)                 /* Shared Int Source GPIO_INT[7] from LSIO Sub-System */
+    HOSTSIM_VECTOR(Reserved243_IRQHandler)                    /* xxx Interrupt 243 */
+    HOSTSIM_VECTOR(Reserved244_IRQHandler)                    /* xxx Interrupt 244 */
+    HOSTSIM_VECTOR(Reserved245_IRQHandler)                    /* xxx Interrupt 245 */
+    HOSTSIM_VECTOR(Reserved246_IRQHandler)                    /* xxx Interrupt 246 */
+    HOSTSIM_VECTOR(Reserved247_IRQHandler)                    /* xxx Interrupt 247 */
+    HOSTSIM_VECTOR(Reserved248_IRQHandler)                    /* xxx Interrupt 248 */
+    HOSTSIM_VECTOR(Reserved249_IRQHandler)                    /* xxx Interrupt 249 */
+    HOSTSIM_VECTOR(Reserved250_IRQHandler)                    /* xxx Interrupt 250 */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT0_IRQHandler)              /* Shared Int Source INT_OUT[0] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT1_IRQHandler)              /* Shared Int Source INT_OUT[1] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT2_IRQHandler)              /* Shared Int Source INT_OUT[2] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT3_IRQHandler)              /* Shared Int Source INT_OUT[3] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT4_IRQHandler)              /* Shared Int Source INT_OUT[4] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT5_IRQHandler)              /* Shared Int Source INT_OUT[5] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT6_IRQHandler)              /* Shared Int Source INT_OUT[6] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT7_IRQHandler)              /* Shared Int Source INT_OUT[7] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_RESERVED_IRQHandler)              /* Shared Int Source Reserved from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT9_IRQHandler)              /* Shared Int Source INT_OUT[9] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT10_IRQHandler)             /* Shared Int Source INT_OUT[10] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT11_IRQHandler)             /* Shared Int Source INT_OUT[11] from Display1 Sub-System */
+    HOSTSIM_VECTOR(DISPLAY1_INT_OUT12_IRQHandler)             /* Shared Int Source INT_OUT[12] from Display1 Sub-System */
+    HOSTSIM_VECTOR(Reserved264_IRQHandler)                    /* xxx Interrupt 264 */
+    HOSTSIM_VECTOR(Reserved265_IRQHandler)                    /* xxx Interrupt 265 */
+    HOSTSIM_VECTOR(Reserved266_IRQHandler)                    /* xxx Interrupt 266 */
+    HOSTSIM_VECTOR(VPU_SYS_INT0_IRQHandler)                   /* Shared Int Source SYS_INT[0] from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_SYS_INT1_IRQHandler)                   /* Shared Int Source SYS_INT[1] from VPU Sub-System */
+    HOSTSIM_VECTOR(Reserved269_IRQHandler)                    /* xxx Interrupt 269 */
+    HOSTSIM_VECTOR(Reserved270_IRQHandler)                    /* xxx Interrupt 270 */
+    HOSTSIM_VECTOR(Reserved271_IRQHandler)                    /* xxx Interrupt 271 */
+    HOSTSIM_VECTOR(Reserved272_IRQHandler)                    /* xxx Interrupt 272 */
+    HOSTSIM_VECTOR(Reserved273_IRQHandler)                    /* xxx Interrupt 273 */
+    HOSTSIM_VECTOR(Reserved274_IRQHandler)                    /* xxx Interrupt 274 */
+    HOSTSIM_VECTOR(LSIO_MU0_INT_IRQHandler)                   /* Shared Int Source MU0_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU1_INT_IRQHandler)                   /* Shared Int Source MU1_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU2_INT_IRQHandler)                   /* Shared Int Source MU2_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU3_INT_IRQHandler)                   /* Shared Int Source MU3_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU4_INT_IRQHandler)                   /* Shared Int Source MU4_INT from LSIO Sub-System */
+    HOSTSIM_VECTOR(Reserved280_IRQHandler)                    /* xxx Interrupt 280 */
+    HOSTSIM_VECTOR(Reserved281_IRQHandler)                    /* xxx Interrupt 281 */
+    HOSTSIM_VECTOR(Reserved282_IRQHandler)                    /* xxx Interrupt 282 */
+    HOSTSIM_VECTOR(LSIO_MU5_INT_A_IRQHandler)                 /* Shared Int Source MU5_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU6_INT_A_IRQHandler)                 /* Shared Int Source MU6_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU7_INT_A_IRQHandler)                 /* Shared Int Source MU7_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU8_INT_A_IRQHandler)                 /* Shared Int Source MU8_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU9_INT_A_IRQHandler)                 /* Shared Int Source MU9_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU10_INT_A_IRQHandler)                /* Shared Int Source MU10_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU11_INT_A_IRQHandler)                /* Shared Int Source MU11_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU12_INT_A_IRQHandler)                /* Shared Int Source MU12_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU13_INT_A_IRQHandler)                /* Shared Int Source MU13_INT_A from LSIO Sub-System */
+    HOSTSIM_VECTOR(Reserved292_IRQHandler)                    /* xxx Interrupt 292 */
+    HOSTSIM_VECTOR(Reserved293_IRQHandler)                    /* xxx Interrupt 293 */
+    HOSTSIM_VECTOR(Reserved294_IRQHandler)                    /* xxx Interrupt 294 */
+    HOSTSIM_VECTOR(Reserved295_IRQHandler)                    /* xxx Interrupt 295 */
+    HOSTSIM_VECTOR(Reserved296_IRQHandler)                    /* xxx Interrupt 296 */
+    HOSTSIM_VECTOR(Reserved297_IRQHandler)                    /* xxx Interrupt 297 */
+    HOSTSIM_VECTOR(Reserved298_IRQHandler)                    /* xxx Interrupt 298 */
+    HOSTSIM_VECTOR(LSIO_MU5_INT_B_IRQHandler)                 /* Shared Int Source MU5_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU6_INT_B_IRQHandler)                 /* Shared Int Source MU6_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU7_INT_B_IRQHandler)                 /* Shared Int Source MU7_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU8_INT_B_IRQHandler)                 /* Shared Int Source MU8_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU9_INT_B_IRQHandler)                 /* Shared Int Source MU9_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU10_INT_B_IRQHandler)                /* Shared Int Source MU10_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU11_INT_B_IRQHandler)                /* Shared Int Source MU11_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU12_INT_B_IRQHandler)                /* Shared Int Source MU12_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(LSIO_MU13_INT_B_IRQHandler)                /* Shared Int Source MU13_INT_B from LSIO Sub-System */
+    HOSTSIM_VECTOR(Reserved308_IRQHandler)                    /* xxx Interrupt 308 */
+    HOSTSIM_VECTOR(Reserved309_IRQHandler)                    /* xxx Interrupt 309 */
+    HOSTSIM_VECTOR(Reserved310_IRQHandler)                    /* xxx Interrupt 310 */
+    HOSTSIM_VECTOR(Reserved311_IRQHandler)                    /* xxx Interrupt 311 */
+    HOSTSIM_VECTOR(Reserved312_IRQHandler)                    /* xxx Interrupt 312 */
+    HOSTSIM_VECTOR(Reserved313_IRQHandler)                    /* xxx Interrupt 313 */
+    HOSTSIM_VECTOR(Reserved314_IRQHandler)                    /* xxx Interrupt 314 */
+    HOSTSIM_VECTOR(DMA_SPI0_INT_IRQHandler)                   /* Shared Int Source SPI0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI1_INT_IRQHandler)                   /* Shared Int Source SPI1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI2_INT_IRQHandler)                   /* Shared Int Source SPI2_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI3_INT_IRQHandler)                   /* Shared Int Source SPI3_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C0_INT_IRQHandler)                   /* Shared Int Source I2C0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C1_INT_IRQHandler)                   /* Shared Int Source I2C1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C2_INT_IRQHandler)                   /* Shared Int Source I2C2_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C3_INT_IRQHandler)                   /* Shared Int Source I2C3_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C4_INT_IRQHandler)                   /* Shared Int Source I2C4_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART0_INT_IRQHandler)                  /* Shared Int Source UART0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART1_INT_IRQHandler)                  /* Shared Int Source UART1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART2_INT_IRQHandler)                  /* Shared Int Source UART2_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART3_INT_IRQHandler)                  /* Shared Int Source UART3_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART4_INT_IRQHandler)                  /* Shared Int Source UART4_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM0_INT_IRQHandler)                   /* Shared Int Source SIM0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM1_INT_IRQHandler)                   /* Shared Int Source SIM1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_USDHC0_INT_IRQHandler)        /* Shared Int Source uSDHC0_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_USDHC1_INT_IRQHandler)        /* Shared Int Source uSDHC1_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_USDHC2_INT_IRQHandler)        /* Shared Int Source uSDHC2_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN0_INT_IRQHandler)               /* Shared Int Source FlexCAN0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN1_INT_IRQHandler)               /* Shared Int Source FlexCAN1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN2_INT_IRQHandler)               /* Shared Int Source FlexCAN2_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FTM0_INT_IRQHandler)                   /* Shared Int Source FTM0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FTM1_INT_IRQHandler)                   /* Shared Int Source FTM1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_ADC0_INT_IRQHandler)                   /* Shared Int Source ADC0_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_ADC1_INT_IRQHandler)                   /* Shared Int Source ADC1_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EXTERNAL_DMA_INT_0_IRQHandler)         /* Shared Int Source EXTERNAL_DMA_INT_0 from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EXTERNAL_DMA_INT_1_IRQHandler)         /* Shared Int Source EXTERNAL_DMA_INT_1 from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EXTERNAL_DMA_INT_2_IRQHandler)         /* Shared Int Source EXTERNAL_DMA_INT_2 from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EXTERNAL_DMA_INT_3_IRQHandler)         /* Shared Int Source EXTERNAL_DMA_INT_3 from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EXTERNAL_DMA_INT_4_IRQHandler)         /* Shared Int Source EXTERNAL_DMA_INT_4 from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_EXTERNAL_DMA_INT_5_IRQHandler)         /* Shared Int Source EXTERNAL_DMA_INT_5 from DMA Sub-System */
+    HOSTSIM_VECTOR(Reserved347_IRQHandler)                    /* xxx Interrupt 347 */
+    HOSTSIM_VECTOR(Reserved348_IRQHandler)                    /* xxx Interrupt 348 */
+    HOSTSIM_VECTOR(Reserved349_IRQHandler)                    /* xxx Interrupt 349 */
+    HOSTSIM_VECTOR(Reserved350_IRQHandler)                    /* xxx Interrupt 350 */
+    HOSTSIM_VECTOR(Reserved351_IRQHandler)                    /* xxx Interrupt 351 */
+    HOSTSIM_VECTOR(Reserved352_IRQHandler)                    /* xxx Interrupt 352 */
+    HOSTSIM_VECTOR(Reserved353_IRQHandler)                    /* xxx Interrupt 353 */
+    HOSTSIM_VECTOR(Reserved354_IRQHandler)                    /* xxx Interrupt 354 */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET0_FRAME1_INT_IRQHandler)  /* Shared Int Source ENET0_FRAME1_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET0_FRAME2_INT_IRQHandler)  /* Shared Int Source ENET0_FRAME2_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET0_FRAME0_EVENT_INT_IRQHandler)/* Shared Int Source ENET0_FRAME0_EVENT_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET0_TIMER_INT_IRQHandler)   /* Shared Int Source ENET0_TIMER_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET1_FRAME1_INT_IRQHandler)  /* Shared Int Source ENET1_FRAME1_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET1_FRAME2_INT_IRQHandler)  /* Shared Int Source ENET1_FRAME2_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET1_FRAME0_EVENT_INT_IRQHandler)/* Shared Int Source ENET1_FRAME0_EVENT_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ENET1_TIMER_INT_IRQHandler)   /* Shared Int Source ENET1_TIMER_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_DTCP_INT_IRQHandler)          /* Shared Int Source DTCP_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_MLB_INT_IRQHandler)           /* Shared Int Source MLB_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_MLB_AHB_INT_IRQHandler)       /* Shared Int Source MLB_AHB_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_USB_OTG_INT_IRQHandler)       /* Shared Int Source USB_OTG_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_USB_HOST_INT_IRQHandler)      /* Shared Int Source USB_HOST_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_UTMI_INT_IRQHandler)          /* Shared Int Source UTMI_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_WAKEUP_INT_IRQHandler)        /* Shared Int Source WAKEUP_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_USB3_INT_IRQHandler)          /* Shared Int Source USB3_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ND_FLASH_BCH_INT_IRQHandler)  /* Shared Int Source ND_FLASH_BCH_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_ND_FLASH_GPMI_INT_IRQHandler) /* Shared Int Source ND_FLASH_GPMI_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_APBHDMA_IRQHandler)           /* Shared Int Source APBHDMA from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_DMA_INT_IRQHandler)           /* Shared Int Source DMA_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(CONNECTIVITY_DMA_ERR_INT_IRQHandler)       /* Shared Int Source DMA_ERR_INT from Connectivity Sub-System */
+    HOSTSIM_VECTOR(Reserved376_IRQHandler)                    /* xxx Interrupt 376 */
+    HOSTSIM_VECTOR(Reserved377_IRQHandler)                    /* xxx Interrupt 377 */
+    HOSTSIM_VECTOR(Reserved378_IRQHandler)                    /* xxx Interrupt 378 */
+    HOSTSIM_VECTOR(Reserved379_IRQHandler)                    /* xxx Interrupt 379 */
+    HOSTSIM_VECTOR(Reserved380_IRQHandler)                    /* xxx Interrupt 380 */
+    HOSTSIM_VECTOR(Reserved381_IRQHandler)                    /* xxx Interrupt 381 */
+    HOSTSIM_VECTOR(Reserved382_IRQHandler)                    /* xxx Interrupt 382 */
+    HOSTSIM_VECTOR(Reserved383_IRQHandler)                    /* xxx Interrupt 383 */
+    HOSTSIM_VECTOR(Reserved384_IRQHandler)                    /* xxx Interrupt 384 */
+    HOSTSIM_VECTOR(Reserved385_IRQHandler)                    /* xxx Interrupt 385 */
+    HOSTSIM_VECTOR(Reserved386_IRQHandler)                    /* xxx Interrupt 386 */
+    HOSTSIM_VECTOR(IMAGING_MSI_INT_IRQHandler)                /* Shared Int Source MSI_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(Reserved388_IRQHandler)                    /* xxx Interrupt 388 */
+    HOSTSIM_VECTOR(Reserved389_IRQHandler)                    /* xxx Interrupt 389 */
+    HOSTSIM_VECTOR(Reserved390_IRQHandler)                    /* xxx Interrupt 390 */
+    HOSTSIM_VECTOR(Reserved391_IRQHandler)                    /* xxx Interrupt 391 */
+    HOSTSIM_VECTOR(Reserved392_IRQHandler)                    /* xxx Interrupt 392 */
+    HOSTSIM_VECTOR(Reserved393_IRQHandler)                    /* xxx Interrupt 393 */
+    HOSTSIM_VECTOR(Reserved394_IRQHandler)                    /* xxx Interrupt 394 */
+    HOSTSIM_VECTOR(Reserved395_IRQHandler)                    /* xxx Interrupt 395 */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM0_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM0_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM1_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM1_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM2_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM2_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM3_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM3_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM4_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM4_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM5_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM5_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM6_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM6_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_PDMA_STREAM7_INT_IRQHandler)       /* Shared Int Source PDMA_STREAM7_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_ENC0_INT_IRQHandler)         /* Shared Int Source MJPEG_ENC0_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_ENC1_INT_IRQHandler)         /* Shared Int Source MJPEG_ENC1_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_ENC2_INT_IRQHandler)         /* Shared Int Source MJPEG_ENC2_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_ENC3_INT_IRQHandler)         /* Shared Int Source MJPEG_ENC3_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_DEC0_INT_IRQHandler)         /* Shared Int Source MJPEG_DEC0_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_DEC1_INT_IRQHandler)         /* Shared Int Source MJPEG_DEC1_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_DEC2_INT_IRQHandler)         /* Shared Int Source MJPEG_DEC2_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(IMAGING_MJPEG_DEC3_INT_IRQHandler)         /* Shared Int Source MJPEG_DEC3_INT from Imaging Sub-System */
+    HOSTSIM_VECTOR(Reserved412_IRQHandler)                    /* xxx Interrupt 412 */
+    HOSTSIM_VECTOR(AUDIO_SAI0_MOD_INT_IRQHandler)             /* Shared Int Source SAI0_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI0_DMA_INT_IRQHandler)             /* Shared Int Source SAI0_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI1_MOD_INT_IRQHandler)             /* Shared Int Source SAI1_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI1_DMA_INT_IRQHandler)             /* Shared Int Source SAI1_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI2_MOD_INT_IRQHandler)             /* Shared Int Source SAI2_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI2_DMA_INT_IRQHandler)             /* Shared Int Source SAI2_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(MIPI_CSI0_OUT_INT_IRQHandler)              /* Shared Int Source OUT_INT from MIPI_CSI0 Sub-System */
+    HOSTSIM_VECTOR(MIPI_CSI1_OUT_INT_IRQHandler)              /* Shared Int Source OUT_INT from MIPI_CSI1 Sub-System */
+    HOSTSIM_VECTOR(HDMI_RX_OUT_INT_IRQHandler)                /* Shared Int Source OUT_INT from HDMI_RX Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI3_MOD_INT_IRQHandler)             /* Shared Int Source SAI3_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI3_DMA_INT_IRQHandler)             /* Shared Int Source SAI3_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI_HDMI_RX_MOD_INT_IRQHandler)      /* Shared Int Source SAI_HDMI_RX_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI_HDMI_RX_DMA_INT_IRQHandler)      /* Shared Int Source SAI_HDMI_RX_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI_HDMI_TX_MOD_INT_IRQHandler)      /* Shared Int Source SAI_HDMI_TX_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI_HDMI_TX_DMA_INT_IRQHandler)      /* Shared Int Source SAI_HDMI_TX_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI6_MOD_INT_IRQHandler)             /* Shared Int Source SAI6_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI6_DMA_INT_IRQHandler)             /* Shared Int Source SAI6_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI7_MOD_INT_IRQHandler)             /* Shared Int Source SAI7_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI7_DMA_INT_IRQHandler)             /* Shared Int Source SAI7_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(Reserved432_IRQHandler)                    /* xxx Interrupt 432 */
+    HOSTSIM_VECTOR(Reserved433_IRQHandler)                    /* xxx Interrupt 433 */
+    HOSTSIM_VECTOR(Reserved434_IRQHandler)                    /* xxx Interrupt 434 */
+    HOSTSIM_VECTOR(DMA_SPI0_MOD_INT_IRQHandler)               /* Shared Int Source SPI0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI1_MOD_INT_IRQHandler)               /* Shared Int Source SPI1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI2_MOD_INT_IRQHandler)               /* Shared Int Source SPI2_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI3_MOD_INT_IRQHandler)               /* Shared Int Source SPI3_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C0_MOD_INT_IRQHandler)               /* Shared Int Source I2C0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C1_MOD_INT_IRQHandler)               /* Shared Int Source I2C1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C2_MOD_INT_IRQHandler)               /* Shared Int Source I2C2_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C3_MOD_INT_IRQHandler)               /* Shared Int Source I2C3_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C4_MOD_INT_IRQHandler)               /* Shared Int Source I2C4_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART0_MOD_INT_IRQHandler)              /* Shared Int Source UART0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART1_MOD_INT_IRQHandler)              /* Shared Int Source UART1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART2_MOD_INT_IRQHandler)              /* Shared Int Source UART2_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART3_MOD_INT_IRQHandler)              /* Shared Int Source UART3_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART4_MOD_INT_IRQHandler)              /* Shared Int Source UART4_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM0_MOD_INT_IRQHandler)               /* Shared Int Source SIM0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM1_MOD_INT_IRQHandler)               /* Shared Int Source SIM1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN0_MOD_INT_IRQHandler)           /* Shared Int Source FLEXCAN0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN1_MOD_INT_IRQHandler)           /* Shared Int Source FLEXCAN1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN2_MOD_INT_IRQHandler)           /* Shared Int Source FLEXCAN2_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FTM0_MOD_INT_IRQHandler)               /* Shared Int Source FTM0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FTM1_MOD_INT_IRQHandler)               /* Shared Int Source FTM1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_ADC0_MOD_INT_IRQHandler)               /* Shared Int Source ADC0_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_ADC1_MOD_INT_IRQHandler)               /* Shared Int Source ADC1_MOD_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN0_DMA_INT_IRQHandler)           /* Shared Int Source FLEXCAN0_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN1_DMA_INT_IRQHandler)           /* Shared Int Source FLEXCAN1_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FLEXCAN2_DMA_INT_IRQHandler)           /* Shared Int Source FLEXCAN2_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FTM0_DMA_INT_IRQHandler)               /* Shared Int Source FTM0_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_FTM1_DMA_INT_IRQHandler)               /* Shared Int Source FTM1_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_ADC0_DMA_INT_IRQHandler)               /* Shared Int Source ADC0_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_ADC1_DMA_INT_IRQHandler)               /* Shared Int Source ADC1_DMA_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(Reserved465_IRQHandler)                    /* xxx Interrupt 465 */
+    HOSTSIM_VECTOR(Reserved466_IRQHandler)                    /* xxx Interrupt 466 */
+    HOSTSIM_VECTOR(AUDIO_EDMA0_INT_IRQHandler)                /* Shared Int Source eDMA0_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_EDMA0_ERR_INT_IRQHandler)            /* Shared Int Source eDMA0_ERR_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_EDMA1_INT_IRQHandler)                /* Shared Int Source eDMA1_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_EDMA1_ERR_INT_IRQHandler)            /* Shared Int Source eDMA1_ERR_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ASRC0_INT1_IRQHandler)               /* Shared Int Source ASRC0_INT1 from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ASRC0_INT2_IRQHandler)               /* Shared Int Source ASRC0_INT2 from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA0_CH0_INT_IRQHandler)             /* Shared Int Source DMA0_CH0_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA0_CH1_INT_IRQHandler)             /* Shared Int Source DMA0_CH1_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA0_CH2_INT_IRQHandler)             /* Shared Int Source DMA0_CH2_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA0_CH3_INT_IRQHandler)             /* Shared Int Source DMA0_CH3_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA0_CH4_INT_IRQHandler)             /* Shared Int Source DMA0_CH4_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA0_CH5_INT_IRQHandler)             /* Shared Int Source DMA0_CH5_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ASRC1_INT1_IRQHandler)               /* Shared Int Source ASRC1_INT1 from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ASRC1_INT2_IRQHandler)               /* Shared Int Source ASRC1_INT2 from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA1_CH0_INT_IRQHandler)             /* Shared Int Source DMA1_CH0_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA1_CH1_INT_IRQHandler)             /* Shared Int Source DMA1_CH1_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA1_CH2_INT_IRQHandler)             /* Shared Int Source DMA1_CH2_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA1_CH3_INT_IRQHandler)             /* Shared Int Source DMA1_CH3_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA1_CH4_INT_IRQHandler)             /* Shared Int Source DMA1_CH4_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_DMA1_CH5_INT_IRQHandler)             /* Shared Int Source DMA1_CH5_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ESAI0_INT_IRQHandler)                /* Shared Int Source ESAI0_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ESAI1_INT_IRQHandler)                /* Shared Int Source ESAI1_INT  from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_UNUSED_IRQHandler)                   /* Shared Int Source Unused from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_GPT0_INT_IRQHandler)                 /* Shared Int Source GPT0_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_GPT1_INT_IRQHandler)                 /* Shared Int Source GPT1_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_GPT2_INT_IRQHandler)                 /* Shared Int Source GPT2_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_GPT3_INT_IRQHandler)                 /* Shared Int Source GPT3_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_GPT4_INT_IRQHandler)                 /* Shared Int Source GPT4_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_GPT5_INT_IRQHandler)                 /* Shared Int Source GPT5_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI0_INT_IRQHandler)                 /* Shared Int Source SAI0_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI1_INT_IRQHandler)                 /* Shared Int Source SAI1_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI2_INT_IRQHandler)                 /* Shared Int Source SAI2_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI3_INT_IRQHandler)                 /* Shared Int Source SAI3_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI_HDMI_RX_INT_IRQHandler)          /* Shared Int Source SAI_HDMI_RX_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI_HDMI_TX_INT_IRQHandler)          /* Shared Int Source SAI_HDMI_TX_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI6_INT_IRQHandler)                 /* Shared Int Source SAI6_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SAI7_INT_IRQHandler)                 /* Shared Int Source SAI7_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF0_RX_INT_IRQHandler)            /* Shared Int Source SPDIF0_RX_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF0_TX_INT_IRQHandler)            /* Shared Int Source SPDIF0_TX_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF1_RX_INT_IRQHandler)            /* Shared Int Source SPDIF1_RX_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF1_TX_INT_IRQHandler)            /* Shared Int Source SPDIF1_TX_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ESAI0_MOD_INT_IRQHandler)            /* Shared Int Source ESAI0_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ESAI0_DMA_INT_IRQHandler)            /* Shared Int Source ESAI0_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ESAI1_MOD_INT_IRQHandler)            /* Shared Int Source ESAI1_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_ESAI1_DMA_INT_IRQHandler)            /* Shared Int Source ESAI1_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(Reserved512_IRQHandler)                    /* xxx Interrupt 512 */
+    HOSTSIM_VECTOR(Reserved513_IRQHandler)                    /* xxx Interrupt 513 */
+    HOSTSIM_VECTOR(Reserved514_IRQHandler)                    /* xxx Interrupt 514 */
+    HOSTSIM_VECTOR(DMA_SPI0_DMA_RX_INT_IRQHandler)            /* Shared Int Source SPI0_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI0_DMA_TX_INT_IRQHandler)            /* Shared Int Source SPI0_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI1_DMA_RX_INT_IRQHandler)            /* Shared Int Source SPI1_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI1_DMA_TX_INT_IRQHandler)            /* Shared Int Source SPI1_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI2_DMA_RX_INT_IRQHandler)            /* Shared Int Source SPI2_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI2_DMA_TX_INT_IRQHandler)            /* Shared Int Source SPI2_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI3_DMA_RX_INT_IRQHandler)            /* Shared Int Source SPI3_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SPI3_DMA_TX_INT_IRQHandler)            /* Shared Int Source SPI3_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C0_DMA_RX_INT_IRQHandler)            /* Shared Int Source I2C0_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C0_DMA_TX_INT_IRQHandler)            /* Shared Int Source I2C0_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C1_DMA_RX_INT_IRQHandler)            /* Shared Int Source I2C1_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C1_DMA_TX_INT_IRQHandler)            /* Shared Int Source I2C1_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C2_DMA_RX_INT_IRQHandler)            /* Shared Int Source I2C2_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C2_DMA_TX_INT_IRQHandler)            /* Shared Int Source I2C2_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C3_DMA_RX_INT_IRQHandler)            /* Shared Int Source I2C3_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C3_DMA_TX_INT_IRQHandler)            /* Shared Int Source I2C3_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C4_DMA_RX_INT_IRQHandler)            /* Shared Int Source I2C4_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_I2C4_DMA_TX_INT_IRQHandler)            /* Shared Int Source I2C4_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART0_DMA_RX_INT_IRQHandler)           /* Shared Int Source UART0_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART0_DMA_TX_INT_IRQHandler)           /* Shared Int Source UART0_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART1_DMA_RX_INT_IRQHandler)           /* Shared Int Source UART1_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART1_DMA_TX_INT_IRQHandler)           /* Shared Int Source UART1_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART2_DMA_RX_INT_IRQHandler)           /* Shared Int Source UART2_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART2_DMA_TX_INT_IRQHandler)           /* Shared Int Source UART2_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART3_DMA_RX_INT_IRQHandler)           /* Shared Int Source UART3_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART3_DMA_TX_INT_IRQHandler)           /* Shared Int Source UART3_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART4_DMA_RX_INT_IRQHandler)           /* Shared Int Source UART4_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_UART4_DMA_TX_INT_IRQHandler)           /* Shared Int Source UART4_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM0_DMA_RX_INT_IRQHandler)            /* Shared Int Source SIM0_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM0_DMA_TX_INT_IRQHandler)            /* Shared Int Source SIM0_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM1_DMA_RX_INT_IRQHandler)            /* Shared Int Source SIM1_DMA_RX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(DMA_SIM1_DMA_TX_INT_IRQHandler)            /* Shared Int Source SIM1_DMA_TX_INT from DMA Sub-System */
+    HOSTSIM_VECTOR(SECURITY_MU1_A_INT_IRQHandler)             /* Shared Int Source MU1_A_INT from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_MU2_A_INT_IRQHandler)             /* Shared Int Source MU2_A_INT from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_MU3_A_INT_IRQHandler)             /* Shared Int Source MU3_A_INT from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_CAAM_INT0_IRQHandler)             /* Shared Int Source CAAM_INT0 from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_CAAM_INT1_IRQHandler)             /* Shared Int Source CAAM_INT1 from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_CAAM_INT2_IRQHandler)             /* Shared Int Source CAAM_INT2 from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_CAAM_INT3_IRQHandler)             /* Shared Int Source CAAM_INT3 from Security Sub-System */
+    HOSTSIM_VECTOR(SECURITY_CAAM_RTIC_INT_IRQHandler)         /* Shared Int Source CAAM_RTIC_INT from Security Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF0_RX_MOD_INT_IRQHandler)        /* Shared Int Source SPDIF0_RX_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF0_RX_DMA_INT_IRQHandler)        /* Shared Int Source SPDIF0_RX_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF0_TX_MOD_INT_IRQHandler)        /* Shared Int Source SPDIF0_TX_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF0_TX_DMA_INT_IRQHandler)        /* Shared Int Source SPDIF0_TX_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF1_RX_MOD_INT_IRQHandler)        /* Shared Int Source SPDIF1_RX_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF1_RX_DMA_INT_IRQHandler)        /* Shared Int Source SPDIF1_RX_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF1_TX_MOD_INT_IRQHandler)        /* Shared Int Source SPDIF1_TX_MOD_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(AUDIO_SPDIF1_TX_DMA_INT_IRQHandler)        /* Shared Int Source SPDIF1_TX_DMA_INT from Audio Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_0_IRQHandler)                  /* Shared Int Source VPU_INT_0 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_1_IRQHandler)                  /* Shared Int Source VPU_INT_1 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_2_IRQHandler)                  /* Shared Int Source VPU_INT_2 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_3_IRQHandler)                  /* Shared Int Source VPU_INT_3 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_4_IRQHandler)                  /* Shared Int Source VPU_INT_4 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_5_IRQHandler)                  /* Shared Int Source VPU_INT_5 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_6_IRQHandler)                  /* Shared Int Source VPU_INT_6 from VPU Sub-System */
+    HOSTSIM_VECTOR(VPU_VPU_INT_7_IRQHandler)                  /* Shared Int Source VPU_INT_7 from VPU Sub-System */
+    HOSTSIM_VECTOR(Reserved571_IRQHandler)                    /* xxx Interrupt 571 */
+    HOSTSIM_VECTOR(Reserved572_IRQHandler)                    /* xxx Interrupt 572 */
+    HOSTSIM_VECTOR(Reserved573_IRQHandler)                    /* xxx Interrupt 573 */
+    HOSTSIM_VECTOR(Reserved574_IRQHandler)                    /* xxx Interrupt 574 */
+    HOSTSIM_VECTOR(Reserved575_IRQHandler)                    /* xxx Interrupt 575 */
+    HOSTSIM_VECTOR(Reserved576_IRQHandler)                    /* xxx Interrupt 576 */
+    HOSTSIM_VECTOR(Reserved577_IRQHandler)                    /* xxx Interrupt 577 */
+    HOSTSIM_VECTOR(Reserved578_IRQHandler)                    /* xxx Interrupt 578 */
+    HOSTSIM_VECTOR(Reserved579_IRQHandler)                    /* xxx Interrupt 579 */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_TPM_IRQHandler)         /* INTMUX Input source: TPM Interrupt */
+    HOSTSIM_VECTOR(Reserved581_IRQHandler)                    /* xxx Interrupt 581 */
+    HOSTSIM_VECTOR(Reserved582_IRQHandler)                    /* xxx Interrupt 582 */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_LPIT_IRQHandler)        /* INTMUX Input source: LPIT Interrupt */
+    HOSTSIM_VECTOR(Reserved584_IRQHandler)                    /* xxx Interrupt 584 */
+    HOSTSIM_VECTOR(Reserved585_IRQHandler)                    /* xxx Interrupt 585 */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_LPUART_IRQHandler)      /* INTMUX Input source: LPUART Interrupt */
+    HOSTSIM_VECTOR(Reserved587_IRQHandler)                    /* xxx Interrupt 587 */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_LPI2C_IRQHandler)       /* INTMUX Input source: LPI2C Interrupt */
+    HOSTSIM_VECTOR(Reserved589_IRQHandler)                    /* xxx Interrupt 589 */
+    HOSTSIM_VECTOR(Reserved590_IRQHandler)                    /* xxx Interrupt 590 */
+    HOSTSIM_VECTOR(Reserved591_IRQHandler)                    /* xxx Interrupt 591 */
+    HOSTSIM_VECTOR(Reserved592_IRQHandler)                    /* xxx Interrupt 592 */
+    HOSTSIM_VECTOR(Reserved593_IRQHandler)                    /* xxx Interrupt 593 */
+    HOSTSIM_VECTOR(Reserved594_IRQHandler)                    /* xxx Interrupt 594 */
+    HOSTSIM_VECTOR(Reserved595_IRQHandler)                    /* xxx Interrupt 595 */
+    HOSTSIM_VECTOR(Reserved596_IRQHandler)                    /* xxx Interrupt 596 */
+    HOSTSIM_VECTOR(Reserved597_IRQHandler)                    /* xxx Interrupt 597 */
+    HOSTSIM_VECTOR(Reserved598_IRQHandler)                    /* xxx Interrupt 598 */
+    HOSTSIM_VECTOR(Reserved599_IRQHandler)                    /* xxx Interrupt 599 */
+    HOSTSIM_VECTOR(Reserved600_IRQHandler)                    /* xxx Interrupt 600 */
+    HOSTSIM_VECTOR(Reserved601_IRQHandler)                    /* xxx Interrupt 601 */
+    HOSTSIM_VECTOR(Reserved602_IRQHandler)                    /* xxx Interrupt 602 */
+    HOSTSIM_VECTOR(Reserved603_IRQHandler)                    /* xxx Interrupt 603 */
+    HOSTSIM_VECTOR(Reserved604_IRQHandler)                    /* xxx Interrupt 604 */
+    HOSTSIM_VECTOR(Reserved605_IRQHandler)                    /* xxx Interrupt 605 */
+    HOSTSIM_VECTOR(Reserved606_IRQHandler)                    /* xxx Interrupt 606 */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_MU0_A3_IRQHandler)      /* INTMUX Input source: MU0_A3 Interrupt */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_MU0_A2_IRQHandler)      /* INTMUX Input source: MU0_A2 Interrupt */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_MU0_A1_IRQHandler)      /* INTMUX Input source: MU0_A1 Interrupt */
+    HOSTSIM_VECTOR(M4_0_INTMUX_SOURCE_MU0_A0_IRQHandler)      /* INTMUX Input source: MU0_A0 Interrupt */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 611 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 612 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 613 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 614 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 615 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 616 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 617 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 618 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 619 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 620 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 621 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 622 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 623 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 624 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 625 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 626 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 627 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 628 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 629 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 630 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 631 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 632 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 633 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 634 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 635 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 636 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 637 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 638 */
+    HOSTSIM_VECTOR(HOSTSIM_DefaultHandler)                    /* 639 */
+    "    .size __VECTOR_TABLE, 2560\n"
+    "    .popsection\n");
+
+uint32_t __VECTOR_RAM[HOSTSIM_VECTOR_COUNT];
+
+/* Size of the RAM vector table, defined by the linker file on the device. */
+__asm__(
+    "    .globl __RAM_VECTOR_TABLE_SIZE_BYTES\n"
+    "    .set __RAM_VECTOR_TABLE_SIZE_BYTES, 2560\n");
+
+/* Reset: the vector table and SystemInit(), once the models registered their peripherals. */
+__attribute__((constructor(110))) static void HOSTSIM_Reset(void)
+{
+    SCB->VTOR = (uint32_t)(uintptr_t)__VECTOR_TABLE;
+    SystemInit();
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Ordering of the DMA copy component on the eDMA model: a request smaller than the CPU copy threshold,
+ * which depends on the data of a request before it, must not run on the CPU while the eDMA still moves
+ * that data, nor while a batch is open.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hostsim_test.h"
+#include "fsl_component_dma_copy.h"
+#include "fsl_hostsim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_DMA         DMA__EDMA0
+#define TEST_DMA_CHANNEL (1U)
+
+#define TEST_BUFF_LENGTH (1024U)
+#define TEST_SMALL_SIZE  (64U)
+#define TEST_TCD_COUNT   (8U)
+
+/* Longest wait for a request, in simulated ns. */
+#define TEST_TIMEOUT_NS (10000000U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* The eDMA reads the fill pattern in the request: the requests are static as the buffers. */
+SDK_ALIGN(static uint8_t s_src[TEST_BUFF_LENGTH], 32U);
+SDK_ALIGN(static uint8_t s_dest[TEST_BUFF_LENGTH], 32U);
+SDK_ALIGN(static uint8_t s_copy[TEST_SMALL_SIZE], 32U);
+SDK_ALIGN(static edma_tcd_t s_tcds[TEST_TCD_COUNT], 32U);
+
+static dma_copy_handle_t s_handle;
+static dma_copy_request_t s_requests[2];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Runs the simulation until a request completes, returns false on timeout. */
+static bool TEST_Wait(const dma_copy_request_t *request)
+{
+    uint64_t end = HOSTSIM_GetTimeNs() + TEST_TIMEOUT_NS;
+
+    while ((DMA_COPY_GetStatus(request) == kStatus_DMA_COPY_Pending) && (HOSTSIM_GetTimeNs() < end))
+    {
+        if (!HOSTSIM_RunNextEvent())
+        {
+            break;
+        }
+    }
+
+    return DMA_COPY_GetStatus(request) == kStatus_Success;
+}
+
+static void TEST_Fill(uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TEST_BUFF_LENGTH; i++)
+    {
+        s_src[i] = (uint8_t)((i * 3U) + seed);
+    }
+    (void)memset(s_dest, 0, sizeof(s_dest));
+    (void)memset(s_copy, 0, sizeof(s_copy));
+}
+
+/* A small copy of the destination of a running eDMA copy waits for it. */
+static uint32_t TEST_SmallAfterRunning(void)
+{
+    uint32_t errors = 0U;
+
+    TEST_Fill(1U);
+    (void)DMA_COPY_Memcpy(&s_handle, &s_requests[0], s_dest, s_src, TEST_BUFF_LENGTH, NULL, NULL);
+    (void)DMA_COPY_Memcpy(&s_handle, &s_requests[1], s_copy, s_dest, TEST_SMALL_SIZE, NULL, NULL);
+
+    if (DMA_COPY_GetStatus(&s_requests[1]) != kStatus_DMA_COPY_Pending)
+    {
+        printf("  small after running: done before the eDMA copy\n");
+        errors++;
+    }
+    if (!TEST_Wait(&s_requests[0]) || !TEST_Wait(&s_requests[1]))
+    {
+        printf("  small after running: not completed\n");
+        return errors + 1U;
+    }
+    if (memcmp(s_copy, s_src, TEST_SMALL_SIZE) != 0)
+    {
+        printf("  small after running: the small copy read the destination before the eDMA copy\n");
+        errors++;
+    }
+
+    return errors;
+}
+
+/* A small fill in a batch waits for the end of the batch, then the copy after it sees the fill. */
+static uint32_t TEST_SmallInBatch(void)
+{
+    uint32_t errors = 0U;
+    uint32_t i;
+
+    TEST_Fill(2U);
+    DMA_COPY_BeginBatch(&s_handle);
+    (void)DMA_COPY_Memset(&s_handle, &s_requests[0], s_src, 0x5AU, TEST_SMALL_SIZE, NULL, NULL);
+    (void)DMA_COPY_Memcpy(&s_handle, &s_requests[1], s_dest, s_src, TEST_BUFF_LENGTH, NULL, NULL);
+    if (DMA_COPY_GetStatus(&s_requests[0]) != kStatus_DMA_COPY_Pending)
+    {
+        printf("  small in batch: done before the end of the batch\n");
+        errors++;
+    }
+    DMA_COPY_EndBatch(&s_handle);
+
+    if (!TEST_Wait(&s_requests[0]) || !TEST_Wait(&s_requests[1]))
+    {
+        printf("  small in batch: not completed\n");
+        return errors + 1U;
+    }
+    for (i = 0U; i < TEST_BUFF_LENGTH; i++)
+    {
+        if (s_dest[i] != ((i < TEST_SMALL_SIZE) ? 0x5AU : s_src[i]))
+        {
+            printf("  small in batch: destination byte %u differs\n", (unsigned int)i);
+            errors++;
+            break;
+        }
+    }
+
+    return errors;
+}
+
+/* On an idle handle a small copy is done by the CPU in the submitting call. */
+static uint32_t TEST_SmallIdle(void)
+{
+    uint32_t errors = 0U;
+
+    TEST_Fill(3U);
+    (void)DMA_COPY_Memcpy(&s_handle, &s_requests[0], s_copy, s_src, TEST_SMALL_SIZE, NULL, NULL);
+    if ((DMA_COPY_GetStatus(&s_requests[0]) != kStatus_Success) || (memcmp(s_copy, s_src, TEST_SMALL_SIZE) != 0))
+    {
+        printf("  small idle: not done by the CPU\n");
+        errors++;
+    }
+
+    return errors;
+}
+
+uint32_t TEST_DmaCopy(void)
+{
+    edma_config_t edmaConfig;
+    dma_copy_config_t config;
+    uint32_t errors = 0U;
+
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(TEST_DMA, &edmaConfig);
+    /* In place of IRQSTEER_EnableInterrupt(), see HOSTSIM_IRQ_COUNT. */
+    NVIC_EnableIRQ(DMA_EDMA0_INT_IRQn);
+
+    DMA_COPY_GetDefaultConfig(&config);
+    config.base     = TEST_DMA;
+    config.channel  = TEST_DMA_CHANNEL;
+    config.tcdPool  = s_tcds;
+    config.tcdCount = TEST_TCD_COUNT;
+    DMA_COPY_Init(&s_handle, &config);
+
+    errors += TEST_SmallIdle();
+    errors += TEST_SmallAfterRunning();
+    errors += TEST_SmallInBatch();
+
+    DMA_COPY_Deinit(&s_handle);
+    EDMA_Deinit(TEST_DMA);
+
+    return errors;
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Memory to memory transfers of fsl_edma.c on the eDMA model, as the edma driver examples: a single TCD
+ * transfer, then a scatter/gather chain of the TCD queue, each TCD one minor loop started by software and
+ * checked with the completion callback and the destination buffer.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hostsim_test.h"
+#include "fsl_edma.h"
+#include "fsl_hostsim.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_DMA         DMA__EDMA0
+#define TEST_DMA_CHANNEL (0U)
+
+#define TEST_BUFF_LENGTH (1024U)
+#define TEST_TCD_COUNT   (4U)
+
+/* Longest wait for a transfer, in simulated ns. */
+#define TEST_TIMEOUT_NS (10000000U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+/* The eDMA reaches 32-bit addresses only: the buffers are static, below 4 GB in the non-PIE process. */
+SDK_ALIGN(static uint8_t s_src[TEST_BUFF_LENGTH], 32U);
+SDK_ALIGN(static uint8_t s_dest[TEST_BUFF_LENGTH], 32U);
+SDK_ALIGN(static edma_tcd_t s_tcds[TEST_TCD_COUNT], 32U);
+
+static edma_handle_t s_handle;
+static volatile uint32_t s_callbacks;
+static volatile uint32_t s_doneTcds;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_Callback(edma_handle_t *handle, void *userData, bool transferDone, uint32_t tcds)
+{
+    (void)handle;
+    (void)userData;
+
+    /* Only the last TCD of a scatter/gather chain is done, the others report their count. */
+    s_doneTcds += tcds;
+    if (transferDone)
+    {
+        s_callbacks++;
+    }
+}
+
+/* Runs the simulation until a count of the callback reaches a value, returns false on timeout. */
+static bool TEST_Wait(volatile uint32_t *count, uint32_t value)
+{
+    uint64_t end = HOSTSIM_GetTimeNs() + TEST_TIMEOUT_NS;
+
+    while ((*count < value) && (HOSTSIM_GetTimeNs() < end))
+    {
+        if (!HOSTSIM_RunNextEvent())
+        {
+            break;
+        }
+    }
+
+    return *count >= value;
+}
+
+static void TEST_Fill(uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TEST_BUFF_LENGTH; i++)
+    {
+        s_src[i] = (uint8_t)((i * 7U) + seed);
+    }
+    (void)memset(s_dest, 0, sizeof(s_dest));
+}
+
+/* One transfer of the whole buffer, with the TCD in the channel registers. */
+static uint32_t TEST_SingleTransfer(void)
+{
+    edma_transfer_config_t transfer;
+    uint32_t errors = 0U;
+
+    TEST_Fill(1U);
+    s_callbacks = 0U;
+    EDMA_CreateHandle(&s_handle, TEST_DMA, TEST_DMA_CHANNEL);
+    EDMA_SetCallback(&s_handle, TEST_Callback, NULL);
+    EDMA_PrepareTransfer(&transfer, s_src, sizeof(uint32_t), s_dest, sizeof(uint32_t), TEST_BUFF_LENGTH,
+                         TEST_BUFF_LENGTH, kEDMA_MemoryToMemory);
+    if (EDMA_SubmitTransfer(&s_handle, &transfer) != kStatus_Success)
+    {
+        printf("  single transfer: not submitted\n");
+        return 1U;
+    }
+    EDMA_TriggerChannelStart(TEST_DMA, TEST_DMA_CHANNEL);
+
+    if (!TEST_Wait(&s_callbacks, 1U))
+    {
+        printf("  single transfer: no completion callback\n");
+        errors++;
+    }
+    else if (memcmp(s_src, s_dest, TEST_BUFF_LENGTH) != 0)
+    {
+        printf("  single transfer: destination differs from the source\n");
+        errors++;
+    }
+
+    return errors;
+}
+
+/* The buffer in TEST_TCD_COUNT parts, each one a TCD of the queue linked by scatter/gather. */
+static uint32_t TEST_QueuedTransfer(void)
+{
+    edma_transfer_config_t transfer;
+    uint32_t part   = TEST_BUFF_LENGTH / TEST_TCD_COUNT;
+    uint32_t errors = 0U;
+    uint32_t i;
+
+    TEST_Fill(2U);
+    s_callbacks = 0U;
+    s_doneTcds  = 0U;
+    EDMA_CreateHandle(&s_handle, TEST_DMA, TEST_DMA_CHANNEL);
+    EDMA_SetCallback(&s_handle, TEST_Callback, NULL);
+    EDMA_ResetChannel(TEST_DMA, TEST_DMA_CHANNEL);
+    EDMA_InstallTCDMemory(&s_handle, s_tcds, TEST_TCD_COUNT);
+    for (i = 0U; i < TEST_TCD_COUNT; i++)
+    {
+        EDMA_PrepareTransfer(&transfer, &s_src[i * part], sizeof(uint32_t), &s_dest[i * part], sizeof(uint32_t),
+                             part, part, kEDMA_MemoryToMemory);
+        if (EDMA_SubmitTransfer(&s_handle, &transfer) != kStatus_Success)
+        {
+            printf("  queued transfer: part %u not submitted\n", (unsigned int)i);
+            return 1U;
+        }
+    }
+
+    /* The scatter/gather loads the next TCD, which waits for its own start. */
+    for (i = 0U; i < TEST_TCD_COUNT; i++)
+    {
+        EDMA_TriggerChannelStart(TEST_DMA, TEST_DMA_CHANNEL);
+        if (!TEST_Wait(&s_doneTcds, i + 1U))
+        {
+            printf("  queued transfer: %u of %u TCDs completed\n", (unsigned int)s_doneTcds,
+                   (unsigned int)TEST_TCD_COUNT);
+            return 1U;
+        }
+    }
+
+    if (memcmp(s_src, s_dest, TEST_BUFF_LENGTH) != 0)
+    {
+        printf("  queued transfer: destination differs from the source\n");
+        errors++;
+    }
+
+    return errors;
+}
+
+uint32_t TEST_Edma(void)
+{
+    edma_config_t config;
+    uint32_t errors = 0U;
+
+    EDMA_GetDefaultConfig(&config);
+    EDMA_Init(TEST_DMA, &config);
+    /* In place of IRQSTEER_EnableInterrupt(), see HOSTSIM_IRQ_COUNT. */
+    NVIC_EnableIRQ(DMA_EDMA0_INT_IRQn);
+
+    errors += TEST_SingleTransfer();
+    errors += TEST_QueuedTransfer();
+
+    EDMA_Deinit(TEST_DMA);
+
+    return errors;
+}
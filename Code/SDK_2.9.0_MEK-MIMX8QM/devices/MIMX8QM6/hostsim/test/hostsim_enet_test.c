@@ -0,0 +1,420 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Traffic classes of the lwIP ENET port (enet_ethernetif_kinetis.c) with three rings on the ENET model:
+ * the transmit ring chosen from the VLAN priority or the DSCP class selector, the receive classification
+ * programmed in the RCMR registers, and the receive polling order, highest ring first. Under a bulk load
+ * which the application cannot keep up with, the latency of the control frames is measured in simulated
+ * time, from their send by the link partner to the input function, with and without a VLAN priority. The
+ * application charges TEST_PROCESS_NS per frame; the CPU cycles of the port and lwIP are not simulated.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hostsim_test.h"
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "enet_ethernetif.h"
+#include "fsl_enet_mdio.h"
+#include "fsl_phyar8031.h"
+#include "fsl_hostsim.h"
+#include "fsl_hostsim_enet.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_ENET          CONNECTIVITY__ENET0
+#define TEST_ENET_CLOCK_HZ (125000000U)
+#define TEST_PHY_ADDRESS   (0x06U)
+
+/* Frames of the minimum length, without the FCS, the test data after the first two bytes of the payload. */
+#define TEST_FRAME_LENGTH (60U)
+#define TEST_TYPE_OFFSET  (12U)
+#define TEST_DATA_OFFSET  (16U)
+#define TEST_TYPE_VLAN    (0x8100U)
+#define TEST_TYPE_IP4     (0x0800U)
+#define TEST_TYPE_ARP     (0x0806U)
+#define TEST_TYPE_IP6     (0x86DDU)
+
+/* Longest wait for a frame, in simulated ns. */
+#define TEST_TIMEOUT_NS (1000000U)
+
+/* Bulk load: one frame per TEST_GAP_NS, every TEST_CONTROL_PERIOD-th a control frame, for TEST_LOAD_NS. */
+#define TEST_GAP_NS             (1000U)
+#define TEST_PROCESS_NS         (1500U)
+#define TEST_CONTROL_PERIOD     (50U)
+#define TEST_LOAD_NS            (20000000U)
+#define TEST_LATENCIES          ((TEST_LOAD_NS / TEST_GAP_NS) + 1U)
+#define TEST_CONTROL_PCP        (6U)
+#define TEST_CONTROL_P99_MAX_NS (2U * TEST_PROCESS_NS)
+
+typedef struct _test_tx_case
+{
+    const char *name;
+    uint16_t type;
+    uint8_t header[2]; /*!< First two bytes after the type: the VLAN tag control or the start of the IP header. */
+    uint32_t ringId;
+} test_tx_case_t;
+
+typedef struct _test_latency
+{
+    uint32_t *ns;
+    uint32_t count;
+} test_latency_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const uint8_t s_macAddress[]  = {0x02, 0x12, 0x13, 0x10, 0x15, 0x11};
+static const uint8_t s_peerAddress[] = {0x02, 0x12, 0x13, 0x10, 0x15, 0x22};
+
+/* Expected with the default ENET_PCP_TO_RING_MAP of three rings: priorities 4-5 to ring 1, 6-7 to ring 2. */
+static const test_tx_case_t s_txCases[] = {
+    {"ARP", TEST_TYPE_ARP, {0x00U, 0x01U}, 0U},
+    {"VLAN PCP 0", TEST_TYPE_VLAN, {0x00U, 0x01U}, 0U},
+    {"VLAN PCP 3", TEST_TYPE_VLAN, {0x60U, 0x01U}, 0U},
+    {"VLAN PCP 4", TEST_TYPE_VLAN, {0x80U, 0x01U}, 1U},
+    {"VLAN PCP 5", TEST_TYPE_VLAN, {0xA0U, 0x01U}, 1U},
+    {"VLAN PCP 6", TEST_TYPE_VLAN, {0xC0U, 0x01U}, 2U},
+    {"VLAN PCP 7", TEST_TYPE_VLAN, {0xE0U, 0x01U}, 2U},
+    {"IPv4 best effort", TEST_TYPE_IP4, {0x45U, 0x00U}, 0U},
+    {"IPv4 AF31", TEST_TYPE_IP4, {0x45U, 0x68U}, 0U},
+    {"IPv4 EF", TEST_TYPE_IP4, {0x45U, 0xB8U}, 1U},
+    {"IPv4 CS6", TEST_TYPE_IP4, {0x45U, 0xC0U}, 2U},
+    {"IPv6 CS1", TEST_TYPE_IP6, {0x62U, 0x00U}, 0U},
+    {"IPv6 AF41", TEST_TYPE_IP6, {0x68U, 0x80U}, 1U},
+    {"IPv6 CS7", TEST_TYPE_IP6, {0x6EU, 0x00U}, 2U},
+};
+
+static mdio_handle_t s_mdioHandle = {.ops = &enet_ops};
+static phy_handle_t s_phyHandle   = {.phyAddr = TEST_PHY_ADDRESS, .mdioHandle = &s_mdioHandle, .ops = &phyar8031_ops};
+static struct netif s_netif;
+
+static volatile uint32_t s_txCount;
+static volatile uint32_t s_txRing;
+
+/* Data bytes of the frames given to the input function, in their order. */
+static uint8_t s_inputOrder[8];
+static uint32_t s_inputCount;
+
+/* Load: frames sent by the link partner, control frames received and the latencies per class. */
+static hostsim_event_t s_loadEvent;
+static uint64_t s_loadEnd;
+static bool s_loadRunning;
+static bool s_loadControlTagged;
+static uint32_t s_loadSent;
+static uint32_t s_loadControlSent;
+static uint32_t s_controlNs[TEST_LATENCIES];
+static uint32_t s_bulkNs[TEST_LATENCIES];
+static test_latency_t s_controlLatency = {s_controlNs, 0U};
+static test_latency_t s_bulkLatency    = {s_bulkNs, 0U};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void TEST_BuildFrame(uint8_t *frame, const uint8_t *dest, uint16_t type, const uint8_t *header)
+{
+    (void)memset(frame, 0, TEST_FRAME_LENGTH);
+    (void)memcpy(&frame[0], dest, 6U);
+    (void)memcpy(&frame[6], (dest == s_macAddress) ? s_peerAddress : s_macAddress, 6U);
+    frame[TEST_TYPE_OFFSET]      = (uint8_t)(type >> 8U);
+    frame[TEST_TYPE_OFFSET + 1U] = (uint8_t)type;
+    frame[TEST_TYPE_OFFSET + 2U] = header[0];
+    frame[TEST_TYPE_OFFSET + 3U] = header[1];
+}
+
+static void TEST_Output(ENET_Type *base, uint32_t ringId, const uint8_t *frame, size_t length, void *userData)
+{
+    (void)base;
+    (void)frame;
+    (void)length;
+    (void)userData;
+
+    s_txRing = ringId;
+    s_txCount++;
+}
+
+/* Input function of the netif in place of ethernet_input(): records the frames. */
+static err_t TEST_Input(struct pbuf *p, struct netif *netif)
+{
+    uint64_t sent = 0U;
+    uint8_t data[1U + sizeof(sent)];
+
+    (void)netif;
+
+    (void)pbuf_copy_partial(p, data, sizeof(data), TEST_DATA_OFFSET);
+    if (s_inputCount < sizeof(s_inputOrder))
+    {
+        s_inputOrder[s_inputCount] = data[0];
+    }
+    s_inputCount++;
+
+    if (s_loadRunning)
+    {
+        test_latency_t *latency = (data[0] != 0U) ? &s_controlLatency : &s_bulkLatency;
+
+        (void)memcpy(&sent, &data[1], sizeof(sent));
+        if (latency->count < TEST_LATENCIES)
+        {
+            latency->ns[latency->count] = (uint32_t)(HOSTSIM_GetTimeNs() - sent);
+            latency->count++;
+        }
+        /* The application handles the frame. */
+        HOSTSIM_Run(TEST_PROCESS_NS);
+    }
+
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+/* Each frame on its own goes out from the ring of its traffic class. */
+static uint32_t TEST_TxRing(void)
+{
+    uint8_t frame[TEST_FRAME_LENGTH];
+    uint32_t errors = 0U;
+    uint32_t count;
+    uint64_t end;
+    struct pbuf *p;
+    uint32_t i;
+
+    for (i = 0U; i < ARRAY_SIZE(s_txCases); i++)
+    {
+        TEST_BuildFrame(frame, s_peerAddress, s_txCases[i].type, s_txCases[i].header);
+        p = pbuf_alloc(PBUF_RAW, TEST_FRAME_LENGTH, PBUF_RAM);
+        (void)pbuf_take(p, frame, TEST_FRAME_LENGTH);
+
+        count = s_txCount;
+        if (s_netif.linkoutput(&s_netif, p) != ERR_OK)
+        {
+            printf("  transmit %s: not sent\n", s_txCases[i].name);
+            errors++;
+        }
+        pbuf_free(p);
+
+        end = HOSTSIM_GetTimeNs() + TEST_TIMEOUT_NS;
+        while ((s_txCount == count) && (HOSTSIM_GetTimeNs() < end) && HOSTSIM_RunNextEvent())
+        {
+        }
+        if (s_txCount == count)
+        {
+            printf("  transmit %s: no frame on the line\n", s_txCases[i].name);
+            errors++;
+        }
+        else if (s_txRing != s_txCases[i].ringId)
+        {
+            printf("  transmit %s: sent from ring %u, expected %u\n", s_txCases[i].name, (unsigned int)s_txRing,
+                   (unsigned int)s_txCases[i].ringId);
+            errors++;
+        }
+        else
+        {
+            /* Sent from the expected ring. */
+        }
+    }
+
+    return errors;
+}
+
+/* Frames waiting in all rings are given to lwIP from the highest ring down, each ring in arrival order. */
+static uint32_t TEST_RxOrder(void)
+{
+    /* Arrival order, with the VLAN tag control of each frame, 0 for untagged. */
+    static const uint8_t tci[]      = {0x00U, 0x00U, 0x80U, 0x00U, 0xE0U, 0x20U};
+    static const uint8_t expected[] = {5U, 3U, 1U, 2U, 4U, 6U};
+    static const uint8_t untagged[] = {0x45U, 0x00U};
+    uint8_t frame[TEST_FRAME_LENGTH];
+    uint8_t header[2];
+    uint32_t errors = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < ARRAY_SIZE(tci); i++)
+    {
+        header[0] = tci[i];
+        header[1] = 0x01U;
+        TEST_BuildFrame(frame, s_macAddress, (tci[i] != 0U) ? TEST_TYPE_VLAN : TEST_TYPE_IP4,
+                        (tci[i] != 0U) ? header : untagged);
+        frame[TEST_DATA_OFFSET] = (uint8_t)(i + 1U);
+        (void)HOSTSIM_EnetSend(TEST_ENET, frame, TEST_FRAME_LENGTH);
+    }
+    HOSTSIM_Run(TEST_TIMEOUT_NS);
+
+    s_inputCount = 0U;
+    ethernetif_input(&s_netif);
+
+    if (s_inputCount != ARRAY_SIZE(expected))
+    {
+        printf("  receive order: %u frames received, expected %u\n", (unsigned int)s_inputCount,
+               (unsigned int)ARRAY_SIZE(expected));
+        return 1U;
+    }
+    for (i = 0U; i < ARRAY_SIZE(expected); i++)
+    {
+        if (s_inputOrder[i] != expected[i])
+        {
+            printf("  receive order: frame %u received at position %u, expected frame %u\n",
+                   (unsigned int)s_inputOrder[i], (unsigned int)i, (unsigned int)expected[i]);
+            errors++;
+        }
+    }
+
+    return errors;
+}
+
+/* Link partner of the load: sends a frame, then schedules the next one. */
+static void TEST_LoadSend(void *param)
+{
+    static const uint8_t bulk[]     = {0x45U, 0x00U};
+    static const uint8_t control[]  = {(uint8_t)(TEST_CONTROL_PCP << 5U), 0x01U};
+    static const uint8_t untagged[] = {0x45U, 0xC0U};
+    uint8_t frame[TEST_FRAME_LENGTH];
+    uint64_t now   = HOSTSIM_GetTimeNs();
+    bool isControl = ((s_loadSent % TEST_CONTROL_PERIOD) == (TEST_CONTROL_PERIOD - 1U));
+
+    (void)param;
+
+    if (!isControl)
+    {
+        TEST_BuildFrame(frame, s_macAddress, TEST_TYPE_IP4, bulk);
+    }
+    else if (s_loadControlTagged)
+    {
+        TEST_BuildFrame(frame, s_macAddress, TEST_TYPE_VLAN, control);
+    }
+    else
+    {
+        /* The same class without a VLAN tag: the receive classification only looks at the VLAN priority. */
+        TEST_BuildFrame(frame, s_macAddress, TEST_TYPE_IP4, untagged);
+    }
+    frame[TEST_DATA_OFFSET] = isControl ? 1U : 0U;
+    (void)memcpy(&frame[TEST_DATA_OFFSET + 1U], &now, sizeof(now));
+
+    if (HOSTSIM_EnetSend(TEST_ENET, frame, TEST_FRAME_LENGTH))
+    {
+        s_loadSent++;
+        s_loadControlSent += isControl ? 1U : 0U;
+    }
+    if (now < s_loadEnd)
+    {
+        HOSTSIM_EventSchedule(&s_loadEvent, TEST_GAP_NS, TEST_LoadSend, NULL);
+    }
+}
+
+static int TEST_CompareNs(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+
+    return (x > y) - (x < y);
+}
+
+static uint32_t TEST_P99(test_latency_t *latency)
+{
+    if (latency->count == 0U)
+    {
+        return 0U;
+    }
+    qsort(latency->ns, latency->count, sizeof(latency->ns[0]), TEST_CompareNs);
+    return latency->ns[(latency->count * 99U) / 100U];
+}
+
+/* Runs the bulk load, returns the 99th percentile latency of the control frames in ns. */
+static uint32_t TEST_Load(bool controlTagged, uint32_t *errors)
+{
+    uint32_t count;
+    uint32_t controlP99;
+
+    s_loadControlTagged    = controlTagged;
+    s_loadSent             = 0U;
+    s_loadControlSent      = 0U;
+    s_controlLatency.count = 0U;
+    s_bulkLatency.count    = 0U;
+    s_loadRunning          = true;
+    s_loadEnd              = HOSTSIM_GetTimeNs() + TEST_LOAD_NS;
+    HOSTSIM_EventSchedule(&s_loadEvent, TEST_GAP_NS, TEST_LoadSend, NULL);
+
+    /* The main loop of a bare metal application. Under the load ethernetif_input() only returns once the
+     * link partner stops and the rings are empty. */
+    while (HOSTSIM_GetTimeNs() < (s_loadEnd + TEST_TIMEOUT_NS))
+    {
+        count = s_inputCount;
+        ethernetif_input(&s_netif);
+        if ((s_inputCount == count) && !HOSTSIM_RunNextEvent())
+        {
+            break;
+        }
+    }
+    s_loadRunning = false;
+
+    controlP99 = TEST_P99(&s_controlLatency);
+    printf("  %-8s %9u %9u %17u %14u\n", controlTagged ? "VLAN" : "untagged", (unsigned int)s_loadSent,
+           (unsigned int)(s_controlLatency.count + s_bulkLatency.count), (unsigned int)controlP99,
+           (unsigned int)TEST_P99(&s_bulkLatency));
+
+    if ((s_loadControlSent == 0U) || (s_bulkLatency.count >= (s_loadSent - s_loadControlSent)))
+    {
+        printf("  the load does not exceed what the application handles\n");
+        (*errors)++;
+    }
+    if (controlTagged && (s_controlLatency.count != s_loadControlSent))
+    {
+        printf("  %u of %u control frames received\n", (unsigned int)s_controlLatency.count,
+               (unsigned int)s_loadControlSent);
+        (*errors)++;
+    }
+
+    return controlP99;
+}
+
+uint32_t TEST_Enet(void)
+{
+    ethernetif_config_t config = {
+        .phyHandle  = &s_phyHandle,
+        .macAddress = {0x02, 0x12, 0x13, 0x10, 0x15, 0x11},
+    };
+    uint32_t errors = 0U;
+    uint32_t taggedP99;
+    uint32_t untaggedP99;
+
+    s_mdioHandle.resource.csrClock_Hz = TEST_ENET_CLOCK_HZ;
+    HOSTSIM_EnetSetOutput(TEST_ENET, TEST_Output, NULL);
+
+    lwip_init();
+    (void)netif_add(&s_netif, NULL, NULL, NULL, &config, ethernetif0_init, TEST_Input);
+    netif_set_up(&s_netif);
+
+    errors += TEST_TxRing();
+    errors += TEST_RxOrder();
+
+    printf("  control  frames sent  received control p99 ns   bulk p99 ns\n");
+    taggedP99   = TEST_Load(true, &errors);
+    untaggedP99 = TEST_Load(false, &errors);
+
+    /* A control frame waits at most for the frame the application is handling when it arrives. */
+    if (taggedP99 > TEST_CONTROL_P99_MAX_NS)
+    {
+        printf("  control frames in their own ring wait %u ns (p99), more than %u ns\n", (unsigned int)taggedP99,
+               (unsigned int)TEST_CONTROL_P99_MAX_NS);
+        errors++;
+    }
+    if (taggedP99 >= untaggedP99)
+    {
+        printf("  control frames do not overtake the bulk backlog\n");
+        errors++;
+    }
+
+    netif_remove(&s_netif);
+    ENET_Deinit(TEST_ENET);
+
+    return errors;
+}
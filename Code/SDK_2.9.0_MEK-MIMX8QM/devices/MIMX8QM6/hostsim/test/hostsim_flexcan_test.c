@@ -0,0 +1,321 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Receive paths of fsl_flexcan.c on the FlexCAN model under full bus load, as the rx_ring_benchmark
+ * example: four Tx Message Buffers send back to back in loopback, eight Rx Message Buffers receive with one
+ * transactional receive per frame, then drained into the receive ring. The IRQ handler is timed in
+ * simulated time, which the model advances by HOSTSIM_ACCESS_TIME_NS per register access: the report gives
+ * the register accesses of the receive path per frame, the Tx interrupts charged at their cost without
+ * receive. The CPU cycles of the code between the accesses are not simulated.
+ */
+
+#include <stdio.h>
+
+#include "hostsim_test.h"
+#include "fsl_flexcan.h"
+#include "fsl_hostsim.h"
+#include "fsl_hostsim_flexcan.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_CAN          DMA__CAN0
+#define TEST_CAN_CLOCK_HZ (24000000U)
+
+/* MB0 is the reserved Tx MB of ERR005641, the Rx FIFO is disabled. */
+#define TEST_TX_MB_FIRST  (1U)
+#define TEST_TX_MB_COUNT  (4U)
+#define TEST_RX_MB_FIRST  (8U)
+#define TEST_RX_MB_COUNT  (8U)
+#define TEST_RING_ENTRIES (64U)
+#define TEST_TX_ID        (0x123U)
+
+/* Each run loads the bus for 20 ms of simulated time. */
+#define TEST_RUN_NS (20000000U)
+
+typedef enum _test_mode
+{
+    kTEST_TxOnly = 0U, /*!< The Tx Message Buffers load the bus, no Rx Message Buffer. */
+    kTEST_MbTransfer,  /*!< One transactional receive per Rx Message Buffer and frame. */
+    kTEST_RxRing,      /*!< The Rx Message Buffers are drained into the receive ring. */
+} test_mode_t;
+
+typedef struct _test_result
+{
+    uint64_t isrNs;    /*!< Simulated time in the IRQ handler. */
+    uint32_t txFrames; /*!< Frames sent. */
+    uint32_t rxFrames; /*!< Frames received. */
+    uint32_t batches;  /*!< Callbacks with received frames. */
+} test_result_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/* Defined by fsl_flexcan.c. */
+void DMA_FLEXCAN0_INT_DriverIRQHandler(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static flexcan_handle_t s_handle;
+static flexcan_mb_transfer_t s_txXfer[TEST_TX_MB_COUNT];
+static flexcan_mb_transfer_t s_rxXfer[TEST_RX_MB_COUNT];
+static flexcan_frame_t s_txFrame;
+static flexcan_frame_t s_rxFrames[TEST_RX_MB_COUNT];
+static flexcan_rx_ring_entry_t s_ringEntries[TEST_RING_ENTRIES];
+static flexcan_rx_ring_t s_ring;
+static volatile bool s_running;
+static volatile uint32_t s_txCount;
+static volatile uint32_t s_rxCount;
+static volatile uint32_t s_batchCount;
+static uint64_t s_isrNs;
+static uint32_t s_badFrames;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* Replaces the weak handler of the vector table, to time the driver IRQ handler. */
+void DMA_FLEXCAN0_INT_IRQHandler(void)
+{
+    uint64_t start = HOSTSIM_GetTimeNs();
+
+    DMA_FLEXCAN0_INT_DriverIRQHandler();
+    s_isrNs += HOSTSIM_GetTimeNs() - start;
+}
+
+static void TEST_CheckFrame(const flexcan_frame_t *frame)
+{
+    if ((frame->id != FLEXCAN_ID_STD(TEST_TX_ID)) || (frame->dataWord0 != s_txFrame.dataWord0) ||
+        (frame->dataWord1 != s_txFrame.dataWord1))
+    {
+        s_badFrames++;
+    }
+}
+
+static void TEST_Callback(CAN_Type *base, flexcan_handle_t *handle, status_t status, uint32_t result, void *userData)
+{
+    (void)userData;
+
+    switch (status)
+    {
+        case kStatus_FLEXCAN_RxIdle:
+            TEST_CheckFrame(&s_rxFrames[result - TEST_RX_MB_FIRST]);
+            s_rxCount++;
+            s_batchCount++;
+            (void)FLEXCAN_TransferReceiveNonBlocking(base, handle, &s_rxXfer[result - TEST_RX_MB_FIRST]);
+            break;
+
+        case kStatus_FLEXCAN_RxRingReady:
+            s_batchCount++;
+            break;
+
+        case kStatus_FLEXCAN_TxIdle:
+            s_txCount++;
+            if (s_running)
+            {
+                (void)FLEXCAN_TransferSendNonBlocking(base, handle, &s_txXfer[result - TEST_TX_MB_FIRST]);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* Drains the receive ring, as the main loop of the application. */
+static void TEST_DrainRing(void)
+{
+    const flexcan_rx_ring_entry_t *entry;
+
+    while ((NULL != s_handle.rxRing) && (NULL != (entry = FLEXCAN_RxRingPeek(&s_ring))))
+    {
+        TEST_CheckFrame(&entry->frame);
+        s_rxCount++;
+        FLEXCAN_RxRingRelease(&s_ring);
+    }
+}
+
+static uint32_t TEST_Run(test_mode_t mode, test_result_t *result)
+{
+    flexcan_config_t config;
+    flexcan_rx_mb_config_t mbConfig;
+    flexcan_rx_ring_config_t ringConfig;
+    uint32_t errors = 0U;
+    uint64_t end;
+    uint32_t i;
+
+    FLEXCAN_GetDefaultConfig(&config);
+    config.maxMbNum       = TEST_RX_MB_FIRST + TEST_RX_MB_COUNT;
+    config.enableLoopBack = true;
+    FLEXCAN_Init(TEST_CAN, &config, TEST_CAN_CLOCK_HZ);
+    FLEXCAN_TransferCreateHandle(TEST_CAN, &s_handle, TEST_Callback, NULL);
+    /* In place of IRQSTEER_EnableInterrupt(), see HOSTSIM_IRQ_COUNT. */
+    NVIC_EnableIRQ(DMA_FLEXCAN0_INT_IRQn);
+
+    s_txCount    = 0U;
+    s_rxCount    = 0U;
+    s_batchCount = 0U;
+    s_isrNs      = 0U;
+
+    if (kTEST_TxOnly != mode)
+    {
+        mbConfig.format = kFLEXCAN_FrameFormatStandard;
+        mbConfig.type   = kFLEXCAN_FrameTypeData;
+        mbConfig.id     = FLEXCAN_ID_STD(TEST_TX_ID);
+        for (i = 0U; i < TEST_RX_MB_COUNT; i++)
+        {
+            FLEXCAN_SetRxMbConfig(TEST_CAN, (uint8_t)(TEST_RX_MB_FIRST + i), &mbConfig, true);
+        }
+    }
+
+    if (kTEST_MbTransfer == mode)
+    {
+        for (i = 0U; i < TEST_RX_MB_COUNT; i++)
+        {
+            s_rxXfer[i].mbIdx = (uint8_t)(TEST_RX_MB_FIRST + i);
+            s_rxXfer[i].frame = &s_rxFrames[i];
+            (void)FLEXCAN_TransferReceiveNonBlocking(TEST_CAN, &s_handle, &s_rxXfer[i]);
+        }
+    }
+    else if (kTEST_RxRing == mode)
+    {
+        ringConfig.entries      = s_ringEntries;
+        ringConfig.entryCount   = TEST_RING_ENTRIES;
+        ringConfig.mbMask       = ((1ULL << TEST_RX_MB_COUNT) - 1U) << TEST_RX_MB_FIRST;
+        ringConfig.enableRxFifo = false;
+        ringConfig.getTimestamp = NULL;
+        if (kStatus_Success != FLEXCAN_TransferStartRxRing(TEST_CAN, &s_handle, &s_ring, &ringConfig))
+        {
+            printf("  receive ring: not started\n");
+            errors++;
+        }
+    }
+    else
+    {
+        /* No receive. */
+    }
+
+    s_running = true;
+    for (i = 0U; i < TEST_TX_MB_COUNT; i++)
+    {
+        FLEXCAN_SetTxMbConfig(TEST_CAN, (uint8_t)(TEST_TX_MB_FIRST + i), true);
+        s_txXfer[i].mbIdx = (uint8_t)(TEST_TX_MB_FIRST + i);
+        s_txXfer[i].frame = &s_txFrame;
+        (void)FLEXCAN_TransferSendNonBlocking(TEST_CAN, &s_handle, &s_txXfer[i]);
+    }
+
+    end = HOSTSIM_GetTimeNs() + TEST_RUN_NS;
+    while ((HOSTSIM_GetTimeNs() < end) && HOSTSIM_RunNextEvent())
+    {
+        TEST_DrainRing();
+    }
+
+    /* The frames on the bus complete, the last entries are drained. */
+    s_running = false;
+    HOSTSIM_Run(TEST_RUN_NS / 100U);
+    TEST_DrainRing();
+
+    if (kTEST_RxRing == mode)
+    {
+        FLEXCAN_TransferStopRxRing(TEST_CAN, &s_handle);
+        if ((0U != s_ring.droppedFrames) || (0U != s_ring.overrunFrames))
+        {
+            printf("  receive ring: %u frames dropped, %u overruns\n", (unsigned int)s_ring.droppedFrames,
+                   (unsigned int)s_ring.overrunFrames);
+            errors++;
+        }
+    }
+    FLEXCAN_Deinit(TEST_CAN);
+
+    result->isrNs    = s_isrNs;
+    result->txFrames = s_txCount;
+    result->rxFrames = s_rxCount;
+    result->batches  = s_batchCount;
+
+    if ((kTEST_TxOnly != mode) && (result->rxFrames != result->txFrames))
+    {
+        printf("  %u frames sent, %u received\n", (unsigned int)result->txFrames, (unsigned int)result->rxFrames);
+        errors++;
+    }
+
+    return errors;
+}
+
+/* Register accesses of the receive path per frame, the Tx interrupts charged at their cost without receive. */
+static uint32_t TEST_RxAccessesPerFrame(const test_result_t *result, const test_result_t *txOnly)
+{
+    uint64_t txNs;
+
+    if ((0U == result->rxFrames) || (0U == txOnly->txFrames))
+    {
+        return 0U;
+    }
+
+    txNs = (txOnly->isrNs * result->txFrames) / txOnly->txFrames;
+    if (result->isrNs <= txNs)
+    {
+        return 0U;
+    }
+
+    return (uint32_t)((result->isrNs - txNs) / ((uint64_t)HOSTSIM_ACCESS_TIME_NS * result->rxFrames));
+}
+
+static void TEST_Print(const char *name, const test_result_t *result, const test_result_t *txOnly)
+{
+    printf("  %-12s %9u %9u %9u %19u\n", name, (unsigned int)result->txFrames, (unsigned int)result->rxFrames,
+           (unsigned int)result->batches, (unsigned int)TEST_RxAccessesPerFrame(result, txOnly));
+}
+
+uint32_t TEST_Flexcan(void)
+{
+    test_result_t txOnly;
+    test_result_t mbTransfer;
+    test_result_t rxRing;
+    uint32_t errors;
+
+    s_txFrame.format    = (uint8_t)kFLEXCAN_FrameFormatStandard;
+    s_txFrame.type      = (uint8_t)kFLEXCAN_FrameTypeData;
+    s_txFrame.id        = FLEXCAN_ID_STD(TEST_TX_ID);
+    s_txFrame.length    = 8U;
+    s_txFrame.dataWord0 = 0x11223344U;
+    s_txFrame.dataWord1 = 0x55667788U;
+    s_badFrames         = 0U;
+
+    HOSTSIM_FlexcanSetClock(TEST_CAN, TEST_CAN_CLOCK_HZ);
+
+    errors = TEST_Run(kTEST_TxOnly, &txOnly);
+    errors += TEST_Run(kTEST_MbTransfer, &mbTransfer);
+    errors += TEST_Run(kTEST_RxRing, &rxRing);
+
+    printf("  receive path tx frames rx frames   batches rx accesses/frame\n");
+    TEST_Print("none", &txOnly, &txOnly);
+    TEST_Print("per MB", &mbTransfer, &txOnly);
+    TEST_Print("receive ring", &rxRing, &txOnly);
+
+    if (0U != s_badFrames)
+    {
+        printf("  %u frames received with a wrong identifier or data\n", (unsigned int)s_badFrames);
+        errors++;
+    }
+    if (0U == txOnly.txFrames)
+    {
+        printf("  no frame sent\n");
+        errors++;
+    }
+    else if (TEST_RxAccessesPerFrame(&rxRing, &txOnly) > TEST_RxAccessesPerFrame(&mbTransfer, &txOnly))
+    {
+        printf("  the receive ring costs more register accesses per frame than the transactional receive\n");
+        errors++;
+    }
+
+    return errors;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Loopback of fsl_lpuart.c on the LPUART model: the transmit line is wired to the receive line, the
+ * interrupt driven receive of the transfer API gets the characters sent with LPUART_WriteBlocking(), then
+ * those of LPUART_TransferSendNonBlocking().
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hostsim_test.h"
+#include "fsl_lpuart.h"
+#include "fsl_hostsim.h"
+#include "fsl_hostsim_lpuart.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define TEST_LPUART          DMA__LPUART0
+#define TEST_LPUART_CLOCK_HZ (80000000U)
+#define TEST_BAUDRATE        (115200U)
+
+#define TEST_LENGTH (100U)
+
+/* Longest wait for a transfer, in simulated ns: the characters take 87 us each at 115200 bit/s. */
+#define TEST_TIMEOUT_NS (20000000U)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static uint8_t s_txData[TEST_LENGTH];
+static uint8_t s_rxData[TEST_LENGTH];
+
+static lpuart_handle_t s_handle;
+static volatile bool s_rxDone;
+static volatile bool s_txDone;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/* The wire from the transmit line back to the receive line. */
+static void TEST_Loopback(LPUART_Type *base, uint16_t data, void *userData)
+{
+    uint8_t character = (uint8_t)data;
+
+    (void)userData;
+    (void)HOSTSIM_LpuartSend(base, &character, 1U);
+}
+
+static void TEST_Callback(LPUART_Type *base, lpuart_handle_t *handle, status_t status, void *userData)
+{
+    (void)base;
+    (void)handle;
+    (void)userData;
+
+    if (status == kStatus_LPUART_RxIdle)
+    {
+        s_rxDone = true;
+    }
+    else if (status == kStatus_LPUART_TxIdle)
+    {
+        s_txDone = true;
+    }
+    else
+    {
+    }
+}
+
+/* Runs the simulation until a flag of the callback is set, returns false on timeout. */
+static bool TEST_Wait(volatile bool *done)
+{
+    uint64_t end = HOSTSIM_GetTimeNs() + TEST_TIMEOUT_NS;
+
+    while ((!*done) && (HOSTSIM_GetTimeNs() < end))
+    {
+        if (!HOSTSIM_RunNextEvent())
+        {
+            break;
+        }
+    }
+
+    return *done;
+}
+
+static uint32_t TEST_Loop(const char *name, bool nonBlockingSend, uint32_t seed)
+{
+    lpuart_transfer_t xfer;
+    uint32_t errors = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < TEST_LENGTH; i++)
+    {
+        s_txData[i] = (uint8_t)((i * 13U) + seed);
+    }
+    (void)memset(s_rxData, 0, sizeof(s_rxData));
+    s_rxDone = false;
+    s_txDone = false;
+
+    xfer.data     = s_rxData;
+    xfer.dataSize = TEST_LENGTH;
+    (void)LPUART_TransferReceiveNonBlocking(TEST_LPUART, &s_handle, &xfer, NULL);
+
+    if (nonBlockingSend)
+    {
+        xfer.data     = s_txData;
+        xfer.dataSize = TEST_LENGTH;
+        (void)LPUART_TransferSendNonBlocking(TEST_LPUART, &s_handle, &xfer);
+        if (!TEST_Wait(&s_txDone))
+        {
+            printf("  %s: send not completed\n", name);
+            errors++;
+        }
+    }
+    else if (LPUART_WriteBlocking(TEST_LPUART, s_txData, TEST_LENGTH) != kStatus_Success)
+    {
+        printf("  %s: write failed\n", name);
+        errors++;
+    }
+    else
+    {
+    }
+
+    if (!TEST_Wait(&s_rxDone))
+    {
+        printf("  %s: %u of %u characters received\n", name,
+               (unsigned int)(TEST_LENGTH - s_handle.rxDataSize), (unsigned int)TEST_LENGTH);
+        errors++;
+    }
+    else if (memcmp(s_txData, s_rxData, TEST_LENGTH) != 0)
+    {
+        printf("  %s: received characters differ from the sent ones\n", name);
+        errors++;
+    }
+    else
+    {
+    }
+
+    return errors;
+}
+
+uint32_t TEST_Lpuart(void)
+{
+    lpuart_config_t config;
+    uint32_t errors = 0U;
+
+    HOSTSIM_LpuartSetClock(TEST_LPUART, TEST_LPUART_CLOCK_HZ);
+    HOSTSIM_LpuartSetOutput(TEST_LPUART, TEST_Loopback, NULL);
+
+    LPUART_GetDefaultConfig(&config);
+    config.baudRate_Bps = TEST_BAUDRATE;
+    config.enableTx     = true;
+    config.enableRx     = true;
+    if (LPUART_Init(TEST_LPUART, &config, TEST_LPUART_CLOCK_HZ) != kStatus_Success)
+    {
+        printf("  init failed\n");
+        return 1U;
+    }
+    LPUART_TransferCreateHandle(TEST_LPUART, &s_handle, TEST_Callback, NULL);
+    /* In place of IRQSTEER_EnableInterrupt(), see HOSTSIM_IRQ_COUNT. */
+    NVIC_EnableIRQ(DMA_UART0_INT_IRQn);
+
+    errors += TEST_Loop("blocking write", false, 1U);
+    errors += TEST_Loop("non-blocking send", true, 2U);
+
+    LPUART_Deinit(TEST_LPUART);
+
+    return errors;
+}
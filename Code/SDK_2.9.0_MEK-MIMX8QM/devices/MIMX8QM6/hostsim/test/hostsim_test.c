@@ -0,0 +1,71 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host tests of the device simulation: each test runs a driver unchanged on the models of its peripherals.
+ *
+ *   hostsim_test [test]    runs the named test, all of them without argument
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hostsim_test.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef struct _test_case
+{
+    const char *name;
+    uint32_t (*run)(void);
+} test_case_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static const test_case_t s_tests[] = {
+    {"dma_copy", TEST_DmaCopy},
+    {"edma", TEST_Edma},
+    {"enet", TEST_Enet},
+    {"flexcan", TEST_Flexcan},
+    {"lpuart", TEST_Lpuart},
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+int main(int argc, char **argv)
+{
+    uint32_t errors = 0U;
+    bool found      = false;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(s_tests) / sizeof(s_tests[0])); i++)
+    {
+        if ((argc < 2) || (strcmp(argv[1], s_tests[i].name) == 0))
+        {
+            uint32_t testErrors = s_tests[i].run();
+
+            printf("%s: %u errors\n", s_tests[i].name, (unsigned int)testErrors);
+            errors += testErrors;
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        printf("unknown test %s\n", argv[1]);
+        return 1;
+    }
+
+    return (errors == 0U) ? 0 : 1;
+}
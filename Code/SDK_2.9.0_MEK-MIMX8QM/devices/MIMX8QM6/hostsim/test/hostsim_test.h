@@ -0,0 +1,52 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _HOSTSIM_TEST_H_
+#define _HOSTSIM_TEST_H_
+
+#include <stdint.h>
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+/*!
+ * @brief Submission order of the DMA copy component.
+ *
+ * @return Number of errors.
+ */
+uint32_t TEST_DmaCopy(void);
+
+/*!
+ * @brief Memory to memory transfers of the eDMA driver.
+ *
+ * @return Number of errors.
+ */
+uint32_t TEST_Edma(void);
+
+/*!
+ * @brief Traffic class rings of the lwIP ENET port, the control frame latency under bulk load.
+ *
+ * @return Number of errors.
+ */
+uint32_t TEST_Enet(void);
+
+/*!
+ * @brief Receive paths of the FlexCAN driver under full bus load, with their register accesses per frame.
+ *
+ * @return Number of errors.
+ */
+uint32_t TEST_Flexcan(void);
+
+/*!
+ * @brief Loopback of the LPUART driver, the transmit line wired to the receive line.
+ *
+ * @return Number of errors.
+ */
+uint32_t TEST_Lpuart(void);
+
+#endif /* _HOSTSIM_TEST_H_ */
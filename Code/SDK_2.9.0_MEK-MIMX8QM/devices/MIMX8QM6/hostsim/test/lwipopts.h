@@ -0,0 +1,41 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef __LWIPOPTS_H__
+#define __LWIPOPTS_H__
+
+#include "fsl_device_registers.h"
+
+/*
+ * Options of the lwIP ENET port test (hostsim_enet_test.c): bare metal, the test drives the port directly and
+ * installs its own input function, so only the link layer is used.
+ */
+
+#define NO_SYS       1
+#define LWIP_TIMERS  0
+#define LWIP_NETCONN 0
+#define LWIP_SOCKET  0
+#define LWIP_TCP     0
+#define LWIP_UDP     0
+#define LWIP_DHCP    0
+#define LWIP_IPV6    0
+
+void sys_check_core_locking(void);
+#define LWIP_ASSERT_CORE_LOCKED() sys_check_core_locking()
+
+#define MEM_ALIGNMENT  8
+#define MEM_SIZE       (16 * 1024)
+#define PBUF_POOL_SIZE 16
+#define MEMP_NUM_PBUF  16
+
+/* Three rings, VLAN priorities 0-3 to ring 0, 4-5 to ring 1, 6-7 to ring 2 (the default map). */
+#define ENET_RING_NUM 3U
+/* Deep enough for a bulk backlog in ring 0. */
+#define ENET_RXBD_NUM 16
+
+#define LWIP_STATS 0
+
+#endif /* __LWIPOPTS_H__ */
@@ -37,7 +37,8 @@ ARCHFILES=$(LWIPARCH)/perf.c \
 	$(LWIPARCH)/netif/tapif.c \
 	$(LWIPARCH)/netif/list.c \
 	$(LWIPARCH)/netif/sio.c \
-	$(LWIPARCH)/netif/fifo.c
+	$(LWIPARCH)/netif/fifo.c \
+	$(LWIPARCH)/netif/pipeif.c
 
 UNIX_COMMON_MK_DIR := $(dir $(abspath $(lastword $(MAKEFILE_LIST))))
 include $(UNIX_COMMON_MK_DIR)../Common.allports.mk
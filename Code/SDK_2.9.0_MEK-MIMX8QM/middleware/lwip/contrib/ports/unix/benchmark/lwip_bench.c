@@ -0,0 +1,558 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * In-process lwIP throughput benchmark.
+ *
+ * Two netifs are connected back-to-back by the pipeif memory link and all
+ * traffic stays inside this process, so no tap device or NIC is needed.
+ * The following tests run one after another:
+ *  - tcp: lwiperf TCP client on netif A streaming to the lwiperf server on B
+ *  - udp: lwiperf UDP client on A sending at a fixed rate to the server on B
+ *  - rr:  TCP request/response, A sends a request, B echoes it back
+ *
+ * Each test prints one CSV line with Mbit/s, packets/s (frames on the link,
+ * both directions) and CPU cycles per payload byte. The lwIP configuration
+ * the binary was built with is reported in the first column, see
+ * LWIP_BENCH_CONFIGS in CMakeLists.txt.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lwip/opt.h"
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/tcp.h"
+#include "lwip/timeouts.h"
+#include "lwip/apps/lwiperf.h"
+#include "netif/ethernet.h"
+#include "netif/pipeif.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_CYCLES() ((u64_t)__rdtsc())
+#define BENCH_CYCLES_UNIT "cycles"
+#else
+/* No portable cycle counter, fall back to nanoseconds. */
+#define BENCH_CYCLES() bench_now_ns()
+#define BENCH_CYCLES_UNIT "ns"
+#endif
+
+#ifndef LWIP_BENCH_CONFIG_NAME
+#define LWIP_BENCH_CONFIG_NAME "default"
+#endif
+
+#define BENCH_RR_PORT 7777
+
+struct bench_options {
+  u32_t seconds;
+  u16_t mtu;
+  u32_t latency_us;
+  u32_t loss_ppm;
+  u32_t udp_mbps;
+  u16_t rr_size;
+  int header;
+};
+
+struct bench_result {
+  const char *name;
+  u64_t bytes;
+  u64_t frames;
+  u64_t cycles;
+  u64_t ns;
+  u32_t transactions;
+};
+
+/** State of the lwiperf session currently being measured */
+struct bench_iperf {
+  int done;
+  enum lwiperf_report_type report_type;
+  u64_t bytes;
+  u32_t ms;
+};
+
+/** State of the request/response test */
+struct bench_rr {
+  struct tcp_pcb *listen_pcb;
+  struct tcp_pcb *client;
+  u8_t *request;
+  u16_t size;
+  u32_t pending;
+  u32_t transactions;
+  u64_t deadline_ns;
+  int done;
+};
+
+static struct pipeif_link bench_link;
+static struct netif netif_a;
+static struct netif netif_b;
+static struct bench_iperf bench_iperf_state;
+static struct bench_rr bench_rr_state;
+/** Number of tests which failed to start or complete, makes ctest report the run as failed */
+static int bench_failures;
+
+static u64_t
+bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((u64_t)ts.tv_sec * 1000000000U) + (u64_t)ts.tv_nsec;
+}
+
+void
+lwip_bench_diag(const char *format, ...)
+{
+  va_list ap;
+
+  va_start(ap, format);
+  vfprintf(stderr, format, ap);
+  va_end(ap);
+}
+
+/** LWIP_HOOK_IP4_ROUTE_SRC: sends from A to B over end[0] and from B to A over end[1] */
+struct netif *
+lwip_bench_route(const ip4_addr_t *src, const ip4_addr_t *dest)
+{
+  if (!ip4_addr_isany(src)) {
+    if (ip4_addr_eq(src, netif_ip4_addr(&netif_a))) {
+      return &netif_a;
+    }
+    if (ip4_addr_eq(src, netif_ip4_addr(&netif_b))) {
+      return &netif_b;
+    }
+    return NULL;
+  }
+  return ip4_addr_eq(dest, netif_ip4_addr(&netif_a)) ? &netif_b : &netif_a;
+}
+
+static u64_t
+bench_link_frames(void)
+{
+  return (u64_t)bench_link.end[0].tx_frames + bench_link.end[1].tx_frames;
+}
+
+/** Runs the stack until *done is set or timeout_ms elapsed, returns 0 on timeout */
+static int
+bench_run(const int *done, u32_t timeout_ms)
+{
+  u64_t end = bench_now_ns() + ((u64_t)timeout_ms * 1000000U);
+
+  while (!*done) {
+    pipeif_link_poll(&bench_link);
+    sys_check_timeouts();
+    lwiperf_poll_udp_client();
+    if (bench_now_ns() > end) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/** Lets the link drain and the stack finish connection teardown between tests */
+static void
+bench_settle(u32_t ms)
+{
+  int never = 0;
+
+  bench_run(&never, ms);
+}
+
+static void
+bench_print(const struct bench_options *opt, const struct bench_result *res)
+{
+  double secs = (double)res->ns / 1e9;
+  double mbps = (secs > 0.0) ? ((double)res->bytes * 8.0 / secs / 1e6) : 0.0;
+  double pps = (secs > 0.0) ? ((double)res->frames / secs) : 0.0;
+  double cpb = (res->bytes != 0) ? ((double)res->cycles / (double)res->bytes) : 0.0;
+  double tps = (secs > 0.0) ? ((double)res->transactions / secs) : 0.0;
+
+  printf("%s,%s,%u,%u,%u,%.1f,%.0f,%.2f,%.0f\n", LWIP_BENCH_CONFIG_NAME, res->name, (unsigned)opt->mtu,
+         (unsigned)opt->latency_us, (unsigned)opt->loss_ppm, mbps, pps, cpb, tps);
+  fflush(stdout);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* lwiperf based tests */
+
+static void
+bench_iperf_report(void *arg, enum lwiperf_report_type report_type,
+                   const ip_addr_t *local_addr, u16_t local_port, const ip_addr_t *remote_addr, u16_t remote_port,
+                   u64_t bytes_transferred, u32_t ms_duration, u32_t bandwidth_kbitpsec)
+{
+  struct bench_iperf *state = (struct bench_iperf *)arg;
+
+  LWIP_UNUSED_ARG(local_addr);
+  LWIP_UNUSED_ARG(local_port);
+  LWIP_UNUSED_ARG(remote_addr);
+  LWIP_UNUSED_ARG(remote_port);
+  LWIP_UNUSED_ARG(bandwidth_kbitpsec);
+
+  /* The receiving side measures, client reports only end the test on error. */
+  if ((report_type == LWIPERF_TCP_DONE_CLIENT) || (report_type == LWIPERF_UDP_DONE_CLIENT)) {
+    return;
+  }
+  state->report_type = report_type;
+  state->bytes = bytes_transferred;
+  state->ms = ms_duration;
+  state->done = 1;
+}
+
+static void
+bench_tcp(const struct bench_options *opt)
+{
+  struct bench_result res;
+  void *server;
+  u64_t t0, c0;
+
+  memset(&bench_iperf_state, 0, sizeof(bench_iperf_state));
+  server = lwiperf_start_tcp_server(netif_ip_addr4(&netif_b), LWIPERF_TCP_PORT_DEFAULT,
+                                    bench_iperf_report, &bench_iperf_state);
+  LWIP_ASSERT("lwiperf_start_tcp_server failed", server != NULL);
+
+  pipeif_link_reset_stats(&bench_link);
+  t0 = bench_now_ns();
+  c0 = BENCH_CYCLES();
+  /* negative amount: duration in 1/100 seconds */
+  if (lwiperf_start_tcp_client(netif_ip_addr4(&netif_b), LWIPERF_TCP_PORT_DEFAULT, LWIPERF_CLIENT,
+                               -(int)(opt->seconds * 100U), bench_iperf_report, &bench_iperf_state) == NULL) {
+    fprintf(stderr, "tcp: lwiperf_start_tcp_client failed\n");
+    bench_failures++;
+    lwiperf_abort(server);
+    return;
+  }
+  if (!bench_run(&bench_iperf_state.done, (opt->seconds + 5U) * 1000U) ||
+      (bench_iperf_state.report_type != LWIPERF_TCP_DONE_SERVER)) {
+    fprintf(stderr, "tcp: test did not complete (report %d)\n", (int)bench_iperf_state.report_type);
+    bench_failures++;
+  }
+
+  memset(&res, 0, sizeof(res));
+  res.name = "tcp";
+  res.cycles = BENCH_CYCLES() - c0;
+  res.ns = (bench_iperf_state.ms != 0) ? ((u64_t)bench_iperf_state.ms * 1000000U) : (bench_now_ns() - t0);
+  res.bytes = bench_iperf_state.bytes;
+  res.frames = bench_link_frames();
+  bench_print(opt, &res);
+
+  lwiperf_abort(server);
+  bench_settle(100);
+}
+
+static void
+bench_udp(const struct bench_options *opt)
+{
+  struct bench_result res;
+  void *server;
+  u64_t t0, c0;
+
+  memset(&bench_iperf_state, 0, sizeof(bench_iperf_state));
+  server = lwiperf_start_udp_server(netif_ip_addr4(&netif_b), LWIPERF_TCP_PORT_DEFAULT,
+                                    bench_iperf_report, &bench_iperf_state);
+  LWIP_ASSERT("lwiperf_start_udp_server failed", server != NULL);
+
+  pipeif_link_reset_stats(&bench_link);
+  t0 = bench_now_ns();
+  c0 = BENCH_CYCLES();
+  if (lwiperf_start_udp_client(netif_ip_addr4(&netif_a), 0, netif_ip_addr4(&netif_b), LWIPERF_TCP_PORT_DEFAULT,
+                               LWIPERF_CLIENT, -(int)(opt->seconds * 100U), (s32_t)(opt->udp_mbps * 1000000U), 0,
+                               bench_iperf_report, &bench_iperf_state) == NULL) {
+    fprintf(stderr, "udp: lwiperf_start_udp_client failed\n");
+    bench_failures++;
+    lwiperf_abort(server);
+    return;
+  }
+  if (!bench_run(&bench_iperf_state.done, (opt->seconds + 5U) * 1000U) ||
+      (bench_iperf_state.report_type != LWIPERF_UDP_DONE_SERVER)) {
+    fprintf(stderr, "udp: test did not complete (report %d)\n", (int)bench_iperf_state.report_type);
+    bench_failures++;
+  }
+
+  memset(&res, 0, sizeof(res));
+  res.name = "udp";
+  res.cycles = BENCH_CYCLES() - c0;
+  res.ns = (bench_iperf_state.ms != 0) ? ((u64_t)bench_iperf_state.ms * 1000000U) : (bench_now_ns() - t0);
+  res.bytes = bench_iperf_state.bytes;
+  res.frames = bench_link_frames();
+  bench_print(opt, &res);
+
+  lwiperf_abort(server);
+  bench_settle(100);
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Request/response test on the raw TCP API */
+
+static err_t
+bench_rr_send(struct bench_rr *rr)
+{
+  err_t err = tcp_write(rr->client, rr->request, rr->size, 0);
+
+  if (err == ERR_OK) {
+    err = tcp_output(rr->client);
+  }
+  return err;
+}
+
+static void
+bench_rr_finish(struct bench_rr *rr)
+{
+  if (rr->client != NULL) {
+    tcp_arg(rr->client, NULL);
+    tcp_recv(rr->client, NULL);
+    tcp_err(rr->client, NULL);
+    if (tcp_close(rr->client) != ERR_OK) {
+      tcp_abort(rr->client);
+    }
+    rr->client = NULL;
+  }
+  rr->done = 1;
+}
+
+static err_t
+bench_rr_echo_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+  struct pbuf *q;
+
+  LWIP_UNUSED_ARG(arg);
+  LWIP_UNUSED_ARG(err);
+
+  if (p == NULL) {
+    tcp_recv(pcb, NULL);
+    if (tcp_close(pcb) != ERR_OK) {
+      tcp_abort(pcb);
+      return ERR_ABRT;
+    }
+    return ERR_OK;
+  }
+  for (q = p; q != NULL; q = q->next) {
+    if (tcp_write(pcb, q->payload, q->len, TCP_WRITE_FLAG_COPY) != ERR_OK) {
+      break;
+    }
+  }
+  tcp_recved(pcb, p->tot_len);
+  pbuf_free(p);
+  tcp_output(pcb);
+  return ERR_OK;
+}
+
+static err_t
+bench_rr_accept(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+
+  if ((err != ERR_OK) || (pcb == NULL)) {
+    return ERR_VAL;
+  }
+  tcp_nagle_disable(pcb);
+  tcp_recv(pcb, bench_rr_echo_recv);
+  return ERR_OK;
+}
+
+static err_t
+bench_rr_client_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+  struct bench_rr *rr = (struct bench_rr *)arg;
+
+  LWIP_UNUSED_ARG(err);
+
+  if (p == NULL) {
+    bench_rr_finish(rr);
+    return ERR_OK;
+  }
+  tcp_recved(pcb, p->tot_len);
+  rr->pending -= LWIP_MIN(rr->pending, p->tot_len);
+  pbuf_free(p);
+
+  if (rr->pending == 0) {
+    rr->transactions++;
+    if (bench_now_ns() >= rr->deadline_ns) {
+      bench_rr_finish(rr);
+    } else {
+      rr->pending = rr->size;
+      if (bench_rr_send(rr) != ERR_OK) {
+        bench_rr_finish(rr);
+      }
+    }
+  }
+  return ERR_OK;
+}
+
+static void
+bench_rr_client_err(void *arg, err_t err)
+{
+  struct bench_rr *rr = (struct bench_rr *)arg;
+
+  LWIP_UNUSED_ARG(err);
+  rr->client = NULL;
+  rr->done = 1;
+}
+
+static err_t
+bench_rr_connected(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+  struct bench_rr *rr = (struct bench_rr *)arg;
+
+  LWIP_UNUSED_ARG(pcb);
+
+  if (err != ERR_OK) {
+    bench_rr_finish(rr);
+    return ERR_OK;
+  }
+  rr->pending = rr->size;
+  if (bench_rr_send(rr) != ERR_OK) {
+    bench_rr_finish(rr);
+  }
+  return ERR_OK;
+}
+
+static void
+bench_rr(const struct bench_options *opt)
+{
+  struct bench_rr *rr = &bench_rr_state;
+  struct bench_result res;
+  struct tcp_pcb *pcb;
+  u64_t t0, c0;
+
+  memset(rr, 0, sizeof(*rr));
+  rr->size = opt->rr_size;
+  rr->request = (u8_t *)malloc(rr->size);
+  LWIP_ASSERT("out of memory", rr->request != NULL);
+  memset(rr->request, 0x5A, rr->size);
+
+  pcb = tcp_new();
+  LWIP_ASSERT("tcp_new failed", pcb != NULL);
+  tcp_bind(pcb, netif_ip_addr4(&netif_b), BENCH_RR_PORT);
+  rr->listen_pcb = tcp_listen(pcb);
+  LWIP_ASSERT("tcp_listen failed", rr->listen_pcb != NULL);
+  tcp_accept(rr->listen_pcb, bench_rr_accept);
+
+  rr->client = tcp_new();
+  LWIP_ASSERT("tcp_new failed", rr->client != NULL);
+  tcp_nagle_disable(rr->client);
+  tcp_arg(rr->client, rr);
+  tcp_recv(rr->client, bench_rr_client_recv);
+  tcp_err(rr->client, bench_rr_client_err);
+
+  pipeif_link_reset_stats(&bench_link);
+  t0 = bench_now_ns();
+  c0 = BENCH_CYCLES();
+  rr->deadline_ns = t0 + ((u64_t)opt->seconds * 1000000000U);
+  tcp_connect(rr->client, netif_ip_addr4(&netif_b), BENCH_RR_PORT, bench_rr_connected);
+  if (!bench_run(&rr->done, (opt->seconds + 5U) * 1000U)) {
+    fprintf(stderr, "rr: test did not complete\n");
+    bench_failures++;
+    bench_rr_finish(rr);
+  }
+
+  memset(&res, 0, sizeof(res));
+  res.name = "rr";
+  res.cycles = BENCH_CYCLES() - c0;
+  res.ns = bench_now_ns() - t0;
+  res.transactions = rr->transactions;
+  /* request and response payload */
+  res.bytes = (u64_t)rr->transactions * rr->size * 2U;
+  res.frames = bench_link_frames();
+  bench_print(opt, &res);
+
+  tcp_close(rr->listen_pcb);
+  free(rr->request);
+  bench_settle(100);
+}
+
+/*-----------------------------------------------------------------------------------*/
+
+static void
+bench_usage(const char *prog)
+{
+  fprintf(stderr,
+          "usage: %s [-t seconds] [-m mtu] [-l latency_us] [-p loss_ppm] [-r udp_mbps] [-s rr_size] [-H]\n"
+          "  -H  print the CSV header line\n",
+          prog);
+}
+
+int
+main(int argc, char **argv)
+{
+  struct bench_options opt;
+  struct pipeif_link_config link_config;
+  ip4_addr_t addr, netmask, gw;
+  int ch;
+
+  opt.seconds = 2;
+  opt.mtu = 1500;
+  opt.latency_us = 0;
+  opt.loss_ppm = 0;
+  opt.udp_mbps = 500;
+  opt.rr_size = 64;
+  opt.header = 0;
+
+  while ((ch = getopt(argc, argv, "t:m:l:p:r:s:H")) != -1) {
+    switch (ch) {
+      case 't':
+        opt.seconds = (u32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'm':
+        opt.mtu = (u16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'l':
+        opt.latency_us = (u32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        opt.loss_ppm = (u32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'r':
+        opt.udp_mbps = (u32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        opt.rr_size = (u16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'H':
+        opt.header = 1;
+        break;
+      default:
+        bench_usage(argv[0]);
+        return 1;
+    }
+  }
+  if ((opt.seconds == 0) || (opt.mtu < 576) || (opt.rr_size == 0) || (opt.udp_mbps == 0) || (opt.udp_mbps > 2000)) {
+    bench_usage(argv[0]);
+    return 1;
+  }
+
+  lwip_init();
+
+  link_config.mtu = opt.mtu;
+  link_config.latency_us = opt.latency_us;
+  link_config.loss_ppm = opt.loss_ppm;
+  link_config.seed = 1;
+  pipeif_link_init(&bench_link, &link_config);
+
+  IP4_ADDR(&netmask, 255, 255, 255, 0);
+  ip4_addr_set_zero(&gw);
+  IP4_ADDR(&addr, 10, 0, 0, 1);
+  netif_add(&netif_a, &addr, &netmask, &gw, &bench_link.end[0], pipeif_init, ethernet_input);
+  IP4_ADDR(&addr, 10, 0, 0, 2);
+  netif_add(&netif_b, &addr, &netmask, &gw, &bench_link.end[1], pipeif_init, ethernet_input);
+  netif_set_up(&netif_a);
+  netif_set_up(&netif_b);
+
+  if (opt.header) {
+    printf("config,test,mtu,latency_us,loss_ppm,mbit_s,packets_s,%s_per_byte,transactions_s\n", BENCH_CYCLES_UNIT);
+  }
+
+  bench_tcp(&opt);
+  bench_udp(&opt);
+  bench_rr(&opt);
+
+  return (bench_failures != 0) ? 1 : 0;
+}
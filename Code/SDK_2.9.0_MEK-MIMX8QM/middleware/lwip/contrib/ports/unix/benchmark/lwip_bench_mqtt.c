@@ -0,0 +1,564 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * MQTT publish throughput.
+ *
+ * The MQTT client on netif A publishes to a minimal broker on netif B over the
+ * pipeif memory link. The broker only parses the stream, acknowledges QoS 1
+ * publishes and discards the payload. Every run keeps up to "window" publishes
+ * outstanding and counts the ones completed (PUBACK received for QoS 1, sent
+ * for QoS 0), either copied through the output ring buffer (mqtt_publish(),
+ * test "copy") or sent by reference (mqtt_publish_ref(), test "ref").
+ * Payloads not fitting the ring buffer cannot be published by copy, that
+ * row reports zero throughput. Nagle is disabled on the client connection,
+ * with a window of 1 the last segment of a message would otherwise wait for
+ * the delayed ACK of the broker.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lwip/opt.h"
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/tcp.h"
+#include "lwip/timeouts.h"
+#include "lwip/apps/mqtt.h"
+#include "lwip/apps/mqtt_priv.h"
+#include "netif/ethernet.h"
+#include "netif/pipeif.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_CYCLES() ((u64_t)__rdtsc())
+#define BENCH_CYCLES_UNIT "cycles"
+#else
+#define BENCH_CYCLES() bench_now_ns()
+#define BENCH_CYCLES_UNIT "ns"
+#endif
+
+#ifndef LWIP_BENCH_CONFIG_NAME
+#define LWIP_BENCH_CONFIG_NAME "default"
+#endif
+
+#define BENCH_MQTT_TOPIC "bench/data"
+
+/** Broker side receive state */
+enum bench_broker_state {
+  BENCH_BROKER_FIXED_HDR,
+  BENCH_BROKER_REM_LEN,
+  BENCH_BROKER_BODY
+};
+
+struct bench_broker {
+  struct tcp_pcb *listen_pcb;
+  struct tcp_pcb *pcb;
+  enum bench_broker_state state;
+  u8_t type_flags;
+  u8_t rem_len_shift;
+  u32_t rem_len;
+  /** Offset into the body of the current message */
+  u32_t body_idx;
+  u16_t topic_len;
+  u16_t pkt_id;
+};
+
+/** Publisher side state of one run */
+struct bench_publisher {
+  mqtt_client_t *client;
+  int connected;
+  int closed;
+  const u8_t *payload;
+  u32_t size;
+  int ref;
+  u8_t qos;
+  u16_t window;
+  u16_t outstanding;
+  u32_t completed;
+  u32_t errors;
+  u64_t deadline_ns;
+  int done;
+};
+
+static struct pipeif_link bench_link;
+static struct netif netif_a;
+static struct netif netif_b;
+static struct bench_broker bench_broker_state;
+static struct bench_publisher bench_pub;
+/** Number of runs which failed to start or complete, makes ctest report the run as failed */
+static int bench_failures;
+
+static u64_t
+bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((u64_t)ts.tv_sec * 1000000000U) + (u64_t)ts.tv_nsec;
+}
+
+void
+lwip_bench_diag(const char *format, ...)
+{
+  va_list ap;
+
+  va_start(ap, format);
+  vfprintf(stderr, format, ap);
+  va_end(ap);
+}
+
+/** LWIP_HOOK_IP4_ROUTE_SRC: sends from A to B over end[0] and from B to A over end[1] */
+struct netif *
+lwip_bench_route(const ip4_addr_t *src, const ip4_addr_t *dest)
+{
+  if (!ip4_addr_isany(src)) {
+    if (ip4_addr_eq(src, netif_ip4_addr(&netif_a))) {
+      return &netif_a;
+    }
+    if (ip4_addr_eq(src, netif_ip4_addr(&netif_b))) {
+      return &netif_b;
+    }
+    return NULL;
+  }
+  return ip4_addr_eq(dest, netif_ip4_addr(&netif_a)) ? &netif_b : &netif_a;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Broker */
+
+static void
+bench_broker_reply(struct bench_broker *br, u8_t type, u16_t pkt_id)
+{
+  u8_t msg[4];
+
+  msg[0] = type;
+  msg[1] = 2;
+  msg[2] = (u8_t)(pkt_id >> 8);
+  msg[3] = (u8_t)(pkt_id & 0xff);
+  if (tcp_write(br->pcb, msg, sizeof(msg), TCP_WRITE_FLAG_COPY) != ERR_OK) {
+    fprintf(stderr, "broker: reply lost\n");
+  }
+}
+
+/** Called when the body of the current message is complete */
+static void
+bench_broker_message(struct bench_broker *br)
+{
+  switch (br->type_flags >> 4) {
+    case 1: /* CONNECT */
+      bench_broker_reply(br, 0x20, 0);
+      break;
+    case 3: /* PUBLISH */
+      if ((br->type_flags & 0x06) != 0) {
+        bench_broker_reply(br, 0x40, br->pkt_id);
+      }
+      break;
+    case 12: /* PINGREQ */
+      bench_broker_reply(br, 0xD0, 0);
+      break;
+    default:
+      break;
+  }
+  br->state = BENCH_BROKER_FIXED_HDR;
+}
+
+/** Parses the variable header of a PUBLISH for its packet identifier, skips everything else */
+static u32_t
+bench_broker_body(struct bench_broker *br, const u8_t *data, u32_t len)
+{
+  u32_t used = 0;
+
+  if ((br->type_flags >> 4) == 3) {
+    u32_t hdr_len = 2U + br->topic_len + (((br->type_flags & 0x06) != 0) ? 2U : 0U);
+    while ((used < len) && (br->body_idx < hdr_len)) {
+      u8_t b = data[used++];
+      if (br->body_idx == 0) {
+        br->topic_len = (u16_t)(b << 8);
+      } else if (br->body_idx == 1) {
+        br->topic_len |= b;
+        hdr_len = 2U + br->topic_len + (((br->type_flags & 0x06) != 0) ? 2U : 0U);
+      } else if (br->body_idx == hdr_len - 2U) {
+        br->pkt_id = (u16_t)(b << 8);
+      } else if (br->body_idx == hdr_len - 1U) {
+        br->pkt_id |= b;
+      }
+      br->body_idx++;
+    }
+  }
+  /* payload */
+  if (used < len) {
+    u32_t skip = LWIP_MIN(len - used, br->rem_len - br->body_idx);
+    used += skip;
+    br->body_idx += skip;
+  }
+  return used;
+}
+
+static void
+bench_broker_parse(struct bench_broker *br, const u8_t *data, u32_t len)
+{
+  u32_t i = 0;
+
+  while (i < len) {
+    switch (br->state) {
+      case BENCH_BROKER_FIXED_HDR:
+        br->type_flags = data[i++];
+        br->rem_len = 0;
+        br->rem_len_shift = 0;
+        br->state = BENCH_BROKER_REM_LEN;
+        break;
+      case BENCH_BROKER_REM_LEN: {
+        u8_t b = data[i++];
+        br->rem_len |= (u32_t)(b & 0x7F) << br->rem_len_shift;
+        br->rem_len_shift = (u8_t)(br->rem_len_shift + 7);
+        if ((b & 0x80) == 0) {
+          br->body_idx = 0;
+          br->topic_len = 0;
+          br->pkt_id = 0;
+          br->state = BENCH_BROKER_BODY;
+          if (br->rem_len == 0) {
+            bench_broker_message(br);
+          }
+        }
+        break;
+      }
+      default:
+        i += bench_broker_body(br, &data[i], len - i);
+        if (br->body_idx == br->rem_len) {
+          bench_broker_message(br);
+        }
+        break;
+    }
+  }
+}
+
+static err_t
+bench_broker_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+  struct bench_broker *br = (struct bench_broker *)arg;
+  struct pbuf *q;
+
+  LWIP_UNUSED_ARG(err);
+  if (p == NULL) {
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, NULL);
+    tcp_close(pcb);
+    br->pcb = NULL;
+    return ERR_OK;
+  }
+  for (q = p; q != NULL; q = q->next) {
+    bench_broker_parse(br, (const u8_t *)q->payload, q->len);
+  }
+  tcp_recved(pcb, p->tot_len);
+  pbuf_free(p);
+  tcp_output(pcb);
+  return ERR_OK;
+}
+
+static void
+bench_broker_err(void *arg, err_t err)
+{
+  struct bench_broker *br = (struct bench_broker *)arg;
+
+  LWIP_UNUSED_ARG(err);
+  br->pcb = NULL;
+}
+
+static err_t
+bench_broker_accept(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+  struct bench_broker *br = (struct bench_broker *)arg;
+
+  if ((err != ERR_OK) || (pcb == NULL) || (br->pcb != NULL)) {
+    return ERR_VAL;
+  }
+  br->pcb = pcb;
+  br->state = BENCH_BROKER_FIXED_HDR;
+  tcp_arg(pcb, br);
+  tcp_recv(pcb, bench_broker_recv);
+  tcp_err(pcb, bench_broker_err);
+  tcp_nagle_disable(pcb);
+  return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+/* Publisher */
+
+static void
+bench_pub_connection_cb(mqtt_client_t *client, void *arg, mqtt_connection_status_t status)
+{
+  struct bench_publisher *pub = (struct bench_publisher *)arg;
+
+  LWIP_UNUSED_ARG(client);
+  if (status == MQTT_CONNECT_ACCEPTED) {
+    pub->connected = 1;
+  } else {
+    pub->closed = 1;
+  }
+}
+
+static void
+bench_pub_done(void *arg, err_t err)
+{
+  struct bench_publisher *pub = (struct bench_publisher *)arg;
+
+  pub->outstanding--;
+  if (err == ERR_OK) {
+    pub->completed++;
+  } else {
+    pub->errors++;
+  }
+}
+
+/** Keeps the window full until the deadline, returns 0 if the payload can not be published at all */
+static int
+bench_pub_fill(struct bench_publisher *pub, u64_t now)
+{
+  while ((pub->outstanding < pub->window) && (now < pub->deadline_ns)) {
+    err_t err;
+
+    if (pub->ref) {
+      err = mqtt_publish_ref(pub->client, BENCH_MQTT_TOPIC, pub->payload, pub->size, pub->qos, 0, bench_pub_done, pub);
+    } else if (pub->size <= 0xFFFF) {
+      err = mqtt_publish(pub->client, BENCH_MQTT_TOPIC, pub->payload, (u16_t)pub->size, pub->qos, 0, bench_pub_done, pub);
+    } else {
+      err = ERR_ARG;
+    }
+    if (err == ERR_MEM) {
+      if (pub->outstanding == 0) {
+        /* nothing in flight, the message will never fit */
+        return 0;
+      }
+      break;
+    }
+    if (err != ERR_OK) {
+      return 0;
+    }
+    pub->outstanding++;
+  }
+  return 1;
+}
+
+static void
+bench_publish(u32_t seconds, u32_t size, int ref, u8_t qos, u16_t window, const u8_t *payload)
+{
+  struct mqtt_connect_client_info_t info;
+  u64_t t0, t1, c0, c1, end;
+  int supported = 1;
+  double secs;
+
+  memset(&info, 0, sizeof(info));
+  info.client_id = "lwip_bench";
+  memset(&bench_pub, 0, sizeof(bench_pub));
+  bench_pub.payload = payload;
+  bench_pub.size = size;
+  bench_pub.ref = ref;
+  bench_pub.qos = qos;
+  bench_pub.window = window;
+  bench_pub.client = mqtt_client_new();
+  LWIP_ASSERT("mqtt_client_new failed", bench_pub.client != NULL);
+
+  if (mqtt_client_connect(bench_pub.client, netif_ip_addr4(&netif_b), MQTT_PORT, bench_pub_connection_cb,
+                          &bench_pub, &info) != ERR_OK) {
+    fprintf(stderr, "mqtt: connect failed\n");
+    bench_failures++;
+    mqtt_client_free(bench_pub.client);
+    return;
+  }
+  end = bench_now_ns() + ((u64_t)5U * 1000000000U);
+  while (!bench_pub.connected && !bench_pub.closed && (bench_now_ns() < end)) {
+    pipeif_link_poll(&bench_link);
+    sys_check_timeouts();
+  }
+  if (!bench_pub.connected) {
+    fprintf(stderr, "mqtt: not connected\n");
+    bench_failures++;
+    mqtt_disconnect(bench_pub.client);
+    mqtt_client_free(bench_pub.client);
+    return;
+  }
+
+  altcp_nagle_disable(bench_pub.client->conn);
+
+  pipeif_link_reset_stats(&bench_link);
+  t0 = bench_now_ns();
+  c0 = BENCH_CYCLES();
+  bench_pub.deadline_ns = t0 + ((u64_t)seconds * 1000000000U);
+  end = bench_pub.deadline_ns + ((u64_t)5U * 1000000000U);
+  for (;;) {
+    u64_t now = bench_now_ns();
+
+    if (supported && !bench_pub_fill(&bench_pub, now)) {
+      supported = 0;
+    }
+    if (((now >= bench_pub.deadline_ns) || !supported) && (bench_pub.outstanding == 0)) {
+      break;
+    }
+    if ((now > end) || bench_pub.closed) {
+      fprintf(stderr, "mqtt: %u publishes did not complete\n", (unsigned)bench_pub.outstanding);
+      bench_failures++;
+      break;
+    }
+    pipeif_link_poll(&bench_link);
+    sys_check_timeouts();
+  }
+  t1 = bench_now_ns();
+  c1 = BENCH_CYCLES();
+  if (!supported && (bench_pub.completed == 0)) {
+    fprintf(stderr, "mqtt: %u byte payload can not be published by %s\n", (unsigned)size, ref ? "reference" : "copy");
+  }
+  if (bench_pub.errors != 0) {
+    fprintf(stderr, "mqtt: %u publishes failed\n", (unsigned)bench_pub.errors);
+    bench_failures++;
+  }
+
+  secs = (double)(t1 - t0) / 1e9;
+  printf("%s,%s,%u,%u,%u,%.1f,%.0f,%.2f\n", LWIP_BENCH_CONFIG_NAME, ref ? "ref" : "copy", (unsigned)size,
+         (unsigned)qos, (unsigned)window,
+         (double)bench_pub.completed * size * 8.0 / secs / 1e6, (double)bench_pub.completed / secs,
+         (bench_pub.completed != 0) ? ((double)(c1 - c0) / ((double)bench_pub.completed * size)) : 0.0);
+  fflush(stdout);
+
+  mqtt_disconnect(bench_pub.client);
+  /* let the broker see the FIN and the pcbs go away */
+  end = bench_now_ns() + 100000000U;
+  while (bench_now_ns() < end) {
+    pipeif_link_poll(&bench_link);
+    sys_check_timeouts();
+  }
+  mqtt_client_free(bench_pub.client);
+}
+
+static void
+bench_usage(const char *prog)
+{
+  fprintf(stderr,
+          "usage: %s [-t seconds] [-s size[,size...]] [-w window[,window...]] [-q qos] [-H]\n"
+          "  -s  payload sizes in bytes (default 1024,4096,16384,65536)\n"
+          "  -w  publishes kept in flight, at most %d (default 1,16)\n"
+          "  -q  QoS 0 or 1 (default 1)\n"
+          "  -H  print the CSV header line\n",
+          prog, MQTT_REQ_MAX_IN_FLIGHT);
+}
+
+/** Parses a comma separated list of numbers in [1, max], returns the count or 0 on error */
+static int
+bench_parse_list(const char *str, u32_t *out, int out_len, u32_t max)
+{
+  char *list = strdup(str);
+  char *tok;
+  int n = 0;
+
+  for (tok = strtok(list, ","); tok != NULL; tok = strtok(NULL, ",")) {
+    unsigned long v = strtoul(tok, NULL, 0);
+    if ((n >= out_len) || (v == 0) || (v > max)) {
+      n = 0;
+      break;
+    }
+    out[n++] = (u32_t)v;
+  }
+  free(list);
+  return n;
+}
+
+int
+main(int argc, char **argv)
+{
+  const char *sizes_arg = "1024,4096,16384,65536";
+  const char *windows_arg = "1,16";
+  u32_t sizes[16], windows[16];
+  int num_sizes, num_windows, s, w, ref;
+  struct pipeif_link_config link_config;
+  ip4_addr_t addr, netmask, gw;
+  u32_t seconds = 2;
+  u32_t max_size = 0;
+  u8_t qos = 1;
+  int header = 0;
+  u8_t *payload;
+  int ch;
+
+  while ((ch = getopt(argc, argv, "t:s:w:q:H")) != -1) {
+    switch (ch) {
+      case 't':
+        seconds = (u32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        sizes_arg = optarg;
+        break;
+      case 'w':
+        windows_arg = optarg;
+        break;
+      case 'q':
+        qos = (u8_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'H':
+        header = 1;
+        break;
+      default:
+        bench_usage(argv[0]);
+        return 1;
+    }
+  }
+  num_sizes = bench_parse_list(sizes_arg, sizes, LWIP_ARRAYSIZE(sizes), 16U * 1024U * 1024U);
+  num_windows = bench_parse_list(windows_arg, windows, LWIP_ARRAYSIZE(windows), MQTT_REQ_MAX_IN_FLIGHT);
+  if ((seconds == 0) || (qos > 1) || (num_sizes == 0) || (num_windows == 0)) {
+    bench_usage(argv[0]);
+    return 1;
+  }
+  for (s = 0; s < num_sizes; s++) {
+    max_size = LWIP_MAX(max_size, sizes[s]);
+  }
+  payload = (u8_t *)malloc(max_size);
+  LWIP_ASSERT("out of memory", payload != NULL);
+  memset(payload, 0x5A, max_size);
+
+  lwip_init();
+
+  link_config.mtu = 1500;
+  link_config.latency_us = 0;
+  link_config.loss_ppm = 0;
+  link_config.seed = 1;
+  pipeif_link_init(&bench_link, &link_config);
+
+  IP4_ADDR(&netmask, 255, 255, 255, 0);
+  ip4_addr_set_zero(&gw);
+  IP4_ADDR(&addr, 10, 0, 0, 1);
+  netif_add(&netif_a, &addr, &netmask, &gw, &bench_link.end[0], pipeif_init, ethernet_input);
+  IP4_ADDR(&addr, 10, 0, 0, 2);
+  netif_add(&netif_b, &addr, &netmask, &gw, &bench_link.end[1], pipeif_init, ethernet_input);
+  netif_set_up(&netif_a);
+  netif_set_up(&netif_b);
+
+  memset(&bench_broker_state, 0, sizeof(bench_broker_state));
+  bench_broker_state.listen_pcb = tcp_new_ip_type(IPADDR_TYPE_V4);
+  LWIP_ASSERT("tcp_new failed", bench_broker_state.listen_pcb != NULL);
+  tcp_bind(bench_broker_state.listen_pcb, netif_ip_addr4(&netif_b), MQTT_PORT);
+  bench_broker_state.listen_pcb = tcp_listen(bench_broker_state.listen_pcb);
+  LWIP_ASSERT("tcp_listen failed", bench_broker_state.listen_pcb != NULL);
+  tcp_arg(bench_broker_state.listen_pcb, &bench_broker_state);
+  tcp_accept(bench_broker_state.listen_pcb, bench_broker_accept);
+
+  if (header) {
+    printf("config,test,payload,qos,window,mbit_s,publish_s,%s_per_byte\n", BENCH_CYCLES_UNIT);
+  }
+
+  for (s = 0; s < num_sizes; s++) {
+    for (w = 0; w < num_windows; w++) {
+      for (ref = 0; ref <= 1; ref++) {
+        bench_publish(seconds, sizes[s], ref, qos, (u16_t)windows[w], payload);
+      }
+    }
+  }
+
+  free(payload);
+  return (bench_failures != 0) ? 1 : 0;
+}
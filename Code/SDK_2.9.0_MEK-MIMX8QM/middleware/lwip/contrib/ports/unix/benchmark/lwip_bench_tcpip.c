@@ -0,0 +1,257 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Packet rate of the receive handoff to the tcpip thread.
+ *
+ * The main thread plays the role of an ethernet driver: it allocates small
+ * frames from the pbuf pool and passes them to the tcpip thread, either one
+ * message per frame (tcpip_inpkt(), batch 1) or several frames per message
+ * (tcpip_inpkt_batch()). The input function only touches and frees the
+ * frame, so the result is the cost of the message allocation, the mailbox
+ * and the thread wakeups. Frames which cannot be handed over (pool or mailbox
+ * exhausted) are dropped and counted, like a driver would.
+ */
+
+#include <sched.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "lwip/opt.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "lwip/tcpip.h"
+
+#if NO_SYS
+#error "lwip_bench_tcpip needs NO_SYS == 0"
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_CYCLES() ((u64_t)__rdtsc())
+#define BENCH_CYCLES_UNIT "cycles"
+#else
+#define BENCH_CYCLES() bench_now_ns()
+#define BENCH_CYCLES_UNIT "ns"
+#endif
+
+#ifndef LWIP_BENCH_CONFIG_NAME
+#define LWIP_BENCH_CONFIG_NAME "default"
+#endif
+
+#define BENCH_FRAME_LEN 64
+
+static struct netif bench_netif;
+/* written by the tcpip thread only */
+static volatile u32_t bench_delivered;
+static volatile u32_t bench_touched;
+
+static u64_t
+bench_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((u64_t)ts.tv_sec * 1000000000U) + (u64_t)ts.tv_nsec;
+}
+
+void
+lwip_bench_diag(const char *format, ...)
+{
+  va_list ap;
+
+  va_start(ap, format);
+  vfprintf(stderr, format, ap);
+  va_end(ap);
+}
+
+/* referenced by lwipopts.h, this program only has one netif */
+struct netif *
+lwip_bench_route(const ip4_addr_t *src, const ip4_addr_t *dest)
+{
+  LWIP_UNUSED_ARG(src);
+  LWIP_UNUSED_ARG(dest);
+  return NULL;
+}
+
+static err_t
+bench_input(struct pbuf *p, struct netif *inp)
+{
+  LWIP_UNUSED_ARG(inp);
+  bench_touched += ((const u8_t *)p->payload)[0];
+  bench_delivered++;
+  pbuf_free(p);
+  return ERR_OK;
+}
+
+static err_t
+bench_netif_init(struct netif *netif)
+{
+  netif->name[0] = 'b';
+  netif->name[1] = 'n';
+  netif->mtu = 1500;
+  return ERR_OK;
+}
+
+static void
+bench_init_done(void *arg)
+{
+  sys_sem_signal((sys_sem_t *)arg);
+}
+
+static void
+bench_sync_done(void *arg)
+{
+  sys_sem_signal((sys_sem_t *)arg);
+}
+
+/** Waits until the tcpip thread processed everything posted before */
+static void
+bench_sync(void)
+{
+  sys_sem_t sem;
+
+  sys_sem_new(&sem, 0);
+  tcpip_callback(bench_sync_done, &sem);
+  sys_arch_sem_wait(&sem, 0);
+  sys_sem_free(&sem);
+}
+
+static void
+bench_handoff(u32_t seconds, u16_t batch_len)
+{
+  struct tcpip_inpkt_batch batch;
+  u64_t dropped = 0;
+  u64_t t0, t1, c0, c1, end;
+  u32_t delivered;
+  double secs;
+
+  tcpip_inpkt_batch_init(&batch);
+  bench_sync();
+  bench_delivered = 0;
+
+  t0 = bench_now_ns();
+  c0 = BENCH_CYCLES();
+  end = t0 + ((u64_t)seconds * 1000000000U);
+  while (bench_now_ns() < end) {
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, BENCH_FRAME_LEN, PBUF_POOL);
+    if (p == NULL) {
+      /* pool exhausted, the tcpip thread is behind */
+      dropped++;
+      sched_yield();
+      continue;
+    }
+    memset(p->payload, 0x5A, BENCH_FRAME_LEN);
+
+    if (batch_len <= 1) {
+      if (tcpip_inpkt(p, &bench_netif, bench_input) != ERR_OK) {
+        pbuf_free(p);
+        dropped++;
+        sched_yield();
+      }
+      continue;
+    }
+
+    tcpip_inpkt_batch_add(&batch, p);
+    if (batch.count >= batch_len) {
+      u16_t count = batch.count;
+      if (tcpip_inpkt_batch(&batch, &bench_netif, bench_input) != ERR_OK) {
+        tcpip_inpkt_batch_free(&batch);
+        dropped += count;
+        sched_yield();
+      }
+    }
+  }
+  if ((batch.count != 0) && (tcpip_inpkt_batch(&batch, &bench_netif, bench_input) != ERR_OK)) {
+    dropped += batch.count;
+    tcpip_inpkt_batch_free(&batch);
+  }
+  bench_sync();
+  t1 = bench_now_ns();
+  c1 = BENCH_CYCLES();
+  delivered = bench_delivered;
+
+  secs = (double)(t1 - t0) / 1e9;
+  printf("%s,tcpip_input,%u,%.0f,%.0f,%.1f\n", LWIP_BENCH_CONFIG_NAME, (unsigned)batch_len,
+         (double)delivered / secs, (double)dropped / secs,
+         (delivered != 0) ? ((double)(c1 - c0) / (double)delivered) : 0.0);
+  fflush(stdout);
+}
+
+static void
+bench_usage(const char *prog)
+{
+  fprintf(stderr,
+          "usage: %s [-t seconds] [-b batch[,batch...]] [-H]\n"
+          "  -b  frames per tcpip message, 1 uses tcpip_inpkt() (default 1,4,16,64)\n"
+          "  -H  print the CSV header line\n",
+          prog);
+}
+
+int
+main(int argc, char **argv)
+{
+  const char *batches = "1,4,16,64";
+  u32_t seconds = 2;
+  int header = 0;
+  sys_sem_t sem;
+  char *list, *tok;
+  int ch;
+
+  while ((ch = getopt(argc, argv, "t:b:H")) != -1) {
+    switch (ch) {
+      case 't':
+        seconds = (u32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'b':
+        batches = optarg;
+        break;
+      case 'H':
+        header = 1;
+        break;
+      default:
+        bench_usage(argv[0]);
+        return 1;
+    }
+  }
+  if (seconds == 0) {
+    bench_usage(argv[0]);
+    return 1;
+  }
+
+  sys_sem_new(&sem, 0);
+  tcpip_init(bench_init_done, &sem);
+  sys_arch_sem_wait(&sem, 0);
+  sys_sem_free(&sem);
+
+  LOCK_TCPIP_CORE();
+  netif_add_noaddr(&bench_netif, NULL, bench_netif_init, tcpip_input);
+  UNLOCK_TCPIP_CORE();
+
+  if (header) {
+    printf("config,test,batch,packets_s,dropped_s,%s_per_packet\n", BENCH_CYCLES_UNIT);
+  }
+
+  list = strdup(batches);
+  for (tok = strtok(list, ","); tok != NULL; tok = strtok(NULL, ",")) {
+    unsigned long b = strtoul(tok, NULL, 0);
+    if ((b == 0) || (b > 0xFFFF)) {
+      bench_usage(argv[0]);
+      free(list);
+      return 1;
+    }
+    bench_handoff(seconds, (u16_t)b);
+  }
+  free(list);
+
+  return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#ifndef LWIP_LWIPOPTS_H
+#define LWIP_LWIPOPTS_H
+
+/*
+ * Options of the in-process benchmark (lwip_bench). Everything guarded by
+ * #ifndef is a parameter of the benchmark matrix and can be overridden from
+ * the compiler command line, see LWIP_BENCH_CONFIGS in CMakeLists.txt.
+ */
+
+/* Single threaded: the benchmark main loop drives the pipe link and the timers.
+ * lwip_bench_tcpip is built with NO_SYS=0 to measure the tcpip thread handoff. */
+#ifndef NO_SYS
+#define NO_SYS                          1
+#endif
+#define SYS_LIGHTWEIGHT_PROT            (NO_SYS == 0)
+#define TCPIP_MBOX_SIZE                 128
+#define LWIP_TIMERS                     1
+#define LWIP_NETCONN                    0
+#define LWIP_SOCKET                     0
+
+#ifndef LWIP_BENCH_ASSERT
+#define LWIP_NOASSERT
+#endif
+
+/* lwiperf reports its progress through LWIP_PLATFORM_DIAG, keep it off the CSV on stdout */
+void lwip_bench_diag(const char *format, ...);
+#undef LWIP_PLATFORM_DIAG
+#define LWIP_PLATFORM_DIAG(x) do { lwip_bench_diag x; } while (0)
+
+/*
+   ------------------------------------
+   ---------- Memory options ----------
+   ------------------------------------
+*/
+#define MEM_ALIGNMENT                   8U
+
+#ifndef MEM_SIZE
+#define MEM_SIZE                        (512 * 1024)
+#endif
+
+#define MEMP_NUM_PBUF                   256
+#define MEMP_NUM_UDP_PCB                8
+#define MEMP_NUM_TCP_PCB                8
+#define MEMP_NUM_TCP_PCB_LISTEN         4
+#define MEMP_NUM_REASSDATA              4
+#define MEMP_NUM_ARP_QUEUE              16
+#define MEMP_NUM_SYS_TIMEOUT            16
+
+#ifndef MEMP_NUM_TCPIP_MSG_INPKT
+#define MEMP_NUM_TCPIP_MSG_INPKT        128
+#endif
+
+/**
+ * PBUF_POOL_SIZE: the number of buffers in the pbuf pool.
+ * The pipe link receives every frame into the pool.
+ */
+#ifndef PBUF_POOL_SIZE
+#define PBUF_POOL_SIZE                  64
+#endif
+
+#ifndef PBUF_POOL_BUFSIZE
+#define PBUF_POOL_BUFSIZE               LWIP_MEM_ALIGN_SIZE(TCP_MSS + 40 + PBUF_LINK_ENCAPSULATION_HLEN + PBUF_LINK_HLEN)
+#endif
+
+/*
+   ---------------------------------
+   ---------- IP options -----------
+   ---------------------------------
+*/
+#define LWIP_ARP                        1
+#define LWIP_ETHERNET                   1
+#define LWIP_IPV4                       1
+#define LWIP_IPV6                       0
+#define IP_FORWARD                      0
+#define IP_REASSEMBLY                   1
+#define IP_FRAG                         1
+#define LWIP_ICMP                       1
+#define LWIP_RAW                        0
+#define LWIP_DHCP                       0
+#define LWIP_AUTOIP                     0
+#define LWIP_IGMP                       0
+#define LWIP_DNS                        0
+
+/*
+ * Both ends of the pipe link live in this stack and share one subnet, so the
+ * outgoing netif is chosen by the source address of a connection (or, for an
+ * unbound one, as the netif not owning the destination). Without this every
+ * packet would be routed to the destination netif itself and never cross the link.
+ */
+struct netif;
+struct ip4_addr;
+struct netif *lwip_bench_route(const struct ip4_addr *src, const struct ip4_addr *dest);
+#define LWIP_HOOK_IP4_ROUTE_SRC(src, dest) lwip_bench_route(src, dest)
+
+/*
+   ---------------------------------
+   ---------- TCP options ----------
+   ---------------------------------
+*/
+#define LWIP_TCP                        1
+#define LWIP_UDP                        1
+
+#ifndef TCP_MSS
+#define TCP_MSS                         1460
+#endif
+
+#ifndef TCP_WND
+#define TCP_WND                         (16 * TCP_MSS)
+#endif
+
+#ifndef TCP_SND_BUF
+#define TCP_SND_BUF                     (16 * TCP_MSS)
+#endif
+
+#define TCP_SND_QUEUELEN                ((4 * (TCP_SND_BUF) + (TCP_MSS - 1)) / (TCP_MSS))
+#define MEMP_NUM_TCP_SEG                (2 * TCP_SND_QUEUELEN)
+#define LWIP_WND_SCALE                  1
+#define TCP_RCV_SCALE                   2
+#define TCP_QUEUE_OOSEQ                 1
+#define LWIP_TCP_SACK_OUT               0
+
+/*
+   ---------------------------------------
+   ---------- Checksum options -----------
+   ---------------------------------------
+*/
+/* LWIP_BENCH_CHECKSUM_OFFLOAD models a MAC computing and checking checksums */
+#ifdef LWIP_BENCH_CHECKSUM_OFFLOAD
+#define CHECKSUM_GEN_IP                 0
+#define CHECKSUM_GEN_UDP                0
+#define CHECKSUM_GEN_TCP                0
+#define CHECKSUM_GEN_ICMP               0
+#define CHECKSUM_CHECK_IP               0
+#define CHECKSUM_CHECK_UDP              0
+#define CHECKSUM_CHECK_TCP              0
+#define CHECKSUM_CHECK_ICMP             0
+#endif
+
+/* LWIP_CHECKSUM_ON_COPY computes the checksum while copying data into the send buffer */
+#ifndef LWIP_CHECKSUM_ON_COPY
+#define LWIP_CHECKSUM_ON_COPY           0
+#endif
+
+/*
+   ---------------------------------------
+   ---------- Statistics options ---------
+   ---------------------------------------
+*/
+#define LWIP_STATS                      0
+#define MIB2_STATS                      0
+
+/* Data pattern checking would add its own cost to every received byte */
+#define LWIPERF_CHECK_RX_DATA           0
+
+/*
+   ---------------------------------------
+   ---------- MQTT options ---------------
+   ---------------------------------------
+*/
+/* lwip_bench_mqtt: copied publishes up to 16 KB, up to 64 publishes in flight */
+#ifndef MQTT_OUTPUT_RINGBUF_SIZE
+#define MQTT_OUTPUT_RINGBUF_SIZE        (32 * 1024)
+#endif
+#ifndef MQTT_REQ_MAX_IN_FLIGHT
+#define MQTT_REQ_MAX_IN_FLIGHT          64
+#endif
+
+#endif /* LWIP_LWIPOPTS_H */
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LWIP_PIPEIF_H
+#define LWIP_PIPEIF_H
+
+#include "lwip/netif.h"
+
+/*
+ * In-memory ethernet link connecting two netifs of the same process.
+ * Frames written by one end are copied into pool pbufs (like a NIC would DMA
+ * them) and handed to the peer's input function by pipeif_link_poll() once
+ * the configured latency has elapsed. Frames can be dropped at random to
+ * emulate a lossy link. Intended for NO_SYS == 1 single threaded use.
+ */
+
+#ifndef PIPEIF_QUEUE_LEN
+#define PIPEIF_QUEUE_LEN 512
+#endif
+
+struct pipeif_link_config {
+  /** MTU of both netifs (IP layer, ethernet header not included) */
+  u16_t mtu;
+  /** one way delay of every frame in microseconds */
+  u32_t latency_us;
+  /** frame loss probability in parts per million */
+  u32_t loss_ppm;
+  /** seed of the loss generator, runs with the same seed drop the same frames */
+  u32_t seed;
+};
+
+struct pipeif_frame {
+  struct pbuf *p;
+  u64_t due_us;
+};
+
+/** One direction of the link: frames sent by netif, received by the peer */
+struct pipeif_end {
+  struct pipeif_link *link;
+  struct netif *netif;
+  struct pipeif_end *peer;
+  struct pipeif_frame queue[PIPEIF_QUEUE_LEN];
+  u16_t head;
+  u16_t count;
+  /* statistics */
+  u32_t tx_frames;
+  u64_t tx_bytes;
+  u32_t dropped_loss;
+  u32_t dropped_full;
+};
+
+struct pipeif_link {
+  struct pipeif_link_config config;
+  struct pipeif_end end[2];
+  u32_t rand_state;
+};
+
+void pipeif_link_init(struct pipeif_link *link, const struct pipeif_link_config *config);
+/** netif_add() init function, state has to point to link->end[0] or link->end[1] */
+err_t pipeif_init(struct netif *netif);
+/** Delivers frames which are due, returns the number of frames delivered */
+u32_t pipeif_link_poll(struct pipeif_link *link);
+/** Returns the number of frames in flight in both directions */
+u32_t pipeif_link_pending(const struct pipeif_link *link);
+void pipeif_link_reset_stats(struct pipeif_link *link);
+
+#endif /* LWIP_PIPEIF_H */
@@ -0,0 +1,196 @@
+/*
+ * Copyright 2020 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "lwip/opt.h"
+
+#include "lwip/def.h"
+#include "lwip/pbuf.h"
+#include "lwip/snmp.h"
+#include "lwip/stats.h"
+#include "netif/etharp.h"
+#include "lwip/ethip6.h"
+
+#include "netif/pipeif.h"
+
+/* Define those to better describe your network interface. */
+#define IFNAME0 'p'
+#define IFNAME1 'i'
+
+#ifndef PIPEIF_DEBUG
+#define PIPEIF_DEBUG LWIP_DBG_OFF
+#endif
+
+static u64_t
+pipeif_now_us(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((u64_t)ts.tv_sec * 1000000U) + ((u64_t)ts.tv_nsec / 1000U);
+}
+
+/* xorshift32, good enough to spread drops and independent of rand() users */
+static u32_t
+pipeif_rand(struct pipeif_link *link)
+{
+  u32_t x = link->rand_state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  link->rand_state = x;
+  return x;
+}
+
+/*-----------------------------------------------------------------------------------*/
+static err_t
+pipeif_linkoutput(struct netif *netif, struct pbuf *p)
+{
+  struct pipeif_end *end = (struct pipeif_end *)netif->state;
+  struct pipeif_link *link = end->link;
+  struct pbuf *q;
+  u16_t tail;
+
+  end->tx_frames++;
+  end->tx_bytes += p->tot_len;
+  MIB2_STATS_NETIF_ADD(netif, ifoutoctets, p->tot_len);
+  LINK_STATS_INC(link.xmit);
+
+  if ((link->config.loss_ppm != 0) && ((pipeif_rand(link) % 1000000U) < link->config.loss_ppm)) {
+    LWIP_DEBUGF(PIPEIF_DEBUG, ("pipeif_linkoutput: frame lost\n"));
+    end->dropped_loss++;
+    return ERR_OK;
+  }
+  if (end->count >= PIPEIF_QUEUE_LEN) {
+    LWIP_DEBUGF(PIPEIF_DEBUG, ("pipeif_linkoutput: queue full\n"));
+    end->dropped_full++;
+    LINK_STATS_INC(link.drop);
+    return ERR_OK;
+  }
+
+  /* The receiving side gets its own copy in pool memory, as with a real MAC. */
+  q = pbuf_alloc(PBUF_RAW, p->tot_len, PBUF_POOL);
+  if (q == NULL) {
+    end->dropped_full++;
+    LINK_STATS_INC(link.memerr);
+    return ERR_OK;
+  }
+  pbuf_copy(q, p);
+
+  tail = (u16_t)((end->head + end->count) % PIPEIF_QUEUE_LEN);
+  end->queue[tail].p = q;
+  end->queue[tail].due_us = pipeif_now_us() + link->config.latency_us;
+  end->count++;
+
+  return ERR_OK;
+}
+
+/*-----------------------------------------------------------------------------------*/
+static u32_t
+pipeif_end_poll(struct pipeif_end *end, u64_t now)
+{
+  struct netif *dst = end->peer->netif;
+  u32_t delivered = 0;
+
+  while ((end->count != 0) && (end->queue[end->head].due_us <= now)) {
+    struct pbuf *p = end->queue[end->head].p;
+
+    end->queue[end->head].p = NULL;
+    end->head = (u16_t)((end->head + 1) % PIPEIF_QUEUE_LEN);
+    end->count--;
+    delivered++;
+
+    MIB2_STATS_NETIF_ADD(dst, ifinoctets, p->tot_len);
+    LINK_STATS_INC(link.recv);
+    if (dst->input(p, dst) != ERR_OK) {
+      LWIP_DEBUGF(NETIF_DEBUG, ("pipeif_end_poll: input error\n"));
+      pbuf_free(p);
+    }
+  }
+
+  return delivered;
+}
+
+u32_t
+pipeif_link_poll(struct pipeif_link *link)
+{
+  u64_t now = pipeif_now_us();
+
+  return pipeif_end_poll(&link->end[0], now) + pipeif_end_poll(&link->end[1], now);
+}
+
+u32_t
+pipeif_link_pending(const struct pipeif_link *link)
+{
+  return (u32_t)link->end[0].count + link->end[1].count;
+}
+
+void
+pipeif_link_reset_stats(struct pipeif_link *link)
+{
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    link->end[i].tx_frames = 0;
+    link->end[i].tx_bytes = 0;
+    link->end[i].dropped_loss = 0;
+    link->end[i].dropped_full = 0;
+  }
+}
+
+void
+pipeif_link_init(struct pipeif_link *link, const struct pipeif_link_config *config)
+{
+  memset(link, 0, sizeof(*link));
+  link->config = *config;
+  link->rand_state = (config->seed != 0) ? config->seed : 0x2545F491U;
+  link->end[0].link = link;
+  link->end[0].peer = &link->end[1];
+  link->end[1].link = link;
+  link->end[1].peer = &link->end[0];
+}
+
+/*-----------------------------------------------------------------------------------*/
+err_t
+pipeif_init(struct netif *netif)
+{
+  struct pipeif_end *end = (struct pipeif_end *)netif->state;
+
+  LWIP_ASSERT("netif->state != NULL", (end != NULL));
+  LWIP_ASSERT("pipeif_link_init() not called", (end->link != NULL));
+
+  end->netif = netif;
+
+  MIB2_INIT_NETIF(netif, snmp_ifType_ethernet_csmacd, 1000000000);
+
+  netif->name[0] = IFNAME0;
+  netif->name[1] = IFNAME1;
+#if LWIP_IPV4
+  netif->output = etharp_output;
+#endif /* LWIP_IPV4 */
+#if LWIP_IPV6
+  netif->output_ip6 = ethip6_output;
+#endif /* LWIP_IPV6 */
+  netif->linkoutput = pipeif_linkoutput;
+  netif->mtu = end->link->config.mtu;
+
+  /* locally administered address, the last byte tells the two ends apart */
+  netif->hwaddr_len = ETH_HWADDR_LEN;
+  netif->hwaddr[0] = 0x02;
+  netif->hwaddr[1] = 0x00;
+  netif->hwaddr[2] = 0x00;
+  netif->hwaddr[3] = 0x00;
+  netif->hwaddr[4] = 0x00;
+  netif->hwaddr[5] = (end == &end->link->end[0]) ? 0x01 : 0x02;
+
+  netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET | NETIF_FLAG_IGMP |
+                 NETIF_FLAG_MLD6 | NETIF_FLAG_LINK_UP;
+
+  return ERR_OK;
+}
@@ -54,13 +54,30 @@
 
 #endif
 
+/* SYS_ARCH_RING_MBOX: 1 implements mailboxes as a ring of message pointers
+ * guarded by a short critical section instead of a FreeRTOS queue. Posting
+ * only involves the kernel when the reader is blocked on an empty mailbox,
+ * which makes a busy tcpip thread cheaper to feed. Mailboxes must have a
+ * single reader, as all lwIP mailboxes do. */
+#ifndef SYS_ARCH_RING_MBOX
+#define SYS_ARCH_RING_MBOX              0
+#endif
+
+#if SYS_ARCH_RING_MBOX
+#define SYS_MBOX_NULL					( NULL )
+#else
 #define SYS_MBOX_NULL					( ( QueueHandle_t ) NULL )
+#endif
 #define SYS_SEM_NULL					( ( SemaphoreHandle_t ) NULL )
 #define SYS_DEFAULT_THREAD_STACK_DEPTH	configMINIMAL_STACK_SIZE
 #if !NO_SYS
 typedef SemaphoreHandle_t sys_sem_t;
 typedef SemaphoreHandle_t sys_mutex_t;
+#if SYS_ARCH_RING_MBOX
+typedef struct sys_mbox_ring *sys_mbox_t;
+#else
 typedef QueueHandle_t sys_mbox_t;
+#endif
 typedef TaskHandle_t sys_thread_t;
 
 #define sys_mbox_valid( x ) ( ( ( *x ) == NULL) ? pdFALSE : pdTRUE )
@@ -49,6 +49,9 @@
 #include "netif/ppp/pppoe.h"
 #include "lwip/igmp.h"
 #include "lwip/mld6.h"
+#if !NO_SYS
+#include "lwip/tcpip.h"
+#endif
 
 #if USE_RTOS && defined(FSL_RTOS_FREE_RTOS)
 #include "FreeRTOS.h"
@@ -142,6 +145,34 @@ void ethernetif_input(struct netif *netif)
 
     LWIP_ASSERT("netif != NULL", (netif != NULL));
 
+#if !NO_SYS && ETHERNETIF_RX_BATCH
+    if (netif->input == tcpip_input)
+    {
+        struct tcpip_inpkt_batch batch;
+
+        /* hand all frames received so far to the tcpip thread in one message */
+        tcpip_inpkt_batch_init(&batch);
+        while ((p = ethernetif_linkinput(netif)) != NULL)
+        {
+            tcpip_inpkt_batch_add(&batch, p);
+            if (batch.count >= ETHERNETIF_RX_BATCH)
+            {
+                if (tcpip_input_batch(&batch, netif) != ERR_OK)
+                {
+                    LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: tcpip mbox full\n"));
+                    tcpip_inpkt_batch_free(&batch);
+                }
+            }
+        }
+        if ((batch.count != 0U) && (tcpip_input_batch(&batch, netif) != ERR_OK))
+        {
+            LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: tcpip mbox full\n"));
+            tcpip_inpkt_batch_free(&batch);
+        }
+        return;
+    }
+#endif /* !NO_SYS && ETHERNETIF_RX_BATCH */
+
     /* move received packet into a new pbuf */
     while ((p = ethernetif_linkinput(netif)) != NULL)
     {
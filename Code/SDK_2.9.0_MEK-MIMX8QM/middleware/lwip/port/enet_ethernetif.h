@@ -79,7 +79,34 @@
 #define IFNAME0 'e'
 #define IFNAME1 'n'
 
-#define ENET_RING_NUM 1U
+/* Number of ENET TX/RX rings used by the interface.
+ * Values above 1 require FSL_FEATURE_ENET_QUEUE > 1 and the enhanced buffer
+ * descriptor mode (ENET_ENHANCEDBUFFERDESCRIPTOR_MODE). */
+#ifndef ENET_RING_NUM
+    #define ENET_RING_NUM 1U
+#endif
+
+/* Maps the 802.1p priority (VLAN PCP, or DSCP class selector DSCP >> 3 for
+ * untagged IP frames) 0..7 to the ENET ring index used for transmission.
+ * The same table programs the receive classification of rings 1 and 2, each
+ * of which can match at most four VLAN priorities.
+ * Higher ring index means higher priority when receive rings are serviced. */
+#ifndef ENET_PCP_TO_RING_MAP
+#if ENET_RING_NUM > 2U
+    #define ENET_PCP_TO_RING_MAP {0U, 0U, 0U, 0U, 1U, 1U, 2U, 2U}
+#elif ENET_RING_NUM > 1U
+    #define ENET_PCP_TO_RING_MAP {0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U}
+#else
+    #define ENET_PCP_TO_RING_MAP {0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U}
+#endif
+#endif
+
+/* Maximum number of received frames passed to the tcpip thread in one message
+ * (tcpip_input_batch()) when netif->input is tcpip_input. 0 posts every frame
+ * separately through netif->input. */
+#ifndef ETHERNETIF_RX_BATCH
+    #define ETHERNETIF_RX_BATCH 8U
+#endif
 
 #if (defined(FSL_FEATURE_SOC_LPC_ENET_COUNT) && (FSL_FEATURE_SOC_LPC_ENET_COUNT > 0))
 typedef struct mem_range
@@ -70,6 +70,15 @@
 #error "ETH_PAD_SIZE != 0"
 #endif /* ETH_PAD_SIZE != 0 */
 
+#if ENET_RING_NUM > 1U
+#if !(FSL_FEATURE_ENET_QUEUE > 1) || (ENET_RING_NUM > FSL_FEATURE_ENET_QUEUE)
+#error "ENET_RING_NUM exceeds the number of rings supported by the ENET"
+#endif
+#ifndef ENET_ENHANCEDBUFFERDESCRIPTOR_MODE
+#error "ENET_RING_NUM > 1 requires ENET_ENHANCEDBUFFERDESCRIPTOR_MODE"
+#endif
+#endif /* ENET_RING_NUM > 1U */
+
 /*******************************************************************************
  * Definitions
  ******************************************************************************/
@@ -111,6 +120,12 @@
 typedef uint8_t rx_buffer_t[SDK_SIZEALIGN(ENET_RXBUFF_SIZE, FSL_ENET_BUFF_ALIGNMENT)];
 typedef uint8_t tx_buffer_t[SDK_SIZEALIGN(ENET_TXBUFF_SIZE, FSL_ENET_BUFF_ALIGNMENT)];
 
+/* Descriptor count between the starts of two consecutive rings, so that every ring starts aligned. */
+#define ENET_RXBD_RING_STRIDE \
+    (SDK_SIZEALIGN(ENET_RXBD_NUM * sizeof(enet_rx_bd_struct_t), FSL_ENET_BUFF_ALIGNMENT) / sizeof(enet_rx_bd_struct_t))
+#define ENET_TXBD_RING_STRIDE \
+    (SDK_SIZEALIGN(ENET_TXBD_NUM * sizeof(enet_tx_bd_struct_t), FSL_ENET_BUFF_ALIGNMENT) / sizeof(enet_tx_bd_struct_t))
+
 /*!
  * @brief Used to wrap received data in a pbuf to be passed into lwIP
  *        without copying.
@@ -121,6 +136,7 @@ typedef struct rx_pbuf_wrapper
     struct pbuf_custom p;          /*!< Pbuf wrapper. Has to be first. */
     void *buffer;                  /*!< Original buffer wrapped by p. */
     struct ethernetif *ethernetif; /*!< Ethernet interface context data. */
+    uint8_t ringId;                /*!< Ring the buffer belongs to. */
 } rx_pbuf_wrapper_t;
 
 /**
@@ -137,13 +153,16 @@ struct ethernetif
     EventGroupHandle_t enetTransmitAccessEvent;
     EventBits_t txFlag;
 #endif
-    enet_rx_bd_struct_t *RxBuffDescrip;
-    enet_tx_bd_struct_t *TxBuffDescrip;
-    rx_buffer_t *RxDataBuff;
-    tx_buffer_t *TxDataBuff;
-    rx_pbuf_wrapper_t RxPbufs[ENET_RXBD_NUM];
+    enet_rx_bd_struct_t *RxBuffDescrip; /* ENET_RING_NUM rings, ENET_RXBD_RING_STRIDE apart */
+    enet_tx_bd_struct_t *TxBuffDescrip; /* ENET_RING_NUM rings, ENET_TXBD_RING_STRIDE apart */
+    rx_buffer_t *RxDataBuff;            /* ENET_RING_NUM * ENET_RXBD_NUM buffers */
+    tx_buffer_t *TxDataBuff;            /* ENET_RING_NUM * ENET_TXBD_NUM buffers */
+    rx_pbuf_wrapper_t RxPbufs[ENET_RING_NUM][ENET_RXBD_NUM];
 };
 
+/* Transmit ring selected by 802.1p priority. */
+static const uint8_t s_pcpToRing[8] = ENET_PCP_TO_RING_MAP;
+
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
@@ -176,6 +195,11 @@ static void ethernet_callback(ENET_Type *base,
         case kENET_TxEvent:
         {
             portBASE_TYPE taskToWake = pdFALSE;
+#if FSL_FEATURE_ENET_QUEUE > 1
+            EventBits_t txFlag = ethernetif->txFlag << ringId;
+#else
+            EventBits_t txFlag = ethernetif->txFlag;
+#endif /* FSL_FEATURE_ENET_QUEUE */
 
 #ifdef __CA7_REV
             if (SystemGetIRQNestingLevel())
@@ -183,7 +207,7 @@ static void ethernet_callback(ENET_Type *base,
             if (__get_IPSR())
 #endif 
             {
-                xResult = xEventGroupSetBitsFromISR(ethernetif->enetTransmitAccessEvent, ethernetif->txFlag, &taskToWake);
+                xResult = xEventGroupSetBitsFromISR(ethernetif->enetTransmitAccessEvent, txFlag, &taskToWake);
                 if ((pdPASS == xResult) && (pdTRUE == taskToWake))
                 {
                     portYIELD_FROM_ISR(taskToWake);
@@ -191,7 +215,7 @@ static void ethernet_callback(ENET_Type *base,
             }
             else
             {
-                xEventGroupSetBits(ethernetif->enetTransmitAccessEvent, ethernetif->txFlag);
+                xEventGroupSetBits(ethernetif->enetTransmitAccessEvent, txFlag);
             }
         }
         break;
@@ -281,6 +305,45 @@ err_t ethernetif_mld_mac_filter(struct netif *netif, const ip6_addr_t *group,
 }
 #endif
 
+#if ENET_RING_NUM > 1U
+/**
+ * Programs the receive classification of rings 1..ENET_RING_NUM-1 so that
+ * VLAN tagged frames land in the same ring their priority is sent from.
+ * Untagged frames and unmatched priorities are received into ring 0.
+ */
+static void ethernetif_rx_classify_init(ENET_Type *base)
+{
+    uint32_t ring;
+    uint32_t pcp;
+
+    for (ring = 1U; ring < ENET_RING_NUM; ring++)
+    {
+        uint32_t match = 0U;
+        uint32_t count = 0U;
+
+        for (pcp = 0U; pcp < ARRAY_SIZE(s_pcpToRing); pcp++)
+        {
+            if (s_pcpToRing[pcp] == ring)
+            {
+                LWIP_ASSERT("At most four VLAN priorities can be mapped to one ring", count < 4U);
+                match |= pcp << (4U * count);
+                count++;
+            }
+        }
+
+        if (count != 0U)
+        {
+            /* Unused compare fields have to repeat the first one. */
+            for (; count < 4U; count++)
+            {
+                match |= (match & 0x7U) << (4U * count);
+            }
+            base->RCMR[ring - 1U] = match | ENET_RCMR_MATCHEN_MASK;
+        }
+    }
+}
+#endif /* ENET_RING_NUM > 1U */
+
 /**
  * Initializes ENET driver.
  */
@@ -292,20 +355,24 @@ void ethernetif_enet_init(struct netif *netif, struct ethernetif *ethernetif,
     enet_buffer_config_t buffCfg[ENET_RING_NUM];
     phy_speed_t speed;
     phy_duplex_t duplex;
+    uint32_t ring;
     int i;
 
     /* prepare the buffer configuration. */
-    buffCfg[0].rxBdNumber = ENET_RXBD_NUM;                      /* Receive buffer descriptor number. */
-    buffCfg[0].txBdNumber = ENET_TXBD_NUM;                      /* Transmit buffer descriptor number. */
-    buffCfg[0].rxBuffSizeAlign = sizeof(rx_buffer_t);           /* Aligned receive data buffer size. */
-    buffCfg[0].txBuffSizeAlign = sizeof(tx_buffer_t);           /* Aligned transmit data buffer size. */
-    buffCfg[0].rxBdStartAddrAlign = &(ethernetif->RxBuffDescrip[0]); /* Aligned receive buffer descriptor start address. */
-    buffCfg[0].txBdStartAddrAlign = &(ethernetif->TxBuffDescrip[0]); /* Aligned transmit buffer descriptor start address. */
-    buffCfg[0].rxBufferAlign = &(ethernetif->RxDataBuff[0][0]); /* Receive data buffer start address. */
-    buffCfg[0].txBufferAlign = &(ethernetif->TxDataBuff[0][0]); /* Transmit data buffer start address. */
-    buffCfg[0].txFrameInfo = NULL;                              /* Transmit frame information start address. Set only if using zero-copy transmit. */
-    buffCfg[0].rxMaintainEnable = true;                         /* Receive buffer cache maintain. */
-    buffCfg[0].txMaintainEnable = true;                         /* Transmit buffer cache maintain. */
+    for (ring = 0U; ring < ENET_RING_NUM; ring++)
+    {
+        buffCfg[ring].rxBdNumber = ENET_RXBD_NUM;                      /* Receive buffer descriptor number. */
+        buffCfg[ring].txBdNumber = ENET_TXBD_NUM;                      /* Transmit buffer descriptor number. */
+        buffCfg[ring].rxBuffSizeAlign = sizeof(rx_buffer_t);           /* Aligned receive data buffer size. */
+        buffCfg[ring].txBuffSizeAlign = sizeof(tx_buffer_t);           /* Aligned transmit data buffer size. */
+        buffCfg[ring].rxBdStartAddrAlign = &(ethernetif->RxBuffDescrip[ring * ENET_RXBD_RING_STRIDE]); /* Aligned receive buffer descriptor start address. */
+        buffCfg[ring].txBdStartAddrAlign = &(ethernetif->TxBuffDescrip[ring * ENET_TXBD_RING_STRIDE]); /* Aligned transmit buffer descriptor start address. */
+        buffCfg[ring].rxBufferAlign = &(ethernetif->RxDataBuff[ring * ENET_RXBD_NUM][0]); /* Receive data buffer start address. */
+        buffCfg[ring].txBufferAlign = &(ethernetif->TxDataBuff[ring * ENET_TXBD_NUM][0]); /* Transmit data buffer start address. */
+        buffCfg[ring].txFrameInfo = NULL;                              /* Transmit frame information start address. Set only if using zero-copy transmit. */
+        buffCfg[ring].rxMaintainEnable = true;                         /* Receive buffer cache maintain. */
+        buffCfg[ring].txMaintainEnable = true;                         /* Transmit buffer cache maintain. */
+    }
 
     sysClock = ethernetifConfig->phyHandle->mdioHandle->resource.csrClock_Hz;
 
@@ -336,6 +403,12 @@ void ethernetif_enet_init(struct netif *netif, struct ethernetif *ethernetif,
     ethernetif->txFlag = 0x1;
 
     config.interrupt |= kENET_RxFrameInterrupt | kENET_TxFrameInterrupt | kENET_TxBufferInterrupt | kENET_LateCollisionInterrupt;
+#if ENET_RING_NUM > 1U
+    config.interrupt |= kENET_RxFrame1Interrupt | kENET_TxFrame1Interrupt | kENET_TxBuffer1Interrupt;
+#endif
+#if ENET_RING_NUM > 2U
+    config.interrupt |= kENET_RxFrame2Interrupt | kENET_TxFrame2Interrupt | kENET_TxBuffer2Interrupt;
+#endif
 
     for (instance = 0; instance < ARRAY_SIZE(enetBases); instance++)
     {
@@ -361,16 +434,26 @@ void ethernetif_enet_init(struct netif *netif, struct ethernetif *ethernetif,
     LWIP_ASSERT("Input Ethernet base error!", (instance != ARRAY_SIZE(enetBases)));
 #endif /* USE_RTOS */
 
-    for (i = 0; i < ENET_RXBD_NUM; i++)
+    for (ring = 0U; ring < ENET_RING_NUM; ring++)
     {
-        ethernetif->RxPbufs[i].p.custom_free_function = ethernetif_rx_release;
-        ethernetif->RxPbufs[i].buffer = &(ethernetif->RxDataBuff[i][0]);
-        ethernetif->RxPbufs[i].ethernetif = ethernetif;
+        for (i = 0; i < ENET_RXBD_NUM; i++)
+        {
+            ethernetif->RxPbufs[ring][i].p.custom_free_function = ethernetif_rx_release;
+            ethernetif->RxPbufs[ring][i].buffer = &(ethernetif->RxDataBuff[ring * ENET_RXBD_NUM + i][0]);
+            ethernetif->RxPbufs[ring][i].ethernetif = ethernetif;
+            ethernetif->RxPbufs[ring][i].ringId = (uint8_t)ring;
+        }
     }
 
     /* Initialize the ENET module. */
     ENET_Init(ethernetif->base, &ethernetif->handle, &config, &buffCfg[0], netif->hwaddr, sysClock);
 
+#if ENET_RING_NUM > 1U
+    /* Rings are served round-robin on transmit (ENET_Init default), so bulk traffic queued
+     * in ring 0 does not delay frames of the other rings. */
+    ethernetif_rx_classify_init(ethernetif->base);
+#endif
+
 #if USE_RTOS && defined(FSL_RTOS_FREE_RTOS)
     ENET_SetCallback(&ethernetif->handle, ethernet_callback, netif);
 #endif
@@ -393,10 +476,52 @@ static unsigned char *enet_get_tx_buffer(struct ethernetif *ethernetif)
     return ucBuffer;
 }
 
+/**
+ * Selects the transmit ring of the frame from its VLAN priority or,
+ * for untagged IP frames, from the class selector of the DSCP field
+ * (set per socket with the IP_TOS option).
+ */
+static uint8_t ethernetif_tx_ring(const struct pbuf *p)
+{
+#if ENET_RING_NUM > 1U
+    const uint8_t *frame = (const uint8_t *)p->payload;
+    const struct eth_hdr *ethhdr = (const struct eth_hdr *)p->payload;
+    uint32_t prio = 0U;
+
+    if (p->len >= (SIZEOF_ETH_HDR + SIZEOF_VLAN_HDR))
+    {
+        if (ethhdr->type == PP_HTONS(ETHTYPE_VLAN))
+        {
+            const struct eth_vlan_hdr *vlan = (const struct eth_vlan_hdr *)(frame + SIZEOF_ETH_HDR);
+            prio = (uint32_t)lwip_ntohs(vlan->prio_vid) >> 13;
+        }
+        else if (ethhdr->type == PP_HTONS(ETHTYPE_IP))
+        {
+            /* Version/IHL is followed by the TOS byte, DSCP is its upper six bits. */
+            prio = (uint32_t)frame[SIZEOF_ETH_HDR + 1U] >> 5;
+        }
+        else if (ethhdr->type == PP_HTONS(ETHTYPE_IPV6))
+        {
+            /* Traffic class spans the low nibble of byte 0 and the high nibble of byte 1. */
+            prio = ((uint32_t)frame[SIZEOF_ETH_HDR] >> 1) & 0x7U;
+        }
+        else
+        {
+            /* Keep prio 0 (best effort). */
+        }
+    }
+
+    return s_pcpToRing[prio];
+#else
+    LWIP_UNUSED_ARG(p);
+    return 0U;
+#endif /* ENET_RING_NUM > 1U */
+}
+
 /**
  * Sends frame via ENET.
  */
-static err_t enet_send_frame(struct ethernetif *ethernetif, unsigned char *data, const uint32_t length)
+static err_t enet_send_frame(struct ethernetif *ethernetif, unsigned char *data, const uint32_t length, uint8_t ringId)
 {
 #if USE_RTOS && defined(FSL_RTOS_FREE_RTOS)
     {
@@ -404,12 +529,12 @@ static err_t enet_send_frame(struct ethernetif *ethernetif, unsigned char *data,
 
         do
         {
-            result = ENET_SendFrame(ethernetif->base, &ethernetif->handle, data, length, 0, false, NULL);
+            result = ENET_SendFrame(ethernetif->base, &ethernetif->handle, data, length, ringId, false, NULL);
 
             if (result == kStatus_ENET_TxFrameBusy)
             {
-                xEventGroupWaitBits(ethernetif->enetTransmitAccessEvent, ethernetif->txFlag, pdTRUE, (BaseType_t) false,
-                                    portMAX_DELAY);
+                xEventGroupWaitBits(ethernetif->enetTransmitAccessEvent, ethernetif->txFlag << ringId, pdTRUE,
+                                    (BaseType_t) false, portMAX_DELAY);
             }
 
         } while (result == kStatus_ENET_TxFrameBusy);
@@ -421,7 +546,7 @@ static err_t enet_send_frame(struct ethernetif *ethernetif, unsigned char *data,
 
         for (counter = ENET_TIMEOUT; counter != 0U; counter--)
         {
-            if (ENET_SendFrame(ethernetif->base, &ethernetif->handle, data, length, 0, false, NULL) != kStatus_ENET_TxFrameBusy)
+            if (ENET_SendFrame(ethernetif->base, &ethernetif->handle, data, length, ringId, false, NULL) != kStatus_ENET_TxFrameBusy)
             {
                 return ERR_OK;
             }
@@ -442,7 +567,7 @@ static void ethernetif_rx_release(struct pbuf *p)
     SYS_ARCH_DECL_PROTECT(old_level);
 
     SYS_ARCH_PROTECT(old_level);
-    ENET_ReleaseRxBuffer(wrapper->ethernetif->base, &wrapper->ethernetif->handle, wrapper->buffer, 0);
+    ENET_ReleaseRxBuffer(wrapper->ethernetif->base, &wrapper->ethernetif->handle, wrapper->buffer, wrapper->ringId);
     SYS_ARCH_UNPROTECT(old_level);
 }
 
@@ -452,7 +577,7 @@ static void ethernetif_rx_release(struct pbuf *p)
  * Function can be called only after ENET_GetRxFrameSize() indicates
  * that there actually is a received frame.
  */
-static struct pbuf *ethernetif_read_frame(struct ethernetif *ethernetif, uint32_t length)
+static struct pbuf *ethernetif_read_frame(struct ethernetif *ethernetif, uint32_t length, uint8_t ringId)
 {
     rx_pbuf_wrapper_t *wrapper;
     uint32_t len = 0;
@@ -466,7 +591,7 @@ static struct pbuf *ethernetif_read_frame(struct ethernetif *ethernetif, uint32_
 
     do
     {
-        status = ENET_GetRxBuffer(ethernetif->base, &ethernetif->handle, &buffer, &len, 0, &isLastBuff, &ts);
+        status = ENET_GetRxBuffer(ethernetif->base, &ethernetif->handle, &buffer, &len, ringId, &isLastBuff, &ts);
         LWIP_UNUSED_ARG(status); /* for LWIP_NOASSERT */
         LWIP_ASSERT("ENET_GetRxBuffer() status != kStatus_Success", status == kStatus_Success);
 
@@ -474,9 +599,9 @@ static struct pbuf *ethernetif_read_frame(struct ethernetif *ethernetif, uint32_
         wrapper = NULL;
         for (i = 0; i < ENET_RXBD_NUM; i++)
         {
-            if (buffer == ethernetif->RxPbufs[i].buffer)
+            if (buffer == ethernetif->RxPbufs[ringId][i].buffer)
             {
-                wrapper = &ethernetif->RxPbufs[i];
+                wrapper = &ethernetif->RxPbufs[ringId][i];
                 break;
             }
         }
@@ -521,7 +646,7 @@ static struct pbuf *ethernetif_read_frame(struct ethernetif *ethernetif, uint32_
  * Function can be called only after ENET_GetRxFrameSize() indicates
  * that there actually is a frame error or a received frame.
  */
-static void ethernetif_drop_frame(struct ethernetif *ethernetif)
+static void ethernetif_drop_frame(struct ethernetif *ethernetif, uint8_t ringId)
 {
     status_t status;
     void *buffer;
@@ -534,12 +659,12 @@ static void ethernetif_drop_frame(struct ethernetif *ethernetif)
 #if 0 /* Error statisctics */
         enet_data_error_stats_t eErrStatic;
         /* Get the error information of the received g_frame. */
-        ENET_GetRxErrBeforeReadFrame(&ethernetif->handle, &eErrStatic);
+        ENET_GetRxErrBeforeReadFrame(&ethernetif->handle, &eErrStatic, ringId);
 #endif
-        status = ENET_GetRxBuffer(ethernetif->base, &ethernetif->handle, &buffer, &len, 0, &isLastBuff, &ts);
+        status = ENET_GetRxBuffer(ethernetif->base, &ethernetif->handle, &buffer, &len, ringId, &isLastBuff, &ts);
         LWIP_UNUSED_ARG(status); /* for LWIP_NOASSERT */
         LWIP_ASSERT("ENET_GetRxBuffer() status != kStatus_Success", status == kStatus_Success);
-        ENET_ReleaseRxBuffer(ethernetif->base, &ethernetif->handle, buffer, 0);
+        ENET_ReleaseRxBuffer(ethernetif->base, &ethernetif->handle, buffer, ringId);
     } while (!isLastBuff);
 
     LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_linkinput: RxFrameError\n"));
@@ -552,21 +677,30 @@ struct pbuf *ethernetif_linkinput(struct netif *netif)
 {
     struct ethernetif *ethernetif = netif->state;
     struct pbuf *p = NULL;
-    status_t status;
+    status_t status = kStatus_ENET_RxFrameEmpty;
     uint32_t len;
+    uint8_t ringId = ENET_RING_NUM;
 
-    /* Obtain the size of the packet and put it into the "len" variable. */
-    status = ENET_GetRxFrameSize(&ethernetif->handle, &len, 0);
+    /* Service the rings in priority order - the highest ring index first. Since the caller
+     * polls until no frame is returned, a frame arriving in a higher priority ring is picked
+     * up before the rest of a lower priority backlog. */
+    while ((ringId > 0U) && (status == kStatus_ENET_RxFrameEmpty))
+    {
+        ringId--;
+
+        /* Obtain the size of the packet and put it into the "len" variable. */
+        status = ENET_GetRxFrameSize(&ethernetif->handle, &len, ringId);
+    }
 
     if (status == kStatus_Success)
     {
         /* Read frame. */
-        p = ethernetif_read_frame(ethernetif, len);
+        p = ethernetif_read_frame(ethernetif, len, ringId);
     }
     else if (status != kStatus_ENET_RxFrameEmpty)
     {
         /* Drop the frame when error happened. */
-        ethernetif_drop_frame(ethernetif);
+        ethernetif_drop_frame(ethernetif, ringId);
     }
 
     return p;
@@ -623,7 +757,7 @@ err_t ethernetif_linkoutput(struct netif *netif, struct pbuf *p)
     }
 
     /* Send frame. */
-    result = enet_send_frame(ethernetif, pucBuffer, p->tot_len);
+    result = enet_send_frame(ethernetif, pucBuffer, p->tot_len, ethernetif_tx_ring(p));
 
     MIB2_STATS_NETIF_ADD(netif, ifoutoctets, p->tot_len);
     if (((u8_t *)p->payload)[0] & 1)
@@ -662,10 +796,10 @@ err_t ethernetif_linkoutput(struct netif *netif, struct pbuf *p)
 err_t ethernetif0_init(struct netif *netif)
 {
     static struct ethernetif ethernetif_0;
-    AT_NONCACHEABLE_SECTION_ALIGN(static enet_rx_bd_struct_t rxBuffDescrip_0[ENET_RXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
-    AT_NONCACHEABLE_SECTION_ALIGN(static enet_tx_bd_struct_t txBuffDescrip_0[ENET_TXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
-    SDK_ALIGN(static rx_buffer_t rxDataBuff_0[ENET_RXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
-    SDK_ALIGN(static tx_buffer_t txDataBuff_0[ENET_TXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
+    AT_NONCACHEABLE_SECTION_ALIGN(static enet_rx_bd_struct_t rxBuffDescrip_0[ENET_RING_NUM * ENET_RXBD_RING_STRIDE], FSL_ENET_BUFF_ALIGNMENT);
+    AT_NONCACHEABLE_SECTION_ALIGN(static enet_tx_bd_struct_t txBuffDescrip_0[ENET_RING_NUM * ENET_TXBD_RING_STRIDE], FSL_ENET_BUFF_ALIGNMENT);
+    SDK_ALIGN(static rx_buffer_t rxDataBuff_0[ENET_RING_NUM * ENET_RXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
+    SDK_ALIGN(static tx_buffer_t txDataBuff_0[ENET_RING_NUM * ENET_TXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
 
     ethernetif_0.RxBuffDescrip = &(rxBuffDescrip_0[0]);
     ethernetif_0.TxBuffDescrip = &(txBuffDescrip_0[0]);
@@ -691,10 +825,10 @@ err_t ethernetif0_init(struct netif *netif)
 err_t ethernetif1_init(struct netif *netif)
 {
     static struct ethernetif ethernetif_1;
-    AT_NONCACHEABLE_SECTION_ALIGN(static enet_rx_bd_struct_t rxBuffDescrip_1[ENET_RXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
-    AT_NONCACHEABLE_SECTION_ALIGN(static enet_tx_bd_struct_t txBuffDescrip_1[ENET_TXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
-    SDK_ALIGN(static rx_buffer_t rxDataBuff_1[ENET_RXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
-    SDK_ALIGN(static tx_buffer_t txDataBuff_1[ENET_TXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
+    AT_NONCACHEABLE_SECTION_ALIGN(static enet_rx_bd_struct_t rxBuffDescrip_1[ENET_RING_NUM * ENET_RXBD_RING_STRIDE], FSL_ENET_BUFF_ALIGNMENT);
+    AT_NONCACHEABLE_SECTION_ALIGN(static enet_tx_bd_struct_t txBuffDescrip_1[ENET_RING_NUM * ENET_TXBD_RING_STRIDE], FSL_ENET_BUFF_ALIGNMENT);
+    SDK_ALIGN(static rx_buffer_t rxDataBuff_1[ENET_RING_NUM * ENET_RXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
+    SDK_ALIGN(static tx_buffer_t txDataBuff_1[ENET_RING_NUM * ENET_TXBD_NUM], FSL_ENET_BUFF_ALIGNMENT);
 
     ethernetif_1.RxBuffDescrip = &(rxBuffDescrip_1[0]);
     ethernetif_1.TxBuffDescrip = &(txBuffDescrip_1[0]);
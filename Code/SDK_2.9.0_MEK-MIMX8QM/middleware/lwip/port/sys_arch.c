@@ -44,6 +44,8 @@
 //
 //*****************************************************************************
 
+#include <string.h>
+
 /* ------------------------ System architecture includes ----------------------------- */
 #include "arch/sys_arch.h"
 
@@ -93,6 +95,7 @@ u32_t lwip_rand(void)
 }
 
 #if !NO_SYS
+#if !SYS_ARCH_RING_MBOX
 /*---------------------------------------------------------------------------*
  * Routine:  sys_mbox_new
  *---------------------------------------------------------------------------*
@@ -340,6 +343,337 @@ unsigned long ulReturn;
     return ulReturn;
 }
 
+#else /* !SYS_ARCH_RING_MBOX */
+
+/* Mailbox with a single reader. Messages are stored in a ring of pointers,
+ * the semaphores are only touched when the reader or a writer has to block. */
+struct sys_mbox_ring
+{
+    void **slots;
+    u32_t size;
+    u32_t head;                   /* index of the oldest message */
+    u32_t count;                  /* number of messages in the ring */
+    u32_t writersWaiting;         /* writers blocked on notFull */
+    u8_t readerWaiting;           /* reader blocked on notEmpty */
+    SemaphoreHandle_t notEmpty;   /* binary, given to wake the reader */
+    SemaphoreHandle_t notFull;    /* counting, given once per woken writer */
+};
+
+static void sys_mbox_ring_give( SemaphoreHandle_t xSemaphore )
+{
+#ifdef __CA7_REV
+    if (SystemGetIRQNestingLevel())
+#else
+    if (__get_IPSR())
+#endif
+    {
+        portBASE_TYPE taskToWake = pdFALSE;
+
+        (void)xSemaphoreGiveFromISR( xSemaphore, &taskToWake );
+        portYIELD_FROM_ISR( taskToWake );
+    }
+    else
+    {
+        (void)xSemaphoreGive( xSemaphore );
+    }
+}
+
+/* Stores a message, registers the caller as waiting writer if the ring is full and xWait is set. */
+static err_t sys_mbox_ring_put( sys_mbox_t pxMailBox, void *pxMessage, int xWait )
+{
+sys_prot_t xProt;
+err_t xReturn = ERR_OK;
+int xWakeReader = 0;
+
+    xProt = sys_arch_protect();
+    if( pxMailBox->count < pxMailBox->size )
+    {
+        pxMailBox->slots[ ( pxMailBox->head + pxMailBox->count ) % pxMailBox->size ] = pxMessage;
+        pxMailBox->count++;
+        if( pxMailBox->readerWaiting != 0U )
+        {
+            pxMailBox->readerWaiting = 0U;
+            xWakeReader = 1;
+        }
+    }
+    else
+    {
+        if( xWait != 0 )
+        {
+            pxMailBox->writersWaiting++;
+        }
+        xReturn = ERR_MEM;
+    }
+    sys_arch_unprotect( xProt );
+
+    if( xWakeReader != 0 )
+    {
+        sys_mbox_ring_give( pxMailBox->notEmpty );
+    }
+    return xReturn;
+}
+
+/* Takes the oldest message, registers the reader as waiting if the ring is empty and xWait is set. */
+static int sys_mbox_ring_get( sys_mbox_t pxMailBox, void **ppvMessage, int xWait )
+{
+sys_prot_t xProt;
+int xReturn = 0;
+int xWakeWriter = 0;
+
+    xProt = sys_arch_protect();
+    if( pxMailBox->count != 0U )
+    {
+        *ppvMessage = pxMailBox->slots[ pxMailBox->head ];
+        pxMailBox->head = ( pxMailBox->head + 1U ) % pxMailBox->size;
+        pxMailBox->count--;
+        if( pxMailBox->writersWaiting != 0U )
+        {
+            pxMailBox->writersWaiting--;
+            xWakeWriter = 1;
+        }
+        xReturn = 1;
+    }
+    else if( xWait != 0 )
+    {
+        pxMailBox->readerWaiting = 1U;
+    }
+    sys_arch_unprotect( xProt );
+
+    if( xWakeWriter != 0 )
+    {
+        sys_mbox_ring_give( pxMailBox->notFull );
+    }
+    return xReturn;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_new
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Creates a new mailbox
+ * Inputs:
+ *      int size                -- Size of elements in the mailbox
+ * Outputs:
+ *      sys_mbox_t              -- Handle to new mailbox
+ *---------------------------------------------------------------------------*/
+err_t sys_mbox_new( sys_mbox_t *pxMailBox, int iSize )
+{
+sys_mbox_t pxNew;
+
+    LWIP_ASSERT( "sys_mbox_new: invalid size", iSize > 0 );
+
+    pxNew = ( sys_mbox_t )pvPortMalloc( sizeof( struct sys_mbox_ring ) + ( ( size_t )iSize * sizeof( void * ) ) );
+    if( pxNew == NULL )
+    {
+        SYS_STATS_INC( mbox.err );
+        return ERR_MEM;
+    }
+    memset( pxNew, 0, sizeof( struct sys_mbox_ring ) );
+    pxNew->slots = ( void ** )( pxNew + 1 );
+    pxNew->size = ( u32_t )iSize;
+    pxNew->notEmpty = xSemaphoreCreateBinary();
+    pxNew->notFull = xSemaphoreCreateCounting( 0xFFFFU, 0U );
+    if( ( pxNew->notEmpty == NULL ) || ( pxNew->notFull == NULL ) )
+    {
+        if( pxNew->notEmpty != NULL )
+        {
+            vSemaphoreDelete( pxNew->notEmpty );
+        }
+        if( pxNew->notFull != NULL )
+        {
+            vSemaphoreDelete( pxNew->notFull );
+        }
+        vPortFree( pxNew );
+        SYS_STATS_INC( mbox.err );
+        return ERR_MEM;
+    }
+
+    *pxMailBox = pxNew;
+    SYS_STATS_INC_USED( mbox );
+    return ERR_OK;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_free
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Deallocates a mailbox. If there are messages still present in the
+ *      mailbox when the mailbox is deallocated, it is an indication of a
+ *      programming error in lwIP and the developer should be notified.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *---------------------------------------------------------------------------*/
+void sys_mbox_free( sys_mbox_t *pxMailBox )
+{
+    configASSERT( ( ( *pxMailBox )->count == 0U ) );
+
+    #if SYS_STATS
+    {
+        if( ( *pxMailBox )->count != 0U )
+        {
+            SYS_STATS_INC( mbox.err );
+        }
+
+        SYS_STATS_DEC( mbox.used );
+    }
+    #endif /* SYS_STATS */
+
+    vSemaphoreDelete( ( *pxMailBox )->notEmpty );
+    vSemaphoreDelete( ( *pxMailBox )->notFull );
+    vPortFree( *pxMailBox );
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_post
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Post the "msg" to the mailbox, blocks while the mailbox is full.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void *data              -- Pointer to data to post
+ *---------------------------------------------------------------------------*/
+void sys_mbox_post( sys_mbox_t *pxMailBox, void *pxMessageToPost )
+{
+    while( sys_mbox_ring_put( *pxMailBox, pxMessageToPost, 1 ) != ERR_OK )
+    {
+        while( xSemaphoreTake( ( *pxMailBox )->notFull, portMAX_DELAY ) != pdTRUE );
+    }
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_trypost
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Try to post the "msg" to the mailbox.  Returns immediately with
+ *      error if cannot. Can be called from ISR.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void *msg               -- Pointer to data to post
+ * Outputs:
+ *      err_t                   -- ERR_OK if message posted, else ERR_MEM
+ *                                  if not.
+ *---------------------------------------------------------------------------*/
+err_t sys_mbox_trypost( sys_mbox_t *pxMailBox, void *pxMessageToPost )
+{
+    if( sys_mbox_ring_put( *pxMailBox, pxMessageToPost, 0 ) != ERR_OK )
+    {
+        /* The mailbox was already full. */
+        SYS_STATS_INC( mbox.err );
+        return ERR_MEM;
+    }
+    return ERR_OK;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_mbox_trypost_fromisr
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Try to post the "msg" to the mailbox.  Returns immediately with
+ *      error if cannot. To be be used from ISR.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void *msg               -- Pointer to data to post
+ * Outputs:
+ *      err_t                   -- ERR_OK if message posted, else ERR_MEM
+ *                                  if not.
+ *---------------------------------------------------------------------------*/
+err_t sys_mbox_trypost_fromisr(sys_mbox_t *mbox, void *msg)
+{
+    return sys_mbox_trypost(mbox, msg);
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_mbox_fetch
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Blocks the thread until a message arrives in the mailbox, but does
+ *      not block the thread longer than "timeout" milliseconds (0 means
+ *      forever). The "msg" parameter maybe NULL to indicate that the message
+ *      should be dropped.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void **msg              -- Pointer to pointer to msg received
+ *      u32_t timeout           -- Number of milliseconds until timeout
+ * Outputs:
+ *      u32_t                   -- SYS_ARCH_TIMEOUT if timeout, else number
+ *                                  of milliseconds until received.
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_mbox_fetch( sys_mbox_t *pxMailBox, void **ppvBuffer, u32_t ulTimeOut )
+{
+void *pvDummy;
+TickType_t xStartTime, xElapsed, xTimeOutTicks, xWait;
+sys_prot_t xProt;
+
+    xStartTime = xTaskGetTickCount();
+    xTimeOutTicks = ulTimeOut / portTICK_PERIOD_MS;
+
+    if( NULL == ppvBuffer )
+    {
+        ppvBuffer = &pvDummy;
+    }
+
+    while( sys_mbox_ring_get( *pxMailBox, ppvBuffer, 1 ) == 0 )
+    {
+        if( ulTimeOut == 0UL )
+        {
+            xWait = portMAX_DELAY;
+        }
+        else
+        {
+            xElapsed = xTaskGetTickCount() - xStartTime;
+            xWait = ( xElapsed < xTimeOutTicks ) ? ( xTimeOutTicks - xElapsed ) : 0U;
+        }
+
+        if( ( xWait == 0U ) || ( xSemaphoreTake( ( *pxMailBox )->notEmpty, xWait ) != pdTRUE ) )
+        {
+            /* Timed out. A writer may have posted in the meantime. */
+            xProt = sys_arch_protect();
+            ( *pxMailBox )->readerWaiting = 0U;
+            sys_arch_unprotect( xProt );
+            if( sys_mbox_ring_get( *pxMailBox, ppvBuffer, 0 ) != 0 )
+            {
+                break;
+            }
+            *ppvBuffer = NULL;
+            return SYS_ARCH_TIMEOUT;
+        }
+    }
+
+    xElapsed = ( xTaskGetTickCount() - xStartTime ) * portTICK_PERIOD_MS;
+    if( ( ulTimeOut == 0UL ) && ( xElapsed == 0UL ) )
+    {
+        xElapsed = 1UL;
+    }
+    return xElapsed;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_mbox_tryfetch
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Similar to sys_arch_mbox_fetch, but if message is not ready
+ *      immediately, we'll return with SYS_MBOX_EMPTY.  On success, 0 is
+ *      returned.
+ * Inputs:
+ *      sys_mbox_t mbox         -- Handle of mailbox
+ *      void **msg              -- Pointer to pointer to msg received
+ * Outputs:
+ *      u32_t                   -- SYS_MBOX_EMPTY if no messages.  Otherwise,
+ *                                  return ERR_OK.
+ *---------------------------------------------------------------------------*/
+u32_t sys_arch_mbox_tryfetch( sys_mbox_t *pxMailBox, void **ppvBuffer )
+{
+void *pvDummy;
+
+    if( ppvBuffer == NULL )
+    {
+        ppvBuffer = &pvDummy;
+    }
+
+    return ( sys_mbox_ring_get( *pxMailBox, ppvBuffer, 0 ) != 0 ) ? ERR_OK : SYS_MBOX_EMPTY;
+}
+#endif /* !SYS_ARCH_RING_MBOX */
+
 /*---------------------------------------------------------------------------*
  * Routine:  sys_sem_new
  *---------------------------------------------------------------------------*
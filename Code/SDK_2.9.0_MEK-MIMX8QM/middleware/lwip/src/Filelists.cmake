@@ -118,7 +118,6 @@ set(lwipppp_SRCS
     ${LWIP_DIR}/src/netif/ppp/chap-new.c
     ${LWIP_DIR}/src/netif/ppp/demand.c
     ${LWIP_DIR}/src/netif/ppp/eap.c
-    ${LWIP_DIR}/src/netif/ppp/ecp.c
     ${LWIP_DIR}/src/netif/ppp/eui64.c
     ${LWIP_DIR}/src/netif/ppp/fsm.c
     ${LWIP_DIR}/src/netif/ppp/ipcp.c
@@ -102,7 +102,6 @@ PPPFILES=$(LWIPDIR)/netif/ppp/auth.c \
 	$(LWIPDIR)/netif/ppp/chap-new.c \
 	$(LWIPDIR)/netif/ppp/demand.c \
 	$(LWIPDIR)/netif/ppp/eap.c \
-	$(LWIPDIR)/netif/ppp/ecp.c \
 	$(LWIPDIR)/netif/ppp/eui64.c \
 	$(LWIPDIR)/netif/ppp/fsm.c \
 	$(LWIPDIR)/netif/ppp/ipcp.c \
@@ -66,6 +66,7 @@ sys_mutex_t lock_tcpip_core;
 #endif /* LWIP_TCPIP_CORE_LOCKING */
 
 static void tcpip_thread_handle_msg(struct tcpip_msg *msg);
+static void tcpip_inpkt_batch_process(struct pbuf *head, struct netif *inp, netif_input_fn input_fn);
 
 #if !LWIP_TIMERS
 /* wait for a message with timers disabled (e.g. pass a timer-check trigger into tcpip_thread) */
@@ -181,6 +182,11 @@ tcpip_thread_handle_msg(struct tcpip_msg *msg)
       }
       memp_free(MEMP_TCPIP_MSG_INPKT, msg);
       break;
+    case TCPIP_MSG_INPKT_BATCH:
+      LWIP_DEBUGF(TCPIP_DEBUG, ("tcpip_thread: PACKET BATCH %p\n", (void *)msg));
+      tcpip_inpkt_batch_process(msg->msg.inp.p, msg->msg.inp.netif, msg->msg.inp.input_fn);
+      memp_free(MEMP_TCPIP_MSG_INPKT, msg);
+      break;
 #endif /* !LWIP_TCPIP_CORE_LOCKING_INPUT */
 
 #if LWIP_TCPIP_TIMEOUT && LWIP_TIMERS
@@ -295,6 +301,173 @@ tcpip_input(struct pbuf *p, struct netif *inp)
     return tcpip_inpkt(p, inp, ip_input);
 }
 
+/* Cuts the first packet off a packet list built by tcpip_inpkt_batch_add()
+ * and returns the remaining list. */
+static struct pbuf *
+tcpip_inpkt_batch_split(struct pbuf *p)
+{
+  struct pbuf *rest;
+
+  while (p->tot_len != p->len) {
+    LWIP_ASSERT("tcpip_inpkt_batch_split: broken packet list", p->next != NULL);
+    p = p->next;
+  }
+  rest = p->next;
+  p->next = NULL;
+  return rest;
+}
+
+/* Passes every packet of a list to input_fn, must be called with the core locked */
+static void
+tcpip_inpkt_batch_process(struct pbuf *head, struct netif *inp, netif_input_fn input_fn)
+{
+  while (head != NULL) {
+    struct pbuf *p = head;
+    head = tcpip_inpkt_batch_split(p);
+    if (input_fn(p, inp) != ERR_OK) {
+      pbuf_free(p);
+    }
+  }
+}
+
+/**
+ * Initialize an empty list of received packets
+ *
+ * @param batch the packet list
+ */
+void
+tcpip_inpkt_batch_init(struct tcpip_inpkt_batch *batch)
+{
+  batch->head = NULL;
+  batch->tail = NULL;
+  batch->count = 0;
+}
+
+/**
+ * Append a received packet to a packet list. The list takes over the
+ * reference of the caller. Empty pbufs at the end of the packet are freed.
+ *
+ * @param batch the packet list
+ * @param p the received packet (may be a pbuf chain)
+ */
+void
+tcpip_inpkt_batch_add(struct tcpip_inpkt_batch *batch, struct pbuf *p)
+{
+  struct pbuf *last;
+
+  LWIP_ASSERT("tcpip_inpkt_batch_add: invalid pbuf", p != NULL);
+  last = p;
+  while (last->tot_len != last->len) {
+    LWIP_ASSERT("tcpip_inpkt_batch_add: invalid pbuf chain", last->next != NULL);
+    last = last->next;
+  }
+  if (last->next != NULL) {
+    /* only empty pbufs follow the first pbuf with tot_len == len: drop them,
+       tcpip_inpkt_batch_split() would take them for the next packet */
+    struct pbuf *empty = last->next;
+    LWIP_ASSERT("tcpip_inpkt_batch_add: invalid pbuf chain", empty->tot_len == 0);
+    last->next = NULL;
+    pbuf_free(empty);
+  }
+
+  if (batch->tail == NULL) {
+    batch->head = p;
+  } else {
+    batch->tail->next = p;
+  }
+  batch->tail = last;
+  batch->count++;
+}
+
+/**
+ * Free all packets of a packet list, e.g. after tcpip_inpkt_batch() failed
+ *
+ * @param batch the packet list
+ */
+void
+tcpip_inpkt_batch_free(struct tcpip_inpkt_batch *batch)
+{
+  struct pbuf *head = batch->head;
+
+  while (head != NULL) {
+    struct pbuf *p = head;
+    head = tcpip_inpkt_batch_split(p);
+    pbuf_free(p);
+  }
+  tcpip_inpkt_batch_init(batch);
+}
+
+/**
+ * Pass a list of received packets to tcpip_thread for input processing.
+ * All packets are posted in one message and processed in one go, which
+ * saves a message allocation and a mailbox round trip per packet.
+ *
+ * @param batch the received packets, emptied on success. On failure the
+ *        packets are left in the list and must be freed by the caller
+ *        (tcpip_inpkt_batch_free()).
+ * @param inp the network interface on which the packets were received
+ * @param input_fn input function to call for each packet
+ */
+err_t
+tcpip_inpkt_batch(struct tcpip_inpkt_batch *batch, struct netif *inp, netif_input_fn input_fn)
+{
+#if LWIP_TCPIP_CORE_LOCKING_INPUT
+  LWIP_DEBUGF(TCPIP_DEBUG, ("tcpip_inpkt_batch: %"U16_F" PACKETS %p/%p\n", batch->count, (void *)batch->head, (void *)inp));
+  if (batch->head != NULL) {
+    LOCK_TCPIP_CORE();
+    tcpip_inpkt_batch_process(batch->head, inp, input_fn);
+    UNLOCK_TCPIP_CORE();
+  }
+  tcpip_inpkt_batch_init(batch);
+  return ERR_OK;
+#else /* LWIP_TCPIP_CORE_LOCKING_INPUT */
+  struct tcpip_msg *msg;
+
+  LWIP_ASSERT("Invalid mbox", sys_mbox_valid_val(tcpip_mbox));
+
+  if (batch->head == NULL) {
+    return ERR_OK;
+  }
+
+  msg = (struct tcpip_msg *)memp_malloc(MEMP_TCPIP_MSG_INPKT);
+  if (msg == NULL) {
+    return ERR_MEM;
+  }
+
+  msg->type = TCPIP_MSG_INPKT_BATCH;
+  msg->msg.inp.p = batch->head;
+  msg->msg.inp.netif = inp;
+  msg->msg.inp.input_fn = input_fn;
+  if (sys_mbox_trypost(&tcpip_mbox, msg) != ERR_OK) {
+    memp_free(MEMP_TCPIP_MSG_INPKT, msg);
+    return ERR_MEM;
+  }
+  tcpip_inpkt_batch_init(batch);
+  return ERR_OK;
+#endif /* LWIP_TCPIP_CORE_LOCKING_INPUT */
+}
+
+/**
+ * @ingroup lwip_os
+ * Pass a list of received packets to tcpip_thread for input processing
+ * with ethernet_input or ip_input, see tcpip_inpkt_batch().
+ * Drivers receiving several frames per interrupt should use this instead of
+ * calling netif->input() for every frame when netif->input is tcpip_input.
+ *
+ * @param batch the received packets, emptied on success
+ * @param inp the network interface on which the packets were received
+ */
+err_t
+tcpip_input_batch(struct tcpip_inpkt_batch *batch, struct netif *inp)
+{
+#if LWIP_ETHERNET
+  if (inp->flags & (NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET)) {
+    return tcpip_inpkt_batch(batch, inp, ethernet_input);
+  } else
+#endif /* LWIP_ETHERNET */
+    return tcpip_inpkt_batch(batch, inp, ip_input);
+}
+
 /**
  * @ingroup lwip_os
  * Call a specific function in the thread context of
@@ -53,6 +53,11 @@
 #define HTTPSRV_CFG_CACHE_MAXAGE (3600)
 #endif
 
+/* Size of the buffer for the If-None-Match request header, longer lists of entity tags are ignored */
+#ifndef HTTPSRV_CFG_IF_NONE_MATCH_SIZE
+#define HTTPSRV_CFG_IF_NONE_MATCH_SIZE (64)
+#endif
+
 /* Default sessions count */
 #ifndef HTTPSRV_CFG_DEFAULT_SES_CNT
 #define HTTPSRV_CFG_DEFAULT_SES_CNT  (2)
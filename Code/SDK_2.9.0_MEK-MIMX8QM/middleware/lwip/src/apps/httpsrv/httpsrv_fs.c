@@ -21,12 +21,16 @@ static uint32_t httpsrv_fs_read(HTTPSRV_FS_FILE_PTR, uint32_t, char *, int32_t *
 static uint32_t httpsrv_fs_move_file_pointer(HTTPSRV_FS_FILE_PTR, int32_t *);
 
 const HTTPSRV_FS_DIR_ENTRY *ROOT;
+/* Number of entries in ROOT, 0 if ROOT is not sorted and has to be searched linearly */
+static uint32_t root_sorted_count;
 
 /*FUNCTION*-------------------------------------------------------------------
 *
 * Function Name    : HTTPSRV_FS_init
 * Returned Value   : HTTPSRV_FS error code.
-* Comments         : Initialize the Trivial File System.
+* Comments         : Initialize the Trivial File System. Checks whether
+*                    the directory is sorted, so files can be searched
+*                    by bisection.
 *
 *END*---------------------------------------------------------------------*/
 
@@ -34,7 +38,23 @@ void HTTPSRV_FS_init(
     /*[IN] pointer to the first entry of the root HTTPSRV_FS directory  */
     const HTTPSRV_FS_DIR_ENTRY *root)
 {
+    uint32_t count = 0;
+
     ROOT = root;
+    root_sorted_count = 0;
+    if (root == NULL)
+    {
+        return;
+    }
+    while (root[count].NAME != NULL)
+    {
+        if ((count != 0) && (httpsrv_fs_cmp(root[count - 1].NAME, root[count].NAME) >= 0))
+        {
+            return;
+        }
+        count++;
+    }
+    root_sorted_count = count;
 }
 
 /*FUNCTION*-------------------------------------------------------------------
@@ -66,7 +86,9 @@ HTTPSRV_FS_FILE_PTR HTTPSRV_FS_open(
                 fd_ptr->DEV_DATA_PTR = entry;
                 fd_ptr->LOCATION = 0;
                 fd_ptr->ERROR = 0;
-                fd_ptr->SIZE = ((HTTPSRV_FS_DIR_ENTRY_PTR)fd_ptr->DEV_DATA_PTR)->SIZE;
+                fd_ptr->SIZE = entry->SIZE;
+                fd_ptr->DATA = entry->DATA;
+                fd_ptr->ETAG = entry->ETAG;
             }
         }
     }
@@ -252,8 +274,44 @@ int32_t HTTPSRV_FS_ioctl(
             }
             else
             {
-                *((unsigned char **)param_ptr) =
-                    ((HTTPSRV_FS_DIR_ENTRY_PTR)file_ptr->DEV_DATA_PTR)->DATA + file_ptr->LOCATION;
+                *((unsigned char **)param_ptr) = (unsigned char *)file_ptr->DATA + file_ptr->LOCATION;
+            }
+            break;
+        case IO_IOCTL_HTTPSRV_FS_GET_ETAG:
+            if (file_ptr->DEV_DATA_PTR == NULL)
+            {
+                error_code = HTTPSRV_FS_ERROR_INVALID_FILE_HANDLE;
+            }
+            else
+            {
+                *((const char **)param_ptr) = file_ptr->ETAG;
+            }
+            break;
+        case IO_IOCTL_HTTPSRV_FS_HAS_GZIP:
+            if (file_ptr->DEV_DATA_PTR == NULL)
+            {
+                error_code = HTTPSRV_FS_ERROR_INVALID_FILE_HANDLE;
+            }
+            else
+            {
+                *((bool *)param_ptr) = (file_ptr->DEV_DATA_PTR->GZ_DATA != NULL);
+            }
+            break;
+        case IO_IOCTL_HTTPSRV_FS_SET_GZIP:
+            /* Switch to the compressed data, only before anything was read */
+            if (file_ptr->DEV_DATA_PTR == NULL)
+            {
+                error_code = HTTPSRV_FS_ERROR_INVALID_FILE_HANDLE;
+            }
+            else if ((file_ptr->DEV_DATA_PTR->GZ_DATA == NULL) || (file_ptr->LOCATION != 0))
+            {
+                error_code = HTTPSRV_FS_OPERATION_NOT_ALLOWED;
+            }
+            else
+            {
+                file_ptr->DATA = file_ptr->DEV_DATA_PTR->GZ_DATA;
+                file_ptr->SIZE = file_ptr->DEV_DATA_PTR->GZ_SIZE;
+                file_ptr->ETAG = file_ptr->DEV_DATA_PTR->GZ_ETAG;
             }
             break;
         case IO_IOCTL_HTTPSRV_FS_GET_LAST_ERROR:
@@ -328,6 +386,8 @@ static const HTTPSRV_FS_DIR_ENTRY *httpsrv_fs_open_file(
     int32_t *error_ptr)
 {
     const HTTPSRV_FS_DIR_ENTRY *entry;
+    uint32_t low, high, mid;
+    int32_t cmp;
 
     if (/*(drive_ptr == NULL) ||*/ (pathname == NULL) || (*pathname == '\0'))
     {
@@ -336,6 +396,30 @@ static const HTTPSRV_FS_DIR_ENTRY *httpsrv_fs_open_file(
     }
     *error_ptr = HTTPSRV_FS_FILE_NOT_FOUND;
     entry = /* (HTTPSRV_FS_DIR_ENTRY_PTR)drive_ptr-> */ ROOT;
+    if (root_sorted_count != 0)
+    {
+        low  = 0;
+        high = root_sorted_count;
+        while (low < high)
+        {
+            mid = low + (high - low) / 2;
+            cmp = httpsrv_fs_cmp(entry[mid].NAME, pathname);
+            if (cmp == 0)
+            {
+                *error_ptr = HTTPSRV_FS_OK;
+                return &entry[mid];
+            }
+            if (cmp < 0)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return NULL;
+    }
     while (entry->NAME != NULL)
     {
         if (httpsrv_fs_cmp(entry->NAME, pathname) == 0)
@@ -369,8 +453,7 @@ static uint32_t httpsrv_fs_read(
     /* [OUT] error information */
     int32_t *error_ptr)
 {
-    uint32_t i;
-    unsigned char *data;
+    const unsigned char *data;
 
     *error_ptr = HTTPSRV_FS_OK;
     if (file_fd_ptr->DEV_DATA_PTR == NULL)
@@ -387,9 +470,8 @@ static uint32_t httpsrv_fs_read(
     {
         num_bytes = file_fd_ptr->SIZE - file_fd_ptr->LOCATION;
     }
-    data = ((HTTPSRV_FS_DIR_ENTRY_PTR)file_fd_ptr->DEV_DATA_PTR)->DATA + file_fd_ptr->LOCATION;
-    for (i = num_bytes; i != 0; i--)
-        *buffer_address++ = *data++;
+    data = file_fd_ptr->DATA + file_fd_ptr->LOCATION;
+    memcpy(buffer_address, data, num_bytes);
     file_fd_ptr->LOCATION += num_bytes;
     return num_bytes;
 }
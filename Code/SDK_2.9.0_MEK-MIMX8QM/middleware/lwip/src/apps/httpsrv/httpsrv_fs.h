@@ -72,6 +72,9 @@
 #define IO_IOCTL_HTTPSRV_FS_GET_CURRENT_DATA_PTR (0x05)
 
 #define IO_IOCTL_HTTPSRV_FS_SEEK (0x06)
+#define IO_IOCTL_HTTPSRV_FS_GET_ETAG (0x07)
+#define IO_IOCTL_HTTPSRV_FS_HAS_GZIP (0x08)
+#define IO_IOCTL_HTTPSRV_FS_SET_GZIP (0x09)
 
 /*
  * Seek parameters
@@ -82,6 +85,12 @@
 
 /*
 ** HTTP_SRV directory entry information
+**
+** Tables generated by mkfs.pl are sorted by name (see httpsrv_fs_cmp) so that
+** files are found by binary search, unsorted tables are searched linearly.
+** The trailing fields are optional and zero when not present: a gzip
+** compressed copy of the data and the strong entity tags (quoted strings)
+** of the plain and compressed data.
 */
 typedef struct httpsrv_fs_dir_entry
 {
@@ -89,6 +98,10 @@ typedef struct httpsrv_fs_dir_entry
     uint32_t FLAGS;
     unsigned char *DATA;
     uint32_t SIZE;
+    unsigned char *GZ_DATA;
+    uint32_t GZ_SIZE;
+    char *ETAG;
+    char *GZ_ETAG;
 } HTTPSRV_FS_DIR_ENTRY, *HTTPSRV_FS_DIR_ENTRY_PTR;
 
 /* FILE STRUCTURE */
@@ -110,6 +123,12 @@ typedef struct httpsrv_fs_file
 
     /*! \brief The current size of the file. */
     size_t SIZE;
+
+    /*! \brief Data read from the file, plain or gzip compressed. */
+    const unsigned char *DATA;
+
+    /*! \brief Entity tag of the data read, NULL if unknown. */
+    const char *ETAG;
 } HTTPSRV_FS_FILE, *HTTPSRV_FS_FILE_PTR;
 
 #ifdef __cplusplus
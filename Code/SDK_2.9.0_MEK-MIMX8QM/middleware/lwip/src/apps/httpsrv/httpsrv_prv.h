@@ -38,6 +38,9 @@
 #define HTTPSRV_FLAG_KEEP_ALIVE_ENABLED (1 << 6) /* Keep-alive enabled/disabled for session */
 #define HTTPSRV_FLAG_HAS_CONTENT_LENGTH (1 << 7) /* Flag signalizing presence of Content-Length in request. */
 #define HTTPSRV_FLAG_HEADER_SENT (1 << 8)        /* Flag signalizing if response header was sent. */
+#define HTTPSRV_FLAG_ACCEPT_GZIP (1 << 9)        /* Client accepts gzip content encoding. */
+#define HTTPSRV_FLAG_HAS_GZIP (1 << 10)          /* Response depends on accepted content encoding. */
+#define HTTPSRV_FLAG_IS_GZIP (1 << 11)           /* Response entity is gzip encoded. */
 
 /*
 **  Wildcard typedef for CGI/SSI callback prototype
@@ -118,6 +121,7 @@ typedef struct httpsrv_req_struct
     char *query;                     /* Data send in URL */
     HTTPSRV_AUTH_USER_STRUCT auth;   /* Authentication credentials received from client */
     HTTPSRV_UPGRADE_PROT upgrade_to; /* Protocol to upgrade to. Zero = no upgrade. */
+    char if_none_match[HTTPSRV_CFG_IF_NONE_MATCH_SIZE]; /* Entity tags the client has cached. */
 } HTTPSRV_REQ_STRUCT;
 
 /*
@@ -131,6 +135,7 @@ typedef struct httpsrv_res_struct
     const HTTPSRV_AUTH_REALM_STRUCT *auth_realm; /* Authentication realm */
     int content_type;                            /* Content type */
     char script_buffer[3];                       /* Buffer for script tag search. */
+    const char *etag;                            /* Entity tag of the file sent */
 } HTTPSRV_RES_STRUCT;
 
 /*
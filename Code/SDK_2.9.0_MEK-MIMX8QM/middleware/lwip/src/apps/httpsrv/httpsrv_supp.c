@@ -687,6 +687,18 @@ void httpsrv_sendhdr(HTTPSRV_SESSION_STRUCT *session, int32_t content_len, bool
         httpsrv_print(session, "Content-Type: %s\r\n",
                       httpsrv_get_table_str((HTTPSRV_TABLE_ROW *)content_type, session->response.content_type));
     }
+    if (session->flags & HTTPSRV_FLAG_IS_GZIP)
+    {
+        httpsrv_print(session, "Content-Encoding: gzip\r\n");
+    }
+    if (session->flags & HTTPSRV_FLAG_HAS_GZIP)
+    {
+        httpsrv_print(session, "Vary: Accept-Encoding\r\n");
+    }
+    if (session->response.etag != NULL)
+    {
+        httpsrv_print(session, "ETag: %s\r\n", session->response.etag);
+    }
 
     if (session->response.status_code != HTTPSRV_CODE_UPGRADE)
     {
@@ -827,6 +839,56 @@ NO_EXT:
     session->flags &= ~HTTPSRV_FLAG_IS_CACHEABLE;
 }
 
+/*
+** Select the representation of a static file to send: gzip encoded data if
+** the file system has it and the client accepts it. Compare the entity tag
+** with the ones cached by the client, if it matches the response is
+** "304 Not Modified" without any entity.
+** Output of server side includes is generated and never validated.
+**
+** IN/OUT:
+**      HTTPSRV_SESSION_STRUCT* session - session with opened response file
+**
+** Return Value:
+**      none
+*/
+void httpsrv_file_select(HTTPSRV_SESSION_STRUCT *session)
+{
+    HTTPSRV_FS_FILE_PTR file = session->response.file;
+    const char *etag = NULL;
+    bool has_gzip = false;
+    char *ext;
+
+    ext = strrchr(session->request.path, '.');
+    if ((ext != NULL) && ((0 == lwip_stricmp(ext, ".shtml")) || (0 == lwip_stricmp(ext, ".shtm"))))
+    {
+        return;
+    }
+
+    if ((HTTPSRV_FS_ioctl(file, IO_IOCTL_HTTPSRV_FS_HAS_GZIP, &has_gzip) == HTTPSRV_FS_OK) && has_gzip)
+    {
+        session->flags |= HTTPSRV_FLAG_HAS_GZIP;
+        if ((session->flags & HTTPSRV_FLAG_ACCEPT_GZIP) &&
+            (HTTPSRV_FS_ioctl(file, IO_IOCTL_HTTPSRV_FS_SET_GZIP, NULL) == HTTPSRV_FS_OK))
+        {
+            session->flags |= HTTPSRV_FLAG_IS_GZIP;
+        }
+    }
+
+    if ((HTTPSRV_FS_ioctl(file, IO_IOCTL_HTTPSRV_FS_GET_ETAG, &etag) != HTTPSRV_FS_OK) || (etag == NULL))
+    {
+        return;
+    }
+    session->response.etag = etag;
+
+    if ((strcmp(session->request.if_none_match, "*") == 0) || (strstr(session->request.if_none_match, etag) != NULL))
+    {
+        /* Same cache control as the full response would have */
+        httpsrv_process_file_type(ext, session);
+        session->response.status_code = HTTPSRV_CODE_NOT_MODIFIED;
+    }
+}
+
 /*
 ** Send file to client
 **
@@ -1364,6 +1426,32 @@ int32_t httpsrv_req_hdr(HTTPSRV_SESSION_STRUCT *session, char *buffer)
         session->request.content_length = (uint32_t)value;
         session->flags |= HTTPSRV_FLAG_HAS_CONTENT_LENGTH;
     }
+    else if (strncmp(buffer, "Accept-Encoding: ", 17) == 0)
+    {
+        param_ptr = strstr(buffer + 17, "gzip");
+        if (param_ptr != NULL)
+        {
+            session->flags |= HTTPSRV_FLAG_ACCEPT_GZIP;
+            /* "gzip;q=0" refuses the encoding */
+            param_ptr += 4;
+            if (strncmp(param_ptr, ";q=0", 4) == 0)
+            {
+                param_ptr += 3 + strspn(param_ptr + 3, "0.");
+                if ((*param_ptr == '\0') || (*param_ptr == ',') || (*param_ptr == ' '))
+                {
+                    session->flags &= ~HTTPSRV_FLAG_ACCEPT_GZIP;
+                }
+            }
+        }
+    }
+    else if (strncmp(buffer, "If-None-Match: ", 15) == 0)
+    {
+        param_ptr = buffer + 15;
+        if (strlen(param_ptr) < sizeof(session->request.if_none_match))
+        {
+            strcpy(session->request.if_none_match, param_ptr);
+        }
+    }
     else if (strncmp(buffer, "Content-Type: ", 14) == 0)
     {
         param_ptr = buffer + 14;
@@ -27,6 +27,7 @@ int32_t httpsrv_ses_flush(HTTPSRV_SESSION_STRUCT *session);
 
 void httpsrv_sendhdr(HTTPSRV_SESSION_STRUCT *session, int32_t content_len, bool has_entity);
 HTTPSRV_SES_STATE httpsrv_sendfile(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_STRUCT *session);
+void httpsrv_file_select(HTTPSRV_SESSION_STRUCT *session);
 void httpsrv_send_err_page(HTTPSRV_SESSION_STRUCT *session, const char *title, const char *text);
 
 int32_t httpsrv_req_hdr(HTTPSRV_SESSION_STRUCT *session, char *buffer);
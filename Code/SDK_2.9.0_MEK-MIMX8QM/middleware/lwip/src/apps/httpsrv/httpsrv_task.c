@@ -465,6 +465,7 @@ void httpsrv_http_process(void *server_ptr, void *session_ptr)
                 }
                 session->request.auth.user_id = NULL;
                 session->request.auth.password = NULL;
+                session->request.if_none_match[0] = '\0';
                 session->time = sys_now();
                 session->timeout = HTTPSRV_CFG_KEEPALIVE_TIMEOUT;
                 session->flags = HTTPSRV_FLAG_IS_KEEP_ALIVE | HTTPSRV_FLAG_PROCESS_HEADER;
@@ -722,6 +723,10 @@ static HTTPSRV_SES_STATE httpsrv_req_do(HTTPSRV_STRUCT *server, HTTPSRV_SESSION_
     {
         session->response.status_code = HTTPSRV_CODE_NOT_FOUND;
     }
+    else
+    {
+        httpsrv_file_select(session);
+    }
     httpsrv_mem_free(full_path);
 
 EXIT:
@@ -771,6 +776,9 @@ static HTTPSRV_SES_STATE httpsrv_response(HTTPSRV_STRUCT *server, HTTPSRV_SESSIO
                 retval = httpsrv_sendfile(server, session);
             }
             break;
+        case HTTPSRV_CODE_NOT_MODIFIED:
+            httpsrv_sendhdr(session, 0, 0);
+            break;
         case HTTPSRV_CODE_UNAUTHORIZED:
             httpsrv_send_err_page(session, "Unauthorized", "Unauthorized!");
             break;
@@ -36,20 +36,31 @@
 # (pages, pictures, ...) in C constant arrays. Separate C files can be created for selected
 # input files.
 #
+# Entries are sorted by name the way HTTPSRV_FS compares paths, which lets the
+# server look them up by binary search. Every entry gets a strong ETag computed
+# from its content. With -z, text files (html, css, js, ...) are also stored
+# gzip compressed when that makes them smaller; the server sends the compressed
+# body to clients accepting gzip encoding.
+#
 # Perl:
-# 	perl mkfs.pl -s <separate_file> <input directory>
+# 	perl mkfs.pl [-z] -s <separate_file> <input directory>
 #
-# 	Example: perl mkfs.pl -s image.bmp my_web
+# 	Example: perl mkfs.pl -z -s image.bmp my_web
 
 
 use File::Find;
 use File::Compare;
+use Digest::MD5 qw(md5_hex);
+
+# Files worth compressing, server side includes (shtml) are parsed by the server and stay plain.
+%GZIP_TYPES = map { $_ => 1 } qw(htm html css js json svg txt xml csv);
 
 
 # Get input
 
 %SEPARATE_FILES = ();
 $INPUT_DIR = "";
+$GZIP = 0;
 while(@ARGV)
 {
   if ($ARGV[0] =~ /^-s$/)
@@ -59,6 +70,8 @@ while(@ARGV)
     $tmp = $ARGV[0];
     $tmp =~ s#\\#/#g;
     $SEPARATE_FILES{$tmp} = 1;
+  } elsif ($ARGV[0] =~ /^-z$/) {
+    $GZIP = 1;
   } else {
     $INPUT_DIR = $ARGV[0];
     shift @ARGV;
@@ -74,18 +87,25 @@ if (($INPUT_DIR =~ /^$/) || (@ARGV))
   my $readme =
       "\tThis tool creates C language source file httpsrv_fs_data.c with\n".
       "\tconstant arrays of binary data of all input directory files.\n".
-      "\tData of selected files can be stored in separate C files.\n";
+      "\tData of selected files can be stored in separate C files.\n".
+      "\t-z stores gzip compressed copies of text files as well.\n";
 
   print "$readme\n";
   print "Usage:\n";
-  print "mkfs.pl [-s <separate_file>] <input_directory>\n";
+  print "mkfs.pl [-z] [-s <separate_file>] <input_directory>\n";
   exit(0);
 }
 
+if ($GZIP)
+{
+  require IO::Compress::Gzip;
+}
+
 # Gather files
 
 @INPUT_FILES = ();
 find (\&get_files, $INPUT_DIR);
+@INPUT_FILES = sort { &fs_key($a) cmp &fs_key($b) } @INPUT_FILES;
 
 # Open httpsrv_fs_data.tmp for writing
 
@@ -120,12 +140,18 @@ foreach $file (@INPUT_FILES)
 {
   $fvar = "httpsrv_fs_" . $file;
   $fvar =~ s#[/\.]#_#g;
-  $dest = $file;
-  $dest =~ s/^$INPUT_DIR//;
+  $dest = &fs_name($file);
   print(OUTPUT "\t{ \"${dest}\", 0, ");
-  print(OUTPUT "(unsigned char*)${fvar}, sizeof(${fvar}) },\n");
+  print(OUTPUT "(unsigned char*)${fvar}, sizeof(${fvar}), ");
+  if ($GZIP_ETAG{$file})
+  {
+    print(OUTPUT "(unsigned char*)${fvar}_gz, sizeof(${fvar}_gz), ");
+    print(OUTPUT "\"\\\"$ETAG{$file}\\\"\", \"\\\"$GZIP_ETAG{$file}\\\"\" },\n");
+  } else {
+    print(OUTPUT "0, 0, \"\\\"$ETAG{$file}\\\"\", 0 },\n");
+  }
 }
-print(OUTPUT "\t{ 0, 0, 0, 0 }\n};\n\n");
+print(OUTPUT "\t{ 0, 0, 0, 0, 0, 0, 0, 0 }\n};\n\n");
 close(OUTPUT);
 
 # Rename temporary to *.c files
@@ -169,6 +195,41 @@ sub get_files
 }
 
 
+# Name of the file in the file system
+sub fs_name
+{
+  my ($file) = @_;
+
+  $file =~ s/^\Q$INPUT_DIR\E//;
+  return $file;
+}
+
+
+# Sort key matching httpsrv_fs_cmp(): case insensitive, '\' same as '/'
+sub fs_key
+{
+  my ($file) = @_;
+
+  $file = uc(&fs_name($file));
+  $file =~ s#\\#/#g;
+  return $file;
+}
+
+
+sub print_array
+{
+  my ($output, $data) = @_;
+  my $sep = "\t";
+  my $i;
+
+  for ($i = 0; $i < length($data); $i++)
+  {
+    printf($output "${sep}0x%02x", ord(substr($data, $i, 1)));
+    $sep = (($i % 10) == 9) ? ",\n\t" : ", ";
+  }
+}
+
+
 sub check_write_protect
 {
   my ($file) = @_;
@@ -195,6 +256,12 @@ sub process_file
   open(FILE, $file) or die "Can't open file ${file}!\n";
 
   binmode(FILE);
+  local $/;
+  my $data = <FILE>;
+  close(FILE);
+  $data = "" unless defined($data);
+
+  $ETAG{$file} = substr(md5_hex($data), 0, 16);
 
   $output = "OUTPUT";
   if ($separate)
@@ -208,25 +275,29 @@ sub process_file
   }
 
   print($output "\t/* $file */\n");
-
-  $sep = "\t";
-  while(read(FILE, $data, 10, 0))
-  {
-    foreach(split(//, $data))
-    {
-      printf($output "${sep}0x%02x", ord($_));
-      $sep = ", ";
-    }
-    $sep = ",\n\t";
-  }
-
+  &print_array($output, $data);
   print($output "\n};\n\n");
 
   if ($separate)
   {
     close($output);
   }
-  
-  close(FILE);
+
+  # Compressed copy, no file name nor time stamp in the header so the output is reproducible
+  if ($GZIP && ($file =~ /\.(\w+)$/) && $GZIP_TYPES{lc($1)})
+  {
+    my $gz;
+
+    IO::Compress::Gzip::gzip(\$data => \$gz, -Level => 9, Minimal => 1)
+      or die "Can't compress file ${file}!\n";
+    if (length($gz) < length($data))
+    {
+      $GZIP_ETAG{$file} = substr(md5_hex($gz), 0, 16);
+      print(OUTPUT "static const unsigned char " . $fvar . "_gz[] = {\n");
+      print(OUTPUT "\t/* $file, gzip */\n");
+      &print_array("OUTPUT", $gz);
+      print(OUTPUT "\n};\n\n");
+    }
+  }
 }
 
@@ -190,6 +190,22 @@ mqtt_ringbuf_put(struct mqtt_ringbuf_t *rb, u8_t item)
   }
 }
 
+/** Add data to ring buffer, at most two copies depending on wrap around */
+static void
+mqtt_ringbuf_put_buf(struct mqtt_ringbuf_t *rb, const void *data, u16_t len)
+{
+  u16_t lin_len = (u16_t)(MQTT_OUTPUT_RINGBUF_SIZE - rb->put);
+
+  if (len >= lin_len) {
+    MEMCPY(&rb->buf[rb->put], data, lin_len);
+    MEMCPY(&rb->buf[0], (const u8_t *)data + lin_len, len - lin_len);
+    rb->put = (u16_t)(len - lin_len);
+  } else {
+    MEMCPY(&rb->buf[rb->put], data, len);
+    rb->put = (u16_t)(rb->put + len);
+  }
+}
+
 /** Return pointer to ring buffer get position */
 static u8_t *
 mqtt_ringbuf_get_ptr(struct mqtt_ringbuf_t *rb)
@@ -219,56 +235,145 @@ mqtt_ringbuf_len(struct mqtt_ringbuf_t *rb)
   return (u16_t)len;
 }
 
-/** Return number of bytes free in ring buffer */
-#define mqtt_ringbuf_free(rb) (MQTT_OUTPUT_RINGBUF_SIZE - mqtt_ringbuf_len(rb))
+/** Return number of bytes free in ring buffer, one byte is kept free so a full buffer does not look empty */
+#define mqtt_ringbuf_free(rb) (MQTT_OUTPUT_RINGBUF_SIZE - 1 - mqtt_ringbuf_len(rb))
 
 /** Return number of bytes possible to read without wrapping around */
 #define mqtt_ringbuf_linear_read_length(rb) LWIP_MIN(mqtt_ringbuf_len(rb), (MQTT_OUTPUT_RINGBUF_SIZE - (rb)->get))
 
+/** Return the payload sent by reference of a QoS 1 or 2 publish, NULL if none or already released */
+static struct mqtt_output_ref_t *
+mqtt_output_find_ref(mqtt_client_t *client, u16_t pkt_id)
+{
+  u8_t n;
+  if (pkt_id == 0) {
+    return NULL;
+  }
+  for (n = 0; n < client->out_ref_count; n++) {
+    struct mqtt_output_ref_t *ref = &client->out_refs[(client->out_ref_first + n) % MQTT_OUTPUT_REF_MAX];
+    if (ref->pkt_id == pkt_id) {
+      return ref;
+    }
+  }
+  return NULL;
+}
+
+/** Return the payload sent by reference which is next to be written, NULL if none */
+static struct mqtt_output_ref_t *
+mqtt_output_next_ref(mqtt_client_t *client)
+{
+  if (client->out_ref_written >= client->out_ref_count) {
+    return NULL;
+  }
+  return &client->out_refs[(client->out_ref_first + client->out_ref_written) % MQTT_OUTPUT_REF_MAX];
+}
+
 /**
- * Try send as many bytes as possible from output ring buffer
- * @param rb Output ring buffer
- * @param tpcb TCP connection handle
+ * Try send as many bytes as possible from output ring buffer and payloads sent by reference.
+ * Ring buffer bytes are copied into TCP, referenced payloads are written without copy
+ * in between them at the position they were queued at.
+ * @param client MQTT client
  */
 static void
-mqtt_output_send(struct mqtt_ringbuf_t *rb, struct altcp_pcb *tpcb)
+mqtt_output_send(mqtt_client_t *client)
 {
-  err_t err;
-  u8_t wrap = 0;
-  u16_t ringbuf_lin_len = mqtt_ringbuf_linear_read_length(rb);
-  u16_t send_len = altcp_sndbuf(tpcb);
+  struct mqtt_ringbuf_t *rb = &client->output;
+  struct altcp_pcb *tpcb = client->conn;
+  struct mqtt_output_ref_t *ref;
+  err_t err = ERR_OK;
+  u8_t written = 0;
   LWIP_ASSERT("mqtt_output_send: tpcb != NULL", tpcb != NULL);
 
-  if (send_len == 0 || ringbuf_lin_len == 0) {
-    return;
-  }
+  while (err == ERR_OK) {
+    u16_t send_len = altcp_sndbuf(tpcb);
+    u16_t ring_len;
+    u8_t more;
 
-  LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_output_send: tcp_sndbuf: %d bytes, ringbuf_linear_available: %d, get %d, put %d\n",
-                                 send_len, ringbuf_lin_len, rb->get, rb->put));
+    ref = mqtt_output_next_ref(client);
+    ring_len = (ref != NULL) ? ref->ring_before : mqtt_ringbuf_len(rb);
+    if (send_len == 0 || (ring_len == 0 && ref == NULL)) {
+      break;
+    }
 
-  if (send_len > ringbuf_lin_len) {
-    /* Space in TCP output buffer is larger than available in ring buffer linear portion */
-    send_len = ringbuf_lin_len;
-    /* Wrap around if more data in ring buffer after linear portion */
-    wrap = (mqtt_ringbuf_len(rb) > ringbuf_lin_len);
-  }
-  err = altcp_write(tpcb, mqtt_ringbuf_get_ptr(rb), send_len, TCP_WRITE_FLAG_COPY | (wrap ? TCP_WRITE_FLAG_MORE : 0));
-  if ((err == ERR_OK) && wrap) {
-    mqtt_ringbuf_advance_get_idx(rb, send_len);
-    /* Use the lesser one of ring buffer linear length and TCP send buffer size */
-    send_len = LWIP_MIN(altcp_sndbuf(tpcb), mqtt_ringbuf_linear_read_length(rb));
-    err = altcp_write(tpcb, mqtt_ringbuf_get_ptr(rb), send_len, TCP_WRITE_FLAG_COPY);
+    LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_output_send: tcp_sndbuf: %d bytes, ringbuf: %d, get %d, put %d, ref: %s\n",
+                                   send_len, ring_len, rb->get, rb->put, (ref != NULL) ? "yes" : "no"));
+
+    if (ring_len > 0) {
+      /* Copy ring buffer bytes in front of next referenced payload */
+      ring_len = LWIP_MIN(ring_len, mqtt_ringbuf_linear_read_length(rb));
+      send_len = LWIP_MIN(send_len, ring_len);
+      more = (ref != NULL) || (mqtt_ringbuf_len(rb) > send_len);
+      err = altcp_write(tpcb, mqtt_ringbuf_get_ptr(rb), send_len, TCP_WRITE_FLAG_COPY | (more ? TCP_WRITE_FLAG_MORE : 0));
+      if (err == ERR_OK) {
+        mqtt_ringbuf_advance_get_idx(rb, send_len);
+        if (ref != NULL) {
+          ref->ring_before -= send_len;
+          client->out_ref_ring -= send_len;
+        }
+      }
+    } else if (ref->written == ref->len) {
+      /* Empty payload */
+      ref->end_pos = client->out_written;
+      client->out_ref_written++;
+      continue;
+    } else {
+      /* Referenced payload, TCP keeps pointing at it until acknowledged */
+      if (send_len > ref->len - ref->written) {
+        send_len = (u16_t)(ref->len - ref->written);
+      }
+      more = (ref->written + send_len < ref->len) || (mqtt_ringbuf_len(rb) > client->out_ref_ring);
+      err = altcp_write(tpcb, ref->data + ref->written, send_len, more ? TCP_WRITE_FLAG_MORE : 0);
+      if (err == ERR_OK) {
+        ref->written += send_len;
+        if (ref->written == ref->len) {
+          ref->end_pos = client->out_written + send_len;
+          client->out_ref_written++;
+        }
+      }
+    }
+    if (err == ERR_OK) {
+      client->out_written += send_len;
+      written = 1;
+    }
   }
 
-  if (err == ERR_OK) {
-    mqtt_ringbuf_advance_get_idx(rb, send_len);
+  if (written) {
     /* Flush */
     altcp_output(tpcb);
-  } else {
+  }
+  if (err != ERR_OK) {
     LWIP_DEBUGF(MQTT_DEBUG_WARN, ("mqtt_output_send: Send failed with err %d (\"%s\")\n", err, lwip_strerr(err)));
   }
 }
 
+/**
+ * Account acknowledged output bytes and release payloads sent by reference
+ * @param client MQTT client
+ * @param len Number of bytes acknowledged
+ */
+static void
+mqtt_output_acked(mqtt_client_t *client, u16_t len)
+{
+  client->out_acked += len;
+  while (client->out_ref_written > 0) {
+    struct mqtt_output_ref_t *ref = &client->out_refs[client->out_ref_first];
+    mqtt_request_cb_t cb = ref->cb;
+    void *arg = ref->arg;
+
+    if ((s32_t)(client->out_acked - ref->end_pos) < 0) {
+      break;
+    }
+    client->out_ref_first = (u8_t)((client->out_ref_first + 1) % MQTT_OUTPUT_REF_MAX);
+    client->out_ref_count--;
+    client->out_ref_written--;
+    /* Payload is no longer used by TCP: QoS 0 publish has no response from server,
+       a timed out QoS 1 or 2 publish was held until now */
+    if (cb != NULL) {
+      cb(arg, ref->err);
+    }
+  }
+}
+
 
 
 /*--------------------------------------------------------------------------------------------------------------------- */
@@ -276,29 +381,22 @@ mqtt_output_send(struct mqtt_ringbuf_t *rb, struct altcp_pcb *tpcb)
 
 /**
  * Create request item
- * @param r_objs Pointer to request objects
- * @param r_objs_len Number of array entries
+ * @param client MQTT client
  * @param pkt_id Packet identifier of request
  * @param cb Packet callback to call when requests lifetime ends
  * @param arg Parameter following callback
  * @return Request or NULL if failed to create
  */
 static struct mqtt_request_t *
-mqtt_create_request(struct mqtt_request_t *r_objs, size_t r_objs_len, u16_t pkt_id, mqtt_request_cb_t cb, void *arg)
+mqtt_create_request(mqtt_client_t *client, u16_t pkt_id, mqtt_request_cb_t cb, void *arg)
 {
-  struct mqtt_request_t *r = NULL;
-  u8_t n;
-  LWIP_ASSERT("mqtt_create_request: r_objs != NULL", r_objs != NULL);
-  for (n = 0; n < r_objs_len; n++) {
-    /* Item point to itself if not in use */
-    if (r_objs[n].next == &r_objs[n]) {
-      r = &r_objs[n];
-      r->next = NULL;
-      r->cb = cb;
-      r->arg = arg;
-      r->pkt_id = pkt_id;
-      break;
-    }
+  struct mqtt_request_t *r = client->req_free;
+  if (r != NULL) {
+    client->req_free = r->next;
+    r->next = NULL;
+    r->cb = cb;
+    r->arg = arg;
+    r->pkt_id = pkt_id;
   }
   return r;
 }
@@ -306,59 +404,50 @@ mqtt_create_request(struct mqtt_request_t *r_objs, size_t r_objs_len, u16_t pkt_
 
 /**
  * Append request to pending request queue
- * @param tail Pointer to request queue tail pointer
+ * @param client MQTT client
  * @param r Request to append
  */
 static void
-mqtt_append_request(struct mqtt_request_t **tail, struct mqtt_request_t *r)
+mqtt_append_request(mqtt_client_t *client, struct mqtt_request_t *r)
 {
-  struct mqtt_request_t *head = NULL;
-  s16_t time_before = 0;
-  struct mqtt_request_t *iter;
-
-  LWIP_ASSERT("mqtt_append_request: tail != NULL", tail != NULL);
-
-  /* Iterate trough queue to find head, and count total timeout time */
-  for (iter = *tail; iter != NULL; iter = iter->next) {
-    time_before += iter->timeout_diff;
-    head = iter;
-  }
-
-  LWIP_ASSERT("mqtt_append_request: time_before <= MQTT_REQ_TIMEOUT", time_before <= MQTT_REQ_TIMEOUT);
-  r->timeout_diff = MQTT_REQ_TIMEOUT - time_before;
-  if (head == NULL) {
-    *tail = r;
+  /* Requests expire in the order they are appended, so the queue stays sorted by timeout */
+  r->next = NULL;
+  r->timeout = (u16_t)(client->req_clock + MQTT_REQ_TIMEOUT);
+  if (client->pend_req_last == NULL) {
+    client->pend_req_queue = r;
   } else {
-    head->next = r;
+    client->pend_req_last->next = r;
   }
+  client->pend_req_last = r;
 }
 
 
 /**
  * Delete request item
+ * @param client MQTT client
  * @param r Request item to delete
  */
 static void
-mqtt_delete_request(struct mqtt_request_t *r)
+mqtt_delete_request(mqtt_client_t *client, struct mqtt_request_t *r)
 {
   if (r != NULL) {
-    r->next = r;
+    r->next = client->req_free;
+    client->req_free = r;
   }
 }
 
 /**
  * Remove a request item with a specific packet identifier from request queue
- * @param tail Pointer to request queue tail pointer
+ * @param client MQTT client
  * @param pkt_id Packet identifier of request to take
  * @return Request item if found, NULL if not
  */
 static struct mqtt_request_t *
-mqtt_take_request(struct mqtt_request_t **tail, u16_t pkt_id)
+mqtt_take_request(mqtt_client_t *client, u16_t pkt_id)
 {
   struct mqtt_request_t *iter = NULL, *prev = NULL;
-  LWIP_ASSERT("mqtt_take_request: tail != NULL", tail != NULL);
-  /* Search all request for pkt_id */
-  for (iter = *tail; iter != NULL; iter = iter->next) {
+  /* Search all request for pkt_id, responses mostly arrive in order so this is usually the first one */
+  for (iter = client->pend_req_queue; iter != NULL; iter = iter->next) {
     if (iter->pkt_id == pkt_id) {
       break;
     }
@@ -369,13 +458,12 @@ mqtt_take_request(struct mqtt_request_t **tail, u16_t pkt_id)
   if (iter != NULL) {
     /* unchain */
     if (prev == NULL) {
-      *tail = iter->next;
+      client->pend_req_queue = iter->next;
     } else {
       prev->next = iter->next;
     }
-    /* If exists, add remaining timeout time for the request to next */
-    if (iter->next != NULL) {
-      iter->next->timeout_diff += iter->timeout_diff;
+    if (client->pend_req_last == iter) {
+      client->pend_req_last = prev;
     }
     iter->next = NULL;
   }
@@ -384,62 +472,63 @@ mqtt_take_request(struct mqtt_request_t **tail, u16_t pkt_id)
 
 /**
  * Handle requests timeout
- * @param tail Pointer to request queue tail pointer
+ * @param client MQTT client
  * @param t Time since last call in seconds
  */
 static void
-mqtt_request_time_elapsed(struct mqtt_request_t **tail, u8_t t)
+mqtt_request_time_elapsed(mqtt_client_t *client, u8_t t)
 {
   struct mqtt_request_t *r;
-  LWIP_ASSERT("mqtt_request_time_elapsed: tail != NULL", tail != NULL);
-  r = *tail;
-  while (t > 0 && r != NULL) {
-    if (t >= r->timeout_diff) {
-      t -= (u8_t)r->timeout_diff;
-      /* Unchain */
-      *tail = r->next;
+  struct mqtt_output_ref_t *ref;
+
+  client->req_clock = (u16_t)(client->req_clock + t);
+  /* Queue might be be modified in callback, so re-read it in every iteration */
+  while (((r = client->pend_req_queue) != NULL) && ((s16_t)(client->req_clock - r->timeout) >= 0)) {
+    /* Unchain */
+    client->pend_req_queue = r->next;
+    if (r->next == NULL) {
+      client->pend_req_last = NULL;
+    }
+    ref = mqtt_output_find_ref(client, r->pkt_id);
+    if (ref != NULL) {
+      /* TCP still uses the payload sent by reference, notify upper layer when it is released */
+      ref->cb = r->cb;
+      ref->arg = r->arg;
+      ref->err = ERR_TIMEOUT;
+    } else if (r->cb != NULL) {
       /* Notify upper layer about timeout */
-      if (r->cb != NULL) {
-        r->cb(r->arg, ERR_TIMEOUT);
-      }
-      mqtt_delete_request(r);
-      /* Tail might be be modified in callback, so re-read it in every iteration */
-      r = *(struct mqtt_request_t *const volatile *)tail;
-    } else {
-      r->timeout_diff -= t;
-      t = 0;
+      r->cb(r->arg, ERR_TIMEOUT);
     }
+    mqtt_delete_request(client, r);
   }
 }
 
 /**
  * Free all request items
- * @param tail Pointer to request queue tail pointer
+ * @param client MQTT client
  */
 static void
-mqtt_clear_requests(struct mqtt_request_t **tail)
+mqtt_clear_requests(mqtt_client_t *client)
 {
   struct mqtt_request_t *iter, *next;
-  LWIP_ASSERT("mqtt_clear_requests: tail != NULL", tail != NULL);
-  for (iter = *tail; iter != NULL; iter = next) {
+  for (iter = client->pend_req_queue; iter != NULL; iter = next) {
     next = iter->next;
-    mqtt_delete_request(iter);
+    mqtt_delete_request(client, iter);
   }
-  *tail = NULL;
+  client->pend_req_queue = NULL;
+  client->pend_req_last = NULL;
 }
 /**
  * Initialize all request items
- * @param r_objs Pointer to request objects
- * @param r_objs_len Number of array entries
+ * @param client MQTT client
  */
 static void
-mqtt_init_requests(struct mqtt_request_t *r_objs, size_t r_objs_len)
+mqtt_init_requests(mqtt_client_t *client)
 {
-  u8_t n;
-  LWIP_ASSERT("mqtt_init_requests: r_objs != NULL", r_objs != NULL);
-  for (n = 0; n < r_objs_len; n++) {
-    /* Item pointing to itself indicates unused */
-    r_objs[n].next = &r_objs[n];
+  size_t n;
+  client->req_free = NULL;
+  for (n = 0; n < LWIP_ARRAYSIZE(client->req_list); n++) {
+    mqtt_delete_request(client, &client->req_list[n]);
   }
 }
 
@@ -456,28 +545,23 @@ mqtt_output_append_u8(struct mqtt_ringbuf_t *rb, u8_t value)
 static
 void mqtt_output_append_u16(struct mqtt_ringbuf_t *rb, u16_t value)
 {
-  mqtt_ringbuf_put(rb, value >> 8);
-  mqtt_ringbuf_put(rb, value & 0xff);
+  u8_t buf[2];
+  buf[0] = (u8_t)(value >> 8);
+  buf[1] = (u8_t)(value & 0xff);
+  mqtt_ringbuf_put_buf(rb, buf, sizeof(buf));
 }
 
 static void
 mqtt_output_append_buf(struct mqtt_ringbuf_t *rb, const void *data, u16_t length)
 {
-  u16_t n;
-  for (n = 0; n < length; n++) {
-    mqtt_ringbuf_put(rb, ((const u8_t *)data)[n]);
-  }
+  mqtt_ringbuf_put_buf(rb, data, length);
 }
 
 static void
 mqtt_output_append_string(struct mqtt_ringbuf_t *rb, const char *str, u16_t length)
 {
-  u16_t n;
-  mqtt_ringbuf_put(rb, length >> 8);
-  mqtt_ringbuf_put(rb, length & 0xff);
-  for (n = 0; n < length; n++) {
-    mqtt_ringbuf_put(rb, str[n]);
-  }
+  mqtt_output_append_u16(rb, length);
+  mqtt_ringbuf_put_buf(rb, str, length);
 }
 
 /**
@@ -492,15 +576,38 @@ mqtt_output_append_string(struct mqtt_ringbuf_t *rb, const char *str, u16_t leng
 
 static void
 mqtt_output_append_fixed_header(struct mqtt_ringbuf_t *rb, u8_t msg_type, u8_t fdup,
-                                u8_t fqos, u8_t fretain, u16_t r_length)
+                                u8_t fqos, u8_t fretain, u32_t r_length)
 {
+  u8_t hdr[5];
+  u16_t len = 0;
   /* Start with control byte */
-  mqtt_output_append_u8(rb, (((msg_type & 0x0f) << 4) | ((fdup & 1) << 3) | ((fqos & 3) << 1) | (fretain & 1)));
+  hdr[len++] = (u8_t)(((msg_type & 0x0f) << 4) | ((fdup & 1) << 3) | ((fqos & 3) << 1) | (fretain & 1));
   /* Encode remaining length field */
   do {
-    mqtt_output_append_u8(rb, (r_length & 0x7f) | (r_length >= 128 ? 0x80 : 0));
+    hdr[len++] = (u8_t)((r_length & 0x7f) | (r_length >= 128 ? 0x80 : 0));
+    r_length >>= 7;
+  } while (r_length > 0 && len < sizeof(hdr));
+  mqtt_ringbuf_put_buf(rb, hdr, len);
+}
+
+
+/**
+ * Length of fixed header
+ * @param r_length Remaining length after fixed header
+ * @return Number of bytes of type byte and remaining length field
+ */
+static u16_t
+mqtt_output_fixed_header_len(u32_t r_length)
+{
+  /* Start with length of type byte */
+  u16_t len = 1;
+
+  /* Add number of required bytes to contain the remaining bytes field */
+  do {
+    len++;
     r_length >>= 7;
   } while (r_length > 0);
+  return len;
 }
 
 
@@ -513,18 +620,11 @@ mqtt_output_append_fixed_header(struct mqtt_ringbuf_t *rb, u8_t msg_type, u8_t f
 static u8_t
 mqtt_output_check_space(struct mqtt_ringbuf_t *rb, u16_t r_length)
 {
-  /* Start with length of type byte + remaining length */
-  u16_t total_len = 1 + r_length;
+  u32_t total_len = (u32_t)mqtt_output_fixed_header_len(r_length) + r_length;
 
   LWIP_ASSERT("mqtt_output_check_space: rb != NULL", rb != NULL);
 
-  /* Calculate number of required bytes to contain the remaining bytes field and add to total*/
-  do {
-    total_len++;
-    r_length >>= 7;
-  } while (r_length > 0);
-
-  return (total_len <= mqtt_ringbuf_free(rb));
+  return (total_len <= (u32_t)mqtt_ringbuf_free(rb));
 }
 
 
@@ -544,16 +644,25 @@ mqtt_close(mqtt_client_t *client, mqtt_connection_status_t reason)
     altcp_recv(client->conn, NULL);
     altcp_err(client->conn,  NULL);
     altcp_sent(client->conn, NULL);
-    res = altcp_close(client->conn);
-    if (res != ERR_OK) {
+    if (client->out_ref_count != 0) {
+      /* Queued segments point to payloads sent by reference, which are handed
+         back to the application below, so they must not be sent after closing */
       altcp_abort(client->conn);
-      LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_close: Close err=%s\n", lwip_strerr(res)));
+    } else {
+      res = altcp_close(client->conn);
+      if (res != ERR_OK) {
+        altcp_abort(client->conn);
+        LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_close: Close err=%s\n", lwip_strerr(res)));
+      }
     }
     client->conn = NULL;
   }
 
-  /* Remove all pending requests */
-  mqtt_clear_requests(&client->pend_req_queue);
+  /* Remove all pending requests and payloads sent by reference */
+  mqtt_clear_requests(client);
+  client->out_ref_count = 0;
+  client->out_ref_written = 0;
+  client->out_ref_ring = 0;
   /* Stop cyclic timer */
   sys_untimeout(mqtt_cyclic_timer, client);
 
@@ -589,7 +698,7 @@ mqtt_cyclic_timer(void *arg)
     }
   } else if (client->conn_state == MQTT_CONNECTED) {
     /* Handle timeout for pending requests */
-    mqtt_request_time_elapsed(&client->pend_req_queue, MQTT_CYCLIC_TIMER_INTERVAL);
+    mqtt_request_time_elapsed(client, MQTT_CYCLIC_TIMER_INTERVAL);
 
     /* keep_alive > 0 means keep alive functionality shall be used */
     if (client->keep_alive > 0) {
@@ -637,7 +746,7 @@ pub_ack_rec_rel_response(mqtt_client_t *client, u8_t msg, u16_t pkt_id, u8_t qos
   if (mqtt_output_check_space(&client->output, 2)) {
     mqtt_output_append_fixed_header(&client->output, msg, 0, qos, 0, 2);
     mqtt_output_append_u16(&client->output, pkt_id);
-    mqtt_output_send(&client->output, client->conn);
+    mqtt_output_send(client);
   } else {
     LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("pub_ack_rec_rel_response: OOM creating response: %s with pkt_id: %d\n",
                                    mqtt_msg_type_to_str(msg), pkt_id));
@@ -802,7 +911,7 @@ mqtt_message_received(mqtt_client_t *client, u8_t fixed_hdr_len, u16_t length, u
 
     } else if (pkt_type == MQTT_MSG_TYPE_SUBACK || pkt_type == MQTT_MSG_TYPE_UNSUBACK ||
                pkt_type == MQTT_MSG_TYPE_PUBCOMP || pkt_type == MQTT_MSG_TYPE_PUBACK) {
-      struct mqtt_request_t *r = mqtt_take_request(&client->pend_req_queue, pkt_id);
+      struct mqtt_request_t *r = mqtt_take_request(client, pkt_id);
       if (r != NULL) {
         LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_message_received: %s response with id %d\n", mqtt_msg_type_to_str(pkt_type), pkt_id));
         if (pkt_type == MQTT_MSG_TYPE_SUBACK) {
@@ -815,7 +924,7 @@ mqtt_message_received(mqtt_client_t *client, u8_t fixed_hdr_len, u16_t length, u
         } else if (r->cb != NULL) {
           r->cb(r->arg, ERR_OK);
         }
-        mqtt_delete_request(r);
+        mqtt_delete_request(client, r);
       } else {
         LWIP_DEBUGF(MQTT_DEBUG_WARN, ( "mqtt_message_received: Received %s reply, with wrong pkt_id: %d\n", mqtt_msg_type_to_str(pkt_type), pkt_id));
       }
@@ -983,7 +1092,9 @@ mqtt_tcp_sent_cb(void *arg, struct altcp_pcb *tpcb, u16_t len)
   mqtt_client_t *client = (mqtt_client_t *)arg;
 
   LWIP_UNUSED_ARG(tpcb);
-  LWIP_UNUSED_ARG(len);
+
+  /* Release payloads sent by reference */
+  mqtt_output_acked(client, len);
 
   if (client->conn_state == MQTT_CONNECTED) {
     struct mqtt_request_t *r;
@@ -992,15 +1103,15 @@ mqtt_tcp_sent_cb(void *arg, struct altcp_pcb *tpcb, u16_t len)
     client->cyclic_tick = 0;
     client->server_watchdog = 0;
     /* QoS 0 publish has no response from server, so call its callbacks here */
-    while ((r = mqtt_take_request(&client->pend_req_queue, 0)) != NULL) {
+    while ((r = mqtt_take_request(client, 0)) != NULL) {
       LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_tcp_sent_cb: Calling QoS 0 publish complete callback\n"));
       if (r->cb != NULL) {
         r->cb(r->arg, ERR_OK);
       }
-      mqtt_delete_request(r);
+      mqtt_delete_request(client, r);
     }
     /* Try send any remaining buffers from output queue */
-    mqtt_output_send(&client->output, client->conn);
+    mqtt_output_send(client);
   }
   return ERR_OK;
 }
@@ -1032,9 +1143,10 @@ static err_t
 mqtt_tcp_poll_cb(void *arg, struct altcp_pcb *tpcb)
 {
   mqtt_client_t *client = (mqtt_client_t *)arg;
+  LWIP_UNUSED_ARG(tpcb);
   if (client->conn_state == MQTT_CONNECTED) {
     /* Try send any remaining buffers from output queue */
-    mqtt_output_send(&client->output, tpcb);
+    mqtt_output_send(client);
   }
   return ERR_OK;
 }
@@ -1072,7 +1184,7 @@ mqtt_tcp_connect_cb(void *arg, struct altcp_pcb *tpcb, err_t err)
   client->cyclic_tick = 0;
 
   /* Start transmission from output queue, connect message is the first one out*/
-  mqtt_output_send(&client->output, client->conn);
+  mqtt_output_send(client);
 
   return ERR_OK;
 }
@@ -1132,13 +1244,13 @@ mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_
 
   LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_publish: Publish with payload length %d to topic \"%s\"\n", payload_length, topic));
 
-  r = mqtt_create_request(client->req_list, LWIP_ARRAYSIZE(client->req_list), pkt_id, cb, arg);
+  r = mqtt_create_request(client, pkt_id, cb, arg);
   if (r == NULL) {
     return ERR_MEM;
   }
 
   if (mqtt_output_check_space(&client->output, remaining_length) == 0) {
-    mqtt_delete_request(r);
+    mqtt_delete_request(client, r);
     return ERR_MEM;
   }
   /* Append fixed header */
@@ -1157,8 +1269,107 @@ mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_
     mqtt_output_append_buf(&client->output, payload, payload_length);
   }
 
-  mqtt_append_request(&client->pend_req_queue, r);
-  mqtt_output_send(&client->output, client->conn);
+  mqtt_append_request(client, r);
+  mqtt_output_send(client);
+  return ERR_OK;
+}
+
+
+/**
+ * @ingroup mqtt
+ * MQTT publish function sending the payload without copying it.
+ * Only the fixed header, topic and packet identifier are stored in the output
+ * ring-buffer, the payload is passed to TCP by reference. Unlike mqtt_publish(),
+ * the payload is not limited by MQTT_OUTPUT_RINGBUF_SIZE.
+ * The payload must stay valid and unmodified until the callback is called
+ * (for QoS 0 when TCP has received an acknowledge for it, for QoS 1 and 2 when
+ * the publish is complete, or has timed out and TCP has received an acknowledge
+ * for it) or until the connection callback reports a disconnect, the connection
+ * is aborted instead of closed in that case.
+ * @param client MQTT client
+ * @param topic Publish topic string
+ * @param payload Data to publish
+ * @param payload_length Length of payload (0 is allowed)
+ * @param qos Quality of service, 0 1 or 2
+ * @param retain MQTT retain flag
+ * @param cb Callback to call when publish is complete or has timed out
+ * @param arg User supplied argument to publish callback
+ * @return ERR_OK if successful
+ *         ERR_CONN if client is disconnected
+ *         ERR_MEM if short on memory, either ring-buffer space, request or
+ *         reference slots (see MQTT_REQ_MAX_IN_FLIGHT and MQTT_OUTPUT_REF_MAX)
+ */
+err_t
+mqtt_publish_ref(mqtt_client_t *client, const char *topic, const void *payload, u32_t payload_length, u8_t qos,
+                 u8_t retain, mqtt_request_cb_t cb, void *arg)
+{
+  struct mqtt_request_t *r = NULL;
+  struct mqtt_output_ref_t *ref;
+  u16_t pkt_id;
+  size_t topic_strlen;
+  u16_t topic_len;
+  u16_t header_len;
+  u32_t remaining_length;
+
+  LWIP_ASSERT_CORE_LOCKED();
+  LWIP_ASSERT("mqtt_publish_ref: client != NULL", client);
+  LWIP_ASSERT("mqtt_publish_ref: topic != NULL", topic);
+  LWIP_ASSERT("mqtt_publish_ref: payload != NULL", (payload != NULL) || (payload_length == 0));
+  LWIP_ERROR("mqtt_publish_ref: TCP disconnected", (client->conn_state != TCP_DISCONNECTED), return ERR_CONN);
+
+  topic_strlen = strlen(topic);
+  LWIP_ERROR("mqtt_publish_ref: topic length overflow", (topic_strlen <= (0xFFFF - 2 - 2 - 5)), return ERR_ARG);
+  topic_len = (u16_t)topic_strlen;
+  /* Variable header, stored in the ring buffer */
+  header_len = (u16_t)(2 + topic_len + ((qos > 0) ? 2 : 0));
+  /* Largest value of the 4 byte remaining length field */
+  LWIP_ERROR("mqtt_publish_ref: total length overflow", (payload_length <= (0x0FFFFFFFUL - header_len)), return ERR_ARG);
+  remaining_length = header_len + payload_length;
+
+  if (client->out_ref_count >= MQTT_OUTPUT_REF_MAX) {
+    return ERR_MEM;
+  }
+  if ((u32_t)mqtt_output_fixed_header_len(remaining_length) + header_len > (u32_t)mqtt_ringbuf_free(&client->output)) {
+    return ERR_MEM;
+  }
+  if (qos > 0) {
+    /* Generate pkt_id id for QoS1 and 2 */
+    pkt_id = msg_generate_packet_id(client);
+    r = mqtt_create_request(client, pkt_id, cb, arg);
+    if (r == NULL) {
+      return ERR_MEM;
+    }
+  } else {
+    pkt_id = 0;
+  }
+
+  LWIP_DEBUGF(MQTT_DEBUG_TRACE, ("mqtt_publish_ref: Publish with payload length %"U32_F" to topic \"%s\"\n", payload_length, topic));
+
+  mqtt_output_append_fixed_header(&client->output, MQTT_MSG_TYPE_PUBLISH, 0, qos, retain, remaining_length);
+  mqtt_output_append_string(&client->output, topic, topic_len);
+  if (qos > 0) {
+    mqtt_output_append_u16(&client->output, pkt_id);
+  }
+
+  /* Payload follows the ring buffer bytes queued so far */
+  ref = &client->out_refs[(client->out_ref_first + client->out_ref_count) % MQTT_OUTPUT_REF_MAX];
+  ref->data = (const u8_t *)payload;
+  ref->len = payload_length;
+  ref->written = 0;
+  ref->ring_before = (u16_t)(mqtt_ringbuf_len(&client->output) - client->out_ref_ring);
+  ref->end_pos = 0;
+  /* QoS 1 and 2 complete with the server response, QoS 0 when the payload is released */
+  ref->pkt_id = pkt_id;
+  ref->cb = (qos > 0) ? NULL : cb;
+  ref->arg = (qos > 0) ? NULL : arg;
+  ref->err = ERR_OK;
+  client->out_ref_ring = (u16_t)(client->out_ref_ring + ref->ring_before);
+  client->out_ref_count++;
+
+  if (r != NULL) {
+    mqtt_append_request(client, r);
+  }
+  mqtt_output_send(client);
   return ERR_OK;
 }
 
@@ -1203,13 +1414,13 @@ mqtt_sub_unsub(mqtt_client_t *client, const char *topic, u8_t qos, mqtt_request_
   }
 
   pkt_id = msg_generate_packet_id(client);
-  r = mqtt_create_request(client->req_list, LWIP_ARRAYSIZE(client->req_list), pkt_id, cb, arg);
+  r = mqtt_create_request(client, pkt_id, cb, arg);
   if (r == NULL) {
     return ERR_MEM;
   }
 
   if (mqtt_output_check_space(&client->output, remaining_length) == 0) {
-    mqtt_delete_request(r);
+    mqtt_delete_request(client, r);
     return ERR_MEM;
   }
 
@@ -1225,8 +1436,8 @@ mqtt_sub_unsub(mqtt_client_t *client, const char *topic, u8_t qos, mqtt_request_
     mqtt_output_append_u8(&client->output, LWIP_MIN(qos, 2));
   }
 
-  mqtt_append_request(&client->pend_req_queue, r);
-  mqtt_output_send(&client->output, client->conn);
+  mqtt_append_request(client, r);
+  mqtt_output_send(client);
   return ERR_OK;
 }
 
@@ -1312,7 +1523,7 @@ mqtt_client_connect(mqtt_client_t *client, const ip_addr_t *ip_addr, u16_t port,
   client->connect_arg = arg;
   client->connect_cb = cb;
   client->keep_alive = client_info->keep_alive;
-  mqtt_init_requests(client->req_list, LWIP_ARRAYSIZE(client->req_list));
+  mqtt_init_requests(client);
 
   /* Build connect message */
   if (client_info->will_topic != NULL && client_info->will_msg != NULL) {
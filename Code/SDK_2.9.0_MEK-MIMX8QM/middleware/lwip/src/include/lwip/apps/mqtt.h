@@ -197,6 +197,8 @@ err_t mqtt_sub_unsub(mqtt_client_t *client, const char *topic, u8_t qos, mqtt_re
 
 err_t mqtt_publish(mqtt_client_t *client, const char *topic, const void *payload, u16_t payload_length, u8_t qos, u8_t retain,
                                     mqtt_request_cb_t cb, void *arg);
+err_t mqtt_publish_ref(mqtt_client_t *client, const char *topic, const void *payload, u32_t payload_length, u8_t qos,
+                       u8_t retain, mqtt_request_cb_t cb, void *arg);
 
 #ifdef __cplusplus
 }
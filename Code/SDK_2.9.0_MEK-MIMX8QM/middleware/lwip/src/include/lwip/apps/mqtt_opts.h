@@ -66,11 +66,23 @@ extern "C" {
 
 /**
  * Maximum number of pending subscribe, unsubscribe and publish requests to server .
+ * This is the window of QoS 1 and 2 publishes which can be pipelined before
+ * the first one is acknowledged, request bookkeeping is O(1) for acknowledges
+ * arriving in order so the window may be made large (up to 255).
  */
 #ifndef MQTT_REQ_MAX_IN_FLIGHT
 #define MQTT_REQ_MAX_IN_FLIGHT 4
 #endif
 
+/**
+ * Maximum number of payloads passed to mqtt_publish_ref() which are not yet
+ * acknowledged by the remote TCP. Payloads sent by reference are not stored in
+ * the output ring-buffer, so MQTT_OUTPUT_RINGBUF_SIZE only has to fit the headers.
+ */
+#ifndef MQTT_OUTPUT_REF_MAX
+#define MQTT_OUTPUT_REF_MAX MQTT_REQ_MAX_IN_FLIGHT
+#endif
+
 /**
  * Seconds between each cyclic timer call.
  */
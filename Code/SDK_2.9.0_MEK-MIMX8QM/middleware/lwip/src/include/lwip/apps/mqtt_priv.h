@@ -48,15 +48,15 @@ extern "C" {
 struct mqtt_request_t
 {
   /** Next item in list, NULL means this is the last in chain,
-      next pointing at itself means request is unallocated */
+      for unallocated requests next item in the free list */
   struct mqtt_request_t *next;
   /** Callback to upper layer */
   mqtt_request_cb_t cb;
   void *arg;
   /** MQTT packet identifier */
   u16_t pkt_id;
-  /** Expire time relative to element before this  */
-  u16_t timeout_diff;
+  /** Expire time, compared with mqtt_client_s::req_clock */
+  u16_t timeout;
 };
 
 /** Ring buffer */
@@ -66,6 +66,24 @@ struct mqtt_ringbuf_t {
   u8_t buf[MQTT_OUTPUT_RINGBUF_SIZE];
 };
 
+/** Payload sent by reference, part of the output stream not stored in the ring buffer */
+struct mqtt_output_ref_t {
+  const u8_t *data;
+  u32_t len;
+  /** Number of bytes of data written to the connection */
+  u32_t written;
+  /** Number of ring buffer bytes to send before data */
+  u16_t ring_before;
+  /** Output stream position after the last byte of data, valid when written == len */
+  u32_t end_pos;
+  /** Packet identifier of the QoS 1 and 2 publish, 0 for QoS 0 */
+  u16_t pkt_id;
+  /** Callback called when data is acknowledged: QoS 0 publish complete, or QoS 1 and 2 publish timed out */
+  mqtt_request_cb_t cb;
+  void *arg;
+  err_t err;
+};
+
 /** MQTT client */
 struct mqtt_client_s
 {
@@ -85,7 +103,11 @@ struct mqtt_client_s
   mqtt_connection_cb_t connect_cb;
   /** Pending requests to server */
   struct mqtt_request_t *pend_req_queue;
+  struct mqtt_request_t *pend_req_last;
+  struct mqtt_request_t *req_free;
   struct mqtt_request_t req_list[MQTT_REQ_MAX_IN_FLIGHT];
+  /** Seconds counter for request timeouts */
+  u16_t req_clock;
   void *inpub_arg;
   /** Incoming data callback */
   mqtt_incoming_data_cb_t data_cb;
@@ -95,6 +117,17 @@ struct mqtt_client_s
   u8_t rx_buffer[MQTT_VAR_HEADER_BUFFER_LEN];
   /** Output ring-buffer */
   struct mqtt_ringbuf_t output;
+  /** Payloads sent by reference, from the oldest not acknowledged one */
+  struct mqtt_output_ref_t out_refs[MQTT_OUTPUT_REF_MAX];
+  u8_t out_ref_first;
+  u8_t out_ref_count;
+  /** Number of out_refs completely written to the connection */
+  u8_t out_ref_written;
+  /** Sum of ring_before of the out_refs not completely written */
+  u16_t out_ref_ring;
+  /** Output stream positions: bytes written to and acknowledged by the connection */
+  u32_t out_written;
+  u32_t out_acked;
 };
 
 #ifdef __cplusplus
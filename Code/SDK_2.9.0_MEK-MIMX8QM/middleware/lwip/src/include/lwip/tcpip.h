@@ -74,11 +74,34 @@ typedef void (*tcpip_callback_fn)(void *ctx);
 /* Forward declarations */
 struct tcpip_callback_msg;
 
+/**
+ * A list of received packets passed to tcpip_thread in a single message.
+ * Packets are appended with tcpip_inpkt_batch_add(): the last pbuf of a packet
+ * is linked to the first pbuf of the next one without updating tot_len, so the
+ * packet boundaries are found again where p->tot_len == p->len. That is the
+ * last pbuf of a packet as long as it is not followed by empty pbufs, which
+ * tcpip_inpkt_batch_add() frees for that reason.
+ */
+struct tcpip_inpkt_batch {
+  /** first pbuf of the first packet */
+  struct pbuf *head;
+  /** last pbuf of the last packet */
+  struct pbuf *tail;
+  /** number of packets in the list */
+  u16_t count;
+};
+
 void   tcpip_init(tcpip_init_done_fn tcpip_init_done, void *arg);
 
 err_t  tcpip_inpkt(struct pbuf *p, struct netif *inp, netif_input_fn input_fn);
 err_t  tcpip_input(struct pbuf *p, struct netif *inp);
 
+void   tcpip_inpkt_batch_init(struct tcpip_inpkt_batch *batch);
+void   tcpip_inpkt_batch_add(struct tcpip_inpkt_batch *batch, struct pbuf *p);
+void   tcpip_inpkt_batch_free(struct tcpip_inpkt_batch *batch);
+err_t  tcpip_inpkt_batch(struct tcpip_inpkt_batch *batch, struct netif *inp, netif_input_fn input_fn);
+err_t  tcpip_input_batch(struct tcpip_inpkt_batch *batch, struct netif *inp);
+
 err_t  tcpip_try_callback(tcpip_callback_fn function, void *ctx);
 err_t  tcpip_callback(tcpip_callback_fn function, void *ctx);
 err_t  tcpip_callback_wait(tcpip_callback_fn function, void *ctx);
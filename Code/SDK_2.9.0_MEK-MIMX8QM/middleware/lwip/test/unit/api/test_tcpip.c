@@ -0,0 +1,162 @@
+#include "test_tcpip.h"
+
+#include "lwip/pbuf.h"
+#include "lwip/netif.h"
+#include "lwip/tcpip.h"
+
+#if !NO_SYS
+
+static struct netif test_netif;
+static int batch_input_ctr;
+static u16_t batch_input_len[4];
+static u16_t batch_input_clen[4];
+
+static err_t
+batch_input(struct pbuf *p, struct netif *inp)
+{
+  fail_unless(inp == &test_netif);
+  fail_unless(batch_input_ctr < (int)LWIP_ARRAYSIZE(batch_input_len));
+  if (batch_input_ctr < (int)LWIP_ARRAYSIZE(batch_input_len)) {
+    batch_input_len[batch_input_ctr] = p->tot_len;
+    batch_input_clen[batch_input_ctr] = pbuf_clen(p);
+  }
+  batch_input_ctr++;
+  pbuf_free(p);
+  return ERR_OK;
+}
+
+/* Setups/teardown functions */
+
+static void
+tcpip_setup(void)
+{
+  batch_input_ctr = 0;
+  memset(batch_input_len, 0, sizeof(batch_input_len));
+  memset(batch_input_clen, 0, sizeof(batch_input_clen));
+  lwip_check_ensure_no_alloc(SKIP_POOL(MEMP_SYS_TIMEOUT));
+}
+
+static void
+tcpip_teardown(void)
+{
+  /* ensure full free heap */
+  lwip_check_ensure_no_alloc(SKIP_POOL(MEMP_SYS_TIMEOUT));
+}
+
+/* Test functions */
+
+/* a packet list is posted in one message and split into its packets again */
+START_TEST(test_tcpip_inpkt_batch)
+{
+  struct tcpip_inpkt_batch batch;
+  struct pbuf *p;
+  err_t err;
+
+  LWIP_UNUSED_ARG(_i);
+
+  tcpip_inpkt_batch_init(&batch);
+  tcpip_inpkt_batch_add(&batch, pbuf_alloc(PBUF_RAW, 100, PBUF_RAM));
+  p = pbuf_alloc(PBUF_RAW, 60, PBUF_RAM);
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 40, PBUF_RAM));
+  tcpip_inpkt_batch_add(&batch, p);
+  tcpip_inpkt_batch_add(&batch, pbuf_alloc(PBUF_RAW, 20, PBUF_RAM));
+  fail_unless(batch.count == 3);
+
+  err = tcpip_inpkt_batch(&batch, &test_netif, batch_input);
+  fail_unless(err == ERR_OK);
+  fail_unless(batch.head == NULL);
+  fail_unless(batch.count == 0);
+  fail_unless(batch_input_ctr == 0);
+
+  fail_unless(tcpip_thread_poll_one() == 1);
+  fail_unless(batch_input_ctr == 3);
+  fail_unless(batch_input_len[0] == 100);
+  fail_unless(batch_input_clen[0] == 1);
+  fail_unless(batch_input_len[1] == 100);
+  fail_unless(batch_input_clen[1] == 2);
+  fail_unless(batch_input_len[2] == 20);
+  fail_unless(batch_input_clen[2] == 1);
+}
+END_TEST
+
+/* empty pbufs inside a packet stay in it, empty pbufs at its end do not start a new packet */
+START_TEST(test_tcpip_inpkt_batch_empty_pbufs)
+{
+  struct tcpip_inpkt_batch batch;
+  struct pbuf *p;
+  err_t err;
+
+  LWIP_UNUSED_ARG(_i);
+
+  tcpip_inpkt_batch_init(&batch);
+  /* 60 + 0 + 40 */
+  p = pbuf_alloc(PBUF_RAW, 60, PBUF_RAM);
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 0, PBUF_RAM));
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 40, PBUF_RAM));
+  tcpip_inpkt_batch_add(&batch, p);
+  /* 50 + 30 + 0 + 0 */
+  p = pbuf_alloc(PBUF_RAW, 50, PBUF_RAM);
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 30, PBUF_RAM));
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 0, PBUF_RAM));
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 0, PBUF_RAM));
+  tcpip_inpkt_batch_add(&batch, p);
+  /* 20 + 0 */
+  p = pbuf_alloc(PBUF_RAW, 20, PBUF_RAM);
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 0, PBUF_RAM));
+  tcpip_inpkt_batch_add(&batch, p);
+  fail_unless(batch.count == 3);
+
+  err = tcpip_inpkt_batch(&batch, &test_netif, batch_input);
+  fail_unless(err == ERR_OK);
+  fail_unless(tcpip_thread_poll_one() == 1);
+  fail_unless(batch_input_ctr == 3);
+  fail_unless(batch_input_len[0] == 100);
+  fail_unless(batch_input_clen[0] == 3);
+  fail_unless(batch_input_len[1] == 80);
+  fail_unless(batch_input_clen[1] == 2);
+  fail_unless(batch_input_len[2] == 20);
+  fail_unless(batch_input_clen[2] == 1);
+}
+END_TEST
+
+/* packets not handed over are freed one by one */
+START_TEST(test_tcpip_inpkt_batch_free)
+{
+  struct tcpip_inpkt_batch batch;
+  struct pbuf *p;
+
+  LWIP_UNUSED_ARG(_i);
+
+  tcpip_inpkt_batch_init(&batch);
+  tcpip_inpkt_batch_add(&batch, pbuf_alloc(PBUF_RAW, 30, PBUF_POOL));
+  p = pbuf_alloc(PBUF_RAW, 30, PBUF_POOL);
+  pbuf_cat(p, pbuf_alloc(PBUF_RAW, 0, PBUF_RAM));
+  tcpip_inpkt_batch_add(&batch, p);
+  tcpip_inpkt_batch_add(&batch, pbuf_alloc(PBUF_RAW, 30, PBUF_POOL));
+  fail_unless(batch.count == 3);
+  tcpip_inpkt_batch_free(&batch);
+  fail_unless(batch.head == NULL);
+  fail_unless(batch.count == 0);
+}
+END_TEST
+
+/** Create the suite including all tests for this module */
+Suite *
+tcpip_suite(void)
+{
+  testfunc tests[] = {
+    TESTFUNC(test_tcpip_inpkt_batch),
+    TESTFUNC(test_tcpip_inpkt_batch_empty_pbufs),
+    TESTFUNC(test_tcpip_inpkt_batch_free),
+  };
+  return create_suite("TCPIP", tests, sizeof(tests)/sizeof(testfunc), tcpip_setup, tcpip_teardown);
+}
+
+#else /* !NO_SYS */
+
+Suite *
+tcpip_suite(void)
+{
+  return create_suite("TCPIP", NULL, 0, NULL, NULL);
+}
+#endif /* !NO_SYS */
@@ -4,6 +4,8 @@
 #include "lwip/apps/mqtt.h"
 #include "lwip/apps/mqtt_priv.h"
 #include "lwip/netif.h"
+#include "lwip/timeouts.h"
+#include "lwip/priv/tcp_priv.h"
 
 const ip_addr_t test_mqtt_local_ip = IPADDR4_INIT_BYTES(192, 168, 1, 1);
 const ip_addr_t test_mqtt_remote_ip = IPADDR4_INIT_BYTES(192, 168, 1, 2);
@@ -68,6 +70,77 @@ static void test_mqtt_connection_cb(mqtt_client_t *client, void *arg, mqtt_conne
   LWIP_UNUSED_ARG(status);
 }
 
+static int test_mqtt_req_done;
+static err_t test_mqtt_req_err;
+
+static void test_mqtt_request_cb(void *arg, err_t err)
+{
+  LWIP_UNUSED_ARG(arg);
+  test_mqtt_req_done++;
+  test_mqtt_req_err = err;
+}
+
+static void
+test_mqtt_rx(mqtt_client_t *client, unsigned char *rxbuf, u16_t len)
+{
+  struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_REF);
+  fail_unless(p != NULL);
+  p->payload = rxbuf;
+  /* since we hack the rx path, we have to hack the rx window, too: */
+  client->conn->rcv_wnd -= p->tot_len;
+  if (client->conn->recv(client->conn->callback_arg, client->conn, p, ERR_OK) != ERR_OK) {
+    pbuf_free(p);
+  }
+}
+
+static mqtt_client_t *
+test_mqtt_connect(struct netif *netif)
+{
+  mqtt_client_t* client;
+  err_t err;
+  struct mqtt_connect_client_info_t client_info = {
+    "dumm",
+    NULL, NULL,
+    10,
+    NULL, NULL, 0, 0
+  };
+  unsigned char connack[] = {0x20, 0x02, 0x00, 0x00};
+
+  test_mqtt_init_netif(netif, &test_mqtt_local_ip, &test_mqtt_netmask);
+
+  client = mqtt_client_new();
+  fail_unless(client != NULL);
+  err = mqtt_client_connect(client, &test_mqtt_remote_ip, 1234, test_mqtt_connection_cb, NULL, &client_info);
+  fail_unless(err == ERR_OK);
+  client->conn->connected(client->conn->callback_arg, client->conn, ERR_OK);
+  test_mqtt_rx(client, connack, sizeof(connack));
+  fail_unless(mqtt_client_is_connected(client));
+  return client;
+}
+
+/* returns 1 if a queued segment of conn references (not copies) data */
+static int
+test_mqtt_tcp_references(struct tcp_pcb *pcb, const u8_t *data, u32_t len)
+{
+  struct tcp_seg *lists[2];
+  int i;
+  lists[0] = pcb->unsent;
+  lists[1] = pcb->unacked;
+  for (i = 0; i < 2; i++) {
+    struct tcp_seg *seg;
+    for (seg = lists[i]; seg != NULL; seg = seg->next) {
+      struct pbuf *q;
+      for (q = seg->p; q != NULL; q = q->next) {
+        const u8_t *pl = (const u8_t *)q->payload;
+        if ((pl >= data) && (pl < data + len)) {
+          return 1;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
 START_TEST(basic_connect)
 {
   mqtt_client_t* client;
@@ -106,10 +179,139 @@ START_TEST(basic_connect)
 }
 END_TEST
 
+START_TEST(publish_ref)
+{
+  mqtt_client_t* client;
+  struct netif netif;
+  static u8_t payload[4 * MQTT_OUTPUT_RINGBUF_SIZE];
+  unsigned char puback[] = {0x40, 0x02, 0x00, 0x00};
+  u16_t pkt_id;
+  LWIP_UNUSED_ARG(_i);
+
+  memset(payload, 0xA5, sizeof(payload));
+  test_mqtt_req_done = 0;
+  client = test_mqtt_connect(&netif);
+
+  /* too large for the ring buffer when copied */
+  fail_unless(mqtt_publish(client, "t", payload, sizeof(payload), 1, 0, test_mqtt_request_cb, NULL) == ERR_MEM);
+
+  /* QoS 1: payload is referenced by TCP, complete on PUBACK */
+  fail_unless(mqtt_publish_ref(client, "t", payload, sizeof(payload), 1, 0, test_mqtt_request_cb, NULL) == ERR_OK);
+  fail_unless(test_mqtt_tcp_references(client->conn, payload, sizeof(payload)));
+  fail_unless(client->pend_req_queue != NULL);
+  pkt_id = client->pend_req_queue->pkt_id;
+  puback[2] = (unsigned char)(pkt_id >> 8);
+  puback[3] = (unsigned char)(pkt_id & 0xff);
+  test_mqtt_rx(client, puback, sizeof(puback));
+  fail_unless(test_mqtt_req_done == 1);
+  fail_unless(test_mqtt_req_err == ERR_OK);
+
+  /* QoS 0: complete once TCP acknowledged the whole payload */
+  client->conn->sent(client->conn->callback_arg, client->conn, (u16_t)(client->out_written - client->out_acked));
+  fail_unless(mqtt_publish_ref(client, "t", payload, sizeof(payload), 0, 0, test_mqtt_request_cb, NULL) == ERR_OK);
+  fail_unless(client->out_ref_count == 1);
+  client->conn->sent(client->conn->callback_arg, client->conn, (u16_t)(client->out_written - client->out_acked - 1));
+  fail_unless(test_mqtt_req_done == 1);
+  client->conn->sent(client->conn->callback_arg, client->conn, 1);
+  fail_unless(test_mqtt_req_done == 2);
+  fail_unless(client->out_ref_count == 0);
+
+  /* disconnecting with a payload still referenced aborts the connection */
+  fail_unless(mqtt_publish_ref(client, "t", payload, sizeof(payload), 0, 0, test_mqtt_request_cb, NULL) == ERR_OK);
+  mqtt_disconnect(client);
+  fail_unless(client->out_ref_count == 0);
+  mqtt_client_free(client);
+}
+END_TEST
+
+START_TEST(publish_ref_timeout)
+{
+  mqtt_client_t* client;
+  struct netif netif;
+  static u8_t payload[4 * MQTT_OUTPUT_RINGBUF_SIZE];
+  int i;
+  LWIP_UNUSED_ARG(_i);
+
+  test_mqtt_req_done = 0;
+  client = test_mqtt_connect(&netif);
+  /* no keep-alive, the server watchdog would close the connection first */
+  client->keep_alive = 0;
+
+  fail_unless(mqtt_publish_ref(client, "t", payload, sizeof(payload), 1, 0, test_mqtt_request_cb, NULL) == ERR_OK);
+
+  /* no PUBACK and no TCP acknowledge: the request times out while TCP still references the payload */
+  for (i = 0; i <= MQTT_REQ_TIMEOUT / MQTT_CYCLIC_TIMER_INTERVAL; i++) {
+    lwip_sys_now += MQTT_CYCLIC_TIMER_INTERVAL * 1000;
+    sys_check_timeouts();
+  }
+  fail_unless(mqtt_client_is_connected(client));
+  fail_unless(client->pend_req_queue == NULL);
+  fail_unless(test_mqtt_tcp_references(client->conn, payload, sizeof(payload)));
+  fail_unless(client->out_ref_count == 1);
+  fail_unless(test_mqtt_req_done == 0);
+
+  /* the timeout is reported once TCP has released the payload */
+  client->conn->sent(client->conn->callback_arg, client->conn, (u16_t)(client->out_written - client->out_acked - 1));
+  fail_unless(test_mqtt_req_done == 0);
+  client->conn->sent(client->conn->callback_arg, client->conn, 1);
+  fail_unless(client->out_ref_count == 0);
+  fail_unless(test_mqtt_req_done == 1);
+  fail_unless(test_mqtt_req_err == ERR_TIMEOUT);
+
+  mqtt_disconnect(client);
+  mqtt_client_free(client);
+}
+END_TEST
+
+START_TEST(publish_window)
+{
+  mqtt_client_t* client;
+  struct netif netif;
+  unsigned char puback[] = {0x40, 0x02, 0x00, 0x00};
+  u16_t pkt_id;
+  int i;
+  LWIP_UNUSED_ARG(_i);
+
+  test_mqtt_req_done = 0;
+  client = test_mqtt_connect(&netif);
+
+  for (i = 0; i < MQTT_REQ_MAX_IN_FLIGHT; i++) {
+    fail_unless(mqtt_publish(client, "t", "x", 1, 1, 0, test_mqtt_request_cb, NULL) == ERR_OK);
+  }
+  fail_unless(mqtt_publish(client, "t", "x", 1, 1, 0, test_mqtt_request_cb, NULL) == ERR_MEM);
+
+  /* acknowledge the last one first, the window opens by one */
+  fail_unless(client->pend_req_last != NULL);
+  pkt_id = client->pend_req_last->pkt_id;
+  puback[2] = (unsigned char)(pkt_id >> 8);
+  puback[3] = (unsigned char)(pkt_id & 0xff);
+  test_mqtt_rx(client, puback, sizeof(puback));
+  fail_unless(test_mqtt_req_done == 1);
+  fail_unless(mqtt_publish(client, "t", "x", 1, 1, 0, test_mqtt_request_cb, NULL) == ERR_OK);
+  fail_unless(mqtt_publish(client, "t", "x", 1, 1, 0, test_mqtt_request_cb, NULL) == ERR_MEM);
+
+  /* acknowledge all in order */
+  while (client->pend_req_queue != NULL) {
+    pkt_id = client->pend_req_queue->pkt_id;
+    puback[2] = (unsigned char)(pkt_id >> 8);
+    puback[3] = (unsigned char)(pkt_id & 0xff);
+    test_mqtt_rx(client, puback, sizeof(puback));
+  }
+  fail_unless(test_mqtt_req_done == MQTT_REQ_MAX_IN_FLIGHT + 1);
+  fail_unless(client->pend_req_last == NULL);
+
+  mqtt_disconnect(client);
+  mqtt_client_free(client);
+}
+END_TEST
+
 Suite* mqtt_suite(void)
 {
   testfunc tests[] = {
     TESTFUNC(basic_connect),
+    TESTFUNC(publish_ref),
+    TESTFUNC(publish_ref_timeout),
+    TESTFUNC(publish_window),
   };
   return create_suite("MQTT", tests, sizeof(tests)/sizeof(testfunc), mqtt_setup, mqtt_teardown);
 }
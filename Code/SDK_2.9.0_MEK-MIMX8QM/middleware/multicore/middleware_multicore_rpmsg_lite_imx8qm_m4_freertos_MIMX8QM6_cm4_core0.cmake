@@ -18,4 +18,6 @@ if(NOT MIDDLEWARE_MULTICORE_RPMSG_LITE_IMX8QM_M4_FREERTOS_MIMX8QM6_cm4_core0_INC
 
     include(middleware_freertos-kernel_heap_4_MIMX8QM6_cm4_core0)
 
+    include(driver_cache_lmem_MIMX8QM6_cm4_core0)
+
 endif()
@@ -98,6 +98,17 @@
 #define RL_CLEAR_USED_BUFFERS (0)
 #endif
 
+//! @def RL_USE_CACHEABLE_BUFFERS
+//!
+//! When enabled the message buffers in the shared memory may be cached:
+//! the messages are cleaned from the cache before they are sent, and
+//! invalidated before they are received. The vrings stay in uncached
+//! memory, and the buffers must start on a cache line.
+//! The default value is 0 (buffers in uncached memory).
+#ifndef RL_USE_CACHEABLE_BUFFERS
+#define RL_USE_CACHEABLE_BUFFERS (0)
+#endif
+
 //! @def RL_USE_MCMGR_IPC_ISR_HANDLER
 //!
 //! When enabled IPC interrupts are managed by the Multicore Manager (IPC
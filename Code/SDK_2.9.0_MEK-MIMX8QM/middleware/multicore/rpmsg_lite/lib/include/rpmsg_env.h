@@ -451,6 +451,28 @@ uint64_t env_get_timestamp(void);
 
 void env_disable_cache(void);
 
+/*!
+ * env_cache_clean_range
+ *
+ * Writes the cached data of a memory range back to the memory,
+ * before the other side reads it.
+ *
+ * @param data - start of the range
+ * @param size - size of the range in bytes
+ */
+void env_cache_clean_range(void *data, uint32_t size);
+
+/*!
+ * env_cache_invalidate_range
+ *
+ * Discards the cached data of a memory range, before reading
+ * what the other side wrote in it.
+ *
+ * @param data - start of the range
+ * @param size - size of the range in bytes
+ */
+void env_cache_invalidate_range(void *data, uint32_t size);
+
 typedef void LOCK;
 
 /*!
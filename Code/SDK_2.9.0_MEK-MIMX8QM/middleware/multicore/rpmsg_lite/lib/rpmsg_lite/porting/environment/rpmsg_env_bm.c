@@ -399,6 +399,32 @@ void env_disable_cache(void)
     platform_cache_disable();
 }
 
+/*!
+ * env_cache_clean_range
+ *
+ * Writes the cached data of a memory range back to the memory.
+ *
+ * @param data - start of the range
+ * @param size - size of the range in bytes
+ */
+void env_cache_clean_range(void *data, uint32_t size)
+{
+    platform_cache_clean_range(data, size);
+}
+
+/*!
+ * env_cache_invalidate_range
+ *
+ * Discards the cached data of a memory range.
+ *
+ * @param data - start of the range
+ * @param size - size of the range in bytes
+ */
+void env_cache_invalidate_range(void *data, uint32_t size)
+{
+    platform_cache_invalidate_range(data, size);
+}
+
 /*========================================================= */
 /* Util data / functions for BM */
 
@@ -13,6 +13,9 @@
 #include "fsl_device_registers.h"
 #include "fsl_mu.h"
 #include "fsl_irqsteer.h"
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+#include "fsl_cache.h"
+#endif
 
 #if defined(RL_USE_ENVIRONMENT_CONTEXT) && (RL_USE_ENVIRONMENT_CONTEXT == 1)
 #error "This RPMsg-Lite port requires RL_USE_ENVIRONMENT_CONTEXT set to 0"
@@ -413,6 +416,34 @@ void platform_cache_disable(void)
 {
 }
 
+/**
+ * platform_cache_clean_range
+ *
+ * Cleans the range from the LMEM cache, or the whole cache when
+ * the range is larger than the cache.
+ *
+ */
+void platform_cache_clean_range(void *data, uint32_t size)
+{
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+    DCACHE_CleanByRangeOrAll((uint32_t)(char *)data, size);
+#endif
+}
+
+/**
+ * platform_cache_invalidate_range
+ *
+ * Invalidates the range in the LMEM cache, or cleans and invalidates
+ * the whole cache when the range is larger than the cache.
+ *
+ */
+void platform_cache_invalidate_range(void *data, uint32_t size)
+{
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+    DCACHE_InvalidateByRangeOrAll((uint32_t)(char *)data, size);
+#endif
+}
+
 /**
  * platform_vatopa
  *
@@ -169,6 +169,13 @@ static void rpmsg_lite_rx_callback(struct virtqueue *vq)
 
     while (rpmsg_msg != RL_NULL)
     {
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+        /* Drop the cached copy of the buffer, the header first to read the payload size. */
+        env_cache_invalidate_range(rpmsg_msg, (uint32_t)sizeof(struct rpmsg_std_hdr));
+        env_cache_invalidate_range(rpmsg_msg->data, (rpmsg_msg->hdr.len <= (uint16_t)RL_BUFFER_PAYLOAD_SIZE) ?
+                                                        (uint32_t)rpmsg_msg->hdr.len :
+                                                        (uint32_t)RL_BUFFER_PAYLOAD_SIZE);
+#endif
         node = rpmsg_lite_get_endpoint_from_addr(rpmsg_lite_dev, rpmsg_msg->hdr.dst);
 
         cb_ret = RL_RELEASE;
@@ -181,6 +188,10 @@ static void rpmsg_lite_rx_callback(struct virtqueue *vq)
         if (cb_ret == RL_HOLD)
         {
             rpmsg_msg->hdr.reserved.idx = idx;
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+            /* The modified header must not be evicted over the next message of the other side. */
+            env_cache_clean_range(rpmsg_msg, (uint32_t)sizeof(struct rpmsg_std_hdr));
+#endif
         }
         else
         {
@@ -298,6 +309,10 @@ static void vq_rx_free_remote(struct virtqueue *rvq, void *buffer, uint32_t len,
     int32_t status;
 #if defined(RL_CLEAR_USED_BUFFERS) && (RL_CLEAR_USED_BUFFERS == 1)
     env_memset(buffer, 0x00, len);
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+    /* The cleared lines must not be evicted over the next message of the other side. */
+    env_cache_clean_range(buffer, len);
+#endif
 #endif
     status = virtqueue_add_consumed_buffer(rvq, idx, len);
     RL_ASSERT(status == VQUEUE_SUCCESS); /* must success here */
@@ -385,6 +400,10 @@ static void vq_rx_free_master(struct virtqueue *rvq, void *buffer, uint32_t len,
     int32_t status;
 #if defined(RL_CLEAR_USED_BUFFERS) && (RL_CLEAR_USED_BUFFERS == 1)
     env_memset(buffer, 0x00, len);
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+    /* The cleared lines must not be evicted over the next message of the other side. */
+    env_cache_clean_range(buffer, len);
+#endif
 #endif
     status = virtqueue_add_buffer(rvq, idx);
     RL_ASSERT(status == VQUEUE_SUCCESS); /* must success here */
@@ -663,6 +682,10 @@ static int32_t rpmsg_lite_format_message(struct rpmsg_lite_instance *rpmsg_lite_
 
     /* Copy data to rpmsg buffer. */
     env_memcpy(rpmsg_msg->data, data, size);
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+    /* Write the message back to the shared memory before the other side reads it. */
+    env_cache_clean_range(rpmsg_msg, (uint32_t)sizeof(struct rpmsg_std_hdr) + size);
+#endif
 
     env_lock_mutex(rpmsg_lite_dev->lock);
     /* Enqueue buffer on virtqueue. */
@@ -797,6 +820,10 @@ int32_t rpmsg_lite_send_nocopy(struct rpmsg_lite_instance *rpmsg_lite_dev,
     rpmsg_msg->hdr.src   = src;
     rpmsg_msg->hdr.len   = (uint16_t)size;
     rpmsg_msg->hdr.flags = (uint16_t)RL_NO_FLAGS;
+#if defined(RL_USE_CACHEABLE_BUFFERS) && (RL_USE_CACHEABLE_BUFFERS == 1)
+    /* Write the message back to the shared memory before the other side reads it. */
+    env_cache_clean_range(rpmsg_msg, (uint32_t)sizeof(struct rpmsg_std_hdr) + size);
+#endif
 
     env_lock_mutex(rpmsg_lite_dev->lock);
     /* Enqueue buffer on virtqueue. */